@@ -473,6 +473,9 @@ FXint Adie::start(int argc,char** argv){
   // The registry has been loaded after this
   init(argc,argv);
 
+  // Start worker threads for background restyling and searching
+  pool.start();
+
   // Make a tool tip
   new FXToolTip(this,0);
 
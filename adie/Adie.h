@@ -45,6 +45,7 @@ protected:
   FXFileAssociations *associations;             // File association table
   SyntaxList          syntaxes;                 // List of syntax patterns
   FXString            syntaxpaths;              // Where to look for syntax file
+  FXThreadPool        pool;                     // Threads for background work
   FXIcon             *bigicon;                  // Big application icon
   FXIcon             *smallicon;                // Small application icon
   FXIcon             *newicon;
@@ -179,6 +180,9 @@ public:
   // Generate unique name from given path
   FXString unique(const FXString& path) const;
 
+  // Get thread pool for background work
+  FXThreadPool* getThreadPool(){ return &pool; }
+
   // Set syntax paths
   void setSyntaxPaths(const FXString& paths){ syntaxpaths=paths; }
 
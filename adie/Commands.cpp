@@ -42,7 +42,11 @@
     removing an entire line.
   - For now, we limit the undo-merging to single character modifications as
     these are occurring during text enty.  The idea is to not undo/redo over
-    trivial modifications.
+    trivial modifications.  Note a single character may be a multi-byte UTF8
+    sequence.
+  - The replace command keeps deleted and inserted text in a single buffer;
+    since a global replace generates many small replace records, this saves
+    one string allocation per record.
   - When manipulating text widget, we generate callbacks even when changing
     the text via undo or redo.
   - During the execution of an undo or redo, FXUndoList is marked as busy;
@@ -58,6 +62,13 @@
 */
 
 
+/*******************************************************************************/
+
+// Return true if text is empty or a single, possibly multi-byte, character
+static FXbool singleChar(const FXchar* str,FXint num){
+  return num<=1 || num==wclen(str);
+  }
+
 /*******************************************************************************/
 
 FXIMPLEMENT_ABSTRACT(FXTextCommand,FXCommand,nullptr,0)
@@ -87,7 +98,7 @@ FXIMPLEMENT_ABSTRACT(FXTextInsert,FXTextCommand,nullptr,0)
 
 
 // Insert command
-FXTextInsert::FXTextInsert(FXText* txt,FXint p,FXint ni,const FXchar* ins):FXTextCommand(txt,p,(ni==1)),inserted(ins,ni){
+FXTextInsert::FXTextInsert(FXText* txt,FXint p,FXint ni,const FXchar* ins):FXTextCommand(txt,p,(0<ni && singleChar(ins,ni))),inserted(ins,ni){
   }
 
 
@@ -116,15 +127,15 @@ FXuint FXTextInsert::mergeWith(FXCommand* command){
   const FXushort PROPERTIES=Ascii::Word|Ascii::Blank|Ascii::Punct|Ascii::Digit;
   if(text->isModified()){
     FXTextInsert* txtins=dynamic_cast<FXTextInsert*>(command);
-    if(txtins && txtins->inserted.length()==1 && txtins->pos==pos+inserted.length()){
+    if(txtins && txtins->canMerge() && txtins->pos==pos+inserted.length()){
       if(((Ascii::charProperties(inserted.tail())^Ascii::charProperties(txtins->inserted.tail()))&PROPERTIES)==0){
         inserted.append(txtins->inserted);
         return 1;
         }
       }
     FXTextDelete* txtdel=dynamic_cast<FXTextDelete*>(command);
-    if(txtdel && txtdel->deleted.length()==1 && txtdel->pos==pos+inserted.length()-1){
-      inserted.erase(txtdel->pos-pos,1);
+    if(txtdel && txtdel->canMerge() && pos<=txtdel->pos && txtdel->pos+txtdel->deleted.length()==pos+inserted.length()){
+      inserted.erase(txtdel->pos-pos,txtdel->deleted.length());
       if(inserted.length()==0) return 2;
       return 1;
       }
@@ -159,7 +170,7 @@ FXIMPLEMENT_ABSTRACT(FXTextDelete,FXTextCommand,nullptr,0)
 
 
 // Delete command
-FXTextDelete::FXTextDelete(FXText* txt,FXint p,FXint nd,const FXchar* del):FXTextCommand(txt,p,(nd==1)),deleted(del,nd){
+FXTextDelete::FXTextDelete(FXText* txt,FXint p,FXint nd,const FXchar* del):FXTextCommand(txt,p,(0<nd && singleChar(del,nd))),deleted(del,nd){
   }
 
 
@@ -185,7 +196,7 @@ FXString FXTextDelete::redoName() const {
 FXuint FXTextDelete::mergeWith(FXCommand* command){
   if(text->isModified()){
     FXTextDelete* txtdel=dynamic_cast<FXTextDelete*>(command);
-    if(txtdel && txtdel->deleted.length()==1){
+    if(txtdel && txtdel->canMerge()){
       if(txtdel->pos==pos){
         deleted.append(txtdel->deleted);
         return 1;
@@ -226,13 +237,14 @@ FXIMPLEMENT_ABSTRACT(FXTextReplace,FXTextCommand,nullptr,0)
 
 
 // Replace command
-FXTextReplace::FXTextReplace(FXText* txt,FXint p,FXint nd,FXint ni,const FXchar* del,const FXchar* ins):FXTextCommand(txt,p,((nd|ni)==1)),deleted(del,nd),inserted(ins,ni){
+FXTextReplace::FXTextReplace(FXText* txt,FXint p,FXint nd,FXint ni,const FXchar* del,const FXchar* ins):FXTextCommand(txt,p,(0<(nd|ni) && singleChar(del,nd) && singleChar(ins,ni))),buffer(del,nd),ndeleted(nd){
+  buffer.append(ins,ni);
   }
 
 
 // Return size of record plus any data kept here
 FXuval FXTextReplace::size() const {
-  return sizeof(FXTextReplace)+deleted.length()+inserted.length();
+  return sizeof(FXTextReplace)+buffer.length();
   }
 
 
@@ -252,10 +264,11 @@ FXString FXTextReplace::redoName() const {
 FXuint FXTextReplace::mergeWith(FXCommand* command){
   if(text->isModified()){
     FXTextReplace* txtrep=dynamic_cast<FXTextReplace*>(command);
-    if(txtrep && txtrep->deleted.length()==1 && txtrep->inserted.length()==1){
-      if(txtrep->pos==pos+inserted.length()){
-        deleted.append(txtrep->deleted);
-        inserted.append(txtrep->inserted);
+    if(txtrep && txtrep->canMerge() && 0<txtrep->ndeleted && txtrep->ndeleted<txtrep->buffer.length()){
+      if(txtrep->pos==pos+buffer.length()-ndeleted){
+        buffer.insert(ndeleted,txtrep->buffer.text(),txtrep->ndeleted);
+        buffer.append(txtrep->buffer.text()+txtrep->ndeleted,txtrep->buffer.length()-txtrep->ndeleted);
+        ndeleted+=txtrep->ndeleted;
         return 1;
         }
       }
@@ -266,17 +279,19 @@ FXuint FXTextReplace::mergeWith(FXCommand* command){
 
 // Undo a replace reinserts the old text
 void FXTextReplace::undo(){
-  text->replaceText(pos,inserted.length(),deleted,true);
-  text->setCursorPos(pos+deleted.length());
-  text->makePositionVisible(pos+deleted.length());
+  FXint ninserted=buffer.length()-ndeleted;
+  text->replaceText(pos,ninserted,buffer.text(),ndeleted,true);
+  text->setCursorPos(pos+ndeleted);
+  text->makePositionVisible(pos+ndeleted);
   }
 
 
 // Redo a replace reinserts the new text
 void FXTextReplace::redo(){
-  text->replaceText(pos,deleted.length(),inserted,true);
-  text->setCursorPos(pos+inserted.length());
-  text->makePositionVisible(pos+inserted.length());
+  FXint ninserted=buffer.length()-ndeleted;
+  text->replaceText(pos,ndeleted,buffer.text()+ndeleted,ninserted,true);
+  text->setCursorPos(pos+ninserted);
+  text->makePositionVisible(pos+ninserted);
   }
 
 
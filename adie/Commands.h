@@ -82,8 +82,8 @@ class FXTextReplace : public FXTextCommand {
   friend class FXTextInsert;
   friend class FXTextDelete;
 protected:
-  FXString deleted;
-  FXString inserted;
+  FXString buffer;      // Deleted text followed by inserted text
+  FXint    ndeleted;    // Length of deleted text
 public:
   FXTextReplace(FXText* txt,FXint p,FXint nd,FXint ni,const FXchar* del,const FXchar* ins);
   virtual FXuval size() const;
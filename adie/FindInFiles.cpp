@@ -43,10 +43,27 @@
     filter of TextWindow.
   - Remembering current pattern and search text would be nice, for repeated
     invocations.  Maybe some more tweaks.
+  - Searching is done on the thread pool, in a pipeline: one task walks the
+    folders, and hands each matching file off to a task which reads and scans
+    it.  At most MAXSEARCHTASKS file tasks are pending at any time; when none
+    is available, the walker searches the file itself.  Thus the walker never
+    blocks, even if it has the only worker thread.
+  - Hits are collected under a mutex; the first hit collected after the dialog
+    picked up the previous batch wakes up the GUI through the message channel.
+    Thus, hits are delivered in batches, and the channel never fills up.
+  - Pausing stops the walker; files already handed off are still searched.
+    Stopping also makes the file tasks bail out early.
+  - Files are scanned for candidate positions first: the pattern's first-byte
+    set tells which bytes a match could start with.  If that's just one byte,
+    memchr() skips ahead; otherwise a table lookup does.  The regex is only
+    tried at candidates, and after a hit, scanning resumes on the next line.
+  - Line numbers are computed lazily: newlines between the previous hit and
+    the current one are counted a word at a time, only when a hit is found.
 */
 
-#define HORZ_PAD      12
-#define VERT_PAD      2
+#define HORZ_PAD        12
+#define VERT_PAD        2
+#define MAXSEARCHTASKS  32      // Maximum pending file search tasks
 
 /*******************************************************************************/
 
@@ -111,20 +128,23 @@ static const FXchar mkey[20][3]={
 
 /*******************************************************************************/
 
-// Traverse files under path and search for pattern in each
-FXuint SearchVisitor::traverse(const FXString& path,const FXString& pattern,const FXString& wild,FXint mode,FXuint opts,FXint depth){
-  FXTRACE((1,"SearchVisitor::traverse(path=%s,pattern=%s,wild=%s,mode=%b,opts=%b,depth=%d)\n",path.text(),pattern.text(),wild.text(),mode,opts,depth));
-
-  // Compile the pattern
+// Set pattern to search for
+FXbool SearchVisitor::setPattern(const FXString& pattern,FXint mode){
+  FXTRACE((1,"SearchVisitor::setPattern(pattern=%s,mode=%b)\n",pattern.text(),mode));
   if(rex.parse(pattern,mode)==FXRex::ErrOK){
-
-    // Sensitize controls; in case GUI-update can't get in sideways
-    dlg->forceRefresh();
-
-    // Traverse directory and visit the files
-    return FXGlobVisitor::traverse(path,wild,opts,depth);
+    FXuchar set[32];
+    rex.firstSet(set);
+    leader=-1;
+    nleaders=0;
+    for(FXint c=0; c<256; ++c){
+      leaders[c]=(set[c>>3]>>(c&7))&1;
+      if(leaders[c]){ leader=c; nleaders++; }
+      }
+    if(nleaders!=1) leader=-1;
+    FXTRACE((1,"SearchVisitor::setPattern: leader=%d nleaders=%d\n",leader,nleaders));
+    return true;
     }
-  return 0;
+  return false;
   }
 
 
@@ -136,41 +156,86 @@ void SearchVisitor::setLimit(FXlong size){
 
 // Visit file
 FXuint SearchVisitor::visit(const FXString& path){
-  if(!dlg->continueProcessing()) return 2;
+  if(!searcher->continueProcessing()) return 2;
   if(FXGlobVisitor::visit(path)){
-    if(searchFile(path)) return 1;
+    searcher->schedule(path);
     }
   return 0;
   }
 
 
+// Count newlines in range [beg,end>, a word at a time
+static FXint countLines(const FXuchar* beg,const FXuchar* end){
+  const FXulong ones=FXULONG(0x0101010101010101);
+  const FXulong high=FXULONG(0x8080808080808080);
+  const FXulong nl=ones*'\n';
+  FXulong w,t;
+  FXint count=0;
+  while(beg+8<=end){
+    memcpy(&w,beg,8);
+    w^=nl;                                      // Newlines become zero bytes
+    t=((w&~high)+~high)|w;                      // High bit clear only in zero bytes
+    count+=(FXint)pop64(~t&high);
+    beg+=8;
+    }
+  while(beg<end){
+    count+=(*beg++=='\n');
+    }
+  return count;
+  }
+
+
+// Return first position at or after pos where a match could start, or len
+FXint SearchVisitor::nextCandidate(const FXuchar* ptr,FXint pos,FXint len) const {
+  if(0<=leader){
+    const FXuchar* p=(const FXuchar*)memchr(ptr+pos,leader,len-pos);
+    return p?(FXint)(p-ptr):len;
+    }
+  if(nleaders<256){
+    while(pos<len && !leaders[ptr[pos]]) ++pos;
+    }
+  return pos;
+  }
+
+
 // Search file contents for pattern
-FXint SearchVisitor::searchFile(const FXString& path) const {
+FXint SearchVisitor::searchFile(const FXString& path,SearchHitList& hits) const {
   FXString text;
   FXTRACE((1,"searchFile(path=%s)\n",path.text()));
   if(loadFile(path,text)){
-    FXString relpath=FXPath::relative(dlg->getDirectory(),path);
-    FXString hit;
-    FXint beg[10],end[10],ls,le,p;
+    FXString relpath=FXPath::relative(folder,path);
+    const FXuchar* ptr=(const FXuchar*)text.text();
+    const FXuchar* nl;
+    FXint beg[10],end[10],ls,le,p,n;
+    FXint len=text.length();
     FXint lineno=1;
     FXint column=0;
+    FXint mark=0;
     FXint pos=0;
-    FXTRACE((1,"loadFile(path=%s) -> %d bytes\n",relpath.text(),text.length()));
-    dlg->setSearchingText(relpath);
-    while(pos<text.length()){
+    FXTRACE((1,"loadFile(path=%s) -> %d bytes\n",relpath.text(),len));
+    while(pos<len && !searcher->isStopped()){
+      if((pos=nextCandidate(ptr,pos,len))>=len) break;                  // Skip to next candidate
       if(rex.amatch(text,pos,FXRex::Normal,beg,end,10)){
-        for(ls=beg[0]; 0<ls && text[ls-1]!='\n'; --ls){ }               // Back up to line start
-        for(le=beg[0]; le<text.length() && text[le]!='\n'; ++le){ }     // Advance to line end
+        for(ls=beg[0]; 0<ls && ptr[ls-1]!='\n'; --ls){ }                // Back up to line start
+        nl=(const FXuchar*)memchr(ptr+beg[0],'\n',len-beg[0]);         // Advance to line end
+        le=nl?(FXint)(nl-ptr):len;
         for(p=ls,column=0; p<beg[0]; p=text.inc(p)){                    // Count columns, assuming for now tabs are set at 8
           column+=(text[p]=='\t')?8-column%8:1;
           }
-        hit.assign(&text[ls],le-ls);
-        hit.trim();
-        dlg->appendSearchResult(relpath,hit,lineno,column);
-        if(dlg->getFirstHit()) break;
-        pos=le;
+        lineno+=countLines(ptr+mark,ptr+ls);                            // Count lines since last hit
+        mark=ls;
+        n=hits.no();
+        if(!hits.no(n+1)) break;
+        hits[n].relpath=relpath;
+        hits[n].text.assign(&text[ls],le-ls);
+        hits[n].text.trim();
+        hits[n].lineno=lineno;
+        hits[n].column=column;
+        if(firsthit) break;
+        pos=le+1;                                                       // Resume on next line
+        continue;
         }
-      lineno+=(text[pos++]=='\n');              // Moved to next line
+      pos++;
       }
     }
   return 0;
@@ -193,8 +258,203 @@ FXlong SearchVisitor::loadFile(const FXString& path,FXString& text) const {
 
 /*******************************************************************************/
 
+// Walks the folders
+class WalkTask : public FXRunnable {
+private:
+  Searcher *searcher;           // Searcher we work for
+  FXString  path;               // Folder to search
+  FXString  wild;               // Wildcard for files to search
+  FXuint    opts;               // Matching options
+  FXint     depth;              // Recursion limit
+private:
+  WalkTask(const WalkTask&);
+  WalkTask &operator=(const WalkTask&);
+public:
+  WalkTask(Searcher* s,const FXString& p,const FXString& w,FXuint o,FXint d):searcher(s),path(p),wild(w),opts(o),depth(d){ searcher->enter(); }
+  virtual FXint run(){ searcher->visitor.traverse(path,wild,opts,depth); delete this; return 0; }
+  virtual ~WalkTask(){ searcher->leave(); }
+  };
+
+
+// Reads and searches one file
+class SearchTask : public FXRunnable {
+private:
+  Searcher *searcher;           // Searcher we work for
+  FXString  path;               // File to search
+private:
+  SearchTask(const SearchTask&);
+  SearchTask &operator=(const SearchTask&);
+public:
+  SearchTask(Searcher* s,const FXString& p):searcher(s),path(p){ searcher->enter(); }
+  virtual FXint run(){ searcher->searchFile(path); delete this; return 0; }
+  virtual ~SearchTask(){ searcher->slots.post(); searcher->leave(); }
+  };
+
+/*******************************************************************************/
+
+// Map
+FXDEFMAP(Searcher) SearcherMap[]={
+  FXMAPFUNC(SEL_COMMAND,Searcher::ID_SEARCHED,Searcher::onCmdSearched),
+  };
+
+
+// Object implementation
+FXIMPLEMENT(Searcher,FXMessageChannel,SearcherMap,ARRAYNUMBER(SearcherMap))
+
+
+// Construct searcher
+Searcher::Searcher(FindInFiles* dlg,FXThreadPool* p):FXMessageChannel(dlg->getApp()),visitor(this),slots(MAXSEARCHTASKS),dialog(dlg),pool(p),running(0),notified(false),finished(false),paused(false),active(false),cancelled(false){
+  FXTRACE((10,"Searcher::Searcher(%p,%p)\n",dlg,p));
+  }
+
+
+// Start searching files matching wild under path for pattern
+FXbool Searcher::start(const FXString& path,const FXString& pattern,const FXString& wild,FXint mode,FXuint opts,FXint depth,FXbool first){
+  FXTRACE((1,"Searcher::start(path=%s,pattern=%s,wild=%s,mode=%b,opts=%b,depth=%d)\n",path.text(),pattern.text(),wild.text(),mode,opts,depth));
+  stop();
+  tasks.wait();
+  if(visitor.setPattern(pattern,mode)){
+    visitor.setFolder(path);
+    visitor.setFirstHit(first);
+    mutex.lock();
+    hits.clear();
+    current.clear();
+    finished=false;
+    paused=false;
+    cancelled=false;
+    mutex.unlock();
+    WalkTask *task=new WalkTask(this,path,wild,opts,depth);
+    if(pool->execute(task)){
+      active=true;
+      return true;
+      }
+    delete task;
+    }
+  return false;
+  }
+
+
+// Called by walker to see if we should continue processing
+FXbool Searcher::continueProcessing(){
+  FXScopedMutex locker(mutex);
+  while(paused && !cancelled){
+    resumed.wait(mutex);
+    }
+  return !cancelled;
+  }
+
+
+// Search file on a worker thread, or right here if no slot is free
+void Searcher::schedule(const FXString& path){
+  if(slots.trywait()){
+    SearchTask *task=new SearchTask(this,path);
+    if(pool->execute(task,0)) return;
+    delete task;
+    }
+  searchFile(path);
+  }
+
+
+// Search file, and hand over the hits
+void Searcher::searchFile(const FXString& path){
+  SearchHitList list;
+  if(!cancelled){
+    visitor.searchFile(path,list);
+    FXScopedMutex locker(mutex);
+    hits.append(list.data(),list.no());
+    current=FXPath::relative(visitor.getFolder(),path);
+    notify();
+    }
+  }
+
+
+// Task starts
+void Searcher::enter(){
+  tasks.increment();
+  FXScopedMutex locker(mutex);
+  running++;
+  }
+
+
+// Task ends; the last one tells the dialog
+void Searcher::leave(){
+  mutex.lock();
+  if(--running==0){
+    finished=true;
+    notify();
+    }
+  mutex.unlock();
+  tasks.decrement();
+  }
+
+
+// Wake up the dialog, unless already done; mutex must be held
+void Searcher::notify(){
+  if(!notified){
+    message(this,FXSEL(SEL_COMMAND,ID_SEARCHED));
+    notified=true;
+    }
+  }
+
+
+// Pause or resume search
+void Searcher::pause(FXbool flag){
+  FXScopedMutex locker(mutex);
+  paused=flag;
+  resumed.broadcast();
+  }
+
+
+// Stop search
+void Searcher::stop(){
+  FXScopedMutex locker(mutex);
+  cancelled=true;
+  paused=false;
+  resumed.broadcast();
+  }
+
+
+// Pick up search hits, and show them in the dialog
+long Searcher::onCmdSearched(FXObject*,FXSelector,void*){
+  SearchHitList list;
+  FXString file;
+  FXbool done;
+  mutex.lock();
+  list.adopt(hits);
+  file=current;
+  done=finished;
+  finished=false;
+  notified=false;
+  mutex.unlock();
+  for(FXival i=0; i<list.no(); ++i){
+    dialog->appendSearchResult(list[i].relpath,list[i].text,list[i].lineno,list[i].column);
+    }
+  if(done){
+    dialog->setSearchingText(dialog->tr("<stopped>"));
+    active=false;
+    getApp()->refresh();
+    }
+  else if(!file.empty()){
+    dialog->setSearchingText(file);
+    }
+  return 1;
+  }
+
+
+// Stop, and wait for worker threads to finish
+Searcher::~Searcher(){
+  FXTRACE((10,"Searcher::~Searcher()\n"));
+  stop();
+  tasks.wait();
+  dialog=(FindInFiles*)-1L;
+  pool=(FXThreadPool*)-1L;
+  }
+
+/*******************************************************************************/
+
 // For deserialization
-FindInFiles::FindInFiles():visitor(this){
+FindInFiles::FindInFiles(){
+  searcher=nullptr;
   locations=nullptr;
   findstring=nullptr;
   filefolder=nullptr;
@@ -207,13 +467,15 @@ FindInFiles::FindInFiles():visitor(this){
   savedsearchmode=0;
   savedcurrentpattern=0;
   index=-1;
-  proceed=1;
   firsthit=false;
   }
 
 
 // Construct file in files dialog
-FindInFiles::FindInFiles(Adie *a):FXDialogBox(a,"Find In Files",DECOR_TITLE|DECOR_BORDER|DECOR_RESIZE|DECOR_CLOSE,0,0,600,400, 10,10,10,10, 10,10),visitor(this){
+FindInFiles::FindInFiles(Adie *a):FXDialogBox(a,"Find In Files",DECOR_TITLE|DECOR_BORDER|DECOR_RESIZE|DECOR_CLOSE,0,0,600,400, 10,10,10,10, 10,10){
+
+  // Searcher, running on application's thread pool
+  searcher=new Searcher(this,a->getThreadPool());
 
   // Buttons at bottom
   FXHorizontalFrame* bottomline=new FXHorizontalFrame(this,LAYOUT_SIDE_BOTTOM|LAYOUT_FILL_X,0,0,0,0,0,0,0,0);
@@ -294,7 +556,6 @@ FindInFiles::FindInFiles(Adie *a):FXDialogBox(a,"Find In Files",DECOR_TITLE|DECO
   savedsearchmode=0;
   savedcurrentpattern=0;
   index=-1;
-  proceed=1;
   firsthit=false;
   }
 
@@ -374,21 +635,13 @@ void FindInFiles::create(){
 
 // Close window
 FXbool FindInFiles::close(FXbool notify){
+  searcher->stop();
   writeRegistry();
   return FXDialogBox::close(notify);
   }
 
 
-// Called by visitor to see if we should continue processing
-FXbool FindInFiles::continueProcessing(){
-  getApp()->refresh();
-  getApp()->runModalWhileEvents(pausebutton,1000000L);
-  getApp()->runUntil(proceed);
-  return (proceed!=2);
-  }
-
-
-// Called by visitor to deposit new search result
+// Called by searcher to deposit new search result
 // List will show filename relativized to base name, and location of where string was found
 void FindInFiles::appendSearchResult(const FXString& relpath,const FXString& text,FXint lineno,FXint column){
   FXString string;
@@ -521,29 +774,29 @@ FXString FindInFiles::getSearchingText() const {
 
 // Update stop button
 long FindInFiles::onUpdStop(FXObject* sender,FXSelector,void*){
-  sender->handle(this,proceed?FXSEL(SEL_COMMAND,ID_DISABLE):FXSEL(SEL_COMMAND,ID_ENABLE),nullptr);
+  sender->handle(this,(searcher->isSearching() && !searcher->isStopped())?FXSEL(SEL_COMMAND,ID_ENABLE):FXSEL(SEL_COMMAND,ID_DISABLE),nullptr);
   return 1;
   }
 
 
 // Stop scanning disk
 long FindInFiles::onCmdStop(FXObject*,FXSelector,void*){
-  proceed=2;
+  searcher->stop();
   return 1;
   }
 
 
 // Update pause/resume button
 long FindInFiles::onUpdPause(FXObject* sender,FXSelector,void*){
-  sender->handle(this,(proceed==0)?FXSEL(SEL_COMMAND,ID_CHECK):FXSEL(SEL_COMMAND,ID_UNCHECK),nullptr);
-  sender->handle(this,visitor.visiting()?FXSEL(SEL_COMMAND,ID_ENABLE):FXSEL(SEL_COMMAND,ID_DISABLE),nullptr);
+  sender->handle(this,searcher->isPaused()?FXSEL(SEL_COMMAND,ID_CHECK):FXSEL(SEL_COMMAND,ID_UNCHECK),nullptr);
+  sender->handle(this,(searcher->isSearching() && !searcher->isStopped())?FXSEL(SEL_COMMAND,ID_ENABLE):FXSEL(SEL_COMMAND,ID_DISABLE),nullptr);
   return 1;
   }
 
 
 // Pause/resume
 long FindInFiles::onCmdPause(FXObject*,FXSelector,void*){
-  proceed=(proceed==1)?0:1;
+  searcher->pause(!searcher->isPaused());
   return 1;
   }
 
@@ -564,7 +817,7 @@ long FindInFiles::onCmdDelete(FXObject*,FXSelector,void*){
 
 // Grey out buttons if no search text
 long FindInFiles::onUpdSearch(FXObject* sender,FXSelector,void*){
-  FXbool enabled=!visitor.visiting() && !findstring->getText().empty();
+  FXbool enabled=!searcher->isSearching() && !findstring->getText().empty();
   sender->handle(this,enabled?FXSEL(SEL_COMMAND,ID_ENABLE):FXSEL(SEL_COMMAND,ID_DISABLE),nullptr);
   return 1;
   }
@@ -581,10 +834,9 @@ long FindInFiles::onCmdSearch(FXObject*,FXSelector,void*){
   if(getSearchMode()&SeachHidden) opts|=FXDir::HiddenFiles|FXDir::HiddenDirs;   // Visit hidden files and directories
   if(!(getSearchMode()&SearchRecurse)) limit=2;                                 // Don't recurse
   appendHistory(getSearchText(),getDirectory(),getCurrentPattern(),getSearchMode());
-  proceed=1;
-  visitor.traverse(getDirectory(),getSearchText(),getPattern(),rexmode,opts,limit);
-  setSearchingText(tr("<stopped>"));
-  getApp()->refresh();
+  if(!searcher->start(getDirectory(),getSearchText(),getPattern(),rexmode,opts,limit,getFirstHit())){
+    getApp()->beep();
+    }
   return 1;
   }
 
@@ -753,6 +1005,8 @@ long FindInFiles::onCmdFileDblClicked(FXObject*,FXSelector,void* ptr){
 
 // Clean up
 FindInFiles::~FindInFiles(){
+  delete searcher;
+  searcher=(Searcher*)-1L;
   locations=(FXIconList*)-1L;
   findstring=(FXTextField*)-1L;
   filefolder=(FXTextField*)-1L;
@@ -24,17 +24,36 @@
 
 class Adie;
 class FindInFiles;
+class Searcher;
+
+
+// Search hit
+struct SearchHit {
+  FXString      relpath;        // File, relative to search folder
+  FXString      text;           // Text of line with hit
+  FXint         lineno;         // Line number of hit
+  FXint         column;         // Column of hit
+  };
+
+
+// List of search hits
+typedef FXArray<SearchHit> SearchHitList;
 
 
 /// Directory search visitor
 class SearchVisitor : public FXGlobVisitor {
 private:
-  FindInFiles* dlg;     // Find dialog
-  FXRex        rex;     // Regex parser
-  FXlong       limit;   // File size limit
+  Searcher*    searcher;        // Searcher we work for
+  FXRex        rex;             // Regex parser
+  FXString     folder;          // Folder being searched
+  FXlong       limit;           // File size limit
+  FXint        leader;          // Only byte a match can start with, or -1
+  FXint        nleaders;        // Number of bytes a match can start with
+  FXbool       firsthit;        // Record only first hit in file
+  FXuchar      leaders[256];    // Bytes a match can start with
 private:
   FXlong loadFile(const FXString& path,FXString& text) const;
-  FXint searchFile(const FXString& path) const;
+  FXint nextCandidate(const FXuchar* ptr,FXint pos,FXint len) const;
 private:
   SearchVisitor();
   SearchVisitor(const SearchVisitor&);
@@ -42,10 +61,16 @@ private:
 public:
 
   // Construct search file for pattern visitor
-  SearchVisitor(FindInFiles* dg):dlg(dg),limit(100000000L){ }
+  SearchVisitor(Searcher* s):searcher(s),limit(100000000L),leader(-1),nleaders(256),firsthit(false){ }
 
-  // Traverse files under path and search for pattern in each
-  FXuint traverse(const FXString& path,const FXString& pattern,const FXString& wild="*",FXint mode=FXRex::Normal,FXuint opts=FXDir::MatchAll,FXint depth=1000);
+  // Set pattern to search for; return false if pattern is bad
+  FXbool setPattern(const FXString& pattern,FXint mode=FXRex::Normal);
+
+  // Set folder under which files are searched
+  void setFolder(const FXString& path){ folder=path; }
+
+  // Get folder under which files are searched
+  const FXString& getFolder() const { return folder; }
 
   // Set file size limit
   void setLimit(FXlong size);
@@ -53,16 +78,95 @@ public:
   // Get file size limit
   FXlong getLimit() const { return limit; }
 
+  // Set first hit only flag
+  void setFirstHit(FXbool flag){ firsthit=flag; }
+
+  // Get first hit only flag
+  FXbool getFirstHit() const { return firsthit; }
+
+  // Search file for pattern, and append hits to list
+  FXint searchFile(const FXString& path,SearchHitList& hits) const;
+
   // Visit given file and scan it
   virtual FXuint visit(const FXString& path);
   };
 
 
+// Background search of files
+class Searcher : public FXMessageChannel {
+  FXDECLARE(Searcher)
+  friend class SearchVisitor;
+  friend class SearchTask;
+  friend class WalkTask;
+private:
+  SearchVisitor     visitor;    // Walks the folders
+  FXCompletion      tasks;      // Running search tasks
+  FXSemaphore       slots;      // Free slots for file search tasks
+  FXMutex           mutex;      // Guards state below
+  FXCondition       resumed;    // Signalled when resumed or stopped
+  SearchHitList     hits;       // Hits ready for pickup
+  FXString          current;    // File searched last
+  FindInFiles      *dialog;     // Dialog showing hits
+  FXThreadPool     *pool;       // Pool of worker threads
+  FXint             running;    // Number of walk and search tasks
+  FXbool            notified;   // Dialog has been notified
+  FXbool            finished;   // Last task has finished
+  FXbool            paused;     // Search is paused
+  FXbool            active;     // Search in progress, as far as dialog knows
+  volatile FXbool   cancelled;  // Search has been stopped
+private:
+  Searcher():visitor(this){}
+  Searcher(const Searcher&);
+  Searcher &operator=(const Searcher&);
+  FXbool continueProcessing();
+  void schedule(const FXString& path);
+  void searchFile(const FXString& path);
+  void enter();
+  void leave();
+  void notify();
+public:
+  long onCmdSearched(FXObject*,FXSelector,void*);
+public:
+  enum {
+    ID_SEARCHED=FXMessageChannel::ID_LAST,
+    ID_LAST
+    };
+public:
+
+  // Construct searcher for dialog, running on thread pool
+  Searcher(FindInFiles* dlg,FXThreadPool* p);
+
+  // Access visitor
+  SearchVisitor& getVisitor(){ return visitor; }
+
+  // Start searching files matching wild under path for pattern
+  FXbool start(const FXString& path,const FXString& pattern,const FXString& wild="*",FXint mode=FXRex::Normal,FXuint opts=FXDir::MatchAll,FXint depth=1000,FXbool first=false);
+
+  // Return true if search is in progress
+  FXbool isSearching() const { return active; }
+
+  // Pause or resume search
+  void pause(FXbool flag);
+
+  // Return true if search is paused
+  FXbool isPaused() const { return paused; }
+
+  // Stop search; running tasks stop as soon as possible
+  void stop();
+
+  // Return true if search was stopped
+  FXbool isStopped() const { return cancelled; }
+
+  // Stop, and wait for worker threads
+  virtual ~Searcher();
+  };
+
+
 /// Find patterns in Files
 class FindInFiles : public FXDialogBox {
   FXDECLARE(FindInFiles)
 protected:
-  SearchVisitor   visitor;              // Search visitor
+  Searcher       *searcher;             // Background searcher
   FXIconList     *locations;            // Search hits
   FXTextField    *findstring;           // String to search for
   FXTextField    *filefolder;           // Folder to search
@@ -80,7 +184,6 @@ protected:
   FXuint          savedsearchmode;      // Saved search mode
   FXuint          savedcurrentpattern;  // Saved search pattern
   FXint           index;                // History index
-  FXuint          proceed;              // Flag
   FXbool          firsthit;             // Record only first hit in file
 protected:
   FindInFiles();
@@ -157,10 +260,7 @@ public:
   /// Close the window, return true if actually closed
   virtual FXbool close(FXbool notify=false);
 
-  /// Called by visitor to see if we should continue processing
-  FXbool continueProcessing();
-
-  /// Called by visitor to deposit new search result
+  /// Called by searcher to deposit new search result
   void appendSearchResult(const FXString& relpath,const FXString& text,FXint lineno,FXint column);
 
   /// Clear search results
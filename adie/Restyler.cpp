@@ -0,0 +1,298 @@
+/********************************************************************************
+*                                                                               *
+*                  B a c k g r o u n d   R e s t y l e   E n g i n e            *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+*********************************************************************************
+* This program is free software: you can redistribute it and/or modify          *
+* it under the terms of the GNU General Public License as published by          *
+* the Free Software Foundation, either version 3 of the License, or             *
+* (at your option) any later version.                                           *
+*                                                                               *
+* This program is distributed in the hope that it will be useful,               *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of                *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the                 *
+* GNU General Public License for more details.                                  *
+*                                                                               *
+* You should have received a copy of the GNU General Public License             *
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.         *
+********************************************************************************/
+#include "fx.h"
+#include "Syntax.h"
+#include "TextWindow.h"
+#include "Adie.h"
+#include "Restyler.h"
+
+
+/*
+  Notes:
+
+  - The Restyler runs the same incremental restyle algorithm as the GUI thread
+    does for small changes, but on a snapshot of the text and styles taken from
+    the start of the restyle range to a little past its goal.  Thus, the worker
+    never touches the text widget.
+
+  - When the styles keep changing past the end of the snapshot, the worker stops
+    and tells the GUI thread where to resume; the GUI thread then restyles from
+    there as if the text up to the end of the changes had been edited.
+
+  - The snapshot is styled in chunks: the first chunk extends to the bottom of
+    the visible part of the text, and subsequent chunks double in size until the
+    restyle goal is reached; after that, the usual back-off is applied until the
+    styles no longer change.  Each chunk's changed styles are published as soon
+    as they're computed, so the visible rows get colored first; each span also
+    tells how far the restyle got, so that an edit made meanwhile may resume the
+    restyle from there, rather than from the start.
+
+  - Restyler is itself the message channel through which the worker wakes up the
+    GUI thread; since it's owned by the TextWindow, nothing remains in the pipe
+    when the window goes away.
+
+  - Published spans are tagged with the generation of the request; the worker
+    appends them to a list under a mutex, and only the first span appended to an
+    empty list wakes up the GUI thread through the message channel.  This keeps
+    the channel's pipe from filling up, so the worker never blocks on it.
+
+  - Each new request, or cancel(), bumps the generation.  Workers running on
+    behalf of an older generation stop at the next chunk boundary, and spans
+    of older generations still in the list are dropped by the GUI thread.
+
+  - The GUI thread merges each span into the text widget, and is told the
+    request finished, or where to resume it, by a final, empty span.
+*/
+
+/*******************************************************************************/
+
+// Restyle task
+class RestyleTask : public FXRunnable {
+private:
+  Restyler       *restyler;     // Restyler we work for
+  RestyleRequest *request;      // Snapshot and restyle parameters
+  FXString        buffer;       // Scratch styles
+  FXuint          generation;   // Generation of request
+private:
+  RestyleTask(const RestyleTask&);
+  RestyleTask &operator=(const RestyleTask&);
+  FXint forwardByContext(FXint pos) const;
+  FXint restyleRange(FXint beg,FXint end,FXint& changed,FXint rule);
+public:
+  RestyleTask(Restyler* r,RestyleRequest* req,FXuint gen);
+  virtual FXint run();
+  virtual ~RestyleTask();
+  };
+
+
+// Construct restyle task
+RestyleTask::RestyleTask(Restyler* r,RestyleRequest* req,FXuint gen):restyler(r),request(req),generation(gen){
+  restyler->tasks.increment();
+  }
+
+
+// Scan forward by context amount
+FXint RestyleTask::forwardByContext(FXint pos) const {
+  const FXchar* text=request->text.text();
+  FXint len=request->text.length();
+  FXint nlines=request->syntax->getContextLines();
+  FXint nchars=request->syntax->getContextChars();
+  FXint r1=pos-request->base;
+  FXint r2=pos-request->base;
+  if(0<nchars){
+    r1+=nchars;
+    if(r1>=len){ r1=len; } else { while(0<r1 && followUTF8(text[r1])) --r1; }
+    }
+  if(0<nlines){
+    while(r2<len){ if(text[r2++]=='\n' && --nlines==0) break; }
+    }
+  return request->base+Math::imin(len,Math::imax(r1,r2));
+  }
+
+
+// Restyle range of snapshot, and publish changed styles and progress; returns
+// affected style end, i.e. one beyond the last position where the style changed
+FXint RestyleTask::restyleRange(FXint beg,FXint end,FXint& changed,FXint rule){
+  FXint len=end-beg,pos=0,chg=0,unc=0;
+  FXASSERT(request->base<=beg && beg<=end && end<=request->base+request->text.length());
+  if(0<len && buffer.length(len)){
+    const FXchar* text=&request->text[beg-request->base];
+    FXchar* style=&request->style[beg-request->base];
+    FXASSERT(0<=rule && rule<request->syntax->getNumRules());
+    pos=chg=request->syntax->getRule(rule)->stylizeBody(text,&buffer[0],0,len);
+    while(0<chg && style[chg-1]==buffer[chg-1]){ --chg; }
+    while(unc<chg && style[unc]==buffer[unc]){ ++unc; }
+    if(unc<chg){
+      copyElms(style+unc,&buffer[unc],chg-unc);
+      }
+    restyler->publish(generation,beg+unc,&buffer[unc],chg-unc,beg+pos);
+    }
+  changed=beg+chg;
+  return beg+pos;
+  }
+
+
+// Restyle until style change is fully enclosed, or until cancelled
+FXint RestyleTask::run(){
+  FXint len=request->base+request->text.length();
+  FXbool all=(len==request->length);
+  FXint beg=request->beg;
+  FXint end=request->end;
+  FXint goal=request->goal;
+  FXint changed=request->changed;
+  FXint rule=request->rule;
+  FXint jump=request->jump;
+  FXint tail,affected;
+  FXbool more=false;
+  while(!restyler->isCancelled(generation)){
+
+    // Restyle [beg,end> using rule, return the end of matched range
+    // and the range of affected characters where style was changed
+    tail=restyleRange(beg,end,affected,rule);
+
+    FXTRACE((110,"RestyleTask: affected=%d beg=%d end=%d goal=%d tail=%d, rule=%d\n",affected,beg,end,goal,tail,rule));
+
+    // Not all colored yet, continue coloring with parent rule from tail
+    if(tail<end){
+      beg=tail;
+      end=goal=forwardByContext(Math::imax(affected,changed));
+      if(rule==0){ fxwarning("Top level patterns did not color everything.\n"); break; }
+      rule=request->syntax->getRule(rule)->getParent();
+      if(!all && len<=end){ changed=Math::imax(beg,Math::imax(affected,changed)); more=true; break; }
+      continue;
+      }
+
+    // Colored only first chunk so far, grow it
+    if(end<goal){
+      end=Math::imin(goal,end+Math::imax(end-beg,jump));
+      continue;
+      }
+
+    // Style changed in unchanged text
+    if(affected>changed){
+      jump<<=1;
+      changed=affected;
+      end=goal=Math::imin(changed+jump,len);
+      if(!all && len<=end){ more=true; break; }
+      continue;
+      }
+
+    // Everything was recolored and style didn't change anymore
+    break;
+    }
+
+  // Tell GUI we're done, or where to resume, unless cancelled
+  restyler->finish(generation,beg,changed,more);
+  delete this;
+  return 0;
+  }
+
+
+// Destroy restyle task
+RestyleTask::~RestyleTask(){
+  delete request;
+  restyler->tasks.decrement();
+  }
+
+/*******************************************************************************/
+
+// Map
+FXDEFMAP(Restyler) RestylerMap[]={
+  FXMAPFUNC(SEL_COMMAND,Restyler::ID_RESTYLED,Restyler::onCmdRestyled),
+  };
+
+
+// Object implementation
+FXIMPLEMENT(Restyler,FXMessageChannel,RestylerMap,ARRAYNUMBER(RestylerMap))
+
+
+// Construct restyler
+Restyler::Restyler(TextWindow* win,FXThreadPool* p):FXMessageChannel(win->getApp()),window(win),pool(p),generation(0){
+  FXTRACE((10,"Restyler::Restyler(%p,%p)\n",win,p));
+  }
+
+
+// Start restyling in the background
+FXuint Restyler::start(RestyleRequest* request){
+  FXuint gen;
+  mutex.lock();
+  gen=++generation;
+  spans.clear();
+  mutex.unlock();
+  FXTRACE((100,"Restyler::start: generation=%u beg=%d end=%d goal=%d changed=%d rule=%d\n",gen,request->beg,request->end,request->goal,request->changed,request->rule));
+  RestyleTask *task=new RestyleTask(this,request,gen);
+  if(!pool->execute(task)){
+    delete task;
+    return 0;
+    }
+  return gen;
+  }
+
+
+// Cancel restyling
+void Restyler::cancel(){
+  FXScopedMutex locker(mutex);
+  ++generation;
+  spans.clear();
+  }
+
+
+// Publish restyled span; wake GUI if first one
+void Restyler::publish(FXuint gen,FXint pos,const FXchar* style,FXint num,FXint reach){
+  FXScopedMutex locker(mutex);
+  if(gen==generation){
+    FXival n=spans.no();
+    if(spans.no(n+1)){
+      spans[n].style.assign(style,num);
+      spans[n].pos=pos;
+      spans[n].reach=reach;
+      spans[n].changed=0;
+      spans[n].generation=gen;
+      spans[n].done=false;
+      spans[n].more=false;
+      if(n==0){ message(this,FXSEL(SEL_COMMAND,ID_RESTYLED)); }
+      }
+    }
+  }
+
+
+// Publish end of request, and where to resume it if more; wake GUI if first one
+void Restyler::finish(FXuint gen,FXint pos,FXint changed,FXbool more){
+  FXScopedMutex locker(mutex);
+  if(gen==generation){
+    FXival n=spans.no();
+    if(spans.no(n+1)){
+      spans[n].style.clear();
+      spans[n].pos=pos;
+      spans[n].reach=pos;
+      spans[n].changed=changed;
+      spans[n].generation=gen;
+      spans[n].done=true;
+      spans[n].more=more;
+      if(n==0){ message(this,FXSEL(SEL_COMMAND,ID_RESTYLED)); }
+      }
+    }
+  }
+
+
+// Pick up restyled spans, and merge them into the text
+long Restyler::onCmdRestyled(FXObject*,FXSelector,void*){
+  StyleSpanList list;
+  mutex.lock();
+  list.adopt(spans);
+  mutex.unlock();
+  for(FXival i=0; i<list.no(); ++i){
+    if(list[i].generation==generation){
+      window->mergeStyleSpan(list[i]);
+      }
+    }
+  return 1;
+  }
+
+
+// Cancel, and wait for worker threads to finish
+Restyler::~Restyler(){
+  FXTRACE((10,"Restyler::~Restyler()\n"));
+  cancel();
+  tasks.wait();
+  window=(TextWindow*)-1L;
+  pool=(FXThreadPool*)-1L;
+  }
@@ -0,0 +1,104 @@
+/********************************************************************************
+*                                                                               *
+*                  B a c k g r o u n d   R e s t y l e   E n g i n e            *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+*********************************************************************************
+* This program is free software: you can redistribute it and/or modify          *
+* it under the terms of the GNU General Public License as published by          *
+* the Free Software Foundation, either version 3 of the License, or             *
+* (at your option) any later version.                                           *
+*                                                                               *
+* This program is distributed in the hope that it will be useful,               *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of                *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the                 *
+* GNU General Public License for more details.                                  *
+*                                                                               *
+* You should have received a copy of the GNU General Public License             *
+* along with this program.  If not, see <http://www.gnu.org/licenses/>.         *
+********************************************************************************/
+#ifndef RESTYLER_H
+#define RESTYLER_H
+
+
+class Syntax;
+class TextWindow;
+
+
+// Restyled span of text
+struct StyleSpan {
+  FXString      style;          // New styles
+  FXint         pos;            // Start of span, or where to resume
+  FXint         reach;          // Restyled up to here
+  FXint         changed;        // End of changed text, when resuming
+  FXuint        generation;     // Generation of request
+  FXbool        done;           // Last span of request
+  FXbool        more;           // Ran past snapshot; resume from pos
+  };
+
+
+// List of restyled spans
+typedef FXArray<StyleSpan> StyleSpanList;
+
+
+// Restyle request
+struct RestyleRequest {
+  FXString      text;           // Snapshot of text from base
+  FXString      style;          // Snapshot of style from base
+  const Syntax *syntax;         // Syntax used for restyling
+  FXint         base;           // Start of snapshot
+  FXint         length;         // Length of whole text
+  FXint         beg;            // Start restyling here
+  FXint         end;            // Initial end of restyled range
+  FXint         goal;           // Restyle at least up to here
+  FXint         changed;        // End of changed text
+  FXint         rule;           // Rule in effect at beg
+  FXint         jump;           // Restyle back-off
+  };
+
+
+// Background restyler
+class Restyler : public FXMessageChannel {
+  FXDECLARE(Restyler)
+  friend class RestyleTask;
+private:
+  FXCompletion      tasks;      // Running restyle tasks
+  FXMutex           mutex;      // Guards spans
+  StyleSpanList     spans;      // Spans ready for pickup
+  TextWindow       *window;     // Window to be restyled
+  FXThreadPool     *pool;       // Pool of worker threads
+  volatile FXuint   generation; // Current request generation
+private:
+  Restyler(){}
+  Restyler(const Restyler&);
+  Restyler &operator=(const Restyler&);
+  FXbool isCancelled(FXuint gen) const { return gen!=generation; }
+  void publish(FXuint gen,FXint pos,const FXchar* style,FXint num,FXint reach);
+  void finish(FXuint gen,FXint pos,FXint changed,FXbool more);
+public:
+  long onCmdRestyled(FXObject*,FXSelector,void*);
+public:
+  enum {
+    ID_RESTYLED=FXMessageChannel::ID_LAST,
+    ID_LAST
+    };
+public:
+
+  // Construct restyler for window, running on thread pool
+  Restyler(TextWindow* win,FXThreadPool* p);
+
+  // Return current generation
+  FXuint getGeneration() const { return generation; }
+
+  // Start restyling in the background; returns new generation
+  FXuint start(RestyleRequest* request);
+
+  // Cancel restyling; any outstanding spans will be dropped
+  void cancel();
+
+  // Cancel, and wait for worker threads
+  virtual ~Restyler();
+  };
+
+#endif
@@ -92,6 +92,14 @@
     o Rules MAY have the same NAMES even though they are different rules.  That
       merely means these rules will have the same style.  It says nothing about
       what is matched or how the colorizer works.
+
+    o Each rule keeps a dispatch table of its subrules, indexed by the first byte
+      of the text to be matched.  For each byte, it lists those subrules whose
+      pattern could start with that byte, in the order they were appended, so
+      at each position only the subrules which could possibly match are tried.
+      The set of starting bytes is obtained from FXRex; it is conservative, so
+      the result is the same as trying all subrules in turn.  The tables are
+      built by Syntax::prepare(), once all rules have been appended.
 */
 
 /*******************************************************************************/
@@ -104,6 +112,33 @@ static inline void fillstyle(FXchar* textstyle,FXchar style,FXint f,FXint t){
 
 // Constructor
 Rule::Rule(const FXString& nam,const FXString& sty,FXival par,FXival idx):name(nam),style(sty),parent(par),index(idx){
+  clearElms(first,ARRAYNUMBER(first));
+  }
+
+
+// Build dispatch table of subrules
+void Rule::prepare(){
+  FXArray<FXint> lists[256];
+  FXuchar set[32];
+  FXint c;
+  for(FXival node=0; node<rules.no(); node++){
+    rules[node]->firstSet(set);
+    for(c=0; c<256; ++c){
+      if(set[c>>3]&(1<<(c&7))) lists[c].append((FXint)node);
+      }
+    }
+  candidates.clear();
+  for(c=0; c<256; ++c){
+    first[c]=(FXint)candidates.no();
+    candidates.append(lists[c].data(),lists[c].no());
+    }
+  first[256]=(FXint)candidates.no();
+  }
+
+
+// Get set of bytes with which a match may start
+void Rule::firstSet(FXuchar set[]) const {
+  fillElms(set,(FXuchar)0xFF,32);
   }
 
 
@@ -141,10 +176,10 @@ FXint DefaultRule::stylize(const FXchar* text,FXchar *textstyle,FXint pos,FXint
 FXint DefaultRule::stylizeBody(const FXchar* text,FXchar* textstyle,FXint pos,FXint len) const {
   FXint p; FXuchar c;
   while(pos<len){
-    for(FXival node=0; node<rules.no(); node++){
-      if(pos<(p=rules[node]->stylize(text,textstyle,pos,len))){ pos=p; goto nxt; }
-      }
     c=text[pos];
+    for(FXint i=first[c]; i<first[c+1]; i++){
+      if(pos<(p=rules[candidates[i]]->stylize(text,textstyle,pos,len))){ pos=p; goto nxt; }
+      }
     textstyle[pos++]=index;
     if(c<0xC0) continue;
     textstyle[pos++]=index;
@@ -171,6 +206,12 @@ SimpleRule::SimpleRule(const FXString& nam,const FXString& sty,const FXString& r
   }
 
 
+// Get set of bytes with which a match may start
+void SimpleRule::firstSet(FXuchar set[]) const {
+  pattern.firstSet(set);
+  }
+
+
 // Stylize text; a match always non-empty
 FXint SimpleRule::stylize(const FXchar* text,FXchar *textstyle,FXint pos,FXint len) const {
   return SimpleRule::stylizeBody(text,textstyle,pos,len);
@@ -201,6 +242,12 @@ BracketRule::BracketRule(const FXString& nam,const FXString& sty,const FXString&
   }
 
 
+// Get set of bytes with which a match may start
+void BracketRule::firstSet(FXuchar set[]) const {
+  open.firstSet(set);
+  }
+
+
 // Stylize text; only report success if non-empty
 FXint BracketRule::stylize(const FXchar* text,FXchar *textstyle,FXint pos,FXint len) const {
   FXint beg,end;
@@ -216,14 +263,14 @@ FXint BracketRule::stylize(const FXchar* text,FXchar *textstyle,FXint pos,FXint
 FXint BracketRule::stylizeBody(const FXchar* text,FXchar* textstyle,FXint pos,FXint len) const {
   FXint beg,end,p; FXuchar c;
   while(pos<len){
-    for(FXival node=0; node<rules.no(); node++){
-      if(pos<(p=rules[node]->stylize(text,textstyle,pos,len))){ pos=p; goto nxt; }
+    c=text[pos];
+    for(FXint i=first[c]; i<first[c+1]; i++){
+      if(pos<(p=rules[candidates[i]]->stylize(text,textstyle,pos,len))){ pos=p; goto nxt; }
       }
     if(close.amatch(text,len,pos,FXRex::Normal,&beg,&end,1)){
       fillstyle(textstyle,index,beg,end);
       return end;
       }
-    c=text[pos];
     textstyle[pos++]=index;
     if(c<0xC0) continue;
     textstyle[pos++]=index;
@@ -269,14 +316,14 @@ FXint SafeBracketRule::stylizeBody(const FXchar* text,FXchar* textstyle,FXint po
       fillstyle(textstyle,index,beg,end);
       return end;
       }
-    for(FXival node=0; node<rules.no(); node++){
-      if(pos<(p=rules[node]->stylize(text,textstyle,pos,len))){ pos=p; goto nxt; }
+    c=text[pos];
+    for(FXint i=first[c]; i<first[c+1]; i++){
+      if(pos<(p=rules[candidates[i]]->stylize(text,textstyle,pos,len))){ pos=p; goto nxt; }
       }
     if(close.amatch(text,len,pos,FXRex::Normal,&beg,&end,1)){
       fillstyle(textstyle,index,beg,end);
       return end;
       }
-    c=text[pos];
     textstyle[pos++]=index;
     if(c<0xC0) continue;
     textstyle[pos++]=index;
@@ -303,6 +350,12 @@ SpanRule::SpanRule(const FXString& nam,const FXString& sty,const FXString& rex,F
   }
 
 
+// Get set of bytes with which a match may start
+void SpanRule::firstSet(FXuchar set[]) const {
+  pattern.firstSet(set);
+  }
+
+
 // Stylize text; a match always non-empty
 FXint SpanRule::stylize(const FXchar* text,FXchar *textstyle,FXint pos,FXint len) const {
   FXint beg,end;
@@ -318,10 +371,10 @@ FXint SpanRule::stylize(const FXchar* text,FXchar *textstyle,FXint pos,FXint len
 FXint SpanRule::stylizeBody(const FXchar* text,FXchar* textstyle,FXint pos,FXint len) const {
   FXint p; FXuchar c;
   while(pos<len){
-    for(FXival node=0; node<rules.no(); node++){
-      if(pos<(p=rules[node]->stylize(text,textstyle,pos,len))){ pos=p; goto nxt; }
-      }
     c=text[pos];
+    for(FXint i=first[c]; i<first[c+1]; i++){
+      if(pos<(p=rules[candidates[i]]->stylize(text,textstyle,pos,len))){ pos=p; goto nxt; }
+      }
     textstyle[pos++]=index;
     if(c<0xC0) continue;
     textstyle[pos++]=index;
@@ -405,6 +458,14 @@ FXbool Syntax::matchContents(const FXString& text) const {
   }
 
 
+// Build dispatch tables of all rules
+void Syntax::prepare(){
+  for(FXival i=0; i<rules.no(); ++i){
+    rules[i]->prepare();
+    }
+  }
+
+
 // Append default rule
 FXival Syntax::appendDefault(const FXString& name,const FXString& style,FXival parent){
   FXival index=rules.no();
@@ -40,6 +40,8 @@ protected:
   FXString      name;           // Name of rule
   FXString      style;          // Colors for highlighting (default)
   RuleList      rules;          // Subrules
+  FXArray<FXint> candidates;    // Subrules by first byte
+  FXint         first[257];     // Subrules starting with byte c in candidates[first[c]..first[c+1]>
   FXival        parent;         // Parent rule
   FXival        index;          // Own style index
 protected:
@@ -47,6 +49,7 @@ protected:
 private:
   Rule(const Rule&);
   Rule &operator=(const Rule&);
+  void prepare();
 public:
 
   // Construct node
@@ -76,6 +79,9 @@ public:
   // Get child rule
   Rule* getRule(FXival inx) const { return rules[inx]; }
 
+  // Get set of bytes with which a match may start
+  virtual void firstSet(FXuchar set[]) const;
+
   // Stylize text
   virtual FXint stylize(const FXchar* text,FXchar* textstyle,FXint pos,FXint len) const;
 
@@ -124,6 +130,9 @@ public:
   // Construct node
   SimpleRule(const FXString& nam,const FXString& sty,const FXString& rex,FXival par,FXival idx);
 
+  // Get set of bytes with which a match may start
+  virtual void firstSet(FXuchar set[]) const;
+
   // Stylize text
   virtual FXint stylize(const FXchar* text,FXchar *textstyle,FXint pos,FXint len) const;
 
@@ -150,6 +159,9 @@ public:
   // Construct node
   BracketRule(const FXString& nam,const FXString& sty,const FXString& brex,const FXString& erex,FXival par,FXival idx);
 
+  // Get set of bytes with which a match may start
+  virtual void firstSet(FXuchar set[]) const;
+
   // Stylize text
   virtual FXint stylize(const FXchar* text,FXchar *textstyle,FXint pos,FXint len) const;
 
@@ -200,6 +212,9 @@ public:
   // Construct node
   SpanRule(const FXString& nam,const FXString& sty,const FXString& rex,FXival par,FXival idx);
 
+  // Get set of bytes with which a match may start
+  virtual void firstSet(FXuchar set[]) const;
+
   // Stylize text
   virtual FXint stylize(const FXchar* text,FXchar *textstyle,FXint pos,FXint len) const;
 
@@ -337,6 +352,9 @@ public:
   // Match contents against regular expression
   FXbool matchContents(const FXString& text) const;
 
+  // Build subrule dispatch tables, after all rules have been appended
+  void prepare();
+
   // Append default rule
   FXival appendDefault(const FXString& name,const FXString& style,FXival parent=0);
 
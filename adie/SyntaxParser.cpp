@@ -523,9 +523,12 @@ FXbool SyntaxParser::parseLanguage(SyntaxList& syntaxes){
 
     // Parse rules
     while(token==TK_RULE){
-      if(!parseRule(syntax,0)) return false;
+      if(!parseRule(syntax,0)){ syntax->prepare(); return false; }
       }
 
+    // Build rule dispatch tables
+    syntax->prepare();
+
     // Check end
     if(token!=TK_END){
       fxwarning("%s:%d: error: expected 'end'.\n",from,line);
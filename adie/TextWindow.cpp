@@ -33,6 +33,7 @@
 #include "FindInFiles.h"
 #include "ShellCommand.h"
 #include "ShellDialog.h"
+#include "Restyler.h"
 #include "icons.h"
 
 
@@ -86,6 +87,7 @@
 #define CLOCKTIMER      1000000000      // Blink rate for corner clock
 #define CHECKTIMER      1000000000      // Blink rate for corner clock
 #define RESTYLEJUMP     80              // Restyling back-off
+#define RESTYLESYNC     32768           // Restyle larger ranges in the background
 #define MAXFILESIZE     1000000000      // Limit files to this when loading
 
 /*******************************************************************************/
@@ -441,6 +443,9 @@ TextWindow::TextWindow(Adie* a):FXMainWindow(a,"Adie",nullptr,nullptr,DECOR_ALL,
   // Initial setting
   syntax=nullptr;
 
+  // Background restyler
+  restyler=new Restyler(this,a->getThreadPool());
+
   // Empty window is "clean"
   undolist.mark();
 
@@ -488,6 +493,11 @@ TextWindow::TextWindow(Adie* a):FXMainWindow(a,"Adie",nullptr,nullptr,DECOR_ALL,
   mergeundos=true;
   showlogger=false;
   colorize=false;
+  restyling=false;
+  restylebeg=0;
+  restylerule=0;
+  restylechanged=0;
+  restylemerged=0;
   stripcr=true;
   stripsp=false;
   appendcr=false;
@@ -1153,6 +1163,9 @@ FXbool TextWindow::loadFile(const FXString& file){
     // Set text
     editor->setText(buffer);
 
+    // Pending restyle refers to old text
+    cancelRestyle();
+
     // Set filename
     setFilename(file);
     setFilenameSet(true);
@@ -1554,6 +1567,10 @@ void TextWindow::readRegistry(){
   // Undo alternate history
   undolist.setAlternateHistory(alternatehistory);
 
+  // Undo memory budget
+  undolist.setMaxSize(undoMaxSize);
+  undolist.setKeepSize(undoKeepSize);
+
   // Search history
   loadSearchHistory();
 
@@ -1733,6 +1750,7 @@ TextWindow::~TextWindow(){
   getApp()->removeWindow(this);
   getApp()->removeTimeout(this,ID_CLOCKTIME);
   getApp()->removeTimeout(this,ID_CHECKCHANGE);
+  delete restyler;
   delete shellCommand;
   delete font;
   delete dragshell1;
@@ -2850,6 +2868,7 @@ long TextWindow::onUpdDelimiters(FXObject* sender,FXSelector,void*){
 // Change maximum undo buffer size
 long TextWindow::onCmdUndoMaxSize(FXObject* sender,FXSelector,void*){
   sender->handle(this,FXSEL(SEL_COMMAND,ID_GETINTVALUE),(void*)&undoMaxSize);
+  undolist.setMaxSize(undoMaxSize);
   return 1;
   }
 
@@ -2863,6 +2882,7 @@ long TextWindow::onUpdUndoMaxSize(FXObject* sender,FXSelector,void*){
 // Change undo buffer size to keep around
 long TextWindow::onCmdUndoKeepSize(FXObject* sender,FXSelector,void*){
   sender->handle(this,FXSEL(SEL_COMMAND,ID_GETINTVALUE),(void*)&undoKeepSize);
+  undolist.setKeepSize(undoKeepSize);
   return 1;
   }
 
@@ -4414,7 +4434,6 @@ long TextWindow::onTextInserted(FXObject*,FXSelector,void* ptr){
   if(!undolist.busy()){
     FXbool merge=(cursormoved<=1) && mergeundos;
     undolist.add(new FXTextInsert(editor,change->pos,change->nins,change->ins),false,merge);
-    if(undolist.size()>undoMaxSize) undolist.trimSize(undoKeepSize);
     }
 
   // Update bookmark locations
@@ -4444,7 +4463,6 @@ long TextWindow::onTextReplaced(FXObject*,FXSelector,void* ptr){
   if(!undolist.busy()){
     FXbool merge=(cursormoved<=1) && mergeundos;
     undolist.add(new FXTextReplace(editor,change->pos,change->ndel,change->nins,change->del,change->ins),false,merge);
-    if(undolist.size()>undoMaxSize) undolist.trimSize(undoKeepSize);
     }
 
   // Update bookmark locations
@@ -4474,7 +4492,6 @@ long TextWindow::onTextDeleted(FXObject*,FXSelector,void* ptr){
   if(!undolist.busy()){
     FXbool merge=(cursormoved<=1) && mergeundos;
     undolist.add(new FXTextDelete(editor,change->pos,change->ndel,change->del),false,merge);
-    if(undolist.size()>undoMaxSize) undolist.trimSize(undoKeepSize);
     }
 
   // Update bookmark locations
@@ -5220,6 +5237,7 @@ long TextWindow::onUpdStyleBold(FXObject* sender,FXSelector sel,void*){
 
 // Set language
 void TextWindow::setSyntax(Syntax* syn){
+  Syntax* old=syntax;
   syntax=syn;
 
   // Set editor attributes to syntax mode
@@ -5269,6 +5287,9 @@ void TextWindow::setSyntax(Syntax* syn){
     editor->setTabColumns(tabwidth);
     editor->setWrapColumns(wrapwidth);
 
+    // Styles of another syntax don't apply
+    if(syn!=old) editor->changeStyle(0,editor->getLength(),0);
+
     // Full recolorization is called for
     restyleText();
     }
@@ -5279,6 +5300,9 @@ void TextWindow::setSyntax(Syntax* syn){
     // Update language setting
     language->setText("---");
 
+    // Stop restyling
+    cancelRestyle();
+
     // Set styles
     editor->setHiliteStyles(nullptr);
     editor->setStyled(false);
@@ -5424,6 +5448,7 @@ void TextWindow::restyleText(FXint pos,FXint del,FXint ins){
   FXTRACE((100,"restyleText(pos=%d,del=%d,ins=%d)\n",pos,del,ins));
   if(colorize && syntax){
     FXint tail,changed,affected,beg,end,len,rule,restylejump;
+    FXbool background=true;
 
     // Length of text
     len=editor->getLength();
@@ -5431,9 +5456,31 @@ void TextWindow::restyleText(FXint pos,FXint del,FXint ins){
     // End of buffer modification
     changed=pos+ins;
 
+    // Still restyling in the background; restart it so as to include
+    // this change, from what was merged back already unless this change
+    // comes earlier; if it can't be restarted, finish it here
+    if(restyling){
+      if(pos<restylechanged) restylechanged+=ins-del;
+      changed=Math::imax(changed,restylechanged);
+      if(pos<=restylebeg){
+        beg=findRestylePoint(pos,rule);
+        }
+      else{
+        beg=findRestylePoint(Math::imin(pos,restylemerged),rule);
+        if(beg<=restylebeg){
+          beg=restylebeg;
+          rule=restylerule;
+          }
+        }
+      if(startRestyle(beg,forwardByContext(changed),changed,rule,RESTYLEJUMP)) return;
+      background=false;
+      }
+
     // Scan back to a place where the style changed, return
     // the style rule in effect at that location
-    beg=findRestylePoint(pos,rule);
+    else{
+      beg=findRestylePoint(pos,rule);
+      }
 
     // Scan forward by one context
     end=forwardByContext(changed);
@@ -5446,6 +5493,13 @@ void TextWindow::restyleText(FXint pos,FXint del,FXint ins){
     restylejump=RESTYLEJUMP;
     while(1){
 
+      // Too much to do right now; finish it in the background,
+      // unless it can't be started
+      if(background && RESTYLESYNC<end-beg){
+        if(startRestyle(beg,end,changed,rule,restylejump)) return;
+        background=false;
+        }
+
       // Restyle [beg,end> using rule, return the end of matched range
       // and the range of affected characters where style was changed
       tail=restyleRange(beg,end,affected,rule);
@@ -5481,7 +5535,11 @@ void TextWindow::restyleText(FXint pos,FXint del,FXint ins){
 void TextWindow::restyleText(){
   if(colorize && syntax){
     FXint len=editor->getLength();
+    if(RESTYLESYNC<len){
+      if(startRestyle(0,len,len,0,RESTYLEJUMP)) return;
+      }
     FXString text;
+    cancelRestyle();
     if(text.length(len+len)){
       editor->extractText(&text[0],0,len);
       syntax->getRule(0)->stylize(&text[0],&text[len],0,len);
@@ -5491,6 +5549,58 @@ void TextWindow::restyleText(){
   }
 
 
+// Restyle [beg,end> in the background, using rule; keep restyling
+// past changed until style no longer changes, like restyleText() does.
+// A snapshot of the text from beg to a little past end is restyled,
+// starting with the visible part of the text; if the style still changes
+// past the snapshot, the rest is restyled when the snapshot is done.
+// Return false if it couldn't be started.
+FXbool TextWindow::startRestyle(FXint beg,FXint end,FXint changed,FXint rule,FXint jump){
+  RestyleRequest *request=new RestyleRequest;
+  FXint len=Math::imin(editor->getLength(),end+RESTYLESYNC);
+  FXint vis=forwardByContext(editor->nextLine(editor->getBottomLine()));
+  request->syntax=syntax;
+  request->base=beg;
+  request->length=editor->getLength();
+  request->beg=beg;
+  request->end=Math::imin(end,Math::imax(vis,beg+jump));
+  request->goal=end;
+  request->changed=changed;
+  request->rule=rule;
+  request->jump=jump;
+  editor->extractText(request->text,beg,len-beg);
+  editor->extractStyle(request->style,beg,len-beg);
+  restylebeg=beg;
+  restylerule=rule;
+  restylechanged=changed;
+  restylemerged=beg;
+  restyling=(restyler->start(request)!=0);
+  return restyling;
+  }
+
+
+// Cancel background restyle, if any
+void TextWindow::cancelRestyle(){
+  restyler->cancel();
+  restyling=false;
+  }
+
+
+// Merge span restyled in the background
+void TextWindow::mergeStyleSpan(const StyleSpan& span){
+  FXTRACE((110,"mergeStyleSpan(pos=%d,len=%d,done=%d)\n",span.pos,span.style.length(),span.done));
+  if(span.done){
+    restyling=false;
+    if(span.more){                      // Resume as if [pos,changed> were edited
+      restyleText(span.pos,span.changed-span.pos,span.changed-span.pos);
+      }
+    return;
+    }
+  if(!span.style.empty()) editor->changeStyle(span.pos,span.style);
+  restylemerged=Math::imax(restylemerged,span.reach);
+  }
+
+
 // Read style
 FXHiliteStyle TextWindow::readStyleForRule(const FXString& group,const FXString& name,const FXString& style){
   FXchar nfg[100],nbg[100],sfg[100],sbg[100],hfg[100],hbg[100],abg[100]; FXint sty;
@@ -5533,6 +5643,7 @@ long TextWindow::onCmdSyntax(FXObject*,FXSelector,void* ptr){
     }
   else{
     editor->setStyled(false);
+    cancelRestyle();
     }
   return 1;
   }
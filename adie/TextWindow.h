@@ -27,6 +27,8 @@ class Syntax;
 class HelpWindow;
 class Preferences;
 class ShellCommand;
+class Restyler;
+struct StyleSpan;
 
 // Array of styles
 typedef FXArray<FXHiliteStyle> FXHiliteArray;
@@ -72,6 +74,7 @@ protected:
   FXStatusBar         *statusbar;               // Status bar
   FXFont              *font;                    // Text window font
   Syntax              *syntax;                  // Syntax highlighter
+  Restyler            *restyler;                // Background restyler
   FXUndoList           undolist;                // Undo list
   FXRecentFiles        mrufiles;                // Recent files list
   FXHiliteArray        styles;                  // Highlight styles
@@ -109,6 +112,11 @@ protected:
   FXbool               mergeundos;              // Merge undos
   FXbool               showlogger;              // Showing error logger
   FXbool               colorize;                // Syntax coloring on if possible
+  FXbool               restyling;               // Restyling in the background
+  FXint                restylebeg;              // Start of background restyle
+  FXint                restylerule;             // Rule in effect at restylebeg
+  FXint                restylechanged;          // End of text changed since restyle
+  FXint                restylemerged;           // Restyled text merged back up to here
   FXbool               stripcr;                 // Strip carriage returns
   FXbool               stripsp;                 // Strip trailing spaces
   FXbool               appendcr;                // Append carriage returns
@@ -141,6 +149,8 @@ private:
   void restyleText();
   void restyleText(FXint pos,FXint del,FXint ins);
   FXint restyleRange(FXint beg,FXint end,FXint& changed,FXint rule);
+  FXbool startRestyle(FXint beg,FXint end,FXint changed,FXint rule,FXint jump);
+  void cancelRestyle();
   FXHiliteStyle readStyleForRule(const FXString& group,const FXString& name,const FXString& style);
   void writeStyleForRule(const FXString& group,const FXString& name,const FXHiliteStyle& style);
   void loadSearchHistory();
@@ -723,6 +733,9 @@ public:
   // Determine syntax
   void determineSyntax();
 
+  // Merge span restyled in the background
+  void mergeStyleSpan(const StyleSpan& span);
+
   // Parse modeline
   void parseModeline();
 
@@ -0,0 +1,245 @@
+/*********** Generated on 2026/10/18 22:46:56 by reswrap version 6.0.0 *********/
+
+/* Created by reswrap from file adie_gif.gif */
+extern const unsigned char adie_gif[];
+
+/* Created by reswrap from file backward_gif.gif */
+extern const unsigned char backward_gif[];
+
+/* Created by reswrap from file big_gif.gif */
+extern const unsigned char big_gif[];
+
+/* Created by reswrap from file bookclr2_gif.gif */
+extern const unsigned char bookclr2_gif[];
+
+/* Created by reswrap from file bookdel2_gif.gif */
+extern const unsigned char bookdel2_gif[];
+
+/* Created by reswrap from file bookmrk2_gif.gif */
+extern const unsigned char bookmrk2_gif[];
+
+/* Created by reswrap from file booknxt2_gif.gif */
+extern const unsigned char booknxt2_gif[];
+
+/* Created by reswrap from file bookprv2_gif.gif */
+extern const unsigned char bookprv2_gif[];
+
+/* Created by reswrap from file bookset2_gif.gif */
+extern const unsigned char bookset2_gif[];
+
+/* Created by reswrap from file browser.gif */
+extern const unsigned char browser[];
+
+/* Created by reswrap from file capitalize.gif */
+extern const unsigned char capitalize[];
+
+/* Created by reswrap from file close_gif.gif */
+extern const unsigned char close_gif[];
+
+/* Created by reswrap from file colors_gif.gif */
+extern const unsigned char colors_gif[];
+
+/* Created by reswrap from file command_bmp.bmp */
+extern const unsigned char command_bmp[];
+
+/* Created by reswrap from file config_gif.gif */
+extern const unsigned char config_gif[];
+
+/* Created by reswrap from file copy_gif.gif */
+extern const unsigned char copy_gif[];
+
+/* Created by reswrap from file cut_gif.gif */
+extern const unsigned char cut_gif[];
+
+/* Created by reswrap from file delete_gif.gif */
+extern const unsigned char delete_gif[];
+
+/* Created by reswrap from file delimit_gif.gif */
+extern const unsigned char delimit_gif[];
+
+/* Created by reswrap from file docs_gif.gif */
+extern const unsigned char docs_gif[];
+
+/* Created by reswrap from file export_gif.gif */
+extern const unsigned char export_gif[];
+
+/* Created by reswrap from file express_gif.gif */
+extern const unsigned char express_gif[];
+
+/* Created by reswrap from file filehidden_gif.gif */
+extern const unsigned char filehidden_gif[];
+
+/* Created by reswrap from file fileshown_gif.gif */
+extern const unsigned char fileshown_gif[];
+
+/* Created by reswrap from file filter_gif.gif */
+extern const unsigned char filter_gif[];
+
+/* Created by reswrap from file fonts_gif.gif */
+extern const unsigned char fonts_gif[];
+
+/* Created by reswrap from file forward_gif.gif */
+extern const unsigned char forward_gif[];
+
+/* Created by reswrap from file goto_gif.gif */
+extern const unsigned char goto_gif[];
+
+/* Created by reswrap from file help_gif.gif */
+extern const unsigned char help_gif[];
+
+/* Created by reswrap from file import_gif.gif */
+extern const unsigned char import_gif[];
+
+/* Created by reswrap from file indent_gif.gif */
+extern const unsigned char indent_gif[];
+
+/* Created by reswrap from file info_gif.gif */
+extern const unsigned char info_gif[];
+
+/* Created by reswrap from file lang_gif.gif */
+extern const unsigned char lang_gif[];
+
+/* Created by reswrap from file logger.gif */
+extern const unsigned char logger[];
+
+/* Created by reswrap from file lowercase.gif */
+extern const unsigned char lowercase[];
+
+/* Created by reswrap from file miscellaneous_gif.gif */
+extern const unsigned char miscellaneous_gif[];
+
+/* Created by reswrap from file new_gif.gif */
+extern const unsigned char new_gif[];
+
+/* Created by reswrap from file newfile_gif.gif */
+extern const unsigned char newfile_gif[];
+
+/* Created by reswrap from file nobrowser.gif */
+extern const unsigned char nobrowser[];
+
+/* Created by reswrap from file nologger.gif */
+extern const unsigned char nologger[];
+
+/* Created by reswrap from file nowrap_gif.gif */
+extern const unsigned char nowrap_gif[];
+
+/* Created by reswrap from file open_gif.gif */
+extern const unsigned char open_gif[];
+
+/* Created by reswrap from file opensel_gif.gif */
+extern const unsigned char opensel_gif[];
+
+/* Created by reswrap from file palette_gif.gif */
+extern const unsigned char palette_gif[];
+
+/* Created by reswrap from file pattern_gif.gif */
+extern const unsigned char pattern_gif[];
+
+/* Created by reswrap from file paste_gif.gif */
+extern const unsigned char paste_gif[];
+
+/* Created by reswrap from file point_gif.gif */
+extern const unsigned char point_gif[];
+
+/* Created by reswrap from file point2_gif.gif */
+extern const unsigned char point2_gif[];
+
+/* Created by reswrap from file print_gif.gif */
+extern const unsigned char print_gif[];
+
+/* Created by reswrap from file quit_gif.gif */
+extern const unsigned char quit_gif[];
+
+/* Created by reswrap from file redo_gif.gif */
+extern const unsigned char redo_gif[];
+
+/* Created by reswrap from file reload_gif.gif */
+extern const unsigned char reload_gif[];
+
+/* Created by reswrap from file replace_gif.gif */
+extern const unsigned char replace_gif[];
+
+/* Created by reswrap from file save_gif.gif */
+extern const unsigned char save_gif[];
+
+/* Created by reswrap from file saveall_gif.gif */
+extern const unsigned char saveall_gif[];
+
+/* Created by reswrap from file saveas_gif.gif */
+extern const unsigned char saveas_gif[];
+
+/* Created by reswrap from file saveto_gif.gif */
+extern const unsigned char saveto_gif[];
+
+/* Created by reswrap from file script_gif.gif */
+extern const unsigned char script_gif[];
+
+/* Created by reswrap from file search_gif.gif */
+extern const unsigned char search_gif[];
+
+/* Created by reswrap from file search_case.gif */
+extern const unsigned char search_case[];
+
+/* Created by reswrap from file search_dn.gif */
+extern const unsigned char search_dn[];
+
+/* Created by reswrap from file search_nocase.gif */
+extern const unsigned char search_nocase[];
+
+/* Created by reswrap from file search_norex.gif */
+extern const unsigned char search_norex[];
+
+/* Created by reswrap from file search_noword.gif */
+extern const unsigned char search_noword[];
+
+/* Created by reswrap from file search_rex.gif */
+extern const unsigned char search_rex[];
+
+/* Created by reswrap from file search_up.gif */
+extern const unsigned char search_up[];
+
+/* Created by reswrap from file search_word.gif */
+extern const unsigned char search_word[];
+
+/* Created by reswrap from file searchfiles_gif.gif */
+extern const unsigned char searchfiles_gif[];
+
+/* Created by reswrap from file searchicon_gif.gif */
+extern const unsigned char searchicon_gif[];
+
+/* Created by reswrap from file searchnext_gif.gif */
+extern const unsigned char searchnext_gif[];
+
+/* Created by reswrap from file searchprev_gif.gif */
+extern const unsigned char searchprev_gif[];
+
+/* Created by reswrap from file shiftleft_gif.gif */
+extern const unsigned char shiftleft_gif[];
+
+/* Created by reswrap from file shiftright_gif.gif */
+extern const unsigned char shiftright_gif[];
+
+/* Created by reswrap from file small_gif.gif */
+extern const unsigned char small_gif[];
+
+/* Created by reswrap from file styles_gif.gif */
+extern const unsigned char styles_gif[];
+
+/* Created by reswrap from file syntax_gif.gif */
+extern const unsigned char syntax_gif[];
+
+/* Created by reswrap from file switch_gif.gif */
+extern const unsigned char switch_gif[];
+
+/* Created by reswrap from file terminal_gif.gif */
+extern const unsigned char terminal_gif[];
+
+/* Created by reswrap from file undo_gif.gif */
+extern const unsigned char undo_gif[];
+
+/* Created by reswrap from file uppercase.gif */
+extern const unsigned char uppercase[];
+
+/* Created by reswrap from file wordwrap_gif.gif */
+extern const unsigned char wordwrap_gif[];
+
@@ -0,0 +1,405 @@
+/*********** Generated on 2026/10/18 22:46:56 by reswrap version 6.0.0 *********/
+
+#include "icons.h"
+
+/* Created by reswrap from file bigcalc.gif */
+const unsigned char bigcalc[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x1f,0x00,0x15,0x00,0xe3,0x00,0x00,0xb0,0xc0,0xd8,
+  0x98,0x8c,0x88,0xf8,0xfc,0xf8,0xf8,0xfc,0x00,0xe0,0x88,0x28,0x00,0x00,0x00,0xe0,
+  0xb4,0x30,0xc0,0xc0,0xc0,0xd0,0xfc,0xc8,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x1f,0x00,0x15,0x00,0x00,0x04,0xa8,0x10,0x84,0x49,0xab,0xbd,0x38,0x48,
+  0x31,0xb8,0xef,0xe0,0x27,0x86,0x20,0x51,0x04,0x83,0xa1,0xae,0x6c,0xe1,0xbe,0x70,
+  0xac,0x9a,0x81,0xa0,0x0a,0x38,0x5e,0xa8,0xc5,0xe1,0xff,0x40,0xe0,0xec,0x94,0x32,
+  0x08,0x80,0x3b,0x43,0x01,0xc1,0x6c,0x3a,0x9b,0x87,0x61,0x8d,0x27,0x53,0x06,0xaf,
+  0x3f,0x69,0x91,0xc5,0xed,0x7a,0x57,0x34,0x9b,0x51,0xb0,0xd3,0x8d,0xcb,0xe4,0xb3,
+  0x21,0x91,0x48,0xd2,0x8a,0xc7,0xf2,0x41,0x4e,0x37,0xce,0xd7,0x77,0x43,0x98,0xba,
+  0x7b,0x29,0x5d,0x7f,0x7d,0x80,0x7e,0x7a,0x44,0x5f,0x87,0x88,0x7b,0x6a,0x66,0x8c,
+  0x69,0x8d,0x6e,0x86,0x76,0x75,0x71,0x92,0x95,0x94,0x85,0x53,0x81,0x9a,0x7e,0x9c,
+  0x83,0x80,0x98,0x5b,0x88,0xa2,0x60,0x27,0x62,0x8f,0x8b,0x8e,0x39,0x66,0xa0,0x37,
+  0x77,0x94,0xaf,0xae,0x41,0x90,0x99,0x9d,0x82,0xb6,0x81,0x30,0x5a,0xa3,0xbb,0x52,
+  0x01,0x04,0xbf,0xc0,0xc1,0xc2,0xc3,0xc4,0x05,0x00,0x31,0xc8,0xc9,0xca,0x2f,0x00,
+  0x11,0x00,0x3b
+  };
+
+/* Created by reswrap from file colors.gif */
+const unsigned char colors[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x20,0x00,0x20,0x00,0xf7,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0x98,0x90,0x78,0xb0,0xa8,0x88,0xc8,0xbc,0x98,0xc8,0xc4,0xa0,0xd0,
+  0xc4,0xa0,0xc8,0xc0,0xa0,0xb8,0xb4,0x90,0x90,0x8c,0x70,0xd0,0xc8,0xa8,0xb8,0xac,
+  0x90,0xa8,0x9c,0x80,0xb8,0xb0,0x90,0x20,0x64,0x30,0x20,0x5c,0x30,0x18,0x44,0x20,
+  0x98,0x8c,0x78,0xb0,0xac,0x88,0x90,0x90,0x70,0xc8,0xbc,0xa0,0xd0,0xc4,0xa8,0x28,
+  0x78,0x38,0x50,0xb4,0x58,0x40,0x98,0x48,0x30,0x78,0x40,0x18,0x48,0x20,0xb0,0xa4,
+  0x88,0x98,0x94,0x78,0xa8,0x88,0x78,0xa8,0x84,0x78,0xb0,0xa8,0x90,0xb8,0xb0,0x98,
+  0xd8,0xcc,0xb0,0x70,0xc0,0x70,0x48,0xb0,0x58,0x50,0xb0,0x58,0xc0,0xbc,0x98,0xa0,
+  0x98,0x78,0xc8,0xc0,0xa8,0xd0,0xcc,0xb0,0x88,0x10,0x20,0xa8,0x14,0x28,0x70,0x0c,
+  0x20,0x98,0x98,0x80,0xc0,0xb8,0xa0,0x28,0x90,0x40,0x68,0xc0,0x68,0xa8,0xdc,0xa8,
+  0xa8,0xdc,0xa0,0xa0,0x98,0x80,0xd8,0xd0,0xb0,0xa0,0x14,0x28,0xc8,0x18,0x30,0xe0,
+  0x48,0x48,0x70,0x0c,0x18,0xb8,0xec,0xc8,0x28,0x78,0x40,0x18,0x7c,0x78,0x18,0x6c,
+  0x70,0x08,0x54,0x50,0x08,0x48,0x48,0x90,0x88,0x70,0xd8,0xd4,0xb8,0xd8,0xd0,0xb8,
+  0xd0,0x1c,0x38,0xf8,0x5c,0x60,0xf8,0x88,0x88,0xf8,0x44,0x48,0xc8,0x20,0x28,0xc0,
+  0xb4,0xa0,0xe0,0xf0,0xe8,0xff,0xff,0xff,0x70,0xc4,0x70,0x30,0x90,0x48,0x18,0x94,
+  0x98,0x18,0x90,0x90,0x18,0x94,0x90,0x10,0x6c,0x68,0x10,0x48,0x48,0xe0,0xd4,0xc0,
+  0xf8,0x8c,0x90,0xf8,0xb8,0xb8,0xf8,0xa4,0xa8,0xe0,0x3c,0x48,0xb0,0xe0,0xb0,0x28,
+  0x8c,0x40,0x80,0xc4,0x78,0x40,0xa8,0x50,0x90,0xb4,0x88,0x20,0xac,0xa8,0x78,0xd0,
+  0xc8,0x58,0xc8,0xc0,0xc0,0xb4,0x90,0xe0,0xd8,0xc0,0xc0,0x6c,0x68,0xf8,0xd4,0xd0,
+  0xf8,0xc4,0xc0,0xf0,0x74,0x78,0xc8,0xc4,0xb0,0x38,0x94,0x50,0x98,0xb4,0x88,0x98,
+  0xdc,0xd8,0xb8,0xe4,0xe0,0xb8,0xe4,0xe8,0xd0,0xc8,0xb0,0xd8,0xd8,0xc0,0xe0,0xb4,
+  0xa8,0xf8,0x9c,0xa0,0xf8,0x9c,0x98,0xf8,0x80,0x80,0xf8,0x5c,0x58,0xe0,0xd4,0xb8,
+  0x30,0xb4,0xb8,0xe0,0xf0,0xf0,0xa0,0xe0,0xd8,0x58,0xcc,0xc0,0x10,0x90,0x90,0xc0,
+  0xb8,0x98,0xe0,0xd8,0xc8,0xe0,0xdc,0xc8,0xe8,0xdc,0xc8,0xe8,0xb4,0xa8,0xd8,0xd4,
+  0xc0,0x28,0xb0,0xb0,0x80,0xd8,0xd0,0x40,0xc4,0xc8,0xe8,0xe0,0xc8,0xe8,0xe0,0xd0,
+  0xe0,0xe0,0xc8,0x28,0xac,0xb0,0xc8,0xc0,0x98,0xa0,0x9c,0x80,0xe8,0xe4,0xd0,0xf0,
+  0xe8,0xd8,0xe8,0xe4,0xd8,0xc8,0xc4,0xa8,0xb0,0xac,0x90,0xf0,0xec,0xe8,0x08,0x04,
+  0x08,0x00,0x04,0x00,0x08,0x08,0x08,0xf0,0xf0,0xe8,0xe0,0xe0,0xd0,0x00,0x50,0x80,
+  0x00,0x50,0x78,0x00,0x44,0x68,0x00,0x40,0x60,0x88,0x80,0x68,0x10,0x0c,0x10,0x00,
+  0x54,0x80,0x00,0x68,0x98,0x10,0x7c,0xb8,0xe8,0xe8,0xd8,0x30,0xa0,0xd8,0x48,0xb4,
+  0xe0,0x28,0xa0,0xd8,0x30,0x98,0xd0,0x00,0x64,0x98,0x10,0x7c,0xb0,0x78,0xcc,0xf0,
+  0x98,0xdc,0xf0,0x68,0xc4,0xe8,0x58,0xb4,0xe0,0x10,0x80,0xb8,0xc0,0xb0,0x98,0xe8,
+  0xec,0xe0,0xf0,0xec,0xe0,0x20,0x20,0x20,0xa8,0xe0,0xf0,0xe0,0xf0,0xf8,0xa0,0xe0,
+  0xf0,0x38,0xac,0xd8,0x08,0x7c,0xb8,0xf0,0xe4,0xd8,0x10,0x10,0x10,0x60,0xb8,0xd8,
+  0xa8,0xe8,0xf8,0x78,0xd0,0xf8,0x10,0x84,0xc0,0x20,0x1c,0x20,0x10,0x78,0xb0,0xd0,
+  0xcc,0xa8,0xf8,0xf4,0xf0,0xf0,0xe8,0xe0,0xf8,0xf0,0xe8,0xc0,0xb4,0x98,0x30,0x30,
+  0x30,0xd8,0xcc,0xa8,0x28,0x28,0x28,0xf8,0xf4,0xe8,0x50,0x54,0x50,0xf0,0xf4,0xe8,
+  0x18,0x18,0x18,0x50,0x4c,0x50,0x38,0x38,0x38,0x10,0x14,0x10,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x08,0xfe,0x00,0x01,0x08,0x1c,0x48,0xb0,0xa0,
+  0xc1,0x83,0x08,0x13,0x2a,0x5c,0x98,0x30,0x80,0xc3,0x87,0x10,0x19,0x22,0x74,0x28,
+  0x60,0x00,0x81,0x02,0x06,0x0a,0x1c,0x40,0x30,0x20,0x81,0x43,0x89,0x03,0x1d,0x0e,
+  0x30,0x70,0xc0,0x80,0x01,0x05,0x24,0x17,0xa8,0x3c,0x70,0x80,0xc1,0x47,0x86,0x01,
+  0x1a,0x9c,0x9c,0xa9,0x40,0xa3,0x83,0x07,0x10,0x22,0x48,0x60,0x69,0x60,0x42,0x80,
+  0x85,0x01,0x28,0x28,0x50,0x50,0x81,0xe8,0xd0,0x0a,0x16,0x2e,0x60,0xc8,0xa0,0x61,
+  0xc3,0x01,0x94,0x14,0x38,0xfc,0x9c,0xf8,0xb4,0x42,0x07,0x0f,0x1f,0x40,0x1c,0x08,
+  0x61,0x41,0xc4,0x08,0x12,0x18,0x9a,0x1e,0xd0,0x58,0x82,0x82,0x89,0xa9,0x05,0x03,
+  0x9c,0x50,0x80,0x22,0x85,0x8a,0x14,0x2b,0x58,0xb4,0x50,0xe0,0xe2,0x05,0x8c,0x18,
+  0x17,0x1c,0x34,0x60,0xd9,0x80,0x81,0x5f,0x19,0x68,0x43,0xa2,0x98,0x41,0xa3,0x86,
+  0x8d,0x1a,0x34,0x6e,0x80,0x40,0x81,0x21,0x06,0x8e,0x18,0x2f,0x72,0xec,0xd5,0xb1,
+  0x83,0x47,0x0f,0x1f,0x0d,0x02,0x03,0x08,0xa0,0xe0,0x07,0x90,0x20,0x42,0x86,0x10,
+  0x29,0x92,0xc2,0x08,0x0a,0x17,0x47,0x90,0xc4,0x48,0xa2,0xa4,0x82,0x8e,0x25,0x4c,
+  0x9a,0x38,0x79,0xb2,0xc0,0x25,0xc1,0x00,0x3f,0x7e,0x40,0xb1,0x11,0x45,0xca,0x14,
+  0x2a,0x34,0x5a,0x00,0xa9,0x62,0xe5,0x0a,0x16,0x25,0x59,0x14,0x34,0xd1,0xb2,0x85,
+  0x4b,0x13,0x1e,0x0b,0xba,0xa0,0x55,0xfb,0xc3,0x8b,0x97,0x2f,0x52,0xc0,0x84,0x11,
+  0xa3,0x62,0x0c,0x10,0x2f,0x59,0xc8,0xfe,0x28,0x29,0x13,0x62,0x06,0x13,0x33,0x67,
+  0xd0,0x68,0xd9,0x21,0xd3,0xf6,0xe6,0x34,0x5e,0xd4,0x78,0x59,0xc3,0xa6,0x8d,0x9b,
+  0x37,0x35,0xbe,0x5b,0xff,0x01,0x07,0x08,0x90,0x19,0x71,0x98,0x21,0xc7,0x1c,0x74,
+  0xd4,0x41,0x41,0x01,0x76,0x4c,0x15,0xc0,0x1d,0x5e,0xe0,0x81,0x47,0x1e,0x7a,0x7c,
+  0x61,0x43,0x10,0x77,0x38,0x98,0x87,0x75,0x7b,0x78,0x91,0x1b,0x13,0x7c,0xf4,0xe1,
+  0x07,0x13,0x25,0xa1,0xf4,0x53,0x00,0xd6,0x39,0xf8,0x07,0x1e,0x80,0x04,0x92,0x22,
+  0x20,0x78,0x9c,0x88,0xc7,0x7e,0x50,0xf8,0x57,0x47,0x1c,0x82,0x1c,0x30,0xc8,0x58,
+  0x06,0x10,0xe2,0x90,0x17,0x79,0xa0,0x08,0x48,0x21,0x85,0x18,0x52,0xc8,0x21,0x3f,
+  0x02,0xc2,0xe2,0x85,0x78,0xec,0x01,0x85,0x67,0x88,0xb4,0x90,0x48,0x22,0x03,0x94,
+  0x94,0x60,0x00,0x0e,0xa6,0x58,0x88,0x22,0x8b,0x30,0xd2,0x88,0x23,0x44,0x16,0xf2,
+  0x08,0x8b,0x2f,0x6a,0xf8,0x83,0x02,0x90,0x44,0x22,0xc9,0x24,0x94,0xec,0x34,0xa5,
+  0x8f,0x87,0x18,0xd0,0xc8,0x40,0x95,0x38,0x22,0x24,0x91,0x47,0x5a,0x07,0x84,0x25,
+  0x97,0x60,0x72,0x89,0x25,0x93,0x44,0xa9,0x80,0x43,0x56,0x16,0xa2,0x59,0x23,0x99,
+  0x08,0xe9,0x25,0x98,0x5e,0x5c,0xa2,0xc9,0x26,0x9c,0x74,0xe2,0x09,0x24,0x3b,0x15,
+  0x00,0xe8,0x21,0x41,0x6a,0xc6,0x88,0x22,0x85,0x0a,0xca,0x88,0x21,0x0e,0x7e,0x02,
+  0x4a,0x28,0xa2,0x8c,0x42,0xca,0x25,0xa5,0xb0,0xe4,0x10,0x91,0x99,0x64,0x62,0xa9,
+  0x29,0xa7,0xa8,0x2a,0x10,0x2a,0xae,0x87,0x78,0xf1,0x49,0x2a,0xaa,0xac,0xc2,0x8a,
+  0x27,0xad,0x94,0x60,0xc0,0x4f,0x8b,0x38,0xe2,0x4a,0x26,0xa7,0x04,0x16,0x80,0x01,
+  0x8e,0x04,0x4b,0xd0,0x2b,0x2f,0xc2,0x12,0x8b,0x2c,0xb3,0x90,0x52,0xd4,0xae,0x02,
+  0xd1,0x52,0x48,0xaa,0xc2,0x16,0x6b,0xec,0x40,0xaf,0xc4,0xfa,0xc3,0x27,0xb5,0xa4,
+  0xa1,0x80,0x2d,0x26,0x4d,0x55,0xc9,0x2d,0x99,0xe0,0x02,0xed,0x66,0xb7,0x38,0x92,
+  0x8b,0x66,0x00,0xa0,0xb2,0x1f,0x1c,0x21,0x84,0x30,0x94,0x2e,0x68,0xed,0x82,0x4b,
+  0xaa,0xbb,0x0e,0xab,0x2e,0xbb,0x00,0x30,0x52,0x08,0x7f,0x33,0xcc,0x60,0x0b,0x2f,
+  0xe7,0x0a,0xd4,0xcb,0x2d,0xa7,0x9c,0xe2,0x88,0x23,0xbe,0x38,0x92,0x2e,0xbf,0x00,
+  0xbc,0x02,0x48,0x6e,0xf1,0x2a,0x90,0x60,0x41,0xbf,0x00,0x73,0x8a,0x29,0xc5,0x16,
+  0x0b,0xb1,0x40,0xc1,0x00,0x12,0xf0,0x9f,0xfc,0x0a,0x93,0xee,0x29,0x8a,0x24,0xfc,
+  0xb1,0x40,0x11,0x25,0x84,0xca,0x30,0x08,0x5f,0x0b,0x12,0x43,0xbd,0x10,0xb3,0xf2,
+  0xcc,0x38,0x4b,0x14,0x10,0x00,0x3b
+  };
+
+/* Created by reswrap from file information.gif */
+const unsigned char information[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x20,0x00,0x20,0x00,0xa5,0x00,0x00,0xf8,0x00,0x00,
+  0xc8,0xc8,0xc8,0xc0,0xc0,0xc0,0xa8,0xc0,0xc8,0xc0,0xb8,0xa8,0xa8,0xa4,0x98,0x90,
+  0x94,0x90,0x38,0x50,0x60,0xf8,0xf8,0xf8,0xf0,0xf0,0xe8,0xe0,0xe0,0xe0,0xd8,0xd8,
+  0xd8,0x88,0x8c,0x88,0x50,0x50,0x48,0x78,0x74,0x68,0x38,0x38,0x38,0x08,0x38,0x60,
+  0x00,0x40,0x68,0x10,0x40,0x58,0xe0,0xe8,0xe8,0xc8,0xd4,0xd8,0x98,0xb8,0xc8,0x80,
+  0xa0,0xb0,0xb8,0xcc,0xd8,0x60,0x90,0xa8,0x48,0x84,0xa0,0x28,0x74,0x98,0x08,0x1c,
+  0x30,0x10,0x68,0x98,0x08,0x64,0x90,0x10,0x5c,0x88,0x00,0x38,0x68,0xd8,0xd8,0xc8,
+  0x08,0x58,0x90,0x08,0x58,0x88,0x10,0x58,0x88,0x18,0x48,0x70,0xd0,0xc8,0xb8,0xb8,
+  0xb0,0x98,0x08,0x50,0x80,0xb8,0xb0,0xa8,0x08,0x48,0x70,0xe8,0xe8,0xe0,0xe0,0xd8,
+  0xc8,0xa0,0xa0,0x90,0xe8,0xe0,0xd0,0x18,0x50,0x78,0xb8,0xa8,0x88,0x00,0x30,0x58,
+  0x00,0x00,0x08,0x00,0x2c,0x50,0xe0,0xd4,0xc0,0xa0,0x98,0x90,0xe8,0xd8,0xc0,0xe8,
+  0xe0,0xc8,0x00,0x24,0x40,0xe0,0xd0,0xb0,0xe8,0xd8,0xb8,0xe0,0xcc,0xa8,0xb8,0xa0,
+  0x78,0xe8,0xd0,0xb8,0x30,0x30,0x30,0xe0,0xc8,0xa0,0xd8,0xd0,0xc0,0x2c,0x00,0x00,
+  0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x06,0xfe,0x40,0x80,0x70,0x48,0x2c,0x1a,0x8f,
+  0x48,0x63,0x40,0x10,0x58,0x3a,0x03,0x03,0x42,0xc1,0x70,0x48,0x26,0x03,0x88,0xac,
+  0x56,0x9b,0x50,0x2c,0x0e,0x0c,0xeb,0x11,0xbb,0x2d,0x77,0x1b,0x82,0xb0,0x98,0x28,
+  0x28,0xbb,0x13,0x0d,0x44,0xc0,0xb1,0x7e,0x40,0x22,0x12,0x7c,0x64,0xe2,0xce,0xc6,
+  0x11,0x69,0x56,0x12,0x10,0x03,0x01,0x14,0x14,0x15,0x16,0x10,0x12,0x09,0x6e,0x0e,
+  0x0b,0x59,0x01,0x6a,0x45,0x07,0x11,0x02,0x0b,0x87,0x17,0x17,0x03,0x89,0x18,0x7b,
+  0x65,0x0e,0x02,0x0a,0x59,0x81,0x45,0x12,0x14,0x13,0x14,0x9c,0x16,0x19,0x19,0x1a,
+  0xad,0x1a,0x12,0x0a,0x8d,0x59,0x0e,0x0d,0xb7,0x07,0x0f,0x0f,0x1b,0x44,0x12,0x04,
+  0x13,0x9b,0xac,0x59,0x1c,0x1d,0x1c,0x1c,0x1a,0x1e,0x1f,0xb3,0x5a,0x20,0x14,0x52,
+  0x0e,0xb6,0x43,0x11,0x16,0x14,0x17,0x16,0x18,0x1a,0x5b,0x21,0x21,0x22,0x1e,0x23,
+  0x24,0x11,0xcb,0x59,0x0a,0x20,0x25,0x26,0x05,0x74,0x00,0x0f,0x12,0x15,0x17,0x15,
+  0xd8,0x1a,0x1c,0x59,0xdb,0x22,0x22,0xdb,0x27,0x24,0x03,0xa3,0x59,0x5d,0x0b,0x25,
+  0x28,0xe9,0x20,0x60,0x08,0xa6,0x41,0x43,0x87,0x83,0xf4,0xb6,0x8d,0x08,0x91,0x22,
+  0x05,0x89,0x00,0x13,0x1a,0x25,0x50,0xb1,0x82,0x42,0x09,0x16,0x42,0x3e,0x58,0x18,
+  0x70,0x2d,0xde,0x41,0x0f,0xf4,0x16,0xde,0x8b,0x00,0x81,0xc0,0x82,0x04,0x13,0x55,
+  0xb4,0x58,0x01,0x02,0x23,0x00,0x08,0x16,0xde,0x65,0x20,0x56,0x06,0x64,0x08,0x90,
+  0x2e,0x3e,0x40,0x28,0x20,0x0a,0xa5,0xfe,0xca,0x16,0x20,0x5e,0x08,0x11,0xf8,0xce,
+  0x63,0x07,0x0f,0x5a,0x3c,0xd8,0x14,0x91,0x02,0x02,0x8c,0x02,0x04,0x56,0xa8,0xf8,
+  0x09,0xb4,0x40,0x46,0x0c,0xac,0x0c,0x6e,0x0b,0xa1,0xc5,0xde,0x4d,0xa6,0x30,0x9e,
+  0xa2,0x00,0x31,0xb5,0xc5,0xca,0xa0,0x42,0x62,0x68,0x60,0x05,0xd2,0x1e,0xd2,0x2c,
+  0x0b,0xed,0x9d,0x88,0x00,0x43,0x46,0x01,0x14,0x14,0xa8,0xae,0x98,0x21,0x14,0x40,
+  0x0c,0x12,0x18,0x32,0xb4,0xad,0xa7,0xe5,0x84,0x61,0x17,0x4d,0x65,0x48,0xa0,0x81,
+  0xd7,0xac,0xd9,0x1a,0x35,0xfa,0x3e,0x88,0x71,0x00,0x59,0xbd,0x13,0x6f,0x11,0x9c,
+  0x48,0x81,0x38,0x82,0x8c,0x0d,0x34,0x68,0x98,0xa0,0x60,0xd6,0x86,0x8d,0x1a,0x7c,
+  0x87,0xc4,0x80,0xe0,0xa2,0x75,0x8a,0x3e,0x24,0x24,0xc0,0xb8,0x71,0xc0,0x00,0x0b,
+  0x02,0x33,0x5a,0x98,0x86,0x8c,0xa3,0xaf,0xba,0x18,0x30,0x1a,0x92,0x68,0x4d,0x9c,
+  0x84,0xf1,0x1b,0x1b,0x62,0x18,0xa0,0x51,0xa0,0xc4,0x8a,0xdd,0x35,0x72,0xe8,0xd8,
+  0x41,0x64,0xb2,0x8c,0x3b,0x1f,0x3e,0x48,0x18,0x54,0xf7,0xb3,0x72,0x1a,0x2c,0x50,
+  0x38,0x3f,0x1d,0x9d,0xc7,0xf4,0x22,0x3d,0x62,0xdc,0x90,0x11,0x56,0x86,0x7b,0xe4,
+  0xc9,0x69,0xd8,0x36,0x51,0x62,0x06,0xe4,0xe8,0x38,0x70,0x9c,0x37,0x12,0xa3,0xff,
+  0x8d,0xff,0xc9,0xf5,0xc7,0xc0,0x7c,0xf5,0xad,0x10,0x5d,0x0e,0xe6,0xe9,0xb0,0x9f,
+  0x11,0x01,0xf6,0xa7,0x9e,0x01,0x0c,0x80,0x47,0xdf,0x0c,0xa7,0xe5,0x90,0x43,0x7e,
+  0x3a,0xe0,0xe0,0x03,0x75,0x56,0x4e,0x30,0x50,0x40,0x68,0xe0,0xdd,0x55,0x1f,0x64,
+  0x16,0xf2,0xa0,0x9f,0x0e,0x3e,0x6c,0x28,0x86,0x01,0x28,0xa0,0x50,0x80,0x09,0x28,
+  0x10,0x50,0xc2,0x7d,0x08,0x9e,0xa8,0x61,0x8a,0x1c,0x26,0x41,0x40,0x33,0x3f,0x50,
+  0x30,0x03,0x08,0x34,0x5e,0xa8,0x5f,0x8a,0x44,0xa6,0xa3,0x23,0x01,0x48,0x9a,0xa0,
+  0xa4,0x92,0x2f,0xbc,0xb0,0x83,0x93,0x3b,0x44,0xb9,0x03,0x34,0x46,0xae,0x61,0xe5,
+  0x95,0x58,0x22,0x11,0x04,0x00,0x3b
+  };
+
+/* Created by reswrap from file question.gif */
+const unsigned char question[]={
+  0x47,0x49,0x46,0x38,0x39,0x61,0x10,0x00,0x10,0x00,0xf4,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0xa6,0xbf,0xa2,0xf0,0xf4,0xef,0xeb,0xf1,0xea,0xe1,0xe9,0xe0,0xcb,
+  0xda,0xc9,0xf3,0xf6,0xf3,0xd2,0xdf,0xd0,0xc3,0xd4,0xc1,0xac,0xc3,0xa8,0xbc,0xcf,
+  0xb8,0x2b,0x2b,0x2b,0xe6,0xed,0xe4,0x21,0x2e,0x1f,0x65,0x8b,0x5e,0x8c,0xad,0x86,
+  0x96,0xb4,0x91,0xb8,0xcc,0xb5,0x8d,0xad,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x05,
+  0x46,0x20,0x20,0x8a,0x41,0x59,0x8e,0xe8,0x18,0x08,0x03,0x51,0x18,0x41,0xaa,0x1a,
+  0xc7,0x50,0xdc,0x48,0x9c,0x06,0xc9,0xa0,0x98,0x8b,0x82,0x82,0x21,0x0b,0x34,0x1c,
+  0xaa,0x9b,0x6e,0x87,0x0a,0x08,0x97,0x32,0xd2,0xed,0x01,0x2d,0xde,0x20,0xd5,0xdd,
+  0x35,0xdb,0x8c,0x14,0xb0,0xd1,0x66,0x21,0xc2,0xdd,0x99,0xc2,0x66,0xb4,0x58,0x52,
+  0x6e,0x4a,0x26,0xed,0x66,0x39,0x04,0x00,0x3b
+  };
+
+/* Created by reswrap from file tinycalc.gif */
+const unsigned char tinycalc[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xc2,0x00,0x00,0x00,0x80,0x80,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0x00,0xe0,0xb4,0x30,0x00,0x00,0x00,0xe0,0x88,0x28,0xd0,
+  0xfc,0xc8,0xc0,0xc0,0xc0,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x03,
+  0x42,0x08,0xba,0xdc,0xfe,0x30,0xb2,0x20,0xa8,0xad,0x38,0x2c,0x31,0x3a,0xf9,0xe0,
+  0x37,0x14,0x04,0x10,0x74,0x03,0x61,0xac,0xec,0x31,0x96,0x9c,0x77,0xcc,0xb4,0x4b,
+  0x9a,0x68,0xae,0xdf,0x1c,0x11,0xf8,0xc0,0xdf,0xef,0x76,0xd2,0x19,0x79,0x29,0x61,
+  0x30,0x70,0x20,0x10,0x8d,0xc7,0x12,0xa0,0x40,0xad,0x5a,0xab,0xa5,0x90,0x56,0x2b,
+  0xe9,0x7a,0x13,0x00,0x3b
+  };
+
+/* Created by reswrap from file constmem.bmp */
+const unsigned char constmem[]={
+  0x42,0x4d,0x36,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x55,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0c,0x00,0x00,0x6d,0x0b,0x00,0x00,0x6d,0x0b,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf6,0xfa,0xf6,
+  0xb8,0xbb,0xb8,0xf3,0xf7,0xf3,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0x00,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xd2,0xd6,0xd2,
+  0x41,0x43,0x41,0x8d,0x90,0x8d,0xf3,0xf7,0xf3,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0x00,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xc1,0xc4,0xc1,0x8d,0x8f,0x8d,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0x00,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xdc,0xdf,0xdc,0x65,
+  0x67,0x65,0x7e,0x80,0x7e,0x6d,0x6e,0x6d,0x4a,0x4b,0x4a,0xe7,0xea,0xe7,0xb8,0xbc,
+  0xb8,0x6b,0x6d,0x6b,0x5e,0x60,0x5e,0xa1,0xa3,0xa1,0xf8,0xfc,0xf8,0xd7,0xdb,0xd7,
+  0x6c,0x6d,0x6c,0xf8,0xfc,0xf8,0xe9,0xed,0xe9,0x3e,0x3f,0x3e,0xa4,0xa7,0xa4,0xe1,
+  0xe5,0xe1,0x53,0x54,0x53,0x7e,0x80,0x7e,0x8e,0x90,0x8e,0xf8,0xfc,0xf8,0x84,0x86,
+  0x84,0x70,0x72,0x70,0xd2,0xd6,0xd2,0x9f,0xa1,0x9f,0x5e,0x60,0x5e,0xad,0xb0,0xad,
+  0xae,0xb0,0xae,0x5f,0x61,0x5f,0xd7,0xda,0xd7,0x8e,0x90,0x8e,0xb6,0xb8,0xb6,0xf8,
+  0xfc,0xf8,0xa8,0xab,0xa8,0x60,0x62,0x60,0xc3,0xc6,0xc3,0xf8,0xfc,0xf8,0x3f,0x40,
+  0x3f,0x96,0x98,0x96,0xf2,0xf6,0xf2,0xf8,0xfc,0xf8,0xe7,0xeb,0xe7,0x85,0x88,0x85,
+  0x68,0x69,0x68,0xea,0xee,0xea,0xbf,0xc2,0xbf,0xc5,0xc8,0xc5,0xe5,0xe9,0xe5,0x94,
+  0x97,0x94,0x32,0x33,0x32,0xc2,0xc5,0xc2,0xec,0xf0,0xec,0x53,0x54,0x53,0x74,0x76,
+  0x74,0x9b,0x9d,0x9b,0xe5,0xe9,0xe5,0xc4,0xc7,0xc4,0x70,0x71,0x70,0xf8,0xfc,0xf8,
+  0xe1,0xe5,0xe1,0x67,0x69,0x67,0xf8,0xfc,0xf8,0xe4,0xe8,0xe4,0x3f,0x40,0x3f,0xa9,
+  0xac,0xa9,0xf8,0xfc,0xf8,0xa9,0xac,0xa9,0x6d,0x6f,0x6d,0x5c,0x5e,0x5c,0xb0,0xb3,
+  0xb0,0xf8,0xfc,0xf8,0xbe,0xc1,0xbe,0xb8,0xbb,0xb8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xc1,0xc4,0xc1,0x0e,0x0e,0x0e,0xdf,0xe3,0xdf,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0x00,0xf8,0xfc,0xf8,0xf6,0xfa,0xf6,0x2a,0x2b,0x2a,0xd6,
+  0xd9,0xd6,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xcb,0xce,0xcb,0xa4,0xa7,0xa4,0x3b,0x3c,
+  0x3b,0xc7,0xca,0xc7,0xf5,0xf9,0xf5,0x3d,0x3f,0x3d,0xa7,0xaa,0xa7,0xef,0xf3,0xef,
+  0x26,0x27,0x26,0xea,0xed,0xea,0xf3,0xf7,0xf3,0x28,0x29,0x28,0xbb,0xbe,0xbb,0xd0,
+  0xd4,0xd0,0xa9,0xab,0xa9,0xec,0xf0,0xec,0x18,0x19,0x18,0xdf,0xe3,0xdf,0x7c,0x7e,
+  0x7c,0x8a,0x8d,0x8a,0xb6,0xb9,0xb6,0x54,0x55,0x54,0xa5,0xa8,0xa5,0xdb,0xdf,0xdb,
+  0x60,0x62,0x60,0x65,0x66,0x65,0xc5,0xc8,0xc5,0xad,0xaf,0xad,0x5a,0x5c,0x5a,0xf8,
+  0xfc,0xf8,0xb7,0xba,0xb7,0x4f,0x51,0x4f,0xc0,0xc3,0xc0,0xf8,0xfc,0xf8,0x27,0x28,
+  0x27,0xd5,0xd9,0xd5,0xc0,0xc3,0xc0,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xd9,0xdc,0xd9,
+  0x81,0x83,0x81,0xf8,0xfc,0xf8,0x7c,0x7f,0x7c,0x32,0x33,0x32,0xf2,0xf6,0xf2,0xeb,
+  0xef,0xeb,0x12,0x12,0x12,0xf3,0xf7,0xf3,0xa8,0xaa,0xa8,0x46,0x47,0x46,0xf8,0xfc,
+  0xf8,0xe4,0xe8,0xe4,0xb0,0xb3,0xb0,0xed,0xf1,0xed,0x26,0x27,0x26,0xeb,0xef,0xeb,
+  0xf8,0xfc,0xf8,0x32,0x33,0x32,0xdf,0xe3,0xdf,0xf2,0xf6,0xf2,0x22,0x23,0x22,0xc5,
+  0xc8,0xc5,0xdc,0xe0,0xdc,0x20,0x21,0x20,0xe2,0xe5,0xe2,0xf0,0xf4,0xf0,0x2b,0x2c,
+  0x2b,0xbe,0xc1,0xbe,0xcc,0xd0,0xcc,0x36,0x37,0x36,0xf6,0xfa,0xf6,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xc1,0xc4,0xc1,0x37,0x38,0x37,0x95,0x98,0x95,0xf7,0xfb,0xf7,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0x00,0xf8,0xfc,0xf8,0xbf,0xc3,0xbf,0x41,0x43,0x41,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xef,0xf3,0xef,0x39,0x39,
+  0x39,0xb0,0xb3,0xb0,0xf8,0xfc,0xf8,0xa6,0xa9,0xa6,0x39,0x3a,0x39,0xf8,0xfc,0xf8,
+  0x4e,0x4f,0x4e,0xa2,0xa4,0xa2,0xf8,0xfc,0xf8,0x60,0x62,0x60,0x97,0x9a,0x97,0xf8,
+  0xfc,0xf8,0xf4,0xf8,0xf4,0x62,0x64,0x62,0x3a,0x3b,0x3a,0xf3,0xf7,0xf3,0xca,0xce,
+  0xca,0x4c,0x4d,0x4c,0xf8,0xfc,0xf8,0x8f,0x92,0x8f,0x59,0x5a,0x59,0xf8,0xfc,0xf8,
+  0x9a,0x9d,0x9a,0x1d,0x1d,0x1d,0xf2,0xf6,0xf2,0xe4,0xe8,0xe4,0x1a,0x1b,0x1a,0xe9,
+  0xed,0xe9,0xf0,0xf4,0xf0,0x15,0x16,0x15,0xea,0xee,0xea,0xf8,0xfc,0xf8,0x75,0x77,
+  0x75,0xa1,0xa3,0xa1,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf5,0xf9,0xf5,
+  0x6f,0x70,0x6f,0xf8,0xfc,0xf8,0x4d,0x4e,0x4d,0x9b,0x9e,0x9b,0x8b,0x8d,0x8b,0xf8,
+  0xfc,0xf8,0x36,0x37,0x36,0xc1,0xc4,0xc1,0xbe,0xc1,0xbe,0x12,0x12,0x12,0x8d,0x8f,
+  0x8d,0x9d,0x9f,0x9d,0xeb,0xef,0xeb,0xf8,0xfc,0xf8,0x49,0x4a,0x49,0xa7,0xaa,0xa7,
+  0xf8,0xfc,0xf8,0x64,0x66,0x64,0x6e,0x6f,0x6e,0xf8,0xfc,0xf8,0x6f,0x71,0x6f,0xa1,
+  0xa3,0xa1,0xf8,0xfc,0xf8,0x1e,0x1e,0x1e,0xcb,0xce,0xcb,0xf8,0xfc,0xf8,0x8c,0x8e,
+  0x8c,0x54,0x55,0x54,0xf8,0xfc,0xf8,0x15,0x15,0x15,0xd3,0xd7,0xd3,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xc1,0xc4,0xc1,0x4d,0x4f,0x4d,0xad,0xb0,0xad,0xc6,0xc9,0xc6,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0x00,0xf8,0xfc,0xf8,0xb7,0xba,0xb7,0x38,0x3a,0x38,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0x8f,0x92,
+  0x8f,0x59,0x5b,0x59,0xf8,0xfc,0xf8,0xe6,0xea,0xe6,0x12,0x13,0x12,0xf8,0xfc,0xf8,
+  0x8d,0x8f,0x8d,0x3c,0x3d,0x3c,0xe0,0xe3,0xe0,0xb7,0xba,0xb7,0x50,0x51,0x50,0xf8,
+  0xfc,0xf8,0x7c,0x7d,0x7c,0x4b,0x4c,0x4b,0xec,0xf0,0xec,0xf8,0xfc,0xf8,0xf3,0xf7,
+  0xf3,0x2d,0x2d,0x2d,0xee,0xf2,0xee,0xe8,0xec,0xe8,0x32,0x33,0x32,0xc5,0xc9,0xc5,
+  0xf2,0xf6,0xf2,0x26,0x26,0x26,0xc1,0xc4,0xc1,0xf8,0xfc,0xf8,0x32,0x33,0x32,0x80,
+  0x82,0x80,0xf6,0xfa,0xf6,0x5d,0x5e,0x5d,0xaa,0xad,0xaa,0xf8,0xfc,0xf8,0xb4,0xb7,
+  0xb4,0x61,0x63,0x61,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0x6d,0x6e,0x6d,0xf4,0xf8,0xf4,0x23,0x24,0x23,0xd7,0xda,0xd7,0xb3,0xb6,0xb3,0xc0,
+  0xc3,0xc0,0x75,0x77,0x75,0x8b,0x8e,0x8b,0xf1,0xf5,0xf1,0x2b,0x2b,0x2b,0xd4,0xd7,
+  0xd4,0xbe,0xc1,0xbe,0x32,0x32,0x32,0xe9,0xec,0xe9,0x88,0x8a,0x88,0x3f,0x40,0x3f,
+  0xe2,0xe5,0xe2,0xa3,0xa6,0xa3,0x1a,0x1b,0x1a,0xc4,0xc7,0xc4,0xae,0xb1,0xae,0x59,
+  0x5b,0x59,0xf8,0xfc,0xf8,0x74,0x77,0x74,0x74,0x76,0x74,0xf8,0xfc,0xf8,0xcb,0xcf,
+  0xcb,0x2d,0x2e,0x2d,0xf8,0xfc,0xf8,0x54,0x56,0x54,0x7d,0x7f,0x7d,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xa8,0xab,0xa8,0x75,0x77,0x75,0xf8,0xfc,0xf8,0x56,0x57,0x56,0xf6,
+  0xfa,0xf6,0xf8,0xfc,0xf8,0x00,0xf8,0xfc,0xf8,0xef,0xf3,0xef,0x0b,0x0c,0x0b,0xe0,
+  0xe3,0xe0,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf3,0xf7,
+  0xf3,0x5f,0x61,0x5f,0x74,0x75,0x74,0x7b,0x7d,0x7b,0x65,0x66,0x65,0xef,0xf3,0xef,
+  0x70,0x72,0x70,0x29,0x2a,0x29,0xa4,0xa7,0xa4,0x89,0x8c,0x89,0x25,0x26,0x25,0xf8,
+  0xfc,0xf8,0xa4,0xa6,0xa4,0x6a,0x6c,0x6a,0x64,0x65,0x64,0x83,0x86,0x83,0xd0,0xd3,
+  0xd0,0x2d,0x2d,0x2d,0x84,0x86,0x84,0xbc,0xbf,0xbc,0xe2,0xe6,0xe2,0x65,0x66,0x65,
+  0x82,0x84,0x82,0x3d,0x3e,0x3d,0x96,0x98,0x96,0xca,0xcd,0xca,0x3a,0x3b,0x3a,0x6e,
+  0x70,0x6e,0x9b,0x9e,0x9b,0x4e,0x50,0x4e,0x7f,0x82,0x7f,0xf8,0xfc,0xf8,0xa7,0xa9,
+  0xa7,0x24,0x25,0x24,0x92,0x95,0x92,0xdf,0xe2,0xdf,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0x9f,0xa2,0x9f,0xc1,0xc4,0xc1,0x13,0x13,0x13,0xf8,0xfc,0xf8,0xf6,0xfa,0xf6,0x85,
+  0x87,0x85,0xad,0xaf,0xad,0x54,0x55,0x54,0xf8,0xfc,0xf8,0xd0,0xd3,0xd0,0x51,0x53,
+  0x51,0x88,0x8a,0x88,0x2a,0x2b,0x2a,0xd6,0xda,0xd6,0x6d,0x6f,0x6d,0x2e,0x2e,0x2e,
+  0xa2,0xa5,0xa2,0x87,0x89,0x87,0x26,0x27,0x26,0x8b,0x8e,0x8b,0x7b,0x7c,0x7b,0x2e,
+  0x2f,0x2e,0xf8,0xfc,0xf8,0xea,0xed,0xea,0x55,0x56,0x55,0x7c,0x7e,0x7c,0x70,0x72,
+  0x70,0x7b,0x7d,0x7b,0xf0,0xf4,0xf0,0x63,0x65,0x63,0x41,0x42,0x41,0x5e,0x60,0x5e,
+  0x72,0x74,0x72,0x62,0x65,0x62,0x7f,0x81,0x7f,0xf8,0xfc,0xf8,0x41,0x43,0x41,0xcc,
+  0xcf,0xcc,0xf8,0xfc,0xf8,0x00,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0x6f,0x70,0x6f,0x89,
+  0x8b,0x89,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xcc,0xcf,0xcc,0xee,0xf2,
+  0xee,0xf8,0xfc,0xf8,0xe7,0xeb,0xe7,0xe5,0xe8,0xe5,0xf8,0xfc,0xf8,0xf6,0xfa,0xf6,
+  0xe3,0xe7,0xe3,0xb8,0xbb,0xb8,0xf8,0xfc,0xf8,0xeb,0xef,0xeb,0xeb,0xee,0xeb,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xeb,0xef,0xeb,0xe3,0xe7,0xe3,0xf5,0xf9,0xf5,0xf0,0xf3,
+  0xf0,0x84,0x86,0x84,0x7a,0x7c,0x7a,0xec,0xef,0xec,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xe5,0xe8,0xe5,0xe3,0xe7,0xe3,0xf6,0xfa,0xf6,0xee,0xf2,0xee,0xd7,0xda,0xd7,0xcb,
+  0xcf,0xcb,0xf8,0xfc,0xf8,0xe4,0xe8,0xe4,0xf2,0xf6,0xf2,0xf8,0xfc,0xf8,0xe9,0xec,
+  0xe9,0x36,0x37,0x36,0xc8,0xcb,0xc8,0xf3,0xf6,0xf3,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xcd,0xd1,0xcd,0x51,0x52,0x51,0x47,0x48,0x47,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xea,
+  0xee,0xea,0x6e,0x70,0x6e,0x15,0x15,0x15,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf6,0xfa,
+  0xf6,0xe3,0xe7,0xe3,0xea,0xee,0xea,0xf5,0xf9,0xf5,0xe3,0xe7,0xe3,0xb8,0xbb,0xb8,
+  0xf8,0xfc,0xf8,0xeb,0xef,0xeb,0xeb,0xef,0xeb,0xf8,0xfc,0xf8,0xe5,0xe9,0xe5,0xeb,
+  0xef,0xeb,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xe5,0xe9,0xe5,0xe7,0xeb,
+  0xe7,0xf8,0xfc,0xf8,0xf4,0xf8,0xf4,0xd7,0xdb,0xd7,0xcb,0xce,0xcb,0xee,0xf2,0xee,
+  0xed,0xf0,0xed,0xee,0xf2,0xee,0xf2,0xf6,0xf2,0xf8,0xfc,0xf8,0xe9,0xec,0xe9,0xf2,
+  0xf6,0xf2,0xf8,0xfc,0xf8,0x00,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf2,0xf6,0xf2,0x61,
+  0x63,0x61,0x6d,0x6f,0x6d,0xc5,0xc8,0xc5,0xc2,0xc5,0xc2,0x42,0x42,0x42,0xc5,0xc9,
+  0xc5,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf5,0xf9,0xf5,0xc1,0xc4,0xc1,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xe1,0xe5,0xe1,0xd5,0xd8,0xd5,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xd7,0xdb,0xd7,0x03,0x03,0x03,0x80,0x82,0x80,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xa4,0xa6,0xa4,0x0c,0x0c,0x0c,0xa4,0xa6,0xa4,0xef,0xf2,0xef,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0x00,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf7,
+  0xfb,0xf7,0xdc,0xe0,0xdc,0xb1,0xb4,0xb1,0xb1,0xb4,0xb1,0xd1,0xd5,0xd1,0xf5,0xf9,
+  0xf5,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xc3,0xc6,0xc3,0xb1,0xb4,0xb1,0xd6,0xda,0xd6,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf7,0xfb,0xf7,0xbc,0xbf,0xbc,0xc4,0xc7,0xc4,0xf6,0xfa,0xf6,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0x00,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,
+  0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,
+  0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,0xfc,0xf8,0xf8,
+  0xfc,0xf8,0xf8,0xfc,0xf8,0x00
+  };
+
@@ -0,0 +1,20 @@
+/*********** Generated on 2026/10/18 22:46:56 by reswrap version 6.0.0 *********/
+
+/* Created by reswrap from file bigcalc.gif */
+extern const unsigned char bigcalc[];
+
+/* Created by reswrap from file colors.gif */
+extern const unsigned char colors[];
+
+/* Created by reswrap from file information.gif */
+extern const unsigned char information[];
+
+/* Created by reswrap from file question.gif */
+extern const unsigned char question[];
+
+/* Created by reswrap from file tinycalc.gif */
+extern const unsigned char tinycalc[];
+
+/* Created by reswrap from file constmem.bmp */
+extern const unsigned char constmem[];
+
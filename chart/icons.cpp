@@ -0,0 +1,780 @@
+/*********** Generated on 2026/10/18 22:46:56 by reswrap version 6.0.0 *********/
+
+#include "icons.h"
+
+/* Created by reswrap from file marble.bmp */
+const unsigned char marble[]={
+  0x42,0x4d,0x36,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x30,0x00,0x00,0x6d,0x0b,0x00,0x00,0x6d,0x0b,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xb0,0xc0,0xd0,0xb0,0xc0,0xd0,0xb0,0xc0,0xcd,0xb0,
+  0xc0,0xcd,0xb1,0xc0,0xd0,0xb0,0xbf,0xcf,0xaf,0xbd,0xcf,0xad,0xbb,0xcd,0xab,0xb9,
+  0xcb,0xa9,0xb7,0xca,0xa9,0xb7,0xce,0xab,0xb9,0xd0,0xac,0xba,0xd1,0xac,0xba,0xd1,
+  0xab,0xb9,0xd0,0xab,0xb9,0xd0,0xab,0xb9,0xd0,0xac,0xba,0xd1,0xab,0xb9,0xcf,0xab,
+  0xb9,0xcf,0xaa,0xb8,0xcf,0xaa,0xb8,0xcf,0xa9,0xb6,0xd0,0xa7,0xb4,0xce,0xa6,0xb2,
+  0xce,0xa5,0xb1,0xcd,0xa0,0xaf,0xd0,0x9f,0xae,0xcf,0x9e,0xad,0xcd,0x9c,0xab,0xcb,
+  0x99,0xa8,0xc9,0x94,0xa1,0xc7,0x8e,0x9a,0xc4,0x89,0x94,0xc0,0x7d,0x8d,0xbb,0x82,
+  0x92,0xc0,0x86,0x93,0xc1,0x89,0x96,0xc4,0x86,0x95,0xc3,0x77,0x87,0xb5,0x6a,0x7e,
+  0xad,0x6e,0x86,0xb4,0x89,0x98,0xbf,0x94,0xa4,0xc9,0x9f,0xad,0xd1,0xa0,0xaf,0xd0,
+  0xa0,0xb0,0xcd,0xa4,0xb3,0xcd,0xa5,0xb5,0xcc,0xa4,0xb4,0xcb,0xa4,0xb4,0xcb,0xa4,
+  0xb3,0xcd,0xa1,0xb2,0xcd,0xa0,0xb0,0xcd,0x9b,0xad,0xcc,0x97,0xaa,0xcb,0x95,0xa8,
+  0xcb,0x94,0xa7,0xca,0x88,0x9c,0xc5,0x87,0x9b,0xc4,0x86,0x99,0xc4,0x85,0x98,0xc3,
+  0x86,0x99,0xc6,0x88,0x9b,0xc8,0xaf,0xbf,0xd0,0xaf,0xbf,0xcf,0xaf,0xbe,0xce,0xb0,
+  0xbf,0xcf,0xb0,0xbf,0xcf,0xaf,0xbd,0xcf,0xae,0xbc,0xce,0xac,0xba,0xcd,0xaa,0xb8,
+  0xcb,0xa9,0xb7,0xca,0xa9,0xb7,0xce,0xab,0xb9,0xd0,0xac,0xba,0xd1,0xac,0xba,0xd1,
+  0xab,0xb9,0xd0,0xab,0xb9,0xd0,0xab,0xb9,0xd0,0xac,0xba,0xd1,0xac,0xba,0xd0,0xac,
+  0xba,0xd0,0xac,0xba,0xd1,0xac,0xba,0xd1,0xab,0xb8,0xd2,0xa9,0xb6,0xd0,0xa8,0xb4,
+  0xd0,0xa7,0xb3,0xcf,0xa2,0xb1,0xd2,0xa1,0xb0,0xd0,0xa0,0xaf,0xcf,0x9e,0xad,0xcd,
+  0x9b,0xaa,0xcb,0x96,0xa4,0xc8,0x91,0x9d,0xc5,0x8c,0x97,0xc3,0x7a,0x8c,0xbb,0x7a,
+  0x8c,0xbb,0x80,0x90,0xbf,0x87,0x96,0xc7,0x81,0x91,0xc0,0x6a,0x7c,0xab,0x68,0x7c,
+  0xab,0x7e,0x95,0xc3,0x93,0xa3,0xc8,0x98,0xa8,0xcc,0x9f,0xae,0xcf,0xa1,0xb0,0xd0,
+  0xa2,0xb2,0xcf,0xa7,0xb6,0xd0,0xa7,0xb7,0xce,0xa6,0xb6,0xcd,0xa7,0xb7,0xce,0xa4,
+  0xb5,0xcf,0xa4,0xb5,0xcf,0xa2,0xb3,0xce,0x9f,0xb1,0xce,0x9d,0xaf,0xce,0x9b,0xac,
+  0xcd,0x98,0xab,0xcc,0x93,0xa6,0xcb,0x92,0xa5,0xca,0x91,0xa4,0xc9,0x8f,0xa2,0xc8,
+  0x8e,0xa1,0xc7,0x8e,0xa0,0xc9,0xae,0xbe,0xcf,0xae,0xbe,0xcf,0xaf,0xbe,0xce,0xb0,
+  0xbf,0xcf,0xb0,0xbe,0xd0,0xaf,0xbd,0xcf,0xae,0xbc,0xce,0xac,0xba,0xcd,0xaa,0xb8,
+  0xcb,0xa8,0xb6,0xc9,0xa9,0xb7,0xce,0xaa,0xb8,0xcf,0xac,0xba,0xd1,0xac,0xba,0xd1,
+  0xab,0xb9,0xd0,0xab,0xb9,0xd0,0xab,0xb9,0xd0,0xac,0xba,0xd1,0xac,0xba,0xd0,0xac,
+  0xba,0xd0,0xac,0xba,0xd1,0xac,0xba,0xd1,0xab,0xb8,0xd2,0xaa,0xb7,0xd1,0xa9,0xb5,
+  0xd1,0xa9,0xb5,0xd1,0xa6,0xb3,0xd3,0xa5,0xb3,0xd0,0xa3,0xb1,0xce,0xa1,0xaf,0xcc,
+  0x9f,0xac,0xcc,0x9b,0xa7,0xc9,0x95,0xa0,0xc6,0x91,0x9a,0xc5,0x79,0x8d,0xbd,0x79,
+  0x8a,0xbb,0x79,0x8a,0xbd,0x7d,0x8e,0xc1,0x79,0x8a,0xbd,0x6a,0x7e,0xae,0x74,0x88,
+  0xb7,0x91,0xa6,0xd3,0x9b,0xab,0xcf,0x9c,0xad,0xce,0xa0,0xaf,0xd0,0xa1,0xb0,0xd0,
+  0xa4,0xb5,0xd0,0xa9,0xb8,0xd2,0xa9,0xb8,0xd2,0xa8,0xb8,0xcf,0xa6,0xb8,0xcf,0xa6,
+  0xb8,0xcf,0xa5,0xb6,0xd0,0xa4,0xb5,0xcf,0xa3,0xb4,0xcf,0xa1,0xb1,0xce,0xa0,0xb0,
+  0xcd,0x9f,0xaf,0xcc,0x9a,0xae,0xcd,0x9a,0xae,0xcd,0x9a,0xad,0xce,0x99,0xac,0xcd,
+  0x98,0xab,0xcc,0x98,0xab,0xce,0xae,0xbe,0xcf,0xae,0xbe,0xcf,0xaf,0xbd,0xcf,0xaf,
+  0xbd,0xcf,0xb0,0xbe,0xd0,0xaf,0xbd,0xd0,0xae,0xbc,0xcf,0xac,0xba,0xcd,0xaa,0xb7,
+  0xcd,0xa8,0xb5,0xcb,0xa8,0xb6,0xcd,0xaa,0xb8,0xcf,0xab,0xb9,0xd0,0xab,0xb9,0xd0,
+  0xaa,0xb8,0xcf,0xaa,0xb8,0xcf,0xaa,0xb8,0xcf,0xab,0xb9,0xd0,0xaa,0xb8,0xce,0xab,
+  0xb9,0xcf,0xab,0xb9,0xd0,0xab,0xb9,0xd0,0xab,0xb8,0xd2,0xaa,0xb7,0xd1,0xa9,0xb5,
+  0xd1,0xa9,0xb5,0xd1,0xa6,0xb4,0xd1,0xa5,0xb3,0xcf,0xa3,0xb1,0xcd,0xa1,0xaf,0xcb,
+  0x9f,0xad,0xca,0x9b,0xa7,0xc9,0x97,0xa3,0xc7,0x93,0x9d,0xc5,0x7f,0x91,0xc0,0x7e,
+  0x8f,0xc0,0x75,0x86,0xb9,0x6f,0x80,0xb3,0x73,0x84,0xb7,0x78,0x8a,0xb9,0x87,0x98,
+  0xc3,0x9b,0xad,0xd6,0xa0,0xb1,0xd2,0x9e,0xb0,0xcf,0x9f,0xae,0xce,0xa2,0xb2,0xcf,
+  0xa5,0xb6,0xd1,0xa8,0xb7,0xd1,0xa9,0xb8,0xd2,0xa9,0xb9,0xd0,0xa6,0xb8,0xcf,0xa6,
+  0xb8,0xcf,0xa6,0xb8,0xcf,0xa5,0xb6,0xd0,0xa6,0xb5,0xcf,0xa5,0xb4,0xce,0xa4,0xb3,
+  0xcd,0xa3,0xb1,0xcd,0x9d,0xb2,0xcd,0x9e,0xb3,0xce,0x9f,0xb4,0xd0,0x9e,0xb3,0xcf,
+  0x9c,0xb0,0xcf,0x9c,0xb0,0xcf,0xae,0xbd,0xd0,0xae,0xbd,0xd0,0xae,0xbc,0xce,0xae,
+  0xbc,0xce,0xae,0xbc,0xce,0xae,0xbc,0xcf,0xac,0xba,0xcd,0xaa,0xb7,0xcd,0xa8,0xb5,
+  0xcb,0xa7,0xb4,0xca,0xa7,0xb5,0xcc,0xa8,0xb6,0xcd,0xaa,0xb8,0xcf,0xaa,0xb8,0xcf,
+  0xa9,0xb7,0xce,0xa9,0xb7,0xce,0xa9,0xb7,0xce,0xaa,0xb8,0xcf,0xa8,0xb6,0xcc,0xa9,
+  0xb7,0xcd,0xa9,0xb7,0xce,0xaa,0xb8,0xcf,0xa9,0xb6,0xd0,0xa9,0xb6,0xd0,0xa8,0xb4,
+  0xd0,0xa8,0xb4,0xd0,0xa7,0xb3,0xcf,0xa6,0xb3,0xcd,0xa4,0xb1,0xcb,0xa2,0xaf,0xc9,
+  0xa0,0xac,0xc8,0x9d,0xa8,0xc8,0x99,0xa2,0xc7,0x95,0x9e,0xc4,0x86,0x96,0xc1,0x84,
+  0x94,0xc3,0x72,0x83,0xb4,0x67,0x78,0xab,0x73,0x84,0xb5,0x86,0x96,0xc4,0x93,0xa2,
+  0xc9,0x9c,0xaa,0xce,0xa1,0xb3,0xd0,0x9e,0xb0,0xcd,0xa0,0xb0,0xcd,0xa3,0xb4,0xcf,
+  0xa5,0xb6,0xd1,0xa7,0xb6,0xd0,0xa8,0xb7,0xd1,0xab,0xba,0xd4,0xa6,0xb8,0xcf,0xa6,
+  0xb8,0xcf,0xa6,0xb8,0xcf,0xa8,0xb8,0xcf,0xa8,0xb8,0xcf,0xa9,0xb7,0xce,0xa8,0xb6,
+  0xcd,0xa8,0xb6,0xcd,0xa1,0xb5,0xce,0xa3,0xb7,0xd0,0xa4,0xb7,0xd2,0xa3,0xb6,0xd1,
+  0xa0,0xb2,0xcf,0x9e,0xb0,0xcd,0xac,0xbb,0xce,0xac,0xbb,0xce,0xac,0xba,0xcc,0xac,
+  0xba,0xcd,0xac,0xba,0xcd,0xac,0xba,0xcd,0xaa,0xb7,0xcd,0xa8,0xb5,0xcb,0xa6,0xb2,
+  0xca,0xa5,0xb1,0xc9,0xa5,0xb3,0xca,0xa7,0xb5,0xcc,0xa9,0xb7,0xce,0xa9,0xb7,0xce,
+  0xa8,0xb6,0xcd,0xa7,0xb5,0xcc,0xa8,0xb6,0xcd,0xa9,0xb7,0xce,0xa7,0xb5,0xcb,0xa8,
+  0xb6,0xcc,0xa8,0xb6,0xcd,0xa9,0xb7,0xce,0xa9,0xb6,0xd0,0xa9,0xb6,0xd0,0xa8,0xb4,
+  0xd0,0xa8,0xb4,0xd0,0xa5,0xb2,0xcc,0xa4,0xb1,0xcb,0xa1,0xaf,0xc6,0xa0,0xae,0xc5,
+  0x9e,0xab,0xc5,0x9b,0xa6,0xc4,0x97,0xa1,0xc3,0x95,0x9e,0xc3,0x88,0x96,0xc0,0x83,
+  0x93,0xbe,0x73,0x83,0xb2,0x6f,0x7e,0xaf,0x81,0x91,0xc0,0x95,0xa3,0xcd,0x9d,0xa9,
+  0xcd,0xa0,0xab,0xc9,0xa1,0xb4,0xcf,0x9f,0xb2,0xcd,0xa1,0xb2,0xcd,0xa5,0xb6,0xd1,
+  0xa5,0xb6,0xd1,0xa6,0xb5,0xcf,0xa8,0xb7,0xd1,0xad,0xbc,0xd6,0xa7,0xb9,0xd0,0xa7,
+  0xb9,0xd0,0xa7,0xba,0xcf,0xaa,0xbb,0xd0,0xac,0xba,0xd0,0xab,0xb9,0xcf,0xab,0xb8,
+  0xce,0xab,0xb8,0xce,0xa4,0xb5,0xcf,0xa7,0xb8,0xd2,0xa9,0xba,0xd5,0xa8,0xb9,0xd4,
+  0xa4,0xb5,0xd0,0xa3,0xb3,0xd0,0xab,0xba,0xcd,0xab,0xba,0xcd,0xaa,0xb8,0xcb,0xaa,
+  0xb8,0xcb,0xaa,0xb8,0xcb,0xaa,0xb8,0xcb,0xa9,0xb6,0xcc,0xa7,0xb4,0xca,0xa4,0xb0,
+  0xc8,0xa3,0xaf,0xc7,0xa5,0xb3,0xca,0xa6,0xb4,0xcb,0xa8,0xb6,0xcd,0xa8,0xb6,0xcd,
+  0xa7,0xb5,0xcc,0xa6,0xb4,0xcb,0xa7,0xb5,0xcc,0xa8,0xb6,0xcd,0xa7,0xb5,0xcb,0xa7,
+  0xb5,0xcb,0xa8,0xb6,0xcd,0xa9,0xb7,0xce,0xa9,0xb6,0xd0,0xa9,0xb6,0xd0,0xa8,0xb4,
+  0xd0,0xa8,0xb4,0xd0,0xa4,0xb1,0xcb,0xa2,0xb0,0xc7,0xa0,0xae,0xc5,0x9e,0xac,0xc3,
+  0x9d,0xaa,0xc4,0x9a,0xa5,0xc3,0x97,0xa2,0xc2,0x94,0x9d,0xc2,0x88,0x94,0xbc,0x81,
+  0x8f,0xb9,0x75,0x83,0xb3,0x79,0x88,0xb9,0x90,0x9f,0xcd,0xa0,0xac,0xd4,0xa3,0xae,
+  0xce,0xa7,0xb0,0xcb,0xa1,0xb4,0xcf,0x9f,0xb2,0xcd,0xa2,0xb3,0xce,0xa6,0xb7,0xd2,
+  0xa6,0xb7,0xd1,0xa6,0xb5,0xcf,0xa9,0xb8,0xd2,0xaf,0xbe,0xd8,0xa7,0xb9,0xd0,0xa8,
+  0xbb,0xd0,0xa8,0xbb,0xd0,0xab,0xbc,0xd1,0xad,0xbb,0xd1,0xae,0xbc,0xcf,0xad,0xbb,
+  0xce,0xad,0xbb,0xce,0xa5,0xb6,0xd0,0xa8,0xb9,0xd3,0xab,0xbc,0xd7,0xab,0xbc,0xd7,
+  0xa8,0xb8,0xd5,0xa7,0xb7,0xd4,0xa6,0xba,0xcc,0xa3,0xb7,0xc9,0xa8,0xb9,0xce,0xa6,
+  0xb7,0xcc,0xa4,0xb5,0xca,0xa3,0xb3,0xca,0xa3,0xb3,0xca,0xa2,0xb1,0xcb,0xa1,0xb0,
+  0xca,0xa0,0xaf,0xc9,0xa1,0xb3,0xca,0xa0,0xb2,0xc9,0xa2,0xb2,0xc9,0xa2,0xb2,0xc9,
+  0xa5,0xb3,0xca,0xa6,0xb4,0xcb,0xa6,0xb4,0xcb,0xa6,0xb2,0xca,0xa6,0xb4,0xcb,0xa6,
+  0xb4,0xcb,0xa6,0xb4,0xcb,0xa7,0xb5,0xcc,0xa8,0xb6,0xcd,0xa7,0xb5,0xcc,0xa5,0xb3,
+  0xca,0xa3,0xb1,0xc8,0x9d,0xb3,0xcc,0x9c,0xad,0xc7,0x9f,0xac,0xc6,0xa4,0xad,0xc8,
+  0x9f,0xa8,0xc3,0x92,0x9d,0xb9,0x8d,0x9b,0xb8,0x90,0x9f,0xbf,0x83,0x8d,0xbc,0x80,
+  0x8c,0xb6,0x84,0x8f,0xb5,0x90,0x9d,0xbd,0xa1,0xad,0xc9,0xaa,0xb8,0xcf,0xa7,0xb5,
+  0xcc,0xa1,0xaf,0xc6,0xa9,0xb8,0xcb,0xa9,0xb8,0xcb,0xa9,0xb7,0xcd,0xa9,0xb7,0xcd,
+  0xaa,0xb8,0xcf,0xaa,0xb8,0xcf,0xab,0xb9,0xd0,0xab,0xb8,0xd2,0xa8,0xb9,0xd3,0xa6,
+  0xb7,0xd1,0xa6,0xb7,0xd1,0xa7,0xb8,0xd2,0xa9,0xba,0xd4,0xa9,0xba,0xd4,0xa7,0xb8,
+  0xd2,0xa5,0xb6,0xd0,0xac,0xb7,0xd2,0xa8,0xb5,0xcf,0xa7,0xb4,0xce,0xab,0xb7,0xd3,
+  0xaa,0xb8,0xd4,0xa8,0xb6,0xd2,0xa4,0xb8,0xca,0xa1,0xb5,0xc7,0xa6,0xb7,0xcc,0xa4,
+  0xb5,0xca,0xa2,0xb2,0xc9,0xa2,0xb2,0xc9,0xa2,0xb2,0xc9,0xa2,0xb1,0xcb,0xa0,0xaf,
+  0xc9,0x9f,0xae,0xc8,0x9e,0xb0,0xc7,0x9e,0xb0,0xc7,0xa0,0xb0,0xc7,0xa0,0xb0,0xc7,
+  0xa2,0xb0,0xc7,0xa3,0xb1,0xc8,0xa3,0xb1,0xc8,0xa2,0xb0,0xc7,0xa4,0xb2,0xc9,0xa4,
+  0xb2,0xc9,0xa4,0xb2,0xc9,0xa5,0xb3,0xca,0xa6,0xb4,0xcb,0xa6,0xb4,0xcb,0xa4,0xb2,
+  0xc9,0xa2,0xb0,0xc7,0x9d,0xae,0xc8,0x9f,0xae,0xc8,0x9f,0xac,0xc6,0x9e,0xa9,0xc5,
+  0x9d,0xa7,0xc5,0x9a,0xa5,0xc5,0x90,0x9e,0xc2,0x88,0x98,0xbc,0x7e,0x89,0xb5,0x82,
+  0x8e,0xb8,0x8c,0x98,0xbc,0x97,0xa5,0xc2,0xa2,0xaf,0xc9,0xa7,0xb5,0xcc,0xa6,0xb4,
+  0xcb,0xa6,0xb2,0xca,0xa9,0xb8,0xcb,0xa9,0xb8,0xcb,0xa9,0xb7,0xcd,0xa9,0xb7,0xcd,
+  0xaa,0xb8,0xcf,0xaa,0xb8,0xcf,0xab,0xb9,0xd0,0xab,0xb9,0xd0,0xa9,0xba,0xd4,0xa8,
+  0xb9,0xd3,0xa7,0xb8,0xd2,0xa7,0xb8,0xd2,0xa9,0xba,0xd4,0xa9,0xba,0xd4,0xa7,0xb8,
+  0xd2,0xa5,0xb6,0xd0,0xab,0xb8,0xd2,0xa8,0xb5,0xcf,0xa7,0xb4,0xce,0xaa,0xb7,0xd1,
+  0xa8,0xb7,0xd1,0xa5,0xb3,0xcf,0xa1,0xb4,0xc9,0x9e,0xb1,0xc6,0xa3,0xb4,0xc9,0xa1,
+  0xb1,0xc8,0xa0,0xb0,0xc7,0xa0,0xb0,0xc7,0xa1,0xb0,0xca,0xa0,0xaf,0xc9,0x9f,0xad,
+  0xc9,0x9e,0xac,0xc8,0x9d,0xae,0xc8,0x9d,0xae,0xc8,0x9d,0xae,0xc8,0x9f,0xae,0xc8,
+  0x9e,0xad,0xc7,0xa0,0xad,0xc7,0xa0,0xad,0xc7,0xa0,0xad,0xc7,0xa1,0xae,0xc8,0xa0,
+  0xad,0xc7,0xa1,0xae,0xc8,0xa3,0xb0,0xca,0xa4,0xb1,0xcb,0xa5,0xb2,0xcc,0xa3,0xb0,
+  0xca,0xa1,0xae,0xc8,0x9d,0xab,0xc2,0xa1,0xae,0xc8,0xa0,0xab,0xc7,0x9a,0xa3,0xc4,
+  0x9b,0xa4,0xc9,0x99,0xa5,0xcd,0x8e,0x9c,0xc6,0x7c,0x8c,0xb6,0x7d,0x86,0xb1,0x88,
+  0x93,0xb9,0x96,0xa2,0xc4,0xa1,0xad,0xc9,0xa3,0xb1,0xc8,0xa4,0xb1,0xc7,0xa7,0xb4,
+  0xca,0xaa,0xb7,0xcd,0xaa,0xb9,0xcc,0xaa,0xb9,0xcc,0xaa,0xb9,0xcc,0xaa,0xb8,0xce,
+  0xaa,0xb8,0xce,0xaa,0xb8,0xcf,0xab,0xb9,0xd0,0xab,0xb9,0xd0,0xa9,0xba,0xd4,0xa8,
+  0xb9,0xd3,0xa8,0xb9,0xd3,0xa8,0xb9,0xd3,0xa9,0xba,0xd4,0xa9,0xba,0xd4,0xa7,0xb8,
+  0xd2,0xa6,0xb7,0xd1,0xab,0xb9,0xcf,0xa9,0xb7,0xce,0xa8,0xb6,0xcd,0xa7,0xb6,0xd0,
+  0xa6,0xb5,0xcf,0xa1,0xb2,0xcd,0x9f,0xb2,0xc7,0x9c,0xaf,0xc4,0xa0,0xb0,0xc7,0x9f,
+  0xaf,0xc6,0x9f,0xaf,0xc6,0x9f,0xae,0xc8,0xa0,0xaf,0xc9,0xa0,0xae,0xca,0x9e,0xac,
+  0xc8,0x9d,0xab,0xc7,0x9b,0xae,0xc9,0x9b,0xae,0xc9,0x9d,0xae,0xc9,0x9d,0xae,0xc9,
+  0x9d,0xab,0xc7,0x9c,0xaa,0xc6,0x9e,0xaa,0xc6,0x9f,0xab,0xc7,0x9e,0xab,0xc5,0x9e,
+  0xab,0xc5,0x9f,0xac,0xc6,0xa1,0xae,0xc8,0xa3,0xb0,0xca,0xa3,0xb0,0xca,0xa2,0xaf,
+  0xc9,0xa0,0xad,0xc7,0xa0,0xaa,0xc2,0xa0,0xab,0xc6,0x9e,0xa7,0xc8,0x98,0xa1,0xc7,
+  0x91,0x9d,0xc7,0x8d,0x9a,0xc8,0x80,0x90,0xbe,0x75,0x85,0xb4,0x83,0x8e,0xb4,0x8f,
+  0x9b,0xbd,0x9f,0xaa,0xc8,0xa5,0xb2,0xcc,0xa3,0xb1,0xc7,0xa3,0xb1,0xc4,0xa7,0xb5,
+  0xc8,0xac,0xb9,0xcf,0xaa,0xba,0xcb,0xaa,0xba,0xcb,0xaa,0xb9,0xcc,0xab,0xba,0xcd,
+  0xab,0xb9,0xcf,0xab,0xb9,0xcf,0xaa,0xb8,0xcf,0xaa,0xb8,0xcf,0xa8,0xb9,0xd3,0xa8,
+  0xb9,0xd3,0xa8,0xb9,0xd3,0xa9,0xba,0xd4,0xa9,0xba,0xd4,0xa9,0xba,0xd4,0xa8,0xb9,
+  0xd3,0xa8,0xb9,0xd3,0xab,0xb9,0xcf,0xaa,0xb8,0xce,0xa7,0xb7,0xce,0xa7,0xb7,0xce,
+  0xa3,0xb4,0xce,0xa1,0xb2,0xcd,0x9f,0xb1,0xc8,0x9c,0xae,0xc5,0x9d,0xaf,0xc6,0x9d,
+  0xaf,0xc6,0x9c,0xad,0xc7,0x9d,0xae,0xc8,0x9e,0xaf,0xca,0x9d,0xae,0xc9,0x9b,0xab,
+  0xc8,0x9a,0xaa,0xc7,0x99,0xac,0xc7,0x9a,0xad,0xc8,0x9a,0xad,0xc8,0x9b,0xac,0xc7,
+  0x98,0xa9,0xc4,0x98,0xa6,0xc2,0x99,0xa7,0xc3,0x9a,0xa8,0xc4,0x9b,0xa7,0xc3,0x9b,
+  0xa7,0xc3,0x9c,0xa8,0xc4,0x9e,0xaa,0xc6,0xa1,0xad,0xc9,0xa1,0xad,0xc9,0xa0,0xac,
+  0xc8,0x9f,0xab,0xc7,0xa1,0xab,0xc3,0x9c,0xa7,0xc3,0x99,0xa3,0xc5,0x93,0x9f,0xc7,
+  0x87,0x94,0xc2,0x78,0x86,0xb6,0x73,0x83,0xb2,0x76,0x86,0xb5,0x90,0x9a,0xbc,0x98,
+  0xa3,0xc1,0xa0,0xad,0xc7,0xa5,0xb2,0xc8,0xa5,0xb3,0xc6,0xa5,0xb3,0xc5,0xaa,0xb5,
+  0xc9,0xae,0xb9,0xcd,0xaa,0xba,0xcb,0xaa,0xba,0xcb,0xab,0xbb,0xcc,0xac,0xbb,0xce,
+  0xab,0xba,0xcd,0xab,0xb9,0xcf,0xaa,0xb8,0xce,0xaa,0xb8,0xce,0xa5,0xb6,0xd0,0xa6,
+  0xb7,0xd1,0xa7,0xb8,0xd2,0xa8,0xb9,0xd3,0xa9,0xba,0xd4,0xa9,0xba,0xd4,0xa9,0xba,
+  0xd4,0xaa,0xbb,0xd5,0xa7,0xb8,0xcd,0xa8,0xb9,0xce,0xa8,0xb8,0xcf,0xa5,0xb6,0xd0,
+  0xa3,0xb4,0xcf,0x9f,0xb1,0xce,0xa0,0xb1,0xcb,0x9f,0xb0,0xca,0x9e,0xaf,0xc9,0x9d,
+  0xae,0xc8,0x9d,0xae,0xc8,0x9e,0xaf,0xca,0x9e,0xaf,0xca,0x9d,0xad,0xca,0x9b,0xab,
+  0xc8,0x99,0xa9,0xc6,0x93,0xa8,0xc4,0x97,0xa9,0xc6,0x97,0xa9,0xc6,0x95,0xa7,0xc4,
+  0x93,0xa3,0xc0,0x91,0xa1,0xbe,0x94,0xa2,0xbf,0x95,0xa3,0xc0,0x99,0xa5,0xc1,0x99,
+  0xa5,0xc1,0x9a,0xa6,0xc2,0x9c,0xa8,0xc4,0x9e,0xaa,0xc6,0x9e,0xaa,0xc6,0x9d,0xa9,
+  0xc5,0x9c,0xa8,0xc4,0x9d,0xa9,0xc1,0x97,0xa2,0xc0,0x90,0x9e,0xc2,0x8a,0x97,0xc3,
+  0x7a,0x89,0xb7,0x6d,0x7c,0xaa,0x72,0x82,0xad,0x82,0x8f,0xbb,0x99,0xa5,0xc1,0x9c,
+  0xa9,0xc3,0xa0,0xae,0xc4,0xa3,0xb1,0xc3,0xa5,0xb4,0xc4,0xaa,0xb7,0xc7,0xac,0xb8,
+  0xca,0xae,0xba,0xcc,0xaa,0xba,0xca,0xab,0xbb,0xcc,0xac,0xbc,0xcd,0xac,0xbc,0xcd,
+  0xac,0xbb,0xce,0xab,0xba,0xcd,0xaa,0xb8,0xce,0xa9,0xb7,0xcd,0xa4,0xb5,0xcf,0xa5,
+  0xb6,0xd0,0xa7,0xb8,0xd2,0xa8,0xb9,0xd3,0xa8,0xb9,0xd3,0xa8,0xb9,0xd3,0xa8,0xb9,
+  0xd3,0xa9,0xba,0xd4,0xa4,0xb4,0xcb,0xa7,0xb6,0xd0,0xa6,0xb7,0xd2,0xa3,0xb3,0xd0,
+  0x9f,0xb1,0xd0,0x9d,0xad,0xd1,0xa2,0xb3,0xcd,0xa2,0xb3,0xcd,0x9e,0xb2,0xcb,0x9d,
+  0xb1,0xca,0x9d,0xb0,0xcb,0x9d,0xb0,0xcb,0x9d,0xaf,0xcc,0x9c,0xae,0xcb,0x99,0xab,
+  0xc8,0x97,0xa9,0xc6,0x92,0xa6,0xc5,0x94,0xa8,0xc7,0x97,0xa9,0xc8,0x94,0xa6,0xc5,
+  0x8f,0xa1,0xc0,0x8f,0x9e,0xbe,0x8f,0x9e,0xbe,0x91,0xa0,0xc0,0x96,0xa2,0xbe,0x96,
+  0xa2,0xbe,0x96,0xa2,0xbe,0x98,0xa4,0xc0,0x9a,0xa6,0xc2,0x9a,0xa6,0xc2,0x99,0xa5,
+  0xc1,0x97,0xa3,0xbf,0x93,0xa2,0xbc,0x90,0x9f,0xbf,0x8a,0x9a,0xbf,0x7c,0x8d,0xb8,
+  0x71,0x81,0xaf,0x71,0x81,0xac,0x82,0x8e,0xb6,0x93,0x9f,0xc3,0x9b,0xa8,0xc2,0x9e,
+  0xaa,0xc2,0xa1,0xaf,0xc2,0xa4,0xb3,0xc3,0xa9,0xb6,0xc6,0xac,0xb9,0xc9,0xb0,0xba,
+  0xcb,0xb1,0xbb,0xcd,0xaa,0xba,0xca,0xab,0xbb,0xcb,0xac,0xbc,0xcd,0xad,0xbd,0xce,
+  0xad,0xbd,0xce,0xab,0xba,0xcd,0xaa,0xb9,0xcc,0xa9,0xb8,0xcb,0xa5,0xb6,0xd0,0xa6,
+  0xb7,0xd1,0xa8,0xb9,0xd3,0xa8,0xb9,0xd3,0xa6,0xb7,0xd1,0xa5,0xb6,0xd0,0xa6,0xb7,
+  0xd1,0xa7,0xb8,0xd2,0x9f,0xb0,0xca,0xa3,0xb4,0xcf,0xa4,0xb4,0xd1,0x9e,0xaf,0xd0,
+  0x9a,0xaa,0xce,0x99,0xa8,0xcf,0xa4,0xb5,0xcf,0xa5,0xb6,0xd1,0x9f,0xb3,0xcc,0x9e,
+  0xb2,0xcb,0x9e,0xb1,0xcc,0x9e,0xb1,0xcc,0x9e,0xb0,0xcd,0x9c,0xae,0xcb,0x99,0xab,
+  0xc8,0x97,0xa9,0xc8,0x93,0xa7,0xc6,0x95,0xa9,0xc8,0x96,0xaa,0xc9,0x95,0xa7,0xc6,
+  0x90,0xa2,0xc1,0x8f,0x9e,0xbe,0x90,0x9f,0xbf,0x92,0xa1,0xc1,0x94,0xa0,0xbc,0x94,
+  0xa0,0xbc,0x94,0xa0,0xbc,0x96,0xa2,0xbe,0x97,0xa3,0xbf,0x98,0xa4,0xc0,0x96,0xa2,
+  0xbe,0x94,0xa0,0xbc,0x8b,0x9c,0xb7,0x8e,0xa0,0xbf,0x85,0x97,0xbc,0x73,0x84,0xaf,
+  0x6c,0x7c,0xaa,0x7b,0x89,0xb3,0x91,0x9d,0xc1,0x9e,0xa9,0xc9,0x9a,0xa6,0xbe,0x9d,
+  0xaa,0xc0,0xa2,0xb0,0xc2,0xa5,0xb4,0xc4,0xaa,0xb7,0xc5,0xad,0xba,0xc8,0xb1,0xbb,
+  0xcc,0xb3,0xbd,0xcf,0xaa,0xba,0xca,0xab,0xbb,0xcb,0xac,0xbc,0xcc,0xad,0xbd,0xce,
+  0xad,0xbd,0xce,0xab,0xba,0xcd,0xaa,0xb9,0xcc,0xa8,0xb7,0xca,0xa6,0xb7,0xd1,0xa8,
+  0xb9,0xd3,0xa9,0xba,0xd4,0xa8,0xb9,0xd3,0xa5,0xb6,0xd0,0xa3,0xb4,0xce,0xa3,0xb4,
+  0xce,0xa4,0xb5,0xcf,0x9e,0xaf,0xca,0xa1,0xb1,0xce,0xa2,0xb1,0xd1,0x9a,0xaa,0xce,
+  0x96,0xa5,0xcc,0x92,0xa2,0xcc,0xa9,0xb9,0xd0,0xa9,0xb9,0xd0,0xa5,0xb9,0xd2,0xa2,
+  0xb6,0xcf,0xa0,0xb3,0xce,0x9f,0xb2,0xcd,0x9f,0xb1,0xce,0x9e,0xb0,0xcf,0x9b,0xac,
+  0xcd,0x99,0xaa,0xcb,0x91,0xa2,0xc9,0x92,0xa3,0xca,0x93,0xa5,0xca,0x93,0xa3,0xc8,
+  0x90,0xa0,0xc4,0x8d,0x9e,0xbf,0x8e,0x9d,0xbe,0x8e,0x9d,0xbd,0x8e,0x9c,0xc0,0x8f,
+  0x9d,0xc1,0x91,0xa0,0xc1,0x93,0xa2,0xc3,0x94,0xa3,0xc4,0x93,0xa2,0xc3,0x8f,0x9e,
+  0xbe,0x8c,0x9b,0xbb,0x8b,0x99,0xbd,0x85,0x95,0xba,0x80,0x90,0xba,0x78,0x88,0xb2,
+  0x74,0x85,0xac,0x86,0x94,0xb8,0x97,0xa5,0xc2,0x99,0xa6,0xc0,0xa0,0xab,0xbf,0xa2,
+  0xad,0xc1,0xa4,0xaf,0xc3,0xa5,0xb0,0xc4,0xa7,0xb2,0xc6,0xa9,0xb4,0xc8,0xac,0xb7,
+  0xcb,0xae,0xb9,0xcd,0xab,0xb9,0xcc,0xad,0xbb,0xce,0xac,0xbb,0xce,0xaa,0xb8,0xce,
+  0xa8,0xb6,0xcc,0xa5,0xb6,0xcb,0xa6,0xb7,0xcc,0xa8,0xb9,0xce,0xaa,0xbb,0xd0,0xaa,
+  0xbb,0xd0,0xa9,0xb9,0xd0,0xa8,0xb8,0xcf,0xaa,0xb8,0xcf,0xa9,0xb7,0xce,0xa7,0xb5,
+  0xcc,0xa5,0xb3,0xca,0x9a,0xad,0xd3,0x9c,0xad,0xd4,0x9a,0xab,0xd2,0x93,0xa4,0xcb,
+  0x8d,0x9c,0xc3,0x8c,0x9c,0xc1,0xaa,0xba,0xd1,0xaa,0xba,0xd1,0xa6,0xbb,0xd1,0xa4,
+  0xb8,0xd1,0xa2,0xb6,0xcf,0xa1,0xb4,0xcf,0xa1,0xb3,0xd0,0xa0,0xb2,0xd1,0x9d,0xae,
+  0xcf,0x9b,0xac,0xcd,0x94,0xa5,0xcc,0x95,0xa7,0xcc,0x95,0xa7,0xcc,0x95,0xa5,0xc9,
+  0x92,0xa2,0xc6,0x8e,0x9f,0xc0,0x8e,0x9d,0xbe,0x8e,0x9d,0xbd,0x90,0x9f,0xc0,0x8f,
+  0x9e,0xbf,0x8f,0x9e,0xbf,0x90,0x9f,0xc0,0x91,0xa0,0xc1,0x91,0xa0,0xc1,0x8f,0x9e,
+  0xbf,0x8d,0x9c,0xbd,0x88,0x96,0xba,0x85,0x95,0xba,0x81,0x91,0xbb,0x78,0x88,0xb3,
+  0x70,0x80,0xaa,0x81,0x8f,0xb3,0x94,0xa2,0xbf,0x99,0xa6,0xc0,0xa0,0xab,0xbf,0xa2,
+  0xad,0xc1,0xa4,0xaf,0xc3,0xa6,0xb1,0xc5,0xa7,0xb2,0xc6,0xa9,0xb4,0xc8,0xac,0xb7,
+  0xcb,0xaf,0xba,0xce,0xac,0xba,0xcd,0xad,0xbb,0xce,0xad,0xbc,0xcf,0xac,0xbb,0xce,
+  0xaa,0xb9,0xcc,0xa7,0xb8,0xcd,0xa9,0xba,0xcf,0xaa,0xbb,0xd0,0xad,0xbb,0xd1,0xac,
+  0xba,0xd0,0xaa,0xb8,0xcf,0xa7,0xb6,0xd0,0xa6,0xb4,0xd0,0xa4,0xb2,0xcf,0xa3,0xb0,
+  0xd0,0xa1,0xae,0xce,0x90,0xa1,0xc8,0x90,0xa1,0xc8,0x91,0xa2,0xc9,0x93,0xa3,0xc8,
+  0x95,0xa5,0xca,0x99,0xa7,0xcb,0xac,0xbc,0xd3,0xac,0xbc,0xd3,0xaa,0xbd,0xd2,0xa8,
+  0xba,0xd1,0xa6,0xb8,0xcf,0xa5,0xb6,0xd0,0xa5,0xb6,0xd1,0xa4,0xb4,0xd1,0xa2,0xb1,
+  0xd1,0xa0,0xaf,0xcf,0x98,0xaa,0xcf,0x99,0xab,0xd0,0x99,0xac,0xcf,0x98,0xa8,0xcc,
+  0x94,0xa5,0xc6,0x90,0xa1,0xc2,0x8f,0x9e,0xbf,0x8e,0x9d,0xbe,0x91,0xa0,0xc1,0x8f,
+  0x9e,0xbf,0x8e,0x9d,0xbe,0x8d,0x9c,0xbd,0x8e,0x9d,0xbe,0x8e,0x9d,0xbe,0x8e,0x9d,
+  0xbe,0x8d,0x9c,0xbd,0x84,0x92,0xb6,0x83,0x93,0xb8,0x82,0x92,0xbc,0x76,0x86,0xb1,
+  0x6b,0x7b,0xa5,0x7b,0x89,0xad,0x91,0x9f,0xbc,0x98,0xa5,0xbf,0xa1,0xac,0xc0,0xa3,
+  0xae,0xc2,0xa5,0xb0,0xc4,0xa7,0xb2,0xc6,0xa8,0xb3,0xc7,0xaa,0xb5,0xc9,0xad,0xb8,
+  0xcc,0xaf,0xba,0xce,0xad,0xbc,0xcc,0xae,0xbc,0xce,0xad,0xbd,0xce,0xac,0xbb,0xce,
+  0xaa,0xb9,0xcc,0xa8,0xb9,0xce,0xa8,0xb9,0xce,0xa9,0xba,0xcf,0xaa,0xb8,0xcb,0xaa,
+  0xb7,0xcd,0xa9,0xb6,0xd0,0xa6,0xb4,0xd0,0xa3,0xaf,0xd1,0x9e,0xab,0xd1,0x98,0xa7,
+  0xce,0x96,0xa4,0xce,0x8a,0x9a,0xc4,0x8c,0x9b,0xc2,0x8f,0x9f,0xc4,0x96,0xa6,0xca,
+  0xa1,0xb0,0xd1,0xa6,0xb5,0xd5,0xad,0xbe,0xd3,0xad,0xbe,0xd3,0xaa,0xbd,0xd2,0xa9,
+  0xbc,0xd1,0xa8,0xba,0xd1,0xa7,0xb9,0xd0,0xa6,0xb7,0xd1,0xa5,0xb6,0xd1,0xa4,0xb4,
+  0xd1,0xa3,0xb3,0xd0,0x9d,0xb0,0xd3,0x9d,0xb0,0xd3,0x9c,0xaf,0xd0,0x9b,0xac,0xcd,
+  0x96,0xa7,0xc8,0x91,0xa2,0xc3,0x90,0x9f,0xc0,0x8f,0x9e,0xbf,0x8f,0x9e,0xbe,0x8e,
+  0x9d,0xbd,0x8d,0x9c,0xbd,0x8c,0x9b,0xbc,0x8d,0x9c,0xbd,0x8d,0x9c,0xbd,0x8c,0x9a,
+  0xbe,0x8a,0x98,0xbc,0x83,0x91,0xb5,0x81,0x90,0xb7,0x7e,0x8e,0xb9,0x73,0x83,0xae,
+  0x69,0x79,0xa3,0x7a,0x87,0xad,0x90,0x9d,0xbd,0x98,0xa4,0xc0,0xa1,0xac,0xc0,0xa3,
+  0xae,0xc2,0xa6,0xb1,0xc5,0xa8,0xb3,0xc7,0xa9,0xb4,0xc8,0xab,0xb6,0xca,0xad,0xb8,
+  0xcc,0xaf,0xba,0xce,0xae,0xbd,0xcd,0xae,0xbd,0xcd,0xac,0xbc,0xcd,0xab,0xbb,0xcc,
+  0xa9,0xb8,0xcb,0xa5,0xb6,0xcb,0xa4,0xb4,0xcb,0xa3,0xb3,0xca,0xa5,0xb2,0xc8,0xa6,
+  0xb2,0xca,0xa5,0xb1,0xcd,0xa2,0xaf,0xcf,0x9c,0xa9,0xcf,0x95,0xa3,0xcd,0x90,0x9f,
+  0xcd,0x8e,0x9c,0xcc,0x93,0xa2,0xc9,0x95,0xa1,0xc9,0x98,0xa6,0xca,0xa0,0xaf,0xd0,
+  0xab,0xb9,0xd6,0xae,0xbd,0xd7,0xae,0xbf,0xd4,0xae,0xbf,0xd4,0xab,0xbc,0xcf,0xab,
+  0xbc,0xcf,0xaa,0xbb,0xd0,0xa9,0xb9,0xd0,0xa8,0xb7,0xd1,0xa7,0xb6,0xd0,0xa7,0xb5,
+  0xd1,0xa7,0xb5,0xd1,0x9f,0xb3,0xd2,0x9f,0xb3,0xd2,0x9e,0xb1,0xd2,0x9d,0xae,0xcf,
+  0x97,0xa8,0xc9,0x92,0xa3,0xc4,0x91,0xa0,0xc1,0x90,0x9f,0xc0,0x8e,0x9e,0xbb,0x8d,
+  0x9c,0xbc,0x8d,0x9c,0xbc,0x8d,0x9c,0xbd,0x8d,0x9c,0xbd,0x8c,0x9a,0xbe,0x89,0x97,
+  0xbb,0x87,0x94,0xba,0x81,0x8e,0xb4,0x7d,0x8c,0xb3,0x79,0x89,0xb4,0x6f,0x7e,0xac,
+  0x69,0x79,0xa4,0x7c,0x89,0xaf,0x92,0x9f,0xbf,0x98,0xa4,0xc0,0x9f,0xaa,0xbe,0xa2,
+  0xad,0xc1,0xa5,0xb0,0xc4,0xa7,0xb2,0xc6,0xa9,0xb4,0xc8,0xaa,0xb5,0xc9,0xac,0xb7,
+  0xcb,0xad,0xb8,0xcc,0xab,0xba,0xca,0xab,0xba,0xca,0xa9,0xb9,0xca,0xa9,0xb8,0xcb,
+  0xa8,0xb6,0xcc,0xa4,0xb4,0xcb,0xa2,0xb1,0xcb,0xa1,0xaf,0xcb,0xa3,0xaf,0xcb,0xa1,
+  0xac,0xca,0x9b,0xa8,0xc8,0x94,0xa2,0xc6,0x90,0x9c,0xc4,0x8e,0x9b,0xc7,0x8f,0x9e,
+  0xcc,0x92,0xa0,0xd0,0x9e,0xac,0xd0,0x9f,0xad,0xd1,0xa5,0xb2,0xd2,0xa8,0xb6,0xd3,
+  0xad,0xba,0xd4,0xae,0xbc,0xd2,0xae,0xbf,0xd2,0xae,0xbf,0xd2,0xaa,0xbc,0xcd,0xab,
+  0xbd,0xce,0xab,0xbc,0xcf,0xaa,0xbb,0xd0,0xa8,0xb8,0xcf,0xa7,0xb6,0xd0,0xa8,0xb7,
+  0xd1,0xa8,0xb6,0xd2,0x9e,0xb3,0xcf,0x9f,0xb4,0xd0,0x9e,0xb2,0xd1,0x9d,0xaf,0xce,
+  0x98,0xa9,0xca,0x94,0xa5,0xc6,0x93,0xa2,0xc3,0x92,0xa1,0xc2,0x8d,0x9d,0xba,0x8d,
+  0x9d,0xba,0x8d,0x9c,0xbc,0x8d,0x9c,0xbd,0x8d,0x9c,0xbd,0x8b,0x99,0xbd,0x88,0x95,
+  0xbb,0x85,0x92,0xb8,0x80,0x8d,0xb3,0x7a,0x88,0xb2,0x75,0x84,0xb2,0x6c,0x7b,0xa9,
+  0x66,0x76,0xa1,0x7b,0x87,0xaf,0x91,0x9d,0xbf,0x98,0xa3,0xc1,0x9d,0xa8,0xbc,0xa0,
+  0xab,0xbf,0xa4,0xaf,0xc3,0xa6,0xb1,0xc5,0xa7,0xb2,0xc6,0xa9,0xb4,0xc8,0xaa,0xb5,
+  0xc9,0xab,0xb6,0xca,0xa7,0xb5,0xc7,0xa7,0xb5,0xc8,0xa6,0xb4,0xca,0xa6,0xb4,0xcb,
+  0xa7,0xb4,0xce,0xa4,0xb2,0xcf,0xa1,0xae,0xce,0x9f,0xac,0xcc,0x9a,0xaa,0xcf,0x97,
+  0xa7,0xcc,0x90,0xa0,0xc5,0x8c,0x99,0xbf,0x8a,0x96,0xbe,0x8f,0x9b,0xc3,0x99,0xa5,
+  0xcd,0xa1,0xad,0xd7,0xa4,0xb2,0xcf,0xa7,0xb5,0xd2,0xab,0xb7,0xd3,0xac,0xb9,0xd3,
+  0xad,0xba,0xd0,0xad,0xbb,0xce,0xae,0xbf,0xd2,0xae,0xbf,0xd2,0xaa,0xbd,0xcc,0xab,
+  0xbe,0xcd,0xac,0xbe,0xcf,0xab,0xbc,0xcf,0xa9,0xba,0xcf,0xa8,0xb8,0xcf,0xa9,0xb9,
+  0xd0,0xaa,0xb9,0xd3,0x9c,0xb1,0xcc,0x9d,0xb2,0xce,0x9d,0xb2,0xce,0x9c,0xae,0xcd,
+  0x98,0xaa,0xc9,0x94,0xa5,0xc6,0x94,0xa3,0xc4,0x93,0xa1,0xc5,0x90,0xa1,0xbc,0x8e,
+  0x9e,0xbb,0x8c,0x9c,0xb9,0x8b,0x9a,0xba,0x8b,0x99,0xbd,0x8a,0x97,0xbd,0x88,0x95,
+  0xbb,0x86,0x92,0xba,0x7c,0x88,0xb0,0x79,0x87,0xb1,0x75,0x84,0xb2,0x6a,0x78,0xa8,
+  0x62,0x71,0x9f,0x75,0x81,0xa9,0x8e,0x9a,0xbc,0x98,0xa3,0xc1,0x9b,0xa6,0xba,0x9e,
+  0xa9,0xbd,0xa2,0xad,0xc1,0xa5,0xb0,0xc4,0xa6,0xb1,0xc5,0xa7,0xb2,0xc6,0xa8,0xb3,
+  0xc7,0xa9,0xb4,0xc8,0xa5,0xb3,0xc6,0xa4,0xb1,0xc7,0xa2,0xb0,0xc7,0xa2,0xae,0xca,
+  0xa1,0xac,0xca,0x9d,0xa9,0xcb,0x99,0xa5,0xc9,0x96,0xa2,0xc6,0x89,0x99,0xc7,0x8b,
+  0x9b,0xc9,0x8e,0x9e,0xc9,0x90,0x9f,0xc6,0x93,0xa0,0xc6,0x9a,0xa6,0xc8,0xa2,0xaf,
+  0xcf,0xaa,0xb5,0xd5,0xa9,0xb7,0xce,0xab,0xb9,0xd0,0xad,0xbb,0xd1,0xaf,0xbc,0xd2,
+  0xae,0xbc,0xcf,0xb0,0xbb,0xcf,0xae,0xbf,0xd2,0xad,0xbe,0xd1,0xab,0xbe,0xcd,0xac,
+  0xbf,0xce,0xad,0xbf,0xd0,0xac,0xbd,0xd0,0xaa,0xbb,0xd0,0xa9,0xba,0xcf,0xaa,0xba,
+  0xd1,0xac,0xbc,0xd3,0x9b,0xb0,0xcb,0x9c,0xb1,0xcc,0x9c,0xb1,0xcd,0x9c,0xae,0xcb,
+  0x98,0xaa,0xc9,0x95,0xa6,0xc7,0x95,0xa4,0xc5,0x94,0xa2,0xc6,0x92,0xa3,0xbe,0x8f,
+  0xa0,0xbb,0x8b,0x9b,0xb8,0x89,0x98,0xb8,0x89,0x97,0xbb,0x89,0x96,0xbc,0x89,0x95,
+  0xbd,0x88,0x94,0xbc,0x79,0x85,0xad,0x79,0x87,0xb1,0x77,0x86,0xb4,0x6a,0x78,0xa8,
+  0x5e,0x6d,0x9b,0x6f,0x7b,0xa3,0x8b,0x97,0xb9,0x97,0xa2,0xc0,0x99,0xa4,0xb8,0x9c,
+  0xa7,0xbb,0xa1,0xac,0xc0,0xa3,0xae,0xc2,0xa5,0xb0,0xc4,0xa6,0xb1,0xc5,0xa7,0xb2,
+  0xc6,0xa8,0xb3,0xc7,0xa5,0xb2,0xc8,0xa3,0xaf,0xc7,0x9f,0xac,0xc6,0x9d,0xa8,0xc6,
+  0x9b,0xa5,0xc7,0x95,0xa1,0xc5,0x8f,0x9a,0xc0,0x8b,0x95,0xbd,0x75,0x88,0xbb,0x7f,
+  0x93,0xc3,0x91,0xa1,0xcf,0x9b,0xab,0xd5,0xa3,0xb1,0xd5,0xa5,0xb3,0xd0,0xa9,0xb4,
+  0xcf,0xa9,0xb5,0xcd,0xae,0xbd,0xd0,0xae,0xbd,0xd0,0xb0,0xbe,0xd1,0xb0,0xbe,0xd1,
+  0xb3,0xbe,0xd2,0xb3,0xbe,0xd2,0xac,0xc0,0xd2,0xac,0xc0,0xd2,0xad,0xbf,0xd0,0xac,
+  0xbe,0xcf,0xac,0xbd,0xd0,0xab,0xbc,0xcf,0xab,0xbc,0xcf,0xaa,0xbb,0xd0,0xa9,0xba,
+  0xcf,0xa9,0xba,0xcf,0xa4,0xb5,0xd0,0xa3,0xb4,0xcf,0xa1,0xb1,0xce,0x9f,0xaf,0xcc,
+  0x9e,0xae,0xcb,0x9c,0xab,0xcb,0x99,0xa8,0xc8,0x97,0xa6,0xc6,0x93,0xa3,0xc0,0x94,
+  0xa3,0xc3,0x94,0xa3,0xc3,0x90,0x9f,0xc0,0x8b,0x99,0xbd,0x88,0x95,0xbb,0x89,0x95,
+  0xbd,0x8c,0x98,0xc0,0x72,0x85,0xb0,0x79,0x89,0xb7,0x76,0x86,0xb5,0x65,0x74,0xa5,
+  0x55,0x63,0x94,0x5a,0x68,0x98,0x76,0x83,0xb1,0x90,0x9d,0xc9,0x98,0xa2,0xc0,0x98,
+  0xa1,0xbc,0x9e,0xa7,0xbb,0xa6,0xaf,0xbd,0xa6,0xaf,0xbd,0xa1,0xaa,0xbe,0xa1,0xaa,
+  0xc5,0xa5,0xaf,0xcd,0xa4,0xae,0xbf,0x9f,0xac,0xc2,0x98,0xa5,0xc5,0x8e,0x9e,0xc8,
+  0x87,0x97,0xc6,0x84,0x94,0xc3,0x83,0x92,0xc0,0x84,0x91,0xbd,0x96,0x9f,0xc4,0x99,
+  0xa2,0xc7,0x9f,0xa8,0xca,0xa3,0xac,0xcd,0xa6,0xb1,0xcd,0xaa,0xb3,0xce,0xad,0xb7,
+  0xcf,0xaf,0xb9,0xd1,0xb2,0xc0,0xd2,0xb1,0xbf,0xd1,0xb1,0xbf,0xd1,0xb1,0xbf,0xd1,
+  0xb1,0xbf,0xd1,0xb1,0xbf,0xd1,0xad,0xc1,0xd3,0xad,0xc1,0xd3,0xad,0xbf,0xd0,0xad,
+  0xbf,0xd0,0xac,0xbd,0xd0,0xac,0xbd,0xd0,0xab,0xbc,0xcf,0xaa,0xbb,0xd0,0xa9,0xba,
+  0xcf,0xa9,0xba,0xcf,0xa4,0xb5,0xd0,0xa2,0xb3,0xce,0xa0,0xb1,0xcc,0x9f,0xaf,0xcc,
+  0x9f,0xaf,0xcc,0x9d,0xac,0xcc,0x9b,0xaa,0xca,0x99,0xa8,0xc8,0x93,0xa3,0xc0,0x94,
+  0xa3,0xc3,0x94,0xa3,0xc3,0x91,0xa0,0xc1,0x8d,0x9b,0xbf,0x88,0x95,0xbb,0x86,0x92,
+  0xba,0x85,0x91,0xb9,0x7c,0x8d,0xb8,0x76,0x86,0xb4,0x6e,0x7e,0xad,0x63,0x72,0xa3,
+  0x54,0x62,0x93,0x4f,0x5d,0x8d,0x66,0x73,0xa1,0x80,0x8d,0xb9,0x98,0xa2,0xc0,0x97,
+  0xa2,0xbd,0x9d,0xa6,0xba,0xa3,0xab,0xbc,0xa5,0xad,0xbe,0xa2,0xab,0xbf,0x9e,0xa9,
+  0xc4,0xa0,0xaa,0xc8,0xa4,0xb1,0xc7,0x9a,0xa6,0xc2,0x8b,0x9a,0xbb,0x81,0x91,0xbb,
+  0x83,0x93,0xbe,0x8a,0x9a,0xc5,0x96,0xa2,0xca,0x9c,0xa7,0xcd,0x9c,0xa6,0xc8,0x9f,
+  0xaa,0xca,0xa4,0xae,0xcc,0xa7,0xb2,0xce,0xa9,0xb4,0xcf,0xad,0xb7,0xcf,0xb0,0xbb,
+  0xd1,0xb2,0xbd,0xd3,0xb0,0xbe,0xd0,0xaf,0xbd,0xcf,0xaf,0xbd,0xcf,0xb0,0xbe,0xd0,
+  0xb0,0xbe,0xd0,0xb0,0xbe,0xd0,0xae,0xc2,0xd4,0xae,0xc2,0xd4,0xaf,0xc1,0xd2,0xae,
+  0xc0,0xd1,0xad,0xbe,0xd1,0xac,0xbd,0xd0,0xab,0xbc,0xcf,0xaa,0xbb,0xd0,0xa9,0xba,
+  0xcf,0xa8,0xb9,0xce,0xa3,0xb4,0xce,0xa1,0xb2,0xcd,0xa0,0xb1,0xcc,0x9f,0xb0,0xcb,
+  0x9f,0xaf,0xcc,0x9f,0xaf,0xcc,0x9d,0xac,0xcc,0x9c,0xab,0xcb,0x99,0xa9,0xc6,0x99,
+  0xa8,0xc8,0x98,0xa7,0xc7,0x97,0xa6,0xc7,0x94,0xa2,0xc6,0x8f,0x9c,0xc2,0x88,0x94,
+  0xbc,0x83,0x8f,0xb7,0x83,0x95,0xbe,0x76,0x87,0xb2,0x6f,0x7f,0xae,0x6e,0x7c,0xac,
+  0x63,0x71,0xa1,0x57,0x63,0x93,0x5e,0x6b,0x97,0x72,0x80,0xaa,0x8f,0x9a,0xb8,0x92,
+  0x9f,0xb9,0x98,0xa3,0xb9,0x9c,0xa5,0xb9,0x9f,0xa8,0xbc,0xa0,0xab,0xc1,0x9c,0xa9,
+  0xc3,0x99,0xa4,0xc2,0x91,0xa0,0xc0,0x8d,0x9c,0xbd,0x89,0x99,0xbe,0x8c,0x9a,0xc4,
+  0x94,0xa3,0xca,0x9c,0xaa,0xce,0xa1,0xac,0xcc,0xa1,0xac,0xc8,0xa1,0xad,0xc9,0xa4,
+  0xb0,0xcc,0xa8,0xb3,0xce,0xaa,0xb6,0xce,0xab,0xb8,0xce,0xaf,0xba,0xce,0xb1,0xbc,
+  0xd0,0xb3,0xbf,0xd1,0xad,0xbb,0xcd,0xad,0xbb,0xcd,0xae,0xbc,0xce,0xae,0xbc,0xce,
+  0xaf,0xbd,0xcf,0xb0,0xbe,0xd0,0xaf,0xc3,0xd5,0xb0,0xc4,0xd6,0xb0,0xc2,0xd3,0xaf,
+  0xc1,0xd2,0xae,0xbf,0xd2,0xad,0xbe,0xd1,0xab,0xbc,0xcf,0xaa,0xbb,0xd0,0xa9,0xba,
+  0xcf,0xa8,0xb9,0xce,0xa2,0xb3,0xcd,0xa1,0xb2,0xcc,0x9f,0xb0,0xcb,0x9f,0xb0,0xcb,
+  0xa0,0xb1,0xcc,0xa0,0xb0,0xcd,0x9f,0xaf,0xcc,0x9e,0xae,0xcb,0x9e,0xae,0xcb,0x9c,
+  0xab,0xcb,0x9a,0xa9,0xc9,0x99,0xa8,0xc9,0x99,0xa7,0xcb,0x95,0xa2,0xc8,0x8d,0x99,
+  0xc1,0x87,0x93,0xbb,0x81,0x93,0xbc,0x79,0x8a,0xb5,0x77,0x86,0xb4,0x7a,0x88,0xb8,
+  0x78,0x84,0xb4,0x6c,0x79,0xa7,0x69,0x74,0xa0,0x6e,0x7a,0xa4,0x7a,0x89,0xa9,0x86,
+  0x94,0xb1,0x90,0x9d,0xb7,0x94,0xa0,0xb8,0x96,0xa2,0xba,0x99,0xa6,0xc0,0x97,0xa5,
+  0xc2,0x91,0xa0,0xc0,0x82,0x93,0xba,0x87,0x98,0xbf,0x91,0xa0,0xc7,0x9d,0xa9,0xd1,
+  0xa5,0xb1,0xd5,0xa7,0xb2,0xd0,0xa4,0xae,0xc6,0x9f,0xaa,0xbe,0xa3,0xb1,0xc8,0xa5,
+  0xb3,0xc9,0xa8,0xb5,0xcb,0xaa,0xb8,0xcb,0xaa,0xb8,0xcb,0xad,0xb9,0xcb,0xaf,0xbb,
+  0xcd,0xb1,0xbe,0xce,0xac,0xba,0xcc,0xac,0xba,0xcc,0xad,0xbb,0xcd,0xae,0xbc,0xce,
+  0xaf,0xbd,0xcf,0xb0,0xbe,0xd0,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xb0,0xc2,0xd3,0xb0,
+  0xc2,0xd3,0xaf,0xc0,0xd3,0xad,0xbe,0xd1,0xac,0xbd,0xd0,0xaa,0xbb,0xd0,0xa9,0xba,
+  0xcf,0xa9,0xba,0xcf,0xa3,0xb4,0xce,0xa1,0xb2,0xcc,0x9f,0xb0,0xca,0x9f,0xb0,0xcb,
+  0x9f,0xb0,0xcb,0xa0,0xb1,0xcc,0x9f,0xaf,0xcc,0x9f,0xaf,0xcc,0x9e,0xae,0xcb,0x99,
+  0xa8,0xc8,0x95,0xa4,0xc4,0x95,0xa4,0xc5,0x96,0xa4,0xc8,0x95,0xa2,0xc8,0x90,0x9c,
+  0xc4,0x8b,0x97,0xbf,0x80,0x90,0xba,0x7e,0x8e,0xb8,0x7b,0x8a,0xb8,0x7a,0x87,0xb5,
+  0x7b,0x88,0xb6,0x7d,0x87,0xb6,0x76,0x82,0xac,0x6e,0x7a,0xa4,0x6b,0x7b,0x9f,0x7a,
+  0x89,0xaa,0x88,0x94,0xb6,0x8e,0x99,0xb9,0x8e,0x99,0xb9,0x8d,0x99,0xbb,0x8c,0x9b,
+  0xbc,0x8a,0x9a,0xbe,0x8a,0x9c,0xc5,0x8f,0x9f,0xc9,0x96,0xa5,0xcc,0x9d,0xa9,0xcd,
+  0xa1,0xac,0xcc,0xa5,0xae,0xc9,0xa8,0xb3,0xc7,0xad,0xb7,0xc8,0xa4,0xb3,0xc6,0xa6,
+  0xb5,0xc8,0xa8,0xb6,0xc9,0xa9,0xb7,0xc9,0xa9,0xb7,0xc9,0xab,0xb7,0xc9,0xad,0xba,
+  0xca,0xaf,0xbc,0xcc,0xab,0xb9,0xcb,0xac,0xba,0xcc,0xae,0xbc,0xce,0xaf,0xbd,0xcf,
+  0xb0,0xbe,0xd0,0xb0,0xbe,0xd0,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xb0,0xc2,0xd3,0xb0,
+  0xc2,0xd3,0xaf,0xc0,0xd3,0xae,0xbf,0xd2,0xac,0xbd,0xd0,0xab,0xbc,0xd1,0xaa,0xbb,
+  0xd0,0xaa,0xbb,0xd0,0xa4,0xb6,0xcd,0xa2,0xb4,0xcb,0x9f,0xb0,0xca,0x9e,0xaf,0xc9,
+  0x9e,0xaf,0xca,0x9e,0xaf,0xca,0x9e,0xaf,0xca,0x9d,0xad,0xca,0x9c,0xac,0xc9,0x98,
+  0xa7,0xc7,0x94,0xa3,0xc3,0x93,0xa2,0xc3,0x95,0xa3,0xc7,0x96,0xa3,0xc9,0x94,0xa0,
+  0xc8,0x91,0x9d,0xc5,0x87,0x98,0xbf,0x86,0x96,0xc0,0x7f,0x8c,0xb8,0x76,0x83,0xb1,
+  0x7a,0x84,0xb3,0x81,0x8c,0xb8,0x7e,0x8a,0xb4,0x76,0x80,0xa8,0x64,0x76,0x9f,0x6c,
+  0x7c,0xa6,0x7b,0x87,0xaf,0x83,0x8f,0xb7,0x83,0x8f,0xb7,0x81,0x8d,0xb5,0x80,0x90,
+  0xba,0x85,0x97,0xc0,0x8d,0xa0,0xc6,0x93,0xa5,0xca,0x9c,0xaa,0xce,0xa1,0xac,0xcc,
+  0xa3,0xab,0xc8,0xa5,0xaf,0xc7,0xaa,0xb5,0xc9,0xaf,0xbb,0xcd,0xa6,0xb6,0xc7,0xa7,
+  0xb7,0xc8,0xa9,0xb7,0xc9,0xa9,0xb7,0xc9,0xa8,0xb6,0xc8,0xab,0xb7,0xc9,0xad,0xb9,
+  0xcb,0xaf,0xbb,0xcd,0xab,0xb9,0xcb,0xac,0xba,0xcc,0xae,0xbc,0xce,0xaf,0xbd,0xcf,
+  0xb0,0xbe,0xd0,0xb0,0xbe,0xd0,0xb0,0xc4,0xd6,0xaf,0xc3,0xd5,0xb0,0xc2,0xd3,0xaf,
+  0xc1,0xd2,0xaf,0xc0,0xd3,0xae,0xbf,0xd2,0xad,0xbe,0xd1,0xac,0xbd,0xd2,0xab,0xbc,
+  0xd1,0xab,0xbc,0xd1,0xa6,0xb8,0xcf,0xa3,0xb5,0xcc,0x9f,0xb1,0xc8,0x9d,0xae,0xc8,
+  0x9d,0xae,0xc8,0x9d,0xae,0xc9,0x9c,0xad,0xc8,0x9b,0xac,0xc7,0x98,0xa8,0xc5,0x95,
+  0xa4,0xc4,0x93,0xa2,0xc2,0x93,0xa2,0xc3,0x94,0xa2,0xc6,0x95,0xa2,0xc8,0x94,0xa0,
+  0xc8,0x93,0x9f,0xc7,0x8e,0x9d,0xc4,0x89,0x97,0xc1,0x80,0x8d,0xb9,0x7b,0x85,0xb4,
+  0x7b,0x85,0xb4,0x7d,0x88,0xb4,0x7d,0x86,0xb1,0x78,0x82,0xaa,0x62,0x75,0xa2,0x60,
+  0x70,0x9f,0x68,0x74,0xa4,0x76,0x82,0xb2,0x7d,0x89,0xb9,0x7c,0x88,0xb8,0x7f,0x8f,
+  0xbe,0x88,0x9b,0xc8,0x8e,0xa1,0xc2,0x98,0xa7,0xc8,0xa3,0xae,0xcc,0xaa,0xb2,0xcf,
+  0xaa,0xb3,0xce,0xa9,0xb2,0xcd,0xa6,0xb2,0xca,0xa6,0xb4,0xcb,0xa5,0xb5,0xc6,0xa6,
+  0xb6,0xc7,0xa7,0xb5,0xc7,0xa7,0xb5,0xc7,0xa7,0xb5,0xc8,0xaa,0xb5,0xc9,0xac,0xb7,
+  0xcb,0xae,0xb9,0xcd,0xaa,0xb8,0xca,0xab,0xb9,0xcb,0xad,0xbb,0xcd,0xae,0xbc,0xce,
+  0xaf,0xbd,0xcf,0xae,0xbc,0xce,0xaf,0xc3,0xd5,0xaf,0xc3,0xd5,0xaf,0xc1,0xd2,0xaf,
+  0xc1,0xd2,0xaf,0xc0,0xd3,0xae,0xbf,0xd2,0xad,0xbe,0xd1,0xad,0xbe,0xd3,0xac,0xbd,
+  0xd2,0xac,0xbd,0xd2,0xa7,0xb9,0xd0,0xa4,0xb6,0xcd,0xa0,0xb2,0xc9,0x9d,0xae,0xc8,
+  0x9c,0xad,0xc7,0x9b,0xac,0xc6,0x9a,0xab,0xc6,0x99,0xaa,0xc5,0x91,0xa1,0xbe,0x90,
+  0x9f,0xbf,0x8f,0x9e,0xbe,0x8f,0x9e,0xbf,0x8f,0x9d,0xc1,0x90,0x9d,0xc3,0x8f,0x9b,
+  0xc3,0x8e,0x9a,0xc2,0x89,0x98,0xbf,0x81,0x90,0xb7,0x7c,0x89,0xb5,0x81,0x8b,0xba,
+  0x7f,0x89,0xb8,0x79,0x82,0xae,0x73,0x7d,0xa5,0x73,0x7d,0xa5,0x62,0x73,0xa4,0x57,
+  0x66,0x97,0x59,0x66,0x9a,0x6e,0x78,0xae,0x7b,0x85,0xbb,0x7c,0x89,0xbd,0x83,0x92,
+  0xc3,0x8f,0xa0,0xd1,0x9a,0xac,0xc9,0x9e,0xac,0xc9,0xa2,0xad,0xc9,0xa5,0xae,0xc9,
+  0xa9,0xb0,0xcb,0xa9,0xb2,0xcd,0xa6,0xb2,0xce,0xa4,0xb2,0xce,0xa3,0xb3,0xc4,0xa4,
+  0xb4,0xc5,0xa5,0xb3,0xc6,0xa5,0xb3,0xc6,0xa5,0xb3,0xc6,0xa8,0xb3,0xc7,0xaa,0xb5,
+  0xcb,0xac,0xb7,0xcd,0xaa,0xb8,0xca,0xab,0xb9,0xcb,0xac,0xba,0xcc,0xad,0xbb,0xcd,
+  0xae,0xbc,0xce,0xad,0xbb,0xcd,0xb3,0xc4,0xd7,0xb3,0xc4,0xd7,0xaf,0xc2,0xd1,0xae,
+  0xc1,0xd0,0xad,0xbf,0xd0,0xad,0xbf,0xd0,0xad,0xbe,0xd1,0xac,0xbd,0xd0,0xaa,0xbb,
+  0xce,0xa9,0xba,0xcf,0xaa,0xbc,0xd3,0xa4,0xb6,0xcd,0x9f,0xb0,0xca,0x9d,0xae,0xc9,
+  0x9b,0xab,0xc8,0x98,0xa8,0xc5,0x96,0xa5,0xc5,0x95,0xa4,0xc5,0x8e,0x9f,0xc6,0x8b,
+  0x9d,0xc2,0x8e,0xa0,0xc5,0x92,0xa4,0xc9,0x8e,0xa1,0xc4,0x83,0x96,0xb9,0x80,0x93,
+  0xb6,0x85,0x98,0xbb,0x81,0x91,0xbf,0x7e,0x8e,0xbc,0x7a,0x8a,0xb9,0x74,0x82,0xb3,
+  0x6f,0x7d,0xae,0x6d,0x78,0xac,0x6b,0x75,0xab,0x6b,0x75,0xab,0x58,0x69,0x9a,0x50,
+  0x5e,0x98,0x51,0x5b,0x9b,0x71,0x7c,0xb8,0x86,0x95,0xc6,0x85,0x95,0xbf,0x8f,0x9f,
+  0xc9,0x95,0xa4,0xd2,0x95,0xa6,0xc7,0x97,0xa9,0xc8,0x9a,0xac,0xcb,0x9f,0xb0,0xcb,
+  0xa2,0xb3,0xcd,0xa4,0xb4,0xcb,0xa4,0xb5,0xca,0xa3,0xb4,0xc9,0x9e,0xaf,0xc4,0x9f,
+  0xb0,0xc5,0xa3,0xb1,0xc7,0xa4,0xb3,0xc6,0xa4,0xb3,0xc6,0xa5,0xb3,0xc5,0xa7,0xb5,
+  0xc7,0xa8,0xb6,0xc8,0xab,0xb8,0xc8,0xab,0xb8,0xc8,0xab,0xb8,0xc8,0xab,0xb8,0xc8,
+  0xab,0xb8,0xc8,0xaa,0xb7,0xc7,0xb3,0xc4,0xd7,0xb3,0xc4,0xd7,0xb3,0xc6,0xd5,0xb1,
+  0xc3,0xd4,0xb0,0xc2,0xd3,0xb0,0xc2,0xd3,0xb0,0xc1,0xd4,0xae,0xbf,0xd2,0xac,0xbd,
+  0xd2,0xaa,0xbb,0xd0,0xa4,0xb7,0xcc,0xa1,0xb3,0xca,0x9e,0xb0,0xc7,0x9d,0xae,0xc8,
+  0x9c,0xad,0xc8,0x9a,0xaa,0xc7,0x98,0xa7,0xc7,0x97,0xa6,0xc6,0x94,0xa5,0xcc,0x86,
+  0x97,0xbe,0x7e,0x8f,0xb6,0x82,0x93,0xba,0x86,0x97,0xbe,0x84,0x95,0xbc,0x84,0x94,
+  0xbe,0x86,0x96,0xc0,0x79,0x89,0xb8,0x73,0x83,0xb2,0x6b,0x7b,0xaa,0x66,0x74,0xa5,
+  0x64,0x72,0xa3,0x65,0x70,0xa2,0x64,0x6f,0xa3,0x63,0x6e,0xa2,0x60,0x71,0xa2,0x59,
+  0x67,0xa1,0x56,0x61,0x9f,0x71,0x7d,0xb7,0x85,0x94,0xc5,0x87,0x97,0xc1,0x91,0xa1,
+  0xcb,0x93,0xa2,0xd0,0x94,0xa4,0xc8,0x97,0xa7,0xcb,0x9b,0xac,0xcd,0xa0,0xaf,0xcf,
+  0xa2,0xb2,0xcf,0xa2,0xb3,0xcd,0xa3,0xb2,0xcc,0xa2,0xb2,0xc9,0x9f,0xaf,0xc6,0xa0,
+  0xb1,0xc6,0xa2,0xb3,0xc8,0xa4,0xb2,0xc8,0xa3,0xb2,0xc5,0xa5,0xb3,0xc6,0xa6,0xb4,
+  0xc6,0xa8,0xb6,0xc8,0xaa,0xb6,0xc8,0xaa,0xb6,0xc8,0xa9,0xb5,0xc7,0xa8,0xb4,0xc6,
+  0xa8,0xb4,0xc6,0xa9,0xb5,0xc7,0xb2,0xc3,0xd6,0xb2,0xc3,0xd6,0xb4,0xc6,0xd7,0xb3,
+  0xc5,0xd6,0xb1,0xc2,0xd5,0xb1,0xc2,0xd5,0xb0,0xc1,0xd6,0xaf,0xc0,0xd5,0xac,0xbd,
+  0xd2,0xaa,0xba,0xd1,0xa4,0xb9,0xce,0xa2,0xb7,0xcd,0xa0,0xb5,0xcb,0x9d,0xb1,0xca,
+  0x99,0xac,0xc7,0x96,0xa8,0xc5,0x92,0xa4,0xc3,0x90,0xa2,0xc1,0x87,0x99,0xc2,0x7f,
+  0x91,0xba,0x7c,0x8e,0xb7,0x80,0x91,0xbc,0x81,0x91,0xbf,0x7c,0x8c,0xbb,0x77,0x86,
+  0xb7,0x77,0x86,0xb7,0x6e,0x7d,0xae,0x67,0x76,0xa7,0x61,0x70,0xa1,0x61,0x6f,0xa0,
+  0x65,0x73,0xa3,0x6c,0x78,0xa8,0x6d,0x79,0xa9,0x6d,0x7a,0xa8,0x6a,0x7b,0xac,0x63,
+  0x72,0xaa,0x5c,0x67,0xa5,0x6f,0x7b,0xb5,0x82,0x92,0xc1,0x88,0x98,0xc2,0x92,0xa2,
+  0xcc,0x8f,0x9e,0xcc,0x92,0xa4,0xc9,0x94,0xa6,0xcb,0x9a,0xaa,0xce,0x9e,0xaf,0xd0,
+  0xa1,0xb0,0xd1,0xa1,0xb0,0xd0,0xa0,0xb0,0xcd,0xa1,0xaf,0xcc,0x9d,0xaf,0xc6,0xa0,
+  0xb0,0xc7,0xa1,0xb1,0xc8,0xa1,0xb2,0xc7,0xa2,0xb0,0xc6,0xa2,0xb1,0xc4,0xa4,0xb2,
+  0xc5,0xa6,0xb4,0xc7,0xa6,0xb4,0xc7,0xa5,0xb3,0xc6,0xa4,0xb2,0xc5,0xa3,0xb1,0xc4,
+  0xa3,0xb1,0xc4,0xa4,0xb2,0xc5,0xb2,0xc3,0xd8,0xb2,0xc3,0xd8,0xb1,0xc2,0xd5,0xb0,
+  0xc1,0xd4,0xaf,0xc0,0xd5,0xaf,0xc0,0xd5,0xaf,0xbf,0xd6,0xae,0xbe,0xd5,0xac,0xbc,
+  0xd3,0xaa,0xba,0xd1,0xa3,0xb8,0xce,0xa4,0xb9,0xcf,0xa2,0xb6,0xcf,0x9d,0xb0,0xcb,
+  0x9a,0xac,0xc9,0x96,0xa8,0xc5,0x91,0xa3,0xc2,0x8d,0x9f,0xbe,0x76,0x8a,0xb3,0x7a,
+  0x8e,0xb7,0x80,0x93,0xbe,0x7e,0x90,0xbf,0x73,0x84,0xb5,0x66,0x77,0xaa,0x64,0x74,
+  0xa9,0x68,0x77,0xaf,0x6b,0x79,0xad,0x69,0x77,0xab,0x69,0x78,0xa9,0x6c,0x7a,0xaa,
+  0x71,0x7f,0xaf,0x77,0x84,0xb2,0x78,0x85,0xb1,0x78,0x85,0xb1,0x70,0x82,0xb1,0x6a,
+  0x79,0xb1,0x60,0x6b,0xa9,0x6f,0x7b,0xb5,0x80,0x90,0xbf,0x89,0x9a,0xc1,0x93,0xa4,
+  0xcb,0x8c,0x9c,0xc7,0x93,0xa4,0xcb,0x94,0xa5,0xcc,0x96,0xa7,0xce,0x9a,0xaa,0xcf,
+  0x9c,0xac,0xd0,0x9e,0xac,0xd0,0x9e,0xad,0xce,0x9e,0xad,0xce,0x9c,0xad,0xc7,0x9d,
+  0xae,0xc8,0xa0,0xaf,0xc9,0xa0,0xb0,0xc7,0x9e,0xae,0xc5,0xa0,0xae,0xc4,0xa1,0xaf,
+  0xc5,0xa2,0xb0,0xc6,0xa0,0xae,0xc4,0xa0,0xae,0xc4,0xa0,0xae,0xc4,0xa1,0xaf,0xc5,
+  0xa1,0xaf,0xc5,0xa1,0xaf,0xc5,0xb1,0xc2,0xd7,0xb1,0xc2,0xd7,0xad,0xc0,0xd5,0xac,
+  0xbf,0xd4,0xac,0xbe,0xd5,0xac,0xbe,0xd5,0xac,0xbe,0xd5,0xac,0xbd,0xd7,0xaa,0xbb,
+  0xd5,0xa8,0xb9,0xd3,0x9f,0xb3,0xcc,0xa0,0xb4,0xcd,0x9e,0xb1,0xcc,0x9a,0xac,0xc9,
+  0x99,0xab,0xca,0x98,0xa9,0xca,0x92,0xa2,0xc6,0x8b,0x9b,0xbf,0x74,0x86,0xaf,0x76,
+  0x88,0xb1,0x76,0x87,0xb2,0x71,0x81,0xb0,0x66,0x75,0xa6,0x60,0x6e,0xa2,0x64,0x72,
+  0xa7,0x6c,0x79,0xb1,0x70,0x7e,0xb2,0x74,0x83,0xb4,0x7a,0x89,0xba,0x7c,0x8a,0xba,
+  0x7a,0x89,0xb7,0x78,0x85,0xb1,0x75,0x82,0xae,0x74,0x82,0xac,0x74,0x86,0xb5,0x6f,
+  0x7f,0xb4,0x66,0x71,0xad,0x75,0x82,0xba,0x85,0x95,0xc3,0x8d,0x9e,0xc5,0x96,0xa7,
+  0xce,0x8f,0x9f,0xca,0x95,0xa7,0xd0,0x95,0xa8,0xce,0x95,0xa6,0xcd,0x95,0xa6,0xcd,
+  0x98,0xa7,0xce,0x99,0xa9,0xce,0x9c,0xa9,0xcf,0x9d,0xaa,0xd0,0x9b,0xac,0xc7,0x9c,
+  0xad,0xc8,0x9c,0xad,0xc8,0x9e,0xad,0xc7,0x9c,0xab,0xc5,0x9b,0xab,0xc2,0x9e,0xac,
+  0xc3,0x9f,0xad,0xc4,0x99,0xa9,0xc0,0x9b,0xab,0xc2,0x9d,0xad,0xc4,0x9e,0xae,0xc5,
+  0x9e,0xae,0xc5,0x9d,0xad,0xc4,0xb1,0xc1,0xd8,0xb1,0xc1,0xd8,0xae,0xc0,0xd7,0xad,
+  0xbf,0xd6,0xac,0xbe,0xd5,0xac,0xbd,0xd7,0xac,0xbd,0xd7,0xac,0xbd,0xd8,0xaa,0xbb,
+  0xd6,0xa8,0xb9,0xd4,0xa0,0xb5,0xd1,0x9f,0xb3,0xd2,0x98,0xac,0xcb,0x91,0xa4,0xc5,
+  0x90,0xa3,0xc6,0x8f,0xa1,0xc6,0x86,0x97,0xbe,0x7a,0x8b,0xb2,0x6d,0x7d,0xa7,0x6c,
+  0x7c,0xa6,0x6c,0x7c,0xa6,0x71,0x81,0xac,0x75,0x84,0xb2,0x75,0x83,0xb3,0x71,0x7f,
+  0xb0,0x6c,0x7a,0xab,0x73,0x83,0xb2,0x7b,0x8b,0xba,0x84,0x94,0xc3,0x87,0x96,0xc4,
+  0x82,0x91,0xbf,0x7e,0x8b,0xb9,0x7a,0x87,0xb3,0x79,0x86,0xb2,0x77,0x8a,0xb7,0x73,
+  0x83,0xb8,0x6e,0x79,0xb5,0x80,0x8d,0xc5,0x8f,0x9f,0xcd,0x91,0xa3,0xc8,0x99,0xab,
+  0xd0,0x96,0xa6,0xd0,0x98,0xab,0xd1,0x97,0xaa,0xd0,0x96,0xa9,0xcf,0x95,0xa6,0xcd,
+  0x95,0xa6,0xcd,0x98,0xa7,0xce,0x99,0xa8,0xcf,0x9a,0xa9,0xd0,0x97,0xa9,0xc6,0x98,
+  0xaa,0xc7,0x9b,0xab,0xc8,0x9b,0xac,0xc7,0x9b,0xa9,0xc5,0x9b,0xaa,0xc4,0x9c,0xab,
+  0xc5,0x9f,0xac,0xc6,0x96,0xa7,0xc2,0x97,0xa8,0xc3,0x99,0xaa,0xc5,0x9a,0xab,0xc6,
+  0x9a,0xab,0xc6,0x98,0xa9,0xc4,0xb0,0xc0,0xd7,0xb0,0xc0,0xd7,0xac,0xc0,0xd9,0xab,
+  0xbf,0xd8,0xa9,0xbd,0xd6,0xa8,0xbb,0xd6,0xa8,0xbb,0xd6,0xa6,0xb8,0xd5,0xa4,0xb6,
+  0xd3,0xa1,0xb3,0xd0,0x9e,0xb1,0xd4,0x9a,0xad,0xd0,0x90,0xa2,0xc7,0x87,0x99,0xbe,
+  0x87,0x98,0xbf,0x88,0x98,0xc2,0x7c,0x8c,0xb7,0x6c,0x7c,0xa7,0x70,0x7c,0xa4,0x74,
+  0x80,0xa8,0x7c,0x88,0xb0,0x87,0x93,0xbb,0x90,0x9c,0xc4,0x8f,0x9b,0xc3,0x85,0x91,
+  0xbb,0x7a,0x86,0xb0,0x7c,0x8d,0xb8,0x81,0x92,0xbd,0x86,0x97,0xc2,0x8a,0x99,0xc7,
+  0x88,0x97,0xc5,0x86,0x93,0xc1,0x84,0x90,0xc0,0x84,0x90,0xc0,0x78,0x8b,0xb8,0x74,
+  0x84,0xb9,0x74,0x80,0xba,0x8c,0x9a,0xcf,0x98,0xa9,0xd4,0x92,0xa4,0xc9,0x98,0xaa,
+  0xcf,0x9a,0xaa,0xd4,0x9a,0xad,0xd2,0x9a,0xad,0xd2,0x9a,0xad,0xd2,0x99,0xac,0xd1,
+  0x99,0xab,0xd0,0x97,0xa9,0xce,0x98,0xa7,0xce,0x97,0xa6,0xcd,0x97,0xa9,0xc8,0x98,
+  0xaa,0xc9,0x99,0xab,0xc8,0x9b,0xab,0xc8,0x9a,0xab,0xc6,0x9c,0xaa,0xc6,0x9d,0xab,
+  0xc7,0x9e,0xad,0xc7,0x99,0xa9,0xc6,0x98,0xa8,0xc5,0x98,0xa8,0xc5,0x97,0xa7,0xc4,
+  0x96,0xa6,0xc3,0x95,0xa5,0xc2,0xb0,0xc0,0xd7,0xb0,0xc0,0xd7,0xab,0xbf,0xd8,0xaa,
+  0xbe,0xd7,0xa7,0xbb,0xd4,0xa6,0xb9,0xd4,0xa4,0xb7,0xd2,0xa2,0xb4,0xd1,0x9f,0xb1,
+  0xce,0x9c,0xae,0xcb,0x91,0xa3,0xc8,0x8c,0x9e,0xc3,0x83,0x94,0xbb,0x7e,0x8e,0xb8,
+  0x83,0x93,0xbe,0x88,0x97,0xc5,0x7e,0x8d,0xbb,0x6e,0x7c,0xac,0x82,0x8c,0xb4,0x89,
+  0x94,0xba,0x90,0x9b,0xc1,0x94,0x9f,0xc5,0x95,0xa1,0xc5,0x95,0xa1,0xc5,0x95,0xa1,
+  0xc5,0x94,0xa0,0xc4,0x89,0x9c,0xc2,0x88,0x9a,0xc3,0x87,0x99,0xc2,0x88,0x98,0xc3,
+  0x87,0x96,0xc4,0x87,0x93,0xc3,0x85,0x91,0xc1,0x83,0x8e,0xc0,0x76,0x89,0xb6,0x72,
+  0x83,0xb6,0x75,0x81,0xbb,0x91,0x9f,0xd4,0x9b,0xac,0xd7,0x90,0xa2,0xc7,0x95,0xa7,
+  0xcc,0x9a,0xaa,0xd4,0x99,0xaf,0xd2,0x9c,0xb0,0xd3,0x9d,0xb1,0xd4,0x9d,0xb0,0xd5,
+  0x9d,0xaf,0xd4,0x99,0xab,0xd0,0x97,0xa7,0xcc,0x95,0xa5,0xca,0x98,0xaa,0xc9,0x99,
+  0xab,0xca,0x9a,0xac,0xcb,0x9c,0xac,0xc9,0x9b,0xab,0xc8,0x9b,0xac,0xc7,0x9e,0xac,
+  0xc8,0x9f,0xad,0xc9,0x99,0xab,0xc8,0x97,0xa9,0xc6,0x94,0xa6,0xc3,0x92,0xa4,0xc1,
+  0x91,0xa3,0xc0,0x91,0xa3,0xc0,0xad,0xbe,0xd9,0xae,0xbf,0xda,0xac,0xc3,0xd9,0xa8,
+  0xbf,0xd5,0xa3,0xb9,0xd2,0x9e,0xb3,0xcf,0x9a,0xae,0xcd,0x95,0xa8,0xc9,0x8e,0xa1,
+  0xc4,0x89,0x9b,0xc0,0x89,0x9c,0xc1,0x89,0x9c,0xc2,0x83,0x94,0xbf,0x85,0x95,0xc3,
+  0x8e,0x9e,0xcd,0x8b,0x9b,0xc9,0x7f,0x90,0xbb,0x7b,0x8c,0xb7,0x8d,0x9f,0xbe,0x8e,
+  0xa0,0xbf,0x8f,0xa1,0xc0,0x95,0xa4,0xc4,0x98,0xa7,0xc7,0x9a,0xa7,0xc7,0x97,0xa4,
+  0xc4,0x94,0xa1,0xc1,0x99,0xa5,0xc9,0x95,0xa1,0xc3,0x8f,0x9e,0xbf,0x8c,0x9a,0xbe,
+  0x8a,0x9a,0xbf,0x89,0x97,0xc1,0x84,0x93,0xc1,0x82,0x90,0xc1,0x75,0x80,0xbc,0x73,
+  0x80,0xb8,0x81,0x8f,0xc3,0x92,0xa2,0xd0,0x93,0xa4,0xcb,0x93,0xa5,0xca,0x9b,0xab,
+  0xd0,0x9d,0xad,0xd2,0xa3,0xb4,0xd5,0xa1,0xb2,0xd3,0x9f,0xaf,0xd3,0x9d,0xad,0xd1,
+  0x9d,0xad,0xd2,0x9d,0xad,0xd2,0x9e,0xae,0xd3,0x9f,0xaf,0xd4,0x99,0xa5,0xcd,0x9c,
+  0xa8,0xd0,0xa2,0xad,0xd3,0xa3,0xaf,0xd1,0xa4,0xaf,0xcf,0xa1,0xac,0xca,0x9f,0xab,
+  0xc7,0x9f,0xaa,0xc5,0x97,0xaa,0xbf,0x95,0xa7,0xbe,0x90,0xa3,0xbe,0x8d,0xa1,0xc0,
+  0x8d,0x9f,0xc4,0x8d,0x9f,0xc8,0xaa,0xba,0xd7,0xa9,0xb9,0xd6,0x9d,0xb2,0xcd,0x9a,
+  0xaf,0xca,0x96,0xab,0xc7,0x93,0xa8,0xc4,0x93,0xa7,0xc6,0x95,0xa8,0xc9,0x96,0xa9,
+  0xcc,0x97,0xaa,0xcd,0x91,0xa5,0xc8,0x90,0xa3,0xc8,0x88,0x9a,0xc3,0x88,0x99,0xc4,
+  0x90,0xa0,0xce,0x8d,0x9e,0xc9,0x84,0x96,0xbf,0x81,0x93,0xbc,0x90,0xa2,0xc1,0x91,
+  0xa3,0xc2,0x93,0xa5,0xc4,0x98,0xa7,0xc7,0x9b,0xaa,0xca,0x9c,0xab,0xcb,0x9c,0xa9,
+  0xc9,0x99,0xa6,0xc6,0x9a,0xa6,0xc8,0x97,0xa3,0xc5,0x92,0xa1,0xc2,0x90,0x9f,0xc0,
+  0x8d,0x9d,0xc2,0x8b,0x99,0xc3,0x84,0x93,0xc1,0x81,0x8f,0xc0,0x75,0x83,0xbe,0x78,
+  0x85,0xbd,0x85,0x94,0xc5,0x91,0xa1,0xcf,0x91,0xa2,0xc9,0x94,0xa6,0xcb,0x9d,0xad,
+  0xd2,0x9e,0xae,0xd3,0x9b,0xac,0xcd,0x9c,0xad,0xce,0x9e,0xaf,0xd0,0x9f,0xaf,0xd3,
+  0xa0,0xb0,0xd4,0xa0,0xb0,0xd5,0x9f,0xaf,0xd4,0x9e,0xae,0xd3,0x9d,0xae,0xcf,0x9c,
+  0xad,0xce,0x9c,0xab,0xcb,0x9a,0xaa,0xc7,0x9c,0xaa,0xc7,0x9c,0xaa,0xc6,0x9c,0xab,
+  0xc5,0x9e,0xab,0xc5,0x8f,0x9f,0xbc,0x90,0xa2,0xbf,0x94,0xa5,0xc6,0x93,0xa6,0xc9,
+  0x8e,0x9f,0xc6,0x84,0x96,0xbf,0xa3,0xb2,0xd2,0xa0,0xaf,0xcf,0x99,0xac,0xcd,0x99,
+  0xac,0xcd,0x98,0xab,0xcc,0x96,0xa9,0xca,0x96,0xa9,0xca,0x98,0xab,0xcc,0x9c,0xaf,
+  0xd0,0x9f,0xb2,0xd3,0x98,0xad,0xcd,0x97,0xab,0xce,0x8d,0xa0,0xc5,0x8a,0x9c,0xc5,
+  0x91,0xa3,0xcc,0x8f,0xa1,0xca,0x88,0x9b,0xc1,0x88,0x9b,0xc0,0x92,0xa6,0xc5,0x92,
+  0xa6,0xc5,0x96,0xa8,0xc7,0x99,0xab,0xca,0x9e,0xad,0xcd,0x9e,0xad,0xcd,0x9d,0xac,
+  0xcc,0x9d,0xaa,0xca,0x9c,0xa8,0xca,0x9a,0xa6,0xc8,0x97,0xa6,0xc7,0x96,0xa5,0xc6,
+  0x92,0xa2,0xc6,0x8d,0x9b,0xc5,0x84,0x93,0xc1,0x7f,0x8d,0xbd,0x73,0x81,0xbb,0x7b,
+  0x8a,0xc2,0x8a,0x9b,0xcc,0x94,0xa5,0xd0,0x91,0xa3,0xcc,0x96,0xa7,0xce,0x9c,0xad,
+  0xd4,0x99,0xaa,0xd1,0x9d,0xaf,0xce,0x9e,0xb0,0xcf,0x9f,0xb0,0xd1,0xa0,0xb1,0xd2,
+  0x9f,0xaf,0xd3,0x9d,0xad,0xd1,0x9c,0xac,0xd0,0x9a,0xaa,0xce,0x9c,0xb1,0xcd,0x99,
+  0xae,0xca,0x96,0xab,0xc7,0x97,0xa9,0xc6,0x99,0xab,0xc8,0x9c,0xac,0xc9,0x9b,0xac,
+  0xc7,0x9a,0xab,0xc6,0x8b,0x9a,0xc1,0x8c,0x9b,0xc2,0x8c,0x9b,0xc2,0x86,0x96,0xc0,
+  0x80,0x90,0xba,0x7b,0x8c,0xb7,0x9d,0xac,0xcc,0x99,0xa8,0xc8,0x9a,0xaa,0xce,0x9d,
+  0xad,0xd1,0xa1,0xb1,0xd5,0xa2,0xb3,0xd4,0xa0,0xb1,0xd2,0x9f,0xb0,0xd1,0x9f,0xb1,
+  0xd0,0xa0,0xb2,0xd1,0x99,0xaf,0xcb,0x99,0xae,0xcd,0x90,0xa4,0xc7,0x8d,0xa0,0xc5,
+  0x92,0xa5,0xcb,0x90,0xa3,0xc8,0x8b,0x9f,0xc2,0x8c,0xa0,0xc3,0x94,0xa7,0xc8,0x95,
+  0xa8,0xc9,0x96,0xa9,0xca,0x9a,0xab,0xcc,0x9b,0xac,0xcd,0x9d,0xac,0xcd,0x9d,0xac,
+  0xcd,0x9c,0xab,0xcc,0x9e,0xaa,0xcc,0x9e,0xab,0xcb,0x9b,0xaa,0xca,0x9a,0xa9,0xca,
+  0x96,0xa6,0xca,0x90,0x9f,0xc6,0x85,0x95,0xc0,0x7e,0x8c,0xbc,0x6d,0x7b,0xb5,0x7b,
+  0x8b,0xc0,0x8f,0xa0,0xd1,0x97,0xa8,0xd3,0x93,0xa5,0xce,0x98,0xab,0xd1,0x9b,0xac,
+  0xd3,0x93,0xa4,0xcb,0x9f,0xb3,0xd2,0x9e,0xb2,0xd1,0x9c,0xaf,0xd0,0x9b,0xae,0xcf,
+  0x9a,0xad,0xd0,0x9a,0xad,0xd0,0x9a,0xad,0xd0,0x9a,0xac,0xd1,0x98,0xaf,0xcf,0x97,
+  0xac,0xcc,0x95,0xa9,0xcc,0x95,0xa9,0xcc,0x98,0xab,0xce,0x95,0xa7,0xcc,0x91,0xa1,
+  0xc6,0x8b,0x9b,0xc0,0x80,0x8e,0xbe,0x81,0x8f,0xbf,0x80,0x8f,0xbd,0x7e,0x8d,0xbb,
+  0x7e,0x8e,0xb9,0x83,0x93,0xbe,0xa0,0xb0,0xcd,0x9c,0xac,0xc9,0x95,0xa5,0xc9,0x99,
+  0xa9,0xcd,0x9e,0xaf,0xd0,0xa0,0xb1,0xd2,0x9e,0xaf,0xd0,0x9d,0xaf,0xce,0x9d,0xaf,
+  0xce,0x9e,0xb0,0xcf,0x97,0xad,0xc9,0x99,0xae,0xcd,0x93,0xa8,0xc8,0x8f,0xa2,0xc7,
+  0x94,0xa7,0xcc,0x92,0xa5,0xca,0x8d,0xa1,0xc4,0x90,0xa5,0xc5,0x95,0xaa,0xca,0x96,
+  0xab,0xcb,0x98,0xab,0xcc,0x98,0xab,0xcc,0x9a,0xab,0xcc,0x9a,0xab,0xcc,0x9c,0xab,
+  0xcc,0x9d,0xac,0xcd,0xa0,0xad,0xcd,0x9f,0xac,0xcc,0x9d,0xac,0xcc,0x9d,0xac,0xcc,
+  0x99,0xa9,0xcd,0x92,0xa1,0xc8,0x87,0x97,0xc2,0x80,0x8f,0xbd,0x6c,0x7d,0xb5,0x78,
+  0x8b,0xbe,0x8c,0x9e,0xcd,0x91,0xa4,0xcf,0x8e,0xa2,0xcb,0x96,0xa8,0xd1,0x9a,0xac,
+  0xd5,0x91,0xa3,0xcc,0x97,0xaa,0xcb,0x98,0xab,0xcc,0x9a,0xad,0xd0,0x9b,0xae,0xd1,
+  0x9c,0xaf,0xd2,0x9b,0xad,0xd2,0x9a,0xac,0xd1,0x99,0xab,0xd0,0x91,0xa4,0xcf,0x8d,
+  0xa0,0xcb,0x8a,0x9d,0xca,0x8b,0x9b,0xc9,0x8a,0x9a,0xc8,0x88,0x96,0xc6,0x81,0x8f,
+  0xbf,0x7b,0x89,0xb9,0x76,0x84,0xb5,0x7e,0x8c,0xbd,0x88,0x96,0xc6,0x8f,0x9e,0xcc,
+  0x93,0xa3,0xcd,0x97,0xa8,0xcf,0xa7,0xb8,0xd3,0xa6,0xb7,0xd2,0xa2,0xb4,0xd1,0xa1,
+  0xb3,0xd0,0x9f,0xb1,0xce,0x9c,0xae,0xcb,0x99,0xab,0xc8,0x99,0xab,0xca,0x99,0xab,
+  0xca,0x9b,0xad,0xcc,0x97,0xad,0xc9,0x9a,0xaf,0xce,0x94,0xa8,0xcb,0x90,0xa3,0xc8,
+  0x94,0xa7,0xcd,0x92,0xa5,0xca,0x8f,0xa3,0xc6,0x93,0xa7,0xca,0x96,0xaa,0xcd,0x97,
+  0xab,0xce,0x97,0xab,0xce,0x98,0xab,0xce,0x97,0xaa,0xcd,0x99,0xa9,0xcd,0x9b,0xab,
+  0xcf,0x9c,0xac,0xd0,0xa1,0xae,0xce,0x9f,0xad,0xca,0x9d,0xad,0xca,0x9c,0xab,0xcb,
+  0x99,0xaa,0xcb,0x93,0xa3,0xc8,0x89,0x99,0xc4,0x83,0x92,0xc0,0x75,0x87,0xbc,0x79,
+  0x8c,0xbf,0x83,0x97,0xc6,0x8a,0x9d,0xc8,0x88,0x9c,0xc5,0x91,0xa3,0xcc,0x98,0xaa,
+  0xd3,0x94,0xa5,0xd0,0x93,0xa6,0xcb,0x96,0xa9,0xce,0x9a,0xad,0xd2,0x9b,0xae,0xd4,
+  0x99,0xac,0xd2,0x94,0xa6,0xcf,0x8d,0x9f,0xc8,0x88,0x9a,0xc3,0x7f,0x90,0xc1,0x7c,
+  0x8d,0xbe,0x7b,0x8a,0xbb,0x7b,0x8a,0xbb,0x80,0x8e,0xbf,0x84,0x92,0xc3,0x86,0x94,
+  0xc5,0x88,0x93,0xc5,0x84,0x94,0xc2,0x8a,0x9b,0xc6,0x94,0xa5,0xd0,0x9b,0xac,0xd3,
+  0x9e,0xb0,0xd5,0xa1,0xb1,0xd5,0xac,0xbe,0xd5,0xad,0xbf,0xd6,0xb0,0xc2,0xd9,0xad,
+  0xbf,0xd6,0xa9,0xba,0xd4,0xa5,0xb6,0xd0,0xa2,0xb3,0xce,0xa0,0xb0,0xcd,0x9e,0xad,
+  0xcd,0x9c,0xab,0xcb,0x98,0xad,0xcc,0x9a,0xaf,0xcf,0x93,0xa6,0xcb,0x8d,0xa0,0xc6,
+  0x8f,0xa1,0xca,0x8d,0xa0,0xc6,0x8c,0x9f,0xc4,0x93,0xa6,0xcb,0x92,0xa6,0xc9,0x93,
+  0xa7,0xca,0x94,0xa8,0xcb,0x94,0xa8,0xcb,0x94,0xa7,0xca,0x95,0xa8,0xcb,0x9a,0xaa,
+  0xce,0x9d,0xad,0xd1,0xa0,0xae,0xcb,0x9f,0xad,0xca,0x9b,0xab,0xc8,0x9a,0xaa,0xc7,
+  0x97,0xa8,0xc9,0x94,0xa4,0xc9,0x8c,0x9c,0xc6,0x87,0x96,0xc4,0x79,0x8e,0xc1,0x76,
+  0x8c,0xbc,0x80,0x94,0xc3,0x89,0x9f,0xc9,0x8a,0x9e,0xc7,0x8c,0xa0,0xc9,0x90,0xa3,
+  0xce,0x8f,0xa0,0xcb,0x91,0xa3,0xcc,0x92,0xa4,0xcd,0x93,0xa5,0xce,0x93,0xa4,0xcf,
+  0x8f,0xa0,0xcb,0x89,0x99,0xc7,0x83,0x93,0xc1,0x7f,0x8f,0xbd,0x7c,0x8b,0xbc,0x7c,
+  0x8c,0xbb,0x7e,0x8c,0xbc,0x82,0x91,0xbf,0x89,0x96,0xc2,0x91,0x9f,0xc9,0x97,0xa5,
+  0xcf,0x9d,0xa9,0xd1,0x97,0xad,0xd1,0x98,0xab,0xd0,0x98,0xac,0xcf,0x99,0xac,0xcd,
+  0x9b,0xae,0xcf,0xa0,0xb2,0xd1,0xad,0xc0,0xd5,0xae,0xc1,0xd6,0xab,0xbf,0xd0,0xab,
+  0xbf,0xd1,0xab,0xbe,0xd3,0xad,0xbf,0xd6,0xae,0xbf,0xda,0xac,0xbc,0xd9,0xa7,0xb6,
+  0xd6,0xa2,0xb1,0xd1,0x98,0xad,0xcd,0x99,0xad,0xd0,0x90,0xa3,0xc8,0x87,0x99,0xc2,
+  0x88,0x9a,0xc3,0x87,0x99,0xc2,0x88,0x9b,0xc1,0x91,0xa4,0xc9,0x8a,0xa0,0xc3,0x8e,
+  0xa2,0xc5,0x8f,0xa3,0xc6,0x90,0xa4,0xc7,0x91,0xa4,0xc7,0x93,0xa6,0xc9,0x99,0xa9,
+  0xcd,0x9c,0xac,0xd0,0xa0,0xae,0xcb,0x9e,0xac,0xc9,0x99,0xa9,0xc6,0x98,0xa8,0xc5,
+  0x96,0xa7,0xc8,0x94,0xa4,0xc9,0x8d,0x9d,0xc7,0x89,0x99,0xc4,0x79,0x8e,0xc1,0x74,
+  0x8a,0xba,0x81,0x96,0xc3,0x90,0xa6,0xd0,0x92,0xa6,0xcf,0x8c,0xa0,0xc9,0x89,0x9c,
+  0xc7,0x85,0x98,0xc5,0x89,0x9a,0xc5,0x88,0x99,0xc4,0x86,0x97,0xc2,0x84,0x94,0xc2,
+  0x84,0x94,0xc2,0x86,0x96,0xc5,0x88,0x98,0xc7,0x8a,0x9a,0xc9,0x8c,0x9c,0xc7,0x8f,
+  0x9f,0xca,0x93,0xa3,0xcd,0x98,0xa8,0xcd,0x9a,0xaa,0xce,0x9d,0xac,0xcd,0x9f,0xae,
+  0xce,0xa1,0xb1,0xce,0x97,0xae,0xce,0x96,0xae,0xcc,0x98,0xad,0xcc,0x9b,0xb0,0xcc,
+  0x9e,0xb3,0xcf,0xa3,0xb6,0xd1,0xb1,0xc2,0xd7,0xb2,0xc3,0xd8,0xad,0xc1,0xd3,0xad,
+  0xc1,0xd3,0xad,0xc1,0xd3,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xbf,0xd6,0xac,0xbe,
+  0xd5,0xab,0xbd,0xd4,0xa6,0xb8,0xd7,0xa1,0xb3,0xd2,0x9c,0xad,0xce,0x99,0xac,0xcd,
+  0x99,0xac,0xcf,0x94,0xa8,0xcb,0x8d,0xa1,0xc4,0x87,0x9a,0xbf,0x8e,0xa4,0xc7,0x90,
+  0xa6,0xca,0x8f,0xa2,0xc8,0x88,0x9a,0xc3,0x87,0x99,0xc2,0x8f,0xa0,0xc7,0x97,0xa9,
+  0xce,0x9a,0xad,0xd0,0x9d,0xaf,0xcc,0x9a,0xac,0xcb,0x98,0xaa,0xc9,0x98,0xa9,0xca,
+  0x99,0xa9,0xcd,0x96,0xa6,0xca,0x90,0xa0,0xc5,0x8b,0x9b,0xc0,0x79,0x8a,0xbb,0x7f,
+  0x90,0xc1,0x87,0x99,0xc8,0x8b,0x9d,0xcc,0x88,0x9a,0xc9,0x7e,0x91,0xbe,0x72,0x85,
+  0xb2,0x6a,0x7d,0xaa,0x77,0x84,0xb2,0x7d,0x8a,0xb6,0x87,0x94,0xc0,0x91,0x9f,0xc9,
+  0x98,0xa7,0xce,0x9b,0xaa,0xd1,0x9b,0xab,0xd0,0x9a,0xaa,0xcf,0x98,0xab,0xcc,0x98,
+  0xab,0xcc,0x99,0xac,0xcd,0x99,0xac,0xcd,0x9a,0xad,0xce,0x9c,0xb0,0xcf,0x9d,0xb1,
+  0xd0,0x9e,0xb2,0xd1,0x9f,0xb4,0xd0,0xa0,0xb5,0xd1,0xa3,0xb5,0xd2,0xa4,0xb7,0xd2,
+  0xa5,0xb8,0xd3,0xa8,0xb9,0xd3,0xb1,0xc2,0xd7,0xb2,0xc3,0xd8,0xae,0xc2,0xd4,0xae,
+  0xc2,0xd4,0xae,0xc2,0xd4,0xae,0xc1,0xd6,0xae,0xc1,0xd6,0xad,0xbf,0xd6,0xad,0xbf,
+  0xd6,0xac,0xbe,0xd5,0xa8,0xba,0xd7,0xa4,0xb6,0xd3,0xa0,0xb2,0xd1,0x9d,0xb1,0xd0,
+  0x9e,0xb1,0xd2,0x9b,0xb0,0xd0,0x95,0xaa,0xca,0x8f,0xa3,0xc6,0x8d,0xa3,0xc6,0x8f,
+  0xa5,0xc9,0x8f,0xa1,0xca,0x89,0x9b,0xc4,0x87,0x99,0xc2,0x8d,0x9d,0xc7,0x93,0xa5,
+  0xca,0x96,0xa9,0xcc,0x9f,0xb1,0xd0,0x9e,0xb0,0xcf,0x9e,0xaf,0xd0,0x9e,0xaf,0xd0,
+  0x9d,0xad,0xd1,0x96,0xa6,0xcb,0x8c,0x9c,0xc1,0x85,0x95,0xba,0x73,0x83,0xb1,0x79,
+  0x89,0xb7,0x83,0x93,0xc1,0x8d,0x9e,0xc9,0x92,0xa3,0xce,0x92,0xa4,0xcd,0x8f,0xa1,
+  0xca,0x8c,0x9e,0xc7,0x95,0xa3,0xcd,0x97,0xa5,0xcf,0x9b,0xaa,0xd1,0x9e,0xad,0xd4,
+  0xa0,0xb0,0xd5,0x9f,0xaf,0xd3,0x9e,0xae,0xd2,0x9c,0xac,0xd0,0x9a,0xad,0xce,0x9a,
+  0xad,0xce,0x9a,0xad,0xce,0x9b,0xae,0xcf,0x9b,0xaf,0xce,0x9d,0xb1,0xd0,0x9e,0xb2,
+  0xd1,0x9e,0xb2,0xd1,0xa0,0xb5,0xd1,0xa0,0xb5,0xd1,0xa1,0xb6,0xd2,0xa5,0xb8,0xd3,
+  0xa6,0xb9,0xd4,0xa9,0xba,0xd4,0xb2,0xc3,0xd8,0xb3,0xc4,0xd9,0xaf,0xc3,0xd5,0xaf,
+  0xc3,0xd5,0xb0,0xc4,0xd6,0xb0,0xc3,0xd8,0xb0,0xc3,0xd8,0xaf,0xc1,0xd8,0xae,0xc0,
+  0xd7,0xae,0xc0,0xd7,0xa9,0xbc,0xd7,0xa6,0xb9,0xd4,0xa3,0xb6,0xd1,0xa2,0xb7,0xd3,
+  0xa4,0xb9,0xd5,0xa2,0xb7,0xd6,0x9d,0xb2,0xd1,0x98,0xad,0xcc,0x86,0x9c,0xc0,0x88,
+  0x9d,0xc3,0x8a,0x9c,0xc5,0x87,0x98,0xc3,0x87,0x98,0xc3,0x8e,0x9e,0xc8,0x94,0xa5,
+  0xcc,0x98,0xaa,0xcf,0x9b,0xac,0xcd,0x9a,0xab,0xcc,0x99,0xa9,0xcd,0x99,0xa9,0xcd,
+  0x97,0xa7,0xcb,0x91,0xa1,0xc6,0x89,0x99,0xbe,0x83,0x93,0xb8,0x84,0x93,0xba,0x88,
+  0x97,0xbe,0x8f,0x9e,0xc5,0x96,0xa6,0xcb,0x9c,0xac,0xd1,0x9f,0xaf,0xd3,0xa1,0xb1,
+  0xd5,0xa2,0xb2,0xd6,0xa2,0xb2,0xd6,0xa2,0xb2,0xd6,0xa2,0xb2,0xd6,0xa3,0xb4,0xd5,
+  0xa3,0xb4,0xd5,0xa4,0xb6,0xd5,0xa4,0xb6,0xd5,0xa4,0xb6,0xd5,0x9e,0xb2,0xd1,0x9d,
+  0xb1,0xd0,0x9d,0xb1,0xd0,0x9d,0xb1,0xd0,0x9d,0xb1,0xd0,0x9e,0xb2,0xd1,0x9e,0xb2,
+  0xd1,0x9f,0xb3,0xd2,0xa0,0xb6,0xd2,0xa1,0xb6,0xd2,0xa2,0xb7,0xd3,0xa4,0xb9,0xd4,
+  0xa7,0xba,0xd5,0xa8,0xbc,0xd5,0xb3,0xc4,0xd9,0xb4,0xc5,0xda,0xb1,0xc5,0xd7,0xb1,
+  0xc5,0xd7,0xb1,0xc5,0xd7,0xb1,0xc4,0xd9,0xb1,0xc4,0xd9,0xb0,0xc2,0xd9,0xb0,0xc2,
+  0xd9,0xaf,0xc1,0xd8,0xa9,0xbe,0xd4,0xa6,0xba,0xd3,0xa5,0xb9,0xd2,0xa3,0xb9,0xd2,
+  0xa5,0xba,0xd5,0xa3,0xba,0xd4,0x9f,0xb5,0xd1,0x9c,0xb2,0xce,0x89,0x9f,0xc3,0x8a,
+  0x9f,0xc5,0x8a,0x9c,0xc5,0x87,0x98,0xc3,0x85,0x96,0xc1,0x89,0x99,0xc3,0x90,0xa1,
+  0xc8,0x94,0xa6,0xcb,0x96,0xa6,0xca,0x94,0xa4,0xc8,0x91,0xa1,0xc5,0x91,0xa1,0xc5,
+  0x92,0xa2,0xc6,0x93,0xa3,0xc7,0x92,0xa2,0xc7,0x91,0xa1,0xc6,0x9e,0xad,0xce,0x9f,
+  0xae,0xcf,0xa0,0xaf,0xd0,0xa1,0xb0,0xd0,0xa2,0xb1,0xd1,0xa3,0xb3,0xd0,0xa3,0xb3,
+  0xd0,0xa3,0xb3,0xd0,0xa0,0xb2,0xcf,0xa0,0xb2,0xcf,0xa1,0xb3,0xd0,0xa2,0xb4,0xd1,
+  0xa4,0xb6,0xd3,0xa5,0xb7,0xd4,0xa6,0xb9,0xd4,0xa7,0xba,0xd5,0xa1,0xb6,0xd2,0xa0,
+  0xb5,0xd1,0xa0,0xb5,0xd1,0x9f,0xb3,0xd2,0x9f,0xb3,0xd2,0x9f,0xb3,0xd2,0x9f,0xb3,
+  0xd2,0x9f,0xb2,0xd3,0xa0,0xb6,0xd2,0xa1,0xb7,0xd3,0xa3,0xb8,0xd4,0xa4,0xb9,0xd4,
+  0xa6,0xbb,0xd6,0xaa,0xbe,0xd7,0xb5,0xc6,0xdb,0xb6,0xc7,0xdc,0xb2,0xc6,0xd8,0xb2,
+  0xc6,0xd8,0xb2,0xc6,0xd8,0xb2,0xc5,0xda,0xb2,0xc5,0xda,0xb2,0xc4,0xdb,0xb1,0xc3,
+  0xda,0xb0,0xc2,0xd9,0xaa,0xbf,0xd5,0xa8,0xbd,0xd3,0xa7,0xbc,0xd2,0xa5,0xbb,0xd4,
+  0xa5,0xbb,0xd4,0xa3,0xba,0xd4,0xa0,0xb7,0xd1,0x9c,0xb3,0xcd,0x9a,0xb0,0xd3,0x96,
+  0xac,0xd0,0x92,0xa5,0xcb,0x8a,0x9c,0xc5,0x83,0x95,0xbe,0x81,0x92,0xb9,0x85,0x97,
+  0xbc,0x89,0x9c,0xbf,0x96,0xa6,0xca,0x95,0xa5,0xc9,0x95,0xa6,0xc7,0x97,0xa8,0xc9,
+  0x9b,0xac,0xcd,0x9f,0xb0,0xd1,0xa2,0xb3,0xd4,0xa3,0xb4,0xd5,0xa5,0xb5,0xd2,0xa6,
+  0xb6,0xd3,0xa7,0xb8,0xd3,0xa7,0xb8,0xd3,0xa8,0xb9,0xd3,0xa7,0xb8,0xd2,0xa7,0xb8,
+  0xd2,0xa7,0xb9,0xd0,0xa5,0xb9,0xd2,0xa6,0xba,0xd3,0xa7,0xbb,0xd4,0xa8,0xbc,0xd5,
+  0xa7,0xbb,0xd4,0xa6,0xb9,0xd4,0xa5,0xb8,0xd3,0xa4,0xb7,0xd2,0xa3,0xb8,0xd3,0xa3,
+  0xb8,0xd3,0xa2,0xb7,0xd2,0xa1,0xb6,0xd2,0xa0,0xb4,0xd3,0xa0,0xb4,0xd3,0xa0,0xb3,
+  0xd4,0xa0,0xb3,0xd4,0xa1,0xb7,0xd3,0xa1,0xb7,0xd3,0xa2,0xb8,0xd4,0xa5,0xba,0xd5,
+  0xa7,0xbc,0xd7,0xa8,0xbe,0xd7,0xb6,0xc7,0xdc,0xb7,0xc8,0xdd,0xb2,0xc6,0xd8,0xb2,
+  0xc6,0xd8,0xb3,0xc7,0xd9,0xb3,0xc6,0xdb,0xb3,0xc6,0xdb,0xb2,0xc4,0xdb,0xb1,0xc3,
+  0xda,0xb1,0xc3,0xda,0xac,0xc1,0xd7,0xab,0xc0,0xd6,0xa9,0xbd,0xd6,0xa7,0xbd,0xd6,
+  0xa6,0xbb,0xd6,0xa3,0xba,0xd4,0xa0,0xb7,0xd1,0x9d,0xb3,0xcf,0x9e,0xb6,0xd4,0x99,
+  0xb0,0xd0,0x96,0xaa,0xcd,0x90,0xa3,0xc8,0x89,0x9c,0xc1,0x86,0x99,0xbc,0x88,0x9b,
+  0xbc,0x8d,0xa1,0xc0,0x97,0xa8,0xc9,0x9a,0xac,0xcb,0x9e,0xb0,0xcf,0xa3,0xb5,0xd4,
+  0xa7,0xb9,0xd6,0xa8,0xba,0xd7,0xa7,0xb9,0xd6,0xa7,0xba,0xd5,0xa6,0xb7,0xd1,0xa7,
+  0xb8,0xd2,0xa9,0xba,0xd4,0xaa,0xbc,0xd3,0xab,0xbd,0xd4,0xab,0xbd,0xd4,0xab,0xbe,
+  0xd3,0xaa,0xbd,0xd2,0xa6,0xbb,0xd1,0xa7,0xbc,0xd2,0xa9,0xbe,0xd4,0xab,0xbf,0xd8,
+  0xab,0xbf,0xd8,0xaa,0xbe,0xd7,0xa8,0xbb,0xd6,0xa6,0xb9,0xd4,0xa4,0xba,0xd3,0xa4,
+  0xba,0xd3,0xa3,0xb8,0xd3,0xa2,0xb7,0xd2,0xa1,0xb6,0xd2,0xa1,0xb5,0xd4,0xa1,0xb4,
+  0xd5,0xa1,0xb4,0xd5,0x9e,0xb6,0xd2,0x9f,0xb7,0xd3,0xa2,0xb8,0xd4,0xa4,0xbb,0xd5,
+  0xa7,0xbc,0xd7,0xa9,0xbf,0xd8,0xb7,0xc8,0xdd,0xb8,0xc9,0xde,0xb2,0xc6,0xd8,0xb3,
+  0xc7,0xd9,0xb3,0xc7,0xd9,0xb3,0xc6,0xdb,0xb3,0xc6,0xdb,0xb2,0xc4,0xdb,0xb1,0xc3,
+  0xda,0xb1,0xc3,0xda,0xab,0xbf,0xd8,0xaa,0xbe,0xd7,0xa9,0xbc,0xd7,0xa6,0xbb,0xd6,
+  0xa5,0xba,0xd6,0xa2,0xb8,0xd4,0x9f,0xb5,0xd1,0x9c,0xb1,0xd0,0x97,0xb0,0xca,0x95,
+  0xad,0xc9,0x97,0xac,0xcb,0x97,0xac,0xcc,0x94,0xa9,0xc9,0x92,0xa6,0xc5,0x95,0xaa,
+  0xc6,0x9b,0xb0,0xcb,0x9b,0xad,0xca,0x9f,0xb1,0xce,0xa4,0xb6,0xd3,0xa7,0xba,0xd5,
+  0xa9,0xbd,0xd6,0xa9,0xbd,0xd6,0xa7,0xbc,0xd2,0xa6,0xbb,0xd1,0xa8,0xbc,0xd5,0xa9,
+  0xbd,0xd6,0xa9,0xbe,0xd4,0xaa,0xbf,0xd5,0xaa,0xbf,0xd4,0xaa,0xbf,0xd4,0xaa,0xbf,
+  0xd4,0xa9,0xbe,0xd3,0xa4,0xb9,0xce,0xa5,0xba,0xd0,0xa8,0xbd,0xd3,0xaa,0xbe,0xd7,
+  0xab,0xbf,0xd8,0xac,0xbf,0xda,0xab,0xbe,0xd9,0xaa,0xbc,0xd9,0xa5,0xbc,0xd2,0xa4,
+  0xbb,0xd1,0xa3,0xb9,0xd2,0xa2,0xb7,0xd2,0xa2,0xb7,0xd3,0xa2,0xb6,0xd5,0xa2,0xb5,
+  0xd6,0xa2,0xb5,0xd6,0x9e,0xb6,0xd2,0x9e,0xb6,0xd2,0xa0,0xb8,0xd4,0xa4,0xbb,0xd5,
+  0xa6,0xbd,0xd7,0xa8,0xbe,0xd7,0xb8,0xc9,0xde,0xb9,0xca,0xdf,0xb2,0xc6,0xd8,0xb3,
+  0xc7,0xd9,0xb3,0xc7,0xd9,0xb3,0xc6,0xdb,0xb3,0xc6,0xdb,0xb2,0xc4,0xdb,0xb1,0xc3,
+  0xda,0xb1,0xc3,0xda,0xa8,0xbb,0xd6,0xa8,0xbb,0xd6,0xa7,0xba,0xd5,0xa4,0xb9,0xd5,
+  0xa3,0xb8,0xd4,0xa0,0xb5,0xd4,0x9d,0xb2,0xd1,0x9b,0xb0,0xcf,0x96,0xb0,0xc8,0x96,
+  0xaf,0xc9,0x9b,0xb1,0xcd,0x9f,0xb4,0xd3,0x9d,0xb2,0xd1,0x99,0xae,0xca,0x9a,0xaf,
+  0xca,0x9f,0xb5,0xce,0xa3,0xb6,0xd1,0xa4,0xb7,0xd2,0xa6,0xba,0xd3,0xa7,0xbb,0xd4,
+  0xa7,0xbc,0xd2,0xa8,0xbd,0xd2,0xaa,0xbf,0xd4,0xab,0xc1,0xd3,0xa9,0xbd,0xd6,0xa9,
+  0xbd,0xd6,0xaa,0xbf,0xd5,0xaa,0xbf,0xd5,0xab,0xc0,0xd5,0xac,0xc1,0xd6,0xac,0xc1,
+  0xd6,0xad,0xc3,0xd5,0xab,0xc0,0xd5,0xab,0xc0,0xd6,0xab,0xc0,0xd6,0xab,0xbf,0xd8,
+  0xab,0xbe,0xd9,0xaa,0xbd,0xd8,0xaa,0xbc,0xd9,0xa9,0xbb,0xd8,0xa4,0xbc,0xd0,0xa4,
+  0xbb,0xd1,0xa3,0xb9,0xd2,0xa2,0xb7,0xd2,0xa2,0xb7,0xd3,0xa2,0xb6,0xd5,0xa2,0xb5,
+  0xd6,0xa3,0xb6,0xd7,0x9d,0xb5,0xd1,0x9e,0xb6,0xd2,0x9f,0xb7,0xd3,0xa3,0xba,0xd4,
+  0xa5,0xbc,0xd6,0xa7,0xbf,0xd7,0xb4,0xc5,0xda,0xb4,0xc5,0xda,0xb2,0xc5,0xda,0xb2,
+  0xc5,0xda,0xb3,0xc6,0xdb,0xb3,0xc6,0xdb,0xb2,0xc5,0xda,0xb1,0xc4,0xd9,0xaf,0xc2,
+  0xd7,0xae,0xc1,0xd6,0xa7,0xbc,0xd2,0xa6,0xbb,0xd1,0xa5,0xba,0xd0,0xa4,0xb9,0xcf,
+  0xa3,0xb8,0xce,0xa3,0xb8,0xce,0xa3,0xb8,0xce,0xa3,0xb8,0xce,0xa4,0xb9,0xcf,0xa5,
+  0xba,0xd0,0xa6,0xbb,0xd1,0xa6,0xbb,0xd1,0xa6,0xbb,0xd1,0xa5,0xba,0xd0,0xa4,0xb9,
+  0xcf,0xa3,0xb8,0xce,0xa0,0xb2,0xd1,0xa4,0xb6,0xd3,0xa7,0xb9,0xd6,0xa8,0xbb,0xd6,
+  0xa8,0xbc,0xd5,0xa7,0xbb,0xd4,0xa9,0xbe,0xd4,0xab,0xc0,0xd6,0xad,0xc0,0xd5,0xad,
+  0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xac,0xbf,0xd4,0xac,0xbf,
+  0xd4,0xac,0xbf,0xd4,0xad,0xbf,0xd6,0xad,0xbf,0xd6,0xad,0xbf,0xd6,0xad,0xbf,0xd6,
+  0xad,0xbf,0xd6,0xad,0xbf,0xd6,0xad,0xbf,0xd6,0xad,0xbf,0xd6,0xab,0xc0,0xd6,0xa9,
+  0xbe,0xd4,0xa7,0xbb,0xd4,0xa6,0xb9,0xd4,0xa5,0xb7,0xd4,0xa5,0xb7,0xd6,0xa4,0xb5,
+  0xd6,0xa2,0xb3,0xd4,0x9e,0xb3,0xd2,0xa0,0xb5,0xd4,0xa2,0xb8,0xd4,0xa6,0xbb,0xd6,
+  0xa8,0xbd,0xd8,0xac,0xc0,0xd9,0xb5,0xc6,0xdb,0xb5,0xc6,0xdb,0xb4,0xc7,0xdc,0xb3,
+  0xc6,0xdb,0xb3,0xc6,0xdb,0xb2,0xc5,0xda,0xb1,0xc4,0xd9,0xaf,0xc2,0xd7,0xae,0xc1,
+  0xd6,0xad,0xc0,0xd5,0xa9,0xbe,0xd4,0xa9,0xbe,0xd4,0xa8,0xbd,0xd3,0xa8,0xbd,0xd3,
+  0xa8,0xbd,0xd3,0xa8,0xbd,0xd3,0xa8,0xbd,0xd3,0xa9,0xbe,0xd4,0xa7,0xbc,0xd2,0xa7,
+  0xbc,0xd2,0xa8,0xbd,0xd3,0xa8,0xbd,0xd3,0xa8,0xbd,0xd3,0xa7,0xbc,0xd2,0xa6,0xbb,
+  0xd1,0xa5,0xba,0xd0,0xa2,0xb4,0xd1,0xa4,0xb6,0xd3,0xa7,0xba,0xd5,0xa8,0xbb,0xd6,
+  0xa8,0xbc,0xd5,0xa8,0xbc,0xd5,0xa9,0xbe,0xd4,0xaa,0xbf,0xd5,0xad,0xc0,0xd5,0xad,
+  0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,
+  0xd5,0xad,0xc0,0xd5,0xad,0xbf,0xd6,0xad,0xbf,0xd6,0xad,0xbf,0xd6,0xad,0xbf,0xd6,
+  0xad,0xbf,0xd6,0xad,0xbf,0xd6,0xad,0xbf,0xd6,0xad,0xbf,0xd6,0xab,0xc0,0xd6,0xaa,
+  0xbf,0xd5,0xa8,0xbc,0xd5,0xa7,0xba,0xd5,0xa6,0xb8,0xd5,0xa6,0xb8,0xd7,0xa4,0xb6,
+  0xd5,0xa3,0xb4,0xd5,0x9f,0xb4,0xd3,0xa0,0xb5,0xd4,0xa2,0xb8,0xd4,0xa6,0xbb,0xd6,
+  0xa9,0xbe,0xd9,0xac,0xc0,0xd9,0xb6,0xc7,0xdc,0xb6,0xc7,0xdc,0xb5,0xc8,0xdd,0xb4,
+  0xc7,0xdc,0xb3,0xc6,0xdb,0xb1,0xc4,0xd9,0xaf,0xc2,0xd7,0xae,0xc1,0xd6,0xae,0xc1,
+  0xd6,0xad,0xc0,0xd5,0xac,0xc1,0xd7,0xac,0xc1,0xd7,0xab,0xc0,0xd6,0xab,0xc0,0xd6,
+  0xac,0xc1,0xd7,0xac,0xc1,0xd7,0xad,0xc2,0xd8,0xad,0xc2,0xd8,0xa9,0xbe,0xd4,0xaa,
+  0xbf,0xd5,0xaa,0xbf,0xd5,0xaa,0xbf,0xd5,0xaa,0xbf,0xd5,0xa9,0xbe,0xd4,0xa8,0xbd,
+  0xd3,0xa8,0xbd,0xd3,0xa5,0xb8,0xd3,0xa5,0xb8,0xd3,0xa6,0xb9,0xd4,0xa7,0xbb,0xd4,
+  0xa9,0xbd,0xd6,0xaa,0xbe,0xd7,0xa9,0xbe,0xd4,0xa8,0xbd,0xd3,0xad,0xc0,0xd5,0xad,
+  0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,
+  0xd5,0xad,0xc0,0xd5,0xae,0xc0,0xd7,0xae,0xc0,0xd7,0xae,0xc0,0xd7,0xae,0xc0,0xd7,
+  0xae,0xc0,0xd7,0xae,0xc0,0xd7,0xae,0xc0,0xd7,0xae,0xc0,0xd7,0xac,0xc1,0xd7,0xab,
+  0xc0,0xd6,0xa9,0xbd,0xd6,0xa8,0xbc,0xd5,0xa8,0xbb,0xd6,0xa7,0xb9,0xd6,0xa5,0xb7,
+  0xd6,0xa3,0xb5,0xd4,0x9f,0xb4,0xd3,0xa1,0xb6,0xd5,0xa3,0xb9,0xd5,0xa7,0xbc,0xd7,
+  0xa9,0xbe,0xd9,0xad,0xc1,0xda,0xb5,0xc6,0xdb,0xb6,0xc7,0xdc,0xb5,0xc8,0xdd,0xb3,
+  0xc6,0xdb,0xb2,0xc5,0xda,0xb0,0xc3,0xd8,0xaf,0xc2,0xd7,0xaf,0xc2,0xd7,0xaf,0xc2,
+  0xd7,0xaf,0xc2,0xd7,0xad,0xc2,0xd7,0xad,0xc2,0xd7,0xad,0xc2,0xd7,0xac,0xc1,0xd6,
+  0xac,0xc1,0xd6,0xad,0xc2,0xd7,0xad,0xc2,0xd7,0xae,0xc3,0xd8,0xab,0xc0,0xd5,0xab,
+  0xc0,0xd5,0xab,0xc0,0xd5,0xab,0xc0,0xd5,0xab,0xc0,0xd5,0xab,0xc0,0xd5,0xaa,0xbf,
+  0xd4,0xaa,0xbf,0xd4,0xa8,0xbc,0xd5,0xa6,0xba,0xd3,0xa5,0xb9,0xd2,0xa7,0xbb,0xd4,
+  0xaa,0xbe,0xd7,0xab,0xbf,0xd8,0xa9,0xbe,0xd4,0xa7,0xbc,0xd2,0xad,0xc0,0xd5,0xad,
+  0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xae,0xc1,
+  0xd6,0xae,0xc1,0xd6,0xaf,0xc2,0xd7,0xaf,0xc2,0xd7,0xaf,0xc2,0xd7,0xaf,0xc2,0xd7,
+  0xaf,0xc2,0xd7,0xaf,0xc2,0xd7,0xaf,0xc2,0xd7,0xaf,0xc2,0xd7,0xad,0xc2,0xd7,0xab,
+  0xc0,0xd5,0xaa,0xbf,0xd5,0xa9,0xbd,0xd6,0xa9,0xbc,0xd7,0xa8,0xba,0xd7,0xa6,0xb8,
+  0xd7,0xa4,0xb6,0xd5,0xa0,0xb5,0xd4,0xa1,0xb6,0xd5,0xa4,0xba,0xd6,0xa7,0xbc,0xd7,
+  0xaa,0xbf,0xda,0xae,0xc2,0xdb,0xb4,0xc5,0xda,0xb5,0xc6,0xdb,0xb3,0xc6,0xdb,0xb2,
+  0xc5,0xda,0xb1,0xc4,0xd9,0xb0,0xc3,0xd8,0xb0,0xc3,0xd8,0xb1,0xc4,0xd9,0xb2,0xc5,
+  0xda,0xb2,0xc5,0xda,0xb0,0xc5,0xda,0xb0,0xc5,0xda,0xaf,0xc4,0xd9,0xae,0xc3,0xd8,
+  0xad,0xc2,0xd7,0xad,0xc2,0xd7,0xad,0xc2,0xd7,0xad,0xc2,0xd7,0xad,0xc2,0xd7,0xac,
+  0xc1,0xd6,0xac,0xc1,0xd6,0xac,0xc1,0xd6,0xab,0xc0,0xd5,0xab,0xc0,0xd5,0xab,0xc0,
+  0xd5,0xab,0xc0,0xd5,0xaa,0xbf,0xd5,0xa8,0xbd,0xd3,0xa6,0xbb,0xd1,0xa7,0xbc,0xd2,
+  0xa9,0xbe,0xd4,0xab,0xc0,0xd6,0xa9,0xbd,0xd6,0xa7,0xbb,0xd4,0xad,0xc0,0xd5,0xad,
+  0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xae,0xc1,0xd6,0xae,0xc1,0xd6,0xae,0xc1,
+  0xd6,0xae,0xc1,0xd6,0xb0,0xc3,0xd8,0xb0,0xc3,0xd8,0xb0,0xc3,0xd8,0xb0,0xc3,0xd8,
+  0xb0,0xc3,0xd8,0xb0,0xc3,0xd8,0xb0,0xc3,0xd8,0xb0,0xc3,0xd8,0xad,0xc2,0xd7,0xac,
+  0xc1,0xd6,0xab,0xc0,0xd6,0xaa,0xbe,0xd7,0xaa,0xbe,0xd7,0xa9,0xbc,0xd7,0xa6,0xb8,
+  0xd5,0xa4,0xb6,0xd3,0xa0,0xb5,0xd4,0xa1,0xb6,0xd5,0xa4,0xba,0xd6,0xa7,0xbc,0xd7,
+  0xaa,0xbf,0xda,0xae,0xc2,0xdb,0xb4,0xc5,0xda,0xb4,0xc5,0xda,0xb2,0xc5,0xda,0xb1,
+  0xc4,0xd9,0xb1,0xc4,0xd9,0xb1,0xc4,0xd9,0xb2,0xc5,0xda,0xb3,0xc6,0xdb,0xb3,0xc6,
+  0xdb,0xb4,0xc7,0xdc,0xb3,0xc9,0xdb,0xb3,0xc9,0xdb,0xb1,0xc7,0xd9,0xb0,0xc6,0xd8,
+  0xaf,0xc5,0xd7,0xaf,0xc5,0xd7,0xaf,0xc5,0xd7,0xaf,0xc5,0xd7,0xae,0xc4,0xd6,0xad,
+  0xc3,0xd5,0xac,0xc2,0xd4,0xac,0xc2,0xd4,0xac,0xc2,0xd4,0xac,0xc2,0xd4,0xac,0xc2,
+  0xd4,0xac,0xc2,0xd4,0xab,0xc0,0xd5,0xaa,0xbf,0xd4,0xa8,0xbd,0xd2,0xa8,0xbd,0xd3,
+  0xa9,0xbe,0xd4,0xa9,0xbe,0xd4,0xa9,0xbd,0xd6,0xa8,0xbc,0xd5,0xac,0xbf,0xd4,0xad,
+  0xc0,0xd5,0xad,0xc0,0xd5,0xad,0xc0,0xd5,0xae,0xc1,0xd6,0xae,0xc1,0xd6,0xaf,0xc2,
+  0xd7,0xaf,0xc2,0xd7,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,
+  0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xac,0xc2,0xd4,0xac,
+  0xc1,0xd6,0xab,0xc0,0xd5,0xab,0xc0,0xd6,0xab,0xbf,0xd8,0xa9,0xbc,0xd7,0xa6,0xb8,
+  0xd5,0xa4,0xb6,0xd3,0x9f,0xb4,0xd3,0xa1,0xb6,0xd5,0xa3,0xb9,0xd5,0xa7,0xbc,0xd7,
+  0xa9,0xbe,0xd9,0xad,0xc1,0xda,0xb5,0xc6,0xdb,0xb5,0xc6,0xdb,0xb2,0xc5,0xda,0xb3,
+  0xc6,0xdb,0xb3,0xc6,0xdb,0xb4,0xc7,0xdc,0xb4,0xc7,0xdc,0xb4,0xc7,0xdc,0xb3,0xc6,
+  0xdb,0xb3,0xc6,0xdb,0xb3,0xc9,0xdb,0xb3,0xc9,0xdb,0xb2,0xc8,0xda,0xb1,0xc7,0xd9,
+  0xb1,0xc7,0xd9,0xb1,0xc7,0xd9,0xb1,0xc7,0xd9,0xb1,0xc7,0xd9,0xaf,0xc5,0xd7,0xaf,
+  0xc5,0xd7,0xae,0xc4,0xd6,0xad,0xc3,0xd5,0xac,0xc2,0xd4,0xad,0xc3,0xd5,0xad,0xc3,
+  0xd5,0xae,0xc4,0xd6,0xab,0xc1,0xd3,0xab,0xc1,0xd3,0xab,0xc0,0xd5,0xa9,0xbe,0xd3,
+  0xa8,0xbd,0xd3,0xa7,0xbc,0xd2,0xa8,0xbc,0xd5,0xa9,0xbd,0xd6,0xac,0xbf,0xd4,0xad,
+  0xc0,0xd5,0xad,0xc0,0xd5,0xae,0xc1,0xd6,0xae,0xc1,0xd6,0xaf,0xc2,0xd7,0xaf,0xc2,
+  0xd7,0xaf,0xc2,0xd7,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,
+  0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xac,0xc2,0xd4,0xab,
+  0xc1,0xd3,0xab,0xc0,0xd5,0xab,0xc0,0xd6,0xab,0xbf,0xd8,0xa9,0xbc,0xd7,0xa6,0xb9,
+  0xd4,0xa3,0xb5,0xd2,0x9f,0xb4,0xd3,0xa0,0xb5,0xd4,0xa2,0xb8,0xd4,0xa6,0xbb,0xd6,
+  0xa9,0xbe,0xd9,0xac,0xc0,0xd9,0xb6,0xc7,0xdc,0xb6,0xc7,0xdc,0xb3,0xc6,0xdb,0xb4,
+  0xc7,0xdc,0xb5,0xc8,0xdd,0xb5,0xc8,0xdd,0xb5,0xc8,0xdd,0xb4,0xc7,0xdc,0xb3,0xc6,
+  0xdb,0xb2,0xc5,0xda,0xb1,0xc7,0xd9,0xb0,0xc6,0xd8,0xb0,0xc6,0xd8,0xb0,0xc6,0xd8,
+  0xb0,0xc6,0xd8,0xb1,0xc7,0xd9,0xb1,0xc7,0xd9,0xb2,0xc8,0xda,0xb0,0xc6,0xd8,0xb0,
+  0xc6,0xd8,0xaf,0xc5,0xd7,0xae,0xc4,0xd6,0xad,0xc3,0xd5,0xae,0xc4,0xd6,0xae,0xc4,
+  0xd6,0xaf,0xc5,0xd7,0xab,0xc2,0xd2,0xac,0xc2,0xd4,0xac,0xc2,0xd4,0xaa,0xbf,0xd4,
+  0xa7,0xbc,0xd2,0xa6,0xbb,0xd1,0xa8,0xbc,0xd5,0xaa,0xbe,0xd7,0xac,0xbf,0xd4,0xad,
+  0xc0,0xd5,0xad,0xc0,0xd5,0xae,0xc1,0xd6,0xae,0xc1,0xd6,0xaf,0xc2,0xd7,0xaf,0xc2,
+  0xd7,0xb0,0xc3,0xd8,0xaf,0xc3,0xd5,0xaf,0xc3,0xd5,0xaf,0xc3,0xd5,0xaf,0xc3,0xd5,
+  0xaf,0xc3,0xd5,0xaf,0xc3,0xd5,0xaf,0xc3,0xd5,0xaf,0xc3,0xd5,0xab,0xc1,0xd3,0xab,
+  0xc1,0xd3,0xaa,0xbf,0xd4,0xab,0xc0,0xd6,0xab,0xbf,0xd8,0xa9,0xbd,0xd6,0xa5,0xb8,
+  0xd3,0xa3,0xb6,0xd1,0x9e,0xb3,0xd2,0xa0,0xb5,0xd4,0xa2,0xb8,0xd4,0xa6,0xbb,0xd6,
+  0xa8,0xbd,0xd8,0xac,0xc0,0xd9,0xb4,0xc7,0xdc,0xb3,0xc6,0xdb,0xb6,0xca,0xdc,0xb6,
+  0xca,0xdc,0xb6,0xca,0xdc,0xb6,0xca,0xdc,0xb6,0xca,0xdc,0xb6,0xca,0xdc,0xb6,0xca,
+  0xdc,0xb6,0xca,0xdc,0xb2,0xc8,0xda,0xb3,0xc9,0xdb,0xb3,0xc9,0xdb,0xb3,0xc9,0xdb,
+  0xb1,0xc7,0xd9,0xb1,0xc7,0xd9,0xb1,0xc7,0xd9,0xb2,0xc8,0xda,0xb4,0xc8,0xd9,0xb5,
+  0xc9,0xda,0xb6,0xca,0xdb,0xb6,0xca,0xdb,0xb4,0xc8,0xd9,0xb2,0xc6,0xd7,0xb2,0xc6,
+  0xd7,0xb3,0xc7,0xd8,0xb2,0xc6,0xd8,0xb1,0xc5,0xd7,0xb0,0xc4,0xd6,0xaf,0xc3,0xd5,
+  0xaf,0xc3,0xd5,0xae,0xc2,0xd4,0xae,0xc2,0xd4,0xae,0xc2,0xd4,0xb0,0xc4,0xd6,0xb0,
+  0xc4,0xd6,0xb0,0xc4,0xd6,0xb0,0xc4,0xd6,0xb1,0xc5,0xd7,0xb1,0xc5,0xd7,0xb1,0xc5,
+  0xd7,0xb1,0xc5,0xd7,0xb1,0xc5,0xd7,0xb1,0xc5,0xd7,0xb1,0xc5,0xd7,0xb1,0xc5,0xd7,
+  0xb1,0xc5,0xd7,0xb1,0xc5,0xd7,0xb1,0xc5,0xd7,0xb1,0xc5,0xd7,0xaf,0xc3,0xd4,0xb0,
+  0xc4,0xd5,0xad,0xc3,0xd5,0xa9,0xbe,0xd3,0xa8,0xbd,0xd3,0xa7,0xbd,0xd6,0xa7,0xbd,
+  0xd6,0xa4,0xb9,0xd4,0xa2,0xb3,0xce,0xa3,0xb6,0xd1,0xa8,0xba,0xd7,0xa9,0xbe,0xda,
+  0xa6,0xbc,0xd8,0xa5,0xbb,0xd7
+  };
+
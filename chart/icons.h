@@ -0,0 +1,5 @@
+/*********** Generated on 2026/10/18 22:46:56 by reswrap version 6.0.0 *********/
+
+/* Created by reswrap from file marble.bmp */
+extern const unsigned char marble[];
+
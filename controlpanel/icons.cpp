@@ -0,0 +1,335 @@
+/*********** Generated on 2026/10/18 22:46:56 by reswrap version 6.0.0 *********/
+
+#include "icons.h"
+
+/* Created by reswrap from file controlpanel_gif.gif */
+const unsigned char controlpanel_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x30,0x00,0x30,0x00,0xe7,0x00,0x00,0xfe,0xfe,0xfe,
+  0xfa,0xfa,0xfa,0xf6,0xf6,0xf6,0xee,0xee,0xee,0xea,0xea,0xea,0xf2,0xf2,0xf2,0x76,
+  0x76,0x76,0x02,0x02,0x02,0x72,0x72,0x72,0xe6,0xe6,0xe6,0xe2,0xe2,0xe2,0xde,0xde,
+  0xde,0xda,0xda,0xda,0xd6,0xd6,0xd6,0x7a,0x7a,0x7a,0xd2,0xd2,0xd2,0xce,0xce,0xce,
+  0xca,0xca,0xca,0xc6,0xc6,0xc6,0xc2,0xc2,0xc2,0xbe,0xbe,0xbe,0xba,0xba,0xba,0x6e,
+  0x6e,0x6e,0x4a,0x46,0x4e,0x52,0x52,0x5a,0x4e,0x4a,0x52,0x5a,0x5a,0x5a,0x42,0x42,
+  0x46,0x5e,0x5a,0x66,0x62,0x5e,0x6a,0x66,0x66,0x6e,0x6a,0x66,0x72,0x6a,0x6a,0x72,
+  0x6a,0x6a,0x76,0x6e,0x6a,0x76,0x6e,0x6e,0x7a,0x76,0x72,0x7e,0x32,0x32,0x32,0x36,
+  0x36,0x3e,0x76,0x76,0x82,0x52,0x4e,0x56,0x2e,0x2e,0x32,0x3e,0x3e,0x42,0x8a,0x86,
+  0x92,0x8e,0x8a,0x9a,0x96,0x92,0xa2,0x8e,0x8e,0x96,0x8a,0x8a,0x96,0x86,0x82,0x92,
+  0x82,0x82,0x8e,0x86,0x86,0x92,0x06,0x06,0x06,0x0e,0x0e,0x12,0xaa,0xa6,0xb6,0xaa,
+  0xaa,0xb6,0xae,0xaa,0xba,0xa2,0xa2,0xae,0xa2,0x9e,0xae,0x6a,0x6a,0x6a,0x72,0x72,
+  0x7e,0x62,0x62,0x66,0x0a,0x0a,0x0a,0x3e,0x3a,0x42,0x56,0x56,0x5e,0x66,0x62,0x6e,
+  0xae,0xae,0xbe,0xb2,0xae,0xbe,0xb2,0xb2,0xbe,0xb6,0xb2,0xc2,0x0e,0x0e,0x0e,0x82,
+  0x7e,0x8a,0x3a,0x3a,0x3a,0xb6,0xb6,0xc6,0x16,0x16,0x16,0x1e,0x1e,0x22,0x0a,0x0a,
+  0x0e,0xba,0xb6,0xc6,0x1a,0x1a,0x1a,0x2a,0x2a,0x2e,0xb6,0xb6,0xb6,0x66,0x66,0x66,
+  0x12,0x12,0x12,0x22,0x22,0x22,0x46,0x46,0x4a,0x16,0x12,0x16,0x5e,0x5e,0x66,0xb2,
+  0xb2,0xb2,0x7a,0x76,0x82,0x9a,0x96,0xa2,0x9e,0x9a,0xa6,0x96,0x92,0x9e,0x92,0x92,
+  0x9e,0x9a,0x96,0xa6,0xae,0xae,0xae,0x62,0x62,0x62,0x4a,0x4a,0x52,0x7a,0x7a,0x82,
+  0x6e,0x6e,0x76,0x6e,0x6e,0x72,0x72,0x72,0x7a,0x7a,0x7a,0x86,0x26,0x26,0x2a,0x2e,
+  0x2a,0x32,0x9a,0x9a,0xa6,0xaa,0xb2,0xb6,0xb6,0xbe,0xc6,0xc6,0xce,0xd6,0xa6,0xaa,
+  0xae,0x9e,0xa2,0xaa,0x8e,0x8e,0x8e,0x76,0x72,0x7a,0xaa,0xaa,0xaa,0x1e,0x1e,0x1e,
+  0xb6,0xba,0xbe,0xbe,0xc6,0xca,0xb2,0xb6,0xbe,0xba,0xc2,0xc6,0xaa,0xae,0xb2,0x4a,
+  0x4a,0x4a,0xa6,0xa6,0xa6,0x5e,0x5e,0x5e,0xb2,0xb2,0xb6,0xae,0xb6,0xba,0xaa,0xae,
+  0xb6,0xb2,0xba,0xbe,0xa2,0xaa,0xae,0xa2,0xa6,0xaa,0xba,0xbe,0xc6,0x76,0x7a,0x7e,
+  0x7e,0x7e,0x7e,0x92,0x96,0x9a,0x6e,0x72,0x76,0x62,0x66,0x6a,0x96,0x9a,0xa2,0x26,
+  0x26,0x26,0xa2,0xa2,0xa2,0x96,0x9a,0x9e,0x86,0x8a,0x8e,0x2e,0x2e,0x2e,0xba,0xbe,
+  0xc2,0x52,0x52,0x52,0x9e,0x9e,0x9e,0x96,0x9e,0xa2,0x86,0x8a,0x8a,0x36,0x36,0x36,
+  0x6e,0x72,0x72,0x2a,0x2a,0x2a,0x9a,0x9a,0x9a,0x26,0x26,0x1e,0x96,0x96,0x96,0x8a,
+  0x8a,0x8e,0x56,0x56,0x56,0x46,0x46,0x46,0x3e,0x3e,0x3e,0xce,0xc6,0x9e,0xd2,0xd2,
+  0xce,0xba,0xb2,0x96,0x92,0x92,0x92,0x4e,0x4e,0x4e,0xb2,0xb6,0xba,0x86,0x86,0x86,
+  0xce,0xbe,0x96,0xea,0xe6,0xe2,0xce,0xce,0xca,0xca,0xca,0xc6,0xd2,0xce,0xca,0xaa,
+  0x9e,0x76,0x8a,0x8a,0x8a,0x42,0x3e,0x46,0xe2,0xe2,0xde,0xee,0xee,0xea,0xf6,0xf2,
+  0xf2,0x92,0x86,0x5e,0xce,0xbe,0x82,0xe2,0xce,0x8a,0xc2,0xb2,0x7a,0x8e,0x86,0x5a,
+  0x82,0x82,0x82,0x86,0x86,0x8a,0x76,0x6e,0x4a,0x8e,0x82,0x5a,0x86,0x7a,0x52,0x92,
+  0x86,0x5a,0x9a,0x8a,0x5e,0x7e,0x72,0x4a,0x72,0x6a,0x4a,0x7a,0x6e,0x4a,0x6e,0x66,
+  0x4e,0x9a,0x9e,0xa2,0xa2,0xa2,0xa6,0xe6,0xda,0xb6,0xe6,0xd2,0x92,0xa2,0x96,0x62,
+  0xee,0xe2,0xba,0xea,0xde,0xb6,0x56,0x52,0x5a,0xf2,0xee,0xee,0xea,0xde,0xb2,0xaa,
+  0x9a,0x6a,0x46,0x42,0x36,0xaa,0x9a,0x66,0x42,0x42,0x42,0x36,0x32,0x26,0xee,0xe6,
+  0xca,0xe6,0xd6,0x9a,0xba,0xaa,0x72,0x4e,0x46,0x2e,0xf6,0xee,0xda,0x6a,0x62,0x42,
+  0xf2,0xea,0xd6,0xf2,0xee,0xda,0xd2,0xca,0xa2,0xa6,0x96,0x66,0x52,0x4a,0x32,0x7e,
+  0x82,0x82,0x8e,0x8a,0x72,0x7e,0x76,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x30,0x00,0x30,0x00,0x00,0x08,0xfe,0x00,0x01,0x08,0x14,0x18,0xa0,0xa0,
+  0xc1,0x83,0x08,0x13,0x2a,0x5c,0x78,0x70,0xa0,0x43,0x01,0x02,0x06,0x10,0x98,0x48,
+  0xb1,0xa2,0xc5,0x8b,0x18,0x33,0x0e,0x28,0x20,0x20,0xc0,0xc0,0x00,0x02,0x0c,0x1c,
+  0x18,0x49,0xb2,0xa4,0xc9,0x93,0x28,0x53,0x96,0x44,0x20,0xe0,0xa3,0x80,0x03,0x03,
+  0x20,0xca,0x9c,0x49,0x53,0x40,0x81,0x9b,0x38,0x0b,0x0c,0xd8,0x49,0x20,0x41,0x02,
+  0x05,0x40,0x17,0x08,0x65,0xc0,0xa0,0x41,0x03,0x07,0x30,0x5b,0x02,0x88,0x78,0x40,
+  0x80,0xcf,0x8c,0x15,0x77,0x4a,0xec,0x99,0x80,0x2a,0x50,0x05,0x43,0x8b,0x3e,0x78,
+  0x00,0x01,0x42,0x84,0x08,0x08,0x0e,0x10,0x50,0x1a,0x80,0x40,0x53,0x8b,0x52,0xd3,
+  0xf2,0x9c,0x38,0xd5,0xea,0xcf,0xac,0x46,0xb7,0x76,0xfd,0x1a,0x36,0x01,0x59,0xb3,
+  0x02,0x7a,0x2a,0x20,0xca,0xb7,0x6f,0x5f,0xa3,0x71,0xe5,0x72,0xf5,0x2a,0x41,0xc2,
+  0x84,0x09,0x14,0x28,0x54,0x80,0x20,0x21,0x82,0x85,0x03,0x0a,0x0a,0x08,0xcc,0xdb,
+  0xb4,0x2a,0x03,0x95,0x98,0x33,0x8f,0x7c,0x60,0x38,0x6c,0xe4,0xc9,0x66,0xcb,0x12,
+  0x68,0x70,0xf2,0x02,0x86,0x0c,0x1a,0x36,0x70,0xd0,0xd0,0xc1,0x83,0x6b,0x0f,0x1f,
+  0x40,0x84,0x10,0x31,0x62,0x04,0x09,0x12,0x25,0x4c,0x94,0x6c,0x60,0xf8,0xf1,0xe7,
+  0xa5,0x78,0x7b,0x5e,0x36,0x79,0x02,0x45,0x8a,0x0e,0x2a,0x42,0xac,0x60,0xd1,0xa2,
+  0x85,0x0b,0x16,0x2f,0x56,0xc0,0x88,0x11,0x03,0x06,0x0c,0x19,0x19,0x50,0x1c,0x98,
+  0x31,0x92,0xf7,0x04,0xdf,0x92,0x81,0xfe,0x9f,0x4d,0x40,0x9a,0x38,0x06,0x1a,0x2a,
+  0x50,0xc4,0xa8,0x61,0xe3,0x86,0xfb,0x1b,0x35,0xdc,0xd7,0xa8,0x81,0x23,0x47,0x0e,
+  0x0f,0xda,0x49,0x3e,0x38,0xac,0x03,0x72,0x78,0xca,0x05,0x54,0x55,0x5e,0x49,0x3b,
+  0xf0,0xd0,0x83,0x0f,0x3f,0x00,0x11,0x84,0x10,0x42,0x0c,0xc1,0xe0,0x10,0x0e,0x12,
+  0xc1,0x20,0x83,0x2c,0x60,0x50,0x84,0x7e,0x8a,0x3d,0xb6,0xc0,0x7f,0x78,0x01,0xf5,
+  0xc0,0x49,0x24,0x18,0x41,0x83,0x0f,0x47,0x64,0xf0,0x82,0x7b,0x0b,0x3e,0xd8,0xe0,
+  0x10,0x44,0x20,0x81,0x04,0x11,0x1c,0x24,0x81,0x61,0x05,0xfd,0x6d,0x08,0xda,0x01,
+  0x01,0x26,0xf0,0x21,0x71,0x4a,0x2c,0xe1,0x43,0x0a,0x29,0xac,0x30,0x21,0x8b,0x4c,
+  0xb4,0x58,0xe4,0x8b,0x44,0x10,0x31,0x82,0x6e,0x23,0x41,0x50,0x01,0x8d,0xfe,0xdd,
+  0x58,0x00,0x50,0x10,0x9c,0xb4,0xc3,0x01,0x3d,0x1c,0xd1,0x84,0x13,0x40,0x30,0xc1,
+  0x04,0x12,0x45,0x16,0x49,0xc4,0x91,0x2e,0xba,0xf0,0x41,0x09,0x24,0x41,0xf0,0xc4,
+  0x13,0x50,0x1c,0x60,0xa3,0x78,0x05,0x2c,0xa0,0xc0,0x8e,0x25,0x9d,0x70,0xc0,0x12,
+  0x1b,0x44,0xa1,0x84,0x07,0x35,0x88,0xe9,0xe2,0x97,0x60,0x26,0xc9,0x44,0x0b,0x21,
+  0x48,0x41,0x52,0x04,0x6b,0xb6,0xf9,0x1b,0x65,0x04,0x08,0x15,0xc1,0x76,0x33,0x44,
+  0x3a,0xc3,0x09,0x33,0xd0,0x30,0x05,0x15,0x4b,0x54,0xf1,0x82,0x97,0x61,0x76,0x9a,
+  0xe4,0x98,0x2d,0x24,0x11,0xe9,0x01,0x11,0x58,0x61,0x45,0x9b,0x6f,0x52,0x36,0x00,
+  0x51,0x8f,0xf6,0xe0,0x6a,0x0f,0xfe,0x33,0x5c,0xb1,0x44,0x14,0x53,0x44,0xb1,0x44,
+  0x07,0xf3,0xe1,0x80,0x45,0x16,0x58,0x68,0xa1,0xc5,0x16,0xbe,0x72,0xc1,0xab,0x11,
+  0x29,0x8c,0x4a,0x81,0x15,0x5d,0x78,0x11,0xa5,0x78,0x04,0x10,0x25,0x01,0x96,0xae,
+  0x16,0xd1,0x03,0x0a,0x4b,0x50,0xf1,0x45,0x14,0x3d,0x6c,0x00,0x46,0x18,0x61,0xbc,
+  0x06,0x42,0x6c,0x62,0x8c,0x41,0x06,0x75,0x46,0x94,0xe1,0xea,0x01,0x14,0x74,0x91,
+  0xac,0x9b,0x1c,0x8a,0x65,0xd4,0xb3,0x45,0xc4,0x5b,0x44,0x14,0x51,0x14,0x91,0x04,
+  0x0a,0xf5,0x9a,0x71,0x06,0x09,0x68,0x3c,0x90,0x86,0x1a,0x6b,0x3c,0x80,0x83,0x1a,
+  0x6c,0xb4,0xa1,0x86,0x1b,0x25,0x34,0x11,0xef,0x01,0x13,0x74,0xf1,0x86,0xb2,0x8b,
+  0x9a,0x45,0xde,0x7e,0x07,0x44,0x41,0x05,0xbd,0x18,0xc3,0x71,0x02,0xbd,0x49,0xc4,
+  0x21,0x87,0x1a,0xff,0xce,0xa1,0x06,0x1d,0x6a,0xd4,0x31,0xb2,0x1a,0x6a,0xd8,0xa1,
+  0xf0,0x85,0x13,0xbc,0x71,0x07,0x1e,0xec,0xde,0x98,0x00,0x04,0x14,0x27,0x61,0x33,
+  0xc7,0x49,0x38,0x71,0x45,0x12,0x52,0x34,0x91,0x87,0x1a,0x7a,0xec,0xc1,0x07,0x1d,
+  0x7c,0xf4,0x21,0x43,0x1d,0x7c,0xa8,0xe1,0xc7,0x1f,0x6a,0xc0,0x61,0x2f,0xba,0x2e,
+  0x43,0xdc,0xae,0x8e,0x10,0x50,0x70,0x40,0x13,0x49,0x34,0xa1,0xb5,0xcd,0x5b,0x4b,
+  0x01,0xc7,0xbf,0x7f,0xac,0xe1,0x47,0x0c,0x75,0x00,0x12,0x48,0x19,0x82,0x38,0x31,
+  0x08,0x21,0x85,0x18,0x32,0xef,0x01,0x15,0xdc,0x71,0x08,0xcc,0xa9,0x4a,0x1c,0x81,
+  0x93,0x57,0xc3,0xa1,0x75,0xfe,0x13,0x70,0xe8,0xdd,0x77,0xdf,0x67,0xfc,0x81,0x88,
+  0x1f,0x89,0x00,0x82,0x08,0x21,0x83,0xc8,0x48,0xef,0x01,0x16,0x28,0x92,0x35,0xdc,
+  0x87,0xcc,0xbd,0x2c,0x65,0x0a,0x34,0xf6,0xc4,0x01,0x70,0x48,0xe1,0x75,0xdf,0x9b,
+  0xff,0x0d,0xc7,0x22,0x89,0x64,0x10,0x08,0x23,0xae,0x2a,0x22,0xc5,0x0c,0x3c,0xa3,
+  0x5e,0x82,0x21,0x4d,0x1c,0xf0,0xc4,0x21,0x8d,0x68,0x10,0xb3,0x78,0x0c,0x14,0x56,
+  0xc1,0x01,0x9a,0xe7,0xae,0xbb,0xee,0x8e,0x3c,0x52,0x02,0x24,0x91,0xcc,0x2b,0x45,
+  0x09,0x33,0xf0,0xad,0xba,0x24,0xad,0x77,0x31,0x49,0x23,0x30,0x47,0x7c,0x40,0xed,
+  0x13,0x58,0x81,0xbb,0x14,0x86,0x18,0x42,0x09,0xf5,0x94,0x58,0x6f,0x88,0xe6,0x84,
+  0x53,0x1f,0x45,0x12,0x3d,0x44,0xa1,0x70,0x12,0xf5,0x8a,0xaf,0xf5,0x01,0x6f,0x54,
+  0x32,0x89,0xec,0x75,0x1f,0xd0,0x00,0x05,0xd1,0x1f,0x20,0xc9,0xfc,0x65,0x94,0x21,
+  0x89,0x21,0xf5,0x97,0x61,0xc8,0xfc,0x96,0x28,0xac,0xd9,0x0c,0x70,0x38,0xc0,0x1d,
+  0x2a,0x51,0x89,0x4b,0x4c,0xee,0x32,0x98,0x90,0x02,0xf8,0x48,0x62,0x2f,0x29,0xcc,
+  0x4f,0x11,0x92,0x80,0xe0,0xfc,0x32,0x91,0x04,0x4d,0x24,0x60,0x13,0x3e,0xf1,0x49,
+  0x03,0x32,0x98,0x00,0x4e,0x14,0xa1,0x75,0x93,0xe8,0x44,0x01,0x67,0x17,0x01,0x4f,
+  0x40,0xc2,0x02,0x16,0x40,0x40,0x25,0x3a,0x81,0x18,0x06,0x7c,0x02,0x14,0x49,0x50,
+  0x84,0x0c,0x67,0x28,0xc3,0x28,0x84,0x42,0x14,0xa3,0x20,0x45,0x29,0x46,0xc1,0xc3,
+  0x51,0x94,0xa2,0x27,0xfe,0xa6,0xf8,0xe0,0x01,0x26,0x71,0x8a,0x4e,0x18,0xf0,0x37,
+  0x8c,0xb0,0x80,0x03,0xec,0x00,0x89,0xea,0x55,0x8f,0x12,0xa8,0xc0,0x03,0x20,0x40,
+  0xa1,0x12,0x4d,0x88,0x22,0x15,0xaa,0x58,0x85,0x16,0x57,0x01,0x91,0x00,0x24,0x80,
+  0x15,0x24,0xa9,0x44,0x1b,0x8c,0x38,0x3b,0x45,0x30,0x00,0x02,0x5e,0x90,0xe1,0xfc,
+  0x24,0x51,0x82,0xdf,0xb9,0x01,0x01,0x99,0xd8,0x44,0x57,0xe6,0x22,0x81,0x4b,0xb4,
+  0xc2,0x15,0x78,0xcc,0xa3,0x1e,0x5f,0x01,0x8b,0x4c,0xe8,0x20,0x16,0x62,0x24,0xe3,
+  0x6f,0xa2,0x70,0x08,0x06,0xc8,0x29,0x4e,0x87,0x90,0xdb,0x29,0x2e,0xe1,0x09,0x3b,
+  0x1c,0xa0,0x12,0xea,0x7a,0x83,0xc3,0xee,0x20,0x8b,0x59,0xd0,0xa2,0x16,0x98,0xb4,
+  0xc5,0x2d,0x6a,0x81,0x8b,0x5c,0xe8,0x42,0x17,0xbb,0xb8,0x84,0x17,0x10,0x10,0x8b,
+  0x31,0x1a,0xf0,0x4d,0x4d,0x78,0x43,0x06,0x79,0x61,0x00,0x0b,0x44,0xa0,0x0d,0x97,
+  0xb8,0x84,0x06,0x0c,0x60,0x88,0x03,0x34,0xe2,0x0d,0x2e,0xbb,0x43,0x2f,0x1a,0x11,
+  0x88,0x4c,0x40,0x42,0x11,0x94,0xf0,0xc5,0x2f,0x80,0xe1,0xc0,0x08,0x6a,0x40,0x07,
+  0x0e,0x08,0x44,0x11,0x47,0xf8,0x9b,0x24,0x3c,0x01,0x22,0x04,0xb0,0x02,0x02,0x94,
+  0x38,0x3f,0x65,0xc6,0xa2,0x07,0x92,0x18,0xe2,0x1d,0xb6,0x09,0x3b,0x22,0x06,0x02,
+  0x01,0x25,0x08,0x86,0x30,0x6c,0x01,0x07,0x3b,0x0c,0x03,0x0f,0x0e,0x40,0xc0,0x37,
+  0xc7,0xc8,0xcc,0xf0,0xa4,0xd2,0x26,0xc4,0x60,0xc0,0x03,0x1a,0xd0,0xc8,0x4d,0x48,
+  0xe2,0x14,0x8c,0xfe,0x10,0x60,0x2d,0x75,0x19,0xb9,0x43,0x4c,0x42,0x8c,0x08,0x38,
+  0x42,0x31,0x82,0x61,0x0c,0x4a,0x78,0xe2,0x98,0x06,0xd0,0x81,0x05,0xd8,0x59,0x09,
+  0x98,0x25,0xc0,0x9d,0x6f,0xb0,0xc9,0x46,0x40,0x02,0x05,0x4f,0xc4,0x22,0x02,0x52,
+  0xc0,0x04,0xa9,0x6a,0x89,0x87,0x8e,0x6a,0xe0,0xa3,0x1a,0xb8,0x44,0x26,0x8e,0x21,
+  0x8c,0x60,0x20,0x83,0x12,0x8a,0x80,0x44,0x32,0xec,0xc0,0x88,0x58,0xba,0x54,0x46,
+  0x63,0x11,0x48,0x12,0x0e,0x51,0x00,0x55,0x6c,0x04,0x00,0x05,0x80,0x02,0x1e,0x3a,
+  0xd1,0x86,0x06,0x50,0x4f,0x12,0x3d,0x90,0x82,0x03,0x1c,0x60,0x80,0xa2,0x1a,0x60,
+  0x9a,0xc9,0xd8,0x85,0x30,0x8a,0x01,0x0c,0x65,0x48,0x22,0x19,0x9e,0xc0,0x83,0x17,
+  0xa0,0xa0,0x83,0x23,0x90,0xc4,0x0b,0x05,0xf0,0x08,0x00,0x08,0x19,0x20,0x02,0x48,
+  0x26,0xa7,0x5e,0x78,0x42,0x20,0x52,0x38,0x92,0x12,0x24,0x03,0x13,0x68,0xc5,0xc4,
+  0x31,0x36,0x90,0x8c,0x64,0x24,0xc1,0x18,0xcb,0x60,0x46,0x33,0x9c,0x91,0x04,0x4a,
+  0xb0,0x11,0x12,0x78,0x0d,0xe0,0x03,0x14,0x10,0x93,0x81,0xf4,0xa0,0x11,0x36,0xf1,
+  0x6a,0x00,0x0a,0xa0,0x03,0x2f,0x4c,0xe0,0x14,0x16,0x90,0x9d,0x66,0x5a,0xf1,0x8c,
+  0x5f,0xb8,0x02,0x1a,0x29,0xf1,0x42,0x02,0x62,0x52,0x10,0x81,0x14,0xa1,0x11,0x05,
+  0xe8,0x49,0x41,0x04,0xa0,0xd3,0x08,0x1c,0x02,0x0a,0xf9,0x04,0x8c,0x68,0x01,0xf3,
+  0x00,0x1f,0xfc,0x22,0x1a,0x78,0xa4,0x05,0x1c,0x1c,0x50,0x09,0x2b,0x44,0xa0,0x01,
+  0x72,0xda,0xe5,0x88,0x52,0x06,0x72,0xd9,0x9a,0x2e,0x40,0x26,0x50,0xf0,0x42,0x05,
+  0x1a,0x01,0x05,0xab,0x42,0xc5,0x27,0xc9,0xf8,0x85,0x34,0x1c,0x5b,0x0b,0x43,0x9c,
+  0xe2,0x0e,0x12,0x58,0x00,0x01,0x64,0xab,0x55,0x87,0xd0,0xa0,0x0d,0x0c,0xc8,0x6c,
+  0x47,0x02,0x90,0xdb,0x4e,0xc4,0xe2,0x08,0x01,0x04,0x49,0x4d,0x40,0x52,0x00,0x4c,
+  0xbc,0xa2,0x14,0xd3,0xa0,0x46,0x35,0x0c,0xd1,0x09,0x2b,0x40,0xe0,0xa1,0x95,0x75,
+  0x08,0x6d,0xad,0x71,0x08,0x09,0x78,0x35,0x22,0x3a,0xc0,0x03,0x02,0x18,0x21,0x3e,
+  0x43,0x34,0xd7,0x21,0x1e,0x09,0xc0,0x22,0x20,0x61,0x8a,0x6b,0x60,0x03,0x0e,0x3a,
+  0x38,0x04,0x05,0x36,0x74,0x5f,0xf5,0x02,0x00,0x0f,0x76,0xb8,0x43,0x17,0x5a,0xe9,
+  0x05,0x3c,0x5c,0xc2,0x0e,0xd4,0x83,0x04,0x1c,0xda,0x60,0x60,0xfc,0x0a,0x60,0x02,
+  0x8a,0xd0,0x85,0x22,0x34,0x30,0x89,0x2e,0x44,0xc0,0x2e,0x05,0x56,0x2f,0x01,0x0c,
+  0xd0,0x04,0xde,0x7a,0x01,0x13,0x76,0x38,0x82,0x0c,0x13,0xd6,0x86,0x01,0x54,0x18,
+  0xbf,0xaa,0x98,0x00,0x26,0x2e,0xd1,0x05,0x2b,0x24,0x77,0x00,0x21,0x36,0x30,0x01,
+  0x22,0xd0,0x09,0x0d,0x28,0x90,0x7c,0x49,0x80,0x02,0x28,0x20,0x30,0xdb,0x17,0x4f,
+  0x46,0x15,0xa9,0x78,0x40,0x04,0x1e,0xc0,0x80,0x98,0x1a,0xb9,0xc2,0x06,0x79,0xf2,
+  0x93,0x07,0x4b,0x95,0xac,0x4a,0x39,0x20,0x00,0x3b
+  };
+
+/* Created by reswrap from file colors_gif.gif */
+const unsigned char colors_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x18,0x00,0x18,0x00,0xc6,0x00,0x00,0xb2,0xc0,0xdc,
+  0x6d,0x6d,0x55,0x49,0x49,0x55,0x49,0x6d,0x55,0x6d,0x49,0x55,0x24,0x24,0x00,0x92,
+  0x92,0x55,0xb6,0x92,0xaa,0x24,0x24,0x55,0xdb,0xb6,0xaa,0xdb,0xdb,0xaa,0xb6,0xb6,
+  0xaa,0x92,0xb6,0xaa,0x49,0x49,0x00,0x92,0xb6,0x55,0x24,0x6d,0x55,0x24,0x6d,0x00,
+  0xb6,0x92,0x55,0x49,0x92,0x55,0x49,0xb6,0x55,0x24,0x49,0x00,0x92,0x24,0x00,0xb6,
+  0x24,0x55,0x92,0x00,0x00,0x6d,0xb6,0xaa,0x6d,0xb6,0x55,0xb6,0xff,0xaa,0x92,0xdb,
+  0xaa,0x6d,0x92,0xaa,0xdb,0xdb,0xff,0xdb,0x6d,0x55,0xdb,0x24,0x55,0xdb,0x24,0x00,
+  0x92,0xdb,0x55,0x24,0x92,0x55,0x49,0x92,0xaa,0x00,0x6d,0x55,0x92,0x92,0xaa,0xdb,
+  0x92,0xaa,0xff,0x6d,0x55,0xff,0x92,0xaa,0xdb,0x6d,0xaa,0xb6,0x00,0x00,0xb6,0xdb,
+  0xff,0xb6,0xdb,0xaa,0x6d,0x92,0x55,0x00,0x92,0xaa,0x49,0xb6,0xaa,0xff,0xb6,0xaa,
+  0xb6,0x24,0x00,0xb6,0xff,0xff,0x92,0xdb,0xff,0x24,0x92,0xaa,0xdb,0x49,0x55,0xff,
+  0xdb,0xaa,0x24,0xb6,0xaa,0xff,0xdb,0xff,0xff,0xff,0xff,0xdb,0xff,0xff,0xff,0xff,
+  0xaa,0x00,0x6d,0xaa,0x00,0x49,0xaa,0x24,0x49,0x55,0xb6,0xb6,0xff,0x24,0x92,0xff,
+  0x00,0x49,0x55,0x6d,0xb6,0xff,0x49,0x24,0x00,0x6d,0xdb,0xff,0x6d,0x6d,0xaa,0xdb,
+  0xff,0xaa,0xdb,0xb6,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x18,0x00,0x18,0x00,0x00,0x07,0xfe,0x80,0x00,0x82,0x83,0x84,0x85,0x86,
+  0x87,0x84,0x01,0x02,0x03,0x02,0x04,0x8c,0x01,0x88,0x87,0x05,0x01,0x06,0x06,0x07,
+  0x95,0x06,0x02,0x05,0x91,0x83,0x08,0x03,0x09,0x0a,0xa0,0x0b,0x0c,0x96,0x0a,0x0b,
+  0x0d,0x08,0x91,0x01,0x0b,0xa2,0xa6,0x0e,0x0f,0x10,0x03,0xac,0x0a,0x99,0x87,0x02,
+  0xac,0x11,0x07,0xac,0x0e,0x12,0x13,0x12,0x14,0xac,0xac,0x06,0xa9,0x84,0x05,0xa6,
+  0x15,0x16,0x17,0x01,0x09,0x18,0x19,0x1a,0x1b,0x10,0x0b,0x0b,0x0e,0x1c,0x96,0x9b,
+  0x82,0x1c,0x01,0x1d,0x1e,0x1f,0x1e,0x20,0x17,0xd3,0x1b,0x1d,0x21,0x22,0x0b,0x23,
+  0x24,0x24,0x0f,0x07,0x0d,0x25,0x82,0x02,0x11,0x0a,0x26,0x27,0x28,0x29,0x2a,0x2b,
+  0x2c,0x2d,0x1b,0x12,0x19,0x0b,0x2e,0x18,0x2f,0x24,0x4a,0xd4,0x2a,0xa1,0x2d,0x5e,
+  0x02,0x18,0x28,0x62,0x28,0x30,0x35,0x81,0x41,0x82,0x0d,0x18,0x64,0xcc,0xa0,0xe1,
+  0x20,0x81,0x80,0x12,0x04,0x17,0x2a,0x80,0xe1,0xa1,0x46,0x0a,0x05,0x1d,0x6c,0x68,
+  0x5c,0x70,0x63,0xc5,0x8b,0x17,0x0b,0x14,0xb0,0xbb,0x85,0x03,0x24,0x48,0x18,0x20,
+  0x6d,0x74,0x70,0xa9,0x60,0xc4,0x0d,0x94,0x09,0xa4,0x15,0x28,0x90,0x23,0xa6,0xb4,
+  0x04,0x3a,0x64,0x2e,0x14,0x6a,0x4a,0xa0,0x81,0x9c,0x3b,0x5b,0x9a,0x5a,0x54,0x70,
+  0xc7,0xcc,0x99,0x0a,0x4a,0xf0,0x20,0xd1,0xc3,0x47,0xca,0x9d,0x3d,0x17,0x0c,0x18,
+  0x24,0x20,0x47,0xc8,0x90,0x0a,0x7e,0xd0,0x18,0x01,0x84,0x47,0x10,0x56,0x05,0x10,
+  0x78,0x5d,0x20,0x60,0x10,0x4f,0x53,0x6f,0x93,0x3a,0xb0,0x18,0x21,0x43,0x08,0x0d,
+  0x1e,0x39,0x7d,0x0c,0xc9,0x4a,0x60,0xd0,0x80,0x1c,0x5a,0x05,0x69,0xc3,0xb0,0x82,
+  0x88,0x8b,0x11,0x2a,0x4b,0x54,0x03,0xdc,0x16,0x00,0xcb,0x00,0xed,0x00,0xbc,0x1d,
+  0x31,0x62,0x16,0x01,0x8c,0x45,0x14,0xe0,0x68,0x11,0xa0,0x48,0x89,0x1c,0x06,0x8a,
+  0x14,0x53,0x1a,0x4a,0x6b,0xbb,0x00,0x20,0x71,0x18,0x28,0xb1,0x23,0xc7,0xb5,0x41,
+  0xab,0x16,0x82,0x32,0x40,0xa8,0x48,0x0e,0x23,0x39,0xbc,0xf6,0x2d,0xc4,0x20,0xb6,
+  0x82,0xc6,0x89,0x8e,0x28,0xe8,0x09,0xbc,0x90,0x00,0x04,0xaf,0x0b,0x41,0x0e,0xb0,
+  0x95,0x93,0xf3,0xe7,0x86,0x02,0x01,0x00,0x3b
+  };
+
+/* Created by reswrap from file filebinding_gif.gif */
+const unsigned char filebinding_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x20,0x00,0x20,0x00,0xe3,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0x9d,0xa0,0xeb,0xc8,0xd7,0xa1,0xff,0xdc,0xa8,0x87,0x84,0xc0,0xff,
+  0xa8,0x58,0x8a,0x7c,0xa4,0x81,0x7f,0xa4,0x80,0x83,0xc0,0x80,0x80,0x80,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x04,0xfb,0x10,0x84,0x49,0xab,0xa5,0x20,0xeb,
+  0xad,0x83,0x18,0xe0,0x27,0x0e,0xe3,0x38,0x71,0xa8,0x27,0x7c,0x64,0x5b,0xba,0xe4,
+  0x89,0x66,0xea,0xca,0xc2,0xaf,0x19,0xcc,0xb5,0x7d,0x83,0x16,0x90,0x10,0x98,0xf2,
+  0xf9,0x48,0x82,0x00,0x61,0x69,0x29,0x38,0x0b,0x3b,0x4e,0xef,0x98,0x54,0x1a,0x94,
+  0x4c,0x8a,0x33,0xba,0x99,0xda,0x62,0x56,0x6c,0x60,0x78,0xe9,0x18,0xbf,0x55,0xc2,
+  0x55,0x3d,0x5e,0x12,0x86,0x44,0xc9,0x79,0x05,0x66,0xb3,0x07,0xee,0x3c,0x9b,0x36,
+  0x17,0x4d,0xec,0x57,0x78,0x7a,0x4b,0x57,0x7c,0x73,0x31,0x55,0x61,0x03,0x17,0x13,
+  0x57,0x3b,0x5e,0x74,0x49,0x36,0x8d,0x13,0x70,0x70,0x07,0x13,0x7d,0x31,0x08,0x3e,
+  0x14,0x48,0x73,0x98,0x90,0x7e,0x01,0x07,0x9c,0x54,0x89,0x99,0x02,0xa1,0x9a,0x49,
+  0x8b,0xa4,0xa6,0x22,0x92,0x2b,0x2a,0xab,0x87,0xad,0xb3,0xaf,0xb1,0xa0,0xa9,0x67,
+  0x31,0x48,0x15,0x07,0xc1,0xc2,0xc3,0xc1,0xbc,0x46,0xbe,0xb3,0x93,0x8c,0x15,0x72,
+  0xb6,0x63,0x7d,0xaa,0x1e,0x5c,0x66,0xce,0xc4,0xd6,0xd2,0x45,0xb6,0xa8,0x8c,0xb3,
+  0xd9,0xbd,0xad,0x96,0x64,0x49,0xde,0xc7,0xb7,0x7d,0x98,0xe3,0x52,0xac,0xcf,0xdb,
+  0x2b,0xe8,0xd3,0x86,0xdf,0xcf,0x09,0x35,0xb4,0xd8,0x52,0x0a,0xce,0x9f,0x67,0xef,
+  0x29,0xa4,0x07,0xe5,0xfe,0x59,0x13,0x76,0xcf,0x5f,0x30,0x34,0xdb,0x2e,0x74,0x9b,
+  0x41,0x43,0xe0,0x3e,0x68,0x0b,0x19,0x36,0x54,0x30,0xb0,0x22,0x26,0x89,0x52,0x96,
+  0x2d,0x9b,0x11,0x01,0x00,0x3b
+  };
+
+/* Created by reswrap from file settings_gif.gif */
+const unsigned char settings_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x20,0x00,0x20,0x00,0xe7,0x00,0x00,0xff,0xff,0xff,
+  0xa0,0xa0,0x91,0x10,0x10,0x0e,0x80,0x80,0x74,0x4b,0x4b,0x4b,0xe1,0xe1,0xe1,0x58,
+  0x58,0x58,0x50,0x50,0x48,0xf0,0xf0,0xd9,0xc0,0xc0,0xae,0x70,0x70,0x65,0x40,0x40,
+  0x3a,0x60,0x60,0x57,0xd0,0xd0,0xbc,0x96,0x96,0x96,0xec,0xec,0xec,0xe5,0xe5,0xe5,
+  0x8b,0x8b,0x8b,0x30,0x30,0x2b,0x2e,0x2e,0x2e,0x87,0x87,0x87,0x99,0x99,0x99,0x46,
+  0x46,0x46,0xe0,0xe0,0xcb,0x1d,0x1d,0x1d,0xe7,0xe7,0xe7,0xe0,0xe0,0xe0,0xda,0xda,
+  0xda,0xac,0xac,0xac,0x20,0x20,0x1d,0x5b,0x5b,0x5b,0xb9,0xb9,0xb9,0xb2,0xb2,0xb2,
+  0x70,0x70,0x70,0xdb,0xdb,0xdb,0xd4,0xd4,0xd4,0xba,0xba,0xba,0x35,0x35,0x35,0xb0,
+  0xb0,0xb0,0x7b,0x7b,0x7b,0x1d,0x1d,0x1c,0xc7,0xc7,0xc7,0xc5,0xc5,0xc5,0x6f,0x6f,
+  0x6f,0x71,0x71,0x71,0xb5,0xb5,0xb5,0x68,0x68,0x68,0x1c,0x1c,0x1b,0x78,0x78,0x78,
+  0xcc,0xcc,0xcc,0xee,0xee,0xee,0x5e,0x5e,0x5e,0x9c,0x9c,0x9c,0xbb,0xbb,0xbb,0xa9,
+  0xa9,0xa9,0xb0,0xb0,0x9f,0x56,0x56,0x56,0xe4,0xe4,0xe4,0x00,0x00,0x00,0xf5,0xf5,
+  0xf5,0xf9,0xf9,0xf9,0x2d,0x2d,0x2d,0xb7,0xb7,0xb7,0xc1,0xc1,0xc1,0x85,0x85,0x85,
+  0x5d,0x5d,0x5d,0x64,0x64,0x64,0x29,0x29,0x29,0x8f,0x8f,0x8f,0xc3,0xc3,0xc3,0xce,
+  0xce,0xce,0xe3,0xe3,0xe3,0xa4,0xa4,0xa4,0xaa,0xaa,0xaa,0xaf,0xaf,0xaf,0xc4,0xc4,
+  0xc4,0xd6,0xd6,0xd6,0xc9,0xc9,0xc9,0x1e,0x1e,0x1d,0x95,0x95,0x95,0x81,0x81,0x81,
+  0xb6,0xb6,0xb6,0xdf,0xdf,0xdf,0xdd,0xdd,0xdd,0xc8,0xc8,0xc8,0x1a,0x1a,0x1a,0xbf,
+  0xbf,0xbf,0x6e,0x6e,0x6e,0x3b,0x3b,0x3b,0x7f,0x7f,0x7f,0x62,0x62,0x62,0xab,0xab,
+  0xab,0xdc,0xdc,0xdc,0x39,0x39,0x38,0x90,0x90,0x82,0x25,0x25,0x25,0x3a,0x3a,0x3a,
+  0x3e,0x35,0x00,0x6d,0x5a,0x00,0x22,0x22,0x22,0x42,0x42,0x42,0xa8,0x9a,0x49,0xfb,
+  0xd0,0x00,0xf5,0xbc,0x00,0x2e,0x23,0x00,0x06,0x06,0x06,0xb1,0x9c,0x13,0xfc,0xd1,
+  0x00,0xf9,0xc3,0x00,0xe7,0xa0,0x00,0x38,0x27,0x00,0x3e,0x32,0x00,0x5f,0x5f,0x5f,
+  0x6e,0x5f,0x00,0xfd,0xd2,0x00,0xf8,0xc1,0x00,0xf2,0xb6,0x00,0xed,0xab,0x00,0xc0,
+  0x83,0x00,0x8e,0x6a,0x00,0x83,0x83,0x83,0x4f,0x43,0x00,0xa8,0x88,0x00,0xbf,0x91,
+  0x00,0xe8,0xa5,0x00,0xe6,0xac,0x00,0xd1,0x97,0x00,0xb2,0x74,0x00,0xb0,0x73,0x00,
+  0x7f,0x5f,0x00,0x21,0x21,0x21,0x95,0x78,0x00,0xfa,0xc9,0x00,0xc4,0x89,0x00,0xab,
+  0x6f,0x00,0xbd,0x83,0x00,0xb0,0x72,0x00,0xbf,0x85,0x00,0x58,0x42,0x00,0xa8,0xa8,
+  0xa8,0x18,0x18,0x18,0xad,0x95,0x00,0xb4,0x7c,0x00,0xba,0x7f,0x00,0xb4,0x79,0x00,
+  0xaf,0x74,0x00,0xc2,0x8a,0x00,0xb3,0x77,0x00,0xca,0x92,0x00,0x2c,0x20,0x00,0x2f,
+  0x28,0x00,0xd3,0xac,0x00,0xb5,0x7d,0x00,0xc7,0x8e,0x00,0xb3,0x7a,0x00,0xcb,0x93,
+  0x00,0xb2,0x79,0x00,0xc6,0x94,0x00,0x2d,0x25,0x0e,0xb4,0xb4,0xb4,0x92,0x92,0x92,
+  0x51,0x51,0x51,0x84,0x84,0x84,0xb8,0xb8,0xb8,0x5d,0x4f,0x00,0xd7,0xaa,0x00,0xb8,
+  0x81,0x00,0xcb,0x94,0x00,0xb7,0x80,0x00,0xb9,0x82,0x00,0xce,0x98,0x00,0xb9,0x83,
+  0x00,0xb6,0x8c,0x00,0x1e,0x1a,0x0e,0x9e,0x9e,0x9e,0x1b,0x1b,0x1a,0x53,0x53,0x53,
+  0x6c,0x5b,0x00,0xd1,0xa3,0x00,0xc1,0x8c,0x00,0xc7,0x92,0x00,0xbb,0x85,0x00,0xc3,
+  0x8f,0x00,0xc9,0x94,0x00,0xbe,0x8a,0x00,0xa2,0x7f,0x00,0x3e,0x3e,0x3e,0x27,0x27,
+  0x27,0x98,0x7e,0x00,0xce,0x9f,0x00,0xca,0x98,0x00,0xca,0x94,0x00,0xbe,0x8b,0x00,
+  0xd1,0x9e,0x00,0xdd,0xa9,0x00,0x2b,0x2b,0x2b,0xc1,0xa0,0x00,0xc9,0x99,0x00,0xd2,
+  0xa3,0x00,0xca,0x97,0x00,0xc2,0x90,0x00,0xed,0xb2,0x00,0x56,0x3c,0x00,0xd7,0xd7,
+  0xd7,0x1f,0x1c,0x0e,0xcd,0xa8,0x00,0xca,0x9b,0x00,0xde,0xad,0x00,0xd4,0x99,0x00,
+  0x39,0x28,0x00,0x0d,0x0d,0x0d,0x2d,0x24,0x00,0xd8,0xae,0x00,0xc8,0x96,0x00,0x2b,
+  0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x08,0xfe,0x00,0x01,0x08,0x1c,0x48,0xb0,0xa0,
+  0xc1,0x83,0x08,0x13,0x2a,0x5c,0xc8,0xb0,0xa1,0xc2,0x00,0x02,0x06,0x38,0x74,0x38,
+  0x80,0x40,0x01,0x03,0x07,0x10,0x2c,0x4c,0xa0,0x60,0x01,0x83,0x06,0x0a,0x19,0x38,
+  0x78,0x00,0x21,0x82,0x04,0x90,0x08,0x19,0x4c,0xa0,0x50,0xc1,0x82,0xc4,0x84,0x17,
+  0x30,0x64,0xd0,0xb0,0x81,0x43,0x07,0x84,0x0a,0x3c,0x7c,0x00,0x11,0x42,0x82,0x46,
+  0x85,0x03,0x42,0x88,0x18,0x41,0xa2,0x04,0x4a,0x82,0x0d,0x26,0x7c,0x30,0x71,0xc2,
+  0xa7,0xc0,0x00,0x17,0x10,0x22,0x40,0x91,0x42,0x05,0x88,0x15,0x07,0x0c,0x0e,0x60,
+  0x01,0xa2,0x85,0x8b,0x97,0x0c,0x2c,0xdc,0x44,0x18,0xe0,0x05,0x8c,0x18,0x32,0x66,
+  0x28,0x28,0x38,0x80,0x46,0x8b,0x1a,0x36,0x3a,0xdc,0x60,0x80,0x23,0x87,0x0e,0x85,
+  0x08,0xe8,0xee,0xe0,0xd1,0x23,0xc0,0x40,0x04,0x12,0x7c,0xd4,0xf8,0x91,0x02,0x48,
+  0x10,0x21,0x10,0x20,0x8c,0x55,0x78,0x80,0xc6,0x8e,0x0d,0x43,0x40,0x02,0x26,0x92,
+  0xa2,0x45,0x11,0x23,0x23,0x44,0x1c,0x81,0x40,0x84,0x01,0x43,0xc0,0x48,0x72,0x98,
+  0x78,0xd1,0x40,0x02,0xe5,0x24,0x4a,0x96,0x30,0xd9,0x50,0x00,0x42,0x13,0x27,0x51,
+  0x19,0x5e,0x70,0xd2,0x62,0xc4,0x13,0x1d,0x50,0x52,0xa0,0x8e,0x22,0x65,0x4a,0x01,
+  0x2a,0x44,0x9c,0x1c,0x65,0xd8,0xa0,0xca,0x0f,0x2b,0x57,0xb0,0x64,0xd1,0xb2,0x85,
+  0x0b,0x93,0x2e,0x0b,0x16,0x28,0xf8,0x39,0xd1,0xcb,0x97,0x0f,0x36,0xc0,0x84,0x11,
+  0x33,0xe4,0xf9,0xf0,0x89,0x00,0x00,0xfe,0x8f,0x21,0x43,0xa3,0x8c,0x99,0x33,0x68,
+  0x22,0x83,0x27,0x38,0x99,0x48,0x1a,0x35,0x6b,0xd8,0xb4,0x71,0xf3,0xc6,0xe9,0xfa,
+  0xc9,0x29,0xe0,0xc4,0x91,0x33,0x87,0x4e,0x9b,0x3a,0x76,0xdc,0x61,0x1f,0x43,0x1c,
+  0x2d,0xd0,0xc1,0x69,0x78,0xe4,0xa1,0xc7,0x1e,0x7c,0xf4,0xe1,0xc7,0x1f,0x80,0x04,
+  0xe2,0x19,0x43,0x2a,0xb1,0xa4,0x84,0x6e,0x4a,0x44,0x71,0x85,0x20,0x83,0x10,0x52,
+  0x88,0x21,0x87,0x20,0x92,0x88,0x22,0x2f,0x25,0x94,0xd3,0x4e,0x6f,0xb5,0x90,0x21,
+  0x17,0x8b,0x30,0xd2,0x88,0x23,0x8f,0x40,0x12,0x89,0x24,0x93,0x50,0x52,0x89,0x5f,
+  0x08,0x5d,0xa0,0x94,0x09,0x6f,0xfd,0x50,0xc4,0x0f,0x52,0x3c,0xe7,0x85,0x25,0x97,
+  0x60,0x92,0x89,0x26,0x8e,0x6c,0xc2,0x49,0x27,0x9e,0x7c,0x37,0x90,0x17,0x2c,0x7c,
+  0x02,0x4a,0x28,0xa2,0x8c,0x62,0x04,0x13,0x53,0xa8,0xe7,0x05,0x29,0xa5,0x98,0x72,
+  0x0a,0x2a,0xa9,0xa8,0xb2,0x0a,0x2b,0xad,0x50,0x47,0xd0,0x00,0xae,0x80,0xf2,0x4a,
+  0x00,0x0c,0xc0,0x32,0x02,0x6b,0x77,0x09,0xc4,0x40,0x2c,0xb2,0xcc,0x42,0x4b,0x2d,
+  0xb6,0xdc,0x82,0x4b,0x2e,0x0b,0x1c,0xe4,0x85,0x2e,0xaf,0x80,0x74,0xc1,0x2e,0x5c,
+  0xb4,0x26,0x00,0x41,0x12,0xf0,0xd2,0x8b,0x2f,0xbf,0x00,0x13,0xcc,0x2d,0xc2,0xc4,
+  0x59,0x10,0x02,0x03,0xc4,0x16,0xc0,0x30,0x39,0x70,0x36,0xa1,0x40,0x08,0x74,0x40,
+  0x4c,0x31,0xc6,0x1c,0x83,0x4c,0x32,0xca,0xac,0xf5,0xd0,0x30,0xcb,0xb8,0x06,0x5b,
+  0x41,0x0d,0x30,0xd3,0x8c,0x33,0x28,0xcf,0x40,0x13,0xcd,0xa6,0x08,0x35,0x20,0x0d,
+  0x13,0x4d,0x40,0x21,0xdc,0x41,0x09,0x4c,0x43,0x4d,0x35,0xd6,0xe0,0xb8,0x10,0x03,
+  0xd1,0x79,0x61,0x66,0x41,0x10,0x75,0x90,0xc0,0x7a,0xcc,0x36,0xbb,0x5e,0x40,0x00,
+  0x3b
+  };
+
@@ -0,0 +1,14 @@
+/*********** Generated on 2026/10/18 22:46:56 by reswrap version 6.0.0 *********/
+
+/* Created by reswrap from file controlpanel_gif.gif */
+extern const unsigned char controlpanel_gif[];
+
+/* Created by reswrap from file colors_gif.gif */
+extern const unsigned char colors_gif[];
+
+/* Created by reswrap from file filebinding_gif.gif */
+extern const unsigned char filebinding_gif[];
+
+/* Created by reswrap from file settings_gif.gif */
+extern const unsigned char settings_gif[];
+
@@ -35,13 +35,33 @@ protected:
 protected:
   FXArrayBase();
   FXbool resize(FXival num,FXival sz);
+  FXbool reserve(FXival num,FXival sz);
+  FXbool shrink(FXival sz);
  ~FXArrayBase();
   };
 
 
-/// Array of some generic type
+/**
+* Array of some generic type.
+* Room for items is allocated ahead, so that appending items one at a time takes
+* amortized constant time; reserve() may be used to allocate room for a known number
+* of items up front.  Items are moved around bit-wise when the array is resized, and
+* when items are inserted or removed in the middle.
+*/
 template<typename EType>
 class FXArray : public FXArrayBase {
+private:
+
+  // Replace m items at pos by room for n unconstructed items
+  FXbool splice(FXival pos,FXival m,FXival n){
+    FXival num=no();
+    if(m<n && !resize(num-m+n,sizeof(EType))) return false;
+    destructElms(data()+pos,m);
+    bitmoveElms(data()+pos+n,data()+pos+m,num-pos-m);
+    if(n<m) resize(num-m+n,sizeof(EType));
+    return true;
+    }
+
 public:
 
   /// Allocate initially empty array
@@ -55,6 +75,11 @@ public:
     if(no(src.no())){ copyElms(data(),src.data(),src.no()); }
     }
 
+  /// Allocate array moved from another; the other array becomes empty
+  FXArray(FXArray<EType>&& src){
+    swap(ptr,src.ptr);
+    }
+
   /// Allocate initialized with n copies of object
   FXArray(const EType& src,FXival n){
     if(no(n)){ fillElms(data(),src,n); }
@@ -82,12 +107,26 @@ public:
     return true;
     }
 
+  /// Return number of items the array can hold without reallocating
+  FXival capacity() const { return *(((FXival*)ptr)-2); }
+
+  /// Make room for at least n items, without changing the number of items
+  FXbool reserve(FXival n){ return FXArrayBase::reserve(n,sizeof(EType)); }
+
+  /// Release room not taken up by items
+  FXbool shrink(){ return FXArrayBase::shrink(sizeof(EType)); }
+
   /// Assign from another array
   FXArray<EType>& operator=(const FXArray<EType>& src){
     if(data()!=src.data() && no(src.no())){ copyElms(data(),src.data(),src.no()); }
     return *this;
     }
 
+  /// Move from another array; the other array becomes empty
+  FXArray<EType>& operator=(FXArray<EType>&& src){
+    return adopt(src);
+    }
+
   /// Return pointer to array
   EType* data(){ return reinterpret_cast<EType*>(ptr); }
   const EType* data() const { return reinterpret_cast<const EType*>(ptr); }
@@ -139,19 +178,25 @@ public:
 
   /// Insert an object
   FXbool insert(FXival pos,const EType& src){
-    if(no(no()+1)){ moveElms(data()+pos+1,data()+pos,no()-pos-1); at(pos)=src; return true; }
+    if(splice(pos,0,1)){ construct(data()+pos,src); return true; }
+    return false;
+    }
+
+  /// Insert an object, moving it into place
+  FXbool insert(FXival pos,EType&& src){
+    if(splice(pos,0,1)){ ::new ((void*)(data()+pos)) EType(static_cast<EType&&>(src)); return true; }
     return false;
     }
 
   /// Insert n copies of object at specified position
   FXbool insert(FXival pos,const EType& src,FXival n){
-    if(no(no()+n)){ moveElms(data()+pos+n,data()+pos,no()-pos-n); fillElms(data()+pos,src,n); return true; }
+    if(splice(pos,0,n)){ constructElms(data()+pos,n); fillElms(data()+pos,src,n); return true; }
     return false;
     }
 
   /// Insert n objects at specified position
   FXbool insert(FXival pos,const EType* src,FXival n){
-    if(no(no()+n)){ moveElms(data()+pos+n,data()+pos,no()-pos-n); copyElms(data()+pos,src,n); return true; }
+    if(splice(pos,0,n)){ constructElms(data()+pos,n); copyElms(data()+pos,src,n); return true; }
     return false;
     }
 
@@ -162,20 +207,22 @@ public:
 
   /// Prepend object
   FXbool prepend(const EType& src){
-    if(no(no()+1)){ moveElms(data()+1,data(),no()-1); head()=src; return true; }
-    return false;
+    return insert(0,src);
+    }
+
+  /// Prepend object, moving it into place
+  FXbool prepend(EType&& src){
+    return insert(0,static_cast<EType&&>(src));
     }
 
   /// Prepend n copies of object
   FXbool prepend(const EType& src,FXival n){
-    if(no(no()+n)){ moveElms(data()+n,data(),no()-n); fillElms(data(),src,n); return true; }
-    return false;
+    return insert(0,src,n);
     }
 
   /// Prepend n objects
   FXbool prepend(const EType* src,FXival n){
-    if(no(no()+n)){ moveElms(data()+n,data(),no()-n); copyElms(data(),src,n); return true; }
-    return false;
+    return insert(0,src,n);
     }
 
   /// Prepend n objects
@@ -185,7 +232,13 @@ public:
 
   /// Append object
   FXbool append(const EType& src){
-    if(no(no()+1)){ tail()=src; return true; }
+    if(resize(no()+1,sizeof(EType))){ construct(&tail(),src); return true; }
+    return false;
+    }
+
+  /// Append object, moving it into place
+  FXbool append(EType&& src){
+    if(resize(no()+1,sizeof(EType))){ ::new ((void*)&tail()) EType(static_cast<EType&&>(src)); return true; }
     return false;
     }
 
@@ -206,38 +259,35 @@ public:
     return append(src.data(),src.no());
     }
 
+  /// Append object constructed in place from the given arguments
+  template<typename... Args>
+  FXbool emplace(Args&&... args){
+    if(resize(no()+1,sizeof(EType))){ ::new ((void*)&tail()) EType(static_cast<Args&&>(args)...); return true; }
+    return false;
+    }
+
   /// Replace an object by other object
   FXbool replace(FXival pos,const EType& src){
     at(pos)=src;
     return true;
     }
 
+  /// Replace an object by other object, moving it into place
+  FXbool replace(FXival pos,EType&& src){
+    at(pos)=static_cast<EType&&>(src);
+    return true;
+    }
+
   /// Replace the m objects at pos with n copies of other object
   FXbool replace(FXival pos,FXival m,const EType& src,FXival n){
-    if(m<n){
-      if(!no(no()-m+n)) return false;
-      moveElms(data()+pos+n,data()+pos+m,no()-pos-n);
-      }
-    else if(m>n){
-      moveElms(data()+pos+n,data()+pos+m,no()-pos-m);
-      if(!no(no()-m+n)) return false;
-      }
-    fillElms(data()+pos,src,n);
-    return true;
+    if(splice(pos,m,n)){ constructElms(data()+pos,n); fillElms(data()+pos,src,n); return true; }
+    return false;
     }
 
   /// Replace m objects at pos by n other objects
   FXbool replace(FXival pos,FXival m,const EType* src,FXival n){
-    if(m<n){
-      if(!no(no()-m+n)) return false;
-      moveElms(data()+pos+n,data()+pos+m,no()-pos-n);
-      }
-    else if(m>n){
-      moveElms(data()+pos+n,data()+pos+m,no()-pos-m);
-      if(!no(no()-m+n)) return false;
-      }
-    copyElms(data()+pos,src,n);
-    return true;
+    if(splice(pos,m,n)){ constructElms(data()+pos,n); copyElms(data()+pos,src,n); return true; }
+    return false;
     }
 
   /// Replace m objects at pos by other objects
@@ -247,20 +297,22 @@ public:
 
   /// Remove object at pos
   FXbool erase(FXival pos){
-    moveElms(data()+pos,data()+pos+1,no()-pos-1);
-    return no(no()-1);
+    return splice(pos,1,0);
     }
 
   /// Remove n objects starting at pos
   FXbool erase(FXival pos,FXival n){
-    moveElms(data()+pos,data()+pos+n,no()-pos-n);
-    return no(no()-n);
+    return splice(pos,n,0);
     }
 
   /// Push object to end
   FXbool push(const EType& src){
-    if(no(no()+1)){ tail()=src; return true; }
-    return false;
+    return append(src);
+    }
+
+  /// Push object to end, moving it into place
+  FXbool push(EType&& src){
+    return append(static_cast<EType&&>(src));
     }
 
   /// Pop object from end
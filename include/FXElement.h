@@ -84,6 +84,14 @@ inline void copyElms(EType* dst,const OType* src,FXuval n){
   }
 
 
+/// Copy some elements from one place to another; bit-wise if trivially copyable
+template<typename EType>
+inline void copyElms(EType* dst,const EType* src,FXuval n){
+  if(std::is_trivially_copyable<EType>::value){ memcpy((void*)dst,(const void*)src,n*sizeof(EType)); return; }
+  while(n--){ *dst++ = *src++; }
+  }
+
+
 /// Bit-wise copy elements from overlapping place to another
 template<typename EType>
 inline void bitcopyElms(EType* dst,const EType* src,FXuval n){
@@ -91,9 +99,10 @@ inline void bitcopyElms(EType* dst,const EType* src,FXuval n){
   }
 
 
-/// Move some elements from overlapping place to another
+/// Move some elements from overlapping place to another; bit-wise if trivially copyable
 template<typename EType>
 inline void moveElms(EType* dst,const EType* src,FXuval n){
+  if(std::is_trivially_copyable<EType>::value){ memmove((void*)dst,(const void*)src,n*sizeof(EType)); return; }
   if(src!=dst){
     if(0<(src-dst)){
       while(n--){ *dst++ = *src++; }
@@ -114,10 +123,10 @@ inline void bitmoveElms(EType* dst,const EType* src,FXuval n){
   }
 
 
-/// Swap element dst and src
+/// Swap element dst and src, moving rather than copying where possible
 template<typename EType>
 inline EType& swap(EType& dst,EType& src){
-  EType t=dst; dst=src; src=t;
+  EType t(static_cast<EType&&>(dst)); dst=static_cast<EType&&>(src); src=static_cast<EType&&>(t);
   return dst;
   }
 
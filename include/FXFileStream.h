@@ -35,6 +35,8 @@ protected:
 protected:
   virtual FXuval writeBuffer(FXuval count);
   virtual FXuval readBuffer(FXuval count);
+  virtual FXuval writeBlock(const FXuchar* data,FXuval count);
+  virtual FXuval readBlock(FXuchar* data,FXuval count);
 private:
   FXFileStream(const FXFileStream&);
   FXFileStream& operator=(const FXFileStream&);
@@ -29,6 +29,7 @@
 namespace FX {
 
 
+class FXThreadPool;
 struct ZBlock;
 
 
@@ -40,6 +41,8 @@ private:
 protected:
   virtual FXuval writeBuffer(FXuval count);
   virtual FXuval readBuffer(FXuval count);
+  virtual FXuval writeBlock(const FXuchar* data,FXuval count);
+  virtual FXuval readBlock(FXuchar* data,FXuval count);
 private:
   FXGZFileStream(const FXGZFileStream&);
   FXGZFileStream& operator=(const FXGZFileStream&);
@@ -49,10 +52,18 @@ public:
   FXGZFileStream(const FXObject* cont=nullptr);
 
   /// Create and open GZIP compressed file stream
-  FXGZFileStream(const FXString& filename,FXStreamDirection save_or_load=FXStreamLoad,FXuval size=8192UL);
-
-  /// Open file stream
-  FXbool open(const FXString& filename,FXStreamDirection save_or_load=FXStreamLoad,FXuval size=8192UL);
+  FXGZFileStream(const FXString& filename,FXStreamDirection save_or_load=FXStreamLoad,FXuval size=8192UL,FXThreadPool* pool=nullptr);
+
+  /**
+  * Open file stream.
+  * If a thread pool is passed, data being saved is split into blocks which are
+  * compressed concurrently by tasks on the thread pool; the file is a single zlib
+  * stream, the same as without the thread pool.  Data being loaded is decompressed
+  * by tasks on the thread pool, ahead of the stream.  While waiting for its tasks,
+  * the stream runs tasks queued on the thread pool itself, so it doesn't rely on
+  * a worker thread being free.
+  */
+  FXbool open(const FXString& filename,FXStreamDirection save_or_load=FXStreamLoad,FXuval size=8192UL,FXThreadPool* pool=nullptr);
 
   /// Flush buffer
   virtual FXbool flush();
@@ -29,6 +29,8 @@ namespace FX {
 * Two special key values are disallowed: NULL and the pointer value (-1L);
 * NULL is used to designate an unoccupied slot, while (-1L) is used to designate
 * a formerly occupied slot.
+* Slots are probed in groups, using a byte of the key's hash value kept for each
+* slot; thus most lookups touch no more than two cache lines.
 */
 class FXAPI FXHash {
 protected:
@@ -21,6 +21,9 @@
 #ifndef FXJSON_H
 #define FXJSON_H
 
+#ifndef FXARRAY_H
+#include "FXArray.h"
+#endif
 #ifndef FXPARSEBUFFER_H
 #include "FXParseBuffer.h"
 #endif
@@ -47,6 +50,13 @@ namespace FX {
 * diagnosis of the problem and its location in the file by line number, column
 * number, and byte-offset from the start of the file.
 *
+* Besides loading a whole document into an FXVariant, the input may be parsed one
+* piece at a time by calling pull() repeatedly; each call reports the next key,
+* value, or start or end of a map or array.  The text of keys and values may be
+* inspected in place in the parse buffer, so that large documents may be filtered
+* without building them up in memory.  Parts of the document may be passed over
+* with skip(), or loaded into an FXVariant with load().
+*
 * When writing a json stream, the generated output may be formatted in different
 * ways. The flow-mode controls the overall layout of the resulting text output;
 * when flow is set to Stream, all output is generated with no formatting to
@@ -57,8 +67,9 @@ namespace FX {
 * results, and the resulting document will contain many, many lines with
 * little data.
 *
-* Numeric values are printed with configurable precision; (default=15 digits
-* which results in minimal information loss for real numbers).
+* Numeric values are printed with configurable precision; by default, with the
+* fewest digits which read back as the same number, so real numbers survive
+* a round trip through the json file exactly.
 * For Pretty flow format, output may be indented in multiples of the indent
 * level (default=2).  Depending on flow setting, lines may be wrapped at a
 * maximum number of columns (default=80).
@@ -98,6 +109,21 @@ public:
     ErrEnd              /// Unexpected end of file
     };
 
+  /// JSON pull parser events
+  enum Event {
+    EventEnd,           /// End of document
+    EventNull,          /// Null value
+    EventBool,          /// Boolean value
+    EventInt,           /// Integer value, decimal or hexadecimal
+    EventReal,          /// Real value, including infinity and NaN
+    EventString,        /// String value
+    EventKey,           /// Key of map member; its value is next
+    EventBeginArray,    /// Start of array
+    EventEndArray,      /// End of array
+    EventBeginMap,      /// Start of map
+    EventEndMap         /// End of map
+    };
+
   /// JSON serializer flow modes
   enum Flow {
     Stream,             /// Stream-of-consciousness output
@@ -128,20 +154,28 @@ protected:
     TK_RBRACE
     };
 protected:
-  FXString  value;      // Token value
-  FXlong    offset;     // Position from start
-  Token     token;      // Token
-  FXint     column;     // Column number
-  FXint     indent;     // Indent level
-  FXint     line;       // Line number
-  FXint     wrap;       // Line wrap column
-  FXchar    quote;      // Quote type used
-  FXuchar   flow;       // Output flow
-  FXuchar   prec;       // Float precision
-  FXuchar   fmt;        // Float format
-  FXuchar   esc;        // Escape mode
-  FXuchar   dent;       // Indentation amount
-  FXuchar   ver;        // Version
+  FXString         value;       // Token value
+  FXArray<FXuchar> nest;        // Maps and arrays being pulled
+  const FXchar    *textptr;     // Text of pulled key or value
+  FXint            textlen;     // Length of its text
+  FXulong          mantissa;    // Significant digits of number
+  FXint            exponent;    // Decimal exponent of number
+  FXint            digits;      // Number of significant digits
+  FXlong           offset;      // Position from start
+  Token            token;       // Token
+  FXint            column;      // Column number
+  FXint            indent;      // Indent level
+  FXint            line;        // Line number
+  FXint            wrap;        // Line wrap column
+  FXchar           quote;       // Quote type used
+  FXuchar          flow;        // Output flow
+  FXuchar          prec;        // Float precision
+  FXuchar          fmt;         // Float format
+  FXuchar          esc;         // Escape mode
+  FXuchar          dent;        // Indentation amount
+  FXuchar          ver;         // Version
+  FXuchar          state;       // Pull parser state
+  FXuchar          sign;        // Pulled number is negative
 protected:
   static const FXchar *const errors[];
 protected:
@@ -151,7 +185,7 @@ protected:
   static Token identoken(const FXString& str);
   Error loadMap(FXVariant& var);
   Error loadArray(FXVariant& var);
-  Error loadVariant(FXVariant& var);
+  Error loadVariant(FXVariant& var,Event event);
   Error saveString(const FXString& str);
   Error saveIdent(const FXString& str);
   Error saveMap(const FXVariant& var);
@@ -197,9 +231,63 @@ public:
   /**
   * Load a variant from JSON stream.
   * Return false if stream wasn't opened for loading, or syntax error.
+  * If part of the stream was already pulled, the next value is loaded;
+  * for example, the value of the key which was just pulled.
   */
   virtual Error load(FXVariant& variant);
 
+  /**
+  * Pull the next event from JSON stream.
+  * Keys and values are available through getText() and friends until the next
+  * call; at the end of the top-level value, EventEnd is returned.
+  * Return an error if stream wasn't opened for loading, or syntax error.
+  */
+  Error pull(Event& event);
+
+  /**
+  * Skip the rest of the innermost map or array being pulled, up to and
+  * including its end; if a map or array was just begun, this skips all of it.
+  */
+  Error skip();
+
+  /**
+  * Return the number of maps and arrays the pulled event is nested in;
+  * after EventBeginMap or EventBeginArray, this includes the one just begun.
+  */
+  FXint getDepth() const { return (FXint)nest.no(); }
+
+  /**
+  * Return the text of the pulled key or value, in place in the buffer,
+  * without the quotes of strings; escape sequences are not decoded.
+  * The text is not null-terminated, and is valid until the next pull().
+  */
+  const FXchar* getText() const { return textptr; }
+
+  /**
+  * Return length of the text of the pulled key or value.
+  */
+  FXint getTextLength() const { return textlen; }
+
+  /**
+  * Return the pulled key or string value, with escape sequences decoded.
+  */
+  FXString getString() const;
+
+  /**
+  * Return the pulled boolean value.
+  */
+  FXbool getBool() const { return token==TK_TRUE; }
+
+  /**
+  * Return the pulled integer value.
+  */
+  FXlong getLong() const;
+
+  /**
+  * Return the pulled real or integer value.
+  */
+  FXdouble getDouble() const;
+
   /**
   * Save a variant to JSON stream.
   * Return false if stream wasn't opened for saving, or disk was full.
@@ -214,7 +302,8 @@ public:
   /**
   * Floating point output precision control.
   * This controls the number of significant digits written to
-  * the output.  The default is 15.
+  * the output.  The default is 0, which writes the fewest digits
+  * which read back as the same number.
   */
   void setNumericPrecision(FXuchar p){ prec=p; }
   FXuchar getNumericPrecision() const { return prec; }
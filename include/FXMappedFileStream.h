@@ -0,0 +1,110 @@
+/********************************************************************************
+*                                                                               *
+*                M a p p e d   F i l e   S t r e a m   C l a s s                *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+*********************************************************************************
+* This library is free software; you can redistribute it and/or modify          *
+* it under the terms of the GNU Lesser General Public License as published by   *
+* the Free Software Foundation; either version 3 of the License, or             *
+* (at your option) any later version.                                           *
+*                                                                               *
+* This library is distributed in the hope that it will be useful,               *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of                *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the                 *
+* GNU Lesser General Public License for more details.                           *
+*                                                                               *
+* You should have received a copy of the GNU Lesser General Public License      *
+* along with this program.  If not, see <http://www.gnu.org/licenses/>          *
+********************************************************************************/
+#ifndef FXMAPPEDFILESTREAM_H
+#define FXMAPPEDFILESTREAM_H
+
+#ifndef FXSTREAM_H
+#include "FXStream.h"
+#endif
+
+namespace FX {
+
+
+/**
+* Memory mapped file stream, for loading only.
+* The whole file is mapped into memory, and the mapping itself serves as the
+* stream's buffer; thus, data is loaded straight from the file's pages, without
+* any system calls or copying through an intermediate buffer, and moving to another
+* position is free.
+* The file should not be truncated by another process while the stream is open.
+*/
+class FXAPI FXMappedFileStream : public FXStream {
+protected:
+  FXMappedFile map;
+protected:
+  virtual FXuval writeBuffer(FXuval count);
+  virtual FXuval readBuffer(FXuval count);
+private:
+  FXMappedFileStream(const FXMappedFileStream&);
+  FXMappedFileStream& operator=(const FXMappedFileStream&);
+public:
+
+  /// Create mapped file stream
+  FXMappedFileStream(const FXObject* cont=nullptr);
+
+  /// Create and open mapped file stream
+  FXMappedFileStream(const FXString& filename);
+
+  /**
+  * Open mapped file stream for loading; fails if the file can't be
+  * mapped, for example because it is empty.
+  */
+  FXbool open(const FXString& filename);
+
+  /// Close mapped file stream
+  virtual FXbool close();
+
+  /// Get position
+  FXlong position() const { return FXStream::position(); }
+
+  /// Move to position
+  virtual FXbool position(FXlong offset,FXWhence whence=FXFromStart);
+
+  /// Load single items from stream
+  FXMappedFileStream& operator>>(FXuchar& v){ FXStream::operator>>(v); return *this; }
+  FXMappedFileStream& operator>>(FXchar& v){ FXStream::operator>>(v); return *this; }
+  FXMappedFileStream& operator>>(FXbool& v){ FXStream::operator>>(v); return *this; }
+  FXMappedFileStream& operator>>(FXushort& v){ FXStream::operator>>(v); return *this; }
+  FXMappedFileStream& operator>>(FXshort& v){ FXStream::operator>>(v); return *this; }
+  FXMappedFileStream& operator>>(FXuint& v){ FXStream::operator>>(v); return *this; }
+  FXMappedFileStream& operator>>(FXint& v){ FXStream::operator>>(v); return *this; }
+  FXMappedFileStream& operator>>(FXfloat& v){ FXStream::operator>>(v); return *this; }
+  FXMappedFileStream& operator>>(FXdouble& v){ FXStream::operator>>(v); return *this; }
+  FXMappedFileStream& operator>>(FXlong& v){ FXStream::operator>>(v); return *this; }
+  FXMappedFileStream& operator>>(FXulong& v){ FXStream::operator>>(v); return *this; }
+
+  /// Load arrays of items from stream
+  FXMappedFileStream& load(FXuchar* p,FXuval n){ FXStream::load(p,n); return *this; }
+  FXMappedFileStream& load(FXchar* p,FXuval n){ FXStream::load(p,n); return *this; }
+  FXMappedFileStream& load(FXbool* p,FXuval n){ FXStream::load(p,n); return *this; }
+  FXMappedFileStream& load(FXushort* p,FXuval n){ FXStream::load(p,n); return *this; }
+  FXMappedFileStream& load(FXshort* p,FXuval n){ FXStream::load(p,n); return *this; }
+  FXMappedFileStream& load(FXuint* p,FXuval n){ FXStream::load(p,n); return *this; }
+  FXMappedFileStream& load(FXint* p,FXuval n){ FXStream::load(p,n); return *this; }
+  FXMappedFileStream& load(FXfloat* p,FXuval n){ FXStream::load(p,n); return *this; }
+  FXMappedFileStream& load(FXdouble* p,FXuval n){ FXStream::load(p,n); return *this; }
+  FXMappedFileStream& load(FXlong* p,FXuval n){ FXStream::load(p,n); return *this; }
+  FXMappedFileStream& load(FXulong* p,FXuval n){ FXStream::load(p,n); return *this; }
+
+  /// Load object
+  FXMappedFileStream& loadObject(FXObject*& v){ FXStream::loadObject(v); return *this; }
+
+  /// Load object
+  template<class TYPE>
+  FXMappedFileStream& operator>>(TYPE*& obj){ return loadObject(reinterpret_cast<FXObject*&>(obj)); }
+
+  /// Destructor
+  virtual ~FXMappedFileStream();
+  };
+
+}
+
+#endif
@@ -55,6 +55,9 @@ namespace FX {
 * by specialized applications (e.g. ControlPanel) or through installation scripts.
 * The Rregistry is automatically read when FXApp::init() is called, and written
 * back to the system when FXApp::exit() is called.
+* To speed up startup, the merged settings are saved in a binary snapshot next to
+* the per-user application settings file, and loaded from there instead of parsing
+* the settings files, as long as none of these files has changed since.
 */
 class FXAPI FXRegistry : public FXSettings {
 protected:
@@ -63,7 +66,12 @@ protected:
   FXString systemdirs;      // System-wide settings directories
   FXString userdir;         // User settings directory
   FXbool   ascii;           // ASCII file-based registry
+  FXbool   snapshot;        // Use snapshot of settings
 protected:
+  FXbool readSnapshot(const FXString& cache,const FXString* files,const FXlong* stamps,FXint num);
+  FXbool writeSnapshot(const FXString& cache,const FXString* files,const FXlong* stamps,FXint num,const FXSettings& app) const;
+  FXbool updateSnapshot(const FXString& cache,const FXString* files,const FXlong* stamps,FXint num) const;
+  FXint settingsFiles(FXString* files,FXString& cache) const;
 #if defined(WIN32)
   FXbool readFromRegistry(FXptr hroot,FXbool mark=false);
   FXbool writeToRegistry(FXptr hroot);
@@ -90,6 +98,16 @@ public:
   /// Get ASCII mode
   FXbool getAsciiMode() const { return ascii; }
 
+  /**
+  * Set snapshot mode; if set, the settings read from ASCII settings files are
+  * saved in a binary snapshot, from which they're loaded again next time, as long
+  * as the settings files are unchanged.  The default is to use a snapshot.
+  */
+  void setSnapshotMode(FXbool snapshotMode){ snapshot=snapshotMode; }
+
+  /// Get snapshot mode
+  FXbool getSnapshotMode() const { return snapshot; }
+
   /// Change application key name
   void setAppKey(const FXString& name){ applicationkey=name; }
 
@@ -126,6 +144,9 @@ public:
   /// File name of common settings file
   static const FXchar foxrc[];
 
+  /// File extension for snapshot of settings
+  static const FXchar snapshotext[];
+
   /// Destructor
   virtual ~FXRegistry();
   };
@@ -23,6 +23,32 @@
 
 namespace FX {
 
+struct FXAnalysis;
+
+
+/**
+* FXRexInput delivers a subject string to FXRex in pieces, such as the two halves
+* of a gap buffer, windows of a memory mapped file, or blocks read from a stream.
+* FXRex asks for the piece containing a given position; positions are asked for in
+* increasing order, starting with the one before the position where matching starts,
+* so pieces wholly before the requested position may be discarded by the time the
+* next piece is asked for.  Each piece must remain valid until the next one is asked
+* for, or until the match is done.
+*/
+class FXAPI FXRexInput {
+public:
+
+  /**
+  * Return the piece of the subject string which contains position pos, and set beg
+  * and end to the positions of its first byte, and of the byte after its last one.
+  * Return NULL if pos is at or beyond the end of the subject string.
+  */
+  virtual const FXchar* fetch(FXint pos,FXint& beg,FXint& end)=0;
+
+  /// Destructor
+  virtual ~FXRexInput(){}
+  };
+
 
 /**
 * FXRex is a regular expression class implementing a NFA matcher.
@@ -59,14 +85,29 @@ namespace FX {
 * causes the begin and end of the subject string NOT to be considered a line start or
 * line end.
 *
-* Patterns which cause inordinate amounts of recursion may cause FXRex to fail where
-* otherwise it would succeed to match.
+* Patterns without back references, lookaround, atomic groups, possessive repeats,
+* or counted repeats of complex sub-patterns are matched by backtracking for only a
+* limited number of steps; if that does not settle the match, the pattern is matched
+* by simulating all alternatives in lock-step, which takes time proportional to the
+* length of the subject string times the size of the pattern, and needs no deep
+* recursion.  Both methods return the same matches and captures.  The match flag
+* Backtrack forces the backtracking matcher to be used.
+*
+* Such patterns may also be matched incrementally against a subject string delivered
+* in pieces by an FXRexInput, in one forward pass, without ever needing more than the
+* current piece and the byte before it.  Other patterns, and backward searches, first
+* gather the whole subject string from the input.
+*
+* Other patterns which cause inordinate amounts of recursion may cause FXRex to fail
+* where otherwise it would succeed to match.
 * FXRex uses no global variables, and thus multiple threads may simultaneously use it;
 * moreover, multiple threads may use the same instance to perform a match.
 */
 class FXAPI FXRex {
+  friend class FXRexSet;
 private:
-  FXString code;
+  FXString code;                // Compiled program
+  FXAnalysis *info;             // Analysis of compiled program
 private:
   static const FXchar *const errors[];
 public:
@@ -91,7 +132,8 @@ public:
 
     /// Regular expression match flags
     NotBol     = 1024,  /// Start of string is NOT begin of line
-    NotEol     = 2048   /// End of string is NOT end of line
+    NotEol     = 2048,  /// End of string is NOT end of line
+    Backtrack  = 4096   /// Always use the backtracking matcher
     };
 
   /// Regular expression error codes
@@ -173,6 +215,37 @@ public:
   FXint search(const FXchar* string,FXint len,FXint fm,FXint to,FXint mode=Normal,FXint* beg=nullptr,FXint* end=nullptr,FXint npar=0) const;
   FXint search(const FXString& string,FXint fm,FXint to,FXint mode=Normal,FXint* beg=nullptr,FXint* end=nullptr,FXint npar=0) const;
 
+  /**
+  * Return true if the pattern can be matched incrementally against a subject string
+  * delivered in pieces by an FXRexInput, without gathering the pieces first.
+  */
+  FXbool incremental() const;
+
+  /**
+  * Perform anchored match at position pos of a subject string delivered in pieces
+  * by input, returning true if the pattern matches at this point.
+  * Captures are returned in beg[] and end[] as with the other amatch().
+  */
+  FXbool amatch(FXRexInput& input,FXint pos=0,FXint mode=Normal,FXint* beg=nullptr,FXint* end=nullptr,FXint npar=0) const;
+
+  /**
+  * Search a subject string delivered in pieces by input for a pattern, returning
+  * the location where the pattern is found, or -1 if there is no match.
+  * The string is searched forwards (or backwards) starting from position fm toward to;
+  * as the length of the string needn't be known in advance, to may lie beyond its end,
+  * so that for instance passing 2147483647 searches a stream up to its end.
+  */
+  FXint search(FXRexInput& input,FXint fm,FXint to,FXint mode=Normal,FXint* beg=nullptr,FXint* end=nullptr,FXint npar=0) const;
+
+  /**
+  * Compute the set of bytes with which a match could start, as a 256-bit
+  * set of 32 bytes.  The set is conservative: a byte may be in the set even
+  * if no match starts with it, but no match starts with a byte not in the set.
+  * If the pattern may match the empty string, all bytes are in the set.
+  * This is useful to quickly rule out positions where the pattern can't match.
+  */
+  void firstSet(FXuchar set[]) const;
+
   /**
   * After performing a regular expression match with capturing parentheses,
   * a substitution string is build from the replace string, where where "&"
@@ -0,0 +1,132 @@
+/********************************************************************************
+*                                                                               *
+*          R e g u l a r   E x p r e s s i o n   C a c h e   C l a s s          *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+*********************************************************************************
+* This library is free software; you can redistribute it and/or modify          *
+* it under the terms of the GNU Lesser General Public License as published by   *
+* the Free Software Foundation; either version 3 of the License, or             *
+* (at your option) any later version.                                           *
+*                                                                               *
+* This library is distributed in the hope that it will be useful,               *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of                *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the                 *
+* GNU Lesser General Public License for more details.                           *
+*                                                                               *
+* You should have received a copy of the GNU Lesser General Public License      *
+* along with this program.  If not, see <http://www.gnu.org/licenses/>          *
+********************************************************************************/
+#ifndef FXREXCACHE_H
+#define FXREXCACHE_H
+
+namespace FX {
+
+
+/**
+* FXRexCache keeps the most recently used compiled regular expressions, so that
+* searching repeatedly with the same pattern, like find-next or replace-all do,
+* parses the pattern only once.  Patterns are looked up by the pattern string as
+* well as the parse mode; failed parses are remembered too.
+* When the cache is full, the least recently used pattern is dropped to make
+* room for a new one.
+* The compiled patterns are handed out by reference counted pointer, without
+* copying them; since a compiled pattern is never changed, it may be shared by
+* any number of threads, and remains valid for as long as it's referenced, even
+* after it has been dropped from the cache.
+* The cache may be used by multiple threads at the same time; a shared instance is
+* available through FXRexCache::instance().
+*/
+class FXAPI FXRexCache {
+public:
+
+  /// Compiled pattern, shared by the cache and the callers of get()
+  class FXAPI Pattern {
+    friend class FXRexCache;
+  private:
+    FXRex          rex;         // Compiled pattern
+    FXRex::Error   err;         // Result of parse
+    volatile FXint refs;        // Reference count
+  private:
+    Pattern(const FXchar* pattern,FXint mode);
+    Pattern(const Pattern&);
+    Pattern &operator=(const Pattern&);
+   ~Pattern();
+  public:
+
+    /// Return compiled pattern
+    const FXRex& getRex() const { return rex; }
+
+    /// Return error code of the parse
+    FXRex::Error getError() const { return err; }
+
+    /// Add a reference
+    void ref();
+
+    /// Drop a reference; the pattern is deleted when the last one is dropped
+    void unref();
+    };
+
+private:
+  struct Entry {
+    FXString          key;      // Parse mode and pattern
+    FXRefPtr<Pattern> pattern;  // Compiled pattern
+    FXint             prev;     // More recently used entry, or -1
+    FXint             next;     // Less recently used entry, or -1
+    };
+private:
+  FXArray<Entry> entries;       // Cached patterns
+  FXDictionary   index;         // Maps key to entry+1
+  FXMutex        mutex;         // Serialize access
+  FXint          head;          // Most recently used entry
+  FXint          tail;          // Least recently used entry
+  FXint          limit;         // Maximum number of entries
+  FXuint         hits;          // Number of lookups found in cache
+  FXuint         misses;        // Number of lookups which had to parse
+private:
+  void unlink(FXint e);
+  void link(FXint e);
+private:
+  FXRexCache(const FXRexCache&);
+  FXRexCache &operator=(const FXRexCache&);
+public:
+
+  /// Construct cache holding at most size patterns
+  FXRexCache(FXint size=64);
+
+  /**
+  * Return pattern compiled with the given parse mode, parsing it only if it is not
+  * in the cache yet; the error code of the parse is kept with the pattern.
+  */
+  FXRefPtr<Pattern> get(const FXchar* pattern,FXint mode=FXRex::Normal);
+  FXRefPtr<Pattern> get(const FXString& pattern,FXint mode=FXRex::Normal);
+
+  /// Change maximum number of patterns kept; drops all patterns
+  void setSize(FXint size);
+
+  /// Return maximum number of patterns kept
+  FXint getSize() const { return limit; }
+
+  /// Return number of patterns in the cache
+  FXint no() const { return (FXint)entries.no(); }
+
+  /// Return number of lookups which found the pattern in the cache
+  FXuint getHits() const { return hits; }
+
+  /// Return number of lookups which had to parse the pattern
+  FXuint getMisses() const { return misses; }
+
+  /// Drop all patterns
+  void clear();
+
+  /// Return cache shared by the whole program
+  static FXRexCache& instance();
+
+  /// Destroy cache
+ ~FXRexCache();
+  };
+
+}
+
+#endif
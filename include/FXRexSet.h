@@ -0,0 +1,109 @@
+/********************************************************************************
+*                                                                               *
+*             R e g u l a r   E x p r e s s i o n   S e t   C l a s s           *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+*********************************************************************************
+* This library is free software; you can redistribute it and/or modify          *
+* it under the terms of the GNU Lesser General Public License as published by   *
+* the Free Software Foundation; either version 3 of the License, or             *
+* (at your option) any later version.                                           *
+*                                                                               *
+* This library is distributed in the hope that it will be useful,               *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of                *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the                 *
+* GNU Lesser General Public License for more details.                           *
+*                                                                               *
+* You should have received a copy of the GNU Lesser General Public License      *
+* along with this program.  If not, see <http://www.gnu.org/licenses/>          *
+********************************************************************************/
+#ifndef FXREXSET_H
+#define FXREXSET_H
+
+namespace FX {
+
+
+/**
+* FXRexSet is a set of regular expressions which are searched for together.
+* Patterns are added with the same syntax and parse flags as FXRex, and are
+* numbered in the order in which they were added.
+* Patterns which can be simulated in lock-step, i.e. those without back
+* references, lookaround, atomic groups, possessive repeats, or counted repeats
+* of complex sub-patterns, are searched for all at once, in a single pass over the
+* subject string, regardless of their number; the remaining patterns are searched
+* for one after the other.
+* The set may be searched for the first match of any pattern, or for the first
+* match of each pattern; either way, the matches found are the same as those
+* found by FXRex::search() for the individual patterns.
+* Like FXRex, multiple threads may search using the same FXRexSet.
+*/
+class FXAPI FXRexSet {
+private:
+  FXArray<FXRex>   rex;         // Patterns
+  FXArray<FXint>   entry;       // Start of each program in code, and end of the last
+  FXArray<FXint>   which;       // Pattern of each program in code
+  FXArray<FXint>   rest;        // Patterns searched for one by one
+  FXArray<FXint>   start[257];  // Programs which may start with each byte, or match anything
+  FXString         code;        // Programs of patterns searched for together
+public:
+
+  /// Construct empty set of patterns
+  FXRexSet();
+
+  /// Copy set of patterns
+  FXRexSet(const FXRexSet& orig);
+
+  /// Return number of patterns
+  FXint no() const { return (FXint)rex.no(); }
+
+  /// Return true if set is empty
+  FXbool empty() const { return rex.no()==0; }
+
+  /// Return pattern i
+  const FXRex& at(FXint i) const { return rex[i]; }
+
+  /// Return pattern i
+  const FXRex& operator[](FXint i) const { return rex[i]; }
+
+  /**
+  * Parse pattern, and append it to the set; return error code if a
+  * syntax error is found, in which case the set is left unchanged.
+  * If successful, the pattern is numbered no()-1.
+  */
+  FXRex::Error append(const FXchar* pattern,FXint mode=FXRex::Normal);
+  FXRex::Error append(const FXString& pattern,FXint mode=FXRex::Normal);
+
+  /**
+  * Search subject string of length len for the first match of any pattern, and
+  * return the number of the pattern which matched, or -1 if none did.
+  * The string is searched forwards (or backwards) starting from position fm toward to;
+  * of the matches starting closest to fm, that of the lowest numbered pattern is
+  * returned, and its location is returned in beg and end.
+  */
+  FXint search(const FXchar* string,FXint len,FXint fm,FXint to,FXint mode=FXRex::Normal,FXint* beg=nullptr,FXint* end=nullptr) const;
+  FXint search(const FXString& string,FXint fm,FXint to,FXint mode=FXRex::Normal,FXint* beg=nullptr,FXint* end=nullptr) const;
+
+  /**
+  * Search subject string of length len for the first match of each pattern, and
+  * return the number of patterns which matched.
+  * The location of the match of pattern i is returned in beg[i] and end[i], which are
+  * set to -1 if pattern i didn't match; both arrays must be at least no() entries long.
+  * The string is searched forwards (or backwards) starting from position fm toward to.
+  */
+  FXint searchAll(const FXchar* string,FXint len,FXint fm,FXint to,FXint mode,FXint* beg,FXint* end) const;
+  FXint searchAll(const FXString& string,FXint fm,FXint to,FXint mode,FXint* beg,FXint* end) const;
+
+  /// Assign another set of patterns to this one
+  FXRexSet& operator=(const FXRexSet& orig);
+
+  /// Remove all patterns
+  void clear();
+
+  /// Delete
+ ~FXRexSet();
+  };
+
+}
+
+#endif
@@ -150,7 +150,11 @@ public:
   FXint writeFormatEntry(const FXString& section,const FXchar* name,const FXchar* fmt,...) FX_PRINTF(4,5) ;
   FXint writeFormatEntry(const FXString& section,const FXString& name,const FXchar* fmt,...) FX_PRINTF(4,5) ;
 
-  /// Read a string registry entry; if no value is found, the default value def is returned
+  /**
+  * Read a string registry entry; if no value is found, the default value def is returned.
+  * The returned text remains valid until the entry is changed or removed, or the
+  * section or settings are cleared; copy it into an FXString to keep it longer.
+  */
   const FXchar* readStringEntry(const FXchar* section,const FXchar* name,const FXchar* def=nullptr) const;
   const FXchar* readStringEntry(const FXString& section,const FXchar* name,const FXchar* def=nullptr) const;
   const FXchar* readStringEntry(const FXString& section,const FXString& name,const FXchar* def=nullptr) const;
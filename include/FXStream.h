@@ -106,6 +106,23 @@ protected:
   */
   virtual FXuval readBuffer(FXuval count);
 
+  /**
+  * Write count bytes directly from data to the device, bypassing the
+  * buffer, which is empty; returns number of bytes written, or 0 if
+  * this is not possible.
+  */
+  virtual FXuval writeBlock(const FXuchar* data,FXuval count);
+
+  /**
+  * Read up to count bytes directly from the device into data, bypassing
+  * the buffer, which is empty; returns number of bytes read, or 0 if
+  * this is not possible.
+  */
+  virtual FXuval readBlock(FXuchar* data,FXuval count);
+
+private:
+  FXStream& saveSwapped(const FXuchar* p,FXuval n,FXuval sz);
+  FXStream& loadSwapped(FXuchar* p,FXuval n,FXuval sz);
 private:
   FXStream(const FXStream&);
   FXStream &operator=(const FXStream&);
@@ -29,19 +29,34 @@ class FXStream;
 
 /**
 * FXString provides essential string manipulation capabilities in FOX.
-* Internally, all strings are stored as an array of bytes preceeded by
-* the length of the string; an end-of-string character is appended at the end,
-* but is not included in the length of the string.
-* An empty string is represented by unique empty-string value which comprises
-* a length of 0, followed by an end-of-string character.
-* Thus, it is ALWAYS safe to dereference FXString as it will never be NULL.
+* Short strings, up to SHORTLEN bytes, are stored inside the FXString object
+* itself, with the length of the string in its last byte; longer strings are
+* stored in an array of bytes allocated on the heap, preceeded by the capacity
+* and the length of the string.  Either way, an end-of-string character is
+* appended at the end, but is not included in the length of the string.
+* Long strings grow their capacity geometrically, so that building a string by
+* repeatedly appending to it takes linear time; reserve() may be used to make
+* room ahead of time, and shrink() to release any room left over.
+* An empty string is a short string of length 0, and so the text of a string
+* may ALWAYS be dereferenced as it will never be NULL.
+* Note that moving a short string moves its text as well, so a pointer to the
+* text of a string remains valid only while the string stays put.
 * FXString can be initialized direcly from literal strings in UTF-8 encoding,
 * but supports automatic conversion from UTF-16 encoded ("narrow") character
 * strings and UTF-32 encoded ("wide") character strings.
 */
 class FXAPI FXString {
+public:
+  enum {
+    SHORTLEN=3*sizeof(FXchar*)-2        /// Longest string stored inside the object
+    };
 private:
-  FXchar* str;
+  union {
+    FXchar* ptr;                        // Long string, preceeded by length
+    FXchar  buf[SHORTLEN+2];            // Short string, length in last byte
+    FXchar* rep[3];                     // Representation
+    };
+  FXbool isShort() const { return (FXuchar)buf[SHORTLEN+1]<=SHORTLEN; }
 public:
   static const FXchar null[];
 public:
@@ -52,6 +67,9 @@ public:
   /// Construct copy of another string
   FXString(const FXString& s);
 
+  /// Construct by taking over another string, leaving it empty
+  FXString(FXString&& s);
+
   /// Construct and init from string
   FXString(const FXchar* s);
 
@@ -74,11 +92,25 @@ public:
   FXString(FXchar c,FXint n);
 
   /// Length of text in bytes
-  FXint length() const { return *(((FXint*)str)-1); }
+  FXint length() const { return isShort() ? (FXuchar)buf[SHORTLEN+1] : ((const FXint*)ptr)[-1]; }
 
   /// Change the length of the string to len
   FXbool length(FXint len);
 
+  /// Return number of bytes the string can hold without reallocating
+  FXint capacity() const { return isShort() ? (FXint)SHORTLEN : ((const FXint*)ptr)[-2]; }
+
+  /**
+  * Make room for at least n bytes, so that the string may grow to length n
+  * without being reallocated; the contents of the string are unchanged.
+  * The room is kept when the string gets shorter, until shrink() is called.
+  * Return false if out of memory.
+  */
+  FXbool reserve(FXint n);
+
+  /// Release unused capacity, including reserved room; return false if out of memory
+  FXbool shrink();
+
   /// Return wide character starting at p
   FXwchar wc(FXint p) const;
 
@@ -116,40 +148,40 @@ public:
   FXint validate(FXint p) const;
 
   /// Get text contents as pointer
-  FXchar* text(){ return str; }
+  FXchar* text(){ return isShort() ? buf : ptr; }
 
   /// Get text contents as const pointer
-  const FXchar* text() const { return str; }
+  const FXchar* text() const { return isShort() ? buf : ptr; }
 
   /// See if string is empty
-  FXbool empty() const { return (((FXint*)str)[-1]==0); }
+  FXbool empty() const { return length()==0; }
 
   /// See if string is empty
-  FXbool operator!() const { return (((FXint*)str)[-1]==0); }
+  FXbool operator!() const { return length()==0; }
 
   /// Return a non-const reference to the ith character
-  FXchar& operator[](FXint i){ return str[i]; }
+  FXchar& operator[](FXint i){ return text()[i]; }
 
   /// Return a const reference to the ith character
-  const FXchar& operator[](FXint i) const { return str[i]; }
+  const FXchar& operator[](FXint i) const { return text()[i]; }
 
   /// Return a non-const reference to the ith character
-  FXchar& at(FXint i){ return str[i]; }
+  FXchar& at(FXint i){ return text()[i]; }
 
   /// Return a const reference to the ith character
-  const FXchar& at(FXint i) const { return str[i]; }
+  const FXchar& at(FXint i) const { return text()[i]; }
 
   /// Return a non-const reference to the first character
-  FXchar& head(){ return str[0]; }
+  FXchar& head(){ return text()[0]; }
 
   /// Return a const reference to the first character
-  const FXchar& head() const { return str[0]; }
+  const FXchar& head() const { return text()[0]; }
 
   /// Return a non-const reference to the last character
-  FXchar& tail(){ return str[length()-1]; }
+  FXchar& tail(){ return text()[length()-1]; }
 
   /// Return a const reference to the last character
-  const FXchar& tail() const { return str[length()-1]; }
+  const FXchar& tail() const { return text()[length()-1]; }
 
   /// Assign a constant string to this string
   FXString& operator=(const FXchar* s);
@@ -163,6 +195,9 @@ public:
   /// Assign another string to this string
   FXString& operator=(const FXString& s);
 
+  /// Take over another string, leaving it empty
+  FXString& operator=(FXString&& s);
+
   /// Append single character to this string
   FXString& operator+=(FXchar c);
 
@@ -542,10 +577,16 @@ public:
   /// Convert from unsigned long integer
   FXString& fromULong(FXulong number,FXint base=10);
 
-  /// Convert from float; fmt is 0 (no exponent), 1 (force exponent), or 2 (exponent when needed)
+  /**
+  * Convert from float; fmt is 0 (no exponent), 1 (force exponent), or 2 (exponent when needed).
+  * A negative precision yields the fewest digits which convert back to the same float.
+  */
   FXString& fromFloat(FXfloat number,FXint prec=6,FXint fmt=2);
 
-  /// Convert from double; fmt is 0 (no exponent), 1 (force exponent), or 2 (exponent when needed)
+  /**
+  * Convert from double; fmt is 0 (no exponent), 1 (force exponent), or 2 (exponent when needed).
+  * A negative precision yields the fewest digits which convert back to the same double.
+  */
   FXString& fromDouble(FXdouble number,FXint prec=6,FXint fmt=2);
 
   /**
@@ -565,7 +606,8 @@ public:
   /**
   * Return a string value by converting real number to a string, using the given
   * procision and exponential notation mode, which may be 0 (never), 1 (always),
-  * or 2 (when needed).
+  * or 2 (when needed).  A negative precision yields the fewest digits which
+  * convert back to the same number.
   */
   static FXString value(FXfloat num,FXint prec=6,FXint fmt=2);
   static FXString value(FXdouble num,FXint prec=6,FXint fmt=2);
@@ -726,7 +768,10 @@ public:
 
 /// Swap two strings
 inline FXString& swap(FXString& dst,FXString& src){
-  FXchar* t=dst.str; dst.str=src.str; src.str=t;
+  FXchar* t;
+  t=dst.rep[0]; dst.rep[0]=src.rep[0]; src.rep[0]=t;
+  t=dst.rep[1]; dst.rep[1]=src.rep[1]; src.rep[1]=t;
+  t=dst.rep[2]; dst.rep[2]=src.rep[2]; src.rep[2]=t;
   return dst;
   }
 
@@ -211,6 +211,8 @@ class FXAPI FXUndoList : public FXCommandGroup {
   FXDECLARE(FXUndoList)
 private:
   FXuval         space;         // Total memory in the undo commands
+  FXuval         maxsize;       // Trim when memory exceeds this size
+  FXuval         keepsize;      // Trim down to this size
   FXint          undocount;     // Number of undo records
   FXint          redocount;     // Number of redo records
   FXint          marker;        // Marker value
@@ -220,6 +222,7 @@ private:
 private:
   FXUndoList(const FXUndoList&);
   FXUndoList &operator=(const FXUndoList&);
+  void trim(FXuval sz,FXint nc);
 public:
   long onCmdUndo(FXObject*,FXSelector,void*);
   long onUpdUndo(FXObject*,FXSelector,void*);
@@ -394,6 +397,27 @@ public:
   */
   void trimSize(FXuval sz);
 
+  /**
+  * Set memory budget for the undo list.  When adding a command causes
+  * the total memory used to exceed the maximum size, the oldest commands
+  * are trimmed until no more than the keep size remains, except that the
+  * most recent command is always kept.
+  * The default maximum size is unlimited.
+  */
+  void setMaxSize(FXuval sz){ maxsize=sz; }
+
+  /// Return memory budget for the undo list
+  FXuval getMaxSize() const { return maxsize; }
+
+  /**
+  * Set size to trim the undo list down to, when the memory
+  * budget is exceeded.
+  */
+  void setKeepSize(FXuval sz){ keepsize=sz; }
+
+  /// Return size to trim undo list down to
+  FXuval getKeepSize() const { return keepsize; }
+
   /**
   * Trim undo list down, starting from the oldest commands,
   * until reaching the marked ("clean" state) point.
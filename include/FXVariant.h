@@ -63,7 +63,7 @@ private:
     FXlong   i;         // Signed integral types
     FXulong  u;         // Unsigned integral types
     FXdouble d;         // Floating point types
-    FXchar*  s;         // Character string
+    FXptr    s[3];      // Character string
     FXptr    p;         // Pointer types
     };
 private:
@@ -79,6 +79,9 @@ public:
   /// Copy constructor
   FXVariant(const FXVariant& other);
 
+  /// Move constructor; the other variant becomes null
+  FXVariant(FXVariant&& other);
+
   /// Construct and initialize with bool
   explicit FXVariant(FXbool val);
 
@@ -196,7 +199,7 @@ public:
   /// Convert to double
   FXdouble toDouble(FXbool* ok=nullptr) const;
 
-  /// Convert to char pointer
+  /// Convert to char pointer; valid only while the variant is neither changed nor moved
   const FXchar* toChars() const;
 
   /// Convert to string
@@ -277,6 +280,9 @@ public:
   /// Assign with variant
   FXVariant& operator=(const FXVariant& val);
 
+  /// Take over variant; the other variant becomes null
+  FXVariant& operator=(FXVariant&& val);
+
   /// Assign with variant
   FXVariant& assign(const FXVariant& other);
 
@@ -351,8 +357,10 @@ public:
   /// Return the value of the variant as a double; variant type MUST be DoubleType
   const FXdouble& asDouble() const { return value.d; }
 
-  /// Return the value of the variant as a char pointer; variant type MUST be StringType
-  const FXchar* asChars() const { return value.s; }
+  /// Return the value of the variant as a char pointer; variant type MUST be StringType.
+  /// Short strings are stored in-place, so the pointer is only valid while the variant is
+  /// neither changed nor moved (e.g. when the array or map holding it is resized)
+  const FXchar* asChars() const { return asString().text(); }
 
   /// Return the value of the variant as a string-reference; variant type MUST be StringType
   FXString& asString(){ return *reinterpret_cast<FXString*>(&value.p); }
@@ -21,6 +21,9 @@
 #ifndef FXXML_H
 #define FXXML_H
 
+#ifndef FXARRAY_H
+#include "FXArray.h"
+#endif
 #ifndef FXPARSEBUFFER_H
 #include "FXParseBuffer.h"
 #endif
@@ -30,6 +33,12 @@ namespace FX {
 
 /**
 * The XML serializer loads or saves data to xml text file.
+* While parsing, the document is reported through callbacks.  The startElementCB,
+* charactersCB, and endElementCB callbacks receive fully decoded strings, and a
+* dictionary of decoded attributes.  For large documents, the low-level callbacks
+* startTagCB, textCB, and endTagCB may be connected instead; these are passed spans
+* of raw characters, which remain valid only for the duration of the callback,
+* and which are decoded only if and when the application calls decode() on them.
 */
 class FXAPI FXXML : public FXParseBuffer {
 public:
@@ -61,22 +70,42 @@ public:
     UTF32LE = 4,        /// Little endian  UTF32 encoded
     UTF32BE = 5         /// Big endian UTF32 encoded
     };
+public:
+
+  /// Run of characters, not yet decoded
+  struct Span {
+    const FXchar* text;         /// Start of characters
+    FXint         length;       /// Number of characters
+    FXuint        flags;        /// Decoding needed, if any (CRLF, REFS)
+    };
+
+  /// Attribute of start tag
+  struct Attribute {
+    Span          name;         /// Attribute name
+    Span          value;        /// Attribute value, not yet decoded
+    };
 protected:
   class Element;        // Element info
 protected:
-  FXlong     offset;    // Position from start
-  Element   *current;   // Current element instance
-  FXint      column;    // Column number
-  FXint      line;      // Line number
-  FXString   vers;      // Version
-  FXuint     enc;       // Encoding
+  FXArray<FXchar>    store;     // Tag names of open elements, and attributes of last start tag
+  FXArray<Attribute> atts;      // Attributes of last start tag
+  FXlong             offset;    // Position from start
+  Element           *current;   // Current element instance
+  FXint              used;      // Characters used in store
+  FXint              natts;     // Number of attributes of last start tag
+  FXint              column;    // Column number
+  FXint              line;      // Line number
+  FXString           vers;      // Version
+  FXuint             enc;       // Encoding
 private:
   FXuint guess();
   void spaces();
   FXbool name();
   FXbool match(FXchar ch);
   FXbool match(const FXchar* str,FXint len);
+  void keep(const FXchar* str,FXint len);
   Error parsestring(FXString& str);
+  Error parsevalue(Span& value);
   Error parsexml();
   Error parseversion();
   Error parseencoding();
@@ -87,12 +116,15 @@ private:
   Error parsedeclarations();
   Error parseprocessing();
   Error parsecomment();
-  Error parseattribute(Element& elm);
+  Error parseattribute();
   Error parsestarttag(Element& elm);
   Error parseendtag(Element& elm);
   Error parsecdata(Element& elm);
   Error parsecontents(Element& elm);
   Error parseelement();
+  Error reportstarttag(Element& elm);
+  Error reporttext(FXString& str,const FXchar* text,FXint len,FXuint flags);
+  Error reportendtag(Element& elm);
 private:
   static const FXchar *const errors[];
 private:
@@ -121,6 +153,25 @@ public:
   /// Called when end of document is recognized.
   FXCallback<Error () > endDocumentCB;
 
+  /**
+  * Called when start of element is recognized, in place of startElementCB.
+  * Passed the tag name, and the attributes in document order; the attribute
+  * values are not decoded.
+  */
+  FXCallback<Error (const Span&,const Attribute*,FXint) > startTagCB;
+
+  /**
+  * Called to pass batch of characters, in place of charactersCB.
+  * The characters are not decoded; empty batches are not reported.
+  */
+  FXCallback<Error (const Span&) > textCB;
+
+  /**
+  * Called when end of element is recognized, in place of endElementCB.
+  * Passed the tag name.
+  */
+  FXCallback<Error (const Span&) > endTagCB;
+
 public:
 
   /**
@@ -207,6 +258,13 @@ public:
   * Decode escaped special characters from XML stream.
   */
   static FXbool decode(FXString& dst,const FXString& src,FXuint flags=CRLF|REFS);
+  static FXbool decode(FXString& dst,const FXchar* src,FXint len,FXuint flags=CRLF|REFS);
+
+  /**
+  * Decode span of characters passed to startTagCB or textCB; return false
+  * if it contains a malformed or unknown character reference.
+  */
+  static FXbool decode(FXString& dst,const Span& span){ return decode(dst,span.text,span.length,span.flags); }
 
   /**
   * Encode special characters for inclusion into XML stream.
@@ -33,7 +33,8 @@ namespace FX {
 */
 class FXAPI FXXMLFile : public FXXML {
 private:
-  FXFile file;
+  FXFile       file;
+  FXMappedFile map;
 private:
   FXXMLFile(const FXXMLFile&);
   FXXMLFile& operator=(const FXXMLFile&);
@@ -51,6 +52,9 @@ public:
 
   /**
   * Open XML file for direction d.
+  * When loading a file larger than the buffer size sz, the whole file is
+  * mapped into memory, if possible, and parsed in place rather than being
+  * read into the buffer piece by piece.
   */
   FXbool open(const FXString& filename,Direction d=Load,FXuval sz=4096);
 
@@ -92,6 +92,7 @@
 #include "FXMappedFile.h"
 #include "FXFileStream.h"
 #include "FXMemoryStream.h"
+#include "FXMappedFileStream.h"
 #include "FXProcess.h"
 #include "FXString.h"
 #include "FXVariant.h"
@@ -292,6 +293,8 @@
 #include "FXFontDialog.h"
 #include "FXUndoList.h"
 #include "FXRex.h"
+#include "FXRexSet.h"
+#include "FXRexCache.h"
 #include "FXExpression.h"
 #include "FXText.h"
 #include "FXDataTarget.h"
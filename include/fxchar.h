@@ -281,7 +281,7 @@ extern FXAPI FXival ncs2utf(const FXnchar* src,FXival srclen);
 extern FXAPI FXival ncs2utf(const FXnchar* src);
 
 /// Return number of wide characters for utf8 character string
-extern FXAPI FXival utf2wcs(const FXchar src,FXival srclen);
+extern FXAPI FXival utf2wcs(const FXchar *src,FXival srclen);
 extern FXAPI FXival utf2wcs(const FXchar *src);
 
 /// Return number of narrow characters for utf8 character string
@@ -54,7 +54,8 @@ enum {
   CPU_HAS_AVX512CD  = 0x1000000,
   CPU_HAS_AVX512BW  = 0x2000000,
   CPU_HAS_AVX512VL  = 0x4000000,
-  CPU_HAS_AVX512VBMI= 0x8000000
+  CPU_HAS_AVX512VBMI= 0x8000000,
+  CPU_HAS_PCLMUL    = 0x10000000
   };
 
 
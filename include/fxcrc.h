@@ -43,12 +43,12 @@ extern FXAPI const FXuint crctab[256];
 *
 *  3) Complement with: crc^=~0; (xor with 0xFFFFFFFF).
 *
-* Faster versions are possible; we'll have it soon.
+* Buffers are processed 16 bytes at a time using slicing tables, or
+* on x86 CPUs with the "carry-less" multiply instruction, by folding
+* 64 bytes at a time using that instruction.
 * And no, you can't use x86 CPU's built-in crc32 instruction;
 * it uses different polynomial P(x)=0x11EDC6F41 (the Castagnoli
-* polynomial). But x86 CPUs have "carry-less" multiply instruction,
-* which will make this code here a fallback option only useful
-* on non-x86 CPUs.
+* polynomial); see CRC32C below.
 */
 
 /// Calculate CRC32 of unsigned char
@@ -116,14 +116,49 @@ static inline FXuint CRC(FXuint crc,FXulong x){
 
 
 /// Calculate CRC32 of a array of unsigned chars
-static inline FXuint CRC(FXuint crc,const FXuchar *buf,FXival len){
-  const FXuchar* end=buf+len;
-  while(buf!=end){
-    crc=CRC(crc,*buf++);
-    }
-  return crc;
+extern FXAPI FXuint CRC(FXuint crc,const FXuchar *buf,FXival len);
+
+
+/**
+* Return checksum of buffer, i.e. with steps 1) and 3) included.
+* A checksum may be calculated incrementally, by passing the checksum
+* of the preceding data in crc.
+*/
+static inline FXuint checksum(const FXuchar *buf,FXival len,FXuint crc=0){
+  return ~CRC(~crc,buf,len);
   }
 
+
+/**
+* Given checksum crc1 of one piece of data, and checksum crc2 of
+* a second piece of data of len2 bytes, return the checksum of the
+* two pieces of data one after the other.  This allows pieces of data
+* to be checksummed in parallel.
+*/
+extern FXAPI FXuint combine(FXuint crc1,FXuint crc2,FXulong len2);
+
+}
+
+
+namespace CRC32C {
+
+/**
+* Calculate CRC32C using Castagnoli polynomial P(x) = 0x11EDC6F41
+* over GF(2), in the same manner as CRC32 above.
+* On x86 CPUs with SSE4.2, the CPU's built-in crc32 instruction is used.
+*/
+extern FXAPI FXuint CRC(FXuint crc,const FXuchar *buf,FXival len);
+
+
+/// Return checksum of buffer, continuing from checksum crc of preceding data
+static inline FXuint checksum(const FXuchar *buf,FXival len,FXuint crc=0){
+  return ~CRC(~crc,buf,len);
+  }
+
+
+/// Return checksum of two pieces of data, given their checksums
+extern FXAPI FXuint combine(FXuint crc1,FXuint crc2,FXulong len2);
+
 }
 
 }
@@ -28,6 +28,9 @@
 // Placement new
 #include <new>
 
+// Type traits
+#include <type_traits>
+
 
 // Path separator
 #ifdef WIN32
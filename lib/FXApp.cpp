@@ -4257,7 +4257,7 @@ void FXApp::init(int& argc,char** argv,FXbool connect){
   FXASSERT_STATIC(sizeof(FXdouble)==8);
   FXASSERT_STATIC(sizeof(FXival)==sizeof(void*));
   FXASSERT_STATIC(sizeof(FXuval)==sizeof(void*));
-  FXASSERT_STATIC(sizeof(FXString)==sizeof(void*));
+  FXASSERT_STATIC(sizeof(FXString)==3*sizeof(void*));
 
   // Check arguments
   if(argc<1 || argv==nullptr || argv[0]==nullptr){
@@ -26,8 +26,8 @@
 
 /*
   Notes:
-  - FXArrayBase manages the gory details of the buffer representation: an item count
-    followed by the items themselves.
+  - FXArrayBase manages the gory details of the buffer representation: the capacity and
+    item count, followed by the items themselves.
   - The chosen representation allows an empty array to take up very minimal space
     only; basically, just a pointer to the memory buffer.
   - The buffer pointer is never NULL; thus its always safe to reference the buffer
@@ -35,11 +35,20 @@
   - Alignment is assumed to be 8 for 64-bit systems and 4 for 32-bit systems, same
     as malloc() returns.
   - Note sizeof(FXival) == sizeof(FXptr).
+  - The capacity grows by half its size at a time, so that adding items one by one
+    takes amortized constant time.  Growing an empty array, or reserving room ahead
+    of time, allocates exactly the requested amount.
+  - The buffer is only shrunk when no more than a quarter of the capacity remains in
+    use, or by calling shrink(); shrinking never fails, as the old buffer may simply
+    be kept if the system declines to hand out a smaller one.
+  - The buffer is reallocated with realloc(), so items are moved around bit-wise; all
+    element types in FOX are expected to put up with that.  FXArray relies on this
+    as well, to insert and remove items in the middle without copying them.
 */
 
 
 // Special empty array value
-#define EMPTY  (const_cast<void*>((const void*)(__array__empty__+1)))
+#define EMPTY  (const_cast<void*>((const void*)(__array__empty__+2)))
 
 using namespace FX;
 
@@ -50,7 +59,7 @@ namespace FX {
 
 // Empty array value
 extern const FXival __array__empty__[];
-const FXival __array__empty__[2]={0,0};
+const FXival __array__empty__[3]={0,0,0};
 
 
 // Copying empty array uses same empty-array pointer regardless of
@@ -59,34 +68,70 @@ FXArrayBase::FXArrayBase():ptr(EMPTY){
   }
 
 
+// Change the capacity of the buffer to cap elements of size sz, keeping the item count
+static FXbool reallocate(FXptr& ptr,FXival cap,FXival sz){
+  FXptr p;
+  if(ptr!=EMPTY){
+    if(__unlikely((p=::realloc(((FXival*)ptr)-2,sizeof(FXival)*2+cap*sz))==nullptr)) return false;
+    }
+  else{
+    if(__unlikely((p=::malloc(sizeof(FXival)*2+cap*sz))==nullptr)) return false;
+    ((FXival*)p)[1]=0;
+    }
+  ptr=((FXival*)p)+2;
+  *(((FXival*)ptr)-2)=cap;
+  return true;
+  }
+
+
 // Resize the array to num elements of size sz; if size becomes zero,
 // substitute special empty-array pointer again which contains zero
 // elements of any type.
 FXbool FXArrayBase::resize(FXival num,FXival sz){
-  FXival old=*(((FXival*)ptr)-1);
-  if(__likely(old!=num)){
-    FXptr p;
-    if(0<num){
-      if(ptr!=EMPTY){
-        if(__unlikely((p=::realloc(((FXival*)ptr)-1,sizeof(FXival)+num*sz))==nullptr)) return false;
-        }
-      else{
-        if(__unlikely((p=::malloc(sizeof(FXival)+num*sz))==nullptr)) return false;
+  if(0<num){
+    FXival cap=*(((FXival*)ptr)-2);
+    if(cap<num){
+      if(0<cap && num<cap+(cap>>1)){
+        if(reallocate(ptr,cap+(cap>>1),sz)) goto x;
         }
-      ptr=((FXival*)p)+1;
-      *(((FXival*)ptr)-1)=num;
+      if(__unlikely(!reallocate(ptr,num,sz))) return false;
       }
-    else{
-      if(ptr!=EMPTY){
-        ::free(((FXival*)ptr)-1);
-        ptr=EMPTY;
-        }
+    else if(num<=(cap>>2)){
+      reallocate(ptr,num,sz);
+      }
+x:  *(((FXival*)ptr)-1)=num;
+    }
+  else{
+    if(ptr!=EMPTY){
+      ::free(((FXival*)ptr)-2);
+      ptr=EMPTY;
       }
     }
   return true;
   }
 
 
+// Reserve room for num elements of size sz, keeping the item count
+FXbool FXArrayBase::reserve(FXival num,FXival sz){
+  if(*(((FXival*)ptr)-2)<num){
+    return reallocate(ptr,num,sz);
+    }
+  return true;
+  }
+
+
+// Release room beyond the item count
+FXbool FXArrayBase::shrink(FXival sz){
+  FXival num=*(((FXival*)ptr)-1);
+  if(num<*(((FXival*)ptr)-2)){
+    if(0<num) return reallocate(ptr,num,sz);
+    ::free(((FXival*)ptr)-2);
+    ptr=EMPTY;
+    }
+  return true;
+  }
+
+
 // Destructor
 FXArrayBase::~FXArrayBase(){
   resize(0,0);
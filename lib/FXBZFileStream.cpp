@@ -27,6 +27,15 @@
 #include "FXStream.h"
 #include "FXString.h"
 #include "FXFile.h"
+#include "FXPtrList.h"
+#include "FXAtomic.h"
+#include "FXSemaphore.h"
+#include "FXCompletion.h"
+#include "FXRunnable.h"
+#include "FXAutoThreadStorageKey.h"
+#include "FXThread.h"
+#include "FXLFQueue.h"
+#include "FXThreadPool.h"
 #include "FXBZFileStream.h"
 
 #ifdef HAVE_BZ2LIB_H
@@ -37,6 +46,34 @@
   - Very basic compressed file I/O only.
   - Updated for new stream classes 2003/07/08.
   - Updated for use with FXFile 2005/09/03.
+  - When opened with a thread pool, saving splits the data into chunks of CHUNKSIZE
+    bytes, which are compressed concurrently by tasks on the thread pool, in the
+    manner of pbzip2; but rather than writing a series of bzip2 streams, which
+    readers stopping at the first end-of-stream wouldn't read completely, the
+    blocks are spliced into a single bzip2 stream, in the manner of lbzip2:
+
+      o Each chunk is compressed as a bzip2 stream of its own.  CHUNKSIZE is small
+        enough that, even after bzip2's initial run-length encoding, the chunk fits
+        in a single bzip2 block.
+
+      o A bzip2 block doesn't depend on anything before it, but it does start and
+        end at arbitrary bit positions; so the block is located in the compressed
+        stream by its end-of-stream marker, and its bits are appended after those
+        of the preceding block.
+
+      o The stream CRC is combined from the block CRCs, as bzip2 itself does.
+
+    The result is a single bzip2 stream, just like the one written otherwise.
+  - Up to MAXJOBS chunks are in flight; blocks are written in order by the
+    calling thread as they are completed, and it waits for the oldest one only
+    when they're all in flight.  If the thread pool won't accept a task, the
+    calling thread compresses the chunk itself.
+  - When opened with a thread pool, loading runs the decompression in tasks on
+    the thread pool, which fill a ring of NUMBUFFERS buffers ahead of the stream;
+    the stream copies data out of them as it needs it.
+  - Tasks never wait for the stream, so no stream ties up a worker thread while it
+    is open; and the stream waits for its tasks by means of FXThreadPool::waitFor(),
+    which runs queued tasks meanwhile.  See FXGZFileStream.cpp.
 */
 
 
@@ -44,6 +81,10 @@
 #define VERBOSITY     0         // For tracing in bzip library
 #define WORKFACTOR    0         // See bzip2 documentation
 #define BUFFERSIZE    8192      // Size of the buffer
+#define CHUNKSIZE     (BLOCKSIZE100K*80000-20)  // Size of chunks compressed concurrently
+#define MAXJOBS       64        // Maximum number of chunks in flight
+#define NUMBUFFERS    4         // Number of buffers decompressed ahead
+#define READSIZE      131072    // Size of buffers decompressed ahead
 
 
 /*******************************************************************************/
@@ -52,21 +93,356 @@
 namespace FX {
 
 
+// Chunk compressed by a task on the thread pool
+struct BZJob : public FXRunnable {
+  FXCompletion  done;           // Counted while chunk is compressed
+  FXuchar      *input;          // Uncompressed data
+  FXuchar      *output;         // Compressed data
+  FXuint        inlen;          // Length of uncompressed data
+  FXuint        outlen;         // Length of compressed data
+  FXuint        outcap;         // Capacity of output
+  FXuval        bits;           // Number of bits in block
+  FXuint        crc;            // CRC of block
+  FXbool        ok;             // Compressed successfully
+  BZJob():input(nullptr),output(nullptr),inlen(0),outlen(0),outcap(0),bits(0),crc(0),ok(false){ }
+  virtual FXint run();
+ ~BZJob(){ freeElms(input); freeElms(output); }
+  };
+
+
+// Chunks being compressed concurrently
+struct BZWriter {
+  FXThreadPool *pool;           // Thread pool compressing chunks
+  BZJob        *jobs;           // Ring of chunks
+  FXint         njobs;          // Number of chunks in ring
+  FXint         head;           // Oldest chunk not yet written
+  FXint         tail;           // Chunk being filled
+  FXint         pending;        // Chunks being compressed
+  FXuint        crc;            // Combined CRC of blocks written so far
+  FXuint        acc;            // Bits not yet written
+  FXint         nacc;           // Number of bits not yet written
+  FXbool        ok;             // No errors so far
+  BZWriter(FXThreadPool* p,FXint n):pool(p),jobs(new BZJob[n]),njobs(n),head(0),tail(0),pending(0),crc(0),acc(0),nacc(0),ok(true){ }
+ ~BZWriter(){ delete [] jobs; }
+  };
+
+
+// Decompression task, filling buffers ahead of the stream
+struct BZReader : public FXRunnable {
+  FXThreadPool *pool;                   // Thread pool decompressing ahead
+  bz_stream    *stream;                 // Decompression stream
+  char         *buffer;                 // Compressed data
+  FXFile       *file;                   // File being read
+  FXCompletion  busy;                   // Counted while task is filling buffers
+  FXuchar      *data[NUMBUFFERS];       // Decompressed data
+  FXuval        size[NUMBUFFERS];       // Amount of data in each buffer
+  FXint         put;                    // First buffer to be filled by task
+  FXint         todo;                   // Number of buffers to be filled by task
+  FXint         added;                  // Number of buffers filled by task
+  FXint         get;                    // Buffer being drained by stream
+  FXint         avail;                  // Filled buffers not yet drained
+  FXuval        pos;                    // Position in buffer being drained
+  FXbool        more;                   // Not yet at end of compressed data
+  BZReader():pool(nullptr),stream(nullptr),buffer(nullptr),file(nullptr),data{},size{},put(0),todo(0),added(0),get(0),avail(0),pos(0),more(true){ }
+  virtual FXint run();
+ ~BZReader(){ for(FXint i=0; i<NUMBUFFERS; ++i) freeElms(data[i]); }
+  };
+
+
 // Used during compression
 struct BZBlock {
   bz_stream stream;
   char      buffer[BUFFERSIZE];
+  BZWriter *writer;
+  BZReader *reader;
   };
 
 
+// Get n<=32 bits at bit position pos, most significant bit first
+static FXuint getBits(const FXuchar* ptr,FXuval pos,FXint n){
+  FXuval b=pos>>3;
+  FXint s=pos&7;
+  FXint m=(s+n+7)>>3;
+  FXulong v=0;
+  for(FXint i=0; i<m; ++i){ v=(v<<8)|ptr[b+i]; }
+  return (FXuint)((v>>((m<<3)-s-n))&((FXULONG(1)<<n)-1));
+  }
+
+
+// Compress chunk as a bzip2 stream, and locate its only block: the block starts
+// after the 32-bit stream header, and is followed by the 48-bit end-of-stream magic
+// number, the 32-bit stream CRC, which equals the block CRC, and zero padding
+FXint BZJob::run(){
+  bz_stream stream;
+  int bzerror=BZ_PARAM_ERROR;
+  memset(&stream,0,sizeof(stream));
+  ok=false;
+  outlen=0;
+  bits=0;
+  if(BZ2_bzCompressInit(&stream,BLOCKSIZE100K,VERBOSITY,WORKFACTOR)==BZ_OK){
+    if(outcap<inlen+inlen/100+600){
+      outcap=inlen+inlen/100+600;
+      if(!resizeElms(output,outcap)) outcap=0;
+      }
+    stream.next_in=(char*)input;
+    stream.avail_in=inlen;
+    while(0<outcap){
+      stream.next_out=(char*)output+outlen;
+      stream.avail_out=outcap-outlen;
+      bzerror=BZ2_bzCompress(&stream,BZ_FINISH);
+      outlen=outcap-stream.avail_out;
+      if(bzerror!=BZ_FINISH_OK) break;
+      if(!resizeElms(output,outcap<<1)) break;
+      outcap<<=1;
+      }
+    if(bzerror==BZ_STREAM_END && 14<=outlen){
+      crc=getBits(output,80,32);
+      for(FXuval end=outlen<<3; (outlen<<3)-8<end && 112+80<=end; --end){
+        if(getBits(output,end-80,24)==0x177245 && getBits(output,end-56,24)==0x385090 && getBits(output,end-32,32)==crc && getBits(output,end,(outlen<<3)-end)==0){
+          bits=end-80-32;
+          ok=true;
+          break;
+          }
+        }
+      }
+    BZ2_bzCompressEnd(&stream);
+    }
+  done.decrement();
+  return 0;
+  }
+
+
+// Wait till completion counter drops to zero, running tasks from the thread
+// pool meanwhile
+static void waitFor(FXThreadPool* pool,FXCompletion& comp){
+  if(!pool->waitFor(comp)) comp.wait();
+  atomicThreadFence();
+  }
+
+
+// Wait till task is no longer signalling completion counter, so it may be deleted
+static void release(FXCompletion& comp){
+  comp.increment();
+  comp.decrement();
+  }
+
+
+// Append bits to file, starting at the start of the buffer, after the bits
+// not written yet; the buffer is shifted in place to line up with those
+static FXbool putBits(BZWriter* w,FXFile& file,FXuchar* ptr,FXuval nbits){
+  FXuval nbytes=nbits>>3;
+  FXint r=nbits&7;
+  FXint s=w->nacc;
+  FXuint a=w->acc;
+  FXuchar c;
+  for(FXuval i=0; i<nbytes; ++i){
+    c=ptr[i];
+    ptr[i]=(FXuchar)((a<<(8-s))|(c>>s));
+    a=c&((1<<s)-1);
+    }
+  if(file.writeBlock(ptr,nbytes)!=(FXival)nbytes) return false;
+  if(r){
+    a=(a<<r)|(ptr[nbytes]>>(8-r));
+    s+=r;
+    if(8<=s){
+      c=(FXuchar)(a>>(s-8));
+      if(file.writeBlock(&c,1)!=1) return false;
+      s-=8;
+      a&=(1<<s)-1;
+      }
+    }
+  w->acc=a;
+  w->nacc=s;
+  return true;
+  }
+
+
+// Write oldest block; if wait is false, only if it's already been compressed
+static FXbool writeJob(BZWriter* w,FXFile& file,FXbool wait){
+  BZJob& job=w->jobs[w->head];
+  if(wait){
+    waitFor(w->pool,job.done);
+    }
+  else{
+    if(!job.done.done()) return false;
+    atomicThreadFence();
+    }
+  if(!job.ok || !putBits(w,file,job.output+4,job.bits)) w->ok=false;
+  w->crc=((w->crc<<1)|(w->crc>>31))^job.crc;
+  w->head=(w->head+1)%w->njobs;
+  w->pending--;
+  return true;
+  }
+
+
+// Hand chunk being filled to the thread pool, and write blocks already done;
+// make sure the next chunk is free to be filled
+static void submitJob(BZWriter* w,FXFile& file){
+  BZJob& job=w->jobs[w->tail];
+  job.done.increment();
+  if(!w->pool->execute(&job)) job.run();
+  w->tail=(w->tail+1)%w->njobs;
+  w->pending++;
+  while(0<w->pending && writeJob(w,file,w->njobs<=w->pending)){ }
+  w->jobs[w->tail].inlen=0;
+  }
+
+
+// Add data to chunks, handing each full chunk to the thread pool; when flushing
+// or finishing, also the partial one, and wait till all blocks are written
+static FXbool putData(BZWriter* w,FXFile& file,const FXuchar* ptr,FXuval count,int action){
+  FXuval n;
+  while(0<count){
+    BZJob& job=w->jobs[w->tail];
+    n=FXMIN(count,CHUNKSIZE-job.inlen);
+    memcpy(job.input+job.inlen,ptr,n);
+    job.inlen+=n;
+    ptr+=n;
+    count-=n;
+    if(job.inlen==CHUNKSIZE) submitJob(w,file);
+    }
+  if(action!=BZ_RUN){
+    if(0<w->jobs[w->tail].inlen) submitJob(w,file);
+    while(0<w->pending){ writeJob(w,file,true); }
+    }
+  if(action==BZ_FINISH){
+    FXuchar trailer[10]={0x17,0x72,0x45,0x38,0x50,0x90,(FXuchar)(w->crc>>24),(FXuchar)(w->crc>>16),(FXuchar)(w->crc>>8),(FXuchar)w->crc};
+    if(!putBits(w,file,trailer,80)) w->ok=false;
+    if(0<w->nacc){
+      trailer[0]=(FXuchar)(w->acc<<(8-w->nacc));
+      if(file.writeBlock(trailer,1)!=1) w->ok=false;
+      w->nacc=0;
+      }
+    }
+  return w->ok;
+  }
+
+
+// Start compressing chunks concurrently, after writing the stream header
+static BZWriter* startWriter(FXThreadPool* pool,FXFile& file){
+  const FXuchar header[4]={'B','Z','h','0'+BLOCKSIZE100K};
+  BZWriter* w=new BZWriter(pool,FXCLAMP(2,2*(FXint)pool->getMaximumThreads(),MAXJOBS));
+  for(FXint i=0; i<w->njobs; ++i){
+    if(!allocElms(w->jobs[i].input,CHUNKSIZE)){ delete w; return nullptr; }
+    }
+  if(file.writeBlock(header,4)!=4){ delete w; return nullptr; }
+  return w;
+  }
+
+
+// Wait for chunks still being compressed, then stop
+static void stopWriter(BZWriter* w){
+  while(0<w->pending){
+    waitFor(w->pool,w->jobs[w->head].done);
+    w->head=(w->head+1)%w->njobs;
+    w->pending--;
+    }
+  for(FXint i=0; i<w->njobs; ++i){
+    release(w->jobs[i].done);
+    }
+  delete w;
+  }
+
+
+// Take the buffers filled by the decompression task, if it's done, and start
+// it on the free ones; if the thread pool won't take it, decompress right here
+static void fillAhead(BZReader* r){
+  if(r->busy.done()){
+    atomicThreadFence();
+    r->avail+=r->added;
+    r->added=0;
+    if(r->more && r->avail<NUMBUFFERS){
+      r->put=(r->get+r->avail)%NUMBUFFERS;
+      r->todo=NUMBUFFERS-r->avail;
+      r->busy.increment();
+      if(!r->pool->execute(r)) r->run();
+      }
+    }
+  }
+
+
+// Pull up to count bytes of decompressed data from buffers filled by
+// decompression task; block until that much is available, or at the end
+static FXuval pullData(BZReader* r,FXuchar* ptr,FXuval count){
+  FXuval result=0,n;
+  while(result<count){
+    if(r->avail==0){
+      waitFor(r->pool,r->busy);
+      fillAhead(r);
+      if(r->avail==0) break;
+      }
+    n=FXMIN(count-result,r->size[r->get]-r->pos);
+    memcpy(ptr+result,r->data[r->get]+r->pos,n);
+    r->pos+=n;
+    result+=n;
+    if(r->pos==r->size[r->get]){
+      r->get=(r->get+1)%NUMBUFFERS;
+      r->avail--;
+      r->pos=0;
+      fillAhead(r);
+      }
+    }
+  return result;
+  }
+
+
+// Start decompressing ahead of the stream, using the thread pool
+static BZReader* startReader(FXThreadPool* pool,bz_stream* stream,char* buffer,FXFile* file){
+  BZReader* r=new BZReader;
+  r->pool=pool;
+  r->stream=stream;
+  r->buffer=buffer;
+  r->file=file;
+  for(FXint i=0; i<NUMBUFFERS; ++i){
+    if(!allocElms(r->data[i],READSIZE)){ delete r; return nullptr; }
+    }
+  fillAhead(r);
+  return r;
+  }
+
+
+// Wait till decompression task is done, then stop
+static void stopReader(BZReader* r){
+  waitFor(r->pool,r->busy);
+  release(r->busy);
+  delete r;
+  }
+
+
+// Decompress into the buffers handed to the task, stopping early at the
+// end of the compressed data
+FXint BZReader::run(){
+  FXival n; int bzerror;
+  FXuchar *out;
+  for(added=0; added<todo && more; ++added){
+    out=data[(put+added)%NUMBUFFERS];
+    stream->next_out=(char*)out;
+    stream->avail_out=READSIZE;
+    while(0<stream->avail_out){
+      if(stream->avail_in<=0){                          // Read more input
+        n=file->readBlock(buffer,BUFFERSIZE);
+        if(n<=0){ more=false; break; }
+        stream->next_in=buffer;
+        stream->avail_in=n;
+        }
+      bzerror=BZ2_bzDecompress(stream);
+      if(bzerror<BZ_OK || bzerror==BZ_STREAM_END){ more=false; break; }
+      }
+    size[(put+added)%NUMBUFFERS]=(FXuchar*)stream->next_out-out;
+    }
+  busy.decrement();
+  return 0;
+  }
+
+
 // Create BZIP2 file stream
 FXBZFileStream::FXBZFileStream(const FXObject* cont):FXFileStream(cont),bz(nullptr),ac(0){
   }
 
 
 // Create and open BZIP2 file stream
-FXBZFileStream::FXBZFileStream(const FXString& filename,FXStreamDirection save_or_load,FXuval size):bz(nullptr),ac(0){
-  open(filename,save_or_load,size);
+FXBZFileStream::FXBZFileStream(const FXString& filename,FXStreamDirection save_or_load,FXuval size,FXThreadPool* pool):bz(nullptr),ac(0){
+  open(filename,save_or_load,size,pool);
   }
 
 
@@ -77,6 +453,12 @@ FXuval FXBZFileStream::writeBuffer(FXuval){
   FXASSERT(begptr<=rdptr);
   FXASSERT(rdptr<=wrptr);
   FXASSERT(wrptr<=endptr);
+  if(bz->writer){
+    if(!putData(bz->writer,file,rdptr,wrptr-rdptr,ac)){ code=FXStreamFull; }
+    rdptr=begptr;
+    wrptr=begptr;
+    return endptr-wrptr;
+    }
   while(rdptr<wrptr || ac==BZ_FINISH || ac==BZ_FLUSH){
     bz->stream.next_in=(char*)rdptr;
     bz->stream.avail_in=wrptr-rdptr;
@@ -108,6 +490,10 @@ FXuval FXBZFileStream::readBuffer(FXuval){
   if(rdptr<wrptr){memmove(begptr,rdptr,wrptr-rdptr);}
   wrptr=begptr+(wrptr-rdptr);
   rdptr=begptr;
+  if(bz->reader){
+    wrptr+=pullData(bz->reader,wrptr,endptr-wrptr);
+    return wrptr-rdptr;
+    }
   while(wrptr<endptr){
     if(bz->stream.avail_in<=0){                         // Read more input
       n=file.readBlock(bz->buffer,BUFFERSIZE);
@@ -126,8 +512,21 @@ FXuval FXBZFileStream::readBuffer(FXuval){
   }
 
 
+// Compressed data can't bypass the buffer
+FXuval FXBZFileStream::writeBlock(const FXuchar*,FXuval){
+  return 0;
+  }
+
+
+// Data decompressed ahead can be copied straight to the caller
+FXuval FXBZFileStream::readBlock(FXuchar* data,FXuval count){
+  if(bz->reader) return pullData(bz->reader,data,count);
+  return 0;
+  }
+
+
 // Try open file stream
-FXbool FXBZFileStream::open(const FXString& filename,FXStreamDirection save_or_load,FXuval size){
+FXbool FXBZFileStream::open(const FXString& filename,FXStreamDirection save_or_load,FXuval size,FXThreadPool* pool){
   if(FXFileStream::open(filename,save_or_load,size)){
     if(callocElms(bz,1)){
       int bzerror;
@@ -138,12 +537,26 @@ FXbool FXBZFileStream::open(const FXString& filename,FXStreamDirection save_or_l
       ac=BZ_RUN;
       if(save_or_load==FXStreamLoad){
         bzerror=BZ2_bzDecompressInit(&bz->stream,VERBOSITY,0);
-        if(bzerror==BZ_OK) return true;
+        if(bzerror==BZ_OK){
+          if(pool){ bz->reader=startReader(pool,&bz->stream,bz->buffer,&file); }
+          return true;
+          }
         code=FXStreamNoRead;
         }
       else{
         bzerror=BZ2_bzCompressInit(&bz->stream,BLOCKSIZE100K,VERBOSITY,WORKFACTOR);
-        if(bzerror==BZ_OK) return true;
+        if(bzerror==BZ_OK){
+          if(pool){
+            if((bz->writer=startWriter(pool,file))==nullptr){
+              BZ2_bzCompressEnd(&bz->stream);
+              freeElms(bz);
+              FXFileStream::close();
+              code=FXStreamNoWrite;
+              return false;
+              }
+            }
+          return true;
+          }
         code=FXStreamNoWrite;
         }
       freeElms(bz);
@@ -169,12 +582,14 @@ FXbool FXBZFileStream::flush(){
 FXbool FXBZFileStream::close(){
   if(dir){
     if(dir==FXStreamLoad){
+      if(bz->reader) stopReader(bz->reader);
       FXFileStream::close();
       BZ2_bzDecompressEnd(&bz->stream);
       }
     else{
       ac=BZ_FINISH;
       FXFileStream::close();
+      if(bz->writer) stopWriter(bz->writer);
       BZ2_bzCompressEnd(&bz->stream);
       }
     freeElms(bz);
@@ -22,6 +22,7 @@
 #include "fxver.h"
 #include "fxdefs.h"
 #include "fxmath.h"
+#include "fxendian.h"
 #include "FXElement.h"
 #include "FXException.h"
 #include "FXString.h"
@@ -34,13 +35,25 @@
     function, the number of calls to strcmp() should be roughly the same as the number
     of successful lookups.
 
-  - When entry is removed, its key and data are cleared, but its hash value remains the
-    same; in other words, voided slots have empty key but non-zero hash value, and free slots
-    have empty key AND zero hash value.
+  - Following the table of entries is an array of control bytes, one for each slot:
+    FREE for a free slot, VOIDED for a formerly occupied slot, and for an occupied slot,
+    the high bit plus the top 7 bits of the key's hash value.  The control array is at
+    least GROUP bytes long, so that small tables can be probed the same way as large ones.
+
+  - Slots are probed in aligned groups of GROUP slots, visited in triangular order; the
+    control bytes of a group are compared against the key's tag all at once, and only
+    entries whose tag matches are looked at.  A probe sequence ends in the first group
+    having a free slot.  Thus most lookups touch one cache line of control bytes, plus
+    the entry being looked for; with short keys stored inside FXString, that's all.
+    See FXHash for details.
+
+  - When entry is removed, its key and data are cleared, and its slot is voided; if the
+    slot's group has a free slot, no probe sequence runs past it, and the slot is freed
+    instead.
 
   - Invariants:
 
-      1 Always at least one table entry marked as "free" i.e. key==empty and hash==0.
+      1 Always at least one table entry marked as "free".
 
       2 Table grows when number of free slots becomes less than or equal to 1+N/4.
 
@@ -57,8 +70,14 @@
   - Similar to FXVariantMap; reimplemented to support plain void* as payload.
 */
 
-#define EMPTY     (const_cast<Entry*>((const Entry*)(__dictionary__empty__+3)))
-#define BSHIFT    5
+#define EMPTY       (const_cast<Entry*>((const Entry*)(__dictionary__empty__+3)))
+#define GROUP       16
+#define FREE        0
+#define VOIDED      1
+#define TAG(h)      ((FXuchar)(0x80|((h)>>25)))
+#define CONTROL(t,n) ((FXuchar*)((t)+(n)))
+#define CTLSIZE(n)  FXMAX(n,GROUP)
+#define VALID(n)    ((n)<GROUP?(1u<<(n))-1:0xFFFFu)
 
 using namespace FX;
 
@@ -67,10 +86,33 @@ using namespace FX;
 namespace FX {
 
 
-// Empty dictionary table value
-extern const FXint __string__empty__[];
+// Empty dictionary table value; its control bytes span a whole group
 extern const FXival __dictionary__empty__[];
-const FXival __dictionary__empty__[6]={1,0,1,(FXival)(__string__empty__+1),0,0};
+const FXival __dictionary__empty__[3+5+GROUP/sizeof(FXival)]={1,0,1,0,0,0,0,0};
+
+
+// Return mask of slots in group whose control byte is c
+static inline FXuint matchgroup(const FXuchar* ctl,FXuchar c){
+#if defined(FOX_HAS_SSE2)
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)ctl),_mm_set1_epi8((FXchar)c)));
+#else
+  FXuint m=0;
+  for(FXuint i=0; i<GROUP; ++i){ m|=(FXuint)(ctl[i]==c)<<i; }
+  return m;
+#endif
+  }
+
+
+// Return mask of slots in group which are free or voided
+static inline FXuint opengroup(const FXuchar* ctl){
+#if defined(FOX_HAS_SSE2)
+  return ~_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ctl))&0xFFFF;
+#else
+  FXuint m=0;
+  for(FXuint i=0; i<GROUP; ++i){ m|=(FXuint)(ctl[i]<0x80)<<i; }
+  return m;
+#endif
+  }
 
 
 // Adjust the size of the table
@@ -89,7 +131,7 @@ FXbool FXDictionary::no(FXival n){
 
     // Allocate new table
     if(1<n){
-      if(__unlikely((p=::calloc(sizeof(FXival)*3+sizeof(Entry)*n,1))==nullptr)) return false;
+      if(__unlikely((p=::calloc(sizeof(FXival)*3+sizeof(Entry)*n+CTLSIZE(n),1))==nullptr)) return false;
       elbat=(Entry*)(((FXival*)p)+3);
       ((FXival*)elbat)[-3]=n;
       ((FXival*)elbat)[-2]=0;
@@ -109,17 +151,24 @@ FXbool FXDictionary::resize(FXival n){
   FXASSERT((n-used())>0);       // At least one free slot
   if(elbat.no(n)){
     if(1<elbat.no() && 1<no()){
-      FXuval p,b,h,x; FXival i;
-      for(i=0; i<no(); ++i){                  // Hash existing entries into new table
-        if(!table[i].key.empty()){
-          p=b=h=table[i].hash;
-          while(elbat.table[x=p&(n-1)].hash){ // Locate slot
-            p=(p<<2)+p+b+1;
-            b>>=BSHIFT;
+      FXuchar* ctl=CONTROL(elbat.table,n);
+      FXuint v=VALID(n),h,bits;
+      FXuval s,x,i;
+      FXival j;
+      for(j=0; j<no(); ++j){                  // Hash existing entries into new table
+        if(!table[j].key.empty()){
+          h=table[j].hash;
+          x=h&(n-1)&~(GROUP-1);
+          s=0;
+          while((bits=matchgroup(ctl+x,FREE)&v)==0){   // Locate group with free slot
+            s+=GROUP;
+            x=(x+s)&(n-1);
             }
-          elbat.table[x].key.adopt(table[i].key);       // Steal the string buffers
-          elbat.table[x].data=table[i].data;
-          elbat.table[x].hash=(FXuint)h;                // And copy the hash value
+          i=x+ctz32(bits);
+          ctl[i]=TAG(h);
+          elbat.table[i].key.adopt(table[j].key);       // Steal the string buffers
+          elbat.table[i].data=table[j].data;
+          elbat.table[i].hash=h;                        // And copy the hash value
           }
         }
       elbat.free(n-used());     // All non-empty slots now free
@@ -135,17 +184,18 @@ FXbool FXDictionary::resize(FXival n){
 // Construct empty dictionary
 FXDictionary::FXDictionary():table(EMPTY){
   FXASSERT(sizeof(FXDictionary)==sizeof(void*));
-  FXASSERT(sizeof(Entry)<=sizeof(FXival)*3);
+  FXASSERT(sizeof(Entry)<=sizeof(FXival)*5);
   }
 
 
 // Construct from another dictionary
 FXDictionary::FXDictionary(const FXDictionary& other):table(EMPTY){
   FXASSERT(sizeof(FXDictionary)==sizeof(void*));
-  FXASSERT(sizeof(Entry)<=sizeof(FXival)*3);
+  FXASSERT(sizeof(Entry)<=sizeof(FXival)*5);
   if(1<other.no()){
     if(__unlikely(!no(other.no()))){ throw FXMemoryException("FXDictionary::FXDictionary: out of memory\n"); }
     copyElms(table,other.table,no());
+    copyElms(CONTROL(table,no()),CONTROL(other.table,no()),no());
     free(other.free());
     used(other.used());
     }
@@ -158,6 +208,7 @@ FXDictionary& FXDictionary::operator=(const FXDictionary& other){
     if(1<other.no()){
       if(__unlikely(!no(other.no()))){ throw FXMemoryException("FXDictionary::operator=: out of memory\n"); }
       copyElms(table,other.table,no());
+      copyElms(CONTROL(table,no()),CONTROL(other.table,no()),no());
       free(other.free());
       used(other.used());
       }
@@ -183,13 +234,19 @@ FXDictionary& FXDictionary::adopt(FXDictionary& other){
 FXival FXDictionary::find(const FXchar* ky) const {
   if(__unlikely(!ky || !*ky)){ throw FXRangeException("FXDictionary::find: null or empty key\n"); }
   if(__likely(!empty())){
-    FXuval p,b,x,h;
-    p=b=h=FXString::hash(ky);
-    FXASSERT(h);
-    while(table[x=p&(no()-1)].hash){
-      if(table[x].hash==h && table[x].key==ky) return x;
-      p=(p<<2)+p+b+1;
-      b>>=BSHIFT;
+    const FXuchar* ctl=CONTROL(table,no());
+    FXuint h=FXString::hash(ky),v=VALID(no()),bits;
+    FXuval m=no()-1,x=h&m&~(GROUP-1),s=0,i;
+    while(1){
+      bits=matchgroup(ctl+x,TAG(h))&v;
+      while(bits){
+        i=x+ctz32(bits);
+        if(table[i].hash==h && table[i].key==ky) return i;
+        bits&=bits-1;
+        }
+      if(matchgroup(ctl+x,FREE)&v) break;
+      s+=GROUP;
+      x=(x+s)&m;
       }
     }
   return -1;
@@ -198,67 +255,54 @@ FXival FXDictionary::find(const FXchar* ky) const {
 
 // Return reference to slot assocated with given key
 void*& FXDictionary::at(const FXchar* ky){
-  FXuval p,b,h,x;
   if(__unlikely(!ky || !*ky)){ throw FXRangeException("FXDictionary::at: null or empty key\n"); }
-  p=b=h=FXString::hash(ky);
-  FXASSERT(h);
-  while(table[x=p&(no()-1)].hash){
-    if(table[x].hash==h && table[x].key==ky) goto x;   // Return existing slot
-    p=(p<<2)+p+b+1;
-    b>>=BSHIFT;
+  FXuchar* ctl=CONTROL(table,no());
+  FXuint h=FXString::hash(ky),v=VALID(no()),bits;
+  FXuval m=no()-1,x=h&m&~(GROUP-1),s=0,i;
+  while(1){
+    bits=matchgroup(ctl+x,TAG(h))&v;
+    while(bits){
+      i=x+ctz32(bits);
+      if(table[i].hash==h && table[i].key==ky) goto x;  // Return existing slot
+      bits&=bits-1;
+      }
+    if(matchgroup(ctl+x,FREE)&v) break;
+    s+=GROUP;
+    x=(x+s)&m;
     }
   if(__unlikely(free()<=1+(no()>>2)) && __unlikely(!resize(no()<<1))){ throw FXMemoryException("FXDictionary::at: out of memory\n"); }
-  p=b=h;
-  while(table[x=p&(no()-1)].hash){
-    if(table[x].key.empty()) goto y;                    // Return voided slot
-    p=(p<<2)+p+b+1;
-    b>>=BSHIFT;
+  ctl=CONTROL(table,no());
+  v=VALID(no());
+  m=no()-1;
+  x=h&m&~(GROUP-1);
+  s=0;
+  while((bits=opengroup(ctl+x)&v)==0){                 // Locate group with voided or free slot
+    s+=GROUP;
+    x=(x+s)&m;
     }
-  free(free()-1);                                       // Put into empty slot
-y:used(used()+1);
-  table[x].key=ky;
-  table[x].hash=(FXuint)h;
-x:return table[x].data;
+  i=x+ctz32(bits);
+  if(ctl[i]==FREE) free(free()-1);                      // Put into empty slot
+  used(used()+1);
+  ctl[i]=TAG(h);
+  table[i].key=ky;
+  table[i].hash=h;
+x:return table[i].data;
   }
 
 
 // Return constant reference to slot assocated with given key
 void *const& FXDictionary::at(const FXchar* ky) const {
-  if(__unlikely(!ky || !*ky)){ throw FXRangeException("FXDictionary::at: null or empty key\n"); }
-  if(__likely(!empty())){
-    FXuval p,b,x,h;
-    p=b=h=FXString::hash(ky);
-    FXASSERT(h);
-    while(table[x=p&(no()-1)].hash){
-      if(table[x].hash==h && table[x].key==ky) return table[x].data;
-      p=(p<<2)+p+b+1;
-      b>>=BSHIFT;
-      }
-    }
+  FXival pos=find(ky);
+  if(0<=pos) return table[pos].data;
   return EMPTY[0].data;
   }
 
 
 // Remove association with given key; return old value, if any
 void* FXDictionary::remove(const FXchar* ky){
-  void* old=nullptr;
-  if(__unlikely(!ky || !*ky)){ throw FXRangeException("FXDictionary::remove: null or empty key\n"); }
-  if(__likely(!empty())){
-    FXuval p,b,h,x;
-    p=b=h=FXString::hash(ky);
-    FXASSERT(h);
-    while(table[x=p&(no()-1)].hash!=h || table[x].key!=ky){
-      if(!table[x].hash) goto x;
-      p=(p<<2)+p+b+1;
-      b>>=BSHIFT;
-      }
-    table[x].key.clear();                                 // Void the slot (not empty!)
-    old=table[x].data;
-    table[x].data=nullptr;
-    used(used()-1);
-    if(__unlikely(used()<=(no()>>2))) resize(no()>>1);
-    }
-x:return old;
+  FXival pos=find(ky);
+  if(0<=pos) return erase(pos);
+  return nullptr;
   }
 
 
@@ -266,9 +310,17 @@ x:return old;
 void* FXDictionary::erase(FXival pos){
   if(__unlikely(pos<0 || no()<=pos)){ throw FXRangeException("FXDictionary::erase: argument out of range\n"); }
   if(!table[pos].key.empty()){
+    FXuchar* ctl=CONTROL(table,no());
     void* old=table[pos].data;
-    table[pos].key.clear();                             // Void the slot (not empty!)
+    table[pos].key.clear();
     table[pos].data=nullptr;
+    if(matchgroup(ctl+(pos&~(GROUP-1)),FREE)&VALID(no())){
+      ctl[pos]=FREE;                                    // Free the slot; no probe sequence passes through its group
+      free(free()+1);
+      }
+    else{
+      ctl[pos]=VOIDED;                                  // Void the slot (not empty!)
+      }
     used(used()-1);
     if(__unlikely(used()<=(no()>>2))) resize(no()>>1);
     return old;
@@ -33,6 +33,8 @@
 /*
   Notes:
   - Future verions will use native system calls under WIN32.
+  - Large arrays are written and read directly to and from the file, bypassing
+    the buffer; see writeBlock() and readBlock().
 */
 
 using namespace FX;
@@ -92,6 +94,20 @@ FXuval FXFileStream::readBuffer(FXuval){
   }
 
 
+// Write count bytes directly to the file
+FXuval FXFileStream::writeBlock(const FXuchar* data,FXuval count){
+  FXival n=file.writeBlock(data,count);
+  return (0<n)?n:0;
+  }
+
+
+// Read up to count bytes directly from the file
+FXuval FXFileStream::readBlock(FXuchar* data,FXuval count){
+  FXival n=file.readBlock(data,count);
+  return (0<n)?n:0;
+  }
+
+
 // Open file stream
 FXbool FXFileStream::open(const FXString& filename,FXStreamDirection save_or_load,FXuval size){
   if(save_or_load!=FXStreamSave && save_or_load!=FXStreamLoad){fxerror("FXFileStream::open: illegal stream direction.\n");}
@@ -1,23 +1,3 @@
-/********************************************************************************
-*                                                                               *
-*                     G Z F i l e S t r e a m   C l a s s e s                   *
-*                                                                               *
-*********************************************************************************
-* Copyright (C) 2002,2024 by Sander Jansen.   All Rights Reserved.              *
-*********************************************************************************
-* This library is free software; you can redistribute it and/or modify          *
-* it under the terms of the GNU Lesser General Public License as published by   *
-* the Free Software Foundation; either version 3 of the License, or             *
-* (at your option) any later version.                                           *
-*                                                                               *
-* This library is distributed in the hope that it will be useful,               *
-* but WITHOUT ANY WARRANTY; without even the implied warranty of                *
-* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the                 *
-* GNU Lesser General Public License for more details.                           *
-*                                                                               *
-* You should have received a copy of the GNU Lesser General Public License      *
-* along with this program.  If not, see <http://www.gnu.org/licenses/>          *
-********************************************************************************/
 #include "xincs.h"
 #include "fxver.h"
 #include "fxdefs.h"
@@ -27,6 +7,15 @@
 #include "FXHash.h"
 #include "FXStream.h"
 #include "FXFile.h"
+#include "FXPtrList.h"
+#include "FXAtomic.h"
+#include "FXSemaphore.h"
+#include "FXCompletion.h"
+#include "FXRunnable.h"
+#include "FXAutoThreadStorageKey.h"
+#include "FXThread.h"
+#include "FXLFQueue.h"
+#include "FXThreadPool.h"
 #include "FXGZFileStream.h"
 
 #ifdef HAVE_ZLIB_H
@@ -37,30 +26,362 @@
   - Very basic compressed file I/O only.
   - Updated for new stream classes 2003/07/08.
   - Updated for FXFile 2005/09/03.
+  - When opened with a thread pool, saving splits the data into blocks of BLOCKSIZE
+    bytes, which are compressed concurrently by tasks on the thread pool, in the
+    manner of pigz:
+
+      o Each block is compressed as raw deflate data, primed with the last 32K of
+        the data before it as dictionary, so compression hardly suffers.
+
+      o Each block but the last ends with a sync flush, which leaves the deflate
+        data byte-aligned without ending it; so the blocks can simply be written
+        out one after the other, between the zlib header and trailer.
+
+      o The Adler32 checksum of each block is computed by its task, and the
+        checksums are combined in order with adler32_combine().
+
+    The result is a single zlib stream, just like the one written otherwise.
+  - Up to MAXJOBS blocks are in flight; blocks are written in order by the
+    calling thread as they are completed, and it waits for the oldest one only
+    when they're all in flight.  If the thread pool won't accept a task, the
+    calling thread compresses the block itself.
+  - When opened with a thread pool, loading runs the decompression in tasks on
+    the thread pool, which fill a ring of NUMBUFFERS buffers ahead of the stream;
+    the stream copies data out of them as it needs it.  The compressed stream
+    itself can't be decompressed in pieces, but this overlaps decompression and
+    file reading with the work done by the caller on the data.
+  - Tasks never wait for the stream: a decompression task fills the buffers which
+    were free when it was started, and returns; the stream starts the next one once
+    buffers have been drained.  So no stream ties up a worker thread while it is
+    open.  The stream waits for its tasks by means of FXThreadPool::waitFor(), which
+    runs queued tasks on the calling thread meanwhile, so a stream makes progress
+    even when all worker threads are busy.
+  - A task posts its completion counter's semaphore just after the count drops to
+    zero; before deleting the counter, an increment() and decrement() makes sure the
+    task is done with it.
 */
 
-#define BUFFERSIZE 8192
+#define BUFFERSIZE 8192         // Size of the buffer
+#define BLOCKSIZE  131072       // Size of blocks compressed concurrently
+#define DICTSIZE   32768        // Size of dictionary carried between blocks
+#define MAXJOBS    64           // Maximum number of blocks in flight
+#define NUMBUFFERS 4            // Number of buffers decompressed ahead
 
 /*******************************************************************************/
 
 namespace FX {
 
 
+// Block compressed by a task on the thread pool
+struct ZJob : public FXRunnable {
+  FXCompletion done;            // Counted while block is compressed
+  Bytef      *input;            // Uncompressed data
+  Bytef      *output;           // Compressed data
+  uLong       inlen;            // Length of uncompressed data
+  uLong       outlen;           // Length of compressed data
+  uLong       outcap;           // Capacity of output
+  uLong       dictlen;          // Length of dictionary
+  uLong       check;            // Adler32 of uncompressed data
+  FXbool      last;             // Last block of stream
+  FXbool      ok;               // Compressed successfully
+  Bytef       dict[DICTSIZE];   // Tail of preceding data
+  ZJob():input(nullptr),output(nullptr),inlen(0),outlen(0),outcap(0),dictlen(0),check(0),last(false),ok(false){ }
+  virtual FXint run();
+ ~ZJob(){ freeElms(input); freeElms(output); }
+  };
+
+
+// Blocks being compressed concurrently
+struct ZWriter {
+  FXThreadPool *pool;           // Thread pool compressing blocks
+  ZJob         *jobs;           // Ring of blocks
+  FXint         njobs;          // Number of blocks in ring
+  FXint         head;           // Oldest block not yet written
+  FXint         tail;           // Block being filled
+  FXint         pending;        // Blocks being compressed
+  FXlong        count;          // Number of blocks submitted
+  uLong         check;          // Adler32 of data written so far
+  FXbool        ok;             // No errors so far
+  ZWriter(FXThreadPool* p,FXint n):pool(p),jobs(new ZJob[n]),njobs(n),head(0),tail(0),pending(0),count(0),check(adler32(0L,Z_NULL,0)),ok(true){ }
+ ~ZWriter(){ delete [] jobs; }
+  };
+
+
+// Decompression task, filling buffers ahead of the stream
+struct ZReader : public FXRunnable {
+  FXThreadPool *pool;                   // Thread pool decompressing ahead
+  z_stream     *stream;                 // Decompression stream
+  Bytef        *buffer;                 // Compressed data
+  FXFile       *file;                   // File being read
+  FXCompletion  busy;                   // Counted while task is filling buffers
+  Bytef        *data[NUMBUFFERS];       // Decompressed data
+  FXuval        size[NUMBUFFERS];       // Amount of data in each buffer
+  FXint         put;                    // First buffer to be filled by task
+  FXint         todo;                   // Number of buffers to be filled by task
+  FXint         added;                  // Number of buffers filled by task
+  FXint         get;                    // Buffer being drained by stream
+  FXint         avail;                  // Filled buffers not yet drained
+  FXuval        pos;                    // Position in buffer being drained
+  FXbool        more;                   // Not yet at end of compressed data
+  ZReader():pool(nullptr),stream(nullptr),buffer(nullptr),file(nullptr),data{},size{},put(0),todo(0),added(0),get(0),avail(0),pos(0),more(true){ }
+  virtual FXint run();
+ ~ZReader(){ for(FXint i=0; i<NUMBUFFERS; ++i) freeElms(data[i]); }
+  };
+
+
 // Used during compression
 struct ZBlock {
   z_stream stream;
   Bytef    buffer[BUFFERSIZE];
+  ZWriter *writer;
+  ZReader *reader;
   };
 
 
+// Compress block as raw deflate data, primed with the preceding data as dictionary;
+// the last block finishes the deflate data, all others end with a sync flush
+FXint ZJob::run(){
+  z_stream stream;
+  int zerror=Z_STREAM_ERROR;
+  memset(&stream,0,sizeof(stream));
+  ok=false;
+  outlen=0;
+  check=adler32(adler32(0L,Z_NULL,0),input,inlen);
+  if(deflateInit2(&stream,Z_DEFAULT_COMPRESSION,Z_DEFLATED,-MAX_WBITS,8,Z_DEFAULT_STRATEGY)==Z_OK){
+    if(dictlen) deflateSetDictionary(&stream,dict,dictlen);
+    if(outcap<deflateBound(&stream,inlen)+16){
+      outcap=deflateBound(&stream,inlen)+16;
+      if(!resizeElms(output,outcap)) outcap=0;
+      }
+    stream.next_in=input;
+    stream.avail_in=inlen;
+    while(0<outcap){
+      stream.next_out=output+outlen;
+      stream.avail_out=outcap-outlen;
+      zerror=deflate(&stream,last?Z_FINISH:Z_SYNC_FLUSH);
+      outlen=outcap-stream.avail_out;
+      if(zerror!=Z_OK || stream.avail_out!=0) break;
+      if(!resizeElms(output,outcap<<1)) break;
+      outcap<<=1;
+      }
+    ok=last?(zerror==Z_STREAM_END):((zerror==Z_OK || zerror==Z_BUF_ERROR) && stream.avail_in==0);
+    deflateEnd(&stream);
+    }
+  done.decrement();
+  return 0;
+  }
+
+
+// Wait till completion counter drops to zero, running tasks from the thread
+// pool meanwhile
+static void waitFor(FXThreadPool* pool,FXCompletion& comp){
+  if(!pool->waitFor(comp)) comp.wait();
+  atomicThreadFence();
+  }
+
+
+// Wait till task is no longer signalling completion counter, so it may be deleted
+static void release(FXCompletion& comp){
+  comp.increment();
+  comp.decrement();
+  }
+
+
+// Write oldest block; if wait is false, only if it's already been compressed
+static FXbool writeJob(ZWriter* w,FXFile& file,FXbool wait){
+  ZJob& job=w->jobs[w->head];
+  if(wait){
+    waitFor(w->pool,job.done);
+    }
+  else{
+    if(!job.done.done()) return false;
+    atomicThreadFence();
+    }
+  if(!job.ok || file.writeBlock(job.output,job.outlen)!=(FXival)job.outlen) w->ok=false;
+  w->check=adler32_combine(w->check,job.check,job.inlen);
+  w->head=(w->head+1)%w->njobs;
+  w->pending--;
+  return true;
+  }
+
+
+// Hand block being filled to the thread pool, and write blocks already done;
+// make sure the next block is free to be filled
+static void submitJob(ZWriter* w,FXFile& file,FXbool last){
+  ZJob& job=w->jobs[w->tail];
+  job.last=last;
+  job.dictlen=0;
+  if(w->count){
+    const ZJob& prev=w->jobs[(w->tail+w->njobs-1)%w->njobs];
+    uLong n=FXMIN(prev.inlen,DICTSIZE);
+    uLong k=FXMIN(prev.dictlen,DICTSIZE-n);
+    memcpy(job.dict,prev.dict+prev.dictlen-k,k);
+    memcpy(job.dict+k,prev.input+prev.inlen-n,n);
+    job.dictlen=k+n;
+    }
+  job.done.increment();
+  if(!w->pool->execute(&job)) job.run();
+  w->tail=(w->tail+1)%w->njobs;
+  w->pending++;
+  w->count++;
+  while(0<w->pending && writeJob(w,file,w->njobs<=w->pending)){ }
+  w->jobs[w->tail].inlen=0;
+  }
+
+
+// Add data to blocks, handing each full block to the thread pool; when flushing
+// or finishing, also the partial one, and wait till all blocks are written
+static FXbool putData(ZWriter* w,FXFile& file,const FXuchar* ptr,FXuval count,int action){
+  FXuval n;
+  while(0<count){
+    ZJob& job=w->jobs[w->tail];
+    n=FXMIN(count,BLOCKSIZE-job.inlen);
+    memcpy(job.input+job.inlen,ptr,n);
+    job.inlen+=n;
+    ptr+=n;
+    count-=n;
+    if(job.inlen==BLOCKSIZE) submitJob(w,file,false);
+    }
+  if(action==Z_FINISH || (action==Z_SYNC_FLUSH && 0<w->jobs[w->tail].inlen)){
+    submitJob(w,file,action==Z_FINISH);
+    }
+  if(action!=Z_NO_FLUSH){
+    while(0<w->pending){ writeJob(w,file,true); }
+    }
+  if(action==Z_FINISH){
+    Bytef trailer[4]={(Bytef)(w->check>>24),(Bytef)(w->check>>16),(Bytef)(w->check>>8),(Bytef)w->check};
+    if(file.writeBlock(trailer,4)!=4) w->ok=false;
+    }
+  return w->ok;
+  }
+
+
+// Start compressing blocks concurrently, after writing the zlib header
+// which deflateInit() would write for the default compression level
+static ZWriter* startWriter(FXThreadPool* pool,FXFile& file){
+  const Bytef header[2]={0x78,0x9C};
+  ZWriter* w=new ZWriter(pool,FXCLAMP(2,2*(FXint)pool->getMaximumThreads(),MAXJOBS));
+  for(FXint i=0; i<w->njobs; ++i){
+    if(!allocElms(w->jobs[i].input,BLOCKSIZE)){ delete w; return nullptr; }
+    }
+  if(file.writeBlock(header,2)!=2){ delete w; return nullptr; }
+  return w;
+  }
+
+
+// Wait for blocks still being compressed, then stop
+static void stopWriter(ZWriter* w){
+  while(0<w->pending){
+    waitFor(w->pool,w->jobs[w->head].done);
+    w->head=(w->head+1)%w->njobs;
+    w->pending--;
+    }
+  for(FXint i=0; i<w->njobs; ++i){
+    release(w->jobs[i].done);
+    }
+  delete w;
+  }
+
+
+// Take the buffers filled by the decompression task, if it's done, and start
+// it on the free ones; if the thread pool won't take it, decompress right here
+static void fillAhead(ZReader* r){
+  if(r->busy.done()){
+    atomicThreadFence();
+    r->avail+=r->added;
+    r->added=0;
+    if(r->more && r->avail<NUMBUFFERS){
+      r->put=(r->get+r->avail)%NUMBUFFERS;
+      r->todo=NUMBUFFERS-r->avail;
+      r->busy.increment();
+      if(!r->pool->execute(r)) r->run();
+      }
+    }
+  }
+
+
+// Pull up to count bytes of decompressed data from buffers filled by
+// decompression task; block until that much is available, or at the end
+static FXuval pullData(ZReader* r,FXuchar* ptr,FXuval count){
+  FXuval result=0,n;
+  while(result<count){
+    if(r->avail==0){
+      waitFor(r->pool,r->busy);
+      fillAhead(r);
+      if(r->avail==0) break;
+      }
+    n=FXMIN(count-result,r->size[r->get]-r->pos);
+    memcpy(ptr+result,r->data[r->get]+r->pos,n);
+    r->pos+=n;
+    result+=n;
+    if(r->pos==r->size[r->get]){
+      r->get=(r->get+1)%NUMBUFFERS;
+      r->avail--;
+      r->pos=0;
+      fillAhead(r);
+      }
+    }
+  return result;
+  }
+
+
+// Start decompressing ahead of the stream, using the thread pool
+static ZReader* startReader(FXThreadPool* pool,z_stream* stream,Bytef* buffer,FXFile* file){
+  ZReader* r=new ZReader;
+  r->pool=pool;
+  r->stream=stream;
+  r->buffer=buffer;
+  r->file=file;
+  for(FXint i=0; i<NUMBUFFERS; ++i){
+    if(!allocElms(r->data[i],BLOCKSIZE)){ delete r; return nullptr; }
+    }
+  fillAhead(r);
+  return r;
+  }
+
+
+// Wait till decompression task is done, then stop
+static void stopReader(ZReader* r){
+  waitFor(r->pool,r->busy);
+  release(r->busy);
+  delete r;
+  }
+
+
+// Decompress into the buffers handed to the task, stopping early at the
+// end of the compressed data
+FXint ZReader::run(){
+  FXival n; int zerror;
+  Bytef *out;
+  for(added=0; added<todo && more; ++added){
+    out=data[(put+added)%NUMBUFFERS];
+    stream->next_out=out;
+    stream->avail_out=BLOCKSIZE;
+    while(0<stream->avail_out){
+      if(stream->avail_in<=0){                          // Read more input
+        n=file->readBlock(buffer,BUFFERSIZE);
+        if(n<=0){ more=false; break; }
+        stream->next_in=buffer;
+        stream->avail_in=n;
+        }
+      zerror=inflate(stream,Z_NO_FLUSH);
+      if(zerror<Z_OK || zerror==Z_STREAM_END){ more=false; break; }
+      }
+    size[(put+added)%NUMBUFFERS]=stream->next_out-out;
+    }
+  busy.decrement();
+  return 0;
+  }
+
+
 // Create GZIP compressed file stream
 FXGZFileStream::FXGZFileStream(const FXObject* cont):FXFileStream(cont),gz(nullptr),ac(0){
   }
 
 
 // Create and open GZIP compressed file stream
-FXGZFileStream::FXGZFileStream(const FXString& filename,FXStreamDirection save_or_load,FXuval size):gz(nullptr),ac(0){
-  open(filename,save_or_load,size);
+FXGZFileStream::FXGZFileStream(const FXString& filename,FXStreamDirection save_or_load,FXuval size,FXThreadPool* pool):gz(nullptr),ac(0){
+  open(filename,save_or_load,size,pool);
   }
 
 
@@ -71,6 +392,12 @@ FXuval FXGZFileStream::writeBuffer(FXuval){
   FXASSERT(begptr<=rdptr);
   FXASSERT(rdptr<=wrptr);
   FXASSERT(wrptr<=endptr);
+  if(gz->writer){
+    if(!putData(gz->writer,file,rdptr,wrptr-rdptr,ac)){ code=FXStreamFull; }
+    rdptr=begptr;
+    wrptr=begptr;
+    return endptr-wrptr;
+    }
   while(rdptr<wrptr || ac==Z_FINISH || ac==Z_SYNC_FLUSH){
     gz->stream.next_in=(Bytef*)rdptr;
     gz->stream.avail_in=wrptr-rdptr;
@@ -101,6 +428,10 @@ FXuval FXGZFileStream::readBuffer(FXuval){
   if(rdptr<wrptr){memmove(begptr,rdptr,wrptr-rdptr);}
   wrptr=begptr+(wrptr-rdptr);
   rdptr=begptr;
+  if(gz->reader){
+    wrptr+=pullData(gz->reader,wrptr,endptr-wrptr);
+    return wrptr-rdptr;
+    }
   while(wrptr<endptr){
     if(gz->stream.avail_in<=0){                         // Read more input
       n=file.readBlock(gz->buffer,BUFFERSIZE);
@@ -119,8 +450,21 @@ FXuval FXGZFileStream::readBuffer(FXuval){
   }
 
 
+// Compressed data can't bypass the buffer
+FXuval FXGZFileStream::writeBlock(const FXuchar*,FXuval){
+  return 0;
+  }
+
+
+// Data decompressed ahead can be copied straight to the caller
+FXuval FXGZFileStream::readBlock(FXuchar* data,FXuval count){
+  if(gz->reader) return pullData(gz->reader,data,count);
+  return 0;
+  }
+
+
 // Try open file stream
-FXbool FXGZFileStream::open(const FXString& filename,FXStreamDirection save_or_load,FXuval size){
+FXbool FXGZFileStream::open(const FXString& filename,FXStreamDirection save_or_load,FXuval size,FXThreadPool* pool){
   if(FXFileStream::open(filename,save_or_load,size)){
     if(callocElms(gz,1)){
       int zerror;
@@ -131,12 +475,26 @@ FXbool FXGZFileStream::open(const FXString& filename,FXStreamDirection save_or_l
       ac=Z_NO_FLUSH;
       if(save_or_load==FXStreamLoad){
         zerror=inflateInit(&gz->stream);
-        if(zerror==Z_OK) return true;
+        if(zerror==Z_OK){
+          if(pool){ gz->reader=startReader(pool,&gz->stream,gz->buffer,&file); }
+          return true;
+          }
         code=FXStreamNoRead;
         }
       else{
         zerror=deflateInit(&gz->stream,Z_DEFAULT_COMPRESSION);
-        if(zerror==Z_OK) return true;
+        if(zerror==Z_OK){
+          if(pool){
+            if((gz->writer=startWriter(pool,file))==nullptr){
+              deflateEnd(&gz->stream);
+              freeElms(gz);
+              FXFileStream::close();
+              code=FXStreamNoWrite;
+              return false;
+              }
+            }
+          return true;
+          }
         code=FXStreamNoWrite;
         }
       freeElms(gz);
@@ -163,12 +521,14 @@ FXbool FXGZFileStream::flush(){
 FXbool FXGZFileStream::close(){
   if(dir){
     if(dir==FXStreamLoad){
+      if(gz->reader) stopReader(gz->reader);
       FXFileStream::close();
       inflateEnd(&gz->stream);
       }
     else{
       ac=Z_FINISH;
       FXFileStream::close();
+      if(gz->writer) stopWriter(gz->writer);
       deflateEnd(&gz->stream);
       }
     freeElms(gz);
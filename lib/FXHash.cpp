@@ -22,6 +22,7 @@
 #include "fxver.h"
 #include "fxdefs.h"
 #include "fxmath.h"
+#include "fxendian.h"
 #include "FXElement.h"
 #include "FXHash.h"
 #include "FXException.h"
@@ -42,7 +43,23 @@
     hash table requires very little space, and no table is allocated until at least one
     element is added.
 
-  - Probe position p, probe increment b, and index x MUST be unsigned.
+  - Following the table of entries is an array of control bytes, one for each slot:
+    FREE for a free slot, VOIDED for a formerly occupied slot, and for an occupied slot,
+    the high bit plus 7 bits of the key's hash value.  The control array is at least
+    GROUP bytes long, so that small tables can be probed the same way as large ones.
+
+  - The slots are probed in aligned groups of GROUP slots: the control bytes of a group
+    are compared against the key's tag all at once (with SSE2, in a single instruction),
+    and only the entries whose tag matches are looked at.  A probe sequence ends in the
+    first group having a free slot.  Thus most lookups touch one cache line of control
+    bytes plus the matching entry.
+
+  - Groups are visited in triangular order, 0, 1, 3, 6, ... groups past the home group;
+    since the number of groups is a power of two, this eventually visits every group.
+    Tables smaller than GROUP form a single group; the control bytes past the end of
+    such a table are masked off.
+
+  - Probe position x, stride s, and index i MUST be unsigned.
 
   - The table resize algorithm:
 
@@ -50,8 +67,10 @@
         is removed, used slot count will be decremented, but free slot count will
         stay the same, because the slot is voided, not freed.  This is because the
         removed slot may still be part of another entry's probe sequence.
-        When an entry is added, it will be placed in a voided slot if possible;
-        if not, then it will be placed in a free slot.
+        However, if the slot's group still has a free slot, no probe sequence passes
+        through that group, and the slot is freed instead.
+        When an entry is added, it will be placed in the first voided or free slot
+        along its probe sequence.
 
       - When the table is resized, all entries wil be re-hashed, and voided slots be
         reclaimed as free slots.
@@ -66,7 +85,7 @@
         of the table size.
 
       - Table must always maintain at least one free slot to insure that probing
-        sequence is always finite (all locations are eventually visited, and thus
+        sequence is always finite (all groups are eventually visited, and thus
         the probing sequence is guaranteed to be finite).
 
       - Thus the new implementation will be at least 1/4 used, and at most 3/4 filled
@@ -75,11 +94,16 @@
         will not cause a table resize (except when the table is near empty, of course).
 */
 
-#define EMPTY     (const_cast<Entry*>((const Entry*)(__hash__empty__+3)))
-#define HASH(x)   ((FXival)(x)^(((FXival)(x))>>13))
-#define VOID      ((const void*)-1L)
-#define LEGAL(p)  ((p)!=nullptr && (p)!=VOID)
-#define BSHIFT    5
+#define EMPTY       (const_cast<Entry*>((const Entry*)(__hash__empty__+3)))
+#define VOID        ((const void*)-1L)
+#define LEGAL(p)    ((p)!=nullptr && (p)!=VOID)
+#define GROUP       16
+#define FREE        0
+#define VOIDED      1
+#define TAG(h)      ((FXuchar)(0x80|((h)>>25)))
+#define CONTROL(t,n) ((FXuchar*)((t)+(n)))
+#define CTLSIZE(n)  FXMAX(n,GROUP)
+#define VALID(n)    ((n)<GROUP?(1u<<(n))-1:0xFFFFu)
 
 
 using namespace FX;
@@ -89,9 +113,41 @@ using namespace FX;
 namespace FX {
 
 
-// Empty object list
+// Empty object list; its control bytes span a whole group
 extern const FXival __hash__empty__[];
-const FXival __hash__empty__[7]={1,0,1,0,0};
+const FXival __hash__empty__[3+2+GROUP/sizeof(FXival)]={1,0,1,0,0};
+
+
+// Hash pointer; mix the high bits into the low ones, as pointers are aligned
+static inline FXuint HASH(const void* ptr){
+  FXulong h=(FXulong)(FXuval)ptr;
+  h=(h^(h>>32))*FXULONG(0xD6E8FEB86659FD93);
+  return (FXuint)(h^(h>>32));
+  }
+
+
+// Return mask of slots in group whose control byte is c
+static inline FXuint matchgroup(const FXuchar* ctl,FXuchar c){
+#if defined(FOX_HAS_SSE2)
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)ctl),_mm_set1_epi8((FXchar)c)));
+#else
+  FXuint m=0;
+  for(FXuint i=0; i<GROUP; ++i){ m|=(FXuint)(ctl[i]==c)<<i; }
+  return m;
+#endif
+  }
+
+
+// Return mask of slots in group which are free or voided
+static inline FXuint opengroup(const FXuchar* ctl){
+#if defined(FOX_HAS_SSE2)
+  return ~_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ctl))&0xFFFF;
+#else
+  FXuint m=0;
+  for(FXuint i=0; i<GROUP; ++i){ m|=(FXuint)(ctl[i]<0x80)<<i; }
+  return m;
+#endif
+  }
 
 
 // Adjust the size of the table
@@ -110,7 +166,7 @@ FXbool FXHash::no(FXival n){
 
     // Allocate new table
     if(1<n){
-      if(__unlikely((p=::calloc(sizeof(FXival)*3+sizeof(Entry)*n,1))==nullptr)) return false;
+      if(__unlikely((p=::calloc(sizeof(FXival)*3+sizeof(Entry)*n+CTLSIZE(n),1))==nullptr)) return false;
       elbat=(Entry*)(((FXival*)p)+3);
       ((FXival*)elbat)[-3]=n;
       ((FXival*)elbat)[-2]=0;
@@ -130,21 +186,23 @@ FXbool FXHash::resize(FXival n){
   FXASSERT((n-used())>0);       // At least one free slot
   if(elbat.no(n)){
     if(1<elbat.no() && 1<no()){
-      const void* ky;
-      void* da;
-      FXuval p,b,x;
-      FXival i;
-      for(i=0; i<no(); ++i){    // Hash existing entries into new table
-        ky=table[i].key;
-        da=table[i].data;
-        if(LEGAL(ky)){
-          p=b=HASH(ky);
-          while(elbat.table[x=p&(n-1)].key){    // Locate slot
-            p=(p<<2)+p+b+1;
-            b>>=BSHIFT;
+      FXuchar* ctl=CONTROL(elbat.table,n);
+      FXuint v=VALID(n),h,bits;
+      FXuval s,x,i;
+      FXival j;
+      for(j=0; j<no(); ++j){    // Hash existing entries into new table
+        if(LEGAL(table[j].key)){
+          h=HASH(table[j].key);
+          x=h&(n-1)&~(GROUP-1);
+          s=0;
+          while((bits=matchgroup(ctl+x,FREE)&v)==0){   // Locate group with free slot
+            s+=GROUP;
+            x=(x+s)&(n-1);
             }
-          elbat.table[x].key=ky;
-          elbat.table[x].data=da;
+          i=x+ctz32(bits);
+          ctl[i]=TAG(h);
+          elbat.table[i].key=table[j].key;
+          elbat.table[i].data=table[j].data;
           }
         }
       elbat.free(n-used());     // All non-empty slots now free
@@ -168,8 +226,10 @@ FXHash::FXHash():table(EMPTY){
 FXHash::FXHash(const FXHash& other):table(EMPTY){
   FXASSERT_STATIC(sizeof(FXHash)==sizeof(void*));
   FXASSERT_STATIC(sizeof(Entry)<=sizeof(FXival)*2);
-  if(__likely(1<other.no() && no(other.no()))){
+  if(1<other.no()){
+    if(__unlikely(!no(other.no()))){ throw FXMemoryException("FXHash::FXHash: out of memory\n"); }
     copyElms(table,other.table,no());
+    copyElms(CONTROL(table,no()),CONTROL(other.table,no()),no());
     free(other.free());
     used(other.used());
     }
@@ -178,10 +238,17 @@ FXHash::FXHash(const FXHash& other):table(EMPTY){
 
 // Assign from another table
 FXHash& FXHash::operator=(const FXHash& other){
-  if(__likely(table!=other.table && no(other.no()))){
-    copyElms(table,other.table,no());
-    free(other.free());
-    used(other.used());
+  if(__likely(table!=other.table)){
+    if(1<other.no()){
+      if(__unlikely(!no(other.no()))){ throw FXMemoryException("FXHash::operator=: out of memory\n"); }
+      copyElms(table,other.table,no());
+      copyElms(CONTROL(table,no()),CONTROL(other.table,no()),no());
+      free(other.free());
+      used(other.used());
+      }
+    else{
+      no(1);
+      }
     }
   return *this;
   }
@@ -200,12 +267,19 @@ FXHash& FXHash::adopt(FXHash& other){
 // Find position of given key
 FXival FXHash::find(const void* ky) const {
   if(__likely(LEGAL(ky))){
-    FXuval p,b,x;
-    p=b=HASH(ky);
-    while(table[x=p&(no()-1)].key){
-      if(__likely(table[x].key==ky)) return x;
-      p=(p<<2)+p+b+1;
-      b>>=BSHIFT;
+    const FXuchar* ctl=CONTROL(table,no());
+    FXuint h=HASH(ky),v=VALID(no()),bits;
+    FXuval m=no()-1,x=h&m&~(GROUP-1),s=0,i;
+    while(1){
+      bits=matchgroup(ctl+x,TAG(h))&v;
+      while(bits){
+        i=x+ctz32(bits);
+        if(__likely(table[i].key==ky)) return i;
+        bits&=bits-1;
+        }
+      if(matchgroup(ctl+x,FREE)&v) break;
+      s+=GROUP;
+      x=(x+s)&m;
       }
     }
   return -1;
@@ -215,24 +289,36 @@ FXival FXHash::find(const void* ky) const {
 // Return reference to slot assocated with given key
 void*& FXHash::at(const void* ky){
   if(__likely(LEGAL(ky))){
-    FXuval p,b,h,x;
-    p=b=h=HASH(ky);
-    while(table[x=p&(no()-1)].key){
-      if(__likely(table[x].key==ky)) goto x;    // Replace existing slot
-      p=(p<<2)+p+b+1;
-      b>>=BSHIFT;
+    FXuchar* ctl=CONTROL(table,no());
+    FXuint h=HASH(ky),v=VALID(no()),bits;
+    FXuval m=no()-1,x=h&m&~(GROUP-1),s=0,i;
+    while(1){
+      bits=matchgroup(ctl+x,TAG(h))&v;
+      while(bits){
+        i=x+ctz32(bits);
+        if(__likely(table[i].key==ky)) goto x;  // Replace existing slot
+        bits&=bits-1;
+        }
+      if(matchgroup(ctl+x,FREE)&v) break;
+      s+=GROUP;
+      x=(x+s)&m;
       }
     if(__unlikely(free()<=1+(no()>>2)) && __unlikely(!resize(no()<<1))){ throw FXMemoryException("FXHash::at: out of memory\n"); }
-    p=b=h;
-    while(table[x=p&(no()-1)].key){
-      if(__likely(table[x].key==VOID)) goto y;  // Put into voided slot
-      p=(p<<2)+p+b+1;
-      b>>=BSHIFT;
+    ctl=CONTROL(table,no());
+    v=VALID(no());
+    m=no()-1;
+    x=h&m&~(GROUP-1);
+    s=0;
+    while((bits=opengroup(ctl+x)&v)==0){       // Locate group with voided or free slot
+      s+=GROUP;
+      x=(x+s)&m;
       }
-    free(free()-1);                             // Put into empty slot
-y:  used(used()+1);
-    table[x].key=ky;
-x:  return table[x].data;
+    i=x+ctz32(bits);
+    if(ctl[i]==FREE) free(free()-1);            // Put into empty slot
+    used(used()+1);
+    ctl[i]=TAG(h);
+    table[i].key=ky;
+x:  return table[i].data;
     }
   return *((void**)nullptr);            // Can NOT be referenced; will generate segfault!
   }
@@ -240,37 +326,17 @@ x:  return table[x].data;
 
 // Return constant reference to slot assocated with given key
 void *const& FXHash::at(const void* ky) const {
-  if(__likely(LEGAL(ky))){
-    FXuval p,b,x;
-    p=b=HASH(ky);
-    while(table[x=p&(no()-1)].key){
-      if(__likely(table[x].key==ky)) return table[x].data;      // Return existing slot
-      p=(p<<2)+p+b+1;
-      b>>=BSHIFT;
-      }
-    }
+  FXival pos=find(ky);
+  if(0<=pos) return table[pos].data;    // Return existing slot
   return EMPTY[0].data;                 // Can be safely referenced, will read as NULL
   }
 
 
 // Remove association from the table
 void* FXHash::remove(const void* ky){
-  void* old=nullptr;
-  if(__likely(LEGAL(ky))){
-    FXuval p,b,x;
-    p=b=HASH(ky);
-    while(table[x=p&(no()-1)].key!=ky){
-      if(!table[x].key) goto x;
-      p=(p<<2)+p+b+1;
-      b>>=BSHIFT;
-      }
-    old=table[x].data;
-    table[x].key=VOID;          // Void the slot (not empty!)
-    table[x].data=nullptr;
-    used(used()-1);
-    if(__unlikely(used()<=(no()>>2))) resize(no()>>1);
-    }
-x:return old;
+  FXival pos=find(ky);
+  if(0<=pos) return erase(pos);
+  return nullptr;
   }
 
 
@@ -279,9 +345,18 @@ void* FXHash::erase(FXival pos){
   void* old=nullptr;
   if(__unlikely(pos<0 || no()<=pos)){ throw FXRangeException("FXHash::erase: argument out of range\n"); }
   if(__likely(LEGAL(table[pos].key))){
+    FXuchar* ctl=CONTROL(table,no());
     old=table[pos].data;
-    table[pos].key=VOID;        // Void the slot (not empty!)
     table[pos].data=nullptr;
+    if(matchgroup(ctl+(pos&~(GROUP-1)),FREE)&VALID(no())){
+      table[pos].key=nullptr;   // Free the slot; no probe sequence passes through its group
+      ctl[pos]=FREE;
+      free(free()+1);
+      }
+    else{
+      table[pos].key=VOID;      // Void the slot (not empty!)
+      ctl[pos]=VOIDED;
+      }
     used(used()-1);
     if(__unlikely(used()<=(no()>>2))) resize(no()>>1);
     }
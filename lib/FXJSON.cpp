@@ -23,6 +23,7 @@
 #include "fxdefs.h"
 #include "fxchar.h"
 #include "fxmath.h"
+#include "fxendian.h"
 #include "fxascii.h"
 #include "fxunicode.h"
 #include "FXElement.h"
@@ -228,6 +229,22 @@
     as those character sequences are not actually equal to those few UTF8 sequences
     we care about!
 
+  - Runs of spaces, and of plain characters in strings, are skipped over 16 bytes
+    at a time, and line and column are advanced by the length of the run; only
+    characters which may change the line, or which advance the column differently,
+    such as tabs and UTF8 sequences, are handled one at a time.
+
+  - Decimal numbers are converted in the same pass which scans them: up to 19
+    significant digits are collected, with the decimal exponent, and converted
+    to double with correct rounding (see fxstrtod.cpp); longer numbers are
+    converted from the text.
+
+  - The pull parser keeps a stack of the maps and arrays it's in, and a state which
+    says what may come next; it reads no further than the token reported, so that
+    the text of the token may be referred to in the buffer until the next pull().
+    Strings which don't fit in the buffer are collected in value instead.  The
+    loader is built on top of the pull parser, so both report the same errors.
+
   - When saving, ver=5 forces JSON5 output mode.  In this mode, keys are written w/o
     quotes; it is upon the user to ensure that keys follow proper identifier syntax
     if the json5 file is to be loaded correctly.
@@ -236,6 +253,23 @@
 // Line termination length
 #define ENDLINELENGTH (sizeof(ENDLINE)-1)
 
+// Pull parser states
+enum {
+  StateValue,           // Expect value
+  StateDone,            // Value complete
+  StateArray,           // Expect first element or ']'
+  StateArrayNext,       // Expect ',' or ']'
+  StateMap,             // Expect first key or '}'
+  StateMapColon,        // Expect ':' and value
+  StateMapNext          // Expect ',' or '}'
+  };
+
+// Pull parser nesting
+enum {
+  NestArray,            // In array
+  NestMap               // In map
+  };
+
 using namespace FX;
 
 /*******************************************************************************/
@@ -245,6 +279,9 @@ namespace FX {
 // Maximum token size
 const FXuval MAXTOKEN=256;
 
+// Maximum significant digits of numbers converted in one pass
+const FXint MAXDIGITS=19;
+
 
 // Error messages
 const FXchar *const FXJSON::errors[]={
@@ -272,6 +309,7 @@ static const union{ FXulong u; FXdouble f; } dblnan={FXULONG(0x7fffffffffffffff)
 // Furnish our own versions
 extern FXAPI FXlong __strtoll(const FXchar *beg,const FXchar** end=nullptr,FXint base=0,FXbool* ok=nullptr);
 extern FXAPI FXdouble __strtod(const FXchar *beg,const FXchar** end=nullptr,FXbool* ok=nullptr);
+extern FXAPI FXdouble __dectod(FXulong mantissa,FXint exponent);
 
 // Unicode IdentifierStart character category set
 const FXuint IdentStart=(1<<CatLetterUpper)|(1<<CatLetterLower)|(1<<CatLetterTitle)|(1<<CatLetterModifier)|(1<<CatLetterOther)|(1<<CatNumberLetter);
@@ -282,14 +320,59 @@ const FXuint IdentPart=(1<<CatLetterUpper)|(1<<CatLetterLower)|(1<<CatLetterTitl
 
 /*******************************************************************************/
 
+// Return number of spaces at ptr, before end
+static inline FXival spaces(const FXchar* ptr,const FXchar* end){
+  const FXchar* p=ptr;
+#if defined(FOX_HAS_SSE2)
+  FXuint mask;
+  while(p+16<=end){
+    mask=_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p),_mm_set1_epi8(' ')))^0xFFFF;
+    if(mask) return (p-ptr)+ctz32(mask);
+    p+=16;
+    }
+#endif
+  while(p<end && p[0]==' '){
+    p++;
+    }
+  return p-ptr;
+  }
+
+
+// Return number of plain characters in string at ptr, before end; these are
+// the printable ASCII characters, except quotes and backslash
+static inline FXival plainchars(const FXchar* ptr,const FXchar* end){
+  const FXchar* p=ptr;
+#if defined(FOX_HAS_SSE2)
+  __m128i x,y;
+  FXuint mask;
+  while(p+16<=end){
+    x=_mm_loadu_si128((const __m128i*)p);
+    y=_mm_cmplt_epi8(x,_mm_set1_epi8(' '));          // Controls, and non-ASCII as signed
+    y=_mm_or_si128(y,_mm_cmpeq_epi8(x,_mm_set1_epi8('"')));
+    y=_mm_or_si128(y,_mm_cmpeq_epi8(x,_mm_set1_epi8('\'')));
+    y=_mm_or_si128(y,_mm_cmpeq_epi8(x,_mm_set1_epi8('\\')));
+    y=_mm_or_si128(y,_mm_cmpeq_epi8(x,_mm_set1_epi8(0x7F)));
+    mask=_mm_movemask_epi8(y);
+    if(mask) return (p-ptr)+ctz32(mask);
+    p+=16;
+    }
+#endif
+  while(p<end && ' '<=p[0] && p[0]<0x7F && p[0]!='"' && p[0]!='\'' && p[0]!='\\'){
+    p++;
+    }
+  return p-ptr;
+  }
+
+/*******************************************************************************/
+
 // Construct JSON serializer
-FXJSON::FXJSON():offset(0),token(TK_EOF),column(0),indent(0),line(1),wrap(80),quote('"'),flow(Compact),prec(15),fmt(2),esc(0),dent(2),ver(4){
+FXJSON::FXJSON():textptr(nullptr),textlen(0),mantissa(0),exponent(0),digits(0),offset(0),token(TK_EOF),column(0),indent(0),line(1),wrap(80),quote('"'),flow(Compact),prec(0),fmt(2),esc(0),dent(2),ver(4),state(StateValue),sign(0){
   FXTRACE((100,"FXJSON::FXJSON\n"));
   }
 
 
 // Construct and open for loading
-FXJSON::FXJSON(FXchar* buffer,FXuval sz,Direction d):FXParseBuffer(buffer,sz,d),offset(0),token(TK_EOF),column(0),indent(0),line(1),wrap(80),quote('"'),flow(Compact),prec(15),fmt(2),esc(0),dent(2),ver(4){
+FXJSON::FXJSON(FXchar* buffer,FXuval sz,Direction d):FXParseBuffer(buffer,sz,d),textptr(nullptr),textlen(0),mantissa(0),exponent(0),digits(0),offset(0),token(TK_EOF),column(0),indent(0),line(1),wrap(80),quote('"'),flow(Compact),prec(0),fmt(2),esc(0),dent(2),ver(4),state(StateValue),sign(0){
   FXTRACE((100,"FXJSON::FXJSON(%p,%lu,%s)\n",buffer,sz,(d==Save)?"Save":(d==Load)?"Load":"Stop"));
   open(buffer,sz,d);
   }
@@ -300,7 +383,12 @@ FXbool FXJSON::open(FXchar* buffer,FXuval sz,Direction d){
   FXTRACE((101,"FXJSON::open(%p,%lu,%s)\n",buffer,sz,(d==Save)?"Save":(d==Load)?"Load":"Stop"));
   if(FXParseBuffer::open(buffer,sz,d)){
     value=FXString::null;
+    nest.clear();
+    textptr=nullptr;
+    textlen=0;
     token=TK_ERROR;
+    state=StateValue;
+    sign=0;
     offset=0;
     column=0;
     line=1;
@@ -316,6 +404,9 @@ FXbool FXJSON::close(){
   FXTRACE((101,"FXJSON::close()\n"));
   if(FXParseBuffer::close()){
     value=FXString::null;
+    nest.clear();
+    textptr=nullptr;
+    textlen=0;
     return true;
     }
   return false;
@@ -327,10 +418,12 @@ FXbool FXJSON::close(){
 FXJSON::Token FXJSON::next(){
   Token tok=TK_EOF;
   FXint comment=0;
+  FXint exp,nex;
+  FXival n;
   FXuchar c;
 
   // While more data
-  while(need(MAXTOKEN)){
+  while(sptr+MAXTOKEN<=wptr || need(MAXTOKEN)){
 
     // Start new token
     tok=TK_ERROR;
@@ -343,8 +436,12 @@ FXJSON::Token FXJSON::next(){
         offset++;
         sptr++;
         continue;
-      case ' ':                                         // Space
-        column++;
+      case ' ':                                         // Spaces
+        n=spaces(sptr,wptr);
+        column+=(FXint)n;
+        offset+=n;
+        sptr+=n;
+        continue;
       case '\v':                                        // Vertical tab
       case '\f':                                        // Form feed
         offset++;
@@ -491,7 +588,19 @@ cmt:    column++;                                       // Comments
       case '8':
       case '9':
         tok=TK_INT;
-        while('0'<= sptr[0] && sptr[0]<='9'){
+        mantissa=0;
+        exponent=0;
+        digits=0;
+        while('0'<= sptr[0] && sptr[0]<='9'){           // Collect significant digits
+          if(mantissa || sptr[0]!='0'){                 // as we go, to convert numbers
+            if(digits<MAXDIGITS){                       // without going over them again
+              mantissa=mantissa*10+(sptr[0]-'0');
+              }
+            else{
+              exponent++;
+              }
+            digits++;
+            }
           tok=TK_INT;
           column++;
           offset++;
@@ -499,12 +608,25 @@ cmt:    column++;                                       // Comments
           }
         //FALL//
       case '.':                                         // Fraction
+        if(tok==TK_ERROR){
+          mantissa=0;
+          exponent=0;
+          digits=0;
+          }
         if(sptr[0]=='.'){
           column++;
           offset++;
           sptr++;
           if(tok==TK_INT) tok=TK_REAL;
           while('0'<= sptr[0] && sptr[0]<='9'){
+            if(digits<MAXDIGITS){
+              mantissa=mantissa*10+(sptr[0]-'0');
+              exponent--;
+              if(mantissa) digits++;
+              }
+            else{
+              digits++;
+              }
             tok=TK_REAL;
             column++;
             offset++;
@@ -517,6 +639,8 @@ cmt:    column++;                                       // Comments
             column++;
             offset++;
             sptr++;
+            exp=0;
+            nex=(sptr[0]=='-');
             if(sptr[0]=='-' || sptr[0]=='+'){
               column++;
               offset++;
@@ -524,11 +648,13 @@ cmt:    column++;                                       // Comments
               }
             tok=TK_ERROR;
             while('0'<= sptr[0] && sptr[0]<='9'){
+              if(exp<100000) exp=exp*10+(sptr[0]-'0');
               tok=TK_REAL;
               column++;
               offset++;
               sptr++;
               }
+            exponent+=nex?-exp:exp;
             }
           return tok;
           }
@@ -735,7 +861,7 @@ FXJSON::Token FXJSON::ident(){
   FXuint charset=IdentStart;
   FXuchar c,cc;
   value=FXString::null;
-  while(need(MAXTOKEN)){
+  while(sptr+MAXTOKEN<=wptr || need(MAXTOKEN)){
     switch((c=sptr[0])){
       case 'a':                                         // Identifier characters
       case 'b':
@@ -907,11 +1033,22 @@ end:    value.append(rptr,(FXint)(sptr-rptr));          // Reserved words can be
 FXJSON::Token FXJSON::string(){
   FXuchar q=rptr[0];
   FXuchar c;
+  FXival n;
   column++;
   offset++;
   sptr++;
   value=FXString::null;
-  while(need(MAXTOKEN)){
+  while(sptr+MAXTOKEN<=wptr || need(MAXTOKEN)){
+    if((n=plainchars(sptr,wptr))!=0){                   // Plain characters in bulk
+      column+=(FXint)n;
+      offset+=n;
+      sptr+=n;
+      if(sptr+MAXTOKEN>wptr && wptr==endptr){           // Big token handling
+        value.append(rptr,(FXint)(sptr-rptr));
+        rptr=sptr;
+        }
+      continue;
+      }
     switch((c=sptr[0])){
       case '\t':                                        // Tab hops to next tabstop
         column+=(8-column%8);
@@ -932,7 +1069,14 @@ FXJSON::Token FXJSON::string(){
         offset++;
         sptr++;
         if(q!=c) break;                                 // Opening quote?
+        if(value.empty()){                              // Refer to string in buffer
+          textptr=rptr+1;
+          textlen=(FXint)(sptr-rptr-2);
+          return TK_STRING;
+          }
         value.append(rptr,(FXint)(sptr-rptr));          // Copy tail-end of string
+        textptr=value.text()+1;
+        textlen=value.length()-2;
         return TK_STRING;
       case '\\':                                        // Escape next character
         column++;
@@ -1142,206 +1286,281 @@ FXJSON::Token FXJSON::string(){
   }
 
 
-// Load map elements int o var
+// Pull next event
+FXJSON::Error FXJSON::pull(Event& event){
+  if(dir!=Load) return ErrLoad;
+  switch(state){
+    case StateDone:                             // Nothing after the value
+      event=EventEnd;
+      return ErrOK;
+    case StateArrayNext:                        // Expect ',' or ']'
+      token=next();
+      if(token==TK_RBRACK) goto end;
+      if(token!=TK_COMMA) return ErrBracket;
+      //FALL//
+    case StateArray:                            // Expect element or ']'
+      token=next();
+      if(token==TK_EOF) return ErrEnd;
+      if(token==TK_RBRACK) goto end;
+      if(token<TK_NAN || TK_LBRACE<token) return ErrBracket;
+      goto val;
+    case StateMapNext:                          // Expect ',' or '}'
+      token=next();
+      if(token==TK_RBRACE) goto end;
+      if(token!=TK_COMMA) return ErrBrace;
+      //FALL//
+    case StateMap:                              // Expect key or '}'
+
+      // Allow either string (old JSON), or identifier (JSON5)
+      // syntax (this includes reserved words such as null, true
+      // false, etc, as there can be no confusion here).
+      token=next();
+      if(token==TK_EOF) return ErrEnd;
+      if(token==TK_RBRACE) goto end;
+      if(token<TK_IDENT || TK_STRING<token) return ErrBrace;
+      if(token!=TK_STRING){
+        textptr=value.text();
+        textlen=value.length();
+        }
+      state=StateMapColon;
+      event=EventKey;
+      return ErrOK;
+    case StateMapColon:                         // Expect ':' and value
+      token=next();
+      if(token==TK_EOF) return ErrEnd;
+      if(token!=TK_COLON) return ErrColon;
+      //FALL//
+    default:                                    // Expect value
+      token=next();
+      break;
+    }
+
+  // Value; here reserved words have special meanings,
+  // and identifiers are not allowed
+val:
+  sign=0;
+  if(token==TK_PLUS || token==TK_MINUS){
+    sign=(token==TK_MINUS);
+    token=next();
+    if(token==TK_EOF) return ErrEnd;
+    if(token!=TK_INT && token!=TK_HEX && token!=TK_REAL && token!=TK_INF && token!=TK_NAN) return ErrToken;
+    }
+  switch(token){
+    case TK_EOF:                                // Unexpected end of file
+      return ErrEnd;
+    case TK_NULL:                               // Null
+      event=EventNull;
+      break;
+    case TK_FALSE:                              // False
+    case TK_TRUE:                               // True
+      event=EventBool;
+      break;
+    case TK_INT:                                // Integer
+    case TK_HEX:                                // Hex
+      event=EventInt;
+      break;
+    case TK_REAL:                               // Real
+    case TK_INF:                                // Infinity
+    case TK_NAN:                                // NaN
+      event=EventReal;
+      break;
+    case TK_STRING:                             // String
+      event=EventString;
+      break;
+    case TK_LBRACK:                             // Array
+      nest.append(NestArray);
+      textptr=rptr;
+      textlen=1;
+      state=StateArray;
+      event=EventBeginArray;
+      return ErrOK;
+    case TK_LBRACE:                             // Map
+      nest.append(NestMap);
+      textptr=rptr;
+      textlen=1;
+      state=StateMap;
+      event=EventBeginMap;
+      return ErrOK;
+    case TK_IDENT:                              // Unexpected identifier
+      return ErrIdent;
+    default:                                    // Illegal token
+      return ErrToken;
+    }
+  if(TK_NAN<=token && token<=TK_TRUE){          // Reserved words
+    textptr=value.text();
+    textlen=value.length();
+    }
+  else if(token!=TK_STRING){                    // Numbers
+    textptr=rptr;
+    textlen=(FXint)(sptr-rptr);
+    }
+  goto nxt;
+
+  // End of map or array
+end:
+  nest.pop();
+  textptr=rptr;
+  textlen=1;
+  event=(token==TK_RBRACK)?EventEndArray:EventEndMap;
+
+  // What may come after the value
+nxt:
+  if(nest.no()==0) state=StateDone;
+  else if(nest.tail()==NestArray) state=StateArrayNext;
+  else state=StateMapNext;
+  return ErrOK;
+  }
+
+
+// Skip rest of innermost map or array
+FXJSON::Error FXJSON::skip(){
+  FXint depth=getDepth();
+  Error err=ErrOK;
+  Event event;
+  while(depth<=getDepth() && 0<getDepth()){
+    if((err=pull(event))!=ErrOK) break;
+    }
+  return err;
+  }
+
+
+// Return pulled key or string, decoded
+FXString FXJSON::getString() const {
+  if(token==TK_STRING) return FXString::unescape(textptr,textlen);
+  return FXString(textptr,textlen);
+  }
+
+
+// Return pulled integer
+FXlong FXJSON::getLong() const {
+  FXlong result;
+  switch(token){
+    case TK_TRUE:
+      return 1;
+    case TK_INT:
+      if(digits<MAXDIGITS){                     // Collected while scanning
+        result=(FXlong)mantissa;
+        return sign?-result:result;
+        }
+      result=__strtoll(FXString(textptr,textlen).text(),nullptr,10);   // Token isn't terminated in buffer
+      return sign?-result:result;
+    case TK_HEX:
+      result=__strtoll(FXString(textptr,textlen).text(),nullptr,16);
+      return sign?-result:result;
+    case TK_REAL:
+      return (FXlong)getDouble();
+    default:
+      return 0;
+    }
+  return 0;
+  }
+
+
+// Return pulled real
+FXdouble FXJSON::getDouble() const {
+  FXdouble result;
+  switch(token){
+    case TK_TRUE:
+      return 1.0;
+    case TK_INT:
+    case TK_HEX:
+      return (FXdouble)getLong();
+    case TK_REAL:
+      if(digits<=MAXDIGITS){                    // Collected while scanning
+        result=__dectod(mantissa,exponent);
+        break;
+        }
+      result=__strtod(FXString(textptr,textlen).text(),nullptr);       // Token isn't terminated in buffer
+      break;
+    case TK_INF:
+      result=dblinf.f;
+      break;
+    case TK_NAN:
+      result=dblnan.f;
+      break;
+    default:
+      return 0.0;
+    }
+  return sign?-result:result;
+  }
+
+
+// Load map elements into var
 FXJSON::Error FXJSON::loadMap(FXVariant& var){
   FXString key;
+  Event event;
   Error err;
 
-  // Make it into an array now
+  // Make it into a map now
   var.setType(FXVariant::MapType);
 
-  // Parse key : value pairs
-  // Allow either string (old JSON), or identifier (JSON5)
-  // syntax (this includes reserved words such as null, true
-  // false, etc, as there can be no confusion here).
-  while(TK_IDENT<=token && token<=TK_STRING){
+  // Parse key : value pairs up to the end of the map
+  while((err=pull(event))==ErrOK && event==EventKey){
 
     // Decode the keys
-    if(token==TK_STRING){
-      key=FXString::unescape(value,value.head(),value.tail());
-      }
-    else{
-      key=value;
-      }
+    key=getString();
 
     // Check for duplicates
     if(var.has(key)) return ErrDuplicate;
 
-    // Token following the string
-    token=next();
-    if(token==TK_EOF) return ErrEnd;
-
-    // Expect colon
-    if(token!=TK_COLON) return ErrColon;
-
-    // Eat the colon
-    token=next();
-    if(token==TK_EOF) return ErrEnd;
+    // The value following the colon
+    if((err=pull(event))!=ErrOK) return err;
 
     // Load item directly into associated slot
-    if((err=loadVariant(var[key]))!=ErrOK) return err;
-
-    // Expect another key-value pair
-    if(token!=TK_COMMA) break;
-
-    // Eat the comma
-    token=next();
-    if(token==TK_EOF) return ErrEnd;
+    if((err=loadVariant(var[key],event))!=ErrOK) return err;
     }
-  return ErrOK;
+  return err;
   }
 
 
 // Load array elements into var
 FXJSON::Error FXJSON::loadArray(FXVariant& var){
   FXival index=0;
+  Event event;
   Error err;
 
   // Make it into an array now
   var.setType(FXVariant::ArrayType);
 
-  // Parse values
-  // Here reserved words have special meanings;
-  // note that identifiers are excluded.
-  while(TK_NAN<=token && token<=TK_LBRACE){
+  // Parse values up to the end of the array
+  while((err=pull(event))==ErrOK && event!=EventEndArray){
 
     // Load item directly into array slot
-    if((err=loadVariant(var[index]))!=ErrOK) return err;
-
-    // Expect another value
-    if(token!=TK_COMMA) break;
-
-    // Next token
-    token=next();
-    if(token==TK_EOF) return ErrEnd;
+    if((err=loadVariant(var[index],event))!=ErrOK) return err;
 
     // Next array index
     index++;
     }
-  return ErrOK;
+  return err;
   }
 
 
-// Load variant
-FXJSON::Error FXJSON::loadVariant(FXVariant& var){
-  Error err;
-  switch(token){
-  case TK_EOF:                                  // Unexpected end of file
-    var=FXVariant::null;
-    return ErrEnd;
-  case TK_PLUS:
-    token=next();
-    if(token==TK_EOF) return ErrEnd;
-    if(token==TK_INT){                          // +Integer
-      var=__strtoll(rptr,nullptr,10);
-      token=next();
-      return ErrOK;
-      }
-    if(token==TK_HEX){                          // +Hexadecimal
-      var=__strtoll(rptr,nullptr,16);
-      token=next();
-      return ErrOK;
-      }
-    if(token==TK_REAL){                         // +Real
-      var=__strtod(rptr,nullptr);
-      token=next();
-      return ErrOK;
-      }
-    if(token==TK_INF){                          // +Infinity
-      var=dblinf.f;
-      token=next();
-      return ErrOK;
-      }
-    if(token==TK_NAN){                          // +NaN
-      var=dblnan.f;
-      token=next();
-      return ErrOK;
-      }
-    return ErrToken;
-  case TK_MINUS:
-    token=next();
-    if(token==TK_EOF) return ErrEnd;
-    if(token==TK_INT){                          // -Integer
-      var=-__strtoll(rptr,nullptr,10);
-      token=next();
-      return ErrOK;
-      }
-    if(token==TK_HEX){                          // -Hexadecimal
-      var=-__strtoll(rptr,nullptr,16);
-      token=next();
-      return ErrOK;
-      }
-    if(token==TK_REAL){                         // -Real
-      var=-__strtod(rptr,nullptr);
-      token=next();
-      return ErrOK;
-      }
-    if(token==TK_INF){                          // -Infinity
-      var=-dblinf.f;
-      token=next();
-      return ErrOK;
-      }
-    if(token==TK_NAN){                          // -NaN
-      var=-dblnan.f;
-      token=next();
-      return ErrOK;
-      }
-    return ErrToken;
-  case TK_NULL:                                 // Null
+// Load variant from pulled event
+FXJSON::Error FXJSON::loadVariant(FXVariant& var,Event event){
+  switch(event){
+  case EventNull:                               // Null
     var=FXVariant::null;
-    token=next();
-    return ErrOK;
-  case TK_FALSE:                                // False
-    var=false;
-    token=next();
     return ErrOK;
-  case TK_TRUE:                                 // True
-    var=true;
-    token=next();
+  case EventBool:                               // True or false
+    var=getBool();
     return ErrOK;
-  case TK_INT:                                  // Integer
-    var=__strtoll(rptr,nullptr,10);
-    token=next();
+  case EventInt:                                // Integer or hex
+    var=getLong();
     return ErrOK;
-  case TK_HEX:                                  // Hex
-    var=__strtoll(rptr,nullptr,16);
-    token=next();
+  case EventReal:                               // Real, infinity, or NaN
+    var=getDouble();
     return ErrOK;
-  case TK_REAL:                                 // Real
-    var=__strtod(rptr,nullptr);
-    token=next();
+  case EventString:                             // String
+    var=getString();
     return ErrOK;
-  case TK_INF:                                  // Infinity
-    var=dblinf.f;
-    token=next();
-    return ErrOK;
-  case TK_NAN:                                  // NaN
-    var=dblnan.f;
-    token=next();
-    return ErrOK;
-  case TK_LBRACK:                               // Array
-    token=next();
-    if(token==TK_EOF) return ErrEnd;
-    if((err=loadArray(var))!=ErrOK) return err;
-    if(token!=TK_RBRACK) return ErrBracket;     // Expected closing bracket
-    token=next();
-    return ErrOK;
-  case TK_LBRACE:                               // Map
-    token=next();
-    if(token==TK_EOF) return ErrEnd;
-    if((err=loadMap(var))!=ErrOK) return err;
-    if(token!=TK_RBRACE) return ErrBrace;       // Expected closing brace
-    token=next();
-    return ErrOK;
-  case TK_STRING:                               // String
-    var=FXString::unescape(value,value.head(),value.tail());
-    token=next();
-    return ErrOK;
-  case TK_IDENT:                                // Unexpected identifier
-    var=FXVariant::null;
-    return ErrIdent;
-  default:                                      // Illegal token
+  case EventBeginArray:                         // Array
+    return loadArray(var);
+  case EventBeginMap:                           // Map
+    return loadMap(var);
+  case EventEnd:                                // Nothing left
     var=FXVariant::null;
+    return ErrEnd;
+  default:                                      // Key or end of map or array
     return ErrToken;
     }
   return ErrToken;
@@ -1352,9 +1571,9 @@ FXJSON::Error FXJSON::loadVariant(FXVariant& var){
 FXJSON::Error FXJSON::load(FXVariant& variant){
   FXTRACE((101,"FXJSON::load(variant)\n"));
   Error err=ErrLoad;
-  if(dir==Load){
-    token=next();
-    err=loadVariant(variant);
+  Event event;
+  if((err=pull(event))==ErrOK){
+    err=loadVariant(variant,event);
     }
   return err;
   }
@@ -1608,8 +1827,13 @@ FXJSON::Error FXJSON::saveVariant(const FXVariant& var){
     offset+=string.length();
     break;
   case FXVariant::FloatType:
+    string.fromFloat((FXfloat)var.asDouble(),prec?prec:-1,fmt);
+    if(!emit(string.text(),string.length())) return ErrSave;
+    column+=string.length();
+    offset+=string.length();
+    break;
   case FXVariant::DoubleType:
-    string.fromDouble(var.asDouble(),prec,fmt);
+    string.fromDouble(var.asDouble(),prec?prec:-1,fmt);
     if(!emit(string.text(),string.length())) return ErrSave;
     column+=string.length();
     offset+=string.length();
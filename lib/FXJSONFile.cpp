@@ -31,6 +31,7 @@
 #include "FXIODevice.h"
 #include "FXStat.h"
 #include "FXFile.h"
+#include "FXMappedFile.h"
 #include "FXParseBuffer.h"
 #include "FXException.h"
 #include "FXVariant.h"
@@ -43,6 +44,16 @@
   Notes:
 
   - JSON Serialization to a file.
+  - When loading a file larger than the buffer, the whole file is memory-mapped and parsed
+    in place, so it is neither copied nor shuffled around in the buffer; fill() then has
+    nothing to do, and need() is just a bounds check.
+  - The parser expects a zero byte at the end of the data, as fill() normally puts there;
+    the remainder of the last page of a map is zero-filled, but if the file size is a
+    multiple of 4096, the smallest page size, there may be no such remainder, so these
+    files are read into the buffer instead.
+  - A mapped file which is truncated by someone else while we're parsing it will crash
+    the parser (SIGBUS); files which are being rewritten in place should not be parsed
+    while being written, mapped or otherwise.
 */
 
 using namespace FX;
@@ -69,6 +80,12 @@ FXbool FXJSONFile::open(const FXString& filename,Direction d,FXuval sz){
   FXTRACE((101,"FXJSONFile::open(\"%s\",%s,%ld)\n",filename.text(),(d==Save)?"Save":(d==Load)?"Load":"Stop",sz));
   if(dir==Stop){
     FXchar *buffer;
+    if(d==Load && sz<(FXuval)FXStat::size(filename) && map.open(filename,FXIO::Reading)){
+      if((map.length()&4095) && FXJSON::open((FXchar*)map.data(),map.length(),d)){
+        return true;
+        }
+      map.close();
+      }
     if(allocElms(buffer,sz)){
       if(file.open(filename,(d==Save)?FXIO::Writing:FXIO::Reading,FXIO::AllReadWrite)){
         if(FXJSON::open(buffer,sz,d)){
@@ -90,6 +107,7 @@ FXbool FXJSONFile::open(const FXString& filename,Direction d,FXuval sz){
 FXival FXJSONFile::fill(FXival){
   if(dir==Load){
     FXival nbytes;
+    if(map.data()) return wptr-sptr;            // Whole file is mapped
     moveElms(begptr,rptr,wptr-rptr);
     wptr=begptr+(wptr-rptr);
     sptr=begptr+(sptr-rptr);
@@ -129,6 +147,7 @@ FXbool FXJSONFile::close(){
   FXTRACE((101,"FXJSONFile::close()\n"));
   FXchar *buffer=begptr;
   if(FXJSON::close()){
+    if(map.data()) return map.close();
     freeElms(buffer);
     return file.close();
     }
@@ -0,0 +1,127 @@
+/********************************************************************************
+*                                                                               *
+*                M a p p e d   F i l e   S t r e a m   C l a s s                *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+*********************************************************************************
+* This library is free software; you can redistribute it and/or modify          *
+* it under the terms of the GNU Lesser General Public License as published by   *
+* the Free Software Foundation; either version 3 of the License, or             *
+* (at your option) any later version.                                           *
+*                                                                               *
+* This library is distributed in the hope that it will be useful,               *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of                *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the                 *
+* GNU Lesser General Public License for more details.                           *
+*                                                                               *
+* You should have received a copy of the GNU Lesser General Public License      *
+* along with this program.  If not, see <http://www.gnu.org/licenses/>          *
+********************************************************************************/
+#include "xincs.h"
+#include "fxver.h"
+#include "fxdefs.h"
+#include "fxmath.h"
+#include "FXElement.h"
+#include "FXMetaClass.h"
+#include "FXHash.h"
+#include "FXStream.h"
+#include "FXString.h"
+#include "FXIO.h"
+#include "FXIODevice.h"
+#include "FXMappedFile.h"
+#include "FXMappedFileStream.h"
+
+
+/*
+  Notes:
+  - The mapping is the stream's buffer, with the write pointer at the end of
+    the file; readBuffer() thus never has anything more to add.
+  - Arrays are loaded with a single memcpy() from the mapping, or byte-swapped
+    while being copied out of it.
+  - Accessing pages past the end of a file which has been truncated by another
+    process after it was mapped raises SIGBUS.
+*/
+
+
+using namespace FX;
+
+
+/*******************************************************************************/
+
+namespace FX {
+
+
+// Create mapped file stream
+FXMappedFileStream::FXMappedFileStream(const FXObject* cont):FXStream(cont){
+  }
+
+
+// Create and open mapped file stream
+FXMappedFileStream::FXMappedFileStream(const FXString& filename){
+  open(filename);
+  }
+
+
+// Can't save to mapped file stream
+FXuval FXMappedFileStream::writeBuffer(FXuval){
+  fxerror("FXMappedFileStream::writeBuffer: wrong stream direction.\n");
+  return 0;
+  }
+
+
+// Whole file is already in the buffer
+FXuval FXMappedFileStream::readBuffer(FXuval){
+  return wrptr-rdptr;
+  }
+
+
+// Open mapped file stream
+FXbool FXMappedFileStream::open(const FXString& filename){
+  if(!dir){
+    if(!map.open(filename,FXIO::Reading)){
+      code=FXStreamNoRead;
+      return false;
+      }
+    if(!FXStream::open(FXStreamLoad,(FXuchar*)map.data(),map.length(),false)){
+      map.close();
+      return false;
+      }
+    wrptr=endptr;
+    return true;
+    }
+  return false;
+  }
+
+
+// Close mapped file stream
+FXbool FXMappedFileStream::close(){
+  if(dir){
+    map.close();
+    return FXStream::close();
+    }
+  return false;
+  }
+
+
+// Move to position
+FXbool FXMappedFileStream::position(FXlong offset,FXWhence whence){
+  if(dir==FXStreamDead){ fxerror("FXMappedFileStream::position: stream is not open.\n"); }
+  if(code==FXStreamOK){
+    if(whence==FXFromCurrent) offset=offset+pos;
+    else if(whence==FXFromEnd) offset=offset+(endptr-begptr);
+    if(offset<0 || begptr+offset>endptr){ setError(FXStreamEnd); return false; }
+    rdptr=begptr+offset;
+    pos=offset;
+    return true;
+    }
+  return false;
+  }
+
+
+// Destructor
+FXMappedFileStream::~FXMappedFileStream(){
+  close();
+  }
+
+}
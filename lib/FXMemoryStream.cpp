@@ -32,7 +32,7 @@
 
 /*
   Notes:
-  - Also need memory mapped file stream.
+  - Memory mapped files are loaded with FXMappedFileStream.
 */
 
 
@@ -49,6 +49,9 @@
     the size of the buffer must be at least equal to length, but may be the same.
   - End-of-file is signified as a partially filled buffer; thus, subclasses must
     initialize rptr, wptr, and sptr to endptr at the start.
+  - A memory-mapped file may be passed as the buffer, much like an in-memory buffer;
+    as wptr starts out at endptr, the whole file is available, and need() reduces to
+    a bounds check.
 */
 
 using namespace FX;
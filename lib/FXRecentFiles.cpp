@@ -174,9 +174,10 @@ long FXRecentFiles::onCmdClear(FXObject*,FXSelector,void*){
 
 // User clicks on one of the file names
 long FXRecentFiles::onCmdFile(FXObject*,FXSelector sel,void*){
-  const FXchar *filename=settings->readStringEntry(group,key[FXSELID(sel)-ID_FILE_1],nullptr);
-  if(filename){
-    if(target){ target->handle(this,FXSEL(SEL_COMMAND,message),(void*)filename); }
+  const FXchar *name=settings->readStringEntry(group,key[FXSELID(sel)-ID_FILE_1],nullptr);
+  if(name){
+    FXString filename(name);    // Copy; target may update the recent files list
+    if(target){ target->handle(this,FXSEL(SEL_COMMAND,message),(void*)filename.text()); }
     }
   return 1;
   }
@@ -34,6 +34,7 @@
 #include "FXIO.h"
 #include "FXStat.h"
 #include "FXFile.h"
+#include "FXMappedFile.h"
 #include "FXDir.h"
 #include "FXStringDictionary.h"
 #include "FXRegistry.h"
@@ -141,6 +142,53 @@
       o Otherwise, it will have the default value: "~/.config".
 
 
+  - Snapshot of settings:
+
+      o After the settings files have been parsed, the merged settings are saved in a
+        binary snapshot file next to the Per-User application settings file, along with
+        the names, sizes, and modification times of all settings files which were tried.
+
+      o Next time, if the same files are tried and none of them has changed (or has
+        appeared or disappeared), the settings are loaded from the memory-mapped snapshot
+        instead; this replaces the scanning, unescaping, and repeated overriding of
+        entries from up to six text files by a single pass over the snapshot.
+
+      o The files are stat-ed before they're parsed, so a file changed while being
+        parsed will cause the snapshot to be rejected next time.
+
+      o The settings from the Per-User application settings file, the only one which
+        is written back, are saved in the snapshot apart from the merged settings of
+        all other files; loading the snapshot merges them just like parsing would.
+
+      o Reading the settings does not mark them as modified, so the Per-User settings
+        file, and thus the snapshot, stays as it is unless the application changes
+        something.  When write() does replace the settings file, the snapshot is
+        updated by keeping the merged settings of the other files, if these files
+        are unchanged, and replacing the application settings by the marked ones
+        just written.  The merged settings in memory can't be used for this, as an
+        entry deleted by the application would come back from another file when
+        the files are parsed.
+
+      o The snapshot is native-endian, and starts with a magic number and version
+        number; sizes and strings are checked while loading it, and anything amiss
+        causes the snapshot to be rejected and the settings files to be parsed instead.
+        It is written to a temporary file first and then renamed, so it is never
+        changed underneath a process which has it mapped.
+
+      o Snapshot layout:
+
+          "FXRC"                        Magic
+          version                       FXuint
+          number of files               FXuint
+            size, time                  FXlong, FXlong (-1, 0 if file didn't exist)
+            name                        FXuint length, characters, '\0'
+          other settings, then application settings:
+            number of sections          FXuint
+              name                      FXuint length, characters, '\0'
+              number of entries         FXuint
+                key                     FXuint length, characters, '\0'
+                value                   FXuint length, characters, '\0'
+
   - The Freedesktop.org XDG standard is found at:
 
         http://standards.freedesktop.org/basedir-spec/basedir-spec-latest.html
@@ -167,13 +215,17 @@
 #define SYSTEMDIRS      "C:\\Program Files;C:\\Windows"
 #define USERDIR         "%USERPROFILE%\\fox"
 #define FILEEXT         ".ini"
+#define SNAPSHOTEXT     ".ini.cache"
 #else
 #define FOXRC           "fox.rc"
 #define SYSTEMDIRS      "/etc/xdg"
 #define USERDIR         "~/.config"
 #define FILEEXT         ".rc"
+#define SNAPSHOTEXT     ".rc.cache"
 #endif
 
+#define SNAPSHOTVERSION 2               // Snapshot format version
+
 using namespace FX;
 
 /*******************************************************************************/
@@ -189,8 +241,12 @@ const FXchar FXRegistry::ext[]=FILEEXT;
 const FXchar FXRegistry::foxrc[]=FOXRC;
 
 
+// File extension for snapshot of settings
+const FXchar FXRegistry::snapshotext[]=SNAPSHOTEXT;
+
+
 // Make registry object
-FXRegistry::FXRegistry(const FXString& akey,const FXString& vkey):applicationkey(akey),vendorkey(vkey),systemdirs(SYSTEMDIRS),userdir(USERDIR){
+FXRegistry::FXRegistry(const FXString& akey,const FXString& vkey):applicationkey(akey),vendorkey(vkey),systemdirs(SYSTEMDIRS),userdir(USERDIR),snapshot(true){
 #if defined(WIN32)
   ascii=false;
 #else
@@ -275,7 +331,9 @@ FXbool FXRegistry::readFromRegistryGroup(const FXString& group,FXptr hbase,FXboo
         // Read key-value pairs
         while(RegEnumValueA(hsection,index,name,&namesize,nullptr,&type,(BYTE*)value,&valuesize)!=ERROR_NO_MORE_ITEMS){
           FXASSERT(type==REG_SZ);
-          at(section).at(name,mrk)=value;
+          FXString& entry=at(section).at(name,mrk);
+          entry=value;
+          entry.reserve(FXString::SHORTLEN+1);                  // Keep text on heap, as FXSettings does
           namesize=MAXNAME;
           valuesize=MAXVALUE;
           index++;
@@ -410,69 +468,346 @@ x:    continue;
 
 /*******************************************************************************/
 
-// Read registry
-FXbool FXRegistry::read(){
-  FXbool ok=false;
-  if(ascii){
-    FXString path;
+// Return size and modification time of file, or -1 and 0 if it doesn't exist
+static void stampFile(const FXString& file,FXlong* stamp){
+  FXStat info;
+  stamp[0]=-1;
+  stamp[1]=0;
+  if(FXStat::statFile(file,info)){
+    stamp[0]=info.size();
+    stamp[1]=info.modified();
+    }
+  }
 
-    // Read system-wide settings from systemdirs
-    if(!systemdirs.empty()){
 
-      // Find common settings
-      path=FXPath::search(systemdirs,FOXRC);
-      if(!path.empty()){
-        if(parseFile(path,false)) ok=true;
+// Fetch number from snapshot
+static FXbool fetchNumber(const FXuchar*& ptr,const FXuchar* end,void* num,FXuval size){
+  if(size<=(FXuval)(end-ptr)){
+    memcpy(num,ptr,size);
+    ptr+=size;
+    return true;
+    }
+  return false;
+  }
+
+
+// Fetch null-terminated string from snapshot, and return it in place
+static const FXchar* fetchString(const FXuchar*& ptr,const FXuchar* end,FXuint& len){
+  if(fetchNumber(ptr,end,&len,sizeof(len)) && len<(FXuval)(end-ptr) && ptr[len]=='\0'){
+    const FXchar* str=(const FXchar*)ptr;
+    ptr+=len+1;
+    return str;
+    }
+  return nullptr;
+  }
+
+
+// Fetch snapshot header, and check that the snapshot was made from the given
+// settings files; the first count of them must be unchanged since
+static FXbool fetchHeader(const FXuchar*& ptr,const FXuchar* end,const FXString* files,const FXlong* stamps,FXint num,FXint count){
+  const FXchar* name;
+  FXuint version,number,len,f;
+  FXlong stamp[2];
+  if(end-ptr<4 || memcmp(ptr,"FXRC",4)!=0) return false;
+  ptr+=4;
+  if(!fetchNumber(ptr,end,&version,sizeof(version)) || version!=SNAPSHOTVERSION) return false;
+  if(!fetchNumber(ptr,end,&number,sizeof(number)) || number!=(FXuint)num) return false;
+  for(f=0; f<number; ++f){
+    if(!fetchNumber(ptr,end,stamp,sizeof(stamp))) return false;
+    if(f<(FXuint)count && (stamp[0]!=stamps[2*f] || stamp[1]!=stamps[2*f+1])) return false;
+    if((name=fetchString(ptr,end,len))==nullptr) return false;
+    if(files[f].length()!=(FXint)len || FXString::compare(files[f].text(),name,len)!=0) return false;
+    }
+  return true;
+  }
+
+
+// Fetch settings from snapshot into settings, or only check them if null
+static FXbool fetchSettings(const FXuchar*& ptr,const FXuchar* end,FXSettings* settings,FXbool mrk){
+  const FXchar *section,*name,*value;
+  FXuint sections,entries,len,s,e;
+  if(!fetchNumber(ptr,end,&sections,sizeof(sections))) return false;
+  for(s=0; s<sections; ++s){
+    if((section=fetchString(ptr,end,len))==nullptr || len==0) return false;
+    if(!fetchNumber(ptr,end,&entries,sizeof(entries))) return false;
+    for(e=0; e<entries; ++e){
+      if((name=fetchString(ptr,end,len))==nullptr || len==0) return false;
+      if((value=fetchString(ptr,end,len))==nullptr) return false;
+      if(settings){
+        FXString& entry=settings->at(section).at(name,mrk);
+        entry.assign(value,len);
+        entry.reserve(FXString::SHORTLEN+1);                    // Keep text on heap, as FXSettings does
         }
+      }
+    }
+  return true;
+  }
 
-      // Have vendor subdirectory
-      if(!vendorkey.empty()){
 
-        // Find vendor subdirectory
-        path=FXPath::search(systemdirs,vendorkey);
-        if(!path.empty()){
+// Append number to snapshot
+static void appendNumber(FXString& buffer,const void* num,FXint size){
+  buffer.append((const FXchar*)num,size);
+  }
 
-          // Try read vendor settings
-          if(parseFile(path+PATHSEPSTRING+vendorkey+ext,false)) ok=true;
 
-          // Try read application settings
-          if(!applicationkey.empty()){
-            if(parseFile(path+PATHSEPSTRING+applicationkey+ext,false)) ok=true;
+// Append string to snapshot, with its length and a terminating null
+static void appendString(FXString& buffer,const FXString& str){
+  FXuint len=str.length();
+  appendNumber(buffer,&len,sizeof(len));
+  buffer.append(str.text(),len);
+  buffer.append('\0');
+  }
+
+
+// Append snapshot header, with the settings files and their state
+static void appendHeader(FXString& buffer,const FXString* files,const FXlong* stamps,FXint num){
+  FXuint version=SNAPSHOTVERSION;
+  FXuint number=num;
+  FXint f;
+  buffer.append("FXRC",4);
+  appendNumber(buffer,&version,sizeof(version));
+  appendNumber(buffer,&number,sizeof(number));
+  for(f=0; f<num; ++f){
+    appendNumber(buffer,stamps+2*f,2*sizeof(FXlong));
+    appendString(buffer,files[f]);
+    }
+  }
+
+
+// Append sections with at least one entry to snapshot; if marked is
+// set, only the marked entries are appended
+static void appendSettings(FXString& buffer,const FXSettings& settings,FXbool marked){
+  FXint pos=buffer.length();
+  FXuint sections=0;
+  FXuint entries;
+  FXival s,e;
+  appendNumber(buffer,&sections,sizeof(sections));
+  for(s=0; s<settings.no(); ++s){
+    if(!settings.empty(s)){
+      const FXStringDictionary& dict=settings.data(s);
+      for(e=entries=0; e<dict.no(); ++e){
+        if(!dict.empty(e) && (!marked || dict.mark(e))) entries++;
+        }
+      if(entries){
+        appendString(buffer,settings.key(s));
+        appendNumber(buffer,&entries,sizeof(entries));
+        for(e=0; e<dict.no(); ++e){
+          if(!dict.empty(e) && (!marked || dict.mark(e))){
+            appendString(buffer,dict.key(e));
+            appendString(buffer,dict.data(e));
             }
           }
+        sections++;
+        }
+      }
+    }
+  memcpy(buffer.text()+pos,&sections,sizeof(sections));
+  }
+
+
+// Save snapshot; write to a temporary file first, then rename it
+static FXbool saveSnapshot(const FXString& cache,const FXString& buffer){
+  FXString tempfile(cache+"_"+FXString::value(FXProcess::current()));
+  FXFile file(tempfile,FXIO::Writing);
+  if(file.isOpen()){
+    if(file.writeBlock(buffer.text(),buffer.length())==buffer.length() && file.close()){
+      if(FXFile::move(tempfile,cache,true)) return true;
+      }
+    file.close();
+    FXFile::remove(tempfile);
+    }
+  return false;
+  }
+
+
+// Load snapshot of settings, if it was made from the given settings files
+// in their current state; the whole snapshot is checked before any setting
+// is loaded from it, so nothing is changed if it is rejected
+FXbool FXRegistry::readSnapshot(const FXString& cache,const FXString* files,const FXlong* stamps,FXint num){
+  FXTRACE((100,"FXRegistry::readSnapshot(%s)\n",cache.text()));
+  FXMappedFile map;
+  if(map.open(cache,FXIO::Reading)){
+    const FXuchar* ptr=(const FXuchar*)map.data();
+    const FXuchar* end=ptr+map.length();
+    const FXuchar* beg;
+    if(fetchHeader(ptr,end,files,stamps,num,num)){
+      beg=ptr;
+      if(fetchSettings(ptr,end,nullptr,false) && fetchSettings(ptr,end,nullptr,true) && ptr==end){
+        ptr=beg;
+        fetchSettings(ptr,end,this,false);
+        fetchSettings(ptr,end,this,true);
+        return true;
+        }
+      }
+    }
+  return false;
+  }
+
+
+// Save snapshot of settings, and of the settings files they were read from;
+// the settings read so far come from all but the last file, the per-user
+// application settings file, whose settings are saved after them
+FXbool FXRegistry::writeSnapshot(const FXString& cache,const FXString* files,const FXlong* stamps,FXint num,const FXSettings& app) const {
+  FXTRACE((100,"FXRegistry::writeSnapshot(%s)\n",cache.text()));
+  FXString buffer;
+  appendHeader(buffer,files,stamps,num);
+  appendSettings(buffer,*this,false);
+  appendSettings(buffer,app,false);
+  return saveSnapshot(cache,buffer);
+  }
+
+
+// Update snapshot after the per-user application settings file has been
+// written; the settings from the other files are kept from the snapshot, if
+// these files are unchanged, and followed by the marked settings just written
+FXbool FXRegistry::updateSnapshot(const FXString& cache,const FXString* files,const FXlong* stamps,FXint num) const {
+  FXTRACE((100,"FXRegistry::updateSnapshot(%s)\n",cache.text()));
+  FXMappedFile map;
+  FXString buffer;
+  if(map.open(cache,FXIO::Reading)){
+    const FXuchar* ptr=(const FXuchar*)map.data();
+    const FXuchar* end=ptr+map.length();
+    const FXuchar* beg;
+    if(fetchHeader(ptr,end,files,stamps,num,num-1)){
+      beg=ptr;
+      if(fetchSettings(ptr,end,nullptr,false)){
+        appendHeader(buffer,files,stamps,num);
+        buffer.append((const FXchar*)beg,(FXint)(ptr-beg));
         }
+      }
+    map.close();
+    }
+  if(!buffer.empty()){
+    appendSettings(buffer,*this,true);
+    return saveSnapshot(cache,buffer);
+    }
+  return false;
+  }
+
+
+// Find settings files, system-wide ones first, then per-user ones; later ones
+// override earlier ones.  If the last one is the per-user application settings
+// file, which is written back, the snapshot file is returned next to it
+FXint FXRegistry::settingsFiles(FXString* files,FXString& cache) const {
+  FXString path;
+  FXint num=0;
 
-      // Have application settings only
-      else if(!applicationkey.empty()){
+  // Find system-wide settings in systemdirs
+  if(!systemdirs.empty()){
 
-        // Find applications settings
-        path=FXPath::search(systemdirs,applicationkey+ext);
+    // Find common settings
+    path=FXPath::search(systemdirs,FOXRC);
+    if(!path.empty()){
+      files[num++]=path;
+      }
+
+    // Have vendor subdirectory
+    if(!vendorkey.empty()){
 
-        // Try read application settings
-        if(!path.empty()){
-          if(parseFile(path,false)) ok=true;
+      // Find vendor subdirectory
+      path=FXPath::search(systemdirs,vendorkey);
+      if(!path.empty()){
+
+        // Try vendor settings
+        files[num++]=path+PATHSEPSTRING+vendorkey+ext;
+
+        // Try application settings
+        if(!applicationkey.empty()){
+          files[num++]=path+PATHSEPSTRING+applicationkey+ext;
           }
         }
       }
 
-    // Read per-user settings from userdir
-    if(!userdir.empty()){
+    // Have application settings only
+    else if(!applicationkey.empty()){
 
-      // Path to settings data
-      path=FXPath::absolute(FXPath::expand(userdir));
+      // Find applications settings
+      path=FXPath::search(systemdirs,applicationkey+ext);
+      if(!path.empty()){
+        files[num++]=path;
+        }
+      }
+    }
 
-      // Try read common settings
-      if(parseFile(path+PATHSEPSTRING FOXRC,false)) ok=true;
+  // Find per-user settings in userdir
+  if(!userdir.empty()){
 
-      // Try read vendor settings
-      if(!vendorkey.empty()){
-        path.append(PATHSEPSTRING+vendorkey);
-        if(parseFile(path+PATHSEPSTRING+vendorkey+ext,false)) ok=true;
+    // Path to settings data
+    path=FXPath::absolute(FXPath::expand(userdir));
+
+    // Try common settings
+    files[num++]=path+PATHSEPSTRING FOXRC;
+
+    // Try vendor settings
+    if(!vendorkey.empty()){
+      path.append(PATHSEPSTRING+vendorkey);
+      files[num++]=path+PATHSEPSTRING+vendorkey+ext;
+      }
+
+    // Try application settings; these are written back
+    if(!applicationkey.empty()){
+      files[num++]=path+PATHSEPSTRING+applicationkey+ext;
+      cache=path+PATHSEPSTRING+applicationkey+snapshotext;
+      }
+    }
+  return num;
+  }
+
+
+// Read registry
+FXbool FXRegistry::read(){
+  FXbool mod=isModified();
+  FXbool ok=false;
+  if(ascii){
+    FXString files[6];
+    FXlong   stamps[12];
+    FXString cache;
+    FXint    num,last,i;
+    FXival   s,e;
+
+    // Find settings files
+    num=settingsFiles(files,cache);
+
+    // Note state of settings files before reading them
+    for(i=0; i<num; ++i){
+      stampFile(files[i],stamps+2*i);
+      }
+
+    // Load snapshot, if settings files are unchanged
+    if(snapshot && !cache.empty() && readSnapshot(cache,files,stamps,num)){
+      ok=true;
+      }
+
+    // Otherwise, parse settings files; later ones override earlier ones
+    else{
+      last=cache.empty()?num:num-1;
+      for(i=0; i<last; ++i){
+        if(parseFile(files[i],false)) ok=true;
         }
 
-      // Try read application settings
-      if(!applicationkey.empty()){
-        if(parseFile(path+PATHSEPSTRING+applicationkey+ext,true)) ok=true;
+      // Per-user application settings are marked to be written back; they're
+      // parsed separately, so the snapshot can keep them apart from the others
+      if(last<num){
+        FXSettings app;
+        if(app.parseFile(files[last],true)) ok=true;
+
+        // Save snapshot for next time
+        if(ok && snapshot){
+          writeSnapshot(cache,files,stamps,num,app);
+          }
+
+        // Application settings override the others
+        for(s=0; s<app.no(); ++s){
+          if(!app.empty(s)){
+            for(e=0; e<app.data(s).no(); ++e){
+              if(!app.data(s).empty(e)){
+                FXString& entry=at(app.key(s)).at(app.data(s).key(e),true);
+                entry.adopt(app.data(s).data(e));
+                entry.reserve(FXString::SHORTLEN+1);            // Keep text on heap, as FXSettings does
+                }
+              }
+            }
+          }
         }
       }
     }
@@ -485,6 +820,9 @@ FXbool FXRegistry::read(){
     if(readFromRegistry(HKEY_CURRENT_USER,true)) ok=true;
     }
 #endif
+
+  // Reading settings doesn't count as changing them
+  setModified(mod);
   return ok;
   }
 
@@ -529,6 +867,19 @@ FXbool FXRegistry::write(){
               if(FXFile::move(tempfile,realfile,true)){
                 setModified(false);
                 ok=true;
+
+                // Snapshot no longer matches; update it with the settings just written
+                if(snapshot){
+                  FXString files[6];
+                  FXlong   stamps[12];
+                  FXString cache;
+                  FXint    num,i;
+                  num=settingsFiles(files,cache);
+                  for(i=0; i<num; ++i){
+                    stampFile(files[i],stamps+2*i);
+                    }
+                  updateSnapshot(cache,files,stamps,num);
+                  }
                 }
               }
             }
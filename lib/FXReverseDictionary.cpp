@@ -48,9 +48,8 @@ using namespace FX;
 namespace FX {
 
 // Empty dictionary table value
-extern const FXint __string__empty__[];
 extern const FXival __reversedictionary__empty__[];
-const FXival __reversedictionary__empty__[5]={1,0,1,0,(FXival)(__string__empty__+1)};
+const FXival __reversedictionary__empty__[7]={1,0,1,0,0,0,0};
 
 
 // Resize buffer for the dictionary.
@@ -119,14 +118,14 @@ FXbool FXReverseDictionary::resize(FXival n){
 // Initialize dictionary to empty.
 FXReverseDictionary::FXReverseDictionary():table(EMPTY){
   FXASSERT(sizeof(FXReverseDictionary)==sizeof(void*));
-  FXASSERT(sizeof(Entry)<=sizeof(FXival)*2);
+  FXASSERT(sizeof(Entry)<=sizeof(FXival)*4);
   }
 
 
 // Copy constructor initializes this dictionary with the data from another.
 FXReverseDictionary::FXReverseDictionary(const FXReverseDictionary& other):table(EMPTY){
   FXASSERT(sizeof(FXReverseDictionary)==sizeof(void*));
-  FXASSERT(sizeof(Entry)<=sizeof(FXival)*2);
+  FXASSERT(sizeof(Entry)<=sizeof(FXival)*4);
   if(1<other.no()){
     if(!no(other.no())){ throw FXMemoryException("FXReverseDictionary::FXReverseDictionary: out of memory\n"); }
     copyElms(table,other.table,no());
@@ -23,6 +23,7 @@
 #include "fxdefs.h"
 #include "fxchar.h"
 #include "fxmath.h"
+#include "fxendian.h"
 #include "fxascii.h"
 #include "fxunicode.h"
 #include "FXElement.h"
@@ -33,6 +34,7 @@
 #include "FXString.h"
 #include "FXException.h"
 #include "FXRex.h"
+#include "FXRexCore.h"
 
 
 /*
@@ -197,6 +199,56 @@
       and scans backward.
 
 
+  Lock-Step Simulation
+  ====================
+
+  Backtracking may take exponential time, for example "(a|aa)*b" against a long run of "a"'s,
+  and needs recursion proportional to the length of the match for complex repeats.  Programs
+  which use no back references, lookarounds, atomic groups, possessive repeats, or counters may
+  also be run by simulating all threads of the backtracking matcher in lock-step, one subject
+  character at a time (a.k.a. Pike VM).
+
+  The simulation runs directly off the same program.  Threads are kept in order of priority, i.e.
+  the order in which the backtracking matcher would try them, and a thread arriving at a state
+  (opcode, character of a literal run, or count of a simple repeat) already visited at this point
+  in the subject string is dropped, as it can only do what the higher-priority thread already
+  does.  Each thread carries its own captures; when a thread reaches the end of the program,
+  all threads of lower priority are cut off.  Thus, matches and captures come out exactly as
+  with backtracking, while the time is bounded by the length of the subject string times the
+  number of states.  When searching forward, a new lowest-priority thread is started at each
+  position, so the whole search takes a single pass.
+
+  Backtracking is usually faster, so programs which can be simulated are first backtracked with a
+  budget of steps proportional to the number of states times the length of the subject string;
+  only when the budget, or the recursion limit, runs out is the match redone by simulation.
+
+
+  Search Acceleration
+  ===================
+
+  Before searching, the program is scanned for the set of bytes with which a match may start,
+  and for a literal string which every match must contain.  If the literal starts every match,
+  possibly after some assertions, searching is done by finding the literal; otherwise, matches
+  are only attempted at positions with a possible first byte, up to the last position from
+  which the literal still occurs further on.  Literals are found by comparing both their first
+  and their last byte 16 positions at a time with SSE2, and memchr() otherwise, after which the
+  candidate is verified.  A literal must occur in the match if every path through the program
+  passes through it; literals inside lookarounds, atomic groups, or optional repeats don't count.
+
+
+  Segmented Input
+  ===============
+
+  The lock-step simulation reads the subject string strictly forwards, one byte at a time,
+  and its assertions only look at the bytes just before and at the current position; that is
+  why it carries no pointers into the string, only positions.  So the string may just as well
+  be delivered in pieces by an FXRexInput: the simulation keeps the current piece and the last
+  byte of the one before it, and asks for the next piece when it runs off the end of the current
+  one.  Thus a stream may be searched while it is being read, and a gap buffer without moving
+  the gap.  Backtracking and backward searches need random access to the string, and so the
+  input is gathered into a contiguous string first.
+
+
   Grammar:
   ========
 
@@ -535,6 +587,12 @@
 // Maximum number of pieces reversed
 #define MAXPIECES     256
 
+// Maximum number of states simulated in lock-step
+#define MAXSTATES     4096
+
+// Maximum number of literals tested for search acceleration
+#define MAXTESTS      16
+
 // Access to opcode
 #define SETOP(p,op)   (*(p)=(op))
 
@@ -1022,6 +1080,12 @@ static const FXuchar nondelimset[32]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
   };
 
+// Set of non-ascii characters
+static const FXuchar highset[32]={
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
+  };
+
 /*******************************************************************************/
 
 // Include character in set
@@ -2475,6 +2539,686 @@ FXRex::Error FXReverse::charset(){
 
 /*******************************************************************************/
 
+// Add bytes which may be matched by single-character opcode at prog to set;
+// returns pointer past the opcode, or NULL if opcode is not understood
+static const FXchar* firstchar(const FXchar* prog,FXuchar set[]){
+  FXint ch;
+  switch(*prog++){
+    case OP_ANY:
+      for(ch=0; ch<256; ++ch){ if(ch!='\n') INCL(set,ch); }
+      return prog;
+    case OP_ANY_NL:
+      for(ch=0; ch<256; ++ch){ INCL(set,ch); }
+      return prog;
+    case OP_IN:
+      UNION(set,(const FXuchar*)prog);
+      return prog+32;
+    case OP_NOT_IN:
+      for(ch=0; ch<256; ++ch){ if(!ISIN(prog,ch)) INCL(set,ch); }
+      return prog+32;
+    case OP_ANY_OF:
+      for(ch=1; ch<=(FXuchar)prog[0]; ++ch){ INCL(set,prog[ch]); }
+      return prog+1+(FXuchar)prog[0];
+    case OP_ANY_BUT:
+      for(ch=0; ch<256; ++ch){ if(!LIST(prog,ch)) INCL(set,ch); }
+      return prog+1+(FXuchar)prog[0];
+    case OP_RNG:
+      for(ch=(FXuchar)prog[0]; ch<=(FXuchar)prog[1]; ++ch){ INCL(set,ch); }
+      return prog+2;
+    case OP_NOT_RNG:
+      for(ch=0; ch<256; ++ch){ INCL(set,ch); }
+      return prog+2;
+    case OP_UPPER:
+      UNION(set,upperset);
+      return prog;
+    case OP_LOWER:
+      UNION(set,lowerset);
+      return prog;
+    case OP_SPACE:
+    case OP_SPACE_NL:
+      UNION(set,spaceset);
+      return prog;
+    case OP_NOT_SPACE:
+      UNION(set,nonspaceset);
+      UNION(set,highset);
+      return prog;
+    case OP_DIGIT:
+      UNION(set,digitset);
+      return prog;
+    case OP_NOT_DIGIT:
+    case OP_NOT_DIGIT_NL:
+      UNION(set,nondigitset);
+      UNION(set,highset);
+      INCL(set,'\n');
+      return prog;
+    case OP_HEX:
+      UNION(set,hexdigitset);
+      return prog;
+    case OP_NOT_HEX:
+    case OP_NOT_HEX_NL:
+      UNION(set,nonhexdigitset);
+      UNION(set,highset);
+      INCL(set,'\n');
+      return prog;
+    case OP_LETTER:
+      UNION(set,letterset);
+      return prog;
+    case OP_NOT_LETTER:
+    case OP_NOT_LETTER_NL:
+      UNION(set,nonletterset);
+      UNION(set,highset);
+      INCL(set,'\n');
+      return prog;
+    case OP_PUNCT:
+      UNION(set,delimset);
+      return prog;
+    case OP_NOT_PUNCT:
+    case OP_NOT_PUNCT_NL:
+      UNION(set,nondelimset);
+      UNION(set,highset);
+      INCL(set,'\n');
+      return prog;
+    case OP_WORD:
+      UNION(set,wordset);
+      return prog;
+    case OP_NOT_WORD:
+    case OP_NOT_WORD_NL:
+      UNION(set,nonwordset);
+      UNION(set,highset);
+      INCL(set,'\n');
+      return prog;
+    case OP_CHAR:
+      INCL(set,prog[0]);
+      return prog+1;
+    case OP_CHAR_CI:
+      INCL(set,Ascii::toLower(prog[0]));
+      INCL(set,Ascii::toUpper(prog[0]));
+      return prog+1;
+    }
+  return nullptr;
+  }
+
+
+// Add bytes which may start a match of the program at prog to set; returns true
+// if the end of the (sub-)program may be reached without consuming any bytes.
+// Assertions and look-arounds are assumed to succeed, and backward jumps (which
+// only occur in loops) end the path, as the loop head has already been visited.
+// When in doubt, all bytes are added to the set.
+static FXbool firstset(const FXchar* prog,FXuchar set[],FXint depth){
+  FXint ch,rep_min;
+  FXshort arg;
+  FXuchar op;
+  if(depth<MAXRECURSION){
+nxt:op=*prog++;
+    switch(op){
+      case OP_FAIL:
+        return false;
+      case OP_PASS:
+        return true;
+      case OP_JUMP:
+        if((arg=GETARG(prog))<0) return false;
+        prog+=arg;
+        goto nxt;
+      case OP_BRANCH:
+      case OP_BRANCHREV:
+        if((arg=GETARG(prog))<0){
+          return firstset(prog+2,set,depth+1);
+          }
+        if(firstset(prog+2,set,depth+1)){
+          firstset(prog+arg,set,depth+1);
+          return true;
+          }
+        prog+=arg;
+        goto nxt;
+      case OP_ATOMIC:
+      case OP_UNTIL:
+        if(!firstset(prog+2,set,depth+1)) return false;
+        prog+=GETARG(prog);
+        goto nxt;
+      case OP_IF:
+      case OP_WHILE:
+        firstset(prog+2,set,depth+1);
+        prog+=GETARG(prog);
+        goto nxt;
+      case OP_FOR:
+        if(!firstset(prog+6,set,depth+1) && 0<GETARG(prog+2)) return false;
+        prog+=GETARG(prog);
+        goto nxt;
+      case OP_AHEAD_NEG:
+      case OP_AHEAD_POS:
+      case OP_BEHIND_NEG:
+      case OP_BEHIND_POS:
+        prog+=GETARG(prog);
+        goto nxt;
+      case OP_NOT_EMPTY:
+      case OP_STR_BEG:
+      case OP_STR_END:
+      case OP_LINE_BEG:
+      case OP_LINE_END:
+      case OP_WORD_BEG:
+      case OP_WORD_END:
+      case OP_WORD_BND:
+      case OP_WORD_INT:
+      case OP_UWORD_BEG:
+      case OP_UWORD_END:
+      case OP_UWORD_BND:
+      case OP_UWORD_INT:
+        goto nxt;
+      case OP_CHARS:
+        INCL(set,prog[2]);
+        return false;
+      case OP_CHARS_CI:
+        INCL(set,Ascii::toLower(prog[2]));
+        INCL(set,Ascii::toUpper(prog[2]));
+        return false;
+      case OP_STAR:
+      case OP_MIN_STAR:
+      case OP_POS_STAR:
+      case OP_QUEST:
+      case OP_MIN_QUEST:
+      case OP_POS_QUEST:
+        if((prog=firstchar(prog,set))==nullptr) break;
+        goto nxt;
+      case OP_PLUS:
+      case OP_MIN_PLUS:
+      case OP_POS_PLUS:
+        if(firstchar(prog,set)==nullptr) break;
+        return false;
+      case OP_REP:
+      case OP_MIN_REP:
+      case OP_POS_REP:
+        rep_min=GETARG(prog);
+        if((prog=firstchar(prog+4,set))==nullptr) break;
+        if(0<rep_min) return false;
+        goto nxt;
+      case OP_SUB_BEG_0:
+      case OP_SUB_BEG_1:
+      case OP_SUB_BEG_2:
+      case OP_SUB_BEG_3:
+      case OP_SUB_BEG_4:
+      case OP_SUB_BEG_5:
+      case OP_SUB_BEG_6:
+      case OP_SUB_BEG_7:
+      case OP_SUB_BEG_8:
+      case OP_SUB_BEG_9:
+      case OP_SUB_END_0:
+      case OP_SUB_END_1:
+      case OP_SUB_END_2:
+      case OP_SUB_END_3:
+      case OP_SUB_END_4:
+      case OP_SUB_END_5:
+      case OP_SUB_END_6:
+      case OP_SUB_END_7:
+      case OP_SUB_END_8:
+      case OP_SUB_END_9:
+      case OP_ZERO_0:
+      case OP_ZERO_1:
+      case OP_ZERO_2:
+      case OP_ZERO_3:
+      case OP_ZERO_4:
+      case OP_ZERO_5:
+      case OP_ZERO_6:
+      case OP_ZERO_7:
+      case OP_ZERO_8:
+      case OP_ZERO_9:
+      case OP_INCR_0:
+      case OP_INCR_1:
+      case OP_INCR_2:
+      case OP_INCR_3:
+      case OP_INCR_4:
+      case OP_INCR_5:
+      case OP_INCR_6:
+      case OP_INCR_7:
+      case OP_INCR_8:
+      case OP_INCR_9:
+        goto nxt;
+      case OP_JUMPLT_0:
+      case OP_JUMPLT_1:
+      case OP_JUMPLT_2:
+      case OP_JUMPLT_3:
+      case OP_JUMPLT_4:
+      case OP_JUMPLT_5:
+      case OP_JUMPLT_6:
+      case OP_JUMPLT_7:
+      case OP_JUMPLT_8:
+      case OP_JUMPLT_9:
+      case OP_JUMPGT_0:
+      case OP_JUMPGT_1:
+      case OP_JUMPGT_2:
+      case OP_JUMPGT_3:
+      case OP_JUMPGT_4:
+      case OP_JUMPGT_5:
+      case OP_JUMPGT_6:
+      case OP_JUMPGT_7:
+      case OP_JUMPGT_8:
+      case OP_JUMPGT_9:
+        if(0<(arg=GETARG(prog+2))){
+          if(firstset(prog+4,set,depth+1)){
+            firstset(prog+2+arg,set,depth+1);
+            return true;
+            }
+          prog+=2+arg;
+          goto nxt;
+          }
+        prog+=4;
+        goto nxt;
+      default:
+        if((prog=firstchar(prog-1,set))==nullptr) break;
+        return false;
+      }
+    }
+
+  // Don't know; anything goes
+  for(ch=0; ch<256; ++ch){ INCL(set,ch); }
+  return true;
+  }
+
+/*******************************************************************************/
+
+// Return pointer past single-character opcode at prog, or NULL if opcode at
+// prog is not a single-character opcode
+static const FXchar* skipchar(const FXchar* prog){
+  switch(*prog++){
+    case OP_ANY:
+    case OP_ANY_NL:
+    case OP_UPPER:
+    case OP_LOWER:
+    case OP_SPACE:
+    case OP_SPACE_NL:
+    case OP_NOT_SPACE:
+    case OP_DIGIT:
+    case OP_NOT_DIGIT:
+    case OP_NOT_DIGIT_NL:
+    case OP_HEX:
+    case OP_NOT_HEX:
+    case OP_NOT_HEX_NL:
+    case OP_LETTER:
+    case OP_NOT_LETTER:
+    case OP_NOT_LETTER_NL:
+    case OP_PUNCT:
+    case OP_NOT_PUNCT:
+    case OP_NOT_PUNCT_NL:
+    case OP_WORD:
+    case OP_NOT_WORD:
+    case OP_NOT_WORD_NL:
+      return prog;
+    case OP_IN:
+    case OP_NOT_IN:
+      return prog+32;
+    case OP_ANY_OF:
+    case OP_ANY_BUT:
+      return prog+1+(FXuchar)prog[0];
+    case OP_RNG:
+    case OP_NOT_RNG:
+      return prog+2;
+    case OP_CHAR:
+    case OP_CHAR_CI:
+      return prog+1;
+    }
+  return nullptr;
+  }
+
+
+// Return true if single-character opcode at prog matches byte ch; this mirrors
+// the tests performed by the matcher exactly
+static FXbool onechar(const FXchar* prog,FXuchar ch){
+  switch(*prog++){
+    case OP_ANY: return ch!='\n';
+    case OP_ANY_NL: return true;
+    case OP_IN: return ISIN(prog,ch)!=0;
+    case OP_NOT_IN: return ISIN(prog,ch)==0;
+    case OP_ANY_OF: return LIST(prog,ch);
+    case OP_ANY_BUT: return !LIST(prog,ch);
+    case OP_RNG: return (FXuchar)prog[0]<=ch && ch<=(FXuchar)prog[1];
+    case OP_NOT_RNG: return ch<(FXuchar)prog[0] || ch>(FXuchar)prog[1];
+    case OP_UPPER: return Ascii::isUpper(ch);
+    case OP_LOWER: return Ascii::isLower(ch);
+    case OP_SPACE: return ch!='\n' && Ascii::isSpace(ch);
+    case OP_SPACE_NL: return Ascii::isSpace(ch);
+    case OP_NOT_SPACE: return !Ascii::isSpace(ch);
+    case OP_DIGIT: return Ascii::isDigit(ch);
+    case OP_NOT_DIGIT: return ch!='\n' && !Ascii::isDigit(ch);
+    case OP_NOT_DIGIT_NL: return !Ascii::isDigit(ch);
+    case OP_HEX: return Ascii::isHexDigit(ch);
+    case OP_NOT_HEX: return ch!='\n' && !Ascii::isHexDigit(ch);
+    case OP_NOT_HEX_NL: return !Ascii::isHexDigit(ch);
+    case OP_LETTER: return Ascii::isLetter(ch);
+    case OP_NOT_LETTER: return ch!='\n' && !Ascii::isLetter(ch);
+    case OP_NOT_LETTER_NL: return !Ascii::isLetter(ch);
+    case OP_PUNCT: return Ascii::isDelim(ch);
+    case OP_NOT_PUNCT: return ch!='\n' && !Ascii::isDelim(ch);
+    case OP_NOT_PUNCT_NL: return !Ascii::isDelim(ch);
+    case OP_WORD: return Ascii::isWord(ch);
+    case OP_NOT_WORD: return ch!='\n' && !Ascii::isWord(ch);
+    case OP_NOT_WORD_NL: return !Ascii::isWord(ch);
+    case OP_CHAR: return (FXuchar)prog[0]==ch;
+    case OP_CHAR_CI: return prog[0]==Ascii::toLower(ch);
+    }
+  return false;
+  }
+
+
+// Return length of opcode at prog, or 0 if unknown
+static FXint oplength(const FXchar* prog){
+  const FXchar* ptr;
+  switch(*prog){
+    case OP_JUMP:
+    case OP_BRANCH:
+    case OP_BRANCHREV:
+    case OP_ATOMIC:
+    case OP_IF:
+    case OP_WHILE:
+    case OP_UNTIL:
+    case OP_AHEAD_NEG:
+    case OP_AHEAD_POS:
+    case OP_BEHIND_NEG:
+    case OP_BEHIND_POS:
+      return 3;
+    case OP_FOR:
+      return 7;
+    case OP_CHARS:
+    case OP_CHARS_CI:
+    case OP_UCHARS:
+    case OP_UCHARS_CI:
+      return 3+GETARG(prog+1);
+    case OP_STAR:
+    case OP_MIN_STAR:
+    case OP_POS_STAR:
+    case OP_PLUS:
+    case OP_MIN_PLUS:
+    case OP_POS_PLUS:
+    case OP_QUEST:
+    case OP_MIN_QUEST:
+    case OP_POS_QUEST:
+      return (ptr=skipchar(prog+1))?ptr-prog:0;
+    case OP_REP:
+    case OP_MIN_REP:
+    case OP_POS_REP:
+      return (ptr=skipchar(prog+5))?ptr-prog:0;
+    }
+  if(OP_JUMPLT_0<=*prog && *prog<=OP_JUMPGT_9) return 5;
+  if(OP_FAIL<=*prog && *prog<=OP_UWORD_INT) return 1;
+  if(OP_SUB_BEG_0<=*prog && *prog<=OP_INCR_9) return 1;
+  return (ptr=skipchar(prog))?ptr-prog:0;
+  }
+
+
+// Return true if every path from prog to the end of the program passes through
+// the opcode at offset avoid; bodies of atomic groups, possessive repeats, and
+// lookarounds are skipped, and so can't contain the avoided opcode
+static FXbool mandatory(const FXchar* prog,FXint len,FXint avoid,FXint* stack,FXuchar* seen){
+  FXint sp=0,pc,arg;
+  clearElms(seen,len);
+  stack[sp++]=0;
+  seen[0]=1;
+  while(0<sp){
+    pc=stack[--sp];
+    if(pc==avoid) continue;
+    arg=-1;
+    switch(prog[pc]){
+      case OP_FAIL:
+        continue;
+      case OP_PASS:
+        return false;
+      case OP_JUMP:
+        pc+=1+GETARG(prog+pc+1);
+        break;
+      case OP_BRANCH:
+      case OP_BRANCHREV:
+        arg=pc+1+GETARG(prog+pc+1);
+        pc+=3;
+        break;
+      case OP_ATOMIC:
+      case OP_IF:
+      case OP_WHILE:
+      case OP_UNTIL:
+      case OP_FOR:
+      case OP_AHEAD_NEG:
+      case OP_AHEAD_POS:
+      case OP_BEHIND_NEG:
+      case OP_BEHIND_POS:
+        pc+=1+GETARG(prog+pc+1);
+        break;
+      default:
+        if(OP_JUMPLT_0<=prog[pc] && prog[pc]<=OP_JUMPGT_9){
+          arg=pc+3+GETARG(prog+pc+3);
+          pc+=5;
+          break;
+          }
+        if((arg=oplength(prog+pc))==0) return false;
+        pc+=arg;
+        arg=-1;
+        break;
+      }
+    if(0<=pc && pc<len && !seen[pc]){ seen[pc]=1; stack[sp++]=pc; }
+    if(0<=arg && arg<len && !seen[arg]){ seen[arg]=1; stack[sp++]=arg; }
+    }
+  return true;
+  }
+
+
+// Return literal matched by opcode at prog, and its length; opcodes matching a
+// single character of a simple repeat count if the repeat is at least once
+static const FXchar* literal(const FXchar* prog,FXint& len,FXbool& ci){
+  switch(*prog){
+    case OP_CHARS:
+    case OP_CHARS_CI:
+      len=GETARG(prog+1);
+      ci=(*prog==OP_CHARS_CI);
+      return prog+3;
+    case OP_PLUS:
+    case OP_MIN_PLUS:
+    case OP_POS_PLUS:
+      prog+=1;
+      break;
+    case OP_REP:
+    case OP_MIN_REP:
+    case OP_POS_REP:
+      if(GETARG(prog+1)<1) return nullptr;
+      prog+=5;
+      break;
+    }
+  if(*prog==OP_CHAR || *prog==OP_CHAR_CI){
+    len=1;
+    ci=(*prog==OP_CHAR_CI);
+    return prog+1;
+    }
+  return nullptr;
+  }
+
+/*******************************************************************************/
+
+// Find the bytes which may start a match, and the longest literal every match must
+// pass through, for the search accelerator
+static void accelerate(const FXchar* prog,FXint size,FXAnalysis& an){
+  const FXchar *ptr;
+  FXint *stack,ch,pc,num,n,tests=0;
+  FXbool c;
+
+  an.lit=-1;
+  an.len=0;
+  an.nfew=0;
+  an.ci=false;
+  an.prefix=false;
+
+  // Set of first bytes; a few of them can be searched for at once
+  clearElms(an.set,32);
+  clearElms(an.few,3);
+  an.any=firstset(prog,an.set,0);
+  for(ch=0; ch<256 && an.nfew<=3; ++ch){
+    if(ISIN(an.set,ch)){ if(an.nfew<3) an.few[an.nfew]=ch; an.nfew++; }
+    }
+  if(3<an.nfew) an.nfew=0;
+
+  // Literal preceded only by assertions starts every match
+  for(pc=0; pc<size; pc+=oplength(prog+pc)){
+    if(prog[pc]==OP_PASS || prog[pc]==OP_FAIL) break;
+    if(OP_NOT_EMPTY<=prog[pc] && prog[pc]<=OP_WORD_INT) continue;
+    if(OP_SUB_BEG_0<=prog[pc] && prog[pc]<=OP_SUB_END_9) continue;
+    if((ptr=literal(prog+pc,an.len,an.ci))!=nullptr){ an.lit=(FXint)(ptr-prog); an.prefix=true; return; }
+    break;
+    }
+
+  // Else, find the longest literal every match must pass through
+  if(allocElms(stack,size+size)){
+    for(pc=0; pc<size; pc+=n){
+      if((n=oplength(prog+pc))==0) break;
+      if((ptr=literal(prog+pc,num,c))!=nullptr && an.len<num && tests++<MAXTESTS && mandatory(prog,size,pc,stack,(FXuchar*)(stack+size))){
+        an.lit=(FXint)(ptr-prog);
+        an.len=num;
+        an.ci=c;
+        }
+      }
+    freeElms(stack);
+    }
+  }
+
+
+// Search accelerator; using the analysis of the program, it skips to positions
+// where a match may start.  If the literal starts every match, searching reduces
+// to finding the literal; otherwise, each candidate start position must be followed
+// by the literal somewhere.
+class FXPrefilter {
+  const FXAnalysis &an;             // Analysis of program
+  const FXchar     *lit;            // Literal which must occur in every match
+  const FXchar     *req;            // Where literal was last found
+private:
+  const FXchar* skip(const FXchar* ptr,const FXchar* end) const;
+  const FXchar* find(const FXchar* ptr,const FXchar* end) const;
+public:
+
+  // Use analysis of program
+  FXPrefilter(const FXchar* prog,const FXAnalysis& a):an(a),lit((0<=a.lit)?prog+a.lit:nullptr),req(nullptr){ }
+
+  // Return true if we can rule out any position
+  FXbool useful() const { return !an.any || 0<an.len; }
+
+  // Return true if the literal occurs in [ptr,end)
+  FXbool possible(const FXchar* ptr,const FXchar* end) const { return an.len==0 || find(ptr,end); }
+
+  // Return true if a match may start at ptr
+  FXbool candidate(const FXchar* ptr,const FXchar* end) const { return an.any || (ptr<end && ISIN(an.set,*ptr)); }
+
+  // Return true if a match may start with byte ch
+  FXbool starts(FXuchar ch) const { return an.any || ISIN(an.set,ch); }
+
+  // Return first position in [ptr,end) where a match may start, judging by [ptr,end) only
+  const FXchar* scan(const FXchar* ptr,const FXchar* end) const;
+
+  // Return first position in [ptr,to] where a match may start, or NULL
+  const FXchar* next(const FXchar* ptr,const FXchar* to,const FXchar* end);
+  };
+
+
+// Skip to first byte in [ptr,end) which may start a match, or end
+const FXchar* FXPrefilter::skip(const FXchar* ptr,const FXchar* end) const {
+  if(an.nfew==1){
+    ptr=(const FXchar*)memchr(ptr,an.few[0],end-ptr);
+    return ptr?ptr:end;
+    }
+#if defined(FOX_HAS_SSE2)
+  if(1<an.nfew){
+    __m128i c0=_mm_set1_epi8(an.few[0]);
+    __m128i c1=_mm_set1_epi8(an.few[1]);
+    __m128i c2=_mm_set1_epi8(an.few[an.nfew-1]);
+    __m128i v;
+    FXuint mask;
+    while(ptr+16<=end){
+      v=_mm_loadu_si128((const __m128i*)ptr);
+      mask=_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v,c0),_mm_cmpeq_epi8(v,c1)),_mm_cmpeq_epi8(v,c2)));
+      if(mask) return ptr+ctz32(mask);
+      ptr+=16;
+      }
+    }
+#endif
+  while(ptr<end && !ISIN(an.set,*ptr)) ptr++;
+  return ptr;
+  }
+
+
+// Find literal in [ptr,end), return NULL if not found
+const FXchar* FXPrefilter::find(const FXchar* ptr,const FXchar* end) const {
+  const FXchar* last=end-an.len;
+  FXint i;
+  if(!an.ci){
+    if(an.len==1) return (const FXchar*)memchr(ptr,lit[0],end-ptr);
+#if defined(FOX_HAS_SSE2)
+    __m128i c0=_mm_set1_epi8(lit[0]);
+    __m128i c1=_mm_set1_epi8(lit[an.len-1]);
+    FXuint mask;
+    while(ptr+16<=last+1){                      // Check first and last bytes 16 positions at a time
+      mask=_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)ptr),c0),_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(ptr+an.len-1)),c1)));
+      while(mask){
+        i=ctz32(mask);
+        if(memcmp(ptr+i+1,lit+1,an.len-2)==0) return ptr+i;
+        mask&=mask-1;
+        }
+      ptr+=16;
+      }
+#endif
+    while(ptr<=last){
+      if((ptr=(const FXchar*)memchr(ptr,lit[0],last-ptr+1))==nullptr) break;
+      if(memcmp(ptr+1,lit+1,an.len-1)==0) return ptr;
+      ptr++;
+      }
+    return nullptr;
+    }
+#if defined(FOX_HAS_SSE2)
+  __m128i f0=_mm_set1_epi8(Ascii::isLetter(lit[0])?0x20:0);
+  __m128i f1=_mm_set1_epi8(Ascii::isLetter(lit[an.len-1])?0x20:0);
+  __m128i c0=_mm_set1_epi8(lit[0]);
+  __m128i c1=_mm_set1_epi8(lit[an.len-1]);
+  FXuint mask;
+  while(ptr+16<=last+1){                        // Same, with letters folded to lower case
+    mask=_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(_mm_or_si128(_mm_loadu_si128((const __m128i*)ptr),f0),c0),_mm_cmpeq_epi8(_mm_or_si128(_mm_loadu_si128((const __m128i*)(ptr+an.len-1)),f1),c1)));
+    while(mask){
+      i=ctz32(mask);
+      for(FXint j=0; Ascii::toLower(ptr[i+j])==lit[j]; ){ if(++j==an.len) return ptr+i; }
+      mask&=mask-1;
+      }
+    ptr+=16;
+    }
+#endif
+  while(ptr<=last){
+    for(i=0; Ascii::toLower(ptr[i])==lit[i]; ){ if(++i==an.len) return ptr; }
+    ptr++;
+    }
+  return nullptr;
+  }
+
+
+// Return first position in [ptr,end) where a match may start, or end, judging by the
+// bytes in [ptr,end) only; so a literal starting a match may also straddle end
+const FXchar* FXPrefilter::scan(const FXchar* ptr,const FXchar* end) const {
+  const FXchar* p;
+  if(an.prefix){
+    if((p=find(ptr,end))!=nullptr) return p;
+    return (ptr<end-an.len+1)?end-an.len+1:ptr;
+    }
+  if(!an.any) return skip(ptr,end);
+  return ptr;
+  }
+
+
+// Return first position in [ptr,to] where a match may start, or NULL
+const FXchar* FXPrefilter::next(const FXchar* ptr,const FXchar* to,const FXchar* end){
+  if(an.prefix){
+    ptr=find(ptr,(to+an.len<end)?to+an.len:end);
+    return ptr;
+    }
+  while(ptr<=to){
+    if(!an.any){
+      ptr=skip(ptr,(to<end)?to+1:end);
+      if(to<ptr || end<=ptr) return nullptr;
+      }
+    if(an.len==0 || (req && ptr<=req)) return ptr;
+    if((req=find(ptr,end))==nullptr) return nullptr;
+    }
+  return nullptr;
+  }
+
+/*******************************************************************************/
+
 // Structure used during matching
 class FXExecute {
   const FXchar  *anc;               // Anchor point
@@ -2489,16 +3233,23 @@ class FXExecute {
   FXint          npar;              // Number of capturing parentheses
   FXint          recs;              // Recursions
   FXint          mode;              // Match mode
+  FXlong         steps;             // Steps left, or negative if unlimited
 public:
 
   // Construct match engine
   FXExecute(const FXchar* sbeg,const FXchar* send,FXint* b,FXint* e,FXint p,FXint m);
 
+  // Give up after n steps, or when running out of recursion; n<0 is unlimited
+  void limit(FXlong n){ steps=n; }
+
+  // Return true if we gave up
+  FXbool exhausted() const { return steps==0; }
+
   // Attempt to match
   FXbool attempt(const FXchar* prog,const FXchar* ptr);
 
   // Search in string, starting at ptr
-  FXint search(const FXchar* prog,const FXchar* fm,const FXchar* to);
+  FXint search(const FXchar* prog,const FXchar* fm,const FXchar* to,FXPrefilter& pf);
 
   // Match at current string position
   FXbool match(const FXchar* prog);
@@ -2510,7 +3261,7 @@ public:
 
 
 // Construct match engine
-FXExecute::FXExecute(const FXchar* sbeg,const FXchar* send,FXint* b,FXint* e,FXint p,FXint m):anc(nullptr),str(nullptr),str_beg(sbeg),str_end(send),sub_beg(b),sub_end(e),npar(p),recs(0),mode(m){
+FXExecute::FXExecute(const FXchar* sbeg,const FXchar* send,FXint* b,FXint* e,FXint p,FXint m):anc(nullptr),str(nullptr),str_beg(sbeg),str_end(send),sub_beg(b),sub_end(e),npar(p),recs(0),mode(m),steps(-1){
   bak_beg[0]=bak_end[0]=nullptr;
   bak_beg[1]=bak_end[1]=nullptr;
   bak_beg[2]=bak_end[2]=nullptr;
@@ -2540,7 +3291,7 @@ FXExecute::FXExecute(const FXchar* sbeg,const FXchar* send,FXint* b,FXint* e,FXi
 
 // The workhorse
 FXbool FXExecute::match(const FXchar* prog){
-  if(recs<MAXRECURSION){
+  if(recs<MAXRECURSION && steps!=0){
     FXint no,keep,rep_min,rep_max,greediness;
     const FXchar *ptr,*save,*beg,*end;
     FXuchar op;
@@ -2548,6 +3299,7 @@ FXbool FXExecute::match(const FXchar* prog){
 
     // Recurse deeper
     ++recs;
+    --steps;
 
     // Process expression
 nxt:op=*prog++;
@@ -2785,7 +3537,7 @@ nxt:op=*prog++;
         goto nxt;
       case OP_NOT_RNG:                          // Any character not in a range
         if(str_end<=str) goto f;
-        if((FXuchar)prog[0]<=(FXuchar)*str && (FXuchar)prog[1]<=(FXuchar)*str) goto f;
+        if((FXuchar)prog[0]<=(FXuchar)*str && (FXuchar)*str<=(FXuchar)prog[1]) goto f;
         prog+=2;
         str++;
         goto nxt;
@@ -3657,13 +4409,16 @@ asc:    if(no<rep_min) goto f;
         fxerror("FXRex::match: bad opcode (%d) at: %p on line: %d\n",op,prog-1,__LINE__);
       }
 
-    // Return with success
+    // Return with success, unless we gave up
 t:  --recs;
-    return true;
+    return steps!=0;
 
     // Return with failure
 f:  --recs;
     }
+  else if(0<steps){                             // Out of recursion; give up if limited
+    steps=0;
+    }
   return false;
   }
 
@@ -3887,7 +4642,7 @@ nxt:op=*prog++;
         goto nxt;
       case OP_NOT_RNG:                          // Any character not in a range
         if(str_end<=str) goto f;
-        if((FXuchar)prog[0]<=(FXuchar)*(str-1) && (FXuchar)prog[1]<=(FXuchar)*(str-1)) goto f;
+        if((FXuchar)prog[0]<=(FXuchar)*(str-1) && (FXuchar)*(str-1)<=(FXuchar)prog[1]) goto f;
         prog+=2;
         str--;
         goto nxt;
@@ -4788,7 +5543,7 @@ FXbool FXExecute::attempt(const FXchar* prog,const FXchar* ptr){
 /*******************************************************************************/
 
 // Search in string, starting at ptr
-FXint FXExecute::search(const FXchar* prog,const FXchar* fm,const FXchar* to){
+FXint FXExecute::search(const FXchar* prog,const FXchar* fm,const FXchar* to,FXPrefilter& pf){
   FXchar ch;
 
   // Must be true
@@ -4820,23 +5575,10 @@ FXint FXExecute::search(const FXchar* prog,const FXchar* fm,const FXchar* to){
         return -1;
         }
 
-      // Known starting character
-      if(prog[0]==OP_CHAR || prog[0]==OP_CHARS){
-        ch=(prog[0]==OP_CHAR)?prog[1]:prog[3];
-        if(to==str_end) to--;
-        while(fm<=to){
-          if((*fm==ch) && attempt(prog,fm)) return fm-str_beg;
-          fm++;
-          }
-        return -1;
-        }
-
-      // Known starting character, ignoring case
-      if(prog[0]==OP_CHAR_CI || prog[0]==OP_CHARS_CI){
-        ch=(prog[0]==OP_CHAR_CI)?prog[1]:prog[3];
-        if(to==str_end) to--;
-        while(fm<=to){
-          if((Ascii::toLower(*fm)==ch) && attempt(prog,fm)) return fm-str_beg;
+      // Skip to candidate positions
+      if(pf.useful()){
+        while(fm<=to && (fm=pf.next(fm,to,str_end))!=nullptr){
+          if(attempt(prog,fm)) return fm-str_beg;
           fm++;
           }
         return -1;
@@ -4867,6 +5609,9 @@ FXint FXExecute::search(const FXchar* prog,const FXchar* fm,const FXchar* to){
         if(fm==str_beg){
           if(!(mode&FXRex::NotBol) && attempt(prog,fm)) return 0;
           }
+        else if((*(fm-1)=='\n') && attempt(prog,fm)){
+          return fm-str_beg;
+          }
         return -1;
         }
 
@@ -4892,9 +5637,12 @@ FXint FXExecute::search(const FXchar* prog,const FXchar* fm,const FXchar* to){
         return -1;
         }
 
+      // Required literal must occur somewhere
+      if(!pf.possible(to,str_end)) return -1;
+
       // General case
       while(to<=fm){
-        if(attempt(prog,fm)) return fm-str_beg;
+        if(pf.candidate(fm,str_end) && attempt(prog,fm)) return fm-str_beg;
         fm--;
         }
       }
@@ -4951,6 +5699,9 @@ FXint FXExecute::search(const FXchar* prog,const FXchar* fm,const FXchar* to){
       if(fm==str_beg){
         if(!(mode&FXRex::NotBol) && attempt(prog,fm)) return 0;
         }
+      else if((*(fm-1)=='\n') && attempt(prog,fm)){
+        return fm-str_beg;
+        }
       return -1;
       }
 
@@ -4964,10 +5715,860 @@ FXint FXExecute::search(const FXchar* prog,const FXchar* fm,const FXchar* to){
   return -1;
   }
 
+/*******************************************************************************/
+
+// Return the number of states needed to simulate the program in lock-step, or -1
+// if the program uses constructs which require backtracking.  There is one state
+// per opcode, per character of a literal run, and per repeat count of a simple
+// repeat; if index is not NULL, the first state of each opcode is stored at the
+// opcode's offset.
+static FXint lockstep(const FXchar* prog,const FXchar* end,FXint* index){
+  const FXchar* beg=prog;
+  FXint nstates=0,num,rep_min,rep_max;
+  while(prog<end){
+    if(index) index[prog-beg]=nstates;
+    num=1;
+    switch(*prog){
+      case OP_FAIL:
+      case OP_PASS:
+      case OP_NOT_EMPTY:
+      case OP_STR_BEG:
+      case OP_STR_END:
+      case OP_LINE_BEG:
+      case OP_LINE_END:
+      case OP_WORD_BEG:
+      case OP_WORD_END:
+      case OP_WORD_BND:
+      case OP_WORD_INT:
+      case OP_SUB_BEG_0:
+      case OP_SUB_BEG_1:
+      case OP_SUB_BEG_2:
+      case OP_SUB_BEG_3:
+      case OP_SUB_BEG_4:
+      case OP_SUB_BEG_5:
+      case OP_SUB_BEG_6:
+      case OP_SUB_BEG_7:
+      case OP_SUB_BEG_8:
+      case OP_SUB_BEG_9:
+      case OP_SUB_END_0:
+      case OP_SUB_END_1:
+      case OP_SUB_END_2:
+      case OP_SUB_END_3:
+      case OP_SUB_END_4:
+      case OP_SUB_END_5:
+      case OP_SUB_END_6:
+      case OP_SUB_END_7:
+      case OP_SUB_END_8:
+      case OP_SUB_END_9:
+        prog+=1;
+        break;
+      case OP_JUMP:
+      case OP_BRANCH:
+      case OP_BRANCHREV:
+        prog+=3;
+        break;
+      case OP_CHARS:
+      case OP_CHARS_CI:
+        num=GETARG(prog+1);
+        prog+=3+num;
+        break;
+      case OP_STAR:
+      case OP_MIN_STAR:
+      case OP_QUEST:
+      case OP_MIN_QUEST:
+        prog=skipchar(prog+1);
+        break;
+      case OP_PLUS:
+      case OP_MIN_PLUS:
+        num=2;
+        prog=skipchar(prog+1);
+        break;
+      case OP_REP:
+      case OP_MIN_REP:
+        rep_min=GETARG(prog+1);
+        rep_max=GETARG(prog+3);
+        num=(rep_max<ONEINDIG)?rep_max:rep_min+1;
+        prog=skipchar(prog+5);
+        break;
+      default:
+        prog=skipchar(prog);
+        break;
+      }
+    if(!prog) return -1;
+    nstates+=num;
+    if(MAXSTATES<nstates) return -1;
+    }
+  return nstates;
+  }
+
+/*******************************************************************************/
+
+// Reads the string delivered by FXRexInput one piece after the other; of the pieces
+// before the current one, only the last byte is kept
+class FXReader {
+  FXRexInput    &input;             // Input delivering the string
+  const FXchar  *ptr;               // Current piece
+  FXint          beg;               // Position of its first byte
+  FXint          end;               // Position after its last byte
+  FXint          last;              // Byte before it, or -1 if unknown
+private:
+  FXReader(const FXReader&);
+  FXReader &operator=(const FXReader&);
+public:
+
+  // Construct reader for input
+  FXReader(FXRexInput& in):input(in),ptr(nullptr),beg(0),end(0),last(-1){ }
+
+  // Return byte at pos, or -1 if pos is at or beyond the end of the string
+  FXint get(FXint pos);
+
+  // Skip from pos to where a match may start, but not beyond to
+  FXint skip(FXint pos,FXint to,const FXPrefilter& pf);
+  };
+
+
+// Return byte at pos, or -1 if pos is at or beyond the end of the string
+FXint FXReader::get(FXint pos){
+  const FXchar* p;
+  FXint b,e,l;
+  if(beg<=pos && pos<end) return (FXuchar)ptr[pos-beg];
+  if(pos==beg-1 && 0<=last) return last;
+  l=(beg<end)?(FXuchar)ptr[end-beg-1]:-1;
+  if((p=input.fetch(pos,b,e))==nullptr || pos<b || e<=pos) return -1;
+  last=(b==end)?l:-1;
+  ptr=p;
+  beg=b;
+  end=e;
+  return (FXuchar)ptr[pos-beg];
+  }
+
+
+// Skip from pos to where a match may start, but not beyond to or the end of the string
+FXint FXReader::skip(FXint pos,FXint to,const FXPrefilter& pf){
+  FXint lim;
+  while(pos<to && 0<=get(pos)){
+    lim=(end<to)?end:to;
+    pos=beg+(FXint)(pf.scan(ptr+pos-beg,ptr+end-beg)-ptr);
+    if(pos<lim) break;
+    pos=lim;
+    }
+  return pos;
+  }
+
+/*******************************************************************************/
+
+// Structure used during lock-step simulation
+class FXSimulate {
+  const FXchar  *prog;              // Program being simulated
+  const FXchar  *str_beg;           // Begin of string
+  const FXchar  *str_end;           // End of string
+  FXint         *sub_beg;           // Begin of substring i
+  FXint         *sub_end;           // End of substring i
+  FXint         *block;             // Allocated memory for tables
+  FXint         *index;             // First state of each opcode
+  FXint         *mark;              // Generation in which state was last added
+  FXint         *cur;               // Threads at current position
+  FXint         *nxt;               // Threads at next position
+  FXint         *caps;              // Captures of thread being added
+  FXint         *best;              // Captures of best match
+  FXint         *owner;             // Program of each opcode, for a set of programs
+  FXint         *cut;               // Generation in which program's threads were cut off
+  FXint          ncur;              // Number of current threads
+  FXint          nnxt;              // Number of next threads
+  FXint          width;             // Size of thread record
+  FXint          gen;               // Generation
+  FXint          mbeg;              // Start of best match, or -1
+  FXint          mend;              // End of best match
+  FXint          npar;              // Number of capturing parentheses
+  FXint          mode;              // Match mode
+  FXint          where;             // Position where threads are added
+  FXint          before;            // Byte before it, or -1 at begin of string
+  FXint          after;             // Byte at it, or -1 at end of string
+  FXint          local[1024];       // Memory for tables, if small enough
+private:
+  FXSimulate(const FXSimulate&);
+  FXSimulate &operator=(const FXSimulate&);
+  void locate(const FXchar* str);
+  void push(FXint* list,FXint& n,const FXchar* pc,FXint cnt,FXint start);
+  void add(FXint* list,FXint& n,const FXchar* pc,FXint cnt,FXint start);
+  void advance(const FXint* rec,FXuchar ch);
+  void step(FXint pos,FXint ch,FXint nch);
+  FXint stepset(FXint pos,FXint ch,FXint nch,FXint* beg,FXint* end,FXbool all);
+  FXbool viable(const FXchar* pc,const FXchar* str) const;
+  FXint run(const FXchar* fm,const FXchar* to,FXPrefilter* pf);
+  FXint run(FXRexInput& input,FXint fm,FXint to,const FXPrefilter* pf);
+  void result();
+public:
+
+  // Construct simulation engine
+  FXSimulate(const FXchar* sbeg,const FXchar* send,FXint* b,FXint* e,FXint p,FXint m);
+
+  // Prepare program of len bytes and nstates states for simulation
+  FXbool init(const FXchar* pr,FXint len,FXint nstates);
+
+  // Prepare n programs, the k-th one spanning entry[k]...entry[k+1], for simulation
+  FXbool init(const FXchar* pr,const FXint* entry,FXint n);
+
+  // Attempt to match
+  FXbool attempt(const FXchar* ptr);
+
+  // Search in string, from fm toward to
+  FXint search(const FXchar* fm,const FXchar* to,FXPrefilter& pf);
+
+  // Attempt to match at pos of string delivered by input
+  FXbool attempt(FXRexInput& input,FXint pos);
+
+  // Search in string delivered by input, from fm to to
+  FXint search(FXRexInput& input,FXint fm,FXint to,const FXPrefilter& pf);
+
+  // Search n programs at once from fm to to, for all of them or for the first one
+  FXint searchset(const FXint* entry,const FXArray<FXint>* start,FXint n,const FXchar* fm,const FXchar* to,FXint* beg,FXint* end,FXbool all);
+
+  // Delete simulation engine
+ ~FXSimulate();
+  };
+
+
+// Construct simulation engine
+FXSimulate::FXSimulate(const FXchar* sbeg,const FXchar* send,FXint* b,FXint* e,FXint p,FXint m):prog(nullptr),str_beg(sbeg),str_end(send),sub_beg(b),sub_end(e),block(nullptr),index(nullptr),mark(nullptr),cur(nullptr),nxt(nullptr),caps(nullptr),best(nullptr),owner(nullptr),cut(nullptr),ncur(0),nnxt(0),width(3+p+p),gen(0),mbeg(-1),mend(-1),npar(p),mode(m),where(0),before(-1),after(-1){
+  for(FXint i=0; i<npar; ++i){ sub_beg[i]=sub_end[i]=-1; }
+  }
+
+
+// Prepare program of len bytes and nstates states for simulation
+FXbool FXSimulate::init(const FXchar* pr,FXint len,FXint nstates){
+  FXint size=len+nstates+nstates*width*2+npar*4;
+  if(size<=(FXint)ARRAYNUMBER(local) || allocElms(block,size)){
+    prog=pr;
+    index=block?block:local;
+    mark=index+len;
+    cur=mark+nstates;
+    nxt=cur+nstates*width;
+    caps=nxt+nstates*width;
+    best=caps+npar*2;
+    clearElms(mark,nstates);
+    lockstep(pr,pr+len,index);
+    return true;
+    }
+  return false;
+  }
+
+
+// Prepare n programs, the k-th one spanning entry[k]...entry[k+1], for simulation;
+// states are numbered consecutively across programs
+FXbool FXSimulate::init(const FXchar* pr,const FXint* entry,FXint n){
+  FXint len=entry[n],nstates=0,size,num,i,k;
+  for(k=0; k<n; ++k){
+    if((num=lockstep(pr+entry[k],pr+entry[k+1],nullptr))<0) return false;
+    nstates+=num;
+    }
+  size=len+len+nstates+nstates*width*2+n;
+  if(size<=(FXint)ARRAYNUMBER(local) || allocElms(block,size)){
+    prog=pr;
+    index=block?block:local;
+    owner=index+len;
+    mark=owner+len;
+    cur=mark+nstates;
+    nxt=cur+nstates*width;
+    cut=nxt+nstates*width;
+    clearElms(mark,nstates);
+    clearElms(cut,n);
+    for(k=nstates=0; k<n; ++k){
+      num=lockstep(pr+entry[k],pr+entry[k+1],index+entry[k]);
+      for(i=entry[k]; i<entry[k+1]; ++i){
+        index[i]+=nstates;
+        owner[i]=k;
+        }
+      nstates+=num;
+      }
+    return true;
+    }
+  return false;
+  }
+
+
+// Set position where threads are added to str
+inline void FXSimulate::locate(const FXchar* str){
+  where=str-str_beg;
+  before=(str_beg<str)?(FXuchar)str[-1]:-1;
+  after=(str<str_end)?(FXuchar)str[0]:-1;
+  }
+
+
+// Append thread waiting at pc to list
+inline void FXSimulate::push(FXint* list,FXint& n,const FXchar* pc,FXint cnt,FXint start){
+  FXint* rec=list+width*n++;
+  rec[0]=pc-prog;
+  rec[1]=cnt;
+  rec[2]=start;
+  copyElms(rec+3,caps,npar*2);
+  }
+
+
+// Add thread at pc to list, following all paths which don't consume a character
+// in order of priority; a state already added at this position is skipped, as
+// the thread which added it earlier has higher priority.  Assertions only need
+// the bytes before and at the position, so the string needn't be contiguous
+void FXSimulate::add(FXint* list,FXint& n,const FXchar* pc,FXint cnt,FXint start){
+  const FXchar *ptr;
+  FXint state,rep_min,rep_max,save,no;
+nxt:state=index[pc-prog];
+  switch(*pc){
+    case OP_STAR:
+    case OP_MIN_STAR:
+      rep_min=0;
+      rep_max=ONEINDIG;
+      ptr=pc+1;
+      goto rep;
+    case OP_PLUS:
+    case OP_MIN_PLUS:
+      rep_min=1;
+      rep_max=ONEINDIG;
+      ptr=pc+1;
+      goto rep;
+    case OP_QUEST:
+    case OP_MIN_QUEST:
+      rep_min=0;
+      rep_max=1;
+      ptr=pc+1;
+      goto rep;
+    case OP_REP:
+    case OP_MIN_REP:
+      rep_min=GETARG(pc+1);
+      rep_max=GETARG(pc+3);
+      ptr=pc+5;
+rep:  if(ONEINDIG<=rep_max){                // Beyond minimum, counts are equivalent
+        if(rep_min<cnt) cnt=rep_min;
+        }
+      else if(rep_max<=cnt){                // Done repeating
+        pc=skipchar(ptr);
+        cnt=0;
+        goto nxt;
+        }
+      state+=cnt;
+      if(mark[state]==gen) return;
+      mark[state]=gen;
+      if(cnt<rep_min){                      // Need more
+        push(list,n,pc,cnt,start);
+        return;
+        }
+      if(*pc==OP_STAR || *pc==OP_PLUS || *pc==OP_QUEST || *pc==OP_REP){
+        push(list,n,pc,cnt,start);          // Greedy: first try another one
+        add(list,n,skipchar(ptr),0,start);
+        return;
+        }
+      add(list,n,skipchar(ptr),0,start);
+      push(list,n,pc,cnt,start);            // Lazy: first try the rest
+      return;
+    }
+  if(mark[state]==gen) return;
+  mark[state]=gen;
+  switch(*pc){
+    case OP_FAIL:
+      return;
+    case OP_JUMP:
+      pc+=1+GETARG(pc+1);
+      goto nxt;
+    case OP_BRANCH:
+      add(list,n,pc+3,0,start);
+      pc+=1+GETARG(pc+1);
+      goto nxt;
+    case OP_BRANCHREV:
+      add(list,n,pc+1+GETARG(pc+1),0,start);
+      pc+=3;
+      goto nxt;
+    case OP_NOT_EMPTY:
+      if(where==start) return;
+      pc++;
+      goto nxt;
+    case OP_STR_BEG:
+      if(0<=before) return;
+      pc++;
+      goto nxt;
+    case OP_STR_END:
+      if(0<=after) return;
+      pc++;
+      goto nxt;
+    case OP_LINE_BEG:
+      if(0<=before){
+        if(before!='\n') return;
+        }
+      else if(mode&FXRex::NotBol){
+        return;
+        }
+      pc++;
+      goto nxt;
+    case OP_LINE_END:
+      if(0<=after){
+        if(after!='\n') return;
+        }
+      else if(mode&FXRex::NotEol){
+        return;
+        }
+      pc++;
+      goto nxt;
+    case OP_WORD_BEG:
+      if(after<0) return;
+      if(!Ascii::isWord(after)) return;
+      if(0<=before && Ascii::isWord(before)) return;
+      pc++;
+      goto nxt;
+    case OP_WORD_END:
+      if(before<0) return;
+      if(!Ascii::isWord(before)) return;
+      if(0<=after && Ascii::isWord(after)) return;
+      pc++;
+      goto nxt;
+    case OP_WORD_BND:
+      if((0<=after && Ascii::isWord(after)) == (0<=before && Ascii::isWord(before))) return;
+      pc++;
+      goto nxt;
+    case OP_WORD_INT:
+      if(after<0) return;
+      if(before<0) return;
+      if(!Ascii::isWord(after)) return;
+      if(!Ascii::isWord(before)) return;
+      pc++;
+      goto nxt;
+    case OP_SUB_BEG_0:
+    case OP_SUB_BEG_1:
+    case OP_SUB_BEG_2:
+    case OP_SUB_BEG_3:
+    case OP_SUB_BEG_4:
+    case OP_SUB_BEG_5:
+    case OP_SUB_BEG_6:
+    case OP_SUB_BEG_7:
+    case OP_SUB_BEG_8:
+    case OP_SUB_BEG_9:
+      no=(*pc-OP_SUB_BEG_0)*2;
+      goto sub;
+    case OP_SUB_END_0:
+    case OP_SUB_END_1:
+    case OP_SUB_END_2:
+    case OP_SUB_END_3:
+    case OP_SUB_END_4:
+    case OP_SUB_END_5:
+    case OP_SUB_END_6:
+    case OP_SUB_END_7:
+    case OP_SUB_END_8:
+    case OP_SUB_END_9:
+      no=(*pc-OP_SUB_END_0)*2+1;
+sub:  if(no<npar*2){                        // Record, and restore after
+        save=caps[no];
+        caps[no]=where;
+        add(list,n,pc+1,0,start);
+        caps[no]=save;
+        return;
+        }
+      pc++;
+      goto nxt;
+    }
+  push(list,n,pc,cnt,start);                // Wait for next character, or match
+  }
+
+
+// Advance thread over the character ch, adding its successors to the next list
+inline void FXSimulate::advance(const FXint* rec,FXuchar ch){
+  const FXchar *pc=prog+rec[0];
+  FXint k,no;
+  copyElms(caps,rec+3,npar*2);
+  switch(*pc){
+    case OP_CHARS:
+      k=rec[1];
+      no=GETARG(pc+1);
+      if(pc[3+k]!=(FXchar)ch) return;
+      goto chs;
+    case OP_CHARS_CI:
+      k=rec[1];
+      no=GETARG(pc+1);
+      if(pc[3+k]!=Ascii::toLower(ch)) return;
+chs:  if(++k<no){
+        if(mark[index[pc-prog]+k]==gen) return;
+        mark[index[pc-prog]+k]=gen;
+        push(nxt,nnxt,pc,k,rec[2]);
+        return;
+        }
+      add(nxt,nnxt,pc+3+no,0,rec[2]);
+      return;
+    case OP_STAR:
+    case OP_MIN_STAR:
+    case OP_PLUS:
+    case OP_MIN_PLUS:
+    case OP_QUEST:
+    case OP_MIN_QUEST:
+      if(!onechar(pc+1,ch)) return;
+      add(nxt,nnxt,pc,rec[1]+1,rec[2]);
+      return;
+    case OP_REP:
+    case OP_MIN_REP:
+      if(!onechar(pc+5,ch)) return;
+      add(nxt,nnxt,pc,rec[1]+1,rec[2]);
+      return;
+    default:
+      if(!onechar(pc,ch)) return;
+      add(nxt,nnxt,skipchar(pc),0,rec[2]);
+      return;
+    }
+  }
+
+
+// Advance current threads over the character ch at pos, in order of priority; the
+// first thread which reached the end of the program records a match, and cuts
+// off all threads of lower priority.  The byte following ch is nch, or -1 if ch
+// is the last one; if ch is -1, pos is the end of the string
+void FXSimulate::step(FXint pos,FXint ch,FXint nch){
+  const FXint *rec;
+  FXint i;
+  nnxt=0;
+  gen++;
+  where=pos+1;
+  before=ch;
+  after=nch;
+  for(i=0; i<ncur; ++i){
+    rec=cur+width*i;
+    if(prog[rec[0]]==OP_PASS){
+      mbeg=rec[2];
+      mend=pos;
+      copyElms(best,rec+3,npar*2);
+      break;
+      }
+    if(ch<0) continue;
+    advance(rec,ch);
+    }
+  swap(cur,nxt);
+  ncur=nnxt;
+  }
+
+
+// Same, for a set of programs; when looking for all programs, a thread which
+// reached the end of its program only cuts off lower priority threads of the
+// same program.  Return the number of programs which matched for the first time
+FXint FXSimulate::stepset(FXint pos,FXint ch,FXint nch,FXint* beg,FXint* end,FXbool all){
+  const FXint *rec;
+  FXint i,k,found=0;
+  nnxt=0;
+  gen++;
+  where=pos+1;
+  before=ch;
+  after=nch;
+  for(i=0; i<ncur; ++i){
+    rec=cur+width*i;
+    k=owner[rec[0]];
+    if(cut[k]==gen) continue;
+    if(prog[rec[0]]==OP_PASS){
+      if(!all){
+        beg[0]=rec[2];
+        end[0]=pos;
+        mbeg=k;
+        break;
+        }
+      if(beg[k]<0) found++;
+      beg[k]=rec[2];
+      end[k]=pos;
+      cut[k]=gen;
+      continue;
+      }
+    if(ch<0) continue;
+    advance(rec,ch);
+    }
+  swap(cur,nxt);
+  ncur=nnxt;
+  return found;
+  }
+
+
+// Run threads started at positions fm...to, in one pass over the string; threads
+// started earlier take priority over those started later, so the first match
+// found is the leftmost one
+FXint FXSimulate::run(const FXchar* fm,const FXchar* to,FXPrefilter* pf){
+  const FXchar* str=fm;
+  ncur=0;
+  mbeg=-1;
+  gen++;
+  while(1){
+    if(pf && ncur==0 && mbeg<0){        // Skip to where a match may start
+      if(to<str || (str=pf->next(str,to,str_end))==nullptr) break;
+      gen++;                            // Marks of dead threads don't apply here
+      }
+    if(mbeg<0 && str<=to && (!pf || pf->candidate(str,str_end))){
+      fillElms(caps,-1,npar*2);
+      locate(str);
+      add(cur,ncur,prog,0,str-str_beg);
+      }
+    if(ncur==0 && (0<=mbeg || to<=str)) break;
+    if(str_end<=str){
+      step(str-str_beg,-1,-1);
+      break;
+      }
+    step(str-str_beg,(FXuchar)str[0],(str+1<str_end)?(FXuchar)str[1]:-1);
+    str++;
+    }
+  result();
+  return mbeg;
+  }
+
+
+// Run threads started at positions fm...to of the string delivered by input, in one
+// pass; this reads the string byte by byte, one piece after the other, keeping only
+// the byte before the current position, and the one after it.  When no threads are
+// running, the prefilter skips over the current piece to where a match may start
+FXint FXSimulate::run(FXRexInput& input,FXint fm,FXint to,const FXPrefilter* pf){
+  FXReader in(input);
+  FXint pos=fm,pch,ch,nch;
+  ncur=0;
+  mbeg=-1;
+  gen++;
+  pch=(0<pos)?in.get(pos-1):-1;
+  if(0<pos && pch<0) return -1;
+  ch=in.get(pos);
+  nch=(0<=ch)?in.get(pos+1):-1;
+  while(1){
+    if(pf && ncur==0 && mbeg<0){        // Skip to where a match may start
+      while(pos<to && 0<=ch && !pf->starts((FXuchar)ch)){
+        pos=in.skip(pos+1,to,*pf);
+        pch=in.get(pos-1);
+        ch=in.get(pos);
+        nch=(0<=ch)?in.get(pos+1):-1;
+        }
+      gen++;                            // Marks of dead threads don't apply here
+      }
+    if(mbeg<0 && pos<=to){
+      fillElms(caps,-1,npar*2);
+      where=pos;
+      before=pch;
+      after=ch;
+      add(cur,ncur,prog,0,pos);
+      }
+    if(ncur==0 && (0<=mbeg || to<=pos || ch<0)) break;
+    step(pos,ch,nch);
+    if(ch<0) break;
+    pos++;
+    pch=ch;
+    ch=nch;
+    nch=(0<=ch)?in.get(pos+1):-1;
+    }
+  result();
+  return mbeg;
+  }
+
+
+// Return captures of best match, if any
+void FXSimulate::result(){
+  if(0<=mbeg && 0<npar){
+    sub_beg[0]=mbeg;
+    sub_end[0]=mend;
+    for(FXint i=1; i<npar; ++i){
+      sub_beg[i]=best[i*2];
+      sub_end[i]=best[i*2+1];
+      }
+    }
+  }
+
+
+// Attempt to match
+FXbool FXSimulate::attempt(const FXchar* ptr){
+  return 0<=run(ptr,ptr,nullptr);
+  }
+
+
+// Search in string, from fm toward to
+FXint FXSimulate::search(const FXchar* fm,const FXchar* to,FXPrefilter& pf){
+  FXASSERT(str_beg<=fm && fm<=str_end);
+  FXASSERT(str_beg<=to && to<=str_end);
+
+  // Search forwards, all starting positions at once
+  if(fm<=to){
+    if(prog[0]==OP_STR_BEG){
+      if(fm!=str_beg) return -1;
+      to=fm;
+      }
+    return run(fm,to,&pf);
+    }
+
+  // Search backwards, one starting position at a time
+  if(!pf.possible(to,str_end)) return -1;
+  while(to<=fm){
+    if(pf.candidate(fm,str_end) && 0<=run(fm,fm,nullptr)) return fm-str_beg;
+    fm--;
+    }
+  return -1;
+  }
+
+
+// Attempt to match at pos of string delivered by input
+FXbool FXSimulate::attempt(FXRexInput& input,FXint pos){
+  return 0<=run(input,pos,pos,nullptr);
+  }
+
+
+// Search forwards in string delivered by input, from fm to to
+FXint FXSimulate::search(FXRexInput& input,FXint fm,FXint to,const FXPrefilter& pf){
+  FXASSERT(0<=fm && fm<=to);
+  if(prog[0]==OP_STR_BEG){
+    if(fm!=0) return -1;
+    to=fm;
+    }
+  return run(input,fm,to,&pf);
+  }
+
+
+// Return false if program at pc starts with a literal which doesn't match at str;
+// a thread started there would die before it could affect any other thread
+inline FXbool FXSimulate::viable(const FXchar* pc,const FXchar* str) const {
+  FXint len,i;
+  if(*pc==OP_CHARS){
+    len=GETARG(pc+1);
+    return len<=str_end-str && memcmp(pc+3,str,len)==0;
+    }
+  if(*pc==OP_CHARS_CI){
+    len=GETARG(pc+1);
+    if(str_end-str<len) return false;
+    for(i=0; i<len; ++i){
+      if(pc[3+i]!=Ascii::toLower(str[i])) return false;
+      }
+    }
+  return true;
+  }
+
+
+// Search n programs at once from fm to to; threads are started for each program
+// in turn, so when looking for the first match of any program, the leftmost one
+// wins, and of those starting at the same place, the one of the lowest program.
+// When looking for all programs, each program gets its own leftmost match, and
+// the number of programs which matched is returned; else, the program which
+// matched first is returned, or -1.  The programs which may start with byte ch
+// are listed in start[ch], in increasing order; those which may match at the end
+// of the string are listed in start[256]
+FXint FXSimulate::searchset(const FXint* entry,const FXArray<FXint>* start,FXint n,const FXchar* fm,const FXchar* to,FXint* beg,FXint* end,FXbool all){
+  const FXchar* str=fm;
+  FXint found=0,ch,i,k;
+  FXASSERT(str_beg<=fm && fm<=to && to<=str_end);
+
+  // Unmatched as yet
+  if(all){
+    fillElms(beg,-1,n);
+    fillElms(end,-1,n);
+    }
+
+  // All starting positions at once
+  ncur=0;
+  mbeg=-1;
+  gen++;
+  while(1){
+    if(ncur==0){                        // Skip to where a match may start
+      while(str<to && start[(FXuchar)*str].no()==0) str++;
+      gen++;
+      }
+    if(mbeg<0 && str<=to){
+      ch=(str<str_end)?(FXuchar)*str:256;
+      for(i=0; i<start[ch].no(); ++i){
+        k=start[ch][i];
+        if((!all || beg[k]<0) && viable(prog+entry[k],str)){
+          locate(str);
+          add(cur,ncur,prog+entry[k],0,str-str_beg);
+          }
+        }
+      }
+    if(ncur==0 && (0<=mbeg || found==n || to<=str)) break;
+    if(str_end<=str){
+      found+=stepset(str-str_beg,-1,-1,beg,end,all);
+      break;
+      }
+    found+=stepset(str-str_beg,(FXuchar)str[0],(str+1<str_end)?(FXuchar)str[1]:-1,beg,end,all);
+    str++;
+    }
+  return all?found:mbeg;
+  }
+
+
+// Delete simulation engine
+FXSimulate::~FXSimulate(){
+  freeElms(block);
+  }
+
+/*******************************************************************************/
+
+// Analyze program of len bytes
+static void analyze(const FXchar* prog,FXint len,FXAnalysis& an){
+  an.nstates=lockstep(prog,prog+len,nullptr);
+  accelerate(prog,len,an);
+  }
+
+
+// Return analysis of program, as kept by parse(); analyze it into an if none was kept
+static const FXAnalysis& analysis(const FXString& code,const FXAnalysis* info,FXAnalysis& an){
+  if(info) return *info;
+  analyze(code.text(),code.length(),an);
+  return an;
+  }
+
+
+// Attempt to match program at ptr; if the program can be simulated in lock-step,
+// backtracking is given a budget, and when it runs out we switch to simulation
+static FXbool rexmatch(const FXchar* prog,FXint len,const FXAnalysis& an,const FXchar* sbeg,const FXchar* send,const FXchar* ptr,FXint* b,FXint* e,FXint p,FXint m){
+  FXExecute ms(sbeg,send,b,e,p,m);
+  FXint nstates=-1;
+  if(!(m&(FXRex::Unicode|FXRex::Backtrack))){
+    nstates=an.nstates;
+    if(0<nstates) ms.limit((send-sbeg+1)*(FXlong)nstates);
+    }
+  if(ms.attempt(prog,ptr)) return true;
+  if(ms.exhausted()){
+    FXSimulate sim(sbeg,send,b,e,p,m);
+    if(sim.init(prog,len,nstates)) return sim.attempt(ptr);
+    ms.limit(-1);
+    return ms.attempt(prog,ptr);
+    }
+  return false;
+  }
+
+
+// Search program from fm to to; if the program can be simulated in lock-step,
+// backtracking is given a budget, and when it runs out we switch to simulation
+static FXint rexsearch(const FXchar* prog,FXint len,const FXAnalysis& an,const FXchar* sbeg,const FXchar* send,const FXchar* fm,const FXchar* to,FXint* b,FXint* e,FXint p,FXint m){
+  FXExecute ms(sbeg,send,b,e,p,m);
+  FXPrefilter pf(prog,an);
+  FXint nstates=-1,result;
+  if(!(m&(FXRex::Unicode|FXRex::Backtrack))){
+    nstates=an.nstates;
+    if(0<nstates) ms.limit((send-sbeg+1)*(FXlong)nstates);
+    }
+  result=ms.search(prog,fm,to,pf);
+  if(result<0 && ms.exhausted()){
+    FXSimulate sim(sbeg,send,b,e,p,m);
+    if(sim.init(prog,len,nstates)) return sim.search(fm,to,pf);
+    ms.limit(-1);
+    return ms.search(prog,fm,to,pf);
+    }
+  return result;
+  }
+
 }
 
 /*******************************************************************************/
 
+// Return number of states needed to simulate program in lock-step, or -1 if
+// it can't be simulated; used by FXRexSet
+FXint fxrexstates(const FXchar* prog,FXint len){
+  return lockstep(prog,prog+len,nullptr);
+  }
+
+
+// Search n programs, the k-th one spanning entry[k]...entry[k+1], in one pass
+// over the string; start[ch] lists the programs which may start with byte ch,
+// and start[256] those which may match the empty string at the end.
+// When all is true, beg[k] and end[k] are set for each program, and the number
+// of programs which matched is returned; otherwise, the first program which
+// matched is returned, and its match is in beg[0] and end[0].
+// Return -2 if out of memory; used by FXRexSet
+FXint fxrexsearchset(const FXchar* prog,const FXint* entry,const FXArray<FXint>* start,FXint n,const FXchar* sbeg,const FXchar* send,const FXchar* fm,const FXchar* to,FXint mode,FXint* beg,FXint* end,FXbool all){
+  FXSimulate sim(sbeg,send,nullptr,nullptr,0,mode);
+  if(sim.init(prog,entry,n)) return sim.searchset(entry,start,n,fm,to,beg,end,all);
+  return -2;
+  }
+
+/*******************************************************************************/
+
 
 // Table of error messages
 const FXchar *const FXRex::errors[]={
@@ -4993,19 +6594,20 @@ const FXchar *const FXRex::errors[]={
 
 
 // Construct empty regular expression object
-FXRex::FXRex(){
+FXRex::FXRex():info(nullptr){
   FXTRACE((TOPIC_CONSTRUCT,"FXRex::FXRex()\n"));
   }
 
 
 // Copy regex object
-FXRex::FXRex(const FXRex& orig):code(orig.code){
+FXRex::FXRex(const FXRex& orig):code(orig.code),info(nullptr){
   FXTRACE((TOPIC_CONSTRUCT,"FXRex::FXRex(FXRex)\n"));
+  if(orig.info){ dupElms(info,orig.info,1); }
   }
 
 
 // Compile expression from pattern; fail if error
-FXRex::FXRex(const FXchar* pattern,FXint mode,FXRex::Error* error){
+FXRex::FXRex(const FXchar* pattern,FXint mode,FXRex::Error* error):info(nullptr){
   FXTRACE((TOPIC_CONSTRUCT,"FXRex::FXRex(%s,%u,%p)\n",pattern,mode,error));
   FXRex::Error err=parse(pattern,mode);
   if(error){ *error=err; }
@@ -5013,7 +6615,7 @@ FXRex::FXRex(const FXchar* pattern,FXint mode,FXRex::Error* error){
 
 
 // Compile expression from pattern; fail if error
-FXRex::FXRex(const FXString& pattern,FXint mode,FXRex::Error* error){
+FXRex::FXRex(const FXString& pattern,FXint mode,FXRex::Error* error):info(nullptr){
   FXTRACE((TOPIC_CONSTRUCT,"FXRex::FXRex(%s,%u,%p)\n",pattern.text(),mode,error));
   FXRex::Error err=parse(pattern.text(),mode);
   if(error){ *error=err; }
@@ -5067,8 +6669,13 @@ FXRex::Error FXRex::parse(const FXchar* pattern,FXint mode){
 #ifdef TOPIC_REXDUMP
                 if(getTraceTopic(TOPIC_REXDUMP)){ dump(adjustedpattern.text(),code.text(),code.text()+code.length()); }
 #endif
-                FXTRACE((TOPIC_DETAIL,"FXRex::parse: OK\n\n"));
-                return ErrOK;
+                // Analyze it once, for all matches and searches
+                err=ErrMemory;
+                if(allocElms(info,1)){
+                  analyze(code.text(),code.length(),*info);
+                  FXTRACE((TOPIC_DETAIL,"FXRex::parse: OK\n\n"));
+                  return ErrOK;
+                  }
                 }
               }
             }
@@ -5091,30 +6698,98 @@ FXRex::Error FXRex::parse(const FXString& pattern,FXint mode){
 
 // Match pattern in string at position pos
 FXbool FXRex::amatch(const FXchar* string,FXint len,FXint pos,FXint mode,FXint* beg,FXint* end,FXint npar) const {
-  FXExecute ms(string,string+len,beg,end,npar,mode);
-  return ms.attempt(code.text(),string+pos);
+  FXAnalysis tmp;
+  const FXAnalysis& an=analysis(code,info,tmp);
+  return rexmatch(code.text(),code.length(),an,string,string+len,string+pos,beg,end,npar,mode);
   }
 
 
 // Match pattern in string at position pos
 FXbool FXRex::amatch(const FXString& string,FXint pos,FXint mode,FXint* beg,FXint* end,FXint npar) const {
-  FXExecute ms(string.text(),string.text()+string.length(),beg,end,npar,mode);
-  return ms.attempt(code.text(),string.text()+pos);
+  return amatch(string.text(),string.length(),pos,mode,beg,end,npar);
   }
 
 /*******************************************************************************/
 
 // Search for pattern in string, starting at fm; return position or -1
 FXint FXRex::search(const FXchar* string,FXint len,FXint fm,FXint to,FXint mode,FXint* beg,FXint* end,FXint npar) const {
-  FXExecute ms(string,string+len,beg,end,npar,mode);
-  return ms.search(code.text(),string+fm,string+to);
+  FXAnalysis tmp;
+  const FXAnalysis& an=analysis(code,info,tmp);
+  return rexsearch(code.text(),code.length(),an,string,string+len,string+fm,string+to,beg,end,npar,mode);
   }
 
 
 // Search for pattern in string, starting at fm; return position or -1
 FXint FXRex::search(const FXString& string,FXint fm,FXint to,FXint mode,FXint* beg,FXint* end,FXint npar) const {
-  FXExecute ms(string.text(),string.text()+string.length(),beg,end,npar,mode);
-  return ms.search(code.text(),string.text()+fm,string.text()+to);
+  return search(string.text(),string.length(),fm,to,mode,beg,end,npar);
+  }
+
+/*******************************************************************************/
+
+// Gather all pieces of the string delivered by input
+static void gather(FXRexInput& input,FXString& string){
+  const FXchar* ptr;
+  FXint pos=0,b,e;
+  string.clear();
+  while((ptr=input.fetch(pos,b,e))!=nullptr && b<=pos && pos<e){
+    string.append(ptr+pos-b,e-pos);
+    pos=e;
+    }
+  }
+
+
+// Return true if pattern can be matched incrementally
+FXbool FXRex::incremental() const {
+  FXAnalysis tmp;
+  const FXAnalysis& an=analysis(code,info,tmp);
+  return 0<an.nstates;
+  }
+
+
+// Match pattern at position pos of string delivered by input
+FXbool FXRex::amatch(FXRexInput& input,FXint pos,FXint mode,FXint* beg,FXint* end,FXint npar) const {
+  FXAnalysis tmp;
+  FXString string;
+  const FXAnalysis& an=analysis(code,info,tmp);
+  if(!(mode&(FXRex::Unicode|FXRex::Backtrack)) && 0<an.nstates){
+    FXSimulate sim(nullptr,nullptr,beg,end,npar,mode);
+    if(sim.init(code.text(),code.length(),an.nstates)){
+      return 0<=pos && sim.attempt(input,pos);
+      }
+    }
+  gather(input,string);
+  return 0<=pos && pos<=string.length() && amatch(string,pos,mode,beg,end,npar);
+  }
+
+
+// Search for pattern in string delivered by input, starting at fm; return position or -1
+FXint FXRex::search(FXRexInput& input,FXint fm,FXint to,FXint mode,FXint* beg,FXint* end,FXint npar) const {
+  FXAnalysis tmp;
+  FXString string;
+  const FXAnalysis& an=analysis(code,info,tmp);
+  if(fm<=to && !(mode&(FXRex::Unicode|FXRex::Backtrack)) && 0<an.nstates){
+    FXSimulate sim(nullptr,nullptr,beg,end,npar,mode);
+    if(sim.init(code.text(),code.length(),an.nstates)){
+      FXPrefilter pf(code.text(),an);
+      return 0<=fm ? sim.search(input,fm,to,pf) : -1;
+      }
+    }
+  gather(input,string);
+  if(fm<0 || to<0 || (fm>string.length() && to>string.length())) return -1;
+  return rexsearch(code.text(),code.length(),an,string.text(),string.text()+string.length(),string.text()+Math::imin(fm,string.length()),string.text()+Math::imin(to,string.length()),beg,end,npar,mode);
+  }
+
+/*******************************************************************************/
+
+// Return set of bytes with which a match may start
+void FXRex::firstSet(FXuchar set[]) const {
+  FXAnalysis tmp;
+  const FXAnalysis& an=analysis(code,info,tmp);
+  if(an.any){
+    fillElms(set,0xFF,32);
+    return;
+    }
+  copyElms(set,an.set,32);
   }
 
 /*******************************************************************************/
@@ -5279,7 +6954,11 @@ FXString FXRex::escape(const FXString& str){
 
 // Assignment
 FXRex& FXRex::operator=(const FXRex& orig){
-  code=orig.code;
+  if(__likely(this!=&orig)){
+    code=orig.code;
+    freeElms(info);
+    if(orig.info){ dupElms(info,orig.info,1); }
+    }
   return *this;
   }
 
@@ -5306,6 +6985,10 @@ FXStream& operator<<(FXStream& store,const FXRex& s){
 // Load
 FXStream& operator>>(FXStream& store,FXRex& s){
   store >> s.code;
+  freeElms(s.info);
+  if(allocElms(s.info,1)){
+    analyze(s.code.text(),s.code.length(),*s.info);
+    }
   return store;
   }
 
@@ -5313,6 +6996,7 @@ FXStream& operator>>(FXStream& store,FXRex& s){
 // Clear program
 void FXRex::clear(){
   code.clear();
+  freeElms(info);
   }
 
 
@@ -0,0 +1,189 @@
+/********************************************************************************
+*                                                                               *
+*          R e g u l a r   E x p r e s s i o n   C a c h e   C l a s s          *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+*********************************************************************************
+* This library is free software; you can redistribute it and/or modify          *
+* it under the terms of the GNU Lesser General Public License as published by   *
+* the Free Software Foundation; either version 3 of the License, or             *
+* (at your option) any later version.                                           *
+*                                                                               *
+* This library is distributed in the hope that it will be useful,               *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of                *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the                 *
+* GNU Lesser General Public License for more details.                           *
+*                                                                               *
+* You should have received a copy of the GNU Lesser General Public License      *
+* along with this program.  If not, see <http://www.gnu.org/licenses/>          *
+********************************************************************************/
+#include "xincs.h"
+#include "fxver.h"
+#include "fxdefs.h"
+#include "FXElement.h"
+#include "FXArray.h"
+#include "FXAtomic.h"
+#include "FXRefPtr.h"
+#include "FXString.h"
+#include "FXMutex.h"
+#include "FXDictionary.h"
+#include "FXRex.h"
+#include "FXRexCache.h"
+
+
+/*
+  Notes:
+
+  - Patterns are looked up by a key made of the parse mode, followed by the pattern
+    itself; the dictionary maps the key to the slot of the entry, plus one, so that a
+    slot is never mapped to NULL.
+
+  - The entries are kept in a doubly linked list in order of use; a lookup moves the
+    entry found to the front, and a new entry replaces the one at the back once the
+    cache is full.
+
+  - The pattern is parsed without holding the lock, so other threads aren't held up
+    by a complicated pattern.  If two threads parse the same pattern at the same time,
+    only the first to finish adds it to the cache.
+
+  - Compiled patterns are reference counted, and shared by the cache and the callers
+    of get(); a lookup only bumps the count, rather than copying the program.  Since
+    a compiled pattern is never changed after parsing, no lock is needed to use it.
+*/
+
+#define TOPIC_CONSTRUCT 1000
+
+using namespace FX;
+
+/*******************************************************************************/
+
+namespace FX {
+
+
+// Parse pattern
+FXRexCache::Pattern::Pattern(const FXchar* pattern,FXint mode):refs(0){
+  err=rex.parse(pattern,mode);
+  }
+
+
+// Add a reference
+void FXRexCache::Pattern::ref(){
+  atomicAdd(&refs,1);
+  }
+
+
+// Drop a reference; delete when it was the last one
+void FXRexCache::Pattern::unref(){
+  if(atomicAdd(&refs,-1)==1) delete this;
+  }
+
+
+// Delete pattern
+FXRexCache::Pattern::~Pattern(){
+  }
+
+/*******************************************************************************/
+
+// Construct cache holding at most size patterns
+FXRexCache::FXRexCache(FXint size):head(-1),tail(-1),limit(size),hits(0),misses(0){
+  FXTRACE((TOPIC_CONSTRUCT,"FXRexCache::FXRexCache(%d)\n",size));
+  }
+
+
+// Take entry out of the list
+void FXRexCache::unlink(FXint e){
+  if(entries[e].prev<0) head=entries[e].next; else entries[entries[e].prev].next=entries[e].next;
+  if(entries[e].next<0) tail=entries[e].prev; else entries[entries[e].next].prev=entries[e].prev;
+  }
+
+
+// Put entry at the front of the list
+void FXRexCache::link(FXint e){
+  entries[e].prev=-1;
+  entries[e].next=head;
+  if(0<=head) entries[head].prev=e; else tail=e;
+  head=e;
+  }
+
+
+// Return compiled pattern, parsing it if not in the cache yet
+FXRefPtr<FXRexCache::Pattern> FXRexCache::get(const FXchar* pattern,FXint mode){
+  FXRefPtr<Pattern> result;
+  FXString key;
+  FXival pos;
+  FXint e;
+  if(!pattern){ result=new Pattern(pattern,mode); return result; }
+  key.format("%x:%s",mode,pattern);
+  mutex.lock();
+  if(0<=(pos=index.find(key))){
+    e=(FXint)(FXival)index.data(pos)-1;
+    unlink(e);
+    link(e);
+    hits++;
+    result=entries[e].pattern;
+    mutex.unlock();
+    return result;
+    }
+  misses++;
+  mutex.unlock();
+  result=new Pattern(pattern,mode);
+  mutex.lock();
+  if(index.find(key)<0 && 0<limit){
+    if(entries.no()<limit){
+      e=(FXint)entries.no();
+      if(!entries.no(e+1)){ mutex.unlock(); return result; }
+      }
+    else{
+      e=tail;
+      unlink(e);
+      index.remove(entries[e].key);
+      }
+    entries[e].key=key;
+    entries[e].pattern=result;
+    link(e);
+    index.insert(key,(void*)(FXival)(e+1));
+    }
+  mutex.unlock();
+  return result;
+  }
+
+
+// Return compiled pattern, parsing it if not in the cache yet
+FXRefPtr<FXRexCache::Pattern> FXRexCache::get(const FXString& pattern,FXint mode){
+  return get(pattern.text(),mode);
+  }
+
+
+// Change maximum number of patterns kept
+void FXRexCache::setSize(FXint size){
+  FXScopedMutex locker(mutex);
+  entries.clear();
+  index.clear();
+  head=tail=-1;
+  limit=size;
+  }
+
+
+// Drop all patterns
+void FXRexCache::clear(){
+  FXScopedMutex locker(mutex);
+  entries.clear();
+  index.clear();
+  head=tail=-1;
+  }
+
+
+// Return cache shared by the whole program
+FXRexCache& FXRexCache::instance(){
+  static FXRexCache cache;
+  return cache;
+  }
+
+
+// Destroy cache
+FXRexCache::~FXRexCache(){
+  FXTRACE((TOPIC_CONSTRUCT,"FXRexCache::~FXRexCache()\n"));
+  }
+
+}
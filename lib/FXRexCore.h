@@ -0,0 +1,57 @@
+/********************************************************************************
+*                                                                               *
+*           R e g u l a r   E x p r e s s i o n   I n t e r n a l s             *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+*********************************************************************************
+* This library is free software; you can redistribute it and/or modify          *
+* it under the terms of the GNU Lesser General Public License as published by   *
+* the Free Software Foundation; either version 3 of the License, or             *
+* (at your option) any later version.                                           *
+*                                                                               *
+* This library is distributed in the hope that it will be useful,               *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of                *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the                 *
+* GNU Lesser General Public License for more details.                           *
+*                                                                               *
+* You should have received a copy of the GNU Lesser General Public License      *
+* along with this program.  If not, see <http://www.gnu.org/licenses/>          *
+********************************************************************************/
+#ifndef FXREXCORE_H
+#define FXREXCORE_H
+
+namespace FX {
+
+// Analysis of a program, made once when the program is compiled, and kept by
+// FXRex: the number of states needed to simulate it in lock-step, the set of
+// bytes which may start a match, and a literal string which must occur in every
+// match
+struct FXAnalysis {
+  FXint          nstates;           // States needed for lock-step simulation, or -1
+  FXint          lit;               // Offset of literal in program, or -1 if none
+  FXint          len;               // Length of literal, or 0 if none
+  FXint          nfew;              // Number of bytes in few, or 0 if many
+  FXuchar        set[32];           // Bytes with which a match may start
+  FXuchar        few[3];            // Same, if only a few
+  FXbool         ci;                // Literal in lower case, compared ignoring case
+  FXbool         prefix;            // Literal starts every match
+  FXbool         any;               // Match may start with any byte, or be empty
+  };
+
+// Return number of states needed to simulate program in lock-step, or -1 if
+// it can't be simulated
+extern FXint fxrexstates(const FXchar* prog,FXint len);
+
+// Search n programs, the k-th one spanning entry[k]...entry[k+1], in one pass
+// over the string; start[ch] lists the programs which may start with byte ch,
+// and start[256] those which may match the empty string at the end.
+// When all is true, beg[k] and end[k] are set for each program, and the number
+// of programs which matched is returned; otherwise, the first program which
+// matched is returned, and its match is in beg[0] and end[0].
+// Return -2 if out of memory
+extern FXint fxrexsearchset(const FXchar* prog,const FXint* entry,const FXArray<FXint>* start,FXint n,const FXchar* sbeg,const FXchar* send,const FXchar* fm,const FXchar* to,FXint mode,FXint* beg,FXint* end,FXbool all);
+
+}
+
+#endif
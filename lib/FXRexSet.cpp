@@ -0,0 +1,248 @@
+/********************************************************************************
+*                                                                               *
+*             R e g u l a r   E x p r e s s i o n   S e t   C l a s s           *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+*********************************************************************************
+* This library is free software; you can redistribute it and/or modify          *
+* it under the terms of the GNU Lesser General Public License as published by   *
+* the Free Software Foundation; either version 3 of the License, or             *
+* (at your option) any later version.                                           *
+*                                                                               *
+* This library is distributed in the hope that it will be useful,               *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of                *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the                 *
+* GNU Lesser General Public License for more details.                           *
+*                                                                               *
+* You should have received a copy of the GNU Lesser General Public License      *
+* along with this program.  If not, see <http://www.gnu.org/licenses/>          *
+********************************************************************************/
+#include "xincs.h"
+#include "fxver.h"
+#include "fxdefs.h"
+#include "FXElement.h"
+#include "FXArray.h"
+#include "FXString.h"
+#include "FXRex.h"
+#include "FXRexSet.h"
+#include "FXRexCore.h"
+
+
+/*
+  Notes:
+
+  - Each pattern is compiled by FXRex.  The programs of the patterns which can be
+    simulated in lock-step are concatenated; since jumps in a program are relative,
+    and each program ends at its own OP_PASS, they don't interfere.
+
+  - Searching starts threads for each of the programs at each position, in order
+    of the patterns, and runs them all in a single pass over the string.  Threads
+    are only started for programs which may start with the byte at hand; for each
+    byte, the list of those programs is kept, as well as a list of the programs
+    which may match the empty string at the end of the subject string.  Where no
+    program may start, no threads are started at all, and the string is skipped
+    over quickly.  When searching for the first match of any pattern, the first
+    thread to finish cuts off all threads of lower priority, just as if the patterns
+    were alternatives of one big pattern; when searching for each pattern, it only
+    cuts off the threads of its own pattern.
+
+  - The lists of programs for each byte are kept up to date as patterns are
+    appended; since a new program has the highest number, it's simply appended to
+    the lists of the bytes it may start with, so appending many patterns takes
+    linear time, and searching doesn't change the set.
+
+  - Patterns which can't be simulated are searched for one at a time, as are all
+    patterns when searching backwards, when the Backtrack flag is passed, or when
+    there's not enough memory to simulate the programs.  When looking for the first
+    match of any pattern, the search range is narrowed down to the best match found
+    so far.
+
+  - Only the whole match is reported; for the captured sub-patterns, match the
+    pattern which was found again with FXRex::amatch().
+*/
+
+#define TOPIC_CONSTRUCT 1000
+
+using namespace FX;
+
+/*******************************************************************************/
+
+namespace FX {
+
+// Check if character in set
+static inline FXuchar ISIN(const FXuchar set[],FXint ch){
+  return set[ch>>3]&(1<<(ch&7));
+  }
+
+
+// Add program k to the lists of programs which may start with each byte in set; if it
+// may start with any byte, and thus also match the empty string, list it for byte 256
+static void startlists(FXArray<FXint> start[],const FXuchar set[],FXint k){
+  FXint ch;
+  for(ch=0; ch<256 && ISIN(set,ch); ++ch){ }
+  if(ch==256) start[256].append(k);
+  for(ch=0; ch<256; ++ch){
+    if(ISIN(set,ch)) start[ch].append(k);
+    }
+  }
+
+
+// Construct empty set of patterns
+FXRexSet::FXRexSet(){
+  FXTRACE((TOPIC_CONSTRUCT,"FXRexSet::FXRexSet()\n"));
+  }
+
+
+// Copy set of patterns
+FXRexSet::FXRexSet(const FXRexSet& orig):rex(orig.rex),entry(orig.entry),which(orig.which),rest(orig.rest),code(orig.code){
+  FXTRACE((TOPIC_CONSTRUCT,"FXRexSet::FXRexSet(FXRexSet)\n"));
+  for(FXint ch=0; ch<257; ++ch) start[ch]=orig.start[ch];
+  }
+
+
+// Parse pattern, and append it to the set
+FXRex::Error FXRexSet::append(const FXchar* pattern,FXint mode){
+  FXRex::Error err;
+  FXRex pat(pattern,mode,&err);
+  if(err==FXRex::ErrOK){
+    if(0<fxrexstates(pat.code.text(),pat.code.length())){
+      FXuchar set[32];
+      if(entry.no()==0) entry.append(0);
+      code.append(pat.code);
+      entry.append(code.length());
+      which.append(no());
+      pat.firstSet(set);
+      startlists(start,set,which.no()-1);
+      }
+    else{
+      rest.append(no());
+      }
+    rex.append(pat);
+    }
+  return err;
+  }
+
+
+// Parse pattern, and append it to the set
+FXRex::Error FXRexSet::append(const FXString& pattern,FXint mode){
+  return append(pattern.text(),mode);
+  }
+
+
+// Search for first match of any pattern, one pattern at a time, from fm toward to; bounds
+// the search by the best match found so far, which is passed in pat, beg[0], and end[0]
+static FXint searchsingly(const FXRex* rex,const FXint* list,FXint n,const FXchar* string,FXint len,FXint fm,FXint to,FXint mode,FXint pat,FXint* beg,FXint* end){
+  FXint b[1],e[1],pos,i,k;
+  if(0<=pat) to=beg[0];
+  for(k=0; k<n; ++k){
+    i=list?list[k]:k;
+    if(0<=(pos=rex[i].search(string,len,fm,to,mode,b,e,1))){
+      if(pat<0 || pos!=beg[0] || i<pat){
+        beg[0]=b[0];
+        end[0]=e[0];
+        pat=i;
+        to=pos;
+        }
+      }
+    }
+  return pat;
+  }
+
+
+// Search for first match of any pattern
+FXint FXRexSet::search(const FXchar* string,FXint len,FXint fm,FXint to,FXint mode,FXint* beg,FXint* end) const {
+  FXint b[1],e[1],pat=-2;
+  if(fm<=to && 0<which.no() && !(mode&FXRex::Backtrack)){
+    pat=fxrexsearchset(code.text(),entry.data(),start,which.no(),string,string+len,string+fm,string+to,mode,b,e,false);
+    if(0<=pat) pat=which[pat];
+    }
+  if(-2<pat){
+    pat=searchsingly(rex.data(),rest.data(),rest.no(),string,len,fm,to,mode,pat,b,e);
+    }
+  else{
+    pat=searchsingly(rex.data(),nullptr,no(),string,len,fm,to,mode,-1,b,e);
+    }
+  if(0<=pat){
+    if(beg) beg[0]=b[0];
+    if(end) end[0]=e[0];
+    }
+  return pat;
+  }
+
+
+// Search for first match of any pattern
+FXint FXRexSet::search(const FXString& string,FXint fm,FXint to,FXint mode,FXint* beg,FXint* end) const {
+  return search(string.text(),string.length(),fm,to,mode,beg,end);
+  }
+
+
+// Search for first match of each pattern
+FXint FXRexSet::searchAll(const FXchar* string,FXint len,FXint fm,FXint to,FXint mode,FXint* beg,FXint* end) const {
+  FXint found=-2,i,k,n=which.no();
+  FXint *b,*e;
+  fillElms(beg,-1,no());
+  fillElms(end,-1,no());
+  if(fm<=to && 0<n && !(mode&FXRex::Backtrack) && allocElms(b,n+n)){
+    e=b+n;
+    if(0<=(found=fxrexsearchset(code.text(),entry.data(),start,n,string,string+len,string+fm,string+to,mode,b,e,true))){
+      for(k=0; k<n; ++k){
+        beg[which[k]]=b[k];
+        end[which[k]]=e[k];
+        }
+      }
+    freeElms(b);
+    }
+  if(0<=found){
+    for(k=0; k<rest.no(); ++k){
+      i=rest[k];
+      if(0<=rex[i].search(string,len,fm,to,mode,beg+i,end+i,1)){ found++; continue; }
+      beg[i]=end[i]=-1;
+      }
+    return found;
+    }
+  for(i=found=0; i<no(); ++i){
+    if(0<=rex[i].search(string,len,fm,to,mode,beg+i,end+i,1)){ found++; continue; }
+    beg[i]=end[i]=-1;
+    }
+  return found;
+  }
+
+
+// Search for first match of each pattern
+FXint FXRexSet::searchAll(const FXString& string,FXint fm,FXint to,FXint mode,FXint* beg,FXint* end) const {
+  return searchAll(string.text(),string.length(),fm,to,mode,beg,end);
+  }
+
+
+// Assign another set of patterns to this one
+FXRexSet& FXRexSet::operator=(const FXRexSet& orig){
+  if(&orig!=this){
+    rex=orig.rex;
+    entry=orig.entry;
+    which=orig.which;
+    rest=orig.rest;
+    for(FXint ch=0; ch<257; ++ch) start[ch]=orig.start[ch];
+    code=orig.code;
+    }
+  return *this;
+  }
+
+
+// Remove all patterns
+void FXRexSet::clear(){
+  rex.clear();
+  entry.clear();
+  which.clear();
+  rest.clear();
+  for(FXint ch=0; ch<257; ++ch) start[ch].clear();
+  code.clear();
+  }
+
+
+// Delete
+FXRexSet::~FXRexSet(){
+  FXTRACE((TOPIC_CONSTRUCT,"FXRexSet::~FXRexSet()\n"));
+  }
+
+}
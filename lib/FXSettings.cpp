@@ -57,6 +57,13 @@
 
   - Extensive error checking in unparseFile() to ensure no settings data is
     lost when disk is full.
+
+  - Short strings are stored in-place, and thus move when a section's table is
+    resized.  Since readStringEntry() returns a pointer to the text of the value,
+    values are always kept on the heap, by reserving room for a long string when
+    storing them; the heap buffer is handed over when the table is resized, so the
+    pointer remains valid until that entry is changed or removed.  Values stored
+    into a section directly, bypassing the write functions, may still move.
 */
 
 
@@ -71,10 +78,29 @@ namespace FX {
 
 
 // Empty string dictionary table value
-extern const FXint __string__empty__[];
 extern const FXival __stringdictionary__empty__[];
 extern const FXival __settings__empty__[];
-const FXival __settings__empty__[6]={1,0,1,(FXival)(__string__empty__+1),(FXival)(__stringdictionary__empty__+3),0};
+const FXival __settings__empty__[8]={1,0,1,0,0,0,(FXival)(__stringdictionary__empty__+3),0};
+
+
+// Keep text of stored value on the heap, so it stays put when the section is resized
+static inline FXString& settle(FXString& value){
+  value.reserve(FXString::SHORTLEN+1);
+  return value;
+  }
+
+
+// Keep text of all values on the heap; copied strings are stored in-place again
+static void settle(FXSettings& settings){
+  for(FXival s=0; s<settings.no(); ++s){
+    if(!settings.empty(s)){
+      FXStringDictionary& dict=settings.data(s);
+      for(FXival e=0; e<dict.no(); ++e){
+        if(!dict.empty(e)) settle(dict.data(e));
+        }
+      }
+    }
+  }
 
 
 // Adjust the size of the table
@@ -139,18 +165,19 @@ FXbool FXSettings::resize(FXival n){
 
 // Construct settings database
 FXSettings::FXSettings():table(EMPTY),modified(false){
-  FXASSERT(sizeof(Entry)<=sizeof(FXival)*3);
+  FXASSERT(sizeof(Entry)<=sizeof(FXival)*5);
   }
 
 
 // Construct from another settings database
 FXSettings::FXSettings(const FXSettings& other):table(EMPTY),modified(other.modified){
-  FXASSERT(sizeof(Entry)<=sizeof(FXival)*3);
+  FXASSERT(sizeof(Entry)<=sizeof(FXival)*5);
   if(1<other.no()){
     if(__unlikely(!no(other.no()))){ throw FXMemoryException("FXSettings::FXSettings: out of memory\n"); }
     copyElms(table,other.table,no());
     free(other.free());
     used(other.used());
+    settle(*this);
     }
   }
 
@@ -163,6 +190,7 @@ FXSettings& FXSettings::operator=(const FXSettings& other){
       copyElms(table,other.table,no());
       free(other.free());
       used(other.used());
+      settle(*this);
       }
     else{
       no(1);
@@ -355,7 +383,7 @@ FXbool FXSettings::parse(const FXString& str,FXbool mrk){
       value=FXString::unescape(str.mid(b,e-b),'"','"');
 
       // Add entry to current section
-      at(section).at(name,mrk)=value;
+      settle(at(section).at(name,mrk)=value);
       }
 
     // Skip to end of line
@@ -468,7 +496,9 @@ FXint FXSettings::writeFormatEntry(const FXchar* section,const FXchar* name,cons
   FXint result;
   va_list args;
   va_start(args,fmt);
-  result=at(section).at(name,true).vformat(fmt,args);
+  FXString& value=at(section).at(name,true);
+  result=value.vformat(fmt,args);
+  settle(value);
   va_end(args);
   return result;
   }
@@ -479,7 +509,9 @@ FXint FXSettings::writeFormatEntry(const FXString& section,const FXchar* name,co
   FXint result;
   va_list args;
   va_start(args,fmt);
-  result=at(section).at(name,true).vformat(fmt,args);
+  FXString& value=at(section).at(name,true);
+  result=value.vformat(fmt,args);
+  settle(value);
   va_end(args);
   return result;
   }
@@ -490,7 +522,9 @@ FXint FXSettings::writeFormatEntry(const FXString& section,const FXString& name,
   FXint result;
   va_list args;
   va_start(args,fmt);
-  result=at(section).at(name,true).vformat(fmt,args);
+  FXString& value=at(section).at(name,true);
+  result=value.vformat(fmt,args);
+  settle(value);
   va_end(args);
   return result;
   }
@@ -521,7 +555,8 @@ const FXchar* FXSettings::readStringEntry(const FXString& section,const FXString
 
 // Write a string-valued registry entry
 FXbool FXSettings::writeStringEntry(const FXchar* section,const FXchar* name,const FXchar* val){
-  at(section).at(name,true)=val;
+  FXString value(val);                  // Copy first; val may point into this section
+  settle(at(section).at(name,true)=value);
   return true;
   }
 
@@ -565,7 +600,7 @@ FXint FXSettings::readIntEntry(const FXString& section,const FXString& name,FXin
 
 // Write a int-valued registry entry
 FXbool FXSettings::writeIntEntry(const FXchar* section,const FXchar* name,FXint val){
-  at(section).at(name,true).fromInt(val);
+  settle(at(section).at(name,true).fromInt(val));
   return true;
   }
 
@@ -609,7 +644,7 @@ FXuint FXSettings::readUIntEntry(const FXString& section,const FXString& name,FX
 
 // Write a unsigned int-valued registry entry
 FXbool FXSettings::writeUIntEntry(const FXchar* section,const FXchar* name,FXuint val){
-  at(section).at(name,true).fromUInt(val);
+  settle(at(section).at(name,true).fromUInt(val));
   return true;
   }
 
@@ -652,7 +687,7 @@ FXlong FXSettings::readLongEntry(const FXString& section,const FXString& name,FX
 
 // Write a 64-bit long integer registry entry
 FXbool FXSettings::writeLongEntry(const FXchar* section,const FXchar* name,FXlong val){
-  at(section).at(name,true).fromLong(val);
+  settle(at(section).at(name,true).fromLong(val));
   return true;
   }
 
@@ -696,7 +731,7 @@ FXulong FXSettings::readULongEntry(const FXString& section,const FXString& name,
 
 // Write a 64-bit long integer registry entry
 FXbool FXSettings::writeULongEntry(const FXchar* section,const FXchar* name,FXulong val){
-  at(section).at(name,true).fromULong(val);
+  settle(at(section).at(name,true).fromULong(val));
   return true;
   }
 
@@ -739,7 +774,7 @@ FXdouble FXSettings::readRealEntry(const FXString& section,const FXString& name,
 
 // Write a double-valued registry entry
 FXbool FXSettings::writeRealEntry(const FXchar* section,const FXchar* name,FXdouble val){
-  at(section).at(name,true).fromDouble(val,16,2);
+  settle(at(section).at(name,true).fromDouble(val,-1,2));
   return true;
   }
 
@@ -780,7 +815,7 @@ FXColor FXSettings::readColorEntry(const FXString& section,const FXString& name,
 
 // Write a color registry entry
 FXbool FXSettings::writeColorEntry(const FXchar* section,const FXchar* name,FXColor val){
-  at(section).at(name,true)=nameFromColor(val);
+  settle(at(section).at(name,true)=nameFromColor(val));
   return true;
   }
 
@@ -828,7 +863,7 @@ FXbool FXSettings::readBoolEntry(const FXString& section,const FXString& name,FX
 
 // Write a boolean registry entry
 FXbool FXSettings::writeBoolEntry(const FXchar* section,const FXchar* name,FXbool val){
-  at(section).at(name,true)=val?"true":"false";
+  settle(at(section).at(name,true)=val?"true":"false");
   return true;
   }
 
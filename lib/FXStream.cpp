@@ -22,6 +22,7 @@
 #include "fxver.h"
 #include "fxdefs.h"
 #include "fxmath.h"
+#include "fxendian.h"
 #include "FXElement.h"
 #include "FXArray.h"
 #include "FXMetaClass.h"
@@ -47,6 +48,12 @@
   - Need to haul some memory stream stuff up (buffer mgmt).
   - Need to have load() and save() API's return number of elements ACTUALLY
     transferred (not bytes but whole numbers of elements!).
+  - Arrays which need no byte swapping are copied in bulk; those which do are
+    byte-swapped while being copied, 16 bytes at a time if SSSE3 is available.
+  - Arrays of bytes at least as large as the buffer are transferred directly
+    between the caller's array and the device, using writeBlock() and readBlock(),
+    once the buffer has been flushed or drained; streams which can't do that simply
+    return 0 from these, and the data goes through the buffer as usual.
 */
 
 
@@ -362,21 +369,115 @@ FXStream& FXStream::operator<<(const FXdouble& v){
 
 /************************  Save Blocks of Basic Types  *************************/
 
-// Write array of bytes
+// Copy n bytes worth of shorts, swapping bytes
+static void copyswap2(FXuchar* dst,const FXuchar* src,FXuval n){
+  FXushort v;
+#if defined(FOX_HAS_SSSE3)
+  const __m128i mask=_mm_setr_epi8(1,0,3,2,5,4,7,6,9,8,11,10,13,12,15,14);
+  while(16<=n){
+    _mm_storeu_si128((__m128i*)dst,_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src),mask));
+    dst+=16;
+    src+=16;
+    n-=16;
+    }
+#endif
+  while(2<=n){
+    memcpy(&v,src,2);
+    v=swap16(v);
+    memcpy(dst,&v,2);
+    dst+=2;
+    src+=2;
+    n-=2;
+    }
+  }
+
+
+// Copy n bytes worth of ints, swapping bytes
+static void copyswap4(FXuchar* dst,const FXuchar* src,FXuval n){
+  FXuint v;
+#if defined(FOX_HAS_SSSE3)
+  const __m128i mask=_mm_setr_epi8(3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12);
+  while(16<=n){
+    _mm_storeu_si128((__m128i*)dst,_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src),mask));
+    dst+=16;
+    src+=16;
+    n-=16;
+    }
+#endif
+  while(4<=n){
+    memcpy(&v,src,4);
+    v=swap32(v);
+    memcpy(dst,&v,4);
+    dst+=4;
+    src+=4;
+    n-=4;
+    }
+  }
+
+
+// Copy n bytes worth of doubles, swapping bytes
+static void copyswap8(FXuchar* dst,const FXuchar* src,FXuval n){
+  FXulong v;
+#if defined(FOX_HAS_SSSE3)
+  const __m128i mask=_mm_setr_epi8(7,6,5,4,3,2,1,0,15,14,13,12,11,10,9,8);
+  while(16<=n){
+    _mm_storeu_si128((__m128i*)dst,_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src),mask));
+    dst+=16;
+    src+=16;
+    n-=16;
+    }
+#endif
+  while(8<=n){
+    memcpy(&v,src,8);
+    v=swap64(v);
+    memcpy(dst,&v,8);
+    dst+=8;
+    src+=8;
+    n-=8;
+    }
+  }
+
+
+// Copy n bytes worth of items of size sz, swapping bytes
+static void copyswap(FXuchar* dst,const FXuchar* src,FXuval n,FXuval sz){
+  switch(sz){
+    case 2: copyswap2(dst,src,n); break;
+    case 4: copyswap4(dst,src,n); break;
+    case 8: copyswap8(dst,src,n); break;
+    }
+  }
+
+
+// Write count bytes directly to the device, bypassing the buffer; the
+// default implementation can't, and returns 0 so the buffer is used instead
+FXuval FXStream::writeBlock(const FXuchar*,FXuval){
+  return 0;
+  }
+
+
+// Write array of bytes; blocks at least as large as the buffer are written
+// straight to the device, if it supports this, once the buffer is flushed
 FXStream& FXStream::save(const FXuchar* p,FXuval n){
+  FXuval m;
   if(code==FXStreamOK){
     FXASSERT(begptr<=rdptr);
     FXASSERT(rdptr<=wrptr);
     FXASSERT(wrptr<=endptr);
     while(0<n){
+      if((FXuval)(endptr-begptr)<=n && writeBuffer(0)==(FXuval)(endptr-begptr) && (m=writeBlock(p,n))>0){
+        pos+=m;
+        p+=m;
+        n-=m;
+        continue;
+        }
       if(wrptr+n>endptr && writeBuffer((wrptr-endptr)+n)<1){ code=FXStreamFull; return *this; }
       FXASSERT(wrptr<endptr);
-      do{
-        *wrptr++=*p++;
-        pos++;
-        n--;
-        }
-      while(0<n && wrptr<endptr);
+      m=FXMIN(n,(FXuval)(endptr-wrptr));
+      memcpy(wrptr,p,m);
+      wrptr+=m;
+      pos+=m;
+      p+=m;
+      n-=m;
       }
     }
   return *this;
@@ -404,148 +505,46 @@ FXStream& FXStream::save(const FXbool* p,FXuval n){
   }
 
 
-// Write array of shorts
-FXStream& FXStream::save(const FXushort* p,FXuval n){
-  const FXuchar *q=(const FXuchar*)p;
+// Write n bytes worth of items of size sz, swapping bytes
+FXStream& FXStream::saveSwapped(const FXuchar* p,FXuval n,FXuval sz){
+  FXuval m;
   if(code==FXStreamOK){
-    n<<=1;
     FXASSERT(begptr<=rdptr);
     FXASSERT(rdptr<=wrptr);
     FXASSERT(wrptr<=endptr);
-    if(swap){
-      while(0<n){
-        if(wrptr+n>endptr && writeBuffer((wrptr-endptr)+n)<2){ code=FXStreamFull; return *this; }
-        FXASSERT(wrptr+2<=endptr);
-        do{
-          wrptr[0]=q[1];
-          wrptr[1]=q[0];
-          wrptr+=2;
-          pos+=2;
-          q+=2;
-          n-=2;
-          }
-        while(0<n && wrptr+2<=endptr);
-        }
-      }
-    else{
-      while(0<n){
-        if(wrptr+n>endptr && writeBuffer((wrptr-endptr)+n)<2){ code=FXStreamFull; return *this; }
-        FXASSERT(wrptr+2<=endptr);
-        do{
-          wrptr[0]=q[0];
-          wrptr[1]=q[1];
-          wrptr+=2;
-          pos+=2;
-          q+=2;
-          n-=2;
-          }
-        while(0<n && wrptr+2<=endptr);
-        }
+    while(0<n){
+      if(wrptr+n>endptr && writeBuffer((wrptr-endptr)+n)<sz){ code=FXStreamFull; return *this; }
+      FXASSERT(wrptr+sz<=endptr);
+      m=FXMIN(n,(FXuval)(endptr-wrptr))&~(sz-1);
+      copyswap(wrptr,p,m,sz);
+      wrptr+=m;
+      pos+=m;
+      p+=m;
+      n-=m;
       }
     }
   return *this;
   }
 
 
+// Write array of shorts
+FXStream& FXStream::save(const FXushort* p,FXuval n){
+  if(swap) return saveSwapped((const FXuchar*)p,n<<1,2);
+  return save((const FXuchar*)p,n<<1);
+  }
+
+
 // Write array of ints
 FXStream& FXStream::save(const FXuint* p,FXuval n){
-  const FXuchar *q=(const FXuchar*)p;
-  if(code==FXStreamOK){
-    n<<=2;
-    FXASSERT(begptr<=rdptr);
-    FXASSERT(rdptr<=wrptr);
-    FXASSERT(wrptr<=endptr);
-    if(swap){
-      while(0<n){
-        if(wrptr+n>endptr && writeBuffer((wrptr-endptr)+n)<4){ code=FXStreamFull; return *this; }
-        FXASSERT(wrptr+4<=endptr);
-        do{
-          wrptr[0]=q[3];
-          wrptr[1]=q[2];
-          wrptr[2]=q[1];
-          wrptr[3]=q[0];
-          wrptr+=4;
-          pos+=4;
-          q+=4;
-          n-=4;
-          }
-        while(0<n && wrptr+4<=endptr);
-        }
-      }
-    else{
-      while(0<n){
-        if(wrptr+n>endptr && writeBuffer((wrptr-endptr)+n)<4){ code=FXStreamFull; return *this; }
-        FXASSERT(wrptr+4<=endptr);
-        do{
-          wrptr[0]=q[0];
-          wrptr[1]=q[1];
-          wrptr[2]=q[2];
-          wrptr[3]=q[3];
-          wrptr+=4;
-          pos+=4;
-          q+=4;
-          n-=4;
-          }
-        while(0<n && wrptr+4<=endptr);
-        }
-      }
-    }
-  return *this;
+  if(swap) return saveSwapped((const FXuchar*)p,n<<2,4);
+  return save((const FXuchar*)p,n<<2);
   }
 
 
 // Write array of doubles
 FXStream& FXStream::save(const FXdouble* p,FXuval n){
-  const FXuchar *q=(const FXuchar*)p;
-  if(code==FXStreamOK){
-    n<<=3;
-    FXASSERT(begptr<=rdptr);
-    FXASSERT(rdptr<=wrptr);
-    FXASSERT(wrptr<=endptr);
-    if(swap){
-      while(0<n){
-        if(wrptr+n>endptr && writeBuffer((wrptr-endptr)+n)<8){ code=FXStreamFull; return *this; }
-        FXASSERT(wrptr+8<=endptr);
-        do{
-          wrptr[0]=q[7];
-          wrptr[1]=q[6];
-          wrptr[2]=q[5];
-          wrptr[3]=q[4];
-          wrptr[4]=q[3];
-          wrptr[5]=q[2];
-          wrptr[6]=q[1];
-          wrptr[7]=q[0];
-          wrptr+=8;
-          pos+=8;
-          q+=8;
-          n-=8;
-          }
-        while(0<n && wrptr+8<=endptr);
-        }
-      }
-    else{
-      while(0<n){
-        if(wrptr+n>endptr && writeBuffer((wrptr-endptr)+n)<8){ code=FXStreamFull; return *this; }
-        FXASSERT(wrptr+8<=endptr);
-        do{
-          wrptr[0]=q[0];
-          wrptr[1]=q[1];
-          wrptr[2]=q[2];
-          wrptr[3]=q[3];
-          wrptr[4]=q[4];
-          wrptr[5]=q[5];
-          wrptr[6]=q[6];
-          wrptr[7]=q[7];
-          wrptr+=8;
-          pos+=8;
-          q+=8;
-          n-=8;
-          }
-        while(0<n && wrptr+8<=endptr);
-        }
-      }
-    }
-  return *this;
+  if(swap) return saveSwapped((const FXuchar*)p,n<<3,8);
+  return save((const FXuchar*)p,n<<3);
   }
 
 
@@ -668,21 +667,38 @@ FXStream& FXStream::operator>>(FXdouble& v){
 
 /************************  Load Blocks of Basic Types  *************************/
 
-// Read array of bytes
+// Read count bytes directly from the device, bypassing the buffer; the
+// default implementation can't, and returns 0 so the buffer is used instead
+FXuval FXStream::readBlock(FXuchar*,FXuval){
+  return 0;
+  }
+
+
+// Read array of bytes; once the buffer is drained, blocks at least as large
+// as the buffer are read straight from the device, if it supports this
 FXStream& FXStream::load(FXuchar* p,FXuval n){
+  FXuval m;
   if(code==FXStreamOK){
     FXASSERT(begptr<=rdptr);
     FXASSERT(rdptr<=wrptr);
     FXASSERT(wrptr<=endptr);
     while(0<n){
-      if(rdptr+n>wrptr && readBuffer((rdptr-wrptr)+n)<1){ code=FXStreamEnd; return *this; }
-      FXASSERT(rdptr<wrptr);
-      do{
-        *p++=*rdptr++;
-        pos++;
-        n--;
+      if(rdptr==wrptr){
+        if((FXuval)(endptr-begptr)<=n && (m=readBlock(p,n))>0){
+          pos+=m;
+          p+=m;
+          n-=m;
+          continue;
+          }
+        if(readBuffer(n)<1){ code=FXStreamEnd; return *this; }
         }
-      while(0<n && rdptr<wrptr);
+      FXASSERT(rdptr<wrptr);
+      m=FXMIN(n,(FXuval)(wrptr-rdptr));
+      memcpy(p,rdptr,m);
+      rdptr+=m;
+      pos+=m;
+      p+=m;
+      n-=m;
       }
     }
   return *this;
@@ -710,148 +726,46 @@ FXStream& FXStream::load(FXbool* p,FXuval n){
   }
 
 
-// Read array of shorts
-FXStream& FXStream::load(FXushort* p,FXuval n){
-  FXuchar *q=(FXuchar*)p;
+// Read n bytes worth of items of size sz, swapping bytes
+FXStream& FXStream::loadSwapped(FXuchar* p,FXuval n,FXuval sz){
+  FXuval m;
   if(code==FXStreamOK){
-    n<<=1;
     FXASSERT(begptr<=rdptr);
     FXASSERT(rdptr<=wrptr);
     FXASSERT(wrptr<=endptr);
-    if(swap){
-      while(0<n){
-        if(rdptr+n>wrptr && readBuffer((rdptr-wrptr)+n)<2){ code=FXStreamEnd; return *this; }
-        FXASSERT(rdptr+2<=wrptr);
-        do{
-          q[1]=rdptr[0];
-          q[0]=rdptr[1];
-          rdptr+=2;
-          pos+=2;
-          q+=2;
-          n-=2;
-          }
-        while(0<n && rdptr+2<=wrptr);
-        }
-      }
-    else{
-      while(0<n){
-        if(rdptr+n>wrptr && readBuffer((rdptr-wrptr)+n)<2){ code=FXStreamEnd; return *this; }
-        FXASSERT(rdptr+2<=wrptr);
-        do{
-          q[0]=rdptr[0];
-          q[1]=rdptr[1];
-          rdptr+=2;
-          pos+=2;
-          q+=2;
-          n-=2;
-          }
-        while(0<n && rdptr+2<=wrptr);
-        }
+    while(0<n){
+      if(rdptr+n>wrptr && readBuffer((rdptr-wrptr)+n)<sz){ code=FXStreamEnd; return *this; }
+      FXASSERT(rdptr+sz<=wrptr);
+      m=FXMIN(n,(FXuval)(wrptr-rdptr))&~(sz-1);
+      copyswap(p,rdptr,m,sz);
+      rdptr+=m;
+      pos+=m;
+      p+=m;
+      n-=m;
       }
     }
   return *this;
   }
 
 
+// Read array of shorts
+FXStream& FXStream::load(FXushort* p,FXuval n){
+  if(swap) return loadSwapped((FXuchar*)p,n<<1,2);
+  return load((FXuchar*)p,n<<1);
+  }
+
+
 // Read array of ints
 FXStream& FXStream::load(FXuint* p,FXuval n){
-  FXuchar *q=(FXuchar*)p;
-  if(code==FXStreamOK){
-    n<<=2;
-    FXASSERT(begptr<=rdptr);
-    FXASSERT(rdptr<=wrptr);
-    FXASSERT(wrptr<=endptr);
-    if(swap){
-      while(0<n){
-        if(rdptr+n>wrptr && readBuffer((rdptr-wrptr)+n)<4){ code=FXStreamEnd; return *this; }
-        FXASSERT(rdptr+4<=wrptr);
-        do{
-          q[3]=rdptr[0];
-          q[2]=rdptr[1];
-          q[1]=rdptr[2];
-          q[0]=rdptr[3];
-          rdptr+=4;
-          pos+=4;
-          q+=4;
-          n-=4;
-          }
-        while(0<n && rdptr+4<=wrptr);
-        }
-      }
-    else{
-      while(0<n){
-        if(rdptr+n>wrptr && readBuffer((rdptr-wrptr)+n)<4){ code=FXStreamEnd; return *this; }
-        FXASSERT(rdptr+4<=wrptr);
-        do{
-          q[0]=rdptr[0];
-          q[1]=rdptr[1];
-          q[2]=rdptr[2];
-          q[3]=rdptr[3];
-          rdptr+=4;
-          pos+=4;
-          q+=4;
-          n-=4;
-          }
-        while(0<n && rdptr+4<=wrptr);
-        }
-      }
-    }
-  return *this;
+  if(swap) return loadSwapped((FXuchar*)p,n<<2,4);
+  return load((FXuchar*)p,n<<2);
   }
 
 
 // Read array of doubles
 FXStream& FXStream::load(FXdouble* p,FXuval n){
-  FXuchar *q=(FXuchar*)p;
-  if(code==FXStreamOK){
-    n<<=3;
-    FXASSERT(begptr<=rdptr);
-    FXASSERT(rdptr<=wrptr);
-    FXASSERT(wrptr<=endptr);
-    if(swap){
-      while(0<n){
-        if(rdptr+n>wrptr && readBuffer((rdptr-wrptr)+n)<8){ code=FXStreamEnd; return *this; }
-        FXASSERT(rdptr+4<=wrptr);
-        do{
-          q[7]=rdptr[0];
-          q[6]=rdptr[1];
-          q[5]=rdptr[2];
-          q[4]=rdptr[3];
-          q[3]=rdptr[4];
-          q[2]=rdptr[5];
-          q[1]=rdptr[6];
-          q[0]=rdptr[7];
-          rdptr+=8;
-          pos+=8;
-          q+=8;
-          n-=8;
-          }
-        while(0<n && rdptr+8<=wrptr);
-        }
-      }
-    else{
-      while(0<n){
-        if(rdptr+n>wrptr && readBuffer((rdptr-wrptr)+n)<8){ code=FXStreamEnd; return *this; }
-        FXASSERT(rdptr+4<=wrptr);
-        do{
-          q[0]=rdptr[0];
-          q[1]=rdptr[1];
-          q[2]=rdptr[2];
-          q[3]=rdptr[3];
-          q[4]=rdptr[4];
-          q[5]=rdptr[5];
-          q[6]=rdptr[6];
-          q[7]=rdptr[7];
-          rdptr+=8;
-          pos+=8;
-          q+=8;
-          n-=8;
-          }
-        while(0<n && rdptr+8<=wrptr);
-        }
-      }
-    }
-  return *this;
+  if(swap) return loadSwapped((FXuchar*)p,n<<3,8);
+  return load((FXuchar*)p,n<<3);
   }
 
 
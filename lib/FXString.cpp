@@ -23,6 +23,7 @@
 #include "fxdefs.h"
 #include "fxchar.h"
 #include "fxmath.h"
+#include "fxendian.h"
 #include "fxascii.h"
 #include "fxunicode.h"
 #include "FXArray.h"
@@ -34,15 +35,55 @@
 
 /*
   Notes:
-  - The special pointer-value null represents an empty "" string.
-
   - Strings are never NULL:- this speeds things up a lot as there is no
     need to check for NULL strings anymore.
 
   - In the new representation, '\0' is allowed as a character everywhere; but there
     is always an (uncounted) '\0' at the end.
 
-  - The length preceeds the text in the buffer.
+  - Strings of up to SHORTLEN bytes are stored inside the object, which is three
+    pointers in size; the last byte holds the length, and the text starts at the
+    first byte.  Thus, strings of up to 22 bytes (10 bytes on 32-bit machines) don't
+    need any memory allocation, and neither do the many empty strings.
+
+  - Longer strings are allocated on the heap, with the capacity and length preceeding
+    the text in the buffer; the object holds the pointer to the text, and its last byte
+    is set to LONGMARK to tell the two apart.
+
+  - The capacity of a long string is the number of bytes it can hold without being
+    reallocated.  When a long string outgrows its capacity, the capacity grows by half,
+    so that a string built up by appending is reallocated only O(log N) times, and each
+    append costs amortized O(1).  When a long string shrinks to a quarter of its capacity
+    or less, the buffer is reduced to fit, and if it's SHORTLEN or less, the string moves
+    back into the object.  Thus, clearing a string releases its memory, unless room was
+    reserved for it, see below.
+
+  - Capacity set by means of reserve() is marked with RESERVED instead of LONGMARK, and
+    is kept when the string shrinks, so a string may be cleared and refilled without
+    being reallocated; a long string may thus be shorter than SHORTLEN.  Only shrink()
+    releases reserved capacity.  Once the string outgrows it, the capacity grows, and
+    shrinks again, automatically.
+
+  - An empty string is all zeroes; this allows tables of entries with empty string keys
+    to be set up as compile-time constant data, see FXDictionary and friends.
+
+  - No pointers into the object itself are kept, so FXString may be moved around in
+    memory without the need to adjust anything, like FXArray does when it resizes.
+
+  - Counting characters, and locating the n-th character, amounts to counting the bytes
+    which start a utf8 character, i.e. all bytes except followers 0x80...0xBF; with SSE2,
+    this is done 16 bytes at a time.  Each character is assumed to be well-formed, which
+    is the same assumption made by inc() and dec().
+    Functions looking at a single character, like wc(), wcnxt(), wcprv(), validate(),
+    and wcvalid(), touch at most four bytes, and are left scalar; it's the loops over
+    many characters which pay off.
+
+  - The hash function reads the string 8 bytes at a time, along two independent lanes
+    for strings over 16 bytes; the last few bytes are picked up with overlapping reads
+    so that there is no byte-at-a-time tail loop.  The result is run through a final
+    mixing step so that every byte of the key affects all bits of the hash; FXDictionary
+    and friends take both the slot and a 7-bit tag from the hash value.
+    Hash values depend on byte order, and must not be stored.
 
   - UTF-8 Encoding scheme:
 
@@ -78,8 +119,14 @@
 // Round up to nearest ROUNDVAL
 #define ROUNDUP(n)  (((n)+ROUNDVAL-1)&-ROUNDVAL)
 
-// Special empty string value
-#define EMPTY       (const_cast<FXchar*>((const FXchar*)(__string__empty__+1)))
+// Capacity and length preceed the text of long strings
+#define HEADER      (sizeof(FXint)*2)
+
+// Last byte of long string
+#define LONGMARK    ((FXchar)0xFF)
+
+// Last byte of long string whose capacity was reserved
+#define RESERVED    ((FXchar)0xFE)
 
 using namespace FX;
 
@@ -97,11 +144,6 @@ const FXint LEAD_OFFSET=0xD800-(0x10000>>10);
 const FXint TAIL_OFFSET=0xDC00;
 
 
-// Empty string
-extern const FXint __string__empty__[];
-const FXint __string__empty__[2]={0,0};
-
-
 // Special NULL string
 const FXchar FXString::null[4]={0,0,0,0};
 
@@ -119,6 +161,12 @@ extern FXAPI FXfloat __strtof(const FXchar *beg,const FXchar** end=nullptr,FXboo
 
 /*******************************************************************************/
 
+// Grow capacity by half, but stay clear of overflow
+static inline FXint growth(FXint cap){
+  return (cap<0x50000000) ? cap+(cap>>1) : 0x7FFFFFEF;
+  }
+
+
 // Length of character string
 static inline FXint strlen(const FXchar *src){
   FXint i=0;
@@ -144,162 +192,339 @@ static inline FXint strlen(const FXwchar *src){
 
 /*******************************************************************************/
 
+#if defined(FOX_HAS_SSE2)
+
+// Mask of bytes starting a utf8 character among 16 bytes at s; these are
+// the bytes which are not followers, i.e. not in the range 0x80...0xBF
+static inline FXuint leadmask(const FXchar* s){
+  return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)s),_mm_set1_epi8(-65)));
+  }
+
+#endif
+
+
+// Count utf8 characters starting in s[p...q)
+static FXint leadcount(const FXchar* s,FXint p,FXint q){
+  FXint cnt=0;
+#if defined(FOX_HAS_AVX2)
+  while(p+32<=q){
+    cnt+=pop32(_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_loadu_si256((const __m256i*)(s+p)),_mm256_set1_epi8(-65))));
+    p+=32;
+    }
+#endif
+#if defined(FOX_HAS_SSE2)
+  while(p+16<=q){
+    cnt+=pop32(leadmask(s+p));
+    p+=16;
+    }
+#endif
+  while(p<q){
+    cnt+=isUTF8(s[p]);
+    p++;
+    }
+  return cnt;
+  }
+
+
+// Skip over n utf8 characters starting in s[p...q), and return the start
+// of the next utf8 character, or q if there are n characters or fewer
+static FXint leadskip(const FXchar* s,FXint p,FXint q,FXint n){
+#if defined(FOX_HAS_SSE2)
+  FXuint mask;
+  FXint m;
+  while(p+16<=q){
+    mask=leadmask(s+p);
+    m=pop32(mask);
+    if(n<m){
+      while(0<n){ mask&=mask-1; n--; }
+      return p+ctz32(mask);
+      }
+    n-=m;
+    p+=16;
+    }
+#endif
+  while(p<q){
+    if(isUTF8(s[p]) && n--==0) break;
+    p++;
+    }
+  return p;
+  }
+
+/*******************************************************************************/
+
 // Change the length of the string to len
 FXbool FXString::length(FXint len){
-  if(__likely(len!=length())){
-    FXchar *ptr;
-    if(0<len){
-      if(str==EMPTY){
-        ptr=(FXchar*)::malloc(ROUNDUP(1+len)+sizeof(FXint));
+  FXint old,cap;
+  FXchar *p;
+  if(__unlikely(len<0)) len=0;
+  if(isShort()){
+    if(len<=SHORTLEN){
+      buf[len]=0;
+      buf[SHORTLEN+1]=len;
+      return true;
+      }
+    old=(FXuchar)buf[SHORTLEN+1];
+    cap=ROUNDUP(1+len)-1;
+    if(__unlikely((p=(FXchar*)::malloc(HEADER+cap+1))==nullptr)) return false;
+    p+=HEADER;
+    memcpy(p,buf,old);
+    ptr=p;
+    buf[SHORTLEN+1]=LONGMARK;
+    }
+  else{
+    old=((FXint*)ptr)[-1];
+    cap=((FXint*)ptr)[-2];
+    if(cap<len){
+      cap=ROUNDUP(1+FXMAX(len,growth(cap)))-1;
+      if(__unlikely((p=(FXchar*)::realloc(ptr-HEADER,HEADER+cap+1))==nullptr)) return false;
+      ptr=p+HEADER;
+      buf[SHORTLEN+1]=LONGMARK;
+      }
+    else if(len<old && len<=(cap>>2) && buf[SHORTLEN+1]==LONGMARK){
+      if(len<=SHORTLEN){
+        p=ptr;
+        memcpy(buf,p,len);
+        ::free(p-HEADER);
+        buf[len]=0;
+        buf[SHORTLEN+1]=len;
+        return true;
+        }
+      cap=ROUNDUP(1+len)-1;
+      if(__likely((p=(FXchar*)::realloc(ptr-HEADER,HEADER+cap+1))!=nullptr)){
+        ptr=p+HEADER;
         }
       else{
-        ptr=(FXchar*)::realloc(str-sizeof(FXint),ROUNDUP(1+len)+sizeof(FXint));
+        cap=((FXint*)ptr)[-2];
         }
-      if(__unlikely(!ptr)) return false;
-      str=ptr+sizeof(FXint);
-      str[len]=0;
-      *(((FXint*)str)-1)=len;
       }
-    else if(str!=EMPTY){
-      ::free(str-sizeof(FXint));
-      str=EMPTY;
+    }
+  ptr[len]=0;
+  ((FXint*)ptr)[-1]=len;
+  ((FXint*)ptr)[-2]=cap;
+  return true;
+  }
+
+
+// Make room for n bytes without changing the string
+FXbool FXString::reserve(FXint n){
+  FXint len,cap;
+  FXchar *p;
+  if(capacity()<n){
+    len=length();
+    cap=ROUNDUP(1+n)-1;
+    if(isShort()){
+      if(__unlikely((p=(FXchar*)::malloc(HEADER+cap+1))==nullptr)) return false;
+      p+=HEADER;
+      memcpy(p,buf,len+1);
+      ptr=p;
+      }
+    else{
+      if(__unlikely((p=(FXchar*)::realloc(ptr-HEADER,HEADER+cap+1))==nullptr)) return false;
+      ptr=p+HEADER;
+      }
+    ((FXint*)ptr)[-1]=len;
+    ((FXint*)ptr)[-2]=cap;
+    }
+  if(SHORTLEN<n){
+    buf[SHORTLEN+1]=RESERVED;
+    }
+  return true;
+  }
+
+
+// Release memory not needed by the string
+FXbool FXString::shrink(){
+  FXint len,cap;
+  FXchar *p;
+  if(!isShort()){
+    len=((FXint*)ptr)[-1];
+    if(len<=SHORTLEN){
+      p=ptr;
+      memcpy(buf,p,len);
+      ::free(p-HEADER);
+      buf[len]=0;
+      buf[SHORTLEN+1]=len;
+      return true;
       }
+    cap=ROUNDUP(1+len)-1;
+    if(cap<((FXint*)ptr)[-2]){
+      if(__unlikely((p=(FXchar*)::realloc(ptr-HEADER,HEADER+cap+1))==nullptr)) return false;
+      ptr=p+HEADER;
+      ((FXint*)ptr)[-2]=cap;
+      }
+    buf[SHORTLEN+1]=LONGMARK;
     }
   return true;
   }
 
 
 // Initialize to empty
-FXString::FXString():str(EMPTY){
+FXString::FXString(){
+  rep[0]=rep[1]=rep[2]=nullptr;
   }
 
 
 // Construct copy of another string
-FXString::FXString(const FXString& s):str(EMPTY){
+FXString::FXString(const FXString& s){
+  rep[0]=rep[1]=rep[2]=nullptr;
   if(__likely(length(s.length()))){
-    memcpy(str,s.text(),s.length());
+    memcpy(text(),s.text(),s.length());
     }
   }
 
 
+// Construct by taking over the contents of string s
+FXString::FXString(FXString&& s){
+  rep[0]=s.rep[0];
+  rep[1]=s.rep[1];
+  rep[2]=s.rep[2];
+  s.rep[0]=s.rep[1]=s.rep[2]=nullptr;
+  }
+
+
 // Construct and initialize with string s
-FXString::FXString(const FXchar* s):str(EMPTY){
+FXString::FXString(const FXchar* s){
   FXint n;
+  rep[0]=rep[1]=rep[2]=nullptr;
   if(__likely(s && s[0] && length((n=strlen(s))))){
-    memcpy(str,s,n);
+    memcpy(text(),s,n);
     }
   }
 
 
 // Construct and init from narrow character string
-FXString::FXString(const FXnchar* s):str(EMPTY){
-  FXint m;
-  if(__likely(s && s[0] && length((m=ncs2utf(s))))){
-    ncs2utf(str,s,m);
+FXString::FXString(const FXnchar* s){
+  FXint n,m;
+  rep[0]=rep[1]=rep[2]=nullptr;
+  if(__likely(s && 0<(n=strlen(s)) && length((m=ncs2utf(s,n))))){
+    ncs2utf(text(),s,m,n);
     }
   }
 
 
 // Construct and init from wide character string
-FXString::FXString(const FXwchar* s):str(EMPTY){
-  FXint m;
-  if(__likely(s && s[0] && length((m=wcs2utf(s))))){
-    wcs2utf(str,s,m);
+FXString::FXString(const FXwchar* s){
+  FXint n,m;
+  rep[0]=rep[1]=rep[2]=nullptr;
+  if(__likely(s && 0<(n=strlen(s)) && length((m=wcs2utf(s,n))))){
+    wcs2utf(text(),s,m,n);
     }
   }
 
 
 // Construct and init with substring
-FXString::FXString(const FXchar* s,FXint n):str(EMPTY){
+FXString::FXString(const FXchar* s,FXint n){
+  rep[0]=rep[1]=rep[2]=nullptr;
   if(__likely(s && 0<n && length(n))){
-    memcpy(str,s,n);
+    memcpy(text(),s,n);
     }
   }
 
 
 // Construct and init with narrow character substring
-FXString::FXString(const FXnchar* s,FXint n):str(EMPTY){
+FXString::FXString(const FXnchar* s,FXint n){
   FXint m;
+  rep[0]=rep[1]=rep[2]=nullptr;
   if(__likely(s && 0<n && length((m=ncs2utf(s,n))))){
-    ncs2utf(str,s,m,n);
+    ncs2utf(text(),s,m,n);
     }
   }
 
 
 // Construct and init with wide character substring
-FXString::FXString(const FXwchar* s,FXint n):str(EMPTY){
+FXString::FXString(const FXwchar* s,FXint n){
   FXint m;
+  rep[0]=rep[1]=rep[2]=nullptr;
   if(__likely(s && 0<n && length((m=wcs2utf(s,n))))){
-    wcs2utf(str,s,m,n);
+    wcs2utf(text(),s,m,n);
     }
   }
 
 
 // Construct and fill with constant
-FXString::FXString(FXchar c,FXint n):str(EMPTY){
+FXString::FXString(FXchar c,FXint n){
+  rep[0]=rep[1]=rep[2]=nullptr;
   if(__likely(0<n && length(n))){
-    memset(str,c,n);
+    memset(text(),c,n);
     }
   }
 
 
 // Destructor
 FXString::~FXString(){
-  if(str!=EMPTY){::free(str-sizeof(FXint));}
+  if(!isShort()){::free(ptr-HEADER);}
   }
 
 
 // Return wide character starting at p
 FXwchar FXString::wc(FXint p) const {
-  FXwchar w=(FXuchar)str[p];
-  if(0xC0<=w){ w = (w<<6) ^ (FXuchar)str[p+1] ^ 0x3080;
-  if(0x800<=w){ w = (w<<6) ^ (FXuchar)str[p+2] ^ 0x20080;
-  if(0x10000<=w){ w = (w<<6) ^ (FXuchar)str[p+3] ^ 0x400080; }}}
+  FXwchar w=(FXuchar)text()[p];
+  if(0xC0<=w){ w = (w<<6) ^ (FXuchar)text()[p+1] ^ 0x3080;
+  if(0x800<=w){ w = (w<<6) ^ (FXuchar)text()[p+2] ^ 0x20080;
+  if(0x10000<=w){ w = (w<<6) ^ (FXuchar)text()[p+3] ^ 0x400080; }}}
   return w;
   }
 
 
 //  Return wide character at p and advance to next
 FXwchar FXString::wcnxt(FXint& p) const {
-  FXwchar w=(FXuchar)str[p++];
-  if(0xC0<=w){ w=(w<<6) ^ (FXuchar)str[p++] ^ 0x3080;
-  if(0x800<=w){ w=(w<<6) ^ (FXuchar)str[p++] ^ 0x20080;
-  if(0x10000<=w){ w=(w<<6) ^ (FXuchar)str[p++] ^ 0x400080; }}}
+  FXwchar w=(FXuchar)text()[p++];
+  if(0xC0<=w){ w=(w<<6) ^ (FXuchar)text()[p++] ^ 0x3080;
+  if(0x800<=w){ w=(w<<6) ^ (FXuchar)text()[p++] ^ 0x20080;
+  if(0x10000<=w){ w=(w<<6) ^ (FXuchar)text()[p++] ^ 0x400080; }}}
   return w;
   }
 
 
 // Retreat to wide character previous to p and return it
 FXwchar FXString::wcprv(FXint& p) const {
-  FXwchar w=(FXuchar)str[--p];
-  if(0x80<=w){ w = ((FXuchar)str[--p]<<6) ^ w ^ 0x3080;
-  if(0x1000<=w){ w = ((FXuchar)str[--p]<<12) ^ w ^ 0xE1000;
-  if(0x20000<=w){ w = ((FXuchar)str[--p]<<18) ^ w ^ 0x3C60000; }}}
+  FXwchar w=(FXuchar)text()[--p];
+  if(0x80<=w){ w = ((FXuchar)text()[--p]<<6) ^ w ^ 0x3080;
+  if(0x1000<=w){ w = ((FXuchar)text()[--p]<<12) ^ w ^ 0xE1000;
+  if(0x20000<=w){ w = ((FXuchar)text()[--p]<<18) ^ w ^ 0x3C60000; }}}
   return w;
   }
 
 
 // Increment byte offset by one utf8 character
 FXint FXString::inc(FXint p) const {
-  return (++p>=length() || isUTF8(str[p]) || ++p>=length() || isUTF8(str[p]) || ++p>=length() || isUTF8(str[p]) || ++p), p;
+  return (++p>=length() || isUTF8(text()[p]) || ++p>=length() || isUTF8(text()[p]) || ++p>=length() || isUTF8(text()[p]) || ++p), p;
   }
 
 
 // Increment byte offset by n utf8 characters
 FXint FXString::inc(FXint p,FXint n) const {
-  while(p<length() && 0<n){ p=inc(p); --n; }
+  FXint len=length();
+  if(0<n && p<len){
+    p=leadskip(text(),p+1,len,n-1);
+    }
   return p;
   }
 
 
 // Decrement byte offset by one utf8 character
 FXint FXString::dec(FXint p) const {
-  return (--p<=0 || isUTF8(str[p]) || --p<=0 || isUTF8(str[p]) || --p<=0 || isUTF8(str[p]) || --p), p;
+  return (--p<=0 || isUTF8(text()[p]) || --p<=0 || isUTF8(text()[p]) || --p<=0 || isUTF8(text()[p]) || --p), p;
   }
 
 
 // Decrement byte offset by n utf8 characters
 FXint FXString::dec(FXint p,FXint n) const {
+#if defined(FOX_HAS_SSE2)
+  const FXchar* str=text();
+  FXuint mask;
+  FXint m;
+  while(16<p && 0<n){
+    mask=leadmask(str+p-16);
+    m=pop32(mask);
+    if(n<=m){
+      while(1<n){ mask&=~(0x80000000>>clz32(mask)); n--; }
+      return p-16+31-clz32(mask);
+      }
+    n-=m;
+    p-=16;
+    }
+#endif
   while(0<=p && 0<n){ p=dec(p); --n; }
   return p;
   }
@@ -307,57 +532,31 @@ FXint FXString::dec(FXint p,FXint n) const {
 
 // Count number of utf8 characters in subrange start...end
 FXint FXString::count(FXint start,FXint end) const {
-  FXint cnt=0;
-  while(start<end){
-    start+=lenUTF8(str[start]);
-    cnt++;
-    }
-  return cnt;
+  return leadcount(text(),start,end);
   }
 
 
 // Count number of utf8 characters
 FXint FXString::count() const {
-  FXint len=length();
-  FXint cnt=0;
-  FXint s=0;
-  while(s<len){
-    s+=lenUTF8(str[s]);
-    cnt++;
-    }
-  return cnt;
+  return leadcount(text(),0,length());
   }
 
 
 // Return byte offset of utf8 character at index
 FXint FXString::offset(FXint indx) const {
-  FXint len=length();
-  FXint i=0;
-  FXint p=0;
-  while(i<indx && p<len){
-    p+=lenUTF8(str[p]);
-    i++;
-    }
-  return p;
+  return (0<indx) ? leadskip(text(),0,length(),indx) : 0;
   }
 
 
 // Return index of utf8 character at byte offset
 FXint FXString::index(FXint offs) const {
-  FXint len=length();
-  FXint i=0;
-  FXint p=0;
-  while(p<offs && p<len){
-    p+=lenUTF8(str[p]);
-    i++;
-    }
-  return i;
+  return (0<offs) ? leadcount(text(),0,FXMIN(offs,length())) : 0;
   }
 
 
 // Return start of utf8 character containing position
 FXint FXString::validate(FXint p) const {
-  return (p<=0 || isUTF8(str[p]) || --p<=0 || isUTF8(str[p]) || --p<=0 || isUTF8(str[p]) || --p), p;
+  return (p<=0 || isUTF8(text()[p]) || --p<=0 || isUTF8(text()[p]) || --p<=0 || isUTF8(text()[p]) || --p), p;
   }
 
 
@@ -381,11 +580,17 @@ FXString& FXString::operator=(const FXwchar* s){
 
 // Assign another string to this string
 FXString& FXString::operator=(const FXString& s){
-  if(__likely(str!=s.str)){ assign(s.str,s.length()); }
+  if(__likely(this!=&s)){ assign(s.text(),s.length()); }
   return *this;
   }
 
 
+// Take over the contents of string s
+FXString& FXString::operator=(FXString&& s){
+  return adopt(s);
+  }
+
+
 // Append single character to this string
 FXString& FXString::operator+=(FXchar c){
   return append(c);
@@ -418,8 +623,8 @@ FXString& FXString::operator+=(const FXString& s){
 
 // Adopt string s, leaving s empty
 FXString& FXString::adopt(FXString& s){
-  if(__likely(str!=s.str)){
-    swap(str,s.str);
+  if(__likely(this!=&s)){
+    swap(*this,s);
     s.clear();
     }
   return *this;
@@ -429,7 +634,7 @@ FXString& FXString::adopt(FXString& s){
 // Assign input character to this string
 FXString& FXString::assign(FXchar c){
   if(__likely(length(1))){
-    str[0]=c;
+    text()[0]=c;
     }
   return *this;
   }
@@ -438,7 +643,7 @@ FXString& FXString::assign(FXchar c){
 // Assign input n characters c to this string
 FXString& FXString::assign(FXchar c,FXint n){
   if(__likely(length(n))){
-    memset(str,c,n);
+    memset(text(),c,n);
     }
   return *this;
   }
@@ -448,7 +653,7 @@ FXString& FXString::assign(FXchar c,FXint n){
 FXString& FXString::assign(const FXchar* s){
   FXint m;
   if(__likely(s && s[0] && length((m=strlen(s))))){
-    memmove(str,s,m);
+    memmove(text(),s,m);
     }
   else{
     length(0);
@@ -459,34 +664,20 @@ FXString& FXString::assign(const FXchar* s){
 
 // Assign narrow character string s to this string
 FXString& FXString::assign(const FXnchar* s){
-  FXint m;
-  if(__likely(s && s[0] && length((m=ncs2utf(s))))){
-    ncs2utf(str,s,m);
-    }
-  else{
-    length(0);
-    }
-  return *this;
+  return assign(s,s?strlen(s):0);
   }
 
 
 // Assign wide character string s to this string
 FXString& FXString::assign(const FXwchar* s){
-  FXint m;
-  if(__likely(s && s[0] && length((m=wcs2utf(s))))){
-    wcs2utf(str,s,m);
-    }
-  else{
-    length(0);
-    }
-  return *this;
+  return assign(s,s?strlen(s):0);
   }
 
 
 // Assign first n characters of input string to this string
 FXString& FXString::assign(const FXchar* s,FXint n){
   if(__likely(s && 0<n && length(n))){
-    memmove(str,s,n);
+    memmove(text(),s,n);
     }
   else{
     length(0);
@@ -499,7 +690,7 @@ FXString& FXString::assign(const FXchar* s,FXint n){
 FXString& FXString::assign(const FXnchar* s,FXint n){
   FXint m;
   if(__likely(s && 0<n && length((m=ncs2utf(s,n))))){
-    ncs2utf(str,s,m,n);
+    ncs2utf(text(),s,m,n);
     }
   else{
     length(0);
@@ -512,7 +703,7 @@ FXString& FXString::assign(const FXnchar* s,FXint n){
 FXString& FXString::assign(const FXwchar* s,FXint n){
   FXint m;
   if(__likely(s && 0<n && length((m=wcs2utf(s,n))))){
-    wcs2utf(str,s,m,n);
+    wcs2utf(text(),s,m,n);
     }
   else{
     length(0);
@@ -523,7 +714,7 @@ FXString& FXString::assign(const FXwchar* s,FXint n){
 
 // Assign input string to this string
 FXString& FXString::assign(const FXString& s){
-  if(__likely(str!=s.text())){ assign(s.text(),s.length()); }
+  if(__likely(this!=&s)){ assign(s.text(),s.length()); }
   return *this;
   }
 
@@ -533,15 +724,15 @@ FXString& FXString::insert(FXint pos,FXchar c){
   FXint len=length();
   if(__likely(length(len+1))){
     if(pos<=0){
-      memmove(str+1,str,len);
-      str[0]=c;
+      memmove(text()+1,text(),len);
+      text()[0]=c;
       }
     else if(pos>=len){
-      str[len]=c;
+      text()[len]=c;
       }
     else{
-      memmove(str+pos+1,str+pos,len-pos);
-      str[pos]=c;
+      memmove(text()+pos+1,text()+pos,len-pos);
+      text()[pos]=c;
       }
     }
   return *this;
@@ -553,15 +744,15 @@ FXString& FXString::insert(FXint pos,FXchar c,FXint n){
   FXint len=length();
   if(__likely(0<n && length(len+n))){
     if(pos<=0){
-      memmove(str+n,str,len);
-      memset(str,c,n);
+      memmove(text()+n,text(),len);
+      memset(text(),c,n);
       }
     else if(pos>=len){
-      memset(str+len,c,n);
+      memset(text()+len,c,n);
       }
     else{
-      memmove(str+pos+n,str+pos,len-pos);
-      memset(str+pos,c,n);
+      memmove(text()+pos+n,text()+pos,len-pos);
+      memset(text()+pos,c,n);
       }
     }
   return *this;
@@ -573,15 +764,15 @@ FXString& FXString::insert(FXint pos,const FXchar* s){
   FXint len=length(),m;
   if(__likely(s && s[0] && length(len+(m=strlen(s))))){
     if(pos<=0){
-      memmove(str+m,str,len);
-      memcpy(str,s,m);
+      memmove(text()+m,text(),len);
+      memcpy(text(),s,m);
       }
     else if(pos>=len){
-      memcpy(str+len,s,m);
+      memcpy(text()+len,s,m);
       }
     else{
-      memmove(str+pos+m,str+pos,len-pos);
-      memcpy(str+pos,s,m);
+      memmove(text()+pos+m,text()+pos,len-pos);
+      memcpy(text()+pos,s,m);
       }
     }
   return *this;
@@ -590,41 +781,13 @@ FXString& FXString::insert(FXint pos,const FXchar* s){
 
 // Insert narrow character string at position
 FXString& FXString::insert(FXint pos,const FXnchar* s){
-  FXint len=length(),m;
-  if(__likely(s && s[0] && length(len+(m=ncs2utf(s))))){
-    if(pos<=0){
-      memmove(str+m,str,len);
-      ncs2utf(str,s,m);
-      }
-    else if(pos>=len){
-      ncs2utf(str+len,s,m);
-      }
-    else{
-      memmove(str+pos+m,str+pos,len-pos);
-      ncs2utf(str+pos,s,m);
-      }
-    }
-  return *this;
+  return insert(pos,s,s?strlen(s):0);
   }
 
 
 // Insert wide character string at position
 FXString& FXString::insert(FXint pos,const FXwchar* s){
-  FXint len=length(),m;
-  if(__likely(s && s[0] && length(len+(m=wcs2utf(s))))){
-    if(pos<=0){
-      memmove(str+m,str,len);
-      wcs2utf(str,s,m);
-      }
-    else if(pos>=len){
-      wcs2utf(str+len,s,m);
-      }
-    else{
-      memmove(str+pos+m,str+pos,len-pos);
-      wcs2utf(str+pos,s,m);
-      }
-    }
-  return *this;
+  return insert(pos,s,s?strlen(s):0);
   }
 
 
@@ -634,15 +797,15 @@ FXString& FXString::insert(FXint pos,const FXchar* s,FXint n){
   FXint len=length();
   if(__likely(s && 0<n && length(len+n))){
     if(pos<=0){
-      memmove(str+n,str,len);
-      memcpy(str,s,n);
+      memmove(text()+n,text(),len);
+      memcpy(text(),s,n);
       }
     else if(pos>=len){
-      memcpy(str+len,s,n);
+      memcpy(text()+len,s,n);
       }
     else{
-      memmove(str+pos+n,str+pos,len-pos);
-      memcpy(str+pos,s,n);
+      memmove(text()+pos+n,text()+pos,len-pos);
+      memcpy(text()+pos,s,n);
       }
     }
   return *this;
@@ -654,15 +817,15 @@ FXString& FXString::insert(FXint pos,const FXnchar* s,FXint n){
   FXint len=length(),m;
   if(__likely(s && 0<n && length(len+(m=ncs2utf(s,n))))){
     if(pos<=0){
-      memmove(str+m,str,len);
-      ncs2utf(str,s,m,n);
+      memmove(text()+m,text(),len);
+      ncs2utf(text(),s,m,n);
       }
     else if(pos>=len){
-      ncs2utf(str+len,s,m,n);
+      ncs2utf(text()+len,s,m,n);
       }
     else{
-      memmove(str+pos+m,str+pos,len-pos);
-      ncs2utf(str+pos,s,m,n);
+      memmove(text()+pos+m,text()+pos,len-pos);
+      ncs2utf(text()+pos,s,m,n);
       }
     }
   return *this;
@@ -674,15 +837,15 @@ FXString& FXString::insert(FXint pos,const FXwchar* s,FXint n){
   FXint len=length(),m;
   if(__likely(s && 0<n && length(len+(m=wcs2utf(s,n))))){
     if(pos<=0){
-      memmove(str+m,str,len);
-      wcs2utf(str,s,m,n);
+      memmove(text()+m,text(),len);
+      wcs2utf(text(),s,m,n);
       }
     else if(pos>=len){
-      wcs2utf(str+len,s,m,n);
+      wcs2utf(text()+len,s,m,n);
       }
     else{
-      memmove(str+pos+m,str+pos,len-pos);
-      wcs2utf(str+pos,s,m,n);
+      memmove(text()+pos+m,text()+pos,len-pos);
+      wcs2utf(text()+pos,s,m,n);
       }
     }
   return *this;
@@ -699,8 +862,8 @@ FXString& FXString::insert(FXint pos,const FXString& s){
 FXString& FXString::prepend(FXchar c){
   FXint len=length();
   if(__likely(length(len+1))){
-    memmove(str+1,str,len);
-    str[0]=c;
+    memmove(text()+1,text(),len);
+    text()[0]=c;
     }
   return *this;
   }
@@ -710,8 +873,8 @@ FXString& FXString::prepend(FXchar c){
 FXString& FXString::prepend(FXchar c,FXint n){
   FXint len=length();
   if(__likely(0<n && length(len+n))){
-    memmove(str+n,str,len);
-    memset(str,c,n);
+    memmove(text()+n,text(),len);
+    memset(text(),c,n);
     }
   return *this;
   }
@@ -721,8 +884,8 @@ FXString& FXString::prepend(FXchar c,FXint n){
 FXString& FXString::prepend(const FXchar* s){
   FXint len=length(),m;
   if(__likely(s && s[0] && length(len+(m=strlen(s))))){
-    memmove(str+m,str,len);
-    memmove(str,s,m);
+    memmove(text()+m,text(),len);
+    memmove(text(),s,m);
     }
   return *this;
   }
@@ -730,23 +893,13 @@ FXString& FXString::prepend(const FXchar* s){
 
 // Prepend narrow character string
 FXString& FXString::prepend(const FXnchar* s){
-  FXint len=length(),m;
-  if(__likely(s && s[0] && length(len+(m=ncs2utf(s))))){
-    memmove(str+m,str,len);
-    ncs2utf(str,s,m);
-    }
-  return *this;
+  return prepend(s,s?strlen(s):0);
   }
 
 
 // Prepend wide character string
 FXString& FXString::prepend(const FXwchar* s){
-  FXint len=length(),m;
-  if(__likely(s && s[0] && length(len+(m=wcs2utf(s))))){
-    memmove(str+m,str,len);
-    wcs2utf(str,s,m);
-    }
-  return *this;
+  return prepend(s,s?strlen(s):0);
   }
 
 
@@ -754,8 +907,8 @@ FXString& FXString::prepend(const FXwchar* s){
 FXString& FXString::prepend(const FXchar* s,FXint n){
   FXint len=length();
   if(__likely(s && 0<n && length(len+n))){
-    memmove(str+n,str,len);
-    memmove(str,s,n);
+    memmove(text()+n,text(),len);
+    memmove(text(),s,n);
     }
   return *this;
   }
@@ -765,8 +918,8 @@ FXString& FXString::prepend(const FXchar* s,FXint n){
 FXString& FXString::prepend(const FXnchar* s,FXint n){
   FXint len=length(),m;
   if(__likely(s && 0<n && length(len+(m=ncs2utf(s,n))))){
-    memmove(str+m,str,len);
-    ncs2utf(str,s,m,n);
+    memmove(text()+m,text(),len);
+    ncs2utf(text(),s,m,n);
     }
   return *this;
   }
@@ -776,8 +929,8 @@ FXString& FXString::prepend(const FXnchar* s,FXint n){
 FXString& FXString::prepend(const FXwchar* s,FXint n){
   FXint len=length(),m;
   if(__likely(s && 0<n && length(len+(m=wcs2utf(s,n))))){
-    memmove(str+m,str,len);
-    wcs2utf(str,s,m,n);
+    memmove(text()+m,text(),len);
+    wcs2utf(text(),s,m,n);
     }
   return *this;
   }
@@ -793,7 +946,7 @@ FXString& FXString::prepend(const FXString& s){
 FXString& FXString::append(FXchar c){
   FXint len=length();
   if(__likely(length(len+1))){
-    str[len]=c;
+    text()[len]=c;
     }
   return *this;
   }
@@ -803,7 +956,7 @@ FXString& FXString::append(FXchar c){
 FXString& FXString::append(FXchar c,FXint n){
   FXint len=length();
   if(__likely(0<n && length(len+n))){
-    memset(str+len,c,n);
+    memset(text()+len,c,n);
     }
   return *this;
   }
@@ -813,7 +966,7 @@ FXString& FXString::append(FXchar c,FXint n){
 FXString& FXString::append(const FXchar* s){
   FXint len=length(),m;
   if(__likely(s && s[0] && length(len+(m=strlen(s))))){
-    memmove(str+len,s,m);
+    memmove(text()+len,s,m);
     }
   return *this;
   }
@@ -821,21 +974,13 @@ FXString& FXString::append(const FXchar* s){
 
 // Append string to this string
 FXString& FXString::append(const FXnchar* s){
-  FXint len=length(),m;
-  if(__likely(s && s[0] && length(len+(m=ncs2utf(s))))){
-    ncs2utf(str+len,s,m);
-    }
-  return *this;
+  return append(s,s?strlen(s):0);
   }
 
 
 // Append string to this string
 FXString& FXString::append(const FXwchar* s){
-  FXint len=length(),m;
-  if(__likely(s && s[0] && length(len+(m=wcs2utf(s))))){
-    wcs2utf(str+len,s,m);
-    }
-  return *this;
+  return append(s,s?strlen(s):0);
   }
 
 
@@ -843,7 +988,7 @@ FXString& FXString::append(const FXwchar* s){
 FXString& FXString::append(const FXchar* s,FXint n){
   FXint len=length();
   if(__likely(s && 0<n && length(len+n))){
-    memmove(str+len,s,n);
+    memmove(text()+len,s,n);
     }
   return *this;
   }
@@ -853,7 +998,7 @@ FXString& FXString::append(const FXchar* s,FXint n){
 FXString& FXString::append(const FXnchar* s,FXint n){
   FXint len=length(),m;
   if(__likely(s && 0<n && length(len+(m=ncs2utf(s,n))))){
-    ncs2utf(str+len,s,m,n);
+    ncs2utf(text()+len,s,m,n);
     }
   return *this;
   }
@@ -863,7 +1008,7 @@ FXString& FXString::append(const FXnchar* s,FXint n){
 FXString& FXString::append(const FXwchar* s,FXint n){
   FXint len=length(),m;
   if(__likely(s && 0<n && length(len+(m=wcs2utf(s,n))))){
-    wcs2utf(str+len,s,m,n);
+    wcs2utf(text()+len,s,m,n);
     }
   return *this;
   }
@@ -877,7 +1022,7 @@ FXString& FXString::append(const FXString& s){
 
 // Replace character in string
 FXString& FXString::replace(FXint pos,FXchar c){
-  str[pos]=c;
+  text()[pos]=c;
   return *this;
   }
 
@@ -888,13 +1033,13 @@ FXString& FXString::replace(FXint pos,FXint r,FXchar c,FXint n){
   if(__likely(0<=pos && 0<=r && pos+r<=len)){
     if(r<n){
       if(!length(len+n-r)) return *this;
-      memmove(str+pos+n,str+pos+r,len-pos-r);
+      memmove(text()+pos+n,text()+pos+r,len-pos-r);
       }
     else if(r>n){
-      memmove(str+pos+n,str+pos+r,len-pos-r);
+      memmove(text()+pos+n,text()+pos+r,len-pos-r);
       if(!length(len+n-r)) return *this;
       }
-    memset(str+pos,c,n);
+    memset(text()+pos,c,n);
     }
   return *this;
   }
@@ -924,13 +1069,13 @@ FXString& FXString::replace(FXint pos,FXint r,const FXchar* s,FXint n){
   if(__likely(0<=pos && 0<=r && pos+r<=len)){
     if(r<n){
       if(!length(len+n-r)) return *this;
-      memmove(str+pos+n,str+pos+r,len-pos-r);
+      memmove(text()+pos+n,text()+pos+r,len-pos-r);
       }
     else if(r>n){
-      memmove(str+pos+n,str+pos+r,len-pos-r);
+      memmove(text()+pos+n,text()+pos+r,len-pos-r);
       if(!length(len+n-r)) return *this;
       }
-    memcpy(str+pos,s,n);
+    memcpy(text()+pos,s,n);
     }
   return *this;
   }
@@ -942,13 +1087,13 @@ FXString& FXString::replace(FXint pos,FXint r,const FXnchar* s,FXint n){
   if(__likely(0<=pos && 0<=r && pos+r<=len)){
     if(r<m){
       if(!length(len+m-r)) return *this;
-      memmove(str+pos+m,str+pos+r,len-pos-r);
+      memmove(text()+pos+m,text()+pos+r,len-pos-r);
       }
     else if(r>m){
-      memmove(str+pos+m,str+pos+r,len-pos-r);
+      memmove(text()+pos+m,text()+pos+r,len-pos-r);
       if(!length(len+m-r)) return *this;
       }
-    ncs2utf(str+pos,s,m,n);
+    ncs2utf(text()+pos,s,m,n);
     }
   return *this;
   }
@@ -960,13 +1105,13 @@ FXString& FXString::replace(FXint pos,FXint r,const FXwchar* s,FXint n){
   if(__likely(0<=pos && 0<=r && pos+r<=len)){
     if(r<m){
       if(!length(len+m-r)) return *this;
-      memmove(str+pos+m,str+pos+r,len-pos-r);
+      memmove(text()+pos+m,text()+pos+r,len-pos-r);
       }
     else if(r>m){
-      memmove(str+pos+m,str+pos+r,len-pos-r);
+      memmove(text()+pos+m,text()+pos+r,len-pos-r);
       if(!length(len+m-r)) return *this;
       }
-    wcs2utf(str+pos,s,m,n);
+    wcs2utf(text()+pos,s,m,n);
     }
   return *this;
   }
@@ -974,7 +1119,7 @@ FXString& FXString::replace(FXint pos,FXint r,const FXwchar* s,FXint n){
 
 // Replace part of string
 FXString& FXString::replace(FXint pos,FXint r,const FXString& s){
-  return replace(pos,r,s.str,s.length());
+  return replace(pos,r,s.text(),s.length());
   }
 
 
@@ -985,16 +1130,16 @@ FXString& FXString::move(FXint dst,FXint src,FXint n){
     if(dst<0){                                  // Move below begin
       if(dst<-n) dst=-n;
       length(len-dst);
-      memmove(str-dst,str,len);
-      memmove(str,str-dst+src,n);
+      memmove(text()-dst,text(),len);
+      memmove(text(),text()-dst+src,n);
       }
     else if(dst+n>len){                         // Move beyond end
       if(dst>len) dst=len;
       length(dst+n);
-      memmove(str+dst,str+src,n);
+      memmove(text()+dst,text()+src,n);
       }
     else{
-      memmove(str+dst,str+src,n);               // Move inside
+      memmove(text()+dst,text()+src,n);               // Move inside
       }
     }
   return *this;
@@ -1005,7 +1150,7 @@ FXString& FXString::move(FXint dst,FXint src,FXint n){
 FXString& FXString::erase(FXint pos){
   FXint len=length();
   if(__likely(0<=pos && pos<len)){
-    memmove(str+pos,str+pos+1,len-pos-1);
+    memmove(text()+pos,text()+pos+1,len-pos-1);
     length(len-1);
     }
   return *this;
@@ -1018,7 +1163,7 @@ FXString& FXString::erase(FXint pos,FXint n){
   if(__likely(0<n && 0<pos+n && pos<len)){
     if(pos<0){n+=pos;pos=0;}
     if(len<pos+n){n=len-pos;}
-    memmove(str+pos,str+pos+n,len-pos-n);
+    memmove(text()+pos,text()+pos+n,len-pos-n);
     length(len-n);
     }
   return *this;
@@ -1045,7 +1190,7 @@ FXint FXString::contains(FXchar ch) const {
   FXint m=0;
   FXint i=0;
   while(i<len){
-    m+=(str[i++]==ch);
+    m+=(text()[i++]==ch);
     }
   return m;
   }
@@ -1057,7 +1202,7 @@ FXint FXString::contains(const FXchar* sub,FXint n) const {
   FXint m=0;
   FXint i=0;
   while(i<=len){
-    if(FXString::compare(str+i,sub,n)==0){
+    if(FXString::compare(text()+i,sub,n)==0){
       m++;
       }
     i++;
@@ -1080,6 +1225,7 @@ FXint FXString::contains(const FXString& sub) const {
 
 // Substitute one character by another
 FXString& FXString::substitute(FXchar org,FXchar sub,FXbool all){
+  FXchar* str=text();
   FXint len=length();
   FXint c=org;
   FXint s=sub;
@@ -1101,7 +1247,7 @@ FXString& FXString::substitute(const FXchar* org,FXint olen,const FXchar* rep,FX
     FXint len=length();
     FXint pos=0;
     while(pos<=len-olen){
-      if(FXString::compare(str+pos,org,olen)==0){
+      if(FXString::compare(text()+pos,org,olen)==0){
         replace(pos,olen,rep,rlen);
         if(!all) break;
         len+=rlen-olen;
@@ -1159,7 +1305,8 @@ FXString& FXString::upper(){
 
 // Simplify whitespace in string
 FXString& FXString::simplify(){
-  if(str!=EMPTY){
+  if(!empty()){
+    FXchar* str=text();
     FXint e=length(),s=0,d=0;
     while(s<e && Ascii::isSpace(str[s])) s++;
     while(1){
@@ -1176,7 +1323,8 @@ FXString& FXString::simplify(){
 
 // Remove leading and trailing whitespace
 FXString& FXString::trim(){
-  if(str!=EMPTY){
+  if(!empty()){
+    FXchar* str=text();
     FXint e=length(),s=0,d=0;
     while(s<e && Ascii::isSpace(str[s])) s++;
     while(s<e && Ascii::isSpace(str[e-1])) e--;
@@ -1189,7 +1337,8 @@ FXString& FXString::trim(){
 
 // Remove leading whitespace
 FXString& FXString::trimBegin(){
-  if(str!=EMPTY){
+  if(!empty()){
+    FXchar* str=text();
     FXint e=length(),s=0,d=0;
     while(s<e && Ascii::isSpace(str[s])) s++;
     while(s<e) str[d++]=str[s++];
@@ -1201,9 +1350,9 @@ FXString& FXString::trimBegin(){
 
 // Remove trailing whitespace
 FXString& FXString::trimEnd(){
-  if(str!=EMPTY){
+  if(!empty()){
     FXint e=length();
-    while(0<e && Ascii::isSpace(str[e-1])) e--;
+    while(0<e && Ascii::isSpace(text()[e-1])) e--;
     length(e);
     }
   return *this;
@@ -1215,7 +1364,7 @@ FXString FXString::left(FXint n) const {
   FXint len=length();
   if(0<n){
     if(n>len) n=len;
-    return FXString(str,n);
+    return FXString(text(),n);
     }
   return FXString::null;
   }
@@ -1226,7 +1375,7 @@ FXString FXString::right(FXint n) const {
   FXint len=length();
   if(0<n){
     if(n>len) n=len;
-    return FXString(str+len-n,n);
+    return FXString(text()+len-n,n);
     }
   return FXString::null;
   }
@@ -1238,7 +1387,7 @@ FXString FXString::mid(FXint pos,FXint n) const {
   if(__likely(0<n && 0<pos+n && pos<len)){
     if(pos<0){n+=pos;pos=0;}
     if(len-pos<n){n=len-pos;}
-    return FXString(str+pos,n);
+    return FXString(text()+pos,n);
     }
   return FXString::null;
   }
@@ -1251,17 +1400,17 @@ FXString FXString::section(FXchar delim,FXint start,FXint num) const {
   if(0<start){
     while(s<len){
       ++s;
-      if(str[s-1]==delim && --start==0) break;
+      if(text()[s-1]==delim && --start==0) break;
       }
     }
   e=s;
   if(0<num){
     while(e<len){
-      if(str[e]==delim && --num==0) break;
+      if(text()[e]==delim && --num==0) break;
       ++e;
       }
     }
-  return FXString(str+s,e-s);
+  return FXString(text()+s,e-s);
   }
 
 
@@ -1272,7 +1421,7 @@ FXString FXString::section(const FXchar* delim,FXint n,FXint start,FXint num) co
   s=0;
   if(0<start){
     while(s<len){
-      c=str[s++];
+      c=text()[s++];
       i=n;
       while(--i>=0){
         if(delim[i]==c){
@@ -1285,7 +1434,7 @@ FXString FXString::section(const FXchar* delim,FXint n,FXint start,FXint num) co
 a:e=s;
   if(0<num){
     while(e<len){
-      c=str[e];
+      c=text()[e];
       i=n;
       while(--i>=0){
         if(delim[i]==c){
@@ -1296,7 +1445,7 @@ a:e=s;
       ++e;
       }
     }
-b:return FXString(str+s,e-s);
+b:return FXString(text()+s,e-s);
   }
 
 
@@ -1318,11 +1467,11 @@ FXString FXString::before(FXchar c,FXint n) const {
   FXint p=0;
   if(0<n){
     while(p<len){
-      if(str[p]==c && --n==0) break;
+      if(text()[p]==c && --n==0) break;
       p++;
       }
     }
-  return FXString(str,p);
+  return FXString(text(),p);
   }
 
 
@@ -1332,10 +1481,10 @@ FXString FXString::rbefore(FXchar c,FXint n) const {
   if(0<n){
     while(0<p){
       p--;
-      if(str[p]==c && --n==0) break;
+      if(text()[p]==c && --n==0) break;
       }
     }
-  return FXString(str,p);
+  return FXString(text(),p);
   }
 
 
@@ -1346,10 +1495,10 @@ FXString FXString::after(FXchar c,FXint n) const {
   if(0<n){
     while(p<len){
       p++;
-      if(str[p-1]==c && --n==0) break;
+      if(text()[p-1]==c && --n==0) break;
       }
     }
-  return FXString(str+p,len-p);
+  return FXString(text()+p,len-p);
   }
 
 
@@ -1359,11 +1508,11 @@ FXString FXString::rafter(FXchar c,FXint n) const {
   FXint p=len;
   if(0<n){
     while(0<p){
-      if(str[p-1]==c && --n==0) break;
+      if(text()[p-1]==c && --n==0) break;
       p--;
       }
     }
-  return FXString(str+p,len-p);
+  return FXString(text()+p,len-p);
   }
 
 
@@ -1375,7 +1524,7 @@ FXint FXString::find(FXchar c,FXint pos,FXint n) const {
   if(p<0) p=0;
   if(n<=0) return p;
   while(p<len){
-    if(str[p]==cc){ if(--n==0) return p; }
+    if(text()[p]==cc){ if(--n==0) return p; }
     ++p;
     }
   return -1;
@@ -1390,7 +1539,7 @@ FXint FXString::rfind(FXchar c,FXint pos,FXint n) const {
   if(p>=len) p=len-1;
   if(n<=0) return p;
   while(0<=p){
-    if(str[p]==cc){ if(--n==0) return p; }
+    if(text()[p]==cc){ if(--n==0) return p; }
     --p;
     }
   return -1;
@@ -1403,7 +1552,7 @@ FXint FXString::find(FXchar c,FXint pos) const {
   FXint p=pos;
   FXint cc=c;
   if(p<0) p=0;
-  while(p<len){ if(str[p]==cc){ return p; } ++p; }
+  while(p<len){ if(text()[p]==cc){ return p; } ++p; }
   return -1;
   }
 
@@ -1414,7 +1563,7 @@ FXint FXString::rfind(FXchar c,FXint pos) const {
   FXint p=pos;
   FXint cc=c;
   if(p>=len) p=len-1;
-  while(0<=p){ if(str[p]==cc){ return p; } --p; }
+  while(0<=p){ if(text()[p]==cc){ return p; } --p; }
   return -1;
   }
 
@@ -1426,8 +1575,8 @@ FXint FXString::find(const FXchar* substr,FXint n,FXint pos) const {
     FXint c=substr[0];
     len=len-n+1;
     while(pos<len){
-      if(str[pos]==c){
-        if(!FXString::compare(str+pos,substr,n)){
+      if(text()[pos]==c){
+        if(!FXString::compare(text()+pos,substr,n)){
           return pos;
           }
         }
@@ -1458,8 +1607,8 @@ FXint FXString::rfind(const FXchar* substr,FXint n,FXint pos) const {
     len-=n;
     if(pos>len) pos=len;
     while(0<=pos){
-      if(str[pos]==c){
-        if(!FXString::compare(str+pos,substr,n)){
+      if(text()[pos]==c){
+        if(!FXString::compare(text()+pos,substr,n)){
           return pos;
           }
         }
@@ -1488,7 +1637,7 @@ FXint FXString::find_first_of(const FXchar* set,FXint n,FXint pos) const {
   FXint p=pos;
   if(p<0) p=0;
   while(p<len){
-    FXint c=str[p];
+    FXint c=text()[p];
     FXint i=n;
     while(--i>=0){ if(set[i]==c) return p; }
     p++;
@@ -1515,7 +1664,7 @@ FXint FXString::find_first_of(FXchar c,FXint pos) const {
   FXint p=pos;
   FXint cc=c;
   if(p<0) p=0;
-  while(p<len){ if(str[p]==cc){ return p; } p++; }
+  while(p<len){ if(text()[p]==cc){ return p; } p++; }
   return -1;
   }
 
@@ -1526,7 +1675,7 @@ FXint FXString::find_last_of(const FXchar* set,FXint n,FXint pos) const {
   FXint p=pos;
   if(p>=len) p=len-1;
   while(0<=p){
-    FXint c=str[p];
+    FXint c=text()[p];
     FXint i=n;
     while(--i>=0){ if(set[i]==c) return p; }
     p--;
@@ -1553,7 +1702,7 @@ FXint FXString::find_last_of(FXchar c,FXint pos) const {
   FXint p=pos;
   FXint cc=c;
   if(p>=len) p=len-1;
-  while(0<=p){ if(str[p]==cc){ return p; } p--; }
+  while(0<=p){ if(text()[p]==cc){ return p; } p--; }
   return -1;
   }
 
@@ -1564,7 +1713,7 @@ FXint FXString::find_first_not_of(const FXchar* set,FXint n,FXint pos) const {
   FXint p=pos;
   if(p<0) p=0;
   while(p<len){
-    FXint c=str[p];
+    FXint c=text()[p];
     FXint i=n;
     while(--i>=0){ if(set[i]==c) goto x; }
     return p;
@@ -1592,7 +1741,7 @@ FXint FXString::find_first_not_of(FXchar c,FXint pos) const {
   FXint p=pos;
   FXint cc=c;
   if(p<0) p=0;
-  while(p<len){ if(str[p]!=cc){ return p; } p++; }
+  while(p<len){ if(text()[p]!=cc){ return p; } p++; }
   return -1;
   }
 
@@ -1603,7 +1752,7 @@ FXint FXString::find_last_not_of(const FXchar* set,FXint n,FXint pos) const {
   FXint p=pos;
   if(p>=len) p=len-1;
   while(0<=p){
-    FXint c=str[p];
+    FXint c=text()[p];
     FXint i=n;
     while(--i>=0){ if(set[i]==c) goto x; }
     return p;
@@ -1631,7 +1780,7 @@ FXint FXString::find_last_not_of(FXchar c,FXint pos) const {
   FXint p=pos;
   FXint cc=c;
   if(p>=len) p=len-1;
-  while(0<=p){ if(str[p]!=cc){ return p; } p--; }
+  while(0<=p){ if(text()[p]!=cc){ return p; } p--; }
   return -1;
   }
 
@@ -1646,7 +1795,7 @@ FXint FXString::find_last_not_of(FXchar c,FXint pos) const {
 
 // Scan
 FXint FXString::vscan(const FXchar* fmt,va_list args) const {
-  return __vsscanf(str,fmt,args);
+  return __vsscanf(text(),fmt,args);
   }
 
 
@@ -1666,11 +1815,11 @@ FXint FXString::vformat(const FXchar* fmt,va_list args){
   if(fmt && *fmt){
     va_list ag;
     va_copy(ag,args);
-    result=__vsnprintf(str,length(),fmt,ag);       // Try to see if existing buffer fits
+    result=__vsnprintf(text(),capacity(),fmt,ag);     // Try to see if existing buffer fits
     va_end(ag);
-    if(length()<result){                           // FOX's own __vsnprintf() truncates at buffer size
+    if(capacity()<result){                         // FOX's own __vsnprintf() truncates at buffer size
       length(result);
-      result=__vsnprintf(str,length(),fmt,args);   // Now try again with exactly the right size
+      result=__vsnprintf(text(),length(),fmt,args);   // Now try again with exactly the right size
       return result;
       }
     }
@@ -1692,37 +1841,37 @@ FXint FXString::format(const FXchar* fmt,...){
 
 // Convert to integer
 FXint FXString::toInt(FXint base,FXbool* ok) const {
-  return __strtol(str,nullptr,base,ok);
+  return __strtol(text(),nullptr,base,ok);
   }
 
 
 // Convert to unsigned integer
 FXuint FXString::toUInt(FXint base,FXbool* ok) const {
-  return __strtoul(str,nullptr,base,ok);
+  return __strtoul(text(),nullptr,base,ok);
   }
 
 
 // Convert to long integer
 FXlong FXString::toLong(FXint base,FXbool* ok) const {
-  return __strtoll(str,nullptr,base,ok);
+  return __strtoll(text(),nullptr,base,ok);
   }
 
 
 // Convert to unsigned long integer
 FXulong FXString::toULong(FXint base,FXbool* ok) const {
-  return __strtoull(str,nullptr,base,ok);
+  return __strtoull(text(),nullptr,base,ok);
   }
 
 
 // Convert to float
 FXfloat FXString::toFloat(FXbool* ok) const {
-  return __strtof(str,nullptr,ok);
+  return __strtof(text(),nullptr,ok);
   }
 
 
 // Convert to double number
 FXdouble FXString::toDouble(FXbool* ok) const {
-  return __strtod(str,nullptr,ok);
+  return __strtod(text(),nullptr,ok);
   }
 
 
@@ -1793,9 +1942,18 @@ static const char conversionformat[16][8]={
   };
 
 
+// Formatting for floats; fewest digits are those of the float
+static const char floatconversionformat[16][8]={
+    "%.*hF",  "%.*hE",  "%.*hG", "%.*hA",
+   "%'.*hF", "%'.*hE", "%'.*hG", "%.*hA",
+   "%#.*hF", "%#.*hE", "%#.*hG","%#.*hA",
+  "%#'.*hF","%#'.*hE","%#'.*hG","%#.*hA"
+  };
+
+
 // Convert from float
 FXString& FXString::fromFloat(FXfloat number,FXint prec,FXint fmt){
-  format(conversionformat[fmt&15],prec,(FXdouble)number);
+  format(floatconversionformat[fmt&15],prec,(FXdouble)number);
   return *this;
   }
 
@@ -1869,35 +2027,81 @@ FXString FXString::vvalue(const FXchar* fmt,va_list args){
 
 /*******************************************************************************/
 
-// Compute FNV1a hash value of string
+// Hash multipliers
+static const FXulong PRIME1=FXULONG(0x9E3779B185EBCA87);
+static const FXulong PRIME2=FXULONG(0xC2B2AE3D27D4EB4F);
+static const FXulong PRIME3=FXULONG(0x165667B19E3779F9);
+
+
+// Rotate left
+static inline FXulong rotl64(FXulong x,FXuint r){
+  return (x<<r)|(x>>(64-r));
+  }
+
+
+// Load 8 bytes
+static inline FXulong load64(const FXchar* s){
+  FXulong w; memcpy(&w,s,sizeof(w)); return w;
+  }
+
+
+// Load 4 bytes
+static inline FXulong load32(const FXchar* s){
+  FXuint w; memcpy(&w,s,sizeof(w)); return w;
+  }
+
+
+// Mix word into hash lane
+static inline FXulong hashround(FXulong h,FXulong w){
+  return rotl64(h+w*PRIME2,31)*PRIME1;
+  }
+
+
+// Compute hash value of string, a word at a time
 FXuint FXString::hash(const FXchar* s,FXint n){
-  FXuint result=0x811C9DC5;
-  FXuchar c;
-  if(0<n){
-    do{
-      c=*s++;
-      result=(result^c)*0x01000193;
+  FXulong h=PRIME3^(FXulong)n;
+  if(__likely(0<n)){
+    const FXchar* e=s+n;
+    if(16<n){
+      FXulong a=h,b=~h;
+      do{
+        a=hashround(a,load64(s));
+        b=hashround(b,load64(s+8));
+        s+=16;
+        }
+      while(16<e-s);
+      h=rotl64(a,7)+rotl64(b,19);
+      n=(FXint)(e-s);
+      }
+    if(8<=n){
+      h=hashround(h,load64(s));
+      h=hashround(h,load64(e-8));
+      }
+    else if(4<=n){
+      h=hashround(h,(load32(s)<<32)|load32(e-4));
+      }
+    else{
+      h=hashround(h,((FXulong)(FXuchar)s[0]<<16)|((FXulong)(FXuchar)s[n>>1]<<8)|(FXuchar)e[-1]);
       }
-    while(--n);
     }
-  return result;
+  h^=h>>33;
+  h*=PRIME2;
+  h^=h>>29;
+  h*=PRIME3;
+  h^=h>>32;
+  return (FXuint)h;
   }
 
 
-// Compute FNV1a hash value of string
+// Compute hash value of string
 FXuint FXString::hash(const FXchar* s){
-  FXuint result=0x811C9DC5;
-  FXuchar c;
-  while((c=*s++)!='\0'){
-    result=(result^c)*0x01000193;
-    }
-  return result;
+  return FXString::hash(s,strlen(s));
   }
 
 
 // Compute hash value of string
 FXuint FXString::hash() const {
-  return FXString::hash(str);
+  return FXString::hash(text());
   }
 
 /*******************************************************************************/
@@ -2906,7 +3110,7 @@ FXString FXString::unescape(const FXString& str,FXchar lquote,FXchar rquote){
 FXStream& operator<<(FXStream& store,const FXString& s){
   FXint len=s.length();
   store << len;
-  store.save(s.str,len);
+  store.save(s.text(),len);
   return store;
   }
 
@@ -2916,7 +3120,7 @@ FXStream& operator>>(FXStream& store,FXString& s){
   FXint len;
   store >> len;
   s.length(len);
-  store.load(s.str,len);
+  store.load(s.text(),len);
   return store;
   }
 
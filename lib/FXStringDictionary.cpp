@@ -22,6 +22,7 @@
 #include "fxver.h"
 #include "fxdefs.h"
 #include "fxmath.h"
+#include "fxendian.h"
 #include "FXElement.h"
 #include "FXException.h"
 #include "FXHash.h"
@@ -38,10 +39,18 @@
     as well!).
   - While we may be able to make it kind of work this way is better and at any rate,
     its not a very large class, but one which has high use.
+  - Slots are probed in groups, using an array of control bytes following the table
+    of entries, in the same way as FXDictionary; see FXHash for details.
 */
 
-#define EMPTY     (const_cast<Entry*>((const Entry*)(__stringdictionary__empty__+3)))
-#define BSHIFT    5
+#define EMPTY       (const_cast<Entry*>((const Entry*)(__stringdictionary__empty__+3)))
+#define GROUP       16
+#define FREE        0
+#define VOIDED      1
+#define TAG(h)      ((FXuchar)(0x80|((h)>>25)))
+#define CONTROL(t,n) ((FXuchar*)((t)+(n)))
+#define CTLSIZE(n)  FXMAX(n,GROUP)
+#define VALID(n)    ((n)<GROUP?(1u<<(n))-1:0xFFFFu)
 
 using namespace FX;
 
@@ -50,10 +59,33 @@ using namespace FX;
 namespace FX {
 
 
-// Empty string dictionary table value
-extern const FXint __string__empty__[];
+// Empty string dictionary table value; its control bytes span a whole group
 extern const FXival __stringdictionary__empty__[];
-const FXival __stringdictionary__empty__[7]={1,0,1,(FXival)(__string__empty__+1),(FXival)(__string__empty__+1),0,0};
+const FXival __stringdictionary__empty__[3+8+GROUP/sizeof(FXival)]={1,0,1,0,0,0,0,0,0,0,0};
+
+
+// Return mask of slots in group whose control byte is c
+static inline FXuint matchgroup(const FXuchar* ctl,FXuchar c){
+#if defined(FOX_HAS_SSE2)
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)ctl),_mm_set1_epi8((FXchar)c)));
+#else
+  FXuint m=0;
+  for(FXuint i=0; i<GROUP; ++i){ m|=(FXuint)(ctl[i]==c)<<i; }
+  return m;
+#endif
+  }
+
+
+// Return mask of slots in group which are free or voided
+static inline FXuint opengroup(const FXuchar* ctl){
+#if defined(FOX_HAS_SSE2)
+  return ~_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ctl))&0xFFFF;
+#else
+  FXuint m=0;
+  for(FXuint i=0; i<GROUP; ++i){ m|=(FXuint)(ctl[i]<0x80)<<i; }
+  return m;
+#endif
+  }
 
 
 // Adjust the size of the table
@@ -72,7 +104,7 @@ FXbool FXStringDictionary::no(FXival n){
 
     // Allocate new table
     if(1<n){
-      if(__unlikely((p=::calloc(sizeof(FXival)*3+sizeof(Entry)*n,1))==nullptr)) return false;
+      if(__unlikely((p=::calloc(sizeof(FXival)*3+sizeof(Entry)*n+CTLSIZE(n),1))==nullptr)) return false;
       elbat=(Entry*)(((FXival*)p)+3);
       ((FXival*)elbat)[-3]=n;
       ((FXival*)elbat)[-2]=0;
@@ -92,18 +124,25 @@ FXbool FXStringDictionary::resize(FXival n){
   FXASSERT((n-used())>0);       // At least one free slot
   if(elbat.no(n)){
     if(1<elbat.no() && 1<no()){
-      FXuval p,b,h,x; FXival i;
-      for(i=0; i<no(); ++i){                  // Hash existing entries into new table
-        if(!table[i].key.empty()){
-          p=b=h=table[i].hash;
-          while(elbat.table[x=p&(n-1)].hash){ // Locate slot
-            p=(p<<2)+p+b+1;
-            b>>=BSHIFT;
+      FXuchar* ctl=CONTROL(elbat.table,n);
+      FXuint v=VALID(n),h,bits;
+      FXuval s,x,i;
+      FXival j;
+      for(j=0; j<no(); ++j){                  // Hash existing entries into new table
+        if(!table[j].key.empty()){
+          h=table[j].hash;
+          x=h&(n-1)&~(GROUP-1);
+          s=0;
+          while((bits=matchgroup(ctl+x,FREE)&v)==0){   // Locate group with free slot
+            s+=GROUP;
+            x=(x+s)&(n-1);
             }
-          elbat.table[x].key.adopt(table[i].key);       // Steal the string buffers
-          elbat.table[x].data.adopt(table[i].data);
-          elbat.table[x].hash=(FXuint)h;                // And copy the hash value
-          elbat.table[x].mark=table[i].mark;            // Copy mark
+          i=x+ctz32(bits);
+          ctl[i]=TAG(h);
+          elbat.table[i].key.adopt(table[j].key);       // Steal the string buffers
+          elbat.table[i].data.adopt(table[j].data);
+          elbat.table[i].hash=h;                        // And copy the hash value
+          elbat.table[i].mark=table[j].mark;            // Copy mark
           }
         }
       elbat.free(n-used());     // All non-empty slots now free
@@ -119,17 +158,18 @@ FXbool FXStringDictionary::resize(FXival n){
 // Construct empty dictionary
 FXStringDictionary::FXStringDictionary():table(EMPTY){
   FXASSERT(sizeof(FXStringDictionary)==sizeof(FXptr));
-  FXASSERT(sizeof(Entry)<=sizeof(FXival)*4);
+  FXASSERT(sizeof(Entry)<=sizeof(FXival)*8);
   }
 
 
 // Construct from another string dictionary
 FXStringDictionary::FXStringDictionary(const FXStringDictionary& other):table(EMPTY){
   FXASSERT(sizeof(FXStringDictionary)==sizeof(FXptr));
-  FXASSERT(sizeof(Entry)<=sizeof(FXival)*4);
+  FXASSERT(sizeof(Entry)<=sizeof(FXival)*8);
   if(1<other.no()){
     if(__unlikely(!no(other.no()))){ throw FXMemoryException("FXStringDictionary::FXStringDictionary: out of memory\n"); }
     copyElms(table,other.table,no());
+    copyElms(CONTROL(table,no()),CONTROL(other.table,no()),no());
     free(other.free());
     used(other.used());
     }
@@ -142,6 +182,7 @@ FXStringDictionary& FXStringDictionary::operator=(const FXStringDictionary& othe
     if(1<other.no()){
       if(__unlikely(!no(other.no()))){ throw FXMemoryException("FXStringDictionary::operator=: out of memory\n"); }
       copyElms(table,other.table,no());
+      copyElms(CONTROL(table,no()),CONTROL(other.table,no()),no());
       free(other.free());
       used(other.used());
       }
@@ -167,13 +208,19 @@ FXStringDictionary& FXStringDictionary::adopt(FXStringDictionary& other){
 FXival FXStringDictionary::find(const FXchar* ky) const {
   if(__unlikely(!ky || !*ky)){ throw FXRangeException("FXStringDictionary::find: null or empty key\n"); }
   if(__likely(!empty())){
-    FXuval p,b,x,h;
-    p=b=h=FXString::hash(ky);
-    FXASSERT(h);
-    while(table[x=p&(no()-1)].hash){
-      if(table[x].hash==h && table[x].key==ky) return x;
-      p=(p<<2)+p+b+1;
-      b>>=BSHIFT;
+    const FXuchar* ctl=CONTROL(table,no());
+    FXuint h=FXString::hash(ky),v=VALID(no()),bits;
+    FXuval m=no()-1,x=h&m&~(GROUP-1),s=0,i;
+    while(1){
+      bits=matchgroup(ctl+x,TAG(h))&v;
+      while(bits){
+        i=x+ctz32(bits);
+        if(table[i].hash==h && table[i].key==ky) return i;
+        bits&=bits-1;
+        }
+      if(matchgroup(ctl+x,FREE)&v) break;
+      s+=GROUP;
+      x=(x+s)&m;
       }
     }
   return -1;
@@ -182,66 +229,54 @@ FXival FXStringDictionary::find(const FXchar* ky) const {
 
 // Return reference to string assocated with key
 FXString& FXStringDictionary::at(const FXchar* ky,FXbool mrk){
-  FXuval p,b,h,x;
   if(__unlikely(!ky || !*ky)){ throw FXRangeException("FXStringDictionary::at: null or empty key\n"); }
-  p=b=h=FXString::hash(ky);
-  FXASSERT(h);
-  while(table[x=p&(no()-1)].hash){
-    if(table[x].hash==h && table[x].key==ky) goto x;   // Return existing slot
-    p=(p<<2)+p+b+1;
-    b>>=BSHIFT;
+  FXuchar* ctl=CONTROL(table,no());
+  FXuint h=FXString::hash(ky),v=VALID(no()),bits;
+  FXuval m=no()-1,x=h&m&~(GROUP-1),s=0,i;
+  while(1){
+    bits=matchgroup(ctl+x,TAG(h))&v;
+    while(bits){
+      i=x+ctz32(bits);
+      if(table[i].hash==h && table[i].key==ky) goto x;  // Return existing slot
+      bits&=bits-1;
+      }
+    if(matchgroup(ctl+x,FREE)&v) break;
+    s+=GROUP;
+    x=(x+s)&m;
     }
   if(__unlikely(free()<=1+(no()>>2)) && __unlikely(!resize(no()<<1))){ throw FXMemoryException("FXStringDictionary::at: out of memory\n"); }
-  p=b=h;
-  while(table[x=p&(no()-1)].hash){
-    if(table[x].key.empty()) goto y;                    // Return voided slot
-    p=(p<<2)+p+b+1;
-    b>>=BSHIFT;
+  ctl=CONTROL(table,no());
+  v=VALID(no());
+  m=no()-1;
+  x=h&m&~(GROUP-1);
+  s=0;
+  while((bits=opengroup(ctl+x)&v)==0){                 // Locate group with voided or free slot
+    s+=GROUP;
+    x=(x+s)&m;
     }
-  free(free()-1);                                       // Put into empty slot
-y:used(used()+1);
-  table[x].key=ky;
-  table[x].hash=(FXuint)h;
-x:table[x].mark=mrk;
-  return table[x].data;
+  i=x+ctz32(bits);
+  if(ctl[i]==FREE) free(free()-1);                      // Put into empty slot
+  used(used()+1);
+  ctl[i]=TAG(h);
+  table[i].key=ky;
+  table[i].hash=h;
+x:table[i].mark=mrk;
+  return table[i].data;
   }
 
 
 // Return constant reference to string assocated with key
 const FXString& FXStringDictionary::at(const FXchar* ky) const {
-  if(__unlikely(!ky || !*ky)){ throw FXRangeException("FXStringDictionary::at: null or empty key\n"); }
-  if(__likely(!empty())){
-    FXuval p,b,x,h;
-    p=b=h=FXString::hash(ky);
-    FXASSERT(h);
-    while(table[x=p&(no()-1)].hash){
-      if(table[x].hash==h && table[x].key==ky) return table[x].data;
-      p=(p<<2)+p+b+1;
-      b>>=BSHIFT;
-      }
-    }
+  FXival pos=find(ky);
+  if(0<=pos) return table[pos].data;
   return EMPTY[0].data;
   }
 
 
 // Remove string associated with given key
 FXbool FXStringDictionary::remove(const FXchar* ky){
-  if(__unlikely(!ky || !*ky)){ throw FXRangeException("FXStringDictionary::remove: null or empty key\n"); }
-  if(__likely(!empty())){
-    FXuval p,b,h,x;
-    p=b=h=FXString::hash(ky);
-    FXASSERT(h);
-    while(table[x=p&(no()-1)].hash!=h || table[x].key!=ky){
-      if(!table[x].hash) return false;
-      p=(p<<2)+p+b+1;
-      b>>=BSHIFT;
-      }
-    table[x].key.clear();                                 // Void the slot (not empty!)
-    table[x].data.clear();
-    used(used()-1);
-    if(__unlikely(used()<=(no()>>2))) resize(no()>>1);
-    return true;
-    }
+  FXival pos=find(ky);
+  if(0<=pos) return erase(pos);
   return false;
   }
 
@@ -250,8 +285,16 @@ FXbool FXStringDictionary::remove(const FXchar* ky){
 FXbool FXStringDictionary::erase(FXival pos){
   if(__unlikely(pos<0 || no()<=pos)){ throw FXRangeException("FXStringDictionary::erase: argument out of range\n"); }
   if(!table[pos].key.empty()){
-    table[pos].key.clear();                             // Void the slot (not empty!)
+    FXuchar* ctl=CONTROL(table,no());
+    table[pos].key.clear();
     table[pos].data.clear();
+    if(matchgroup(ctl+(pos&~(GROUP-1)),FREE)&VALID(no())){
+      ctl[pos]=FREE;                                    // Free the slot; no probe sequence passes through its group
+      free(free()+1);
+      }
+    else{
+      ctl[pos]=VOIDED;                                  // Void the slot (not empty!)
+      }
     used(used()-1);
     if(__unlikely(used()<=(no()>>2))) resize(no()>>1);
     return true;
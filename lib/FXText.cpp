@@ -31,11 +31,15 @@
 #include "FXArray.h"
 #include "FXMetaClass.h"
 #include "FXHash.h"
+#include "FXAtomic.h"
 #include "FXMutex.h"
+#include "FXRefPtr.h"
 #include "FXStream.h"
 #include "FXString.h"
 #include "FXException.h"
+#include "FXDictionary.h"
 #include "FXRex.h"
+#include "FXRexCache.h"
 #include "FXSize.h"
 #include "FXPoint.h"
 #include "FXRectangle.h"
@@ -1518,6 +1522,26 @@ void FXText::flashMatching(){
 
 /*******************************************************************************/
 
+namespace {
+
+// Delivers the text buffer to FXRex as the pieces before and after the gap
+class FXGapInput : public FXRexInput {
+  const FXchar *buffer;
+  FXint         gapbeg;
+  FXint         gapend;
+  FXint         length;
+public:
+  FXGapInput(const FXchar* buf,FXint gb,FXint ge,FXint len):buffer(buf),gapbeg(gb),gapend(ge),length(len){ }
+  virtual const FXchar* fetch(FXint pos,FXint& beg,FXint& end){
+    if(pos<gapbeg){ beg=0; end=gapbeg; return buffer; }
+    if(pos<length){ beg=gapbeg; end=length; return buffer+gapend; }
+    return nullptr;
+    }
+  };
+
+}
+
+
 // Search for text
 FXbool FXText::findText(const FXString& string,FXint* beg,FXint* end,FXint start,FXuint flgs,FXint npar){
 
@@ -1531,9 +1555,22 @@ FXbool FXText::findText(const FXString& string,FXint* beg,FXint* end,FXint start
   if(flgs&SEARCH_IGNORECASE) rexmode|=FXRex::IgnoreCase;        // Case insensitivity
   if(!(flgs&SEARCH_REGEX)) rexmode|=FXRex::Verbatim;            // Verbatim match
 
-  // Try parse the regex
-  FXRex rex;
-  if(rex.parse(string,rexmode)==FXRex::ErrOK){
+  // Try parse the regex; repeated searches share the compiled pattern
+  FXRefPtr<FXRexCache::Pattern> pattern=FXRexCache::instance().get(string,rexmode);
+  if(pattern->getError()==FXRex::ErrOK){
+    const FXRex& rex=pattern->getRex();
+
+    // Search forward around the gap, if the pattern allows
+    if((flgs&SEARCH_FORWARD) && rex.incremental()){
+      FXGapInput input(buffer,gapbeg,gapend,length);
+      if(start<=length){
+        if(rex.search(input,Math::imax(start,0),length,FXRex::Normal,beg,end,npar)>=0) return true;
+        }
+      if((flgs&SEARCH_WRAP) && (start>0)){
+        if(rex.search(input,0,Math::imin(start,length),FXRex::Normal,beg,end,npar)>=0) return true;
+        }
+      return false;
+      }
 
     // Make all characters contiguous in the buffer
     movegap(length);
@@ -110,6 +110,12 @@
     history past that point is often not necessary and could be released
     if space is exceeded.
 
+  - A memory budget may be set with setMaxSize() and setKeepSize().  When
+    adding a command at the top level pushes the total size over the maximum,
+    the oldest commands are trimmed until the keep size is reached.  The most
+    recent command is never trimmed this way, so a single large change, like
+    a global replace, can always be undone.
+
   - FIXME want trimAltHistory() to trim non-linear history only.  Keeping
     track of alternate history may not be as important as linear history;
     when space is exceeded one might want to start deleting alternate
@@ -227,7 +233,7 @@ FXIMPLEMENT(FXUndoList,FXCommandGroup,FXUndoListMap,ARRAYNUMBER(FXUndoListMap))
 
 
 // Make new empty undo list
-FXUndoList::FXUndoList():space(0),undocount(0),redocount(0),marker(0),markset(false),alternate(true),working(false){
+FXUndoList::FXUndoList():space(0),maxsize(~(FXuval)0),keepsize(~(FXuval)0),undocount(0),redocount(0),marker(0),markset(false),alternate(true),working(false){
   }
 
 
@@ -459,6 +465,9 @@ FXbool FXUndoList::cut(){
       command[undocount+i]->unref();
       }
 
+    // Drop them from the list
+    command.no(undocount);
+
     // Update the books
     redocount=0;
     FXTRACE((TOPIC_DEBUG,"FXUndoList::cut: space=%lu undocount=%d redocount=%d marker=%d\n",space,undoCount(),redoCount(),marker));
@@ -534,6 +543,7 @@ FXbool FXUndoList::add(FXCommand* cmd,FXbool doit,FXbool merge){
           // Update bookkeeping
           if(grp==this){
             space+=newsize-oldsize;
+            if(maxsize<space) trim(keepsize,1);
             }
 
           // Delete command
@@ -546,6 +556,18 @@ FXbool FXUndoList::add(FXCommand* cmd,FXbool doit,FXbool merge){
         }
       }
 
+    // Append to innermost open command group
+    if(grp!=this){
+      if(grp->command.push(cmd)){
+        grp->command.tail().flag(true);
+        cmd->ref();
+        working=false;
+        return true;
+        }
+      working=false;
+      return false;
+      }
+
     // Create space if not fits
     if(undocount<command.no() || command.no(command.no()+1)){
 
@@ -561,11 +583,10 @@ FXbool FXUndoList::add(FXCommand* cmd,FXbool doit,FXbool merge){
       cmd->ref();
 
       // Update bookkeeping
-      if(grp==this){
-        space+=cmd->size();
-        undocount++;
-        marker++;
-        }
+      space+=cmd->size();
+      undocount++;
+      marker++;
+      if(maxsize<space) trim(keepsize,1);
 
       working=false;
 
@@ -625,15 +646,23 @@ FXbool FXUndoList::end(){
   if(!cmd->empty()){
 
     // Append new command to undo list
-    grp->command.push(cmd);
+    if(grp->command.push(cmd)){
 
-    // Update bookkeeping
-    if(grp==this){
-      space+=cmd->size();
-      undocount++;
-      marker+=1;
+      // Going forward
+      grp->command.tail().flag(true);
+
+      // Add reference
+      cmd->ref();
+
+      // Update bookkeeping
+      if(grp==this){
+        space+=cmd->size();
+        undocount++;
+        marker+=1;
+        if(maxsize<space) trim(keepsize,1);
+        }
+      return true;
       }
-    return true;
     }
 
   // Delete bottom group
@@ -698,12 +727,12 @@ void FXUndoList::trimCount(FXint nc){
   }
 
 
-// Trim undo list down to at most size sz
-void FXUndoList::trimSize(FXuval sz){
-  FXTRACE((TOPIC_DEBUG,"FXUndoList::trimSize: was: space=%lu undocount=%d; marker=%d ",space,undocount,marker));
+// Trim oldest undo records until at most size sz, keeping at least nc records
+void FXUndoList::trim(FXuval sz,FXint nc){
+  FXTRACE((TOPIC_DEBUG,"FXUndoList::trim: was: space=%lu undocount=%d; marker=%d ",space,undocount,marker));
   if(sz<space){
     FXint i=0;
-    while(i<undocount && sz<space){
+    while(i<undocount-nc && sz<space){
       if(command[i]->nrefs()==1){ space-=command[i]->size(); }
       command[i]->unref();
       i++;
@@ -716,6 +745,12 @@ void FXUndoList::trimSize(FXuval sz){
   }
 
 
+// Trim undo list down to at most size sz
+void FXUndoList::trimSize(FXuval sz){
+  trim(sz,0);
+  }
+
+
 // Trim undo list down to (but not including) marked node.
 void FXUndoList::trimMark(){
   FXTRACE((TOPIC_DEBUG,"FXUndoList::trimSize: was: space=%lu undocount=%d; marker=%d ",space,undocount,marker));
@@ -741,6 +776,7 @@ void FXUndoList::dumpStats(){
   FXbool forward;
   fxmessage("FXUndoList stats:\n");
   fxmessage("  memory used       : %lu\n",space);
+  fxmessage("  memory budget     : %lu (keep: %lu)\n",maxsize,keepsize);
   fxmessage("  number of records : %lu\n",command.no());
   fxmessage("  undolist length   : %d\n",undocount);
   fxmessage("  redolist length   : %d\n",redocount);
@@ -233,6 +233,13 @@ FXVariant::FXVariant(const FXVariant& other):type(NullType){
   }
 
 
+// Move constructor
+FXVariant::FXVariant(FXVariant&& other):value(other.value),type(other.type){
+  other.value.u=0;
+  other.type=NullType;
+  }
+
+
 // Construct and initialize with bool
 FXVariant::FXVariant(FXbool val):type(BoolType){
   FXASSERT_STATIC(sizeof(value)>=sizeof(FXString) && sizeof(value)>=sizeof(FXVariantArray) &&  sizeof(value)>=sizeof(FXVariantMap));
@@ -596,7 +603,7 @@ FXdouble FXVariant::toDouble(FXbool* ok) const {
 
 // Convert to char pointer
 const FXchar* FXVariant::toChars() const {
-  return isString() ? value.s : FXString::null;
+  return isString() ? asString().text() : FXString::null;
   }
 
 
@@ -619,9 +626,11 @@ FXString FXVariant::toString(FXbool* ok) const {
     if(ok) *ok=true;
     return FXString::value(value.u);
   case FloatType:
+    if(ok) *ok=true;
+    return FXString::value((FXfloat)value.d,-1);
   case DoubleType:
     if(ok) *ok=true;
-    return FXString::value(value.d,16);
+    return FXString::value(value.d,-1);
   case StringType:
     if(ok) *ok=true;
     return asString();
@@ -743,6 +752,12 @@ FXVariant& FXVariant::operator=(const FXVariant& val){
   return assign(val);
   }
 
+
+// Take over variant
+FXVariant& FXVariant::operator=(FXVariant&& val){
+  return adopt(val);
+  }
+
 /*******************************************************************************/
 
 // Remove entry from the table
@@ -73,9 +73,8 @@ namespace FX {
 
 
 // Empty dictionary table value
-extern const FXint __string__empty__[];
 extern const FXival __variantmap__empty__[];
-const FXival __variantmap__empty__[12]={1,0,1,(FXival)(__string__empty__+1),0,0,0,0,0,0,0,0};
+const FXival __variantmap__empty__[13]={1,0,1,0,0,0,0,0,0,0,0,0,0};
 
 
 // Adjust the size of the table
@@ -140,14 +139,14 @@ FXbool FXVariantMap::resize(FXival n){
 // Construct empty map
 FXVariantMap::FXVariantMap():table(EMPTY){
   FXASSERT(sizeof(FXVariantMap)==sizeof(FXptr));
-  FXASSERT(sizeof(Entry)<=sizeof(FXival)*8);
+  FXASSERT(sizeof(Entry)<=sizeof(FXival)*10);
   }
 
 
 // Construct from another map
 FXVariantMap::FXVariantMap(const FXVariantMap& other):table(EMPTY){
   FXASSERT(sizeof(FXVariantMap)==sizeof(FXptr));
-  FXASSERT(sizeof(Entry)<=sizeof(FXival)*8);
+  FXASSERT(sizeof(Entry)<=sizeof(FXival)*10);
   if(1<other.no()){
     if(__unlikely(!no(other.no()))){ throw FXMemoryException("FXVariantMap::FXVariantMap: out of memory\n"); }
     copyElms(table,other.table,no());
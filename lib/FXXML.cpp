@@ -202,6 +202,16 @@
 
       o We're not at token or (multibyte) character boundary.
 
+  - Tag names and attributes are copied into a store which only ever grows, as a start tag
+    may span several buffer fills; the tag name is kept until the matching end tag has been
+    parsed.  Attribute values are kept raw, noting whether they contain character references
+    or carriage returns, so that the application decodes them only if needed.
+
+  - If startTagCB, textCB, or endTagCB are connected, they're passed spans of characters
+    from the store or parse buffer directly; otherwise, the spans are decoded and passed
+    to startElementCB, charactersCB, and endElementCB as before.  Thus, once the store has
+    grown large enough, no memory is allocated during the parse at all.
+
   - The column may be incorrect if input string is not UTF8; column number is incremented
     for every character-start [not for UTF8 follower characters, in other words].
 */
@@ -309,13 +319,14 @@ private:
   Element          **instance;          // Instance pointer
   Element           *upper;             // Upper pointer
 public:
-  FXString           name;              // Tag name
-  FXStringDictionary attributes;        // Attribute list
+  FXString           name;              // Tag name, if passed as string
+  FXint              mark;              // Start of tag name in store
+  FXint              length;            // Length of tag name
   FXbool             empty;             // Element is empty
 public:
 
   // Enter
-  Element(Element** ins):instance(ins),upper(*ins),empty(false){ *instance=this; }
+  Element(Element** ins):instance(ins),upper(*ins),mark(0),length(0),empty(false){ *instance=this; }
 
   // Leave
  ~Element(){ *instance=upper; }
@@ -323,74 +334,88 @@ public:
 
 /*******************************************************************************/
 
+// Parse character reference following '&' at src[q], and return its value in wc;
+// return false if malformed or unknown
+static FXbool reference(const FXchar* src,FXint len,FXint& q,FXwchar& wc){
+  if(q<len && src[q]=='#'){
+    if(q+1<len && src[q+1]=='x'){               // &#xXXXX;
+      q+=2;
+      if(q>=len || !Ascii::isHexDigit(src[q])) return false;    // Expected at least one hex digit
+      wc=Ascii::digitValue(src[q++]);
+      while(q<len && Ascii::isHexDigit(src[q])){
+        wc=wc*16+Ascii::digitValue(src[q++]);
+        }
+      }
+    else{                                       // &#DDDD;
+      q+=1;
+      if(q>=len || !Ascii::isDigit(src[q])) return false;       // Expected at least one digit
+      wc=src[q++]-'0';
+      while(q<len && Ascii::isDigit(src[q])){
+        wc=wc*10+(src[q++]-'0');
+        }
+      }
+    if(q>=len || src[q]!=';') return false;     // Expected semicolon
+    q++;
+    return true;
+    }
+  if(q+4<len && src[q]=='q' && src[q+1]=='u' && src[q+2]=='o' && src[q+3]=='t' && src[q+4]==';'){      // &quot;
+    q+=5;
+    wc='\"';
+    return true;
+    }
+  if(q+4<len && src[q]=='a' && src[q+1]=='p' && src[q+2]=='o' && src[q+3]=='s' && src[q+4]==';'){      // &apos;
+    q+=5;
+    wc='\'';
+    return true;
+    }
+  if(q+3<len && src[q]=='a' && src[q+1]=='m' && src[q+2]=='p' && src[q+3]==';'){       // &amp;
+    q+=4;
+    wc='&';
+    return true;
+    }
+  if(q+2<len && src[q]=='l' && src[q+1]=='t' && src[q+2]==';'){        // &lt;
+    q+=3;
+    wc='<';
+    return true;
+    }
+  if(q+2<len && src[q]=='g' && src[q+1]=='t' && src[q+2]==';'){        // &gt;
+    q+=3;
+    wc='>';
+    return true;
+    }
+  return false;                                 // Unknown reference
+  }
+
+
 // Decode escaped special characters from XML stream
-FXbool FXXML::decode(FXString& dst,const FXString& src,FXuint flags){
+FXbool FXXML::decode(FXString& dst,const FXchar* src,FXint len,FXuint flags){
   FXint p,q;
   FXwchar wc;
 
+  // Nothing to translate
+  if(!(flags&(CRLF|REFS))){
+    dst.assign(src,len);
+    return true;
+    }
+
   // Measure the resulting string first
   p=q=0;
-  while(q<src.length()){
+  while(q<len){
     wc=src[q++];
     if(wc=='\r' && (flags&CRLF)){               // CR, CRLF -> LF
-      if(src[q]=='\n'){ q++; }
+      if(q<len && src[q]=='\n'){ q++; }
       p++;
       continue;
       }
     if(wc=='\n' && (flags&CRLF)){               // LF, LFCR -> LF
-      if(src[q]=='\r'){ q++; }
+      if(q<len && src[q]=='\r'){ q++; }
       p++;
       continue;
       }
     if(wc=='&' && (flags&REFS)){
-      if(src[q]=='#'){
-        if(src[q+1]=='x'){                      // &#xXXXX;
-          q+=2;
-          if(!Ascii::isHexDigit(src[q])) return false;  // Expected at least one hex digit
-          wc=Ascii::digitValue(src[q++]);
-          while(Ascii::isHexDigit(src[q])){
-            wc=wc*16+Ascii::digitValue(src[q++]);
-            }
-          if(src[q++]!=';') return false;       // Expected semicolon
-          }
-        else{                                   // &#DDDD;
-          q+=1;
-          if(!Ascii::isDigit(src[q])) return false;     // Expected at least one digit
-          wc=src[q++]-'0';
-          while(Ascii::isDigit(src[q])){
-            wc=wc*10+(src[q++]-'0');
-            }
-          if(src[q++]!=';') return false;       // Expected semicolon
-          }
-        p+=wc2utf(wc);
-        continue;
-        }
-      if(src[q]=='q' && src[q+1]=='u' && src[q+2]=='o' && src[q+3]=='t' && src[q+4]==';'){      // &quot;
-        q+=5;
-        p++;
-        continue;
-        }
-      if(src[q]=='a' && src[q+1]=='p' && src[q+2]=='o' && src[q+3]=='s' && src[q+4]==';'){      // &apos;
-        q+=5;
-        p++;
-        continue;
-        }
-      if(src[q]=='a' && src[q+1]=='m' && src[q+2]=='p' && src[q+3]==';'){       // &amp;
-        q+=4;
-        p++;
-        continue;
-        }
-      if(src[q]=='l' && src[q+1]=='t' && src[q+2]==';'){        // &lt;
-        q+=3;
-        p++;
-        continue;
-        }
-      if(src[q]=='g' && src[q+1]=='t' && src[q+2]==';'){        // &gt;
-        q+=3;
-        p++;
-        continue;
-        }
-      return false;                             // Unknown reference
+      if(!reference(src,len,q,wc)) return false;
+      p+=wc2utf(wc);
+      continue;
       }
     p++;
     }
@@ -400,68 +425,22 @@ FXbool FXXML::decode(FXString& dst,const FXString& src,FXuint flags){
 
   // Now produce the result string
   p=q=0;
-  while(q<src.length()){
+  while(q<len){
     wc=src[q++];
     if(wc=='\r' && (flags&CRLF)){               // CR, CRLF -> LF
-      if(src[q]=='\n'){ q++; }
+      if(q<len && src[q]=='\n'){ q++; }
       dst[p++]='\n';
       continue;
       }
     if(wc=='\n' && (flags&CRLF)){               // LF, LFCR -> LF
-      if(src[q]=='\r'){ q++; }
+      if(q<len && src[q]=='\r'){ q++; }
       dst[p++]='\n';
       continue;
       }
     if(wc=='&' && (flags&REFS)){
-      if(src[q]=='#'){
-        if(src[q+1]=='x'){                      // &#xXXXX;
-          q+=2;
-          FXASSERT(Ascii::isHexDigit(src[q]));  // Expected at least one hex digit
-          wc=Ascii::digitValue(src[q++]);
-          while(Ascii::isHexDigit(src[q])){
-            wc=wc*16+Ascii::digitValue(src[q++]);
-            }
-          FXASSERT(src[q]==';');                // Expected semicolon
-          q++;
-          }
-        else{                                   // &#DDDD;
-          q+=1;
-          FXASSERT(Ascii::isDigit(src[q]));     // Expected at least one digit
-          wc=src[q++]-'0';
-          while(Ascii::isDigit(src[q])){
-            wc=wc*10+(src[q++]-'0');
-            }
-          FXASSERT(src[q]==';');                // Expected semicolon
-          q++;
-          }
-        p+=wc2utf(&dst[p],wc);
-        continue;
-        }
-      if(src[q]=='q' && src[q+1]=='u' && src[q+2]=='o' && src[q+3]=='t' && src[q+4]==';'){      // &quot;
-        q+=5;
-        dst[p++]='\"';
-        continue;
-        }
-      if(src[q]=='a' && src[q+1]=='p' && src[q+2]=='o' && src[q+3]=='s' && src[q+4]==';'){      // &apos;
-        q+=5;
-        dst[p++]='\'';
-        continue;
-        }
-      if(src[q]=='a' && src[q+1]=='m' && src[q+2]=='p' && src[q+3]==';'){       // &amp;
-        q+=4;
-        dst[p++]='&';
-        continue;
-        }
-      if(src[q]=='l' && src[q+1]=='t' && src[q+2]==';'){        // &lt;
-        q+=3;
-        dst[p++]='<';
-        continue;
-        }
-      if(src[q]=='g' && src[q+1]=='t' && src[q+2]==';'){        // &gt;
-        q+=3;
-        dst[p++]='>';
-        continue;
-        }
+      reference(src,len,q,wc);
+      p+=wc2utf(&dst[p],wc);
+      continue;
       }
     dst[p++]=wc;
     }
@@ -469,6 +448,12 @@ FXbool FXXML::decode(FXString& dst,const FXString& src,FXuint flags){
   return true;
   }
 
+
+// Decode escaped special characters from XML stream
+FXbool FXXML::decode(FXString& dst,const FXString& src,FXuint flags){
+  return FXXML::decode(dst,src.text(),src.length(),flags);
+  }
+
 /*******************************************************************************/
 
 // Encode special characters for inclusion into XML stream
@@ -591,13 +576,13 @@ FXbool FXXML::encode(FXString& dst,const FXString& src,FXuint flags){
 /*******************************************************************************/
 
 // Construct XML parser instance
-FXXML::FXXML():offset(0),current(nullptr),column(0),line(1),enc(UTF8){
+FXXML::FXXML():offset(0),current(nullptr),used(0),natts(0),column(0),line(1),enc(UTF8){
   FXTRACE((100,"FXXML::FXXML\n"));
   }
 
 
 // Construct XML parser instance and pass it external buffer
-FXXML::FXXML(FXchar* buffer,FXuval sz,Direction d):FXParseBuffer(buffer,sz,d),offset(0),current(nullptr),column(0),line(1),enc(UTF8){
+FXXML::FXXML(FXchar* buffer,FXuval sz,Direction d):FXParseBuffer(buffer,sz,d),offset(0),current(nullptr),used(0),natts(0),column(0),line(1),enc(UTF8){
   FXTRACE((100,"FXXML::FXXML(%p,%ld,%s)\n",buffer,sz,d==Load?"Load":d==Save?"Save":"Stop"));
   open(buffer,sz,d);
   }
@@ -608,6 +593,8 @@ FXbool FXXML::open(FXchar* buffer,FXuval sz,Direction d){
   FXTRACE((101,"FXXML::open(%p,%ld,%s)\n",buffer,sz,d==Load?"Load":d==Save?"Save":"Stop"));
   if(FXParseBuffer::open(buffer,sz,d)){
     current=nullptr;
+    used=0;
+    natts=0;
     column=0;
     offset=0;
     line=1;
@@ -859,6 +846,17 @@ FXbool FXXML::match(const FXchar* str,FXint len){
   }
 
 
+// Append characters to store; the store only ever grows, so
+// that no memory is allocated once it has become large enough
+void FXXML::keep(const FXchar* str,FXint len){
+  if(store.no()<used+len){
+    if(!store.no(used+len)){ throw FXMemoryException("FXXML: out of memory"); }
+    }
+  copyElms(store.data()+used,str,len);
+  used+=len;
+  }
+
+
 // Parse string
 FXXML::Error FXXML::parsestring(FXString& str){
   FXchar q=sptr[0];
@@ -916,6 +914,69 @@ nxt:    if((sptr-rptr)>=(endptr-begptr-MAXTOKEN)){
   }
 
 
+// Parse attribute value into store, and note which decoding it needs
+FXXML::Error FXXML::parsevalue(Span& value){
+  FXchar q=sptr[0];
+  FXint mark=used;
+  value.flags=0;
+  if(q=='"' || q=='\''){
+    column++;
+    offset++;
+    sptr++;
+    rptr=sptr;
+    while(need(MAXTOKEN)){
+      switch(sptr[0]){
+      case '\t':
+        column+=(8-column%8);
+        offset++;
+        sptr++;
+        continue;
+      case '\r':
+        if(sptr+1<wptr && sptr[1]=='\n'){ offset++; sptr++; }
+        value.flags|=CRLF;
+      case '\n':
+        column=0;
+        offset++;
+        sptr++;
+        line++;
+        continue;
+      case ' ':
+        column++;
+      case '\v':
+      case '\f':
+        offset++;
+        sptr++;
+        continue;
+      case '&':
+        value.flags|=REFS;
+        goto nxt;
+      case '\'':
+      case '"':
+        if(sptr[0]!=q) goto nxt;
+        keep(rptr,sptr-rptr);
+        value.length=used-mark;
+        offset++;
+        column++;
+        sptr++;
+        rptr=sptr;
+        return ErrOK;
+      default:
+nxt:    if((sptr-rptr)>=(endptr-begptr-MAXTOKEN)){
+          keep(rptr,sptr-rptr);
+          rptr=sptr;
+          }
+        column+=isUTF8(*sptr);          // Increment if UTF8 leader only
+        offset++;
+        sptr++;
+        continue;
+        }
+      }
+    return ErrEof;
+    }
+  return ErrString;
+  }
+
+
 // Parse version string
 FXXML::Error FXXML::parseversion(){
   spaces();
@@ -1288,19 +1349,22 @@ nxt:  if((sptr-rptr)>=(endptr-begptr-MAXTOKEN)){
   }
 
 
-// Parse key=value pair
-FXXML::Error FXXML::parseattribute(Element& elm){
+// Parse key=value pair; both are kept in the store, following the tag name
+FXXML::Error FXXML::parseattribute(){
   FXXML::Error err;
-  FXString value;
-  FXString key;
   if(name()){
-    key.assign(rptr,sptr-rptr);
+    if(atts.no()<=natts){
+      if(!atts.no(natts+1)){ throw FXMemoryException("FXXML: out of memory"); }
+      }
+    atts[natts].name.length=sptr-rptr;
+    atts[natts].name.flags=0;
+    keep(rptr,sptr-rptr);
     spaces();
     if(!match('=')) return ErrEquals;
     spaces();
-    if((err=parsestring(value))!=ErrOK) return err;
+    if((err=parsevalue(atts[natts].value))!=ErrOK) return err;
     spaces();
-    if(!FXXML::decode(elm.attributes[key],value,REFS|CRLF)) return ErrToken;
+    natts++;
     return ErrOK;
     }
   return ErrName;
@@ -1311,7 +1375,10 @@ FXXML::Error FXXML::parseattribute(Element& elm){
 FXXML::Error FXXML::parsestarttag(Element& elm){
   FXXML::Error err;
   if(!name()) return ErrName;
-  elm.name.assign(rptr,sptr-rptr);
+  elm.mark=used;
+  elm.length=sptr-rptr;
+  keep(rptr,sptr-rptr);
+  natts=0;
   while(need(MAXTOKEN)){
     rptr=sptr;
     switch(sptr[0]){
@@ -1349,7 +1416,7 @@ FXXML::Error FXXML::parsestarttag(Element& elm){
       sptr++;
       return ErrOK;                     // End of stag
     default:
-      if((err=parseattribute(elm))!=ErrOK) return err;
+      if((err=parseattribute())!=ErrOK) return err;
       continue;
       }
     }
@@ -1359,7 +1426,7 @@ FXXML::Error FXXML::parsestarttag(Element& elm){
 
 // End tag
 FXXML::Error FXXML::parseendtag(Element& elm){
-  if(!match(elm.name.text(),elm.name.length())) return ErrNoMatch;
+  if(!match(store.data()+elm.mark,elm.length)) return ErrNoMatch;
   while(need(MAXTOKEN)){
     rptr=sptr;
     switch(sptr[0]){
@@ -1397,9 +1464,10 @@ FXXML::Error FXXML::parseendtag(Element& elm){
 
 
 // CData
-FXXML::Error FXXML::parsecdata(Element& elm){
+FXXML::Error FXXML::parsecdata(Element&){
   FXXML::Error err;
   FXString text;
+  FXuint flags=0;
   rptr=sptr;
   while(need(MAXTOKEN)){
     switch(sptr[0]){
@@ -1410,6 +1478,7 @@ FXXML::Error FXXML::parsecdata(Element& elm){
       continue;
     case '\r':
       if(sptr+1<wptr && sptr[1]=='\n'){ offset++; sptr++; }
+      flags|=CRLF;
     case '\n':
       column=0;
       offset++;
@@ -1426,8 +1495,7 @@ FXXML::Error FXXML::parsecdata(Element& elm){
     case ']':
       if(sptr[1]!=']') goto nxt;
       if(sptr[2]!='>') goto nxt;
-      if(!FXXML::decode(text,FXString(rptr,sptr-rptr),CRLF)) return ErrToken;
-      if((err=charactersCB(text))!=ErrOK) return err;
+      if((err=reporttext(text,rptr,sptr-rptr,flags))!=ErrOK) return err;
       column+=3;
       offset+=3;
       sptr+=3;
@@ -1435,9 +1503,9 @@ FXXML::Error FXXML::parsecdata(Element& elm){
       return ErrOK;
     default:
 nxt:  if((sptr-rptr)>=(endptr-begptr-MAXTOKEN)){
-        if(!FXXML::decode(text,FXString(rptr,sptr-rptr),CRLF)) return ErrToken;
-        if((err=charactersCB(text))!=ErrOK) return err;
+        if((err=reporttext(text,rptr,sptr-rptr,flags))!=ErrOK) return err;
         rptr=sptr;
+        flags=0;
         }
       column+=isUTF8(*sptr);            // Increment if UTF8 leader only
       offset++;
@@ -1453,6 +1521,7 @@ nxt:  if((sptr-rptr)>=(endptr-begptr-MAXTOKEN)){
 FXXML::Error FXXML::parsecontents(Element& elm){
   FXXML::Error err;
   FXString text;
+  FXuint flags=0;                       // Decoding needed
   FXint brk=1;                          // Allow break
   rptr=sptr;
   while(need(MAXTOKEN)){
@@ -1465,6 +1534,7 @@ FXXML::Error FXXML::parsecontents(Element& elm){
       continue;
     case '\r':
       if(sptr+1<wptr && sptr[1]=='\n'){ offset++; sptr++; }
+      flags|=CRLF;
     case '\n':
       column=0;
       offset++;
@@ -1481,6 +1551,7 @@ FXXML::Error FXXML::parsecontents(Element& elm){
       brk=1;
       continue;
     case '&':                           // Disallow break in character reference
+      flags|=REFS;
       column++;
       offset++;
       sptr++;
@@ -1495,14 +1566,12 @@ FXXML::Error FXXML::parsecontents(Element& elm){
     case '<':
       brk=1;
 
-      // Try decode, translate both CRLF and references
-      if(!FXXML::decode(text,FXString(rptr,sptr-rptr),CRLF|REFS)) return ErrToken;
-
       // Report final batch of characters
-      if((err=charactersCB(text))!=ErrOK) return err;
+      if((err=reporttext(text,rptr,sptr-rptr,flags))!=ErrOK) return err;
 
       // Eat text
       rptr=sptr;
+      flags=0;
 
       // End tag
       if(sptr[1]=='/'){
@@ -1552,14 +1621,12 @@ FXXML::Error FXXML::parsecontents(Element& elm){
     default:
       if(brk && (sptr-rptr)>=(endptr-begptr-MAXTOKEN)){
 
-        // Try decode, translate both CRLF and references
-        if(!FXXML::decode(text,FXString(rptr,sptr-rptr),CRLF|REFS)) return ErrToken;
-
         // Report batch of characters
-        if((err=charactersCB(text))!=ErrOK) return err;
+        if((err=reporttext(text,rptr,sptr-rptr,flags))!=ErrOK) return err;
 
         // Eat text
         rptr=sptr;
+        flags=0;
         }
       column+=isUTF8(*sptr);            // Increment if UTF8 leader only
       offset++;
@@ -1580,7 +1647,10 @@ FXXML::Error FXXML::parseelement(){
   if((err=parsestarttag(instance))!=ErrOK) return err;
 
   // Report element start
-  if((err=startElementCB(instance.name,instance.attributes))!=ErrOK) return err;
+  if((err=reportstarttag(instance))!=ErrOK) return err;
+
+  // Drop attributes, keep tag name for end tag
+  used=instance.mark+instance.length;
 
   // Its a non-empty element
   if(!instance.empty){
@@ -1593,17 +1663,74 @@ FXXML::Error FXXML::parseelement(){
     }
 
   // Report element end
-  if((err=endElementCB(instance.name))!=ErrOK) return err;
+  if((err=reportendtag(instance))!=ErrOK) return err;
+
+  // Drop tag name
+  used=instance.mark;
 
   // OK
   return ErrOK;
   }
 
 
+// Report start tag with its attributes, as spans if startTagCB is
+// connected; otherwise, decode them for startElementCB
+FXXML::Error FXXML::reportstarttag(Element& elm){
+  const FXchar* ptr=store.data()+elm.mark;
+  Span tag={ptr,elm.length,0};
+  ptr+=elm.length;
+  for(FXint i=0; i<natts; ++i){
+    atts[i].name.text=ptr;
+    ptr+=atts[i].name.length;
+    atts[i].value.text=ptr;
+    ptr+=atts[i].value.length;
+    }
+  if(!startTagCB.connected()){
+    FXStringDictionary attributes;
+    for(FXint i=0; i<natts; ++i){
+      if(!FXXML::decode(attributes[FXString(atts[i].name.text,atts[i].name.length)],atts[i].value.text,atts[i].value.length,REFS|CRLF)) return ErrToken;
+      }
+    elm.name.assign(tag.text,tag.length);
+    return startElementCB(elm.name,attributes);
+    }
+  return startTagCB(tag,atts.data(),natts);
+  }
+
+
+// Report batch of characters as span if textCB is connected; otherwise,
+// decode it into str for charactersCB
+FXXML::Error FXXML::reporttext(FXString& str,const FXchar* text,FXint len,FXuint flags){
+  if(!textCB.connected()){
+    if(!FXXML::decode(str,text,len,flags)) return ErrToken;
+    return charactersCB(str);
+    }
+  if(0<len){
+    Span span={text,len,flags};
+    return textCB(span);
+    }
+  return ErrOK;
+  }
+
+
+// Report end tag as span if endTagCB is connected; otherwise, pass
+// tag name to endElementCB
+FXXML::Error FXXML::reportendtag(Element& elm){
+  if(!endTagCB.connected()){
+    if(elm.name.empty()) elm.name.assign(store.data()+elm.mark,elm.length);
+    return endElementCB(elm.name);
+    }
+  Span tag={store.data()+elm.mark,elm.length,0};
+  return endTagCB(tag);
+  }
+
+/*******************************************************************************/
+
 // Parse it
 FXXML::Error FXXML::parse(){
   FXXML::Error err;
   current=nullptr;
+  used=0;
+  natts=0;
   if(need(MAXTOKEN)){
     enc=guess();
     FXTRACE((101,"encoding=%s\n",encodingName[enc]));
@@ -32,6 +32,7 @@
 #include "FXIODevice.h"
 #include "FXStat.h"
 #include "FXFile.h"
+#include "FXMappedFile.h"
 #include "FXException.h"
 #include "FXStringDictionary.h"
 #include "FXCallback.h"
@@ -48,6 +49,8 @@
     means we've reached end of file.
   - To flush buffer, try write all bytes from buffer; if not able to write it all,
     move unwritten bytes to start to have maximum of free space in buffer.
+  - When loading a file larger than the buffer, the whole file is memory-mapped and parsed
+    in place instead; see FXJSONFile for the caveats.
 */
 
 
@@ -75,6 +78,12 @@ FXbool FXXMLFile::open(const FXString& filename,Direction d,FXuval sz){
   FXTRACE((101,"FXXMLFile::open(\"%s\",%s,%lu)\n",filename.text(),(d==Save)?"Save":(d==Load)?"Load":"Stop",sz));
   if(dir==Stop){
     FXchar *buffer;
+    if(d==Load && sz<(FXuval)FXStat::size(filename) && map.open(filename,FXIO::Reading)){
+      if((map.length()&4095) && FXXML::open((FXchar*)map.data(),map.length(),d)){
+        return true;
+        }
+      map.close();
+      }
     if(allocElms(buffer,sz)){
       if(file.open(filename,(d==Save)?FXIO::Writing:FXIO::Reading,FXIO::AllReadWrite)){
         if(FXXML::open(buffer,sz,d)){
@@ -96,6 +105,7 @@ FXbool FXXMLFile::open(const FXString& filename,Direction d,FXuval sz){
 FXival FXXMLFile::fill(FXival){
   if(dir==Load){
     FXival nbytes;
+    if(map.data()) return wptr-sptr;            // Whole file is mapped
     moveElms(begptr,rptr,wptr-rptr);
     wptr=begptr+(wptr-rptr);
     sptr=begptr+(sptr-rptr);
@@ -133,6 +143,7 @@ FXbool FXXMLFile::close(){
   FXTRACE((101,"FXXMLFile::close()\n"));
   FXchar *buffer=begptr;
   if(FXXML::close()){
+    if(map.data()) return map.close();
     freeElms(buffer);
     return file.close();
     }
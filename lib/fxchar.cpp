@@ -23,6 +23,7 @@
 #include "fxdefs.h"
 #include "fxchar.h"
 #include "fxmath.h"
+#include "fxendian.h"
 #include "fxascii.h"
 #include "fxunicode.h"
 
@@ -53,6 +54,10 @@
       CH = (U >> 10) + 0xD800
       CL = (U & 0x3FF) + 0xDC00
 
+  - The conversions of strings of given length have fast paths for runs of ASCII
+    characters, which are converted 8 or 16 at a time using SSE2; the fast path
+    is only tried when the next character is ASCII, so text without ASCII is not
+    slowed down much.  Strings of unknown length are not read ahead of their end.
 */
 
 
@@ -107,6 +112,17 @@ FXival wcs2utf(const FXwchar* src,FXival srclen){
   const FXwchar* srcend=src+srclen;
   FXival p=0;
   FXwchar w;
+#if defined(FOX_HAS_SSE2)
+  __m128i v;
+  while(src+4<=srcend){
+    v=_mm_loadu_si128((const __m128i*)src);
+    p+=4;
+    p+=pop32(_mm_movemask_epi8(_mm_cmpgt_epi32(v,_mm_set1_epi32(0x7F))))>>2;
+    p+=pop32(_mm_movemask_epi8(_mm_cmpgt_epi32(v,_mm_set1_epi32(0x7FF))))>>2;
+    p+=pop32(_mm_movemask_epi8(_mm_cmpgt_epi32(v,_mm_set1_epi32(0xFFFF))))>>2;
+    src+=4;
+    }
+#endif
   while(src<srcend){
     w=*src++;
     p+=wc2utf(w);
@@ -130,8 +146,24 @@ FXival wcs2utf(const FXwchar *src){
 FXival ncs2utf(const FXnchar *src,FXival srclen){
   const FXnchar* srcend=src+srclen;
   FXival p=0;
-  FXnchar w;
+  FXwchar w;
+#if defined(FOX_HAS_SSE2)
+  __m128i v,h;
+#endif
   while(src<srcend){
+#if defined(FOX_HAS_SSE2)
+    if(src+8<=srcend){
+      v=_mm_loadu_si128((const __m128i*)src);
+      h=_mm_and_si128(v,_mm_set1_epi16((FXshort)0xF800));
+      if(_mm_movemask_epi8(_mm_cmpeq_epi16(h,_mm_set1_epi16((FXshort)0xD800)))==0){
+        p+=24;
+        p-=pop32(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v,_mm_set1_epi16((FXshort)0xFF80)),_mm_setzero_si128())))>>1;
+        p-=pop32(_mm_movemask_epi8(_mm_cmpeq_epi16(h,_mm_setzero_si128())))>>1;
+        src+=8;
+        continue;
+        }
+      }
+#endif
     w=*src++;
     if(leadUTF16(w)){
       if(src>=srcend) break;
@@ -147,7 +179,7 @@ FXival ncs2utf(const FXnchar *src,FXival srclen){
 // Return number of bytes for utf8 representation of narrow character string
 FXival ncs2utf(const FXnchar *src){
   FXival p=0;
-  FXnchar w;
+  FXwchar w;
   while((w=*src++)!=0){
     if(leadUTF16(w)){
       if(!followUTF16(*src)) break;
@@ -166,6 +198,13 @@ FXival utf2wcs(const FXchar *src,FXival srclen){
   FXuchar c;
   while(src<srcend){
     c=src[0];
+#if defined(FOX_HAS_SSE2)
+    if(c<0x80 && src+16<=srcend && _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)src))==0){
+      src+=16;
+      p+=16;
+      continue;
+      }
+#endif
     if(0xC0<=c){
       if(src+1>=srcend) break;
       if(!followUTF8(src[1])) break;
@@ -219,6 +258,13 @@ FXival utf2ncs(const FXchar *src,FXival len){
   FXuchar c;
   while(src<end){
     c=src[0];
+#if defined(FOX_HAS_SSE2)
+    if(c<0x80 && src+16<=end && _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)src))==0){
+      src+=16;
+      p+=16;
+      continue;
+      }
+#endif
     if(0xC0<=c){
       if(src+1>=end) break;
       if(!followUTF8(src[1])) break;
@@ -311,7 +357,22 @@ FXival wcs2utf(FXchar *dst,const FXwchar* src,FXival dstlen,FXival srclen){
   FXchar* ptrend=dst+dstlen;
   FXchar* ptr=dst;
   FXwchar w;
+#if defined(FOX_HAS_SSE2)
+  __m128i a,b;
+#endif
   while(src<srcend){
+#if defined(FOX_HAS_SSE2)
+    if(*src<0x80 && src+8<=srcend && ptr+8<=ptrend){
+      a=_mm_loadu_si128((const __m128i*)src);
+      b=_mm_loadu_si128((const __m128i*)(src+4));
+      if(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(a,b),_mm_set1_epi32(~0x7F)),_mm_setzero_si128()))==0xFFFF){
+        _mm_storel_epi64((__m128i*)ptr,_mm_packus_epi16(_mm_packs_epi32(a,b),_mm_setzero_si128()));
+        src+=8;
+        ptr+=8;
+        continue;
+        }
+      }
+#endif
     w=*src++;
     if(0x80<=w){
       if(0x800<=w){
@@ -383,7 +444,21 @@ FXival ncs2utf(FXchar *dst,const FXnchar* src,FXival dstlen,FXival srclen){
   FXchar* ptrend=dst+dstlen;
   FXchar* ptr=dst;
   FXwchar w;
+#if defined(FOX_HAS_SSE2)
+  __m128i v;
+#endif
   while(src<srcend){
+#if defined(FOX_HAS_SSE2)
+    if(*src<0x80 && src+8<=srcend && ptr+8<=ptrend){
+      v=_mm_loadu_si128((const __m128i*)src);
+      if(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v,_mm_set1_epi16((FXshort)0xFF80)),_mm_setzero_si128()))==0xFFFF){
+        _mm_storel_epi64((__m128i*)ptr,_mm_packus_epi16(v,_mm_setzero_si128()));
+        src+=8;
+        ptr+=8;
+        continue;
+        }
+      }
+#endif
     w=*src++;
     if(0x80<=w){
       if(0x800<=w){
@@ -461,7 +536,26 @@ FXival utf2wcs(FXwchar *dst,const FXchar* src,FXival dstlen,FXival srclen){
   FXwchar* ptr=dst;
   FXwchar w;
   FXuchar c;
+#if defined(FOX_HAS_SSE2)
+  __m128i v,lo,hi;
+#endif
   while(src<srcend){
+#if defined(FOX_HAS_SSE2)
+    if((FXuchar)*src<0x80 && src+16<=srcend && ptr+16<=ptrend){
+      v=_mm_loadu_si128((const __m128i*)src);
+      if(_mm_movemask_epi8(v)==0){
+        lo=_mm_unpacklo_epi8(v,_mm_setzero_si128());
+        hi=_mm_unpackhi_epi8(v,_mm_setzero_si128());
+        _mm_storeu_si128((__m128i*)(ptr+0),_mm_unpacklo_epi16(lo,_mm_setzero_si128()));
+        _mm_storeu_si128((__m128i*)(ptr+4),_mm_unpackhi_epi16(lo,_mm_setzero_si128()));
+        _mm_storeu_si128((__m128i*)(ptr+8),_mm_unpacklo_epi16(hi,_mm_setzero_si128()));
+        _mm_storeu_si128((__m128i*)(ptr+12),_mm_unpackhi_epi16(hi,_mm_setzero_si128()));
+        src+=16;
+        ptr+=16;
+        continue;
+        }
+      }
+#endif
     w=c=*src++;
     if(0xC0<=w){
       if(src>=srcend) break;
@@ -526,7 +620,22 @@ FXival utf2ncs(FXnchar *dst,const FXchar* src,FXival dstlen,FXival srclen){
   FXnchar* ptr=dst;
   FXwchar w;
   FXuchar c;
+#if defined(FOX_HAS_SSE2)
+  __m128i v;
+#endif
   while(src<srcend){
+#if defined(FOX_HAS_SSE2)
+    if((FXuchar)*src<0x80 && src+16<=srcend && ptr+16<=ptrend){
+      v=_mm_loadu_si128((const __m128i*)src);
+      if(_mm_movemask_epi8(v)==0){
+        _mm_storeu_si128((__m128i*)(ptr+0),_mm_unpacklo_epi8(v,_mm_setzero_si128()));
+        _mm_storeu_si128((__m128i*)(ptr+8),_mm_unpackhi_epi8(v,_mm_setzero_si128()));
+        src+=16;
+        ptr+=16;
+        continue;
+        }
+      }
+#endif
     w=c=*src++;
     if(0xC0<=w){
       if(src>=srcend) break;
@@ -120,6 +120,7 @@ FXuint fxCPUFeatures(){
     FXuint caps=0;
     FXuint cr=0;
     if(FXBIT(features[2],0)) caps|=CPU_HAS_SSE3;
+    if(FXBIT(features[2],1)) caps|=CPU_HAS_PCLMUL;
     if(FXBIT(features[3],8)) caps|=CPU_HAS_CX8;
     if(FXBIT(features[2],9)) caps|=CPU_HAS_SSSE3;
     if(FXBIT(features[2],13)) caps|=CPU_HAS_CX16;
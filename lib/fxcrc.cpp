@@ -21,6 +21,7 @@
 #include "xincs.h"
 #include "fxver.h"
 #include "fxdefs.h"
+#include "fxcpuid.h"
 #include "fxcrc.h"
 
 
@@ -28,8 +29,39 @@
   Notes:
 
   - Table of pre-calculated CRC32 values for 8-bit values.
+
+  - Buffers are processed 16 bytes at a time by "slicing": table k holds the
+    CRC of a byte followed by k zero bytes, so the CRCs of 16 bytes can be
+    looked up independently and added (xor-ed) together.  The slicing tables
+    are computed when first needed.
+
+  - On x86 CPUs with PCLMULQDQ, CRC32 folds 64 bytes at a time by carry-less
+    multiplication, after Intel's "Fast CRC Computation for Generic Polynomials
+    Using PCLMULQDQ Instruction"; the folding constants are x^k mod P(x) for
+    the appropriate k, bit-reflected.  Remaining bytes are done by slicing.
+
+  - On x86 CPUs with SSE4.2, CRC32C uses the crc32 instruction, 8 bytes at a time,
+    in three independent lanes; the lanes are then combined as described below.
+
+  - The implementation is picked at runtime, based on fxCPUFeatures(), the first
+    time a CRC is calculated.  The hardware versions are compiled for the required
+    instruction set extensions by means of target attributes, so the library
+    itself doesn't have to be compiled for them.
+
+  - Combining CRCs: the CRC of A followed by B is the CRC of A, multiplied by
+    x^(8*len(B)) modulo P(x), plus the CRC of B.  The power of x is calculated by
+    repeated squaring.
 */
 
+// Use carry-less multiply and crc32 instructions, if CPU has them
+#if defined(HAVE_IMMINTRIN_H) && (defined(__GNUC__) || defined(__INTEL_COMPILER)) && (defined(__i386__) || defined(__x86_64__))
+#define CRC_INTRINSICS 1
+#endif
+
+#define CRC32POLY  0xEDB88320   // CRC32 polynomial, bit-reflected
+#define CRC32CPOLY 0x82F63B78   // CRC32C polynomial, bit-reflected
+#define LANESIZE   4096         // Size of interleaved lanes for CRC32C
+
 using namespace FX;
 
 /*******************************************************************************/
@@ -76,6 +108,318 @@ const FXuint crctab[256]={
 
 }
 
+
+/*******************************************************************************/
+
+// Slicing tables; table k has CRC of byte followed by k zero bytes
+struct CRCTables {
+  FXuint tab[16][256];
+  CRCTables(FXuint poly);
+  };
+
+
+// Build slicing tables for polynomial
+CRCTables::CRCTables(FXuint poly){
+  FXuint c,i,j;
+  for(i=0; i<256; ++i){
+    c=i;
+    for(j=0; j<8; ++j){ c=(c>>1)^(poly&(0-(c&1))); }
+    tab[0][i]=c;
+    }
+  for(i=0; i<256; ++i){
+    for(j=1; j<16; ++j){ tab[j][i]=(tab[j-1][i]>>8)^tab[0][tab[j-1][i]&255]; }
+    }
+  }
+
+
+// Get little-endian 32-bit word
+static inline FXuint getLE32(const FXuchar* p){
+  return p[0] | (p[1]<<8) | (p[2]<<16) | ((FXuint)p[3]<<24);
+  }
+
+
+// Calculate CRC of buffer, 16 bytes at a time using slicing tables
+static FXuint sliceCRC(const CRCTables& t,FXuint crc,const FXuchar* buf,FXival len){
+  FXuint a,b,c,d;
+  while(16<=len){
+    a=getLE32(buf)^crc;
+    b=getLE32(buf+4);
+    c=getLE32(buf+8);
+    d=getLE32(buf+12);
+    crc=t.tab[15][a&255]^t.tab[14][(a>>8)&255]^t.tab[13][(a>>16)&255]^t.tab[12][a>>24]^
+        t.tab[11][b&255]^t.tab[10][(b>>8)&255]^t.tab[9][(b>>16)&255]^t.tab[8][b>>24]^
+        t.tab[7][c&255]^t.tab[6][(c>>8)&255]^t.tab[5][(c>>16)&255]^t.tab[4][c>>24]^
+        t.tab[3][d&255]^t.tab[2][(d>>8)&255]^t.tab[1][(d>>16)&255]^t.tab[0][d>>24];
+    buf+=16;
+    len-=16;
+    }
+  while(0<len){
+    crc=t.tab[0][(crc^*buf++)&255]^(crc>>8);
+    --len;
+    }
+  return crc;
+  }
+
+
+// Multiply a and b modulo polynomial, bit-reflected
+static FXuint multModP(FXuint a,FXuint b,FXuint poly){
+  FXuint m=0x80000000;
+  FXuint p=0;
+  while(m){
+    if(a&m) p^=b;
+    b=(b>>1)^(poly&(0-(b&1)));
+    m>>=1;
+    }
+  return p;
+  }
+
+
+// Return x^(8*n) modulo polynomial, bit-reflected
+static FXuint powModP(FXulong n,FXuint poly){
+  FXuint p=0x80000000;          // x^0
+  FXuint q=0x00800000;          // x^8
+  while(n){
+    if(n&1) p=multModP(q,p,poly);
+    q=multModP(q,q,poly);
+    n>>=1;
+    }
+  return p;
+  }
+
+
+// Function calculating CRC of buffer
+typedef FXuint (*CRCFunction)(FXuint,const FXuchar*,FXival);
+
+/*******************************************************************************/
+
+namespace CRC32 {
+
+// Slicing tables for CRC32
+static const CRCTables& tables(){
+  static const CRCTables crctables(CRC32POLY);
+  return crctables;
+  }
+
+
+// Calculate CRC32 using slicing tables
+static FXuint softCRC(FXuint crc,const FXuchar* buf,FXival len){
+  return sliceCRC(tables(),crc,buf,len);
+  }
+
+
+#if defined(CRC_INTRINSICS)
+
+// Fold 64 bytes at a time using carry-less multiply; then fold down to
+// 128 bits, and reduce that to 32 bits using Barrett reduction.
+// Length must be a multiple of 16, and at least 64.
+__attribute__((target("pclmul,sse4.1")))
+static FXuint clmulCRC(FXuint crc,const FXuchar* buf,FXival len){
+  const __m128i k1k2=_mm_set_epi64x(FXULONG(0x01c6e41596),FXULONG(0x0154442bd4));
+  const __m128i k3k4=_mm_set_epi64x(FXULONG(0x00ccaa009e),FXULONG(0x01751997d0));
+  const __m128i k5k0=_mm_set_epi64x(FXULONG(0x0000000000),FXULONG(0x0163cd6124));
+  const __m128i poly=_mm_set_epi64x(FXULONG(0x01f7011641),FXULONG(0x01db710641));
+  const __m128i mask=_mm_setr_epi32(~0,0,~0,0);
+  __m128i x0,x1,x2,x3,x4,x5,x6,x7,x8;
+
+  // Fold 4 x 128 bits at a time
+  x1=_mm_loadu_si128((const __m128i*)(buf+0x00));
+  x2=_mm_loadu_si128((const __m128i*)(buf+0x10));
+  x3=_mm_loadu_si128((const __m128i*)(buf+0x20));
+  x4=_mm_loadu_si128((const __m128i*)(buf+0x30));
+  x1=_mm_xor_si128(x1,_mm_cvtsi32_si128(crc));
+  buf+=64;
+  len-=64;
+  while(64<=len){
+    x5=_mm_clmulepi64_si128(x1,k1k2,0x00);
+    x6=_mm_clmulepi64_si128(x2,k1k2,0x00);
+    x7=_mm_clmulepi64_si128(x3,k1k2,0x00);
+    x8=_mm_clmulepi64_si128(x4,k1k2,0x00);
+    x1=_mm_clmulepi64_si128(x1,k1k2,0x11);
+    x2=_mm_clmulepi64_si128(x2,k1k2,0x11);
+    x3=_mm_clmulepi64_si128(x3,k1k2,0x11);
+    x4=_mm_clmulepi64_si128(x4,k1k2,0x11);
+    x1=_mm_xor_si128(_mm_xor_si128(x1,x5),_mm_loadu_si128((const __m128i*)(buf+0x00)));
+    x2=_mm_xor_si128(_mm_xor_si128(x2,x6),_mm_loadu_si128((const __m128i*)(buf+0x10)));
+    x3=_mm_xor_si128(_mm_xor_si128(x3,x7),_mm_loadu_si128((const __m128i*)(buf+0x20)));
+    x4=_mm_xor_si128(_mm_xor_si128(x4,x8),_mm_loadu_si128((const __m128i*)(buf+0x30)));
+    buf+=64;
+    len-=64;
+    }
+
+  // Fold 4 x 128 bits into 128 bits
+  x5=_mm_clmulepi64_si128(x1,k3k4,0x00);
+  x1=_mm_clmulepi64_si128(x1,k3k4,0x11);
+  x1=_mm_xor_si128(_mm_xor_si128(x1,x2),x5);
+  x5=_mm_clmulepi64_si128(x1,k3k4,0x00);
+  x1=_mm_clmulepi64_si128(x1,k3k4,0x11);
+  x1=_mm_xor_si128(_mm_xor_si128(x1,x3),x5);
+  x5=_mm_clmulepi64_si128(x1,k3k4,0x00);
+  x1=_mm_clmulepi64_si128(x1,k3k4,0x11);
+  x1=_mm_xor_si128(_mm_xor_si128(x1,x4),x5);
+
+  // Fold remaining 128 bits at a time
+  while(16<=len){
+    x5=_mm_clmulepi64_si128(x1,k3k4,0x00);
+    x1=_mm_clmulepi64_si128(x1,k3k4,0x11);
+    x1=_mm_xor_si128(_mm_xor_si128(x1,_mm_loadu_si128((const __m128i*)buf)),x5);
+    buf+=16;
+    len-=16;
+    }
+
+  // Fold 128 bits into 64 bits
+  x2=_mm_clmulepi64_si128(x1,k3k4,0x10);
+  x1=_mm_xor_si128(_mm_srli_si128(x1,8),x2);
+  x0=_mm_srli_si128(x1,4);
+  x1=_mm_and_si128(x1,mask);
+  x1=_mm_clmulepi64_si128(x1,k5k0,0x00);
+  x1=_mm_xor_si128(x1,x0);
+
+  // Barrett reduction to 32 bits
+  x2=_mm_and_si128(x1,mask);
+  x2=_mm_clmulepi64_si128(x2,poly,0x10);
+  x2=_mm_and_si128(x2,mask);
+  x2=_mm_clmulepi64_si128(x2,poly,0x00);
+  x1=_mm_xor_si128(x1,x2);
+  return _mm_extract_epi32(x1,1);
+  }
+
+
+// Calculate CRC32 using carry-less multiply, and slicing for the remainder
+static FXuint fastCRC(FXuint crc,const FXuchar* buf,FXival len){
+  FXival n=len&~15;
+  if(64<=n){
+    crc=clmulCRC(crc,buf,n);
+    buf+=n;
+    len-=n;
+    }
+  return softCRC(crc,buf,len);
+  }
+
+#endif
+
+
+// Pick fastest implementation available
+static CRCFunction implementation(){
+#if defined(CRC_INTRINSICS)
+  if((fxCPUFeatures()&(CPU_HAS_PCLMUL|CPU_HAS_SSE41))==(CPU_HAS_PCLMUL|CPU_HAS_SSE41)) return fastCRC;
+#endif
+  return softCRC;
+  }
+
+
+// Calculate CRC32 of a array of unsigned chars
+FXuint CRC(FXuint crc,const FXuchar *buf,FXival len){
+  static const CRCFunction function=implementation();
+  return function(crc,buf,len);
+  }
+
+
+// Return checksum of two pieces of data, given their checksums
+FXuint combine(FXuint crc1,FXuint crc2,FXulong len2){
+  return multModP(powModP(len2,CRC32POLY),crc1,CRC32POLY)^crc2;
+  }
+
 }
 
+/*******************************************************************************/
+
+namespace CRC32C {
 
+// Slicing tables for CRC32C
+static const CRCTables& tables(){
+  static const CRCTables crctables(CRC32CPOLY);
+  return crctables;
+  }
+
+
+// Calculate CRC32C using slicing tables
+static FXuint softCRC(FXuint crc,const FXuchar* buf,FXival len){
+  return sliceCRC(tables(),crc,buf,len);
+  }
+
+
+#if defined(CRC_INTRINSICS)
+
+// Calculate CRC32C using crc32 instruction; large buffers are done as three
+// interleaved lanes of LANESIZE bytes, to hide the latency of the instruction,
+// after which the lanes are combined
+__attribute__((target("sse4.2")))
+static FXuint fastCRC(FXuint crc,const FXuchar* buf,FXival len){
+#if defined(__x86_64__)
+  static const FXuint shift1=powModP(LANESIZE,CRC32CPOLY);
+  static const FXuint shift2=powModP(2*LANESIZE,CRC32CPOLY);
+  FXulong a,b,c,u,v,w;
+  const FXuchar* end;
+  while(3*LANESIZE<=len){
+    a=crc;
+    b=0;
+    c=0;
+    end=buf+LANESIZE;
+    do{
+      memcpy(&u,buf,8);
+      memcpy(&v,buf+LANESIZE,8);
+      memcpy(&w,buf+2*LANESIZE,8);
+      a=_mm_crc32_u64(a,u);
+      b=_mm_crc32_u64(b,v);
+      c=_mm_crc32_u64(c,w);
+      buf+=8;
+      }
+    while(buf<end);
+    crc=multModP(shift2,(FXuint)a,CRC32CPOLY)^multModP(shift1,(FXuint)b,CRC32CPOLY)^(FXuint)c;
+    buf+=2*LANESIZE;
+    len-=3*LANESIZE;
+    }
+  if(8<=len){
+    a=crc;
+    do{
+      memcpy(&u,buf,8);
+      a=_mm_crc32_u64(a,u);
+      buf+=8;
+      len-=8;
+      }
+    while(8<=len);
+    crc=(FXuint)a;
+    }
+#else
+  FXuint v;
+  while(4<=len){
+    memcpy(&v,buf,4);
+    crc=_mm_crc32_u32(crc,v);
+    buf+=4;
+    len-=4;
+    }
+#endif
+  while(0<len){
+    crc=_mm_crc32_u8(crc,*buf++);
+    --len;
+    }
+  return crc;
+  }
+
+#endif
+
+
+// Pick fastest implementation available
+static CRCFunction implementation(){
+#if defined(CRC_INTRINSICS)
+  if(fxCPUFeatures()&CPU_HAS_SSE42) return fastCRC;
+#endif
+  return softCRC;
+  }
+
+
+// Calculate CRC32C of a array of unsigned chars
+FXuint CRC(FXuint crc,const FXuchar *buf,FXival len){
+  static const CRCFunction function=implementation();
+  return function(crc,buf,len);
+  }
+
+
+// Return checksum of two pieces of data, given their checksums
+FXuint combine(FXuint crc1,FXuint crc2,FXulong len2){
+  return multModP(powModP(len2,CRC32CPOLY),crc1,CRC32CPOLY)^crc2;
+  }
+
+}
+
+}
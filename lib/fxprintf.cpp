@@ -68,10 +68,15 @@
     empty string if the number is 0; otherwise the number will be padded with zeros.
     When thousands grouping is used for integer conversions, don't pad with '0' and ','
     but use the equivalent number of spaces ' ' instead.
+    A negative precision passed as a parameter is taken as if no precision were given,
+    except for floating point conversions, where it prints the fewest digits which convert
+    back to the same number; so printf("%.*g",-1,0.1) prints 0.1, where "%.17g" prints
+    0.10000000000000001.
 
   - Interpretation of size parameters:
      'hh'       convert from FXchar.
-     'h'        convert from FXshort.
+     'h'        convert from FXshort (or FXfloat if real; only used when printing the
+                fewest digits, which are fewer for a float than for the same double).
      ''         convert from FXint (or FXfloat if real).
      'l'        convert from long (or FXdouble if real).
      'll'       convert from FXlong (64-bit number).
@@ -155,7 +160,9 @@ enum {
   FLG_UPPER    = 32,    // Use upper case
   FLG_UNSIGNED = 64,    // Unsigned
   FLG_THOUSAND = 128,   // Print comma's for thousands
-  FLG_DOTSEEN  = 256    // Dot was seen
+  FLG_DOTSEEN  = 256,   // Dot was seen
+  FLG_SHORTEST = 512,   // Fewest digits converting back to same number
+  FLG_SINGLE   = 1024   // Number was a float
   };
 
 
@@ -175,6 +182,19 @@ enum{MAXHEXDIGS=14};
 const FXchar lower_digits[]="0123456789abcdef";
 const FXchar upper_digits[]="0123456789ABCDEF";
 
+// Pairs of decimal digits 00...99
+const FXchar decimal_pairs[]=
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
 
 static FXdouble scalepos1[32] = {
   1.0E+18, 1.0E+19, 1.0E+20, 1.0E+21, 1.0E+22, 1.0E+23, 1.0E+24, 1.0E+25,
@@ -204,6 +224,8 @@ static FXdouble scaleneg2[10] = {
 // Declarations
 extern FXAPI FXint __snprintf(FXchar* string,FXint length,const FXchar* format,...);
 extern FXAPI FXint __vsnprintf(FXchar* string,FXint length,const FXchar* format,va_list args);
+extern FXAPI FXulong __dtodec(FXdouble value,FXint& exponent);
+extern FXAPI FXuint __ftodec(FXfloat value,FXint& exponent);
 
 /*******************************************************************************/
 
@@ -383,6 +405,40 @@ static FXchar* cvtdec(FXchar digits[],FXdouble value,FXint& decimal){
   }
 
 
+// Convert number to the fewest decimal digits which convert back to the same
+// double, or float; return pointer to the digits, and the value of the leading
+// digit, as well as the number of digits.
+static FXchar* cvtshortest(FXchar digits[],FXdouble value,FXint& decimal,FXint& count,FXint flags){
+  FXchar *ptr=digits+MAXDECDIGS+2;
+  FXulong mantissa;
+  FXint exponent;
+  if(flags&FLG_SINGLE){
+    mantissa=__ftodec((FXfloat)value,exponent);
+    }
+  else{
+    mantissa=__dtodec(value,exponent);
+    }
+  *--ptr='\0';
+  while(100<=mantissa){
+    ptr-=2;
+    ptr[0]=decimal_pairs[2*(mantissa%100)];
+    ptr[1]=decimal_pairs[2*(mantissa%100)+1];
+    mantissa/=100;
+    }
+  if(10<=mantissa){
+    ptr-=2;
+    ptr[0]=decimal_pairs[2*mantissa];
+    ptr[1]=decimal_pairs[2*mantissa+1];
+    }
+  else{
+    *--ptr=(FXchar)mantissa+'0';
+    }
+  count=(FXint)(digits+MAXDECDIGS+1-ptr);
+  decimal=exponent+count-1;
+  return ptr;
+  }
+
+
 // Round numeric string to given digit, adjusting the decimal
 // point if a carry-over happened.
 // If the entire number is truncated, return empty string.
@@ -428,13 +484,20 @@ static FXchar* fmtfrc(FXchar* buffer,FXint& len,FXdouble number,FXint precision,
   // Handle normal numbers first
   if(Math::fpFinite(number)){
     FXchar digits[MAXDECDIGS+2];
-    FXint  decimal;
+    FXint  decimal,count;
+    FXchar* p;
 
-    // Convert number to digits
-    FXchar* p=cvtdec(digits,number,decimal);
+    // Fewest digits; as many fraction digits as needed for them
+    if(flags&FLG_SHORTEST){
+      p=cvtshortest(digits,number,decimal,count,flags);
+      precision=Math::imax(count-decimal-1,0);
+      }
 
-    // Round the number (decimal may be negative)
-    p=rndig(p,decimal,precision+decimal+1);
+    // Convert number to digits, and round the number (decimal may be negative)
+    else{
+      p=cvtdec(digits,number,decimal);
+      p=rndig(p,decimal,precision+decimal+1);
+      }
 
     //fprintf(stderr,"number: % 30.20lE  decimal: %4d  precision: %2d  str: %s\n",number,decimal,precision,p);
 
@@ -576,10 +639,16 @@ static FXchar* fmtexp(FXchar* buffer,FXint& len,FXdouble number,FXint precision,
   // Handle normal numbers first
   if(Math::fpFinite(number)){
     FXchar digits[MAXDECDIGS+2];
-    FXint  decimal,extra;
+    FXint  decimal,extra,count;
+    FXchar* p;
 
-    // Convert number to digits
-    FXchar* p=cvtdec(digits,number,decimal);
+    // Fewest digits, or convert number to digits
+    if(flags&FLG_SHORTEST){
+      p=cvtshortest(digits,number,decimal,count,flags);
+      }
+    else{
+      p=cvtdec(digits,number,decimal);
+      }
 
     // In exponent mode, add one before decimal point; add up to
     // two more digits if engineering mode also in effect.
@@ -588,8 +657,15 @@ static FXchar* fmtexp(FXchar* buffer,FXint& len,FXdouble number,FXint precision,
       extra=(decimal+600)%3;
       }
 
+    // Fraction digits are the remaining ones
+    if(flags&FLG_SHORTEST){
+      precision=Math::imax(count-extra-1,0);
+      }
+
     // Round the number (extra before decimal point)
-    p=rndig(p,decimal,precision+extra+1);
+    else{
+      p=rndig(p,decimal,precision+extra+1);
+      }
 
     //fprintf(stderr,"number: % 30.20lE  decimal: %4d  precision: %2d  extra: %2d str: %s\n",number,decimal,precision,extra,p);
 
@@ -748,25 +824,37 @@ static FXchar* fmtgen(FXchar* buffer,FXint& len,FXdouble number,FXint precision,
   // Handle normal numbers first
   if(Math::fpFinite(number)){
     FXchar digits[MAXDECDIGS+2];
-    FXint  decimal,expo;
+    FXint  decimal,expo,count;
+    FXchar* p;
+
+    // Fewest digits, which have no trailing zeroes; switch to exponential mode
+    // at the same point as with the 17 digits always sufficient for a double
+    if(flags&FLG_SHORTEST){
+      p=cvtshortest(digits,number,decimal,count,flags);
+      expo=(17<=decimal) || (decimal<-4);
+      precision=count;
+      }
 
-    // Convert number to digits
-    FXchar* p=cvtdec(digits,number,decimal);
+    else{
 
-    //fprintf(stderr,"digits: %s  decimal: % 4d  number: % .20lG \n",p,decimal,number);
+      // Convert number to digits
+      p=cvtdec(digits,number,decimal);
 
-    // Round the number (no additional precision)
-    p=rndig(p,decimal,precision);
+      //fprintf(stderr,"digits: %s  decimal: % 4d  number: % .20lG \n",p,decimal,number);
 
-    //fprintf(stderr,"number: % 30.20lE  decimal: %4d  prec: %2d  precision: %2d str: %s\n",number,decimal,precision,precision,p);
+      // Round the number (no additional precision)
+      p=rndig(p,decimal,precision);
 
-    // Switch exponential mode
-    expo=(precision<=decimal) || (decimal<-4);
+      //fprintf(stderr,"number: % 30.20lE  decimal: %4d  prec: %2d  precision: %2d str: %s\n",number,decimal,precision,precision,p);
 
-    // Eliminate trailing zeroes; not done for alternate mode
-    if(!(flags&FLG_ALTER)){
-      if(precision>MAXDECDIGS) precision=MAXDECDIGS;
-      while(0<precision && p[precision-1]=='0') --precision;
+      // Switch exponential mode
+      expo=(precision<=decimal) || (decimal<-4);
+
+      // Eliminate trailing zeroes; not done for alternate mode
+      if(!(flags&FLG_ALTER)){
+        if(precision>MAXDECDIGS) precision=MAXDECDIGS;
+        while(0<precision && p[precision-1]=='0') --precision;
+        }
       }
 
     // Write sign
@@ -1473,6 +1561,7 @@ flg:  switch(ch){
             }
           if(flags&FLG_DOTSEEN){                        // After period: its precision
             precision=va_arg(ag,FXint);
+            if(precision<0) flags|=FLG_SHORTEST;        // Fewest digits for reals
             }
           else{                                         // Before period: its width
             width=va_arg(ag,FXint);
@@ -1670,6 +1759,7 @@ flg:  switch(ch){
         case 'f':                                       // Fractional notation
           if(0<pos) vadvance(ag,args,format,pos);       // Advance ag to position
           number=va_arg(ag,FXdouble);
+          if(modifier==ARG_HALF) flags|=FLG_SINGLE;
           if(precision<0) precision=6;
           if(precision>MAXPRECISION) precision=MAXPRECISION;
           str=fmtfrc(buffer,len,number,precision,flags);
@@ -1679,6 +1769,7 @@ flg:  switch(ch){
         case 'e':                                       // Exponential notation
           if(0<pos) vadvance(ag,args,format,pos);       // Advance ag to position
           number=va_arg(ag,FXdouble);
+          if(modifier==ARG_HALF) flags|=FLG_SINGLE;
           if(precision<0) precision=6;
           if(precision>MAXPRECISION) precision=MAXPRECISION;
           str=fmtexp(buffer,len,number,precision,flags);
@@ -1688,6 +1779,7 @@ flg:  switch(ch){
         case 'g':                                       // General notation
           if(0<pos) vadvance(ag,args,format,pos);       // Advance ag to position
           number=va_arg(ag,FXdouble);
+          if(modifier==ARG_HALF) flags|=FLG_SINGLE;
           if(precision<0) precision=6;
           if(precision<1) precision=1;
           if(precision>MAXPRECISION) precision=MAXPRECISION;
@@ -594,6 +594,72 @@ const unsigned char bignethood[]={
   0x00,0x3b
   };
 
+const unsigned char bookclr_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf5,0x00,0x00,0xff,0x66,0x44,
+  0xfc,0x62,0x40,0xfd,0x78,0x56,0xfe,0x5b,0x39,0xfe,0x60,0x3e,0xff,0x6e,0x4c,0xff,
+  0x80,0x5e,0xfe,0x87,0x65,0xfe,0x85,0x63,0xff,0x99,0x77,0xff,0xaa,0x88,0xf8,0x68,
+  0x46,0xff,0x55,0x33,0xff,0x5f,0x3d,0xff,0x91,0x6f,0xff,0xa0,0x7e,0xcc,0x22,0x00,
+  0xf7,0x5c,0x3a,0xf7,0x72,0x50,0xf6,0x59,0x37,0xf3,0x56,0x34,0xf6,0x67,0x45,0xfa,
+  0x88,0x66,0xd4,0x36,0x14,0xf6,0x7b,0x59,0xd9,0x2f,0x0d,0xde,0x52,0x30,0xf2,0x77,
+  0x55,0xe6,0x3c,0x1a,0xe6,0x66,0x44,0xea,0x63,0x41,0xf2,0x48,0x26,0xdf,0x46,0x24,
+  0xf3,0x86,0x64,0xe9,0x42,0x20,0xe1,0x3d,0x1b,0xdb,0x37,0x15,0xdb,0x38,0x16,0xd2,
+  0x49,0x23,0xdd,0x76,0x52,0xab,0x55,0x27,0xd4,0x2c,0x0a,0xcc,0x99,0x66,0xe6,0xbf,
+  0x99,0x99,0x66,0x33,0xcf,0x26,0x04,0xc6,0x93,0x60,0xea,0xc5,0xa1,0xbd,0x8a,0x57,
+  0xef,0xce,0xac,0xb2,0x80,0x4d,0xf6,0xd7,0xb9,0xa8,0x75,0x42,0xfb,0xdf,0xc4,0x9f,
+  0x6c,0x39,0xff,0xe5,0xcc,0x00,0xff,0xff,0x18,0x6a,0xb5,0x97,0xe5,0xff,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x38,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x06,
+  0x8f,0x40,0x1c,0x60,0x48,0x2c,0xe2,0x8e,0xc8,0x80,0x60,0x40,0x28,0x18,0x0e,0x08,
+  0x41,0x00,0x89,0x5c,0x28,0x18,0x0d,0xa7,0xe3,0xa1,0x80,0x44,0xbe,0x5f,0x9c,0xe4,
+  0x9a,0x35,0x6c,0xbb,0x13,0x4a,0xc5,0x72,0xc1,0x61,0xc8,0x5a,0x6e,0x06,0x60,0x48,
+  0x28,0x34,0xb8,0x0d,0xdc,0xcc,0xe5,0xd0,0xed,0x1d,0x38,0x1e,0x7b,0x67,0x1f,0x7f,
+  0x0a,0x81,0x20,0x21,0x22,0x23,0x24,0x25,0x39,0x39,0x21,0x0c,0x00,0x90,0x77,0x38,
+  0x26,0x27,0x28,0x29,0x29,0x39,0x3a,0x90,0x0c,0x90,0x9e,0x6d,0x2a,0x2b,0x2c,0x47,
+  0xa1,0x90,0x9d,0x90,0x2d,0x38,0x2e,0x2f,0xa6,0xa7,0xaa,0x9e,0x39,0x10,0x10,0x38,
+  0x30,0x31,0xb0,0xb1,0xb3,0x54,0x32,0x33,0xba,0xa8,0xbc,0x47,0x34,0x35,0xb0,0xa8,
+  0xc7,0x47,0x36,0x37,0xc6,0xbc,0xa8,0x47,0x2c,0xd0,0x48,0x90,0xd2,0x39,0x47,0x41,
+  0x00,0x3b
+  };
+
+const unsigned char bookdel_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf6,0x00,0x00,0xff,0x66,0x44,
+  0xfc,0x62,0x40,0xfd,0x78,0x56,0xfe,0x5b,0x39,0xfe,0x60,0x3e,0xff,0x6e,0x4c,0xff,
+  0x80,0x5e,0xfe,0x87,0x65,0xfe,0x85,0x63,0xff,0x99,0x77,0xff,0xaa,0x88,0xf8,0x68,
+  0x46,0xff,0x55,0x33,0xff,0x5f,0x3d,0xff,0x91,0x6f,0xff,0xa0,0x7e,0xcc,0x22,0x00,
+  0xf7,0x5c,0x3a,0xf7,0x72,0x50,0xf6,0x59,0x37,0xf3,0x56,0x34,0xf6,0x67,0x45,0xfa,
+  0x88,0x66,0xd4,0x36,0x14,0xf6,0x7b,0x59,0xd9,0x2f,0x0d,0xde,0x52,0x30,0xf2,0x77,
+  0x55,0xe6,0x3c,0x1a,0xe6,0x66,0x44,0xea,0x63,0x41,0xf2,0x48,0x26,0xdf,0x46,0x24,
+  0xf3,0x86,0x64,0xe9,0x42,0x20,0xe1,0x3d,0x1b,0xdb,0x37,0x15,0xdb,0x38,0x16,0xe1,
+  0x47,0x25,0xe9,0x62,0x40,0xd2,0x49,0x23,0xdd,0x76,0x52,0xab,0x55,0x27,0xd4,0x2c,
+  0x0a,0xcc,0x99,0x66,0xe6,0xbf,0x99,0x99,0x66,0x33,0xcf,0x26,0x04,0xe2,0x38,0x16,
+  0xf2,0x55,0x33,0xf2,0x7a,0x58,0xe2,0x5a,0x38,0xc6,0x93,0x60,0xea,0xc5,0xa1,0xbd,
+  0x8a,0x57,0xef,0xce,0xac,0xb2,0x80,0x4d,0xf6,0xd7,0xb9,0xa8,0x75,0x42,0xfb,0xdf,
+  0xc4,0x9f,0x6c,0x39,0xff,0xe5,0xcc,0x00,0xff,0xff,0xb6,0x00,0x00,0xff,0x86,0x86,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x3e,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x07,
+  0x98,0x80,0x3e,0x00,0x83,0x84,0x85,0x3e,0x87,0x88,0x01,0x02,0x03,0x04,0x05,0x06,
+  0x07,0x08,0x02,0x01,0x88,0x88,0x0b,0x0a,0x0c,0x0d,0x8e,0x0e,0x0f,0x0a,0x10,0x11,
+  0x9f,0x9f,0x3e,0x12,0x97,0x99,0x06,0x9b,0x9d,0x13,0x14,0x15,0x16,0x17,0x3e,0x18,
+  0xa4,0x9a,0x9c,0x19,0x00,0x06,0x09,0x0a,0x1a,0x3e,0x1b,0xb0,0xa6,0x9c,0x1c,0xb4,
+  0xb6,0x1d,0x3e,0x1e,0xbb,0xa7,0x1f,0xbf,0x0a,0xc1,0x20,0x21,0x22,0x23,0x24,0x25,
+  0x26,0x27,0x21,0x0c,0xc7,0xb8,0x28,0x29,0x2a,0x2b,0xd9,0xda,0xd3,0xb5,0x0a,0xad,
+  0x2c,0x2d,0x2e,0x94,0x3e,0x2f,0x30,0x31,0x06,0x32,0x33,0x2f,0x3e,0x34,0x35,0xe2,
+  0x94,0x10,0xf1,0xf2,0x10,0x3e,0x36,0x37,0xef,0xe3,0xf9,0x38,0x39,0xef,0x3f,0xfe,
+  0xff,0xfe,0x10,0xe9,0xd8,0xd1,0x0f,0x88,0xc1,0x83,0x3f,0x10,0xf1,0xe8,0xd1,0x0f,
+  0xe0,0x3f,0x44,0x2e,0x22,0xe6,0xcb,0x17,0x08,0x00,0x3b
+  };
+
 const unsigned char bookmrk_gif[]={
   0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf7,0x00,0x00,0xff,0xff,0xff,
   0xff,0x66,0x44,0xfc,0x62,0x40,0xfd,0x78,0x56,0xfe,0x5b,0x39,0xfe,0x60,0x3e,0xff,
@@ -658,33 +724,6 @@ const unsigned char bookmrk_gif[]={
   0x00,0x3b
   };
 
-const unsigned char bookclr_gif[]={
-  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf5,0x00,0x00,0xff,0x66,0x44,
-  0xfc,0x62,0x40,0xfd,0x78,0x56,0xfe,0x5b,0x39,0xfe,0x60,0x3e,0xff,0x6e,0x4c,0xff,
-  0x80,0x5e,0xfe,0x87,0x65,0xfe,0x85,0x63,0xff,0x99,0x77,0xff,0xaa,0x88,0xf8,0x68,
-  0x46,0xff,0x55,0x33,0xff,0x5f,0x3d,0xff,0x91,0x6f,0xff,0xa0,0x7e,0xcc,0x22,0x00,
-  0xf7,0x5c,0x3a,0xf7,0x72,0x50,0xf6,0x59,0x37,0xf3,0x56,0x34,0xf6,0x67,0x45,0xfa,
-  0x88,0x66,0xd4,0x36,0x14,0xf6,0x7b,0x59,0xd9,0x2f,0x0d,0xde,0x52,0x30,0xf2,0x77,
-  0x55,0xe6,0x3c,0x1a,0xe6,0x66,0x44,0xea,0x63,0x41,0xf2,0x48,0x26,0xdf,0x46,0x24,
-  0xf3,0x86,0x64,0xe9,0x42,0x20,0xe1,0x3d,0x1b,0xdb,0x37,0x15,0xdb,0x38,0x16,0xd2,
-  0x49,0x23,0xdd,0x76,0x52,0xab,0x55,0x27,0xd4,0x2c,0x0a,0xcc,0x99,0x66,0xe6,0xbf,
-  0x99,0x99,0x66,0x33,0xcf,0x26,0x04,0xc6,0x93,0x60,0xea,0xc5,0xa1,0xbd,0x8a,0x57,
-  0xef,0xce,0xac,0xb2,0x80,0x4d,0xf6,0xd7,0xb9,0xa8,0x75,0x42,0xfb,0xdf,0xc4,0x9f,
-  0x6c,0x39,0xff,0xe5,0xcc,0x00,0xff,0xff,0x18,0x6a,0xb5,0x97,0xe5,0xff,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
-  0x01,0x00,0x00,0x38,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x06,
-  0x8f,0x40,0x1c,0x60,0x48,0x2c,0xe2,0x8e,0xc8,0x80,0x60,0x40,0x28,0x18,0x0e,0x08,
-  0x41,0x00,0x89,0x5c,0x28,0x18,0x0d,0xa7,0xe3,0xa1,0x80,0x44,0xbe,0x5f,0x9c,0xe4,
-  0x9a,0x35,0x6c,0xbb,0x13,0x4a,0xc5,0x72,0xc1,0x61,0xc8,0x5a,0x6e,0x06,0x60,0x48,
-  0x28,0x34,0xb8,0x0d,0xdc,0xcc,0xe5,0xd0,0xed,0x1d,0x38,0x1e,0x7b,0x67,0x1f,0x7f,
-  0x0a,0x81,0x20,0x21,0x22,0x23,0x24,0x25,0x39,0x39,0x21,0x0c,0x00,0x90,0x77,0x38,
-  0x26,0x27,0x28,0x29,0x29,0x39,0x3a,0x90,0x0c,0x90,0x9e,0x6d,0x2a,0x2b,0x2c,0x47,
-  0xa1,0x90,0x9d,0x90,0x2d,0x38,0x2e,0x2f,0xa6,0xa7,0xaa,0x9e,0x39,0x10,0x10,0x38,
-  0x30,0x31,0xb0,0xb1,0xb3,0x54,0x32,0x33,0xba,0xa8,0xbc,0x47,0x34,0x35,0xb0,0xa8,
-  0xc7,0x47,0x36,0x37,0xc6,0xbc,0xa8,0x47,0x2c,0xd0,0x48,0x90,0xd2,0x39,0x47,0x41,
-  0x00,0x3b
-  };
-
 const unsigned char bookset_gif[]={
   0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf5,0x00,0x00,0xff,0x66,0x44,
   0xfc,0x62,0x40,0xfd,0x78,0x56,0xfe,0x5b,0x39,0xfe,0x60,0x3e,0xff,0x6e,0x4c,0xff,
@@ -712,45 +751,6 @@ const unsigned char bookset_gif[]={
   0xcb,0x54,0x41,0x00,0x3b
   };
 
-const unsigned char bookdel_gif[]={
-  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf6,0x00,0x00,0xff,0x66,0x44,
-  0xfc,0x62,0x40,0xfd,0x78,0x56,0xfe,0x5b,0x39,0xfe,0x60,0x3e,0xff,0x6e,0x4c,0xff,
-  0x80,0x5e,0xfe,0x87,0x65,0xfe,0x85,0x63,0xff,0x99,0x77,0xff,0xaa,0x88,0xf8,0x68,
-  0x46,0xff,0x55,0x33,0xff,0x5f,0x3d,0xff,0x91,0x6f,0xff,0xa0,0x7e,0xcc,0x22,0x00,
-  0xf7,0x5c,0x3a,0xf7,0x72,0x50,0xf6,0x59,0x37,0xf3,0x56,0x34,0xf6,0x67,0x45,0xfa,
-  0x88,0x66,0xd4,0x36,0x14,0xf6,0x7b,0x59,0xd9,0x2f,0x0d,0xde,0x52,0x30,0xf2,0x77,
-  0x55,0xe6,0x3c,0x1a,0xe6,0x66,0x44,0xea,0x63,0x41,0xf2,0x48,0x26,0xdf,0x46,0x24,
-  0xf3,0x86,0x64,0xe9,0x42,0x20,0xe1,0x3d,0x1b,0xdb,0x37,0x15,0xdb,0x38,0x16,0xe1,
-  0x47,0x25,0xe9,0x62,0x40,0xd2,0x49,0x23,0xdd,0x76,0x52,0xab,0x55,0x27,0xd4,0x2c,
-  0x0a,0xcc,0x99,0x66,0xe6,0xbf,0x99,0x99,0x66,0x33,0xcf,0x26,0x04,0xe2,0x38,0x16,
-  0xf2,0x55,0x33,0xf2,0x7a,0x58,0xe2,0x5a,0x38,0xc6,0x93,0x60,0xea,0xc5,0xa1,0xbd,
-  0x8a,0x57,0xef,0xce,0xac,0xb2,0x80,0x4d,0xf6,0xd7,0xb9,0xa8,0x75,0x42,0xfb,0xdf,
-  0xc4,0x9f,0x6c,0x39,0xff,0xe5,0xcc,0x00,0xff,0xff,0xb6,0x00,0x00,0xff,0x86,0x86,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
-  0x01,0x00,0x00,0x3e,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x07,
-  0x98,0x80,0x3e,0x00,0x83,0x84,0x85,0x3e,0x87,0x88,0x01,0x02,0x03,0x04,0x05,0x06,
-  0x07,0x08,0x02,0x01,0x88,0x88,0x0b,0x0a,0x0c,0x0d,0x8e,0x0e,0x0f,0x0a,0x10,0x11,
-  0x9f,0x9f,0x3e,0x12,0x97,0x99,0x06,0x9b,0x9d,0x13,0x14,0x15,0x16,0x17,0x3e,0x18,
-  0xa4,0x9a,0x9c,0x19,0x00,0x06,0x09,0x0a,0x1a,0x3e,0x1b,0xb0,0xa6,0x9c,0x1c,0xb4,
-  0xb6,0x1d,0x3e,0x1e,0xbb,0xa7,0x1f,0xbf,0x0a,0xc1,0x20,0x21,0x22,0x23,0x24,0x25,
-  0x26,0x27,0x21,0x0c,0xc7,0xb8,0x28,0x29,0x2a,0x2b,0xd9,0xda,0xd3,0xb5,0x0a,0xad,
-  0x2c,0x2d,0x2e,0x94,0x3e,0x2f,0x30,0x31,0x06,0x32,0x33,0x2f,0x3e,0x34,0x35,0xe2,
-  0x94,0x10,0xf1,0xf2,0x10,0x3e,0x36,0x37,0xef,0xe3,0xf9,0x38,0x39,0xef,0x3f,0xfe,
-  0xff,0xfe,0x10,0xe9,0xd8,0xd1,0x0f,0x88,0xc1,0x83,0x3f,0x10,0xf1,0xe8,0xd1,0x0f,
-  0xe0,0x3f,0x44,0x2e,0x22,0xe6,0xcb,0x17,0x08,0x00,0x3b
-  };
-
 const unsigned char clearentry[]={
   0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xc6,0x00,0x00,0xff,0xff,0xff,
   0xe7,0xe8,0xe7,0x65,0x65,0x64,0x3d,0x3e,0x3b,0x72,0x74,0x72,0xd9,0xda,0xd9,0x44,
@@ -2207,6 +2207,31 @@ const unsigned char questionicon[]={
   0xae,0x0b,0x98,0xb2,0xb5,0xb6,0xaa,0x09,0x00,0x3b
   };
 
+const unsigned char redo_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf5,0x00,0x00,0x00,0xff,0xff,
+  0x55,0xbb,0x55,0x52,0xb8,0x52,0x65,0xcb,0x65,0x78,0xde,0x78,0x88,0xee,0x88,0x4e,
+  0xb4,0x4e,0x6a,0xd0,0x6a,0x85,0xeb,0x85,0x49,0xaf,0x49,0x5c,0xc2,0x5c,0x80,0xe6,
+  0x80,0x61,0xc7,0x61,0x4b,0xb1,0x4b,0x43,0xa9,0x43,0x6b,0xd1,0x6b,0x7b,0xe1,0x7b,
+  0x5b,0xc1,0x5b,0x3d,0xa3,0x3d,0x75,0xdb,0x75,0x36,0x9c,0x36,0x6f,0xd4,0x6f,0x74,
+  0xd9,0x74,0x30,0x96,0x30,0x58,0xbe,0x58,0x73,0xd9,0x73,0x57,0xbd,0x57,0x29,0x8f,
+  0x29,0x68,0xce,0x68,0x7e,0xe4,0x7e,0x2b,0x91,0x2b,0x62,0xc8,0x62,0x23,0x89,0x23,
+  0x41,0xa7,0x41,0x7a,0xe0,0x7a,0x5d,0xc3,0x5d,0x1d,0x83,0x1d,0x32,0x98,0x32,0x47,
+  0xad,0x47,0x18,0x7e,0x18,0x46,0xac,0x46,0x14,0x7a,0x14,0x45,0xab,0x45,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x06,
+  0x7d,0x40,0x80,0x70,0x48,0x2c,0x16,0x03,0xc8,0xa4,0x32,0x40,0x14,0x0c,0x08,0x85,
+  0xa8,0x34,0x2a,0x18,0x1a,0x0e,0x88,0xac,0x76,0x6b,0x10,0x26,0x14,0x8b,0x05,0xa3,
+  0x91,0x28,0x9b,0xcb,0x42,0xc7,0x03,0x12,0x71,0x38,0x8c,0x44,0xc9,0x64,0x22,0x91,
+  0xc4,0x8d,0x94,0x8a,0x85,0x42,0x21,0xf2,0x8b,0x17,0x18,0x19,0x1a,0x17,0x17,0x43,
+  0x17,0x05,0x86,0x43,0x1b,0x12,0x1c,0x1d,0x11,0x1e,0x1b,0x92,0x1b,0x1f,0x05,0x1b,
+  0x43,0x20,0x20,0x21,0x03,0x22,0x53,0x05,0x23,0x23,0x05,0x20,0x43,0x24,0x24,0x25,
+  0x26,0x18,0xa9,0xaa,0x18,0x09,0x24,0x44,0x27,0xb0,0xb1,0x27,0x29,0x01,0x28,0x29,
+  0x70,0x45,0x29,0x2a,0xb7,0xb8,0x44,0x29,0xbc,0xbd,0x43,0xc0,0x42,0x41,0x00,0x3b
+  };
+
 const unsigned char rgbmode[]={
   0x47,0x49,0x46,0x38,0x39,0x61,0x28,0x00,0x14,0x00,0xf7,0x00,0x00,0xb2,0xc0,0xdc,
   0x08,0x00,0x00,0x10,0x00,0x00,0x18,0x00,0x00,0x20,0x00,0x00,0x28,0x00,0x00,0x30,
@@ -2390,31 +2415,6 @@ const unsigned char sorting[]={
   0xff,0xff,0xff,0xff,0xff,0xff
   };
 
-const unsigned char redo_gif[]={
-  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf5,0x00,0x00,0x00,0xff,0xff,
-  0x55,0xbb,0x55,0x52,0xb8,0x52,0x65,0xcb,0x65,0x78,0xde,0x78,0x88,0xee,0x88,0x4e,
-  0xb4,0x4e,0x6a,0xd0,0x6a,0x85,0xeb,0x85,0x49,0xaf,0x49,0x5c,0xc2,0x5c,0x80,0xe6,
-  0x80,0x61,0xc7,0x61,0x4b,0xb1,0x4b,0x43,0xa9,0x43,0x6b,0xd1,0x6b,0x7b,0xe1,0x7b,
-  0x5b,0xc1,0x5b,0x3d,0xa3,0x3d,0x75,0xdb,0x75,0x36,0x9c,0x36,0x6f,0xd4,0x6f,0x74,
-  0xd9,0x74,0x30,0x96,0x30,0x58,0xbe,0x58,0x73,0xd9,0x73,0x57,0xbd,0x57,0x29,0x8f,
-  0x29,0x68,0xce,0x68,0x7e,0xe4,0x7e,0x2b,0x91,0x2b,0x62,0xc8,0x62,0x23,0x89,0x23,
-  0x41,0xa7,0x41,0x7a,0xe0,0x7a,0x5d,0xc3,0x5d,0x1d,0x83,0x1d,0x32,0x98,0x32,0x47,
-  0xad,0x47,0x18,0x7e,0x18,0x46,0xac,0x46,0x14,0x7a,0x14,0x45,0xab,0x45,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
-  0x01,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x06,
-  0x7d,0x40,0x80,0x70,0x48,0x2c,0x16,0x03,0xc8,0xa4,0x32,0x40,0x14,0x0c,0x08,0x85,
-  0xa8,0x34,0x2a,0x18,0x1a,0x0e,0x88,0xac,0x76,0x6b,0x10,0x26,0x14,0x8b,0x05,0xa3,
-  0x91,0x28,0x9b,0xcb,0x42,0xc7,0x03,0x12,0x71,0x38,0x8c,0x44,0xc9,0x64,0x22,0x91,
-  0xc4,0x8d,0x94,0x8a,0x85,0x42,0x21,0xf2,0x8b,0x17,0x18,0x19,0x1a,0x17,0x17,0x43,
-  0x17,0x05,0x86,0x43,0x1b,0x12,0x1c,0x1d,0x11,0x1e,0x1b,0x92,0x1b,0x1f,0x05,0x1b,
-  0x43,0x20,0x20,0x21,0x03,0x22,0x53,0x05,0x23,0x23,0x05,0x20,0x43,0x24,0x24,0x25,
-  0x26,0x18,0xa9,0xaa,0x18,0x09,0x24,0x44,0x27,0xb0,0xb1,0x27,0x29,0x01,0x28,0x29,
-  0x70,0x45,0x29,0x2a,0xb7,0xb8,0x44,0x29,0xbc,0xbd,0x43,0xc0,0x42,0x41,0x00,0x3b
-  };
-
 const unsigned char undo_gif[]={
   0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf5,0x00,0x00,0xff,0xff,0xff,
   0x55,0xbb,0x55,0x52,0xb8,0x52,0x88,0xee,0x88,0x78,0xde,0x78,0x65,0xcb,0x65,0x4e,
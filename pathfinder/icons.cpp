@@ -0,0 +1,2128 @@
+/*********** Generated on 2026/10/18 22:46:56 by reswrap version 6.0.0 *********/
+
+#include "icons.h"
+
+/* Created by reswrap from file bigicons.bmp */
+const unsigned char bigicons[]={
+  0x42,0x4d,0xc6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x01,0x00,0x04,0x00,0x00,0x00,
+  0x00,0x00,0x80,0x00,0x00,0x00,0x6d,0x0b,0x00,0x00,0x6d,0x0b,0x00,0x00,0x04,0x00,
+  0x00,0x00,0x04,0x00,0x00,0x00,0xdc,0xc0,0xb2,0x00,0x7f,0x00,0x00,0x00,0xff,0xff,
+  0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x03,0x33,0x33,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x11,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x21,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x12,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x11,0x00,0x03,0x33,
+  0x33,0x30,0x00,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,
+  0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x12,
+  0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x11,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00
+  };
+
+/* Created by reswrap from file blocks_gif.gif */
+const unsigned char blocks_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf6,0x00,0x00,0x01,0x89,0xc3,
+  0x01,0x84,0xbf,0x36,0xb2,0xe7,0x54,0xcb,0xfe,0x01,0x7e,0xb9,0x41,0xb8,0xeb,0x33,
+  0xaa,0xdd,0x01,0x76,0xb1,0x3d,0xb4,0xe7,0x30,0xa7,0xda,0x01,0x6e,0xa9,0x38,0xae,
+  0xe1,0x2c,0xa3,0xd6,0x01,0x65,0xa1,0x32,0xa9,0xdc,0x27,0x9e,0xd1,0xbe,0x00,0x00,
+  0x5a,0x30,0x50,0x2d,0xa4,0xd7,0x01,0x5a,0x97,0xba,0x00,0x00,0xe6,0x4b,0x4c,0xfe,
+  0x75,0x76,0xa3,0x62,0x79,0x55,0x50,0x7b,0x28,0x45,0x59,0x19,0x5d,0x59,0x2b,0x74,
+  0x3f,0x54,0xa9,0x00,0xb4,0x00,0x00,0xf2,0x35,0x46,0xe9,0x00,0x20,0x82,0x52,0x00,
+  0x88,0xcc,0x44,0xa9,0xed,0x65,0x89,0xd3,0x41,0x50,0xa4,0x00,0xae,0x00,0x00,0xec,
+  0x2d,0x3e,0xe3,0x00,0x1c,0x7c,0x4e,0x00,0x86,0xca,0x42,0x95,0xd9,0x51,0x4a,0x9c,
+  0x00,0xa6,0x00,0x00,0xe4,0x25,0x36,0xdb,0x00,0x19,0x75,0x4a,0x00,0x82,0xc6,0x3e,
+  0x91,0xd5,0x4d,0x44,0x94,0x00,0x9e,0x00,0x00,0xde,0x1c,0x2d,0xd5,0x00,0x15,0x6d,
+  0x46,0x00,0x7f,0xc3,0x3b,0x8c,0xcf,0x48,0x3c,0x8b,0x00,0x95,0x00,0x00,0xdc,0x1e,
+  0x2f,0xd8,0x13,0x25,0x65,0x41,0x00,0x7b,0xbf,0x37,0x34,0x81,0x00,0x7e,0x00,0x00,
+  0x7a,0x00,0x00,0x53,0x3b,0x00,0x79,0xbd,0x35,0x87,0xcb,0x43,0x2b,0x75,0x00,0x14,
+  0x59,0x00,0x10,0x55,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x48,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x07,
+  0xa4,0x80,0x48,0x82,0x48,0x00,0x85,0x86,0x00,0x83,0x89,0x82,0x01,0x02,0x03,0x8e,
+  0x02,0x01,0x8a,0x89,0x04,0x05,0x06,0x96,0x05,0x04,0x92,0x83,0x07,0x08,0x09,0x9e,
+  0x08,0x07,0x9a,0x82,0x0a,0x0b,0x0c,0xa6,0x0b,0x0a,0xa2,0x48,0x0d,0x0e,0x0f,0xae,
+  0x0e,0x0d,0x8a,0x10,0xb3,0x10,0x11,0x0e,0x12,0xb8,0x0e,0x13,0x8a,0x14,0x15,0x16,
+  0x16,0x17,0x18,0x18,0x19,0x1a,0x1a,0x1b,0x1c,0xc8,0x1c,0x48,0x1d,0x1e,0x1f,0xce,
+  0xce,0x20,0x21,0x22,0xd3,0x22,0x23,0x24,0x48,0x25,0x26,0x27,0xdb,0xdb,0x28,0x29,
+  0x2a,0x29,0xe1,0x2a,0x2b,0x48,0x2c,0x2d,0x2e,0xe8,0xe8,0x2f,0x30,0x31,0x30,0xee,
+  0x31,0x32,0x48,0x33,0x34,0x35,0xf5,0xf5,0x36,0x37,0x38,0x37,0xfb,0x38,0x39,0x48,
+  0x3a,0x3b,0x78,0x08,0x14,0xd8,0xc3,0x47,0x0a,0x1f,0x08,0x53,0xfc,0x40,0x02,0x24,
+  0x88,0xc3,0x87,0x42,0x86,0x10,0x71,0x07,0x83,0x48,0x11,0x51,0x46,0x8e,0x68,0xdc,
+  0x68,0x44,0x95,0xa8,0x40,0x00,0x3b
+  };
+
+/* Created by reswrap from file bookdel_gif.gif */
+const unsigned char bookdel_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf6,0x00,0x00,0xff,0x66,0x44,
+  0xfc,0x62,0x40,0xfd,0x78,0x56,0xfe,0x5b,0x39,0xfe,0x60,0x3e,0xff,0x6e,0x4c,0xff,
+  0x80,0x5e,0xfe,0x87,0x65,0xfe,0x85,0x63,0xff,0x99,0x77,0xff,0xaa,0x88,0xf8,0x68,
+  0x46,0xff,0x55,0x33,0xff,0x5f,0x3d,0xff,0x91,0x6f,0xff,0xa0,0x7e,0xcc,0x22,0x00,
+  0xf7,0x5c,0x3a,0xf7,0x72,0x50,0xf6,0x59,0x37,0xf3,0x56,0x34,0xf6,0x67,0x45,0xfa,
+  0x88,0x66,0xd4,0x36,0x14,0xf6,0x7b,0x59,0xd9,0x2f,0x0d,0xde,0x52,0x30,0xf2,0x77,
+  0x55,0xe6,0x3c,0x1a,0xe6,0x66,0x44,0xea,0x63,0x41,0xf2,0x48,0x26,0xdf,0x46,0x24,
+  0xf3,0x86,0x64,0xe9,0x42,0x20,0xe1,0x3d,0x1b,0xdb,0x37,0x15,0xdb,0x38,0x16,0xe1,
+  0x47,0x25,0xe9,0x62,0x40,0xd2,0x49,0x23,0xdd,0x76,0x52,0xab,0x55,0x27,0xd4,0x2c,
+  0x0a,0xcc,0x99,0x66,0xe6,0xbf,0x99,0x99,0x66,0x33,0xcf,0x26,0x04,0xe2,0x38,0x16,
+  0xf2,0x55,0x33,0xf2,0x7a,0x58,0xe2,0x5a,0x38,0xc6,0x93,0x60,0xea,0xc5,0xa1,0xbd,
+  0x8a,0x57,0xef,0xce,0xac,0xb2,0x80,0x4d,0xf6,0xd7,0xb9,0xa8,0x75,0x42,0xfb,0xdf,
+  0xc4,0x9f,0x6c,0x39,0xff,0xe5,0xcc,0x00,0xff,0xff,0xb6,0x00,0x00,0xff,0x86,0x86,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x3e,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x07,
+  0x98,0x80,0x3e,0x00,0x83,0x84,0x85,0x3e,0x87,0x88,0x01,0x02,0x03,0x04,0x05,0x06,
+  0x07,0x08,0x02,0x01,0x88,0x88,0x0b,0x0a,0x0c,0x0d,0x8e,0x0e,0x0f,0x0a,0x10,0x11,
+  0x9f,0x9f,0x3e,0x12,0x97,0x99,0x06,0x9b,0x9d,0x13,0x14,0x15,0x16,0x17,0x3e,0x18,
+  0xa4,0x9a,0x9c,0x19,0x00,0x06,0x09,0x0a,0x1a,0x3e,0x1b,0xb0,0xa6,0x9c,0x1c,0xb4,
+  0xb6,0x1d,0x3e,0x1e,0xbb,0xa7,0x1f,0xbf,0x0a,0xc1,0x20,0x21,0x22,0x23,0x24,0x25,
+  0x26,0x27,0x21,0x0c,0xc7,0xb8,0x28,0x29,0x2a,0x2b,0xd9,0xda,0xd3,0xb5,0x0a,0xad,
+  0x2c,0x2d,0x2e,0x94,0x3e,0x2f,0x30,0x31,0x06,0x32,0x33,0x2f,0x3e,0x34,0x35,0xe2,
+  0x94,0x10,0xf1,0xf2,0x10,0x3e,0x36,0x37,0xef,0xe3,0xf9,0x38,0x39,0xef,0x3f,0xfe,
+  0xff,0xfe,0x10,0xe9,0xd8,0xd1,0x0f,0x88,0xc1,0x83,0x3f,0x10,0xf1,0xe8,0xd1,0x0f,
+  0xe0,0x3f,0x44,0x2e,0x22,0xe6,0xcb,0x17,0x08,0x00,0x3b
+  };
+
+/* Created by reswrap from file booknxt_gif.gif */
+const unsigned char booknxt_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf5,0x00,0x00,0xff,0x66,0x44,
+  0xfc,0x62,0x40,0xfd,0x78,0x56,0xfe,0x5b,0x39,0xfe,0x60,0x3e,0xff,0x6e,0x4c,0xff,
+  0x80,0x5e,0xfe,0x87,0x65,0xfe,0x85,0x63,0xff,0x99,0x77,0xff,0xaa,0x88,0xf8,0x68,
+  0x46,0xff,0x55,0x33,0xff,0x5f,0x3d,0xff,0x91,0x6f,0xff,0xa0,0x7e,0xcc,0x22,0x00,
+  0xf7,0x5c,0x3a,0xf7,0x72,0x50,0xf6,0x59,0x37,0xf3,0x56,0x34,0xf6,0x67,0x45,0xfa,
+  0x88,0x66,0xd4,0x36,0x14,0xf6,0x7b,0x59,0xd9,0x2f,0x0d,0xde,0x52,0x30,0xf2,0x77,
+  0x55,0xe6,0x3c,0x1a,0xe6,0x66,0x44,0xea,0x63,0x41,0xf2,0x48,0x26,0xdf,0x46,0x24,
+  0xf3,0x86,0x64,0xe9,0x42,0x20,0xe1,0x3d,0x1b,0xdb,0x37,0x15,0xdb,0x38,0x16,0xe1,
+  0x47,0x25,0xe9,0x62,0x40,0xd2,0x49,0x23,0xdd,0x76,0x52,0xab,0x55,0x27,0xd4,0x2c,
+  0x0a,0xcc,0x99,0x66,0xe6,0xbf,0x99,0x99,0x66,0x33,0xcf,0x26,0x04,0xe2,0x38,0x16,
+  0xf2,0x55,0x33,0xe2,0x5a,0x38,0xc6,0x93,0x60,0xea,0xc5,0xa1,0xbd,0x8a,0x57,0xef,
+  0xce,0xac,0xb2,0x80,0x4d,0xf6,0xd7,0xb9,0xa8,0x75,0x42,0xfb,0xdf,0xc4,0x9f,0x6c,
+  0x39,0xff,0xe5,0xcc,0x00,0xff,0xff,0x18,0x6a,0xb5,0x97,0xe5,0xff,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x3d,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x06,
+  0x93,0xc0,0x1e,0x60,0x48,0x2c,0xf6,0x8e,0xc8,0x80,0x60,0x40,0x28,0x18,0x0e,0x08,
+  0x41,0x00,0x89,0x5c,0x28,0x18,0x0d,0xa7,0xe3,0xa1,0x80,0x44,0xbe,0xdf,0x9e,0xe4,
+  0x9a,0x35,0x6c,0xbb,0x13,0x4a,0xc5,0x72,0xe9,0x61,0xc8,0x5a,0x6e,0x06,0x60,0x48,
+  0x28,0x34,0xbd,0x0d,0xdc,0xcc,0xe5,0xd0,0xed,0x1d,0x3d,0x1e,0x7b,0x67,0x1f,0x7f,
+  0x0a,0x81,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x21,0x0c,0x87,0x78,0x28,0x29,
+  0x2a,0x2b,0x99,0x9a,0x93,0x75,0x0a,0x6d,0x2c,0x2d,0x2e,0x54,0x3d,0x2f,0x30,0x31,
+  0x3e,0x3e,0x32,0x2f,0x3d,0x33,0x34,0xa2,0x54,0x10,0xb1,0xa8,0x3e,0x10,0x3d,0x35,
+  0x36,0xaf,0x3d,0xb3,0xb3,0x3f,0xa8,0x3d,0x37,0x38,0xb9,0x3e,0x3f,0xc4,0xc5,0xbd,
+  0x3d,0x39,0x3a,0xc2,0xbb,0xc3,0xbe,0x3b,0x3c,0xb9,0xa3,0xb3,0x47,0x2e,0xd5,0xa3,
+  0x48,0xbe,0x3d,0x41,0x00,0x3b
+  };
+
+/* Created by reswrap from file bookprv_gif.gif */
+const unsigned char bookprv_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf5,0x00,0x00,0xff,0x66,0x44,
+  0xfc,0x62,0x40,0xfd,0x78,0x56,0xfe,0x5b,0x39,0xfe,0x60,0x3e,0xff,0x6e,0x4c,0xff,
+  0x80,0x5e,0xfe,0x87,0x65,0xfe,0x85,0x63,0xff,0x99,0x77,0xff,0xaa,0x88,0xf8,0x68,
+  0x46,0xff,0x55,0x33,0xff,0x5f,0x3d,0xff,0x91,0x6f,0xff,0xa0,0x7e,0xcc,0x22,0x00,
+  0xf7,0x5c,0x3a,0xf7,0x72,0x50,0xf6,0x59,0x37,0xf3,0x56,0x34,0xf6,0x67,0x45,0xfa,
+  0x88,0x66,0xd4,0x36,0x14,0xf6,0x7b,0x59,0xd9,0x2f,0x0d,0xde,0x52,0x30,0xf2,0x77,
+  0x55,0xe6,0x3c,0x1a,0xe6,0x66,0x44,0xea,0x63,0x41,0xf2,0x48,0x26,0xdf,0x46,0x24,
+  0xf3,0x86,0x64,0xe9,0x42,0x20,0xe1,0x3d,0x1b,0xdb,0x37,0x15,0xdb,0x38,0x16,0xe1,
+  0x47,0x25,0xe9,0x62,0x40,0xd2,0x49,0x23,0xdd,0x76,0x52,0xab,0x55,0x27,0xd4,0x2c,
+  0x0a,0xcc,0x99,0x66,0xe6,0xbf,0x99,0x99,0x66,0x33,0xcf,0x26,0x04,0xf2,0x55,0x33,
+  0xf2,0x7a,0x58,0xe2,0x5a,0x38,0xc6,0x93,0x60,0xea,0xc5,0xa1,0xbd,0x8a,0x57,0xef,
+  0xce,0xac,0xb2,0x80,0x4d,0xf6,0xd7,0xb9,0xa8,0x75,0x42,0xfb,0xdf,0xc4,0x9f,0x6c,
+  0x39,0xff,0xe5,0xcc,0x00,0xff,0xff,0x18,0x6a,0xb5,0x97,0xe5,0xff,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x3d,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x06,
+  0x93,0xc0,0x1e,0x60,0x48,0x2c,0xf6,0x8e,0xc8,0x80,0x60,0x40,0x28,0x18,0x0e,0x08,
+  0x41,0x00,0x89,0x5c,0x28,0x18,0x0d,0xa7,0xe3,0xa1,0x80,0x44,0xbe,0xdf,0x9e,0xe4,
+  0x9a,0x35,0x6c,0xbb,0x13,0x4a,0xc5,0x72,0xe9,0x61,0xc8,0x5a,0x6e,0x06,0x60,0x48,
+  0x28,0x34,0xbd,0x0d,0xdc,0xcc,0xe5,0xd0,0xed,0x1d,0x3d,0x1e,0x7b,0x67,0x1f,0x7f,
+  0x0a,0x81,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x21,0x0c,0x87,0x78,0x28,0x29,
+  0x2a,0x2b,0x99,0x9a,0x93,0x75,0x0a,0x6d,0x2c,0x2d,0x2e,0x54,0x3d,0x3e,0x3e,0x30,
+  0x06,0x31,0x32,0x2f,0x3d,0x33,0x34,0xa2,0x48,0xa5,0x3e,0x10,0xb3,0xb3,0x3d,0x35,
+  0x36,0xaf,0xa4,0x3e,0x3f,0xb1,0xb1,0x3d,0x37,0x38,0xb9,0xbb,0x3f,0xc4,0xc5,0x3e,
+  0x3d,0x39,0x3a,0xc2,0xbb,0xbd,0xa5,0x3d,0x3b,0x3c,0xb9,0xba,0xc7,0xa3,0x2e,0xd6,
+  0xa3,0xce,0x54,0x41,0x00,0x3b
+  };
+
+/* Created by reswrap from file bookclr_gif.gif */
+const unsigned char bookclr_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf5,0x00,0x00,0xff,0x66,0x44,
+  0xfc,0x62,0x40,0xfd,0x78,0x56,0xfe,0x5b,0x39,0xfe,0x60,0x3e,0xff,0x6e,0x4c,0xff,
+  0x80,0x5e,0xfe,0x87,0x65,0xfe,0x85,0x63,0xff,0x99,0x77,0xff,0xaa,0x88,0xf8,0x68,
+  0x46,0xff,0x55,0x33,0xff,0x5f,0x3d,0xff,0x91,0x6f,0xff,0xa0,0x7e,0xcc,0x22,0x00,
+  0xf7,0x5c,0x3a,0xf7,0x72,0x50,0xf6,0x59,0x37,0xf3,0x56,0x34,0xf6,0x67,0x45,0xfa,
+  0x88,0x66,0xd4,0x36,0x14,0xf6,0x7b,0x59,0xd9,0x2f,0x0d,0xde,0x52,0x30,0xf2,0x77,
+  0x55,0xe6,0x3c,0x1a,0xe6,0x66,0x44,0xea,0x63,0x41,0xf2,0x48,0x26,0xdf,0x46,0x24,
+  0xf3,0x86,0x64,0xe9,0x42,0x20,0xe1,0x3d,0x1b,0xdb,0x37,0x15,0xdb,0x38,0x16,0xd2,
+  0x49,0x23,0xdd,0x76,0x52,0xab,0x55,0x27,0xd4,0x2c,0x0a,0xcc,0x99,0x66,0xe6,0xbf,
+  0x99,0x99,0x66,0x33,0xcf,0x26,0x04,0xc6,0x93,0x60,0xea,0xc5,0xa1,0xbd,0x8a,0x57,
+  0xef,0xce,0xac,0xb2,0x80,0x4d,0xf6,0xd7,0xb9,0xa8,0x75,0x42,0xfb,0xdf,0xc4,0x9f,
+  0x6c,0x39,0xff,0xe5,0xcc,0x00,0xff,0xff,0x18,0x6a,0xb5,0x97,0xe5,0xff,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x38,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x06,
+  0x8f,0x40,0x1c,0x60,0x48,0x2c,0xe2,0x8e,0xc8,0x80,0x60,0x40,0x28,0x18,0x0e,0x08,
+  0x41,0x00,0x89,0x5c,0x28,0x18,0x0d,0xa7,0xe3,0xa1,0x80,0x44,0xbe,0x5f,0x9c,0xe4,
+  0x9a,0x35,0x6c,0xbb,0x13,0x4a,0xc5,0x72,0xc1,0x61,0xc8,0x5a,0x6e,0x06,0x60,0x48,
+  0x28,0x34,0xb8,0x0d,0xdc,0xcc,0xe5,0xd0,0xed,0x1d,0x38,0x1e,0x7b,0x67,0x1f,0x7f,
+  0x0a,0x81,0x20,0x21,0x22,0x23,0x24,0x25,0x39,0x39,0x21,0x0c,0x00,0x90,0x77,0x38,
+  0x26,0x27,0x28,0x29,0x29,0x39,0x3a,0x90,0x0c,0x90,0x9e,0x6d,0x2a,0x2b,0x2c,0x47,
+  0xa1,0x90,0x9d,0x90,0x2d,0x38,0x2e,0x2f,0xa6,0xa7,0xaa,0x9e,0x39,0x10,0x10,0x38,
+  0x30,0x31,0xb0,0xb1,0xb3,0x54,0x32,0x33,0xba,0xa8,0xbc,0x47,0x34,0x35,0xb0,0xa8,
+  0xc7,0x47,0x36,0x37,0xc6,0xbc,0xa8,0x47,0x2c,0xd0,0x48,0x90,0xd2,0x39,0x47,0x41,
+  0x00,0x3b
+  };
+
+/* Created by reswrap from file bookset_gif.gif */
+const unsigned char bookset_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf5,0x00,0x00,0xff,0x66,0x44,
+  0xfc,0x62,0x40,0xfd,0x78,0x56,0xfe,0x5b,0x39,0xfe,0x60,0x3e,0xff,0x6e,0x4c,0xff,
+  0x80,0x5e,0xfe,0x87,0x65,0xfe,0x85,0x63,0xff,0x99,0x77,0xff,0xaa,0x88,0xf8,0x68,
+  0x46,0xff,0x55,0x33,0xff,0x5f,0x3d,0xff,0x91,0x6f,0xff,0xa0,0x7e,0xcc,0x22,0x00,
+  0xf7,0x5c,0x3a,0xf7,0x72,0x50,0xf6,0x59,0x37,0xf3,0x56,0x34,0xf6,0x67,0x45,0xfa,
+  0x88,0x66,0xd4,0x36,0x14,0xf6,0x7b,0x59,0xd9,0x2f,0x0d,0xde,0x52,0x30,0xf2,0x77,
+  0x55,0xe6,0x3c,0x1a,0xe6,0x66,0x44,0xea,0x63,0x41,0xf2,0x48,0x26,0xdf,0x46,0x24,
+  0xf3,0x86,0x64,0xe9,0x42,0x20,0xe1,0x3d,0x1b,0xdb,0x37,0x15,0xdb,0x38,0x16,0xe1,
+  0x47,0x25,0xe9,0x62,0x40,0xd2,0x49,0x23,0xdd,0x76,0x52,0xab,0x55,0x27,0xd4,0x2c,
+  0x0a,0xcc,0x99,0x66,0xe6,0xbf,0x99,0x99,0x66,0x33,0xcf,0x26,0x04,0xf2,0x7a,0x58,
+  0xe2,0x5a,0x38,0xc6,0x93,0x60,0xea,0xc5,0xa1,0xbd,0x8a,0x57,0xef,0xce,0xac,0xb2,
+  0x80,0x4d,0xf6,0xd7,0xb9,0xa8,0x75,0x42,0xfb,0xdf,0xc4,0x9f,0x6c,0x39,0xff,0xe5,
+  0xcc,0x00,0xff,0xff,0x31,0x85,0x35,0x41,0xe7,0x52,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x3c,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x06,
+  0x92,0x40,0x1e,0x60,0x48,0x2c,0xf2,0x8e,0xc8,0x80,0x60,0x40,0x28,0x18,0x0e,0x08,
+  0x41,0x00,0x89,0x5c,0x28,0x18,0x0d,0xa7,0xe3,0xa1,0x80,0x44,0xbe,0x5f,0x9e,0xe4,
+  0x9a,0x35,0x6c,0xbb,0x13,0x4a,0xc5,0x72,0xe1,0x61,0xc8,0x5a,0x6e,0x06,0x60,0x48,
+  0x28,0x34,0xbc,0x0d,0xdc,0xcc,0xe5,0xd0,0xed,0x1d,0x3c,0x1e,0x7b,0x67,0x1f,0x7f,
+  0x0a,0x81,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x21,0x0c,0x87,0x78,0x28,0x29,
+  0x2a,0x2b,0x99,0x9a,0x93,0x75,0x0a,0x6d,0x2c,0x2d,0x2e,0x54,0x3c,0x3d,0xa5,0x06,
+  0x30,0x31,0x2f,0x3c,0x32,0x33,0xa2,0x54,0x3d,0x3e,0x3d,0x10,0xb3,0x10,0x3c,0x34,
+  0x35,0xae,0xa4,0xa5,0xb1,0xa5,0x48,0x36,0x37,0xb9,0xb0,0x3e,0xc3,0xb1,0x48,0x38,
+  0x39,0xc1,0xbb,0xa5,0x3d,0x48,0x3a,0x3b,0xb9,0x47,0xb0,0xcc,0x54,0x2e,0xd5,0xa3,
+  0xcb,0x54,0x41,0x00,0x3b
+  };
+
+/* Created by reswrap from file bookmrk_gif.gif */
+const unsigned char bookmrk_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf7,0x00,0x00,0xff,0xff,0xff,
+  0xff,0x66,0x44,0xfc,0x62,0x40,0xfd,0x78,0x56,0xfe,0x5b,0x39,0xfe,0x60,0x3e,0xff,
+  0x6e,0x4c,0xff,0x80,0x5e,0xfe,0x87,0x65,0xfe,0x85,0x63,0xff,0x99,0x77,0xff,0xaa,
+  0x88,0xf8,0x68,0x46,0xff,0x55,0x33,0xff,0x5f,0x3d,0xff,0x91,0x6f,0xff,0xa0,0x7e,
+  0xcc,0x22,0x00,0xf7,0x5c,0x3a,0xf7,0x72,0x50,0xf6,0x59,0x37,0xf3,0x56,0x34,0xf6,
+  0x67,0x45,0xfa,0x88,0x66,0xd4,0x36,0x14,0xf6,0x7b,0x59,0xd9,0x2f,0x0d,0xde,0x52,
+  0x30,0xf2,0x77,0x55,0xe6,0x3c,0x1a,0xe6,0x66,0x44,0xea,0x63,0x41,0xf2,0x48,0x26,
+  0xdf,0x46,0x24,0xf3,0x86,0x64,0xe9,0x42,0x20,0xe1,0x3d,0x1b,0xdb,0x37,0x15,0xdb,
+  0x38,0x16,0xe1,0x47,0x25,0xe9,0x62,0x40,0xd2,0x49,0x23,0xdd,0x76,0x52,0xab,0x55,
+  0x27,0xd4,0x2c,0x0a,0xcc,0x99,0x66,0xe6,0xbf,0x99,0x99,0x66,0x33,0xcf,0x26,0x04,
+  0xe2,0x38,0x16,0xf2,0x55,0x33,0xf2,0x7a,0x58,0xe2,0x5a,0x38,0xc6,0x93,0x60,0xea,
+  0xc5,0xa1,0xbd,0x8a,0x57,0xef,0xce,0xac,0xb2,0x80,0x4d,0xf6,0xd7,0xb9,0xa8,0x75,
+  0x42,0xfb,0xdf,0xc4,0x9f,0x6c,0x39,0xff,0xe5,0xcc,0x00,0xff,0xff,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x3f,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x08,
+  0x9f,0x00,0x7f,0x04,0x18,0x48,0xb0,0xe0,0x8f,0x83,0x08,0x05,0x0c,0x20,0x50,0xc0,
+  0xc0,0x01,0x04,0x09,0x06,0x08,0x40,0x88,0x90,0xc1,0x82,0x06,0x0e,0x1c,0x3e,0x80,
+  0xb0,0x20,0x82,0x84,0x8f,0x1f,0x7f,0x4c,0xb8,0x98,0xf1,0xc0,0xc6,0x8e,0x14,0x2a,
+  0x58,0xb8,0x80,0xe1,0x47,0x06,0x92,0x1a,0x39,0x6a,0x08,0x70,0x40,0xc1,0x82,0x0d,
+  0x3f,0x38,0xc0,0x34,0xc9,0xb1,0x03,0x4d,0x9b,0x1e,0x7e,0x7c,0xd8,0x79,0x12,0xc4,
+  0xcf,0x05,0x41,0x43,0x88,0x18,0x41,0xa2,0x84,0x89,0x13,0x28,0x44,0x34,0x38,0x8a,
+  0x33,0x85,0x8a,0x15,0x2c,0xb2,0x6a,0x9d,0x5a,0x73,0x41,0xcb,0x16,0x2e,0x5e,0x50,
+  0xfc,0x01,0x23,0x86,0x8c,0x03,0x33,0x68,0xc0,0xf8,0x51,0xc3,0x86,0x58,0x8a,0x11,
+  0xe2,0xca,0x8d,0xf0,0xe3,0x06,0x8e,0xb7,0x63,0xf3,0xe6,0xd0,0x81,0x37,0x2f,0xc5,
+  0x1d,0x3c,0xfa,0xfa,0x3d,0xd8,0xc3,0x87,0xe0,0xc1,0x2f,0x12,0x0f,0xa6,0x18,0x10,
+  0x00,0x3b
+  };
+
+/* Created by reswrap from file closepanel.gif */
+const unsigned char closepanel[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0x80,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x02,0x20,0x84,
+  0x8f,0xa9,0xcb,0xad,0x11,0x12,0x5c,0x30,0x9a,0xca,0x30,0x6e,0x75,0x3a,0xb0,0x39,
+  0x9d,0x95,0x4d,0xa1,0xe4,0x81,0x29,0xb2,0xaa,0xdf,0x0b,0xc7,0xf2,0x51,0x00,0x00,
+  0x3b
+  };
+
+/* Created by reswrap from file copy_gif.gif */
+const unsigned char copy_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf7,0x00,0x00,0xff,0xff,0xff,
+  0x55,0x7f,0x7f,0x52,0x7c,0x7c,0x50,0x79,0x79,0x4e,0x54,0x43,0x4a,0x2b,0x0a,0xf5,
+  0xfc,0xfc,0xee,0xf8,0xf8,0xe8,0xf6,0xf6,0xe3,0xf3,0xf3,0xe1,0xf2,0xf2,0xb1,0xc2,
+  0xc2,0xf4,0xfa,0xfa,0xec,0xf4,0xf4,0xe6,0xf0,0xf0,0xdd,0xeb,0xeb,0xd6,0xe7,0xe7,
+  0xa5,0xb6,0xb6,0x4c,0x75,0x75,0xf5,0xfb,0xfb,0xef,0xf5,0xf5,0xbb,0xce,0xce,0xa7,
+  0xc0,0xc0,0x7a,0x95,0x95,0x41,0x68,0x68,0x48,0x71,0x71,0xf7,0xfc,0xfc,0xf1,0xf7,
+  0xf7,0xae,0xc3,0xc3,0x44,0x6c,0x6c,0xf9,0xfc,0xfc,0xf4,0xf8,0xf8,0xae,0xc2,0xc2,
+  0x40,0x67,0x67,0xfa,0xfd,0xfd,0xf6,0xfa,0xfa,0xac,0xc1,0xc1,0x93,0xa4,0xa4,0x25,
+  0x49,0x49,0x3c,0x62,0x62,0xfc,0xfe,0xfe,0xf8,0xfb,0xfb,0xac,0xbf,0xbf,0x37,0x5d,
+  0x5d,0xfd,0xfe,0xfe,0xfb,0xfc,0xfc,0xaa,0xbd,0xbd,0xe3,0xf4,0xf4,0x32,0x58,0x58,
+  0xfe,0xff,0xff,0xfc,0xfd,0xfd,0xa8,0xbb,0xbb,0x2d,0x51,0x51,0xfe,0xfe,0xfe,0xa6,
+  0xb8,0xb8,0xef,0xf9,0xf9,0x1d,0x3f,0x3f,0xa3,0xb5,0xb5,0xf2,0xfa,0xfa,0x0f,0x2f,
+  0x2f,0x0d,0x2d,0x2d,0x24,0x47,0x47,0x09,0x29,0x29,0x12,0x33,0x33,0xf6,0xfb,0xfb,
+  0x0d,0x2e,0x2e,0xf9,0xfe,0xfe,0x10,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0xff,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x08,
+  0xba,0x00,0xff,0x05,0x18,0x48,0x70,0xe0,0xbf,0x83,0x08,0x0f,0x0a,0x30,0x70,0x00,
+  0x41,0x02,0x05,0x0b,0x04,0x08,0x48,0x88,0x70,0x00,0x83,0x06,0x0e,0x1e,0x40,0x88,
+  0x00,0x60,0xc0,0x00,0x8a,0xff,0x24,0x4c,0xa0,0xd0,0xa0,0x82,0x85,0x0b,0x28,0x31,
+  0x18,0x44,0x98,0x41,0xc3,0x06,0x0a,0x1c,0x18,0x3a,0x84,0x28,0x11,0x61,0x07,0x0f,
+  0x1f,0x36,0x80,0xb8,0x98,0x71,0x63,0xc7,0x8f,0xff,0x42,0x88,0x18,0xf1,0x81,0xc4,
+  0x48,0x8c,0x0f,0x4a,0x28,0x35,0x71,0xf0,0x04,0x8a,0x14,0x23,0x54,0xb8,0x24,0xd9,
+  0x53,0x41,0x86,0x83,0x2b,0x58,0xb4,0x48,0xe1,0x02,0xe7,0x4b,0xa4,0x2f,0x3a,0x1c,
+  0x84,0x11,0x43,0x46,0x8b,0x19,0x43,0x73,0x52,0x45,0x10,0xe2,0x20,0x0d,0x00,0x35,
+  0x64,0xd8,0x78,0x4a,0xf4,0xeb,0x8d,0x13,0x07,0x71,0x00,0x00,0x10,0x23,0x87,0x56,
+  0xa8,0x6a,0x75,0xac,0x38,0xb8,0x83,0x87,0xe1,0x1e,0x65,0xb7,0xd6,0x65,0x00,0x03,
+  0xe4,0xdb,0xb8,0x8a,0x3f,0x00,0xa1,0x01,0x52,0x2f,0x5f,0x16,0x28,0x44,0x78,0x10,
+  0x82,0x03,0x64,0x61,0xc3,0xa0,0x0d,0xef,0xf8,0x17,0x10,0x00,0x3b
+  };
+
+/* Created by reswrap from file config_gif.gif */
+const unsigned char config_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xc6,0x00,0x00,0xd1,0xee,0xee,
+  0x49,0x49,0x4b,0x42,0x42,0x44,0x00,0x00,0x00,0x41,0x41,0x43,0xee,0xee,0xee,0xe3,
+  0xe3,0xe4,0xc9,0xc9,0xcb,0xbc,0xbc,0xbe,0x2a,0x6a,0x68,0x17,0x3a,0x38,0x4d,0x4d,
+  0x4f,0x99,0x99,0x9a,0xb1,0xb1,0xb2,0x5b,0x5b,0x5d,0x01,0x01,0x01,0x35,0x72,0x70,
+  0xac,0xdb,0xdc,0x29,0x69,0x67,0x56,0x56,0x57,0xf4,0xf4,0xf4,0xb4,0xb4,0xb6,0xaa,
+  0xaa,0xaa,0x58,0x58,0x5a,0x3c,0x3c,0x3e,0xc9,0xe7,0xe8,0x4d,0x90,0x8e,0x14,0x34,
+  0x33,0x2c,0x5a,0x58,0x63,0x63,0x65,0xc0,0xc0,0xc1,0x62,0x58,0x21,0x55,0x9b,0x99,
+  0xaa,0xdb,0xdd,0x69,0x69,0x6a,0xb7,0xb7,0xb8,0xde,0xde,0xdf,0xf0,0xe4,0xbb,0xcf,
+  0xb2,0x62,0x21,0x52,0x50,0x97,0xd4,0xd2,0x65,0xac,0xaa,0x2f,0x5d,0x5b,0xc5,0xe6,
+  0xe6,0x72,0xba,0xb8,0xeb,0xeb,0xec,0xa0,0xa0,0xa1,0x82,0x82,0x83,0x50,0x49,0x1d,
+  0x97,0x85,0x30,0xfd,0xf5,0xdc,0xc7,0xab,0x56,0x6f,0x4e,0x1d,0xbe,0xe1,0xe0,0x73,
+  0xba,0xb8,0x39,0x39,0x3b,0xac,0xac,0xad,0x2b,0x2b,0x2c,0xce,0xac,0x7f,0x9c,0x77,
+  0x41,0x6f,0x4d,0x1c,0x23,0x53,0x51,0x05,0x05,0x04,0x94,0x94,0x95,0x4b,0x32,0x0e,
+  0x84,0x61,0x2b,0xde,0xbd,0x96,0xb4,0x8d,0x5b,0x6b,0x48,0x15,0x91,0x91,0x83,0x3b,
+  0x76,0x74,0x3a,0x26,0x0a,0x90,0x6c,0x33,0xe7,0xce,0xab,0xbe,0x9a,0x6d,0x3c,0x76,
+  0x75,0xbd,0xe5,0xe3,0x7c,0xc2,0xc0,0x38,0x25,0x0a,0xa4,0x83,0x50,0xeb,0xd4,0xb3,
+  0x39,0x75,0x73,0xc4,0xe7,0xe5,0x99,0x74,0x3a,0xe5,0xc4,0x9d,0xb3,0x8a,0x56,0xc1,
+  0xe5,0xe5,0xd3,0xb1,0x86,0x98,0x73,0x39,0x60,0x40,0x12,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x07,0xb3,0x80,0x00,0x82,0x83,0x00,0x01,0x02,
+  0x02,0x03,0x84,0x8a,0x82,0x04,0x05,0x06,0x07,0x08,0x03,0x09,0x0a,0x8b,0x0b,0x03,
+  0x0c,0x0d,0x0e,0x0f,0x03,0x10,0x11,0x12,0x8a,0x13,0x14,0x15,0x16,0x17,0x18,0x00,
+  0x10,0x19,0x1a,0x1b,0x1c,0x94,0x82,0x1d,0x1e,0x14,0x1f,0x1f,0x00,0x09,0x11,0x20,
+  0xab,0x21,0x89,0x18,0x22,0x23,0x24,0x1f,0x25,0x26,0x1f,0x27,0x28,0x29,0x2a,0x2b,
+  0x2c,0x09,0x18,0x2d,0x2e,0x2f,0x0e,0x30,0x31,0x32,0x33,0x34,0x35,0x28,0x2c,0x36,
+  0x93,0x37,0x38,0x2d,0x17,0x39,0x00,0xcf,0x3a,0x3b,0x3c,0x09,0x09,0x3d,0xad,0x3e,
+  0x3f,0x89,0x82,0x40,0x41,0x42,0x43,0x44,0x03,0x45,0x84,0x03,0x02,0x82,0x46,0x1a,
+  0x47,0x48,0x49,0x4a,0x44,0x8b,0x82,0x4b,0x4c,0x4d,0x4e,0x38,0x79,0x02,0x65,0xdf,
+  0xa2,0x28,0x52,0x9a,0x24,0x48,0xe4,0x64,0x0a,0x95,0x2a,0xfc,0x06,0x71,0xb0,0xa2,
+  0x30,0x1d,0x80,0x86,0x57,0xb0,0x44,0x04,0xa0,0xa0,0xa2,0x22,0x27,0x58,0xb2,0x38,
+  0x21,0xa4,0xc0,0x22,0x21,0x27,0x23,0xfb,0xa9,0x04,0x10,0x08,0x00,0x3b
+  };
+
+/* Created by reswrap from file cut_gif.gif */
+const unsigned char cut_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xc2,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0xff,0xff,0xff,0xdc,0xdc,0xdc,0x80,0x80,0x80,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x03,
+  0x34,0x08,0xba,0xdc,0x1a,0x30,0xb8,0x27,0x21,0x75,0x41,0x8c,0xb8,0x6c,0xd7,0x12,
+  0xe0,0x89,0xdf,0xc6,0x44,0x5c,0x66,0x62,0x28,0x38,0x75,0x6a,0xf8,0x8a,0xa0,0xcc,
+  0x46,0xc4,0x7a,0xa2,0x95,0x0b,0x77,0xa5,0xd0,0x68,0x44,0x33,0x79,0x88,0x0f,0x17,
+  0xea,0x85,0x9c,0x2d,0x12,0x00,0x3b
+  };
+
+/* Created by reswrap from file delete_gif.gif */
+const unsigned char delete_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf4,0x00,0x00,0xff,0x66,0x44,
+  0xfd,0x63,0x41,0xff,0xaa,0x88,0xf9,0x5f,0x3d,0xff,0xa5,0x83,0xf6,0x5a,0x38,0xff,
+  0x9f,0x7d,0xf1,0x54,0x32,0xff,0x97,0x75,0xed,0x4e,0x2c,0xff,0x8e,0x6c,0xe8,0x47,
+  0x25,0xff,0x84,0x62,0xe3,0x41,0x1f,0xff,0x93,0x71,0xff,0x7b,0x59,0xde,0x3a,0x18,
+  0xff,0x71,0x4f,0xda,0x34,0x12,0xff,0x68,0x46,0xd5,0x2e,0x0c,0xff,0x60,0x3e,0xd2,
+  0x29,0x07,0xff,0x5a,0x38,0xce,0x25,0x03,0xff,0x55,0x33,0xcc,0x22,0x00,0xff,0x00,
+  0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x1b,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x05,
+  0x7c,0xe0,0x26,0x8e,0x64,0x39,0x02,0xa8,0x89,0x02,0x63,0x10,0x08,0x2e,0xe9,0xc2,
+  0x81,0x38,0x08,0x84,0x30,0x0c,0xf6,0x9d,0xf3,0x9b,0x42,0xc1,0x60,0x10,0x08,0x85,
+  0x02,0xa2,0x70,0x74,0x38,0x20,0x10,0x82,0xa6,0xe0,0xd9,0x2c,0x25,0x12,0x0a,0x85,
+  0x40,0x90,0xbd,0x9a,0x36,0x8b,0x05,0x63,0xcc,0x08,0x7f,0x37,0x8d,0x86,0xe3,0xf1,
+  0x70,0xa4,0xbf,0x10,0x88,0x20,0x42,0x8f,0x08,0xe2,0x25,0x89,0x44,0x30,0x99,0xe8,
+  0xfb,0x02,0x7a,0x23,0x14,0x14,0x02,0x15,0x15,0x84,0x84,0x87,0x02,0x84,0x22,0x16,
+  0x02,0x17,0x17,0x16,0x16,0x8e,0x16,0x91,0x02,0x94,0x1b,0x18,0x18,0x19,0x9b,0x24,
+  0x9b,0x9d,0x18,0x23,0x1a,0xa4,0x26,0xa4,0x1a,0x67,0xa9,0x1b,0x21,0x00,0x3b
+  };
+
+/* Created by reswrap from file desktop.bmp */
+const unsigned char desktop[]={
+  0x42,0x4d,0xda,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5a,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x01,0x00,0x04,0x00,0x00,0x00,
+  0x00,0x00,0x80,0x00,0x00,0x00,0x6d,0x0b,0x00,0x00,0x6d,0x0b,0x00,0x00,0x09,0x00,
+  0x00,0x00,0x09,0x00,0x00,0x00,0xdc,0xc0,0xb2,0x00,0x84,0x86,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xff,0xff,0xff,0x00,0xff,0xff,0x00,0x00,0x84,0x86,0x84,0x00,0xc6,0xc7,
+  0xc6,0x00,0x00,0x86,0x84,0x00,0x00,0xff,0xff,0x00,0x55,0x55,0x55,0x55,0x55,0x55,
+  0x55,0x20,0x53,0x33,0x33,0x33,0x33,0x33,0x35,0x20,0x56,0x22,0x22,0x26,0x22,0x22,
+  0x25,0x52,0x05,0x65,0x33,0x26,0x78,0x88,0x82,0x52,0x05,0x65,0x33,0x32,0x67,0x87,
+  0x72,0x62,0x00,0x56,0x53,0x32,0x67,0x76,0x66,0x62,0x00,0x55,0x55,0x55,0x55,0x55,
+  0x52,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x02,0x22,0x22,0x22,
+  0x00,0x02,0x00,0x00,0x00,0x14,0x11,0x20,0x02,0x20,0x00,0x00,0x00,0x01,0x12,0x32,
+  0x20,0x00,0x00,0x00,0x00,0x01,0x12,0x20,0x00,0x00,0x00,0x00,0x00,0x01,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+  };
+
+/* Created by reswrap from file details.bmp */
+const unsigned char details[]={
+  0x42,0x4d,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x01,0x00,0x04,0x00,0x00,0x00,
+  0x00,0x00,0x80,0x00,0x00,0x00,0x6d,0x0b,0x00,0x00,0x6d,0x0b,0x00,0x00,0x03,0x00,
+  0x00,0x00,0x03,0x00,0x00,0x00,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x20,0x01,0x11,0x10,0x11,0x10,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x20,0x01,0x11,0x10,0x11,0x10,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x20,0x01,0x11,0x10,0x11,0x10,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x20,0x01,0x11,0x10,0x11,0x10,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x20,0x01,0x11,0x10,0x11,0x10,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x11,0x10,0x11,0x10,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00
+  };
+
+/* Created by reswrap from file dirup_gif.gif */
+const unsigned char dirup_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf6,0x00,0x00,0xcb,0xb9,0x3c,
+  0xce,0xba,0x38,0xcd,0xb9,0x38,0xd1,0xbf,0x3d,0x00,0x00,0x00,0xca,0xb6,0x37,0xff,
+  0xfc,0x78,0xfc,0xf7,0x79,0xfc,0xf7,0x7b,0xff,0xfc,0x7d,0xc8,0xb2,0x31,0xce,0xb9,
+  0x38,0xd0,0xbb,0x38,0xd0,0xbb,0x39,0xd6,0xc2,0x3d,0xd2,0xb6,0x33,0xf1,0xe4,0x6d,
+  0xea,0xd6,0x3b,0xea,0xd6,0x3c,0xef,0xdd,0x60,0xf4,0xe5,0x72,0xf4,0xe6,0x72,0xf4,
+  0xe5,0x6f,0xf4,0xe6,0x6d,0xf4,0xe5,0x6c,0xf4,0xe4,0x68,0xf4,0xe4,0x66,0xf3,0xe3,
+  0x64,0xf4,0xe6,0x62,0xd8,0xbb,0x35,0xd5,0xb0,0x2c,0xe8,0xcd,0x5c,0xe1,0xbf,0x31,
+  0xe1,0xbf,0x34,0xe1,0xbf,0x33,0xbb,0x9b,0x23,0xaa,0x8a,0x1a,0xaa,0x89,0x19,0xb4,
+  0x99,0x39,0xb1,0x8a,0x19,0xab,0x82,0x1d,0xaf,0x8c,0x34,0xa3,0x7a,0x13,0xa4,0x7a,
+  0x15,0xff,0xfa,0xbe,0xfe,0xf8,0xbc,0xfd,0xf8,0xbc,0xfe,0xf9,0xc4,0xfb,0xf2,0xb4,
+  0xe9,0xde,0x9f,0xc5,0xa1,0x3b,0xff,0xfe,0xc9,0xfc,0xf9,0xbb,0xfc,0xf9,0xbc,0xf2,
+  0xe6,0x90,0xf2,0xe5,0x8b,0xf2,0xe6,0x8e,0xf6,0xea,0x8f,0xbe,0xa3,0x60,0xd3,0xab,
+  0x31,0xf3,0xe9,0x8e,0xf0,0xe4,0x86,0xf0,0xe4,0x87,0xf1,0xe4,0x89,0xf1,0xe4,0x8a,
+  0xf5,0xea,0x8d,0xbf,0xa5,0x60,0xf2,0xe9,0x8d,0xef,0xe4,0x86,0xf4,0xea,0x89,0xbe,
+  0xa5,0x5d,0xd2,0xab,0x2f,0xf1,0xe8,0x89,0xee,0xe3,0x82,0xf3,0xe8,0x85,0xbd,0xa4,
+  0x5b,0xd2,0xaa,0x2d,0xed,0xe2,0x7e,0xf2,0xe7,0x81,0xbc,0xa3,0x58,0xd1,0xab,0x2d,
+  0xee,0xe3,0x7d,0xf1,0xe9,0x80,0xbb,0xa3,0x56,0xca,0xa0,0x1a,0xd8,0xc7,0x4b,0xd7,
+  0xc3,0x46,0xdb,0xc8,0x48,0xad,0x8f,0x33,0xd3,0xaf,0x36,0xec,0xe6,0x80,0xeb,0xe1,
+  0x7a,0xef,0xe7,0x7d,0xbd,0xa6,0x59,0xce,0xa4,0x23,0xe7,0xd6,0x68,0xe5,0xd3,0x62,
+  0xe8,0xd6,0x65,0xb7,0x9b,0x45,0x1c,0x00,0x00,0x16,0x00,0x00,0x15,0x00,0x00,0x22,
+  0x01,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x67,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x07,
+  0xb8,0x80,0x00,0x01,0x02,0x02,0x01,0x03,0x67,0x88,0x89,0x8a,0x05,0x06,0x07,0x08,
+  0x09,0x0a,0x0b,0x0c,0x93,0x93,0x0d,0x0d,0x0e,0x67,0x0f,0x10,0x11,0x12,0x13,0x14,
+  0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x67,0x1e,0x1f,0x20,0x21,0x22,0x23,
+  0x23,0x24,0xb1,0xb1,0x25,0x26,0x27,0x67,0x28,0x29,0x2a,0x2b,0xbb,0x23,0x2c,0x2d,
+  0xbf,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x33,0x34,0x35,0x2c,0xca,0x36,0x37,0xcd,0xcd,
+  0x38,0x39,0x3a,0x3b,0x3c,0x3d,0x3e,0x10,0x04,0x10,0x3f,0x40,0xdb,0xdb,0x3f,0x41,
+  0x42,0x3b,0x43,0x44,0xd7,0x04,0xd8,0x44,0xe7,0xe8,0x45,0x46,0x47,0x48,0x49,0xe5,
+  0xef,0x49,0xf1,0xf2,0x4a,0x4b,0x4c,0x14,0xf7,0x14,0x04,0x4d,0xfb,0xfc,0xfb,0x4e,
+  0x4f,0x50,0xf0,0xe5,0x8b,0x42,0xb0,0x20,0x41,0x29,0x53,0xa8,0x54,0xb1,0x62,0x25,
+  0xdf,0xbb,0x77,0x14,0xac,0x5c,0xc1,0x92,0x45,0xcb,0x96,0x8b,0x18,0x33,0x5e,0xe4,
+  0xd2,0xc5,0xcb,0x17,0x30,0x20,0x43,0x8a,0x04,0x19,0x46,0x4c,0x8a,0x5d,0x28,0x53,
+  0xaa,0x4c,0xa1,0xa8,0xa5,0xcb,0x33,0x81,0x00,0x00,0x3b
+  };
+
+/* Created by reswrap from file enter.gif */
+const unsigned char enter[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xa1,0x00,0x00,0x00,0xff,0xff,
+  0x00,0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,
+  0x10,0x00,0x00,0x02,0x29,0x84,0x8f,0xa9,0xcb,0xed,0x17,0x62,0x7c,0x41,0xd8,0xa0,
+  0x30,0xb4,0x42,0x43,0x0f,0x54,0x17,0x52,0x49,0x12,0xe7,0x89,0xdc,0x3a,0x86,0xec,
+  0xdb,0x6d,0x30,0x4a,0x76,0xe6,0x9d,0x4c,0x0f,0xb4,0xf7,0xfe,0x51,0x00,0x00,0x3b
+  };
+
+/* Created by reswrap from file file_gif.gif */
+const unsigned char file_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x20,0x00,0x20,0x00,0xe3,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0x9d,0xa0,0xeb,0xc8,0xd7,0xa1,0xff,0xdc,0xa8,0x87,0x84,0xc0,0xff,
+  0xa8,0x58,0x8a,0x7c,0xa4,0x81,0x7f,0xa4,0x80,0x83,0xc0,0x80,0x80,0x80,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x04,0xfb,0x10,0x84,0x49,0xab,0xa5,0x20,0xeb,
+  0xad,0x83,0x18,0xe0,0x27,0x0e,0xe3,0x38,0x71,0xa8,0x27,0x7c,0x64,0x5b,0xba,0xe4,
+  0x89,0x66,0xea,0xca,0xc2,0xaf,0x19,0xcc,0xb5,0x7d,0x83,0x16,0x90,0x10,0x98,0xf2,
+  0xf9,0x48,0x82,0x00,0x61,0x69,0x29,0x38,0x0b,0x3b,0x4e,0xef,0x98,0x54,0x1a,0x94,
+  0x4c,0x8a,0x33,0xba,0x99,0xda,0x62,0x56,0x6c,0x60,0x78,0xe9,0x18,0xbf,0x55,0xc2,
+  0x55,0x3d,0x5e,0x12,0x86,0x44,0xc9,0x79,0x05,0x66,0xb3,0x07,0xee,0x3c,0x9b,0x36,
+  0x17,0x4d,0xec,0x57,0x78,0x7a,0x4b,0x57,0x7c,0x73,0x31,0x55,0x61,0x03,0x17,0x13,
+  0x57,0x3b,0x5e,0x74,0x49,0x36,0x8d,0x13,0x70,0x70,0x07,0x13,0x7d,0x31,0x08,0x3e,
+  0x14,0x48,0x73,0x98,0x90,0x7e,0x01,0x07,0x9c,0x54,0x89,0x99,0x02,0xa1,0x9a,0x49,
+  0x8b,0xa4,0xa6,0x22,0x92,0x2b,0x2a,0xab,0x87,0xad,0xb3,0xaf,0xb1,0xa0,0xa9,0x67,
+  0x31,0x48,0x15,0x07,0xc1,0xc2,0xc3,0xc1,0xbc,0x46,0xbe,0xb3,0x93,0x8c,0x15,0x72,
+  0xb6,0x63,0x7d,0xaa,0x1e,0x5c,0x66,0xce,0xc4,0xd6,0xd2,0x45,0xb6,0xa8,0x8c,0xb3,
+  0xd9,0xbd,0xad,0x96,0x64,0x49,0xde,0xc7,0xb7,0x7d,0x98,0xe3,0x52,0xac,0xcf,0xdb,
+  0x2b,0xe8,0xd3,0x86,0xdf,0xcf,0x09,0x35,0xb4,0xd8,0x52,0x0a,0xce,0x9f,0x67,0xef,
+  0x29,0xa4,0x07,0xe5,0xfe,0x59,0x13,0x76,0xcf,0x5f,0x30,0x34,0xdb,0x2e,0x74,0x9b,
+  0x41,0x43,0xe0,0x3e,0x68,0x0b,0x19,0x36,0x54,0x30,0xb0,0x22,0x26,0x89,0x52,0x96,
+  0x2d,0x9b,0x11,0x01,0x00,0x3b
+  };
+
+/* Created by reswrap from file fileshown.gif */
+const unsigned char fileshown[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf5,0x00,0x00,0xff,0xff,0xff,
+  0x01,0x01,0x01,0x00,0x00,0x00,0x07,0x07,0x07,0x4d,0x4d,0x4d,0xa9,0xa9,0xa9,0x7e,
+  0x7e,0x7e,0x42,0x42,0x42,0x35,0x35,0x35,0xca,0xca,0xca,0xfb,0xfb,0xfb,0xa6,0xa6,
+  0xa6,0x9b,0x9b,0x9b,0x37,0x37,0x38,0x38,0x38,0x38,0x03,0x03,0x03,0x46,0x46,0x46,
+  0xe9,0xe9,0xe9,0xf6,0xf6,0xf6,0xbd,0xbd,0xbd,0x9b,0x9b,0x9e,0x3c,0x3c,0x41,0x46,
+  0x46,0x4c,0x5c,0x5c,0x5c,0xf0,0xf0,0xf0,0x43,0x43,0x43,0xb2,0xb2,0xba,0x2e,0x2e,
+  0x35,0x5f,0x5f,0x6d,0x48,0x48,0x48,0xe2,0xe2,0xe2,0xea,0xea,0xea,0x64,0x64,0x64,
+  0x6f,0x6f,0x81,0x67,0x67,0x7a,0x04,0x04,0x04,0x3a,0x3a,0x3a,0xc6,0xc6,0xc6,0xe7,
+  0xe7,0xe7,0xa2,0xa2,0xa2,0x5d,0x5d,0x64,0x84,0x84,0x9e,0x0c,0x0c,0x0c,0x54,0x54,
+  0x54,0xaa,0xaa,0xaa,0x8c,0x8c,0x8c,0x5e,0x5e,0x5e,0x00,0xff,0xff,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x2f,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x06,
+  0x7d,0xc0,0x97,0x70,0x48,0x2c,0x1a,0x8f,0xc8,0xa4,0x91,0xb5,0x12,0x38,0x9f,0x2b,
+  0x16,0xb1,0x39,0x20,0x14,0x0c,0x87,0x83,0xa1,0x40,0x18,0x08,0x56,0x2f,0x56,0x00,
+  0x91,0x50,0x2c,0x18,0x8d,0x86,0x63,0xa1,0x48,0x20,0x02,0xac,0x07,0x24,0x22,0x91,
+  0x4c,0x00,0x94,0x8a,0xe5,0x52,0x8f,0x40,0x1e,0x0f,0x06,0x18,0x83,0x19,0x1a,0x1b,
+  0x1b,0x1c,0x19,0x83,0x18,0x06,0x80,0x1d,0x1e,0x1f,0x1f,0x20,0x21,0x22,0x22,0x21,
+  0x20,0x91,0x1e,0x1d,0x0f,0x2c,0x23,0x24,0x25,0x26,0x27,0x28,0x29,0x29,0x28,0x27,
+  0x26,0x25,0x24,0x23,0x52,0x2b,0x23,0x2a,0x51,0x2d,0x2e,0x2e,0x2d,0x4c,0x2a,0x23,
+  0x60,0x43,0x4c,0x23,0xbb,0xbc,0x51,0x4a,0xbf,0xc0,0xc1,0xc2,0x47,0x41,0x00,0x3b
+  };
+
+/* Created by reswrap from file filehidden.gif */
+const unsigned char filehidden[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf5,0x00,0x00,0x01,0x01,0x01,
+  0x00,0x00,0x00,0x07,0x07,0x07,0x4d,0x4d,0x4d,0xa9,0xa9,0xa9,0x7e,0x7e,0x7e,0x42,
+  0x42,0x42,0x35,0x35,0x35,0xca,0xca,0xca,0xfb,0xfb,0xfb,0xa6,0xa6,0xa6,0x9b,0x9b,
+  0x9b,0x37,0x37,0x38,0x38,0x38,0x38,0x03,0x03,0x03,0x46,0x46,0x46,0xe9,0xe9,0xe9,
+  0xf6,0xf6,0xf6,0x9b,0x9b,0x9e,0x3c,0x3c,0x41,0x46,0x46,0x4c,0x5c,0x5c,0x5c,0xf0,
+  0xf0,0xf0,0x43,0x43,0x43,0x2e,0x2e,0x35,0x5f,0x5f,0x6d,0x48,0x48,0x48,0xe2,0xe2,
+  0xe2,0xea,0xea,0xea,0x64,0x64,0x64,0x6f,0x6f,0x81,0x04,0x04,0x04,0x3a,0x3a,0x3a,
+  0xc6,0xc6,0xc6,0xe7,0xe7,0xe7,0xa2,0xa2,0xa2,0x0c,0x0c,0x0c,0x54,0x54,0x54,0xaa,
+  0xaa,0xaa,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x27,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x06,
+  0x77,0xc0,0x93,0x70,0x48,0x2c,0x9e,0x3e,0x18,0xa3,0xf2,0x84,0x41,0x2e,0x8d,0x4d,
+  0x44,0x60,0x4a,0x0d,0x1c,0x14,0xc5,0x26,0x86,0x50,0x30,0x18,0x0a,0x84,0x83,0xc0,
+  0x7a,0xc2,0x32,0x91,0x0b,0x06,0xa3,0xa1,0x48,0x20,0x0e,0x00,0x85,0xe3,0x21,0xd4,
+  0x4a,0x26,0x94,0x4a,0x24,0x02,0x79,0x38,0x1c,0x05,0x16,0x75,0x48,0x18,0x19,0x17,
+  0x16,0x88,0x05,0x7f,0x1a,0x1b,0x1c,0x83,0x18,0x1e,0x1d,0x1c,0x1c,0x1b,0x1a,0x0e,
+  0x0a,0x1f,0x20,0x21,0x22,0x8f,0x23,0x22,0x21,0x20,0x1f,0x58,0x07,0x1f,0x24,0x25,
+  0x26,0x8f,0x02,0x24,0x1f,0x07,0x44,0x0a,0xa4,0x1f,0x1f,0x67,0x18,0x08,0x4f,0x44,
+  0x5a,0xb6,0xb7,0xb2,0xb9,0xbc,0xb9,0x41,0x00,0x3b
+  };
+
+/* Created by reswrap from file foldernew_gif.gif */
+const unsigned char foldernew_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf7,0x00,0x00,0xcb,0xb9,0x3c,
+  0xce,0xba,0x38,0xcd,0xb9,0x38,0xd1,0xbf,0x3d,0x00,0x00,0x00,0xca,0xb6,0x37,0xff,
+  0xfc,0x78,0xfc,0xf7,0x79,0xfc,0xf7,0x7b,0xff,0xfc,0x7d,0xc8,0xb2,0x31,0xce,0xb9,
+  0x38,0xd0,0xbb,0x38,0xd0,0xbb,0x39,0xd6,0xc2,0x3d,0xd2,0xb6,0x33,0xf1,0xe4,0x6d,
+  0xea,0xd6,0x3b,0xea,0xd6,0x3c,0xef,0xdd,0x60,0xf4,0xe5,0x72,0xf4,0xe6,0x72,0xf4,
+  0xe5,0x6f,0xf4,0xe6,0x6d,0xf4,0xe5,0x6c,0xf4,0xe4,0x68,0xf4,0xe4,0x66,0xf3,0xe3,
+  0x64,0xf4,0xe6,0x62,0xd8,0xbb,0x35,0xd5,0xb0,0x2c,0xe8,0xcd,0x5c,0xe1,0xbf,0x31,
+  0xe1,0xbf,0x34,0xe1,0xbf,0x33,0xbb,0x9b,0x23,0xaa,0x8a,0x1a,0xaa,0x89,0x19,0xb4,
+  0x99,0x39,0xb1,0x8a,0x19,0xab,0x82,0x1d,0xaf,0x8c,0x34,0xa3,0x7a,0x13,0xa4,0x7a,
+  0x15,0xff,0xfa,0xbe,0xfe,0xf8,0xbc,0xfd,0xf8,0xbc,0xfe,0xf9,0xc4,0xfb,0xf2,0xb4,
+  0xe9,0xde,0x9f,0xc5,0xa1,0x3b,0xff,0xfe,0xc9,0xfc,0xf9,0xbb,0xfc,0xf9,0xbc,0xf2,
+  0xe6,0x90,0xf2,0xe5,0x8b,0xf2,0xe6,0x8e,0xf6,0xea,0x8f,0xbe,0xa3,0x60,0xd3,0xab,
+  0x31,0xf3,0xe9,0x8e,0xf0,0xe4,0x86,0xf0,0xe4,0x87,0xf1,0xe4,0x89,0xf1,0xe4,0x8a,
+  0xf5,0xea,0x8d,0xbf,0xa5,0x60,0xf2,0xe9,0x8d,0xef,0xe4,0x86,0xf4,0xea,0x89,0xbe,
+  0xa5,0x5d,0xd2,0xab,0x2f,0xf1,0xe8,0x89,0xee,0xe3,0x82,0xf3,0xe8,0x85,0xbd,0xa4,
+  0x5b,0xd2,0xaa,0x2d,0xed,0xe2,0x7e,0xf2,0xe7,0x81,0xbc,0xa3,0x58,0xd1,0xab,0x2d,
+  0xee,0xe3,0x7d,0xf1,0xe9,0x80,0xbb,0xa3,0x56,0xca,0xa0,0x1a,0xd8,0xc7,0x4b,0xd7,
+  0xc3,0x46,0xdb,0xc8,0x48,0xad,0x8f,0x33,0xd3,0xaf,0x36,0xec,0xe6,0x80,0xeb,0xe1,
+  0x7a,0xef,0xe7,0x7d,0xbd,0xa6,0x59,0xce,0xa4,0x23,0xe7,0xd6,0x68,0xe5,0xd3,0x62,
+  0xe8,0xd6,0x65,0xb7,0x9b,0x45,0x1c,0x00,0x00,0x16,0x00,0x00,0x15,0x00,0x00,0x22,
+  0x01,0x00,0x00,0xff,0xff,0x00,0x49,0x00,0xff,0xff,0x00,0x28,0xaf,0x1b,0x50,0xd5,
+  0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x67,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x08,
+  0xd3,0x00,0x01,0x04,0x10,0x20,0x20,0xc0,0x80,0x33,0x08,0x13,0x2a,0x2c,0x60,0xe0,
+  0x00,0x82,0x04,0x0a,0x16,0x30,0x98,0x38,0xb1,0x41,0x03,0x07,0x67,0x1e,0x40,0x88,
+  0x20,0x61,0x02,0x85,0x0a,0x16,0x2e,0x60,0xc8,0xa0,0x61,0x03,0x87,0x0e,0x67,0x3c,
+  0x7c,0x00,0x11,0x42,0xc4,0x88,0x11,0x24,0x62,0xc6,0x2c,0x61,0xe2,0xc4,0x19,0x14,
+  0x29,0x54,0xac,0xd8,0x39,0x82,0x45,0x8b,0x9f,0x2d,0x5c,0xbc,0x80,0x11,0x43,0xc6,
+  0x0c,0x1a,0x35,0x58,0x28,0xb5,0x71,0xa3,0x69,0x53,0x1c,0x39,0x74,0xec,0xe0,0xd1,
+  0xc3,0x07,0x04,0x1b,0x10,0x7e,0x00,0xd9,0xba,0xf5,0x47,0x10,0x21,0x3b,0x86,0x10,
+  0xb9,0x6a,0xa3,0x2c,0x91,0xb3,0x68,0x8b,0x18,0x39,0x82,0x24,0x49,0xd9,0xb7,0x49,
+  0x92,0xa0,0x99,0x8b,0x46,0xc9,0x12,0x26,0x14,0xf2,0x52,0xb0,0xd1,0xa4,0x6f,0x13,
+  0x34,0x69,0xd2,0xa0,0x71,0xf2,0x04,0x8a,0xde,0xbd,0x51,0xa2,0xd0,0x4d,0xa3,0x86,
+  0x2e,0x95,0x2a,0x56,0xac,0x38,0x98,0xec,0x00,0x70,0x60,0x35,0x6a,0x04,0x67,0xd1,
+  0xb2,0xa5,0xb3,0x67,0xc0,0x98,0x43,0xa3,0xf1,0xf2,0x05,0x8c,0xe9,0xd3,0x74,0xd7,
+  0x34,0x9e,0x9b,0x62,0xa7,0xeb,0xd7,0xa0,0xd1,0xac,0x48,0xa1,0xb0,0xf6,0x19,0xba,
+  0x68,0x10,0x06,0x04,0x00,0x3b
+  };
+
+/* Created by reswrap from file foxbig.gif */
+const unsigned char foxbig[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x20,0x00,0x20,0x00,0xc2,0x00,0x00,0xff,0xff,0xff,
+  0x8e,0x8e,0x8e,0x00,0x00,0x00,0x49,0x49,0x55,0x24,0x24,0x00,0x24,0x24,0x55,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x03,
+  0x9d,0x08,0xba,0xdc,0xfe,0x30,0xca,0x49,0x6b,0x0d,0x42,0x04,0x90,0x75,0xc4,0x19,
+  0xd4,0x65,0xdb,0x28,0x0c,0x8d,0x29,0x3c,0x6a,0xa9,0x2e,0xea,0xda,0x10,0xdd,0xe6,
+  0x80,0xe1,0x68,0xdf,0xdd,0x14,0x4b,0x3d,0x8a,0x49,0x02,0xda,0xc1,0x42,0x0b,0x9c,
+  0xd1,0x51,0x4b,0x8d,0x18,0xc1,0xc8,0x8b,0x63,0x22,0x1c,0x65,0xd2,0x21,0x55,0xbb,
+  0xf5,0x69,0x7f,0x8a,0xa8,0x08,0x09,0x7d,0x2a,0x94,0x40,0x72,0x19,0x0b,0x28,0x74,
+  0xac,0x59,0xf6,0xc7,0xb4,0x5c,0x53,0x94,0x4d,0x96,0x9a,0xd7,0xc4,0x11,0xea,0x62,
+  0x6b,0x79,0x00,0x38,0x62,0x81,0x57,0x1e,0x7c,0x6a,0x87,0x61,0x24,0x73,0x7b,0x16,
+  0x91,0x92,0x1c,0x61,0x30,0x12,0x70,0x3e,0x95,0x33,0x4c,0x34,0x5b,0x2b,0x27,0x48,
+  0x32,0x9f,0x94,0x87,0x70,0xa2,0x94,0xa8,0xa2,0xa7,0xa8,0x9b,0xa9,0xae,0xa9,0xab,
+  0x72,0x8d,0x9e,0xb4,0xae,0xa3,0x54,0x93,0xb9,0xba,0xbb,0xbc,0x0c,0x09,0x00,0x3b
+  };
+
+/* Created by reswrap from file foxmini.gif */
+const unsigned char foxmini[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xc2,0x00,0x00,0xff,0xff,0xff,
+  0x87,0x87,0x87,0x00,0x00,0x00,0x12,0x12,0x12,0x06,0x06,0x06,0x17,0x17,0x17,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x03,
+  0x35,0x08,0xba,0xdc,0xfe,0x30,0xbe,0x20,0x80,0x08,0x8c,0xae,0x30,0x44,0xa5,0x5e,
+  0x88,0x01,0x60,0x03,0x8e,0x8a,0xb7,0x8d,0x2a,0x13,0x92,0x1e,0xd6,0x2e,0xef,0x09,
+  0x10,0x95,0x8b,0x06,0x6c,0xbe,0x14,0xa8,0x4d,0x4c,0x97,0x09,0x89,0x52,0xc1,0x4b,
+  0x51,0xc2,0x6c,0x3a,0x17,0x09,0x00,0x3b
+  };
+
+/* Created by reswrap from file goup_gif.gif */
+const unsigned char goup_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf7,0x00,0x00,0xfc,0xff,0xff,
+  0x17,0x92,0xef,0x1d,0x96,0xf3,0x02,0x86,0xf2,0x86,0xd0,0xff,0x97,0xdc,0xf9,0x12,
+  0x85,0xf0,0x08,0x80,0xf1,0x69,0xc0,0xf5,0xe9,0xfe,0xff,0xd2,0xf1,0xff,0x72,0xc2,
+  0xf5,0x10,0x7e,0xf7,0x05,0x76,0xee,0x69,0xb9,0xf4,0xf4,0xf8,0xf9,0xa8,0xe2,0xf6,
+  0x85,0xd9,0xf3,0x9d,0xe2,0xff,0x5e,0xb7,0xf3,0x07,0x7b,0xf2,0x00,0x73,0xf1,0x5e,
+  0xb0,0xec,0xeb,0xf8,0xfe,0xa6,0xe2,0xff,0x8a,0xd5,0xfc,0x76,0xda,0xf1,0x80,0xcc,
+  0xff,0x88,0xd2,0xff,0x4e,0xab,0xf1,0x06,0x73,0xec,0x05,0x72,0xeb,0x4a,0xa6,0xf3,
+  0xe4,0xfd,0xff,0xab,0xe7,0xff,0x70,0xd2,0xff,0x85,0xd0,0xf7,0x80,0xcb,0xf5,0x70,
+  0xc9,0xf3,0x6f,0xc6,0xfb,0x6c,0xcd,0xee,0x38,0x9f,0xea,0x0d,0x6a,0xeb,0x09,0x6c,
+  0xeb,0x59,0xa5,0xf1,0xf3,0xff,0xff,0xba,0xe7,0xfc,0x71,0xcc,0xf8,0x7a,0xd3,0xf5,
+  0x76,0xc9,0xf1,0x68,0xc8,0xfa,0x61,0xc0,0xf6,0x51,0xc3,0xf7,0x4f,0xc5,0xf5,0x5f,
+  0xcb,0xf9,0x2f,0x97,0xf0,0x0c,0x63,0xe6,0x0f,0x83,0xea,0x31,0x99,0xee,0xa5,0xe7,
+  0xff,0x8b,0xd2,0xfe,0x78,0xd5,0xfe,0x76,0xc7,0xf2,0x6e,0xc4,0xf7,0x5a,0xca,0xfc,
+  0x57,0xc4,0xef,0x55,0xc3,0xf8,0x45,0xad,0xec,0x3b,0x99,0xdf,0x35,0x9a,0xea,0x3c,
+  0xa8,0xff,0x1b,0x84,0xed,0x06,0x64,0xe0,0x04,0x85,0xeb,0x26,0x9a,0xf1,0x18,0x8e,
+  0xe5,0x10,0x75,0xdd,0x42,0xa6,0xf2,0xb7,0xe9,0xff,0x63,0xc3,0xf6,0x51,0xbd,0xee,
+  0x58,0xb7,0xfb,0x49,0xb5,0xf5,0x3f,0xae,0xe5,0x14,0x7c,0xd5,0x20,0x71,0xca,0x14,
+  0x6c,0xe7,0x14,0x75,0xe8,0x0c,0x6d,0xe2,0x34,0xa3,0xf5,0xbd,0xe6,0xff,0x69,0xc1,
+  0xef,0x49,0xb4,0xe8,0x42,0xb4,0xf2,0x3f,0xb8,0xff,0x33,0xa4,0xe0,0x2f,0x85,0xd8,
+  0x22,0xa7,0xea,0xaa,0xde,0xf4,0x52,0xbc,0xf8,0x3f,0xb0,0xf6,0x3c,0xad,0xf3,0x30,
+  0xa8,0xf6,0x2b,0x9b,0xe5,0x1a,0x7b,0xdc,0x26,0x99,0xea,0xac,0xde,0xff,0x3d,0xb4,
+  0xf6,0x2c,0xa8,0xe6,0x2b,0xa4,0xf3,0x28,0xa4,0xee,0x27,0x95,0xea,0x16,0x77,0xe0,
+  0x2a,0x92,0xf5,0x8e,0xd3,0xf2,0x44,0xaf,0xe5,0x28,0xa0,0xf7,0x20,0xa4,0xec,0x19,
+  0x9d,0xe8,0x17,0x87,0xed,0x0f,0x71,0xde,0x26,0x86,0xec,0x7d,0xd2,0xf9,0x30,0xa7,
+  0xe9,0x1b,0x94,0xf1,0x1d,0x90,0xeb,0x18,0x91,0xea,0x15,0x81,0xe6,0x14,0x6c,0xda,
+  0x1d,0x8a,0xef,0x53,0xc3,0xf1,0x19,0xa2,0xf0,0x1c,0x98,0xf0,0x1a,0x90,0xf4,0x0a,
+  0x8a,0xeb,0x07,0x7d,0xdf,0x10,0x67,0xdb,0x23,0x5c,0xdd,0x03,0x62,0xd6,0x05,0x65,
+  0xd5,0x0b,0x5a,0xdd,0x0a,0x4e,0xd5,0x00,0x51,0xcb,0x00,0x4e,0xcf,0x17,0x47,0xcf,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x08,
+  0xbf,0x00,0x01,0x08,0x1c,0x08,0x20,0x80,0x00,0x82,0x08,0x09,0x0e,0x20,0x50,0xc0,
+  0x40,0x42,0x84,0x07,0x10,0x24,0x50,0xb0,0x80,0xc1,0x43,0x81,0x0d,0x1c,0x3c,0x80,
+  0x10,0x41,0xc2,0x04,0x0a,0x0f,0x2b,0x58,0xb8,0x80,0x21,0x83,0x86,0x0d,0x1c,0x3a,
+  0x78,0x40,0xf8,0x01,0x44,0x08,0x11,0x23,0x48,0x94,0x30,0x71,0x02,0x45,0x0a,0x15,
+  0x03,0x57,0xb0,0x68,0xe1,0xe2,0x05,0x8c,0x18,0x32,0x66,0xd0,0xa8,0x61,0xe3,0x06,
+  0x0e,0x00,0x39,0x74,0xec,0xe0,0xd1,0xc3,0xc7,0x0f,0x20,0x41,0x84,0x0c,0x21,0x52,
+  0xc4,0xc8,0x11,0x24,0x49,0x94,0x2c,0x61,0xd2,0xc4,0xc9,0x13,0x28,0x51,0xa4,0x4c,
+  0xa1,0x52,0xc5,0xca,0x15,0x2c,0x04,0xb3,0x68,0xd9,0xc2,0xa5,0x8b,0x97,0x2f,0x60,
+  0x2e,0x86,0x11,0x33,0x86,0x4c,0x19,0x33,0x67,0xd0,0x5c,0x4c,0xa3,0x66,0x0d,0x9b,
+  0x36,0x6e,0xde,0xc0,0xb9,0x18,0x47,0xce,0x1c,0x3a,0x75,0xec,0xdc,0xc1,0x73,0x31,
+  0x8f,0x9e,0x3d,0x7c,0xfa,0xf8,0xf9,0x03,0xe8,0x62,0x20,0x41,0x83,0x08,0x15,0x32,
+  0x74,0x08,0xd1,0xc5,0x44,0x8a,0x16,0x31,0x6a,0xe4,0xe8,0x11,0x24,0x82,0x01,0x01,
+  0x00,0x3b
+  };
+
+/* Created by reswrap from file godown_gif.gif */
+const unsigned char godown_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf7,0x00,0x00,0xfa,0xfc,0xf9,
+  0x24,0xaa,0xdf,0x63,0xbd,0xef,0x31,0xaf,0xea,0x33,0xa1,0xec,0x27,0x9c,0xe1,0x28,
+  0x96,0xd5,0x1f,0x8e,0xc6,0x1d,0x69,0xc1,0x41,0xb0,0xe7,0xf3,0xff,0xff,0x9a,0xfa,
+  0xf9,0x8c,0xf2,0xff,0x86,0xef,0xf5,0x7b,0xe9,0xff,0x60,0xe7,0xff,0x03,0x63,0xc9,
+  0x44,0xab,0xfa,0xea,0xfb,0xff,0x8c,0xe2,0xfb,0x7b,0xe3,0xff,0x72,0xd6,0xfa,0x60,
+  0xc8,0xfb,0x55,0xdb,0xfe,0x02,0x5f,0xc9,0x44,0xab,0xf0,0xdc,0xfe,0xff,0x87,0xe2,
+  0xff,0x72,0xda,0xfd,0x68,0xd0,0xff,0x62,0xcd,0xff,0x49,0xc8,0xf3,0x0b,0x5d,0xc0,
+  0x3b,0xab,0xeb,0xdf,0xfc,0xff,0x74,0xe2,0xf3,0x65,0xdd,0xf6,0x53,0xd1,0xf7,0x4c,
+  0xd0,0xf7,0x3a,0xc5,0xfc,0x07,0x62,0xbf,0x35,0xa5,0xe4,0xdc,0xfb,0xfd,0x75,0xe1,
+  0xfe,0x60,0xcd,0xf6,0x55,0xca,0xf6,0x45,0xc1,0xf7,0x34,0xbd,0xff,0x07,0x61,0xc2,
+  0x36,0xa3,0xe8,0xd6,0xff,0xfa,0x70,0xd1,0xfe,0x54,0xcf,0xfb,0x49,0xc6,0xf4,0x3e,
+  0xbc,0xf9,0x25,0xb4,0xf6,0x03,0x62,0xbc,0x27,0x92,0xda,0x3c,0xb0,0xfb,0x46,0xb7,
+  0xef,0x09,0xa5,0xef,0x40,0xa3,0xde,0xc2,0xf9,0xff,0x66,0xd0,0xea,0x4b,0xc9,0xef,
+  0x4a,0xba,0xf9,0x29,0xb6,0xee,0x1c,0xaa,0xf6,0x06,0x6d,0xca,0x00,0x4b,0xc3,0x0a,
+  0x51,0xc5,0x00,0x53,0xbd,0x00,0x57,0xc8,0x00,0x4e,0xbb,0x43,0xaa,0xf7,0xbc,0xff,
+  0xf3,0xc0,0xff,0xff,0x6f,0xd7,0xfc,0x63,0xd4,0xfc,0x50,0xcf,0xfa,0x4a,0xc8,0xf0,
+  0x2d,0xb8,0xf1,0x23,0xa8,0xf5,0x0e,0x99,0xea,0x0a,0x95,0xe8,0x02,0x92,0xd8,0x1e,
+  0xbd,0xf4,0x08,0x7c,0xd3,0x15,0x52,0xab,0x07,0x55,0xb9,0x48,0xa1,0xe5,0xcf,0xff,
+  0xfc,0x9f,0xe7,0xfd,0x49,0xc6,0xfe,0x4c,0xce,0xf0,0x37,0xbf,0xef,0x30,0xaf,0xf4,
+  0x1e,0xa1,0xfb,0x08,0x9a,0xe7,0x00,0x8a,0xe3,0x0d,0xb2,0xea,0x00,0x73,0xe0,0x01,
+  0x59,0xba,0x00,0x56,0xbf,0x43,0xa4,0xe9,0xb8,0xf2,0xfe,0x73,0xd3,0xfb,0x37,0xb9,
+  0xf7,0x31,0xb7,0xec,0x1f,0xa7,0xff,0x0e,0x9a,0xe9,0x03,0x88,0xe5,0x11,0xaa,0xee,
+  0x13,0x74,0xd2,0x26,0x66,0xd4,0x09,0x54,0xba,0x32,0x9f,0xe0,0x8e,0xe9,0xfb,0x38,
+  0xb9,0xf0,0x13,0xa6,0xe9,0x20,0xaa,0xf3,0x00,0x8d,0xdc,0x03,0x9f,0xea,0x09,0x74,
+  0xd4,0x0e,0x6a,0xcf,0x05,0x59,0xbc,0x18,0x95,0xd8,0x6d,0xe0,0xfd,0x2a,0xb7,0xfe,
+  0x00,0x85,0xdc,0x06,0x9e,0xf4,0x05,0x74,0xd0,0x10,0x68,0xc9,0x08,0x5e,0xc3,0x25,
+  0x8f,0xd9,0x77,0xd7,0xef,0x25,0xc5,0xf5,0x12,0x7d,0xc5,0x23,0x63,0xcd,0x16,0x5d,
+  0xc9,0x41,0x93,0xdf,0x5a,0xbf,0xf7,0x10,0x63,0xc3,0x06,0x62,0xc5,0x25,0x63,0xae,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x08,
+  0xc2,0x00,0x01,0x08,0x04,0x10,0x40,0xc0,0x00,0x02,0x05,0x0c,0x1c,0x40,0x30,0xb0,
+  0x21,0x80,0x04,0x0a,0x16,0x30,0x68,0xe0,0xe0,0x01,0x04,0x87,0x03,0x23,0x48,0x98,
+  0x40,0xa1,0x82,0x85,0x0b,0x18,0x30,0x0a,0xcc,0xa0,0x61,0x03,0x87,0x0e,0x1e,0x3e,
+  0x80,0x10,0x09,0x20,0x84,0x88,0x11,0x24,0x4a,0x98,0x38,0x81,0x82,0x65,0x0a,0x15,
+  0x2b,0x58,0xb4,0x70,0xf1,0x02,0x06,0xcb,0x18,0x32,0x66,0xd0,0xa8,0x61,0xe3,0x06,
+  0x8e,0x86,0x39,0x74,0xec,0xe0,0xd1,0xc3,0xc7,0x0f,0x20,0x41,0x84,0x0c,0x21,0x52,
+  0xc4,0xc8,0x11,0x24,0x49,0x94,0x2c,0x61,0xd2,0xc4,0xc9,0x13,0x28,0x51,0xa4,0x4c,
+  0xa1,0x52,0xc5,0xca,0x15,0x2c,0x00,0xb2,0x68,0xd9,0xc2,0xa5,0x8b,0x97,0x2f,0x60,
+  0xc2,0x88,0x19,0x43,0xa6,0x8c,0x99,0x81,0x67,0xd0,0xa4,0x51,0xb3,0x86,0x4d,0x1b,
+  0x37,0x6f,0xe0,0xc4,0x91,0xe3,0x70,0x0e,0x9d,0x3a,0x76,0xee,0xe0,0xc9,0xa3,0x67,
+  0x0f,0x1f,0x91,0x7d,0xfc,0xfc,0x01,0x14,0x48,0xd0,0x20,0x42,0x2c,0x01,0x14,0x32,
+  0x74,0x08,0x51,0x22,0x45,0x99,0x05,0x2e,0x62,0xd4,0xc8,0x51,0xe8,0x81,0x8f,0x20,
+  0x89,0x0c,0x08,0x00,0x3b
+  };
+
+/* Created by reswrap from file goback_gif.gif */
+const unsigned char goback_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf7,0x00,0x00,0x07,0x83,0xef,
+  0x0b,0x82,0xed,0x04,0x71,0xed,0x31,0xa0,0xee,0x25,0x95,0xed,0x00,0x6f,0xed,0x55,
+  0xaa,0xf1,0x9f,0xe3,0xfa,0x1b,0x8f,0xed,0x00,0x70,0xee,0x50,0xac,0xf1,0xf1,0xfd,
+  0xfe,0x93,0xd5,0xf9,0x03,0x78,0xea,0x00,0x78,0xef,0x5c,0xb3,0xf2,0xe4,0xf8,0xfe,
+  0xbf,0xe7,0xfc,0x7c,0xd1,0xf8,0x43,0xa9,0xf3,0x37,0xa1,0xf1,0x31,0xa0,0xf0,0x2b,
+  0x9a,0xef,0x25,0x91,0xed,0x21,0x88,0xec,0x21,0x8a,0xec,0x0f,0x64,0xdf,0x00,0x7d,
+  0xf1,0x68,0xbb,0xf5,0xeb,0xfa,0xff,0xad,0xe1,0xfb,0x70,0xce,0xf9,0x70,0xcc,0xf8,
+  0xb6,0xe7,0xfb,0xbe,0xea,0xfa,0xab,0xe2,0xf9,0x9c,0xde,0xf8,0x8a,0xd8,0xf6,0x7f,
+  0xd4,0xf6,0x4e,0xc3,0xf6,0x09,0x62,0xd9,0x01,0x86,0xf3,0x70,0xc1,0xf5,0xec,0xfa,
+  0xff,0xad,0xe2,0xfc,0x7d,0xd1,0xf9,0x7a,0xcf,0xf8,0x68,0xc8,0xf7,0x6a,0xc5,0xf6,
+  0x61,0xc2,0xf4,0x53,0xbb,0xf3,0x47,0xb4,0xf2,0x3d,0xae,0xf0,0x32,0xa5,0xef,0x20,
+  0x9f,0xf0,0x09,0x60,0xda,0x0e,0x95,0xf2,0x87,0xcf,0xf8,0xec,0xf9,0xff,0xac,0xe1,
+  0xfc,0x83,0xd5,0xf9,0x7f,0xd2,0xf8,0x72,0xcb,0xf7,0x63,0xc5,0xf6,0x54,0xbd,0xf4,
+  0x44,0xb5,0xf3,0x3b,0xaf,0xf2,0x32,0xa6,0xf0,0x26,0x9f,0xef,0x1d,0x95,0xed,0x18,
+  0x97,0xf0,0x08,0x59,0xd6,0x14,0x97,0xf3,0x9b,0xdc,0xf9,0xd0,0xef,0xfe,0x88,0xd7,
+  0xfa,0x83,0xd3,0xf9,0x77,0xcf,0xf8,0x69,0xc8,0xf7,0x5b,0xc1,0xf5,0x51,0xbb,0xf4,
+  0x45,0xb6,0xf2,0x39,0xac,0xf1,0x30,0xa5,0xf0,0x26,0x9d,0xee,0x1c,0x94,0xed,0x15,
+  0x91,0xef,0x06,0x54,0xd0,0x0c,0x88,0xf1,0x71,0xc6,0xf6,0x9f,0xe1,0xfc,0x7a,0xce,
+  0xf9,0x6d,0xca,0xf7,0x61,0xc3,0xf6,0x55,0xc0,0xf6,0x4a,0xba,0xf6,0x3e,0xb3,0xf4,
+  0x33,0xaa,0xf3,0x29,0xa3,0xf1,0x1f,0x9a,0xf0,0x17,0x92,0xef,0x0f,0x8b,0xee,0x02,
+  0x4e,0xce,0x0a,0x7f,0xee,0x5f,0xbb,0xf4,0x85,0xd8,0xfa,0x65,0xc7,0xf7,0x59,0xc0,
+  0xf6,0x4a,0xaf,0xed,0x41,0xaa,0xea,0x35,0xa5,0xe7,0x2b,0x9e,0xe8,0x21,0x93,0xe7,
+  0x19,0x89,0xe4,0x11,0x82,0xe2,0x0a,0x7d,0xe3,0x00,0x4b,0xcb,0x09,0x77,0xed,0x4a,
+  0xae,0xef,0x6f,0xd0,0xf9,0x54,0xc0,0xf7,0x37,0x97,0xdf,0x21,0x78,0xd7,0x25,0x82,
+  0xe0,0x1f,0x78,0xdc,0x19,0x78,0xdc,0x13,0x72,0xdb,0x0f,0x6b,0xda,0x0a,0x68,0xda,
+  0x08,0x50,0xd3,0x08,0x6f,0xe9,0x39,0xa1,0xee,0x5d,0xcb,0xf8,0x36,0x9b,0xe9,0x0e,
+  0x70,0xdc,0x07,0x69,0xe7,0x2e,0x9a,0xed,0x3e,0xb0,0xf0,0x10,0x6e,0xe2,0x0a,0x67,
+  0xe6,0x1a,0x80,0xe5,0x16,0x78,0xe5,0x08,0x65,0xe5,0x0c,0x6a,0xe4,0x00,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x90,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x08,
+  0xc2,0x00,0x21,0x09,0x1c,0x08,0x09,0x40,0x00,0x82,0x08,0x09,0x0a,0x18,0x40,0x20,
+  0x61,0xc2,0x02,0x06,0x0e,0x20,0x70,0x48,0x30,0x81,0x82,0x05,0x0c,0x1a,0x50,0x14,
+  0xe8,0xe0,0x01,0x84,0x08,0x12,0x26,0x50,0xa8,0x60,0xe1,0x02,0x86,0x0c,0x1a,0x04,
+  0x6e,0xe0,0xd0,0xc1,0xc3,0x07,0x10,0x21,0x44,0x8c,0x20,0x51,0xc2,0xc4,0x09,0x14,
+  0x90,0x52,0xa8,0x58,0xc1,0xa2,0x85,0x8b,0x17,0x30,0x62,0xc8,0x98,0x41,0xa3,0x86,
+  0x8d,0x1b,0x38,0x72,0xe8,0xd8,0xc1,0xa3,0x87,0x8f,0x1f,0x40,0x82,0x08,0x19,0x42,
+  0xa4,0x88,0x91,0x23,0x48,0x92,0x28,0x59,0xc2,0xa4,0x89,0x93,0x27,0x50,0xa2,0x48,
+  0x99,0x42,0xa5,0x8a,0x95,0x2b,0x90,0xb0,0x64,0xd1,0xb2,0x85,0x4b,0x17,0x2f,0x5f,
+  0xc0,0x84,0x11,0x33,0x86,0x4c,0x19,0x33,0x02,0xcf,0xa0,0x49,0xa3,0x66,0x0d,0x9b,
+  0x36,0x6e,0xde,0xc0,0x89,0x23,0x67,0x0e,0x9d,0x81,0x75,0xec,0xdc,0xc1,0x93,0x47,
+  0xcf,0x1e,0x3e,0x7d,0xfc,0xfc,0x01,0x14,0x88,0xa0,0xa0,0x41,0x84,0x0a,0x19,0xda,
+  0x38,0xf0,0x10,0xa2,0x44,0x8a,0x38,0x0f,0x5c,0xc4,0xa8,0x91,0xe8,0x81,0x8e,0x1e,
+  0x39,0x0c,0x08,0x00,0x3b
+  };
+
+/* Created by reswrap from file goforw_gif.gif */
+const unsigned char goforw_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf7,0x00,0x00,0x00,0xff,0xff,
+  0x26,0x8a,0xda,0x08,0x57,0xc1,0x33,0xbe,0xf8,0x41,0xa5,0xe4,0x05,0x55,0xc1,0x3b,
+  0xb8,0xf3,0xc8,0xfe,0xff,0x3f,0xa6,0xe5,0x05,0x56,0xc1,0x1a,0xa0,0xec,0xc8,0xfb,
+  0xff,0xcc,0xfc,0xff,0x40,0xa5,0xe5,0x07,0x57,0xc1,0x2a,0xa4,0xee,0x44,0xb1,0xee,
+  0x3e,0xab,0xed,0x3d,0xaa,0xec,0x3c,0xa8,0xeb,0x3d,0xa8,0xea,0x37,0xa0,0xe8,0x3b,
+  0xa3,0xe7,0x67,0xde,0xfd,0xa2,0xe9,0xfd,0xb1,0xf3,0xff,0x2e,0x9f,0xe5,0x09,0x58,
+  0xc2,0x5a,0xbc,0xf1,0xfa,0xff,0xff,0xe3,0xff,0xff,0xe0,0xff,0xff,0xdd,0xfe,0xff,
+  0xd8,0xfc,0xff,0xd9,0xfd,0xff,0xc7,0xf7,0xff,0x63,0xd4,0xfb,0x47,0xc9,0xf8,0x74,
+  0xd4,0xf7,0x8c,0xe6,0xfe,0x1f,0x93,0xe3,0x0d,0x5d,0xc4,0x38,0xac,0xed,0x9d,0xf4,
+  0xff,0x89,0xe7,0xfe,0x80,0xe3,0xfe,0x7a,0xe0,0xfd,0x71,0xdc,0xfb,0x69,0xd7,0xfb,
+  0x61,0xd2,0xfa,0x55,0xcd,0xf7,0x51,0xc9,0xf6,0x36,0xbd,0xf5,0x38,0xbd,0xf2,0x6e,
+  0xdc,0xfc,0x2c,0x92,0xde,0x0b,0x5d,0xc4,0x31,0xa2,0xe9,0x8e,0xf0,0xff,0x7a,0xe1,
+  0xfd,0x72,0xdc,0xfc,0x60,0xd2,0xf9,0x55,0xcb,0xf8,0x4e,0xc8,0xf7,0x47,0xc5,0xf5,
+  0x3c,0xbd,0xf4,0x34,0xb5,0xf3,0x1b,0xa7,0xef,0x2b,0xb6,0xf2,0x75,0xd6,0xf5,0x3b,
+  0x96,0xdd,0x0d,0x60,0xc5,0x2e,0x98,0xe3,0x83,0xeb,0xff,0x6f,0xda,0xfb,0x65,0xd3,
+  0xf9,0x5c,0xcf,0xf9,0x52,0xc9,0xf7,0x49,0xc7,0xf6,0x40,0xbf,0xf5,0x35,0xb6,0xf3,
+  0x2c,0xb0,0xf1,0x21,0xa9,0xef,0x18,0xa4,0xed,0x00,0x8a,0xe6,0x29,0xbf,0xf6,0x65,
+  0xbd,0xed,0x11,0x65,0xc9,0x28,0x91,0xde,0x76,0xe6,0xff,0x63,0xd0,0xfa,0x56,0xcd,
+  0xf8,0x4d,0xca,0xf7,0x43,0xc4,0xf6,0x39,0xbd,0xf4,0x2f,0xb3,0xf2,0x24,0xa8,0xef,
+  0x1a,0xa4,0xee,0x0e,0x9c,0xec,0x02,0x8f,0xe6,0x00,0x9b,0xef,0x16,0x7c,0xd2,0x12,
+  0x63,0xc7,0x25,0x8c,0xdc,0x67,0xe7,0xff,0x55,0xd5,0xff,0x47,0xcd,0xfd,0x3e,0xc6,
+  0xfc,0x33,0xbc,0xf8,0x27,0xb4,0xf5,0x1c,0xab,0xf3,0x12,0x9f,0xed,0x05,0x95,0xe9,
+  0x00,0x8c,0xe4,0x02,0x9e,0xed,0x0c,0x72,0xce,0x17,0x68,0xc9,0x13,0x67,0xca,0x06,
+  0x5e,0xc4,0x07,0x5e,0xc4,0x08,0x5f,0xc5,0x09,0x60,0xc5,0x0a,0x60,0xc5,0x0b,0x61,
+  0xc5,0x09,0x67,0xca,0x00,0x93,0xe9,0x00,0x8b,0xe1,0x0e,0xa9,0xf0,0x0a,0x73,0xd0,
+  0x18,0x68,0xc9,0x00,0x51,0xbe,0x01,0x91,0xe6,0x15,0xad,0xf0,0x08,0x76,0xd4,0x19,
+  0x68,0xc9,0x23,0xba,0xf4,0x08,0x77,0xd5,0x1a,0x68,0xc9,0x00,0x54,0xbf,0x0b,0x7a,
+  0xd4,0x00,0x55,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x08,
+  0xc1,0x00,0x01,0x08,0x1c,0x08,0x20,0x80,0x00,0x82,0x08,0x11,0x0e,0x20,0x50,0x20,
+  0xa1,0x43,0x03,0x07,0x10,0x24,0x70,0x88,0x50,0xc1,0x02,0x06,0x0d,0x1c,0x10,0x7c,
+  0x00,0x21,0x82,0x84,0x09,0x14,0x2a,0x58,0xb8,0x80,0x21,0x83,0x86,0x0d,0x03,0x39,
+  0x74,0xf0,0xf0,0x01,0x44,0x08,0x11,0x23,0x48,0x94,0x30,0x71,0x02,0x45,0x0a,0x81,
+  0x2a,0x56,0xb0,0x68,0xe1,0xe2,0x05,0x8c,0x18,0x32,0x66,0xd0,0xa8,0x61,0xe3,0x06,
+  0x0e,0x00,0x39,0x74,0xec,0xe0,0x01,0xa3,0x87,0x8f,0x1f,0x40,0x82,0x08,0x19,0x42,
+  0xa4,0x88,0x91,0x23,0x48,0x92,0x28,0x59,0xc2,0xa4,0x89,0x93,0x27,0x50,0xa2,0x48,
+  0x99,0x42,0xa5,0x8a,0x95,0x2b,0x58,0xb2,0x68,0xd9,0xc2,0xa5,0x8b,0x97,0x2f,0x60,
+  0xc2,0x88,0x19,0x43,0xa6,0x8c,0x19,0x00,0x67,0xd0,0xa4,0x51,0xb3,0x86,0x4d,0x1b,
+  0x37,0x6f,0xe0,0xc4,0x91,0x33,0x87,0x8e,0xc0,0x3a,0x76,0xee,0xe0,0xc9,0xa3,0x67,
+  0x0f,0x9f,0x3e,0x7e,0xfe,0x00,0x0a,0x44,0x51,0xa0,0xa0,0x41,0x84,0x0a,0x19,0xaa,
+  0x6c,0xf9,0x10,0xa2,0x44,0x9c,0x05,0x2a,0x5a,0xc4,0x28,0xb4,0x40,0x46,0xa5,0x13,
+  0x06,0x04,0x00,0x3b
+  };
+
+/* Created by reswrap from file gotodir.bmp */
+const unsigned char gotodir[]={
+  0x42,0x4d,0x52,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x04,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0x00,0x00,0x6d,0x0b,0x00,0x00,0x6d,0x0b,0x00,0x00,0x07,0x00,
+  0x00,0x00,0x07,0x00,0x00,0x00,0xdc,0xc0,0xb2,0x00,0x80,0x80,0x80,0x00,0xff,0xff,
+  0xff,0x00,0x00,0xff,0xff,0x00,0xc0,0xc0,0xc0,0x00,0x00,0x00,0xff,0x00,0x00,0x80,
+  0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+  0x66,0x66,0x00,0x00,0x00,0x00,0x12,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
+  0x43,0x46,0x00,0x00,0x00,0x00,0x12,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,
+  0x34,0x36,0x00,0x00,0x00,0x00,0x12,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
+  0x43,0x46,0x00,0x00,0x00,0x00,0x12,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,
+  0x34,0x36,0x00,0x00,0x00,0x00,0x12,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
+  0x43,0x46,0x00,0x00,0x00,0x00,0x12,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,
+  0x34,0x36,0x00,0x00,0x50,0x00,0x12,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
+  0x43,0x46,0x00,0x00,0x55,0x00,0x12,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,
+  0x34,0x36,0x00,0x00,0x55,0x50,0x12,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
+  0x43,0x46,0x00,0x00,0x55,0x55,0x12,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,
+  0x34,0x36,0x55,0x55,0x55,0x55,0x52,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
+  0x43,0x46,0x55,0x55,0x55,0x55,0x55,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,
+  0x34,0x36,0x55,0x55,0x55,0x55,0x52,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
+  0x43,0x46,0x00,0x00,0x55,0x55,0x12,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,
+  0x34,0x36,0x00,0x00,0x55,0x50,0x12,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x22,
+  0x22,0x22,0x00,0x00,0x55,0x00,0x14,0x44,0x44,0x44,0x44,0x44,0x44,0x11,0x11,0x11,
+  0x11,0x10,0x00,0x00,0x50,0x00,0x01,0x23,0x43,0x43,0x43,0x43,0x41,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x34,0x34,0x34,0x34,0x10,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00
+  };
+
+/* Created by reswrap from file home_gif.gif */
+const unsigned char home_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf6,0x00,0x00,0x00,0x00,0x00,
+  0x58,0x58,0x58,0x95,0x00,0x04,0x69,0x00,0x0c,0x1f,0x17,0x00,0xf3,0xef,0xaa,0x9e,
+  0x88,0x24,0xa7,0x00,0x14,0xa1,0x00,0x3d,0xa6,0x89,0x22,0xb4,0x96,0x17,0xaa,0x87,
+  0x15,0xc8,0xa0,0x0c,0x9b,0x75,0x08,0xcc,0xcf,0xb6,0xff,0xff,0xf2,0xd4,0xaf,0x17,
+  0x20,0x19,0x00,0x94,0x74,0x12,0xce,0xd1,0xb9,0xff,0xff,0xff,0xff,0xff,0xd9,0xff,
+  0xff,0xcc,0xc6,0xaa,0x25,0x87,0x6d,0x15,0xd1,0xd4,0xc0,0xff,0xff,0xcd,0xfa,0xfa,
+  0xbd,0xc9,0xad,0x29,0x85,0x68,0x0f,0xd0,0xd2,0xc0,0xfe,0xfe,0xfd,0xff,0xff,0xde,
+  0xf4,0xf4,0xae,0xdc,0xba,0x24,0xde,0xe0,0xd0,0xff,0xff,0xf6,0xff,0xff,0xd7,0xff,
+  0xff,0xdb,0xff,0xff,0xbf,0x09,0x0a,0x06,0x80,0x80,0x80,0xdc,0xde,0xcd,0xff,0xff,
+  0xcf,0xff,0xff,0xc3,0xff,0xff,0xc9,0xff,0xff,0xca,0xdc,0xdc,0xdc,0xff,0xff,0xc1,
+  0x9b,0x6f,0x00,0xff,0xff,0xc7,0xf3,0xef,0x98,0xe9,0xce,0x43,0xe9,0xb5,0x00,0xe4,
+  0xe4,0x98,0xff,0xff,0xd5,0xff,0xff,0xb5,0xff,0xc4,0x00,0xf9,0xa7,0x00,0xff,0xff,
+  0xc5,0xf7,0xa8,0x00,0xcd,0x8c,0x00,0xe4,0xe4,0xaa,0xca,0x8b,0x00,0x00,0xff,0xff,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x40,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x07,
+  0xab,0x80,0x40,0x82,0x83,0x40,0x01,0x01,0x82,0x02,0x03,0x84,0x8b,0x04,0x05,0x06,
+  0x04,0x40,0x07,0x08,0x8b,0x83,0x8d,0x09,0x05,0x0a,0x04,0x92,0x94,0x40,0x8d,0x0b,
+  0x04,0x8d,0x0c,0x04,0x93,0x8c,0x05,0x0d,0x04,0x0e,0x0f,0x8d,0x10,0x11,0xa5,0x12,
+  0x04,0x13,0x14,0x15,0x16,0x8d,0x17,0x90,0x82,0x8d,0x18,0x04,0x19,0x14,0xbd,0x1a,
+  0x1b,0x8d,0x1c,0x90,0x8d,0x1d,0x04,0x1e,0x1f,0xbe,0x14,0x20,0x21,0x8d,0x22,0xa0,
+  0xa0,0x23,0xbd,0x14,0x24,0x14,0x25,0x14,0x26,0x27,0x04,0x28,0x90,0x29,0x2a,0xbd,
+  0x2b,0x2c,0x2d,0x2d,0x14,0x2b,0x14,0x2e,0x2f,0xb7,0x29,0xbd,0x30,0x14,0x31,0xee,
+  0x00,0x14,0xec,0xe8,0x82,0xea,0x32,0x14,0x33,0x31,0x34,0x35,0x00,0x36,0x14,0x27,
+  0xf3,0x40,0x52,0xdc,0xa0,0x80,0xa3,0x5d,0x0e,0x1d,0xf0,0x0a,0x02,0x54,0xb7,0x83,
+  0x42,0x81,0x18,0x3c,0x7a,0x00,0xf0,0x41,0x61,0xc7,0xc2,0x17,0x18,0x5f,0xc4,0xf8,
+  0x11,0x03,0x40,0x46,0x80,0xcf,0x42,0x8a,0x04,0x05,0x24,0x10,0x00,0x3b
+  };
+
+/* Created by reswrap from file hosts.bmp */
+const unsigned char hosts[]={
+  0x42,0x4d,0x86,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x01,0x00,0x08,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x01,0x00,0x00,0x6d,0x0b,0x00,0x00,0x6d,0x0b,0x00,0x00,0x14,0x00,
+  0x00,0x00,0x14,0x00,0x00,0x00,0xde,0xdf,0xde,0x00,0xc6,0xc7,0xc6,0x00,0x73,0x71,
+  0x73,0x00,0xdc,0xc0,0xb2,0x00,0xce,0x61,0x31,0x00,0xff,0x61,0x31,0x00,0x9c,0x61,
+  0x31,0x00,0xb5,0xb6,0xb5,0x00,0x63,0x61,0x63,0x00,0x5a,0x59,0x5a,0x00,0xce,0xcf,
+  0xce,0x00,0x94,0x96,0x94,0x00,0xa5,0xa6,0xa5,0x00,0x84,0x86,0x84,0x00,0x63,0xff,
+  0x31,0x00,0x31,0x30,0x31,0x00,0x31,0xff,0xff,0x00,0x00,0x9e,0xff,0x00,0x00,0x61,
+  0xce,0x00,0x00,0x41,0x84,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x08,0x08,0x08,
+  0x08,0x08,0x08,0x08,0x08,0x03,0x09,0x09,0x09,0x12,0x13,0x0f,0x0c,0x0c,0x0c,0x0c,
+  0x0c,0x0b,0x0b,0x0b,0x09,0x08,0x0c,0x00,0x00,0x10,0x11,0x00,0x01,0x0e,0x01,0x01,
+  0x01,0x02,0x02,0x02,0x09,0x09,0x03,0x03,0x03,0x00,0x0f,0x03,0x07,0x00,0x00,0x07,
+  0x0d,0x02,0x0d,0x0d,0x0d,0x09,0x03,0x03,0x03,0x07,0x0f,0x03,0x03,0x03,0x03,0x01,
+  0x0b,0x08,0x03,0x03,0x03,0x03,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x00,0x01,0x01,0x07,
+  0x0b,0x0b,0x0b,0x0b,0x08,0x03,0x00,0x0e,0x07,0x07,0x0b,0x0d,0x00,0x05,0x05,0x04,
+  0x06,0x06,0x06,0x0c,0x08,0x03,0x07,0x00,0x07,0x0d,0x02,0x08,0x00,0x04,0x05,0x04,
+  0x04,0x06,0x06,0x0c,0x08,0x09,0x03,0x03,0x0a,0x0b,0x08,0x03,0x00,0x05,0x05,0x04,
+  0x06,0x06,0x06,0x0c,0x08,0x09,0x00,0x01,0x01,0x07,0x07,0x0b,0x00,0x05,0x05,0x04,
+  0x06,0x06,0x06,0x0c,0x08,0x09,0x00,0x04,0x05,0x06,0x04,0x06,0x00,0x04,0x05,0x05,
+  0x04,0x06,0x06,0x0b,0x08,0x02,0x00,0x05,0x04,0x05,0x06,0x06,0x00,0x00,0x0a,0x0a,
+  0x0a,0x01,0x01,0x01,0x02,0x03,0x00,0x04,0x05,0x04,0x06,0x06,0x06,0x07,0x08,0x09,
+  0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x05,0x05,0x04,0x04,0x06,0x06,0x07,0x08,0x09,
+  0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x04,0x05,0x05,0x04,0x06,0x06,0x07,0x08,0x02,
+  0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x02,0x03,
+  0x03,0x03,0x03,0x03,0x03,0x03
+  };
+
+/* Created by reswrap from file iconpath.gif */
+const unsigned char iconpath[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x20,0x00,0x20,0x00,0xe3,0x00,0x00,0xb2,0xc0,0xdc,
+  0x9f,0x9f,0x00,0xff,0xff,0xff,0xff,0xff,0x9f,0xff,0xff,0xf0,0xcf,0xcf,0x60,0xff,
+  0xcf,0x9f,0x80,0x80,0x80,0x00,0x00,0x00,0x80,0x80,0x00,0xc0,0xc0,0xc0,0x00,0xff,
+  0xff,0x30,0x30,0x00,0x00,0x80,0x80,0x00,0x00,0xff,0x00,0x00,0x80,0x2c,0x00,0x00,
+  0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x04,0xfe,0x10,0x48,0x10,0xaa,0xb5,0x33,0xeb,
+  0x9d,0x83,0x18,0x60,0x08,0x06,0x5c,0xa9,0x79,0x62,0x3a,0x90,0x66,0x19,0x10,0xaa,
+  0xca,0xb6,0x5d,0x61,0xdf,0x78,0x7e,0xed,0xbb,0xe4,0x09,0xc0,0xa0,0x70,0x48,0x2c,
+  0xfa,0x3e,0x22,0x83,0xe1,0xc0,0x3c,0x20,0x12,0x89,0x94,0x01,0x34,0xa5,0x0e,0x0a,
+  0x14,0x24,0x95,0xa9,0x58,0x74,0x9d,0x88,0xc3,0xb4,0x3a,0x20,0x8f,0x0b,0x0c,0xd4,
+  0x56,0x21,0x58,0xb4,0xdb,0x8a,0x46,0x38,0x49,0x25,0xa3,0xd5,0x4b,0xb6,0x7b,0xdf,
+  0x8d,0x3f,0xcb,0x21,0x64,0x65,0x77,0x48,0x4b,0x6f,0x40,0x5e,0x89,0x0a,0x4f,0x82,
+  0x80,0x67,0x69,0x48,0x07,0x5d,0x41,0x8a,0x89,0x72,0x62,0x8e,0x81,0x57,0x90,0x20,
+  0x07,0x7b,0x40,0x7d,0x8a,0x72,0x51,0x56,0x65,0x8f,0x6a,0x92,0x6e,0x02,0xa1,0xa1,
+  0x97,0x80,0xaf,0x80,0x84,0x9d,0x9f,0x95,0x7d,0xa3,0x63,0x75,0x54,0xb2,0x03,0xa9,
+  0x70,0xb5,0x0b,0xae,0x9a,0xa6,0x9b,0x78,0xbd,0xbf,0x97,0x4a,0xc3,0x4a,0xa7,0x85,
+  0x07,0x0d,0xac,0x96,0xa3,0xa5,0x55,0xcb,0xbb,0x65,0xce,0xd0,0x0d,0x97,0x08,0xc9,
+  0xdd,0xb8,0xb2,0xd4,0x08,0x08,0xda,0xe4,0xe2,0x0a,0x4c,0xdc,0xcb,0x63,0xd5,0x9c,
+  0x49,0x06,0xe2,0xf0,0x92,0xab,0x07,0x0e,0xdc,0x75,0xdd,0xbb,0xb8,0xa6,0xea,0xf2,
+  0x0b,0x0e,0xf5,0xdd,0xea,0x10,0x6a,0x44,0x8d,0x1a,0xbd,0x05,0xfe,0x00,0xaa,0x53,
+  0x62,0x4d,0x5f,0xc1,0x32,0x0f,0x1c,0x20,0xfc,0x67,0x4f,0xdd,0xc0,0x4c,0x18,0x1d,
+  0x45,0x9c,0xa8,0xf0,0x54,0x8e,0x8f,0x2a,0x1f,0x03,0x6c,0x4c,0xc8,0x20,0x07,0x03,
+  0x00,0x0c,0x52,0xaa,0x5c,0xc9,0x32,0xa5,0x84,0x91,0xff,0x58,0xd2,0xa0,0x01,0xd3,
+  0xc1,0xcc,0x9b,0x2f,0x25,0xfa,0xc3,0x89,0x73,0xa3,0x4d,0x9e,0x40,0x83,0x0a,0x95,
+  0x10,0x01,0x00,0x3b
+  };
+
+/* Created by reswrap from file link_gif.gif */
+const unsigned char link_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf4,0x00,0x00,0x29,0x34,0x40,
+  0xa1,0xaa,0xb4,0xff,0xff,0xff,0x71,0x7a,0x85,0x60,0x6c,0x76,0xae,0xb8,0xc3,0xcb,
+  0xd2,0xd7,0xe2,0xe6,0xe9,0xe0,0xde,0xf7,0xcc,0xcf,0xdb,0x77,0x7e,0x85,0xdc,0xdf,
+  0xef,0xd1,0xd4,0xdd,0xa3,0xab,0xb3,0xd0,0xd3,0xdc,0x7f,0x86,0x8d,0xe1,0xe0,0xf8,
+  0x67,0x6f,0x77,0x83,0x89,0x91,0xcd,0xcf,0xdb,0xce,0xd1,0xdd,0x67,0x70,0x78,0x7d,
+  0x84,0x8b,0xc9,0xd0,0xd5,0xec,0xef,0xfb,0xa1,0xaa,0xb2,0x84,0x8c,0x94,0xeb,0xf0,
+  0xfb,0xe0,0xdf,0xf7,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x1d,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x05,
+  0x66,0x60,0x27,0x8e,0xe4,0x48,0x04,0x25,0x39,0xac,0x03,0x21,0x5c,0x40,0xda,0x0d,
+  0xc2,0xb6,0xb8,0x46,0x10,0x97,0xf4,0x11,0xe0,0xba,0x54,0xef,0x27,0xc8,0x01,0x34,
+  0x3c,0x81,0x0f,0x40,0x68,0xe8,0x0a,0x15,0x95,0x32,0xd8,0x01,0x00,0x18,0x85,0xdd,
+  0x6c,0xaa,0x7d,0x50,0x20,0x59,0xd1,0x50,0xab,0x48,0x20,0xc2,0x62,0xcc,0x8f,0x20,
+  0x2a,0x9f,0xb5,0xb3,0x9b,0x20,0x03,0xb0,0x98,0xd1,0xa3,0x56,0x51,0x37,0x79,0xa7,
+  0x80,0x00,0x0e,0x1c,0x78,0x26,0x7b,0x00,0x05,0x88,0x70,0x23,0x01,0x46,0x12,0x11,
+  0x56,0x32,0x22,0x90,0x91,0x24,0x21,0x00,0x3b
+  };
+
+/* Created by reswrap from file location.gif */
+const unsigned char location[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xc2,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0xcb,0xcb,0xcb,0xb7,0xb7,0xb7,0x88,0x88,0x88,0xff,0xff,0xff,0x5a,
+  0x5a,0x5a,0x2d,0x2d,0x2d,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x03,
+  0x3b,0x08,0xba,0xdc,0xfe,0x2d,0xc8,0x49,0x5d,0x10,0x23,0xeb,0x1c,0x22,0x29,0x05,
+  0x21,0x82,0x62,0xb7,0x04,0x06,0x58,0xa4,0xa0,0xe1,0x9a,0x40,0x70,0x1c,0x2a,0x38,
+  0xdf,0x26,0xa5,0x52,0xd5,0x54,0x17,0xbc,0x5c,0x60,0xb7,0x9b,0x9c,0x86,0x40,0x09,
+  0xc8,0x78,0x0c,0x32,0x9b,0x4e,0x88,0x74,0x4a,0xad,0x2e,0x12,0x00,0x3b
+  };
+
+/* Created by reswrap from file maphost.bmp */
+const unsigned char maphost[]={
+  0x42,0x4d,0xce,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x01,0x00,0x04,0x00,0x00,0x00,
+  0x00,0x00,0x80,0x00,0x00,0x00,0x6d,0x0b,0x00,0x00,0x6d,0x0b,0x00,0x00,0x06,0x00,
+  0x00,0x00,0x06,0x00,0x00,0x00,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x00,0x00,0xbd,0xcf,
+  0xd6,0x00,0x6b,0x8e,0xa5,0x00,0x00,0xff,0x00,0x00,0x00,0x82,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+  0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x01,0x23,0x33,0x33,0x33,0x33,0x31,0x00,0x01,
+  0x22,0x22,0x22,0x22,0x22,0x31,0x00,0x01,0x23,0x33,0x33,0x33,0x33,0x31,0x00,0x01,
+  0x22,0x22,0x22,0x22,0x22,0x31,0x10,0x01,0x23,0x33,0x33,0x33,0x55,0x31,0x01,0x01,
+  0x21,0x33,0x33,0x33,0x44,0x31,0x00,0x11,0x12,0x22,0x22,0x22,0x22,0x21,0x11,0x00,
+  0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x01,0x01,
+  0x01,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x01,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+  };
+
+/* Created by reswrap from file miscellaneous_gif.gif */
+const unsigned char miscellaneous_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x20,0x00,0x20,0x00,0xe7,0x00,0x00,0xff,0xff,0xff,
+  0xa0,0xa0,0x91,0x10,0x10,0x0e,0x80,0x80,0x74,0x4b,0x4b,0x4b,0xe1,0xe1,0xe1,0x58,
+  0x58,0x58,0x50,0x50,0x48,0xf0,0xf0,0xd9,0xc0,0xc0,0xae,0x70,0x70,0x65,0x40,0x40,
+  0x3a,0x60,0x60,0x57,0xd0,0xd0,0xbc,0x96,0x96,0x96,0xec,0xec,0xec,0xe5,0xe5,0xe5,
+  0x8b,0x8b,0x8b,0x30,0x30,0x2b,0x2e,0x2e,0x2e,0x87,0x87,0x87,0x99,0x99,0x99,0x46,
+  0x46,0x46,0xe0,0xe0,0xcb,0x1d,0x1d,0x1d,0xe7,0xe7,0xe7,0xe0,0xe0,0xe0,0xda,0xda,
+  0xda,0xac,0xac,0xac,0x20,0x20,0x1d,0x5b,0x5b,0x5b,0xb9,0xb9,0xb9,0xb2,0xb2,0xb2,
+  0x70,0x70,0x70,0xdb,0xdb,0xdb,0xd4,0xd4,0xd4,0xba,0xba,0xba,0x35,0x35,0x35,0xb0,
+  0xb0,0xb0,0x7b,0x7b,0x7b,0x1d,0x1d,0x1c,0xc7,0xc7,0xc7,0xc5,0xc5,0xc5,0x6f,0x6f,
+  0x6f,0x71,0x71,0x71,0xb5,0xb5,0xb5,0x68,0x68,0x68,0x1c,0x1c,0x1b,0x78,0x78,0x78,
+  0xcc,0xcc,0xcc,0xee,0xee,0xee,0x5e,0x5e,0x5e,0x9c,0x9c,0x9c,0xbb,0xbb,0xbb,0xa9,
+  0xa9,0xa9,0xb0,0xb0,0x9f,0x56,0x56,0x56,0xe4,0xe4,0xe4,0x00,0x00,0x00,0xf5,0xf5,
+  0xf5,0xf9,0xf9,0xf9,0x2d,0x2d,0x2d,0xb7,0xb7,0xb7,0xc1,0xc1,0xc1,0x85,0x85,0x85,
+  0x5d,0x5d,0x5d,0x64,0x64,0x64,0x29,0x29,0x29,0x8f,0x8f,0x8f,0xc3,0xc3,0xc3,0xce,
+  0xce,0xce,0xe3,0xe3,0xe3,0xa4,0xa4,0xa4,0xaa,0xaa,0xaa,0xaf,0xaf,0xaf,0xc4,0xc4,
+  0xc4,0xd6,0xd6,0xd6,0xc9,0xc9,0xc9,0x1e,0x1e,0x1d,0x95,0x95,0x95,0x81,0x81,0x81,
+  0xb6,0xb6,0xb6,0xdf,0xdf,0xdf,0xdd,0xdd,0xdd,0xc8,0xc8,0xc8,0x1a,0x1a,0x1a,0xbf,
+  0xbf,0xbf,0x6e,0x6e,0x6e,0x3b,0x3b,0x3b,0x7f,0x7f,0x7f,0x62,0x62,0x62,0xab,0xab,
+  0xab,0xdc,0xdc,0xdc,0x39,0x39,0x38,0x90,0x90,0x82,0x25,0x25,0x25,0x3a,0x3a,0x3a,
+  0x3e,0x35,0x00,0x6d,0x5a,0x00,0x22,0x22,0x22,0x42,0x42,0x42,0xa8,0x9a,0x49,0xfb,
+  0xd0,0x00,0xf5,0xbc,0x00,0x2e,0x23,0x00,0x06,0x06,0x06,0xb1,0x9c,0x13,0xfc,0xd1,
+  0x00,0xf9,0xc3,0x00,0xe7,0xa0,0x00,0x38,0x27,0x00,0x3e,0x32,0x00,0x5f,0x5f,0x5f,
+  0x6e,0x5f,0x00,0xfd,0xd2,0x00,0xf8,0xc1,0x00,0xf2,0xb6,0x00,0xed,0xab,0x00,0xc0,
+  0x83,0x00,0x8e,0x6a,0x00,0x83,0x83,0x83,0x4f,0x43,0x00,0xa8,0x88,0x00,0xbf,0x91,
+  0x00,0xe8,0xa5,0x00,0xe6,0xac,0x00,0xd1,0x97,0x00,0xb2,0x74,0x00,0xb0,0x73,0x00,
+  0x7f,0x5f,0x00,0x21,0x21,0x21,0x95,0x78,0x00,0xfa,0xc9,0x00,0xc4,0x89,0x00,0xab,
+  0x6f,0x00,0xbd,0x83,0x00,0xb0,0x72,0x00,0xbf,0x85,0x00,0x58,0x42,0x00,0xa8,0xa8,
+  0xa8,0x18,0x18,0x18,0xad,0x95,0x00,0xb4,0x7c,0x00,0xba,0x7f,0x00,0xb4,0x79,0x00,
+  0xaf,0x74,0x00,0xc2,0x8a,0x00,0xb3,0x77,0x00,0xca,0x92,0x00,0x2c,0x20,0x00,0x2f,
+  0x28,0x00,0xd3,0xac,0x00,0xb5,0x7d,0x00,0xc7,0x8e,0x00,0xb3,0x7a,0x00,0xcb,0x93,
+  0x00,0xb2,0x79,0x00,0xc6,0x94,0x00,0x2d,0x25,0x0e,0xb4,0xb4,0xb4,0x92,0x92,0x92,
+  0x51,0x51,0x51,0x84,0x84,0x84,0xb8,0xb8,0xb8,0x5d,0x4f,0x00,0xd7,0xaa,0x00,0xb8,
+  0x81,0x00,0xcb,0x94,0x00,0xb7,0x80,0x00,0xb9,0x82,0x00,0xce,0x98,0x00,0xb9,0x83,
+  0x00,0xb6,0x8c,0x00,0x1e,0x1a,0x0e,0x9e,0x9e,0x9e,0x1b,0x1b,0x1a,0x53,0x53,0x53,
+  0x6c,0x5b,0x00,0xd1,0xa3,0x00,0xc1,0x8c,0x00,0xc7,0x92,0x00,0xbb,0x85,0x00,0xc3,
+  0x8f,0x00,0xc9,0x94,0x00,0xbe,0x8a,0x00,0xa2,0x7f,0x00,0x3e,0x3e,0x3e,0x27,0x27,
+  0x27,0x98,0x7e,0x00,0xce,0x9f,0x00,0xca,0x98,0x00,0xca,0x94,0x00,0xbe,0x8b,0x00,
+  0xd1,0x9e,0x00,0xdd,0xa9,0x00,0x2b,0x2b,0x2b,0xc1,0xa0,0x00,0xc9,0x99,0x00,0xd2,
+  0xa3,0x00,0xca,0x97,0x00,0xc2,0x90,0x00,0xed,0xb2,0x00,0x56,0x3c,0x00,0xd7,0xd7,
+  0xd7,0x1f,0x1c,0x0e,0xcd,0xa8,0x00,0xca,0x9b,0x00,0xde,0xad,0x00,0xd4,0x99,0x00,
+  0x39,0x28,0x00,0x0d,0x0d,0x0d,0x2d,0x24,0x00,0xd8,0xae,0x00,0xc8,0x96,0x00,0x2b,
+  0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x08,0xfe,0x00,0x01,0x08,0x1c,0x48,0xb0,0xa0,
+  0xc1,0x83,0x08,0x13,0x2a,0x5c,0xc8,0xb0,0xa1,0xc2,0x00,0x02,0x06,0x38,0x74,0x38,
+  0x80,0x40,0x01,0x03,0x07,0x10,0x2c,0x4c,0xa0,0x60,0x01,0x83,0x06,0x0a,0x19,0x38,
+  0x78,0x00,0x21,0x82,0x04,0x90,0x08,0x19,0x4c,0xa0,0x50,0xc1,0x82,0xc4,0x84,0x17,
+  0x30,0x64,0xd0,0xb0,0x81,0x43,0x07,0x84,0x0a,0x3c,0x7c,0x00,0x11,0x42,0x82,0x46,
+  0x85,0x03,0x42,0x88,0x18,0x41,0xa2,0x04,0x4a,0x82,0x0d,0x26,0x7c,0x30,0x71,0xc2,
+  0xa7,0xc0,0x00,0x17,0x10,0x22,0x40,0x91,0x42,0x05,0x88,0x15,0x07,0x0c,0x0e,0x60,
+  0x01,0xa2,0x85,0x8b,0x97,0x0c,0x2c,0xdc,0x44,0x18,0xe0,0x05,0x8c,0x18,0x32,0x66,
+  0x28,0x28,0x38,0x80,0x46,0x8b,0x1a,0x36,0x3a,0xdc,0x60,0x80,0x23,0x87,0x0e,0x85,
+  0x08,0xe8,0xee,0xe0,0xd1,0x23,0xc0,0x40,0x04,0x12,0x7c,0xd4,0xf8,0x91,0x02,0x48,
+  0x10,0x21,0x10,0x20,0x8c,0x55,0x78,0x80,0xc6,0x8e,0x0d,0x43,0x40,0x02,0x26,0x92,
+  0xa2,0x45,0x11,0x23,0x23,0x44,0x1c,0x81,0x40,0x84,0x01,0x43,0xc0,0x48,0x72,0x98,
+  0x78,0xd1,0x40,0x02,0xe5,0x24,0x4a,0x96,0x30,0xd9,0x50,0x00,0x42,0x13,0x27,0x51,
+  0x19,0x5e,0x70,0xd2,0x62,0xc4,0x13,0x1d,0x50,0x52,0xa0,0x8e,0x22,0x65,0x4a,0x01,
+  0x2a,0x44,0x9c,0x1c,0x65,0xd8,0xa0,0xca,0x0f,0x2b,0x57,0xb0,0x64,0xd1,0xb2,0x85,
+  0x0b,0x93,0x2e,0x0b,0x16,0x28,0xf8,0x39,0xd1,0xcb,0x97,0x0f,0x36,0xc0,0x84,0x11,
+  0x33,0xe4,0xf9,0xf0,0x89,0x00,0x00,0xfe,0x8f,0x21,0x43,0xa3,0x8c,0x99,0x33,0x68,
+  0x22,0x83,0x27,0x38,0x99,0x48,0x1a,0x35,0x6b,0xd8,0xb4,0x71,0xf3,0xc6,0xe9,0xfa,
+  0xc9,0x29,0xe0,0xc4,0x91,0x33,0x87,0x4e,0x9b,0x3a,0x76,0xdc,0x61,0x1f,0x43,0x1c,
+  0x2d,0xd0,0xc1,0x69,0x78,0xe4,0xa1,0xc7,0x1e,0x7c,0xf4,0xe1,0xc7,0x1f,0x80,0x04,
+  0xe2,0x19,0x43,0x2a,0xb1,0xa4,0x84,0x6e,0x4a,0x44,0x71,0x85,0x20,0x83,0x10,0x52,
+  0x88,0x21,0x87,0x20,0x92,0x88,0x22,0x2f,0x25,0x94,0xd3,0x4e,0x6f,0xb5,0x90,0x21,
+  0x17,0x8b,0x30,0xd2,0x88,0x23,0x8f,0x40,0x12,0x89,0x24,0x93,0x50,0x52,0x89,0x5f,
+  0x08,0x5d,0xa0,0x94,0x09,0x6f,0xfd,0x50,0xc4,0x0f,0x52,0x3c,0xe7,0x85,0x25,0x97,
+  0x60,0x92,0x89,0x26,0x8e,0x6c,0xc2,0x49,0x27,0x9e,0x7c,0x37,0x90,0x17,0x2c,0x7c,
+  0x02,0x4a,0x28,0xa2,0x8c,0x62,0x04,0x13,0x53,0xa8,0xe7,0x05,0x29,0xa5,0x98,0x72,
+  0x0a,0x2a,0xa9,0xa8,0xb2,0x0a,0x2b,0xad,0x50,0x47,0xd0,0x00,0xae,0x80,0xf2,0x4a,
+  0x00,0x0c,0xc0,0x32,0x02,0x6b,0x77,0x09,0xc4,0x40,0x2c,0xb2,0xcc,0x42,0x4b,0x2d,
+  0xb6,0xdc,0x82,0x4b,0x2e,0x0b,0x1c,0xe4,0x85,0x2e,0xaf,0x80,0x74,0xc1,0x2e,0x5c,
+  0xb4,0x26,0x00,0x41,0x12,0xf0,0xd2,0x8b,0x2f,0xbf,0x00,0x13,0xcc,0x2d,0xc2,0xc4,
+  0x59,0x10,0x02,0x03,0xc4,0x16,0xc0,0x30,0x39,0x70,0x36,0xa1,0x40,0x08,0x74,0x40,
+  0x4c,0x31,0xc6,0x1c,0x83,0x4c,0x32,0xca,0xac,0xf5,0xd0,0x30,0xcb,0xb8,0x06,0x5b,
+  0x41,0x0d,0x30,0xd3,0x8c,0x33,0x28,0xcf,0x40,0x13,0xcd,0xa6,0x08,0x35,0x20,0x0d,
+  0x13,0x4d,0x40,0x21,0xdc,0x41,0x09,0x4c,0x43,0x4d,0x35,0xd6,0xe0,0xb8,0x10,0x03,
+  0xd1,0x79,0x61,0x66,0x41,0x10,0x75,0x90,0xc0,0x7a,0xcc,0x36,0xbb,0x5e,0x40,0x00,
+  0x3b
+  };
+
+/* Created by reswrap from file move_gif.gif */
+const unsigned char move_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf7,0x00,0x00,0xff,0xff,0xff,
+  0x55,0x7f,0x7f,0x52,0x7c,0x7c,0x50,0x79,0x79,0x4e,0x54,0x43,0x4a,0x2b,0x0a,0xf5,
+  0xfc,0xfc,0xee,0xf8,0xf8,0xe8,0xf6,0xf6,0xe3,0xf3,0xf3,0xe1,0xf2,0xf2,0xb1,0xc2,
+  0xc2,0xf4,0xfa,0xfa,0xec,0xf4,0xf4,0xe6,0xf0,0xf0,0xdd,0xeb,0xeb,0xd6,0xe7,0xe7,
+  0xa5,0xb6,0xb6,0x4c,0x75,0x75,0xf5,0xfb,0xfb,0xef,0xf5,0xf5,0xbb,0xce,0xce,0xa7,
+  0xc0,0xc0,0x7a,0x95,0x95,0x41,0x68,0x68,0x48,0x71,0x71,0xf7,0xfc,0xfc,0xf1,0xf7,
+  0xf7,0xae,0xc3,0xc3,0x44,0x6c,0x6c,0xf9,0xfc,0xfc,0xf4,0xf8,0xf8,0xae,0xc2,0xc2,
+  0x40,0x67,0x67,0xfa,0xfd,0xfd,0xf6,0xfa,0xfa,0xac,0xc1,0xc1,0x93,0xa4,0xa4,0x25,
+  0x49,0x49,0x3c,0x62,0x62,0xfc,0xfe,0xfe,0xf8,0xfb,0xfb,0xac,0xbf,0xbf,0x37,0x5d,
+  0x5d,0xfd,0xfe,0xfe,0xfb,0xfc,0xfc,0xaa,0xbd,0xbd,0xe3,0xf4,0xf4,0x32,0x58,0x58,
+  0xfe,0xff,0xff,0xfc,0xfd,0xfd,0xa8,0xbb,0xbb,0x2d,0x51,0x51,0xfe,0xfe,0xfe,0xa6,
+  0xb8,0xb8,0xef,0xf9,0xf9,0x1d,0x3f,0x3f,0xa3,0xb5,0xb5,0xf2,0xfa,0xfa,0x0f,0x2f,
+  0x2f,0x0d,0x2d,0x2d,0x24,0x47,0x47,0x09,0x29,0x29,0x12,0x33,0x33,0xf6,0xfb,0xfb,
+  0x0d,0x2e,0x2e,0xf9,0xfe,0xfe,0x10,0x30,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0xff,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x08,
+  0xa6,0x00,0xff,0x25,0x18,0x48,0x70,0xe0,0xbf,0x83,0x08,0x0f,0x26,0x48,0xc1,0x90,
+  0x21,0xc1,0x84,0x08,0x17,0x36,0x6c,0x68,0x10,0xa2,0xc4,0x14,0x15,0x2c,0x5c,0xd8,
+  0x88,0x21,0x40,0x80,0x84,0x17,0x39,0x18,0x38,0x80,0x20,0x81,0x82,0x05,0x02,0x04,
+  0x44,0x6c,0x08,0x82,0x41,0x03,0x07,0x0f,0x20,0x44,0x00,0x30,0x60,0x80,0xc2,0x86,
+  0x24,0x26,0x50,0x78,0xf9,0xa0,0x84,0x4f,0x13,0x37,0x19,0xaa,0xd0,0xb0,0x61,0x27,
+  0x4c,0x08,0x0a,0x32,0x04,0x4d,0xe1,0xc2,0xc3,0x87,0xa2,0x3c,0x5f,0x74,0x58,0x3a,
+  0x43,0xc4,0x88,0xa7,0x46,0x11,0x84,0xb8,0xe9,0x21,0x85,0x0d,0x14,0x29,0xae,0x42,
+  0xbd,0x71,0x62,0x29,0x08,0x16,0x2d,0xc2,0x62,0xd5,0xb1,0x42,0x21,0x41,0x13,0x31,
+  0x64,0xa4,0x15,0xcb,0x00,0x06,0xc4,0x7f,0x34,0x00,0xd4,0x90,0xab,0x16,0x08,0x8d,
+  0xbb,0x38,0x00,0x00,0x88,0xc1,0x02,0x85,0x08,0x0f,0x42,0x70,0xdc,0xdd,0xc1,0xa3,
+  0xb1,0xe3,0xc6,0x3b,0xfe,0x05,0x04,0x00,0x3b
+  };
+
+/* Created by reswrap from file paste.gif */
+const unsigned char paste[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xc6,0x00,0x00,0xb2,0xc0,0xdc,
+  0x23,0x21,0x10,0x71,0x6b,0x32,0x8a,0x7e,0x2d,0x5a,0x50,0x00,0x00,0x00,0x00,0x1e,
+  0x2f,0x04,0x5c,0x38,0x05,0xa4,0x99,0x41,0xff,0xff,0xff,0xd2,0xcc,0x8f,0xab,0xa0,
+  0x62,0xff,0xcf,0x77,0x86,0x76,0x1f,0xf6,0xf6,0xdb,0xbb,0xb5,0x74,0x85,0x74,0x14,
+  0xe2,0xac,0x40,0xdf,0xa9,0x3d,0x4b,0x45,0x2a,0xd9,0xa3,0x39,0x82,0x73,0x63,0x7f,
+  0x71,0x61,0x7c,0x6e,0x5f,0x78,0x6b,0x5c,0x75,0x68,0x5a,0x71,0x65,0x57,0x6e,0x62,
+  0x55,0xd2,0x9c,0x34,0x7e,0x70,0x61,0xde,0xde,0xde,0x6a,0x5f,0x52,0x66,0x5c,0x50,
+  0xcb,0x95,0x2f,0x7a,0x6d,0x5e,0x66,0x5b,0x4f,0xfb,0xf7,0xf4,0x5f,0x55,0x4a,0xc5,
+  0x8e,0x2b,0x76,0x69,0x5b,0x82,0x82,0x82,0xc9,0xc9,0xc9,0x61,0x58,0x4c,0x5e,0x55,
+  0x4a,0x5b,0x52,0x47,0x57,0x4f,0x45,0xbe,0x87,0x26,0x72,0x66,0x58,0xf9,0xf6,0xf2,
+  0xf8,0xf0,0xe5,0xe1,0xde,0xdc,0xbd,0xb4,0xac,0x53,0x4b,0x42,0xb7,0x81,0x21,0x5b,
+  0x5a,0x5a,0x7d,0x73,0x6c,0xbd,0xac,0x92,0x4f,0x48,0x3f,0xb0,0x7a,0x1c,0xf5,0xe9,
+  0xda,0xf1,0xe3,0xce,0xf0,0xdd,0xc1,0xbe,0xa5,0x85,0x4b,0x44,0x3c,0xaa,0x73,0x18,
+  0xc6,0xc6,0xc6,0x5a,0x54,0x51,0xbf,0xa4,0x7f,0x47,0x41,0x39,0xa3,0x6c,0x13,0xed,
+  0xd6,0xb8,0xeb,0xd0,0xaa,0xc0,0xa0,0x77,0x42,0x3d,0x37,0xc2,0x8b,0x28,0x96,0x5f,
+  0x0a,0x5d,0x54,0x49,0x7e,0x79,0x75,0x59,0x54,0x50,0xc1,0xb4,0xaa,0x9b,0x85,0x74,
+  0x7c,0x6e,0x61,0xc0,0x9f,0x71,0x3e,0x3a,0x34,0x59,0x51,0x46,0xc6,0xbe,0xb3,0xc4,
+  0xb9,0xa9,0xc3,0xb5,0x9e,0xc3,0xaf,0x94,0xc2,0xab,0x89,0xc2,0xa6,0x7f,0xc1,0xa1,
+  0x74,0xc0,0x9b,0x6b,0x3a,0x36,0x31,0x55,0x4d,0x44,0x52,0x4a,0x41,0x4e,0x47,0x3f,
+  0x47,0x41,0x3a,0x44,0x3f,0x37,0x40,0x3c,0x35,0x3d,0x39,0x33,0x3a,0x36,0x30,0x36,
+  0x33,0x2e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x07,0xd1,0x80,0x00,0x82,0x82,0x01,0x02,0x03,
+  0x04,0x05,0x06,0x83,0x83,0x07,0x8d,0x07,0x08,0x09,0x0a,0x0b,0x04,0x8e,0x07,0x82,
+  0x07,0x0c,0x99,0x0d,0x0e,0x0a,0x0f,0x08,0x10,0x04,0x11,0x99,0x96,0x98,0x12,0x12,
+  0x0d,0x04,0x04,0x13,0xab,0x13,0xa6,0x12,0xa4,0x0c,0x14,0xb2,0x14,0x15,0x16,0x17,
+  0x18,0x19,0x1a,0x1b,0x14,0xb0,0x1c,0xbe,0x1c,0x1d,0x1e,0xc2,0xc2,0x1f,0x20,0xb0,
+  0x21,0xc8,0x21,0x22,0x1e,0x09,0xcd,0x09,0x23,0x24,0x25,0x00,0x98,0x26,0xd5,0x26,
+  0x27,0x1e,0x28,0x29,0x28,0x09,0x2a,0x2b,0x2c,0x2d,0x98,0x2e,0xe3,0x2e,0x2f,0xcc,
+  0xcd,0x30,0x31,0x32,0x33,0x34,0x98,0x35,0xef,0x35,0x1b,0xd9,0x36,0xdb,0x29,0x37,
+  0x38,0x39,0x98,0x3a,0xfb,0x3a,0x1f,0xcc,0xe9,0x3b,0x78,0xf4,0xf0,0xf1,0x03,0x13,
+  0x90,0x83,0x40,0x46,0x78,0xb0,0x81,0x22,0x08,0x0a,0x21,0x37,0x86,0x10,0xc1,0x54,
+  0xa4,0x62,0x11,0x15,0x1e,0x62,0x04,0xec,0x61,0xe4,0x08,0x92,0x24,0x07,0x94,0x2c,
+  0x19,0xb9,0x84,0x89,0x87,0x26,0x4e,0x9e,0x40,0x89,0x72,0x43,0xca,0x94,0x69,0x95,
+  0xa8,0x54,0xb1,0x72,0x05,0x4b,0x16,0x2d,0x5b,0xb8,0x74,0x59,0x24,0xc8,0xcb,0x17,
+  0x30,0x3f,0xc2,0x88,0x19,0x43,0xa6,0x8c,0x99,0x40,0x00,0x3b
+  };
+
+/* Created by reswrap from file pattern_gif.gif */
+const unsigned char pattern_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x18,0x00,0x18,0x00,0xe3,0x00,0x00,0xb2,0xc0,0xdc,
+  0xaa,0xa8,0xc0,0xa3,0x90,0xa5,0xa7,0x9c,0xb2,0x95,0x60,0x6e,0x78,0x00,0x00,0x86,
+  0x30,0x37,0xae,0xb4,0xce,0x8d,0x48,0x52,0x9c,0x78,0x89,0x98,0x6c,0x7b,0x7b,0x0c,
+  0x0d,0x7f,0x18,0x1b,0x91,0x54,0x60,0x82,0x24,0x29,0xa6,0x9c,0xb2,0x2c,0x00,0x00,
+  0x00,0x00,0x18,0x00,0x18,0x00,0x00,0x04,0x94,0x10,0xc8,0x49,0xab,0xbd,0x38,0xeb,
+  0xad,0x83,0x18,0xda,0x20,0x04,0x18,0x51,0x18,0x9a,0x51,0x10,0xe5,0x99,0xae,0xd4,
+  0x21,0x1c,0x80,0x89,0x02,0xa3,0xe4,0x49,0x2a,0x2b,0x1f,0x88,0x02,0x22,0x61,0x13,
+  0xd8,0x02,0x81,0x9e,0xa0,0x97,0x08,0x22,0x14,0x85,0xc2,0x82,0x21,0xa5,0x0a,0x0f,
+  0xc0,0x28,0x63,0x51,0xd8,0x46,0x15,0x92,0x46,0x74,0xec,0xb0,0x38,0xc6,0xd1,0x46,
+  0x05,0x5d,0x10,0x58,0x04,0xec,0x8a,0xb8,0x00,0x2d,0x94,0x2b,0x67,0x7a,0x5a,0x92,
+  0x5d,0x24,0x00,0x0f,0x54,0x0e,0x24,0x00,0x01,0x67,0x0c,0x0f,0x00,0x09,0x5c,0x08,
+  0x07,0x49,0x05,0x7f,0x12,0x02,0x0c,0x0c,0x6e,0x38,0x94,0x96,0x8a,0x0c,0x04,0x24,
+  0x3b,0x14,0x03,0x20,0x0d,0x6a,0xa0,0x15,0x20,0x1b,0x26,0x30,0x1c,0x17,0x93,0x95,
+  0xaa,0x18,0xa4,0xae,0xb1,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xae,0x11,0x00,0x3b
+  };
+
+/* Created by reswrap from file property_gif.gif */
+const unsigned char property_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf6,0x00,0x00,0x40,0x9f,0xea,
+  0xbe,0x62,0x04,0xbf,0x62,0x04,0xb8,0x5e,0x04,0x5f,0x8f,0xb1,0xfc,0xd8,0xa5,0xdd,
+  0xaf,0x7c,0xcc,0x9d,0x6a,0xff,0xdc,0xa9,0xe7,0xbd,0x8a,0xea,0xc1,0x8e,0xef,0xc6,
+  0x93,0xf4,0xcc,0x99,0xb7,0x5d,0x04,0x94,0x6b,0x3d,0xae,0x59,0x03,0xcb,0x9c,0x69,
+  0xfc,0xd7,0xa4,0xbb,0x88,0x55,0xeb,0xbf,0x8c,0xd5,0xa4,0x71,0xdd,0xad,0x7a,0xe5,
+  0xb7,0x84,0xec,0xbf,0x8c,0x5d,0x88,0xa5,0xa3,0x83,0x5c,0xf8,0xd0,0x9d,0xf0,0xc5,
+  0x92,0xe7,0xba,0x87,0xda,0xa9,0x76,0xe0,0xb0,0x7d,0xd5,0x9e,0x64,0xa3,0x53,0x02,
+  0x3e,0x9c,0xe7,0x75,0xc6,0xfa,0x87,0xd1,0xfe,0x8a,0xaa,0xb5,0xab,0x88,0x5e,0xf5,
+  0xc8,0x95,0x92,0x6b,0x41,0xeb,0xbc,0x89,0xaa,0x77,0x44,0xd4,0xa7,0x75,0xaf,0x83,
+  0x55,0x8e,0x47,0x01,0x91,0x49,0x01,0x3c,0x99,0xe4,0x66,0xb2,0xee,0x65,0xb1,0xed,
+  0x82,0x61,0x3c,0xf1,0xc2,0x8f,0x94,0x6f,0x47,0x6e,0x71,0x6c,0x78,0x54,0x2d,0xe8,
+  0xb7,0x84,0xa5,0x7a,0x4d,0x7c,0x64,0x48,0x48,0x5d,0x68,0x84,0x42,0x00,0xff,0xff,
+  0xff,0xda,0xc5,0xb0,0xa0,0x6c,0x38,0xd6,0xc2,0xad,0x99,0x66,0x33,0xe6,0xb4,0x81,
+  0x3d,0x9b,0xe6,0xfd,0xfd,0xfd,0xfc,0xfc,0xfc,0xd4,0xc0,0xab,0x3a,0x97,0xe2,0xfa,
+  0xfa,0xfa,0x33,0xaa,0x22,0xf8,0xf8,0xf8,0xbb,0xbb,0xbb,0xcc,0xcc,0xcc,0xd4,0xd4,
+  0xd4,0xda,0xda,0xda,0x36,0x92,0xdd,0xf7,0xf7,0xf7,0xf4,0xf4,0xf4,0x32,0x8d,0xd8,
+  0xf3,0xf3,0xf3,0xc2,0x71,0x6e,0xef,0xef,0xef,0xbc,0xbc,0xbc,0xc5,0xc5,0xc5,0x2e,
+  0x87,0xd2,0xf0,0xf0,0xf0,0xeb,0xeb,0xeb,0x29,0x80,0xcb,0xed,0xed,0xed,0x66,0x99,
+  0xff,0xe6,0xe6,0xe6,0xbd,0xbd,0xbd,0xac,0xac,0xac,0xc9,0xc9,0xc9,0x24,0x7a,0xc5,
+  0xea,0xea,0xea,0xe2,0xe2,0xe2,0x1b,0x6e,0xb9,0xe7,0xe7,0xe7,0x0b,0x59,0xa4,0x09,
+  0x56,0xa1,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x67,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x07,
+  0xcc,0x80,0x67,0x82,0x82,0x02,0x85,0x86,0x86,0x01,0x83,0x82,0x03,0x05,0x06,0x07,
+  0x08,0x05,0x09,0x0a,0x0b,0x0c,0x03,0x0d,0x8a,0x0e,0x0f,0x10,0x11,0x12,0x11,0x13,
+  0x14,0x15,0x16,0x17,0x0f,0x00,0xa5,0x00,0x18,0x19,0x1a,0x12,0x1b,0x12,0x1a,0x1c,
+  0x1d,0x1e,0x1f,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x28,0x29,0x28,0x12,0x28,
+  0x2a,0x2b,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x29,0x36,0x37,
+  0x38,0x39,0x3a,0x67,0x00,0x3b,0x3b,0x3c,0x3d,0x3c,0x3b,0x3e,0x3f,0x40,0x29,0x3e,
+  0x3b,0x00,0x82,0x41,0x42,0x43,0xe5,0xe6,0x44,0x3f,0x44,0x43,0x42,0x41,0x82,0x45,
+  0x46,0x47,0x48,0x49,0x4a,0x4b,0x4c,0x48,0xf7,0x48,0x46,0x45,0x82,0x4d,0x4e,0x4f,
+  0xff,0x00,0x03,0x3a,0x69,0x22,0x08,0x4a,0x14,0x29,0x53,0xa8,0x54,0x59,0xa8,0x50,
+  0x61,0x14,0x28,0x82,0xac,0x5c,0xc1,0x42,0xb1,0xa2,0xc5,0x2b,0x56,0x04,0x65,0xd1,
+  0xb2,0x85,0x4b,0x17,0x2f,0x5d,0x3e,0x76,0xf9,0xc2,0x45,0x4b,0x16,0x41,0x60,0xc2,
+  0x88,0x59,0xc9,0xb2,0x65,0x18,0x30,0x82,0xc6,0x60,0x21,0x43,0xb3,0xa6,0x4d,0x2c,
+  0x63,0x04,0x95,0x31,0xc3,0xb3,0xa7,0x4f,0x9e,0x65,0x04,0x05,0x02,0x00,0x3b
+  };
+
+/* Created by reswrap from file quit_gif.gif */
+const unsigned char quit_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xc2,0x00,0x00,0xb2,0xc0,0xdc,
+  0x04,0x02,0x04,0x2c,0x2e,0x2c,0x74,0x72,0x74,0x74,0x76,0x74,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x03,
+  0x39,0x08,0xba,0xdc,0xae,0x21,0xbc,0x17,0xe7,0x92,0xa0,0xe6,0x27,0xaa,0x0f,0x42,
+  0x33,0x68,0x64,0x30,0x30,0xdd,0x99,0x61,0x63,0x78,0x61,0xeb,0xcb,0x68,0x31,0x04,
+  0x03,0xa9,0xad,0xb4,0x0c,0x41,0xbf,0x84,0x46,0xc7,0xb4,0x8b,0xb8,0x84,0x91,0x24,
+  0xc8,0x42,0x18,0x0a,0x54,0x96,0xa8,0xb4,0x91,0x00,0x00,0x3b
+  };
+
+/* Created by reswrap from file newfolder.bmp */
+const unsigned char newfolder[]={
+  0x42,0x4d,0x36,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0c,0x00,0x00,0x6d,0x0b,0x00,0x00,0x6d,0x0b,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x5b,0x8a,0x00,0x5a,0x89,0x00,
+  0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,
+  0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,
+  0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,
+  0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,
+  0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,0x00,0x5a,0x89,
+  0x00,0x5b,0x8a,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x5e,0x8e,0x85,0xce,0xf0,0x81,
+  0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,
+  0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,
+  0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,
+  0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,
+  0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x81,0xcb,0xec,0x85,0xce,0xf0,
+  0x00,0x5e,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x63,0x95,0x74,0xbc,0xde,0x6d,
+  0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,
+  0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,
+  0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,
+  0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,
+  0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x6d,0xb7,0xd8,0x74,0xbc,0xde,
+  0x00,0x63,0x95,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x69,0x9e,0x85,0xce,0xed,0x7c,
+  0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,
+  0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,
+  0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,
+  0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,
+  0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x7c,0xc7,0xe7,0x85,0xce,0xed,
+  0x00,0x69,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x6f,0xa6,0x77,0xbf,0xdf,0x70,
+  0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,
+  0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,
+  0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,
+  0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,
+  0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x70,0xb9,0xda,0x77,0xbf,0xdf,
+  0x00,0x6f,0xa6,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x71,0xab,0x89,0xd1,0xef,0x80,
+  0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,
+  0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,
+  0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,
+  0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,
+  0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x80,0xca,0xe9,0x89,0xd1,0xef,
+  0x00,0x71,0xab,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x73,0xad,0x8b,0xd3,0xf0,0x82,
+  0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,
+  0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,
+  0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,
+  0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,
+  0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x82,0xcc,0xeb,0x8b,0xd3,0xf0,
+  0x00,0x73,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x74,0xaf,0x8d,0xd5,0xf1,0x84,
+  0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,
+  0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,
+  0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,
+  0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,
+  0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x84,0xce,0xec,0x8d,0xd5,0xf1,
+  0x00,0x74,0xaf,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x76,0xb1,0x8f,0xd7,0xf2,0x87,
+  0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,
+  0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,
+  0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,
+  0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,
+  0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x87,0xd0,0xed,0x8f,0xd7,0xf2,
+  0x00,0x76,0xb1,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x77,0xb3,0x92,0xda,0xf3,0x89,
+  0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,
+  0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,
+  0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,
+  0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,
+  0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x89,0xd3,0xef,0x92,0xda,0xf3,
+  0x00,0x77,0xb3,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x79,0xb6,0x94,0xdc,0xf4,0x8c,
+  0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,
+  0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,
+  0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,
+  0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,
+  0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x8c,0xd5,0xf0,0x94,0xdc,0xf4,
+  0x00,0x79,0xb6,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x7a,0xb8,0x97,0xde,0xf5,0x8f,
+  0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,
+  0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,
+  0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,
+  0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,
+  0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x8f,0xd7,0xf1,0x97,0xde,0xf5,
+  0x00,0x7a,0xb8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x7c,0xba,0x9a,0xe0,0xf6,0x92,
+  0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,
+  0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,
+  0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,
+  0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,
+  0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x92,0xd9,0xf3,0x9a,0xe0,0xf6,
+  0x00,0x7c,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x7d,0xbc,0x9c,0xe3,0xf7,0x94,
+  0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,
+  0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,
+  0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,
+  0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,
+  0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x94,0xdc,0xf4,0x9c,0xe3,0xf7,
+  0x00,0x7d,0xbc,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x7e,0xbe,0x9f,0xe5,0xf8,0x97,
+  0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,
+  0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,
+  0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,
+  0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,
+  0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x97,0xde,0xf5,0x9f,0xe5,0xf8,
+  0x00,0x7e,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x7f,0xbf,0xa2,0xe7,0xf9,0x9a,
+  0xe0,0xf7,0x9a,0xe0,0xf7,0x9a,0xe0,0xf7,0x9a,0xe0,0xf7,0x9a,0xe0,0xf7,0x9a,0xe0,
+  0xf7,0x9a,0xe0,0xf7,0x9a,0xe0,0xf7,0x9a,0xe0,0xf7,0x9a,0xe0,0xf7,0x9a,0xe0,0xf7,
+  0x9a,0xe0,0xf7,0x9a,0xe0,0xf7,0x9a,0xe0,0xf7,0x9a,0xe0,0xf7,0xa1,0xe7,0xf9,0xa1,
+  0xe7,0xf9,0xa1,0xe7,0xf9,0xa1,0xe7,0xf9,0xa1,0xe7,0xf9,0xa1,0xe7,0xf9,0xa1,0xe7,
+  0xf9,0xa1,0xe7,0xf9,0xa1,0xe7,0xf9,0xa1,0xe7,0xf9,0xa1,0xe7,0xf9,0xa5,0xea,0xfa,
+  0x00,0x7f,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x81,0xc1,0xa4,0xea,0xfa,0x9c,
+  0xe3,0xf8,0x9c,0xe3,0xf8,0x9c,0xe3,0xf8,0x9c,0xe3,0xf8,0x9c,0xe3,0xf8,0x9c,0xe3,
+  0xf8,0x9c,0xe3,0xf8,0x9c,0xe3,0xf8,0x9c,0xe3,0xf8,0x9c,0xe3,0xf8,0x9c,0xe3,0xf8,
+  0x9c,0xe3,0xf8,0x9c,0xe3,0xf8,0x9c,0xe3,0xf8,0xab,0xf0,0xfc,0x72,0xb7,0xd6,0x64,
+  0xa8,0xca,0x64,0xa8,0xca,0x64,0xa8,0xca,0x64,0xa8,0xca,0x64,0xa8,0xca,0x64,0xa8,
+  0xca,0x64,0xa8,0xca,0x64,0xa8,0xca,0x64,0xa8,0xca,0x64,0xa8,0xca,0x00,0x81,0xc1,
+  0x00,0x81,0xc1,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x82,0xc3,0xa6,0xec,0xfb,0x9f,
+  0xe5,0xf9,0x9f,0xe5,0xf9,0x9f,0xe5,0xf9,0x9f,0xe5,0xf9,0x9f,0xe5,0xf9,0x9f,0xe5,
+  0xf9,0x9f,0xe5,0xf9,0x9f,0xe5,0xf9,0x9f,0xe5,0xf9,0x9f,0xe5,0xf9,0x9f,0xe5,0xf9,
+  0x9f,0xe5,0xf9,0x9f,0xe5,0xf9,0xad,0xf2,0xfc,0x69,0xad,0xcf,0x80,0xc4,0xe2,0x99,
+  0xdd,0xf7,0x98,0xdc,0xf6,0x96,0xda,0xf6,0x95,0xd9,0xf5,0x94,0xd8,0xf4,0x93,0xd7,
+  0xf4,0x92,0xd6,0xf3,0x91,0xd5,0xf3,0x90,0xd4,0xf2,0x8f,0xd3,0xf2,0x00,0x82,0xc3,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x83,0xc5,0xab,0xf0,0xfd,0xa7,
+  0xed,0xfc,0xa7,0xed,0xfc,0xa7,0xed,0xfc,0xa7,0xed,0xfc,0xa7,0xed,0xfc,0xa7,0xed,
+  0xfc,0xa7,0xed,0xfc,0xa7,0xed,0xfc,0xa7,0xed,0xfc,0xa7,0xed,0xfc,0xa7,0xed,0xfc,
+  0xa7,0xed,0xfc,0x9e,0xe2,0xf3,0x6d,0xb1,0xd3,0x8c,0xd0,0xed,0x96,0xda,0xf6,0x95,
+  0xd9,0xf5,0x94,0xd8,0xf4,0x93,0xd7,0xf4,0x92,0xd6,0xf3,0x91,0xd5,0xf3,0x90,0xd4,
+  0xf2,0x8f,0xd3,0xf2,0x8e,0xd2,0xf1,0x8d,0xd1,0xf1,0x8d,0xd1,0xf0,0x00,0x83,0xc5,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x84,0xc6,0x00,0x84,0xc6,0x70,
+  0xb4,0xd6,0x70,0xb4,0xd6,0x70,0xb4,0xd6,0x70,0xb4,0xd6,0x70,0xb4,0xd6,0x70,0xb4,
+  0xd6,0x70,0xb4,0xd6,0x70,0xb4,0xd6,0x70,0xb4,0xd6,0x70,0xb4,0xd6,0x70,0xb4,0xd6,
+  0x70,0xb4,0xd6,0x79,0xbd,0xde,0x8b,0xcf,0xed,0x94,0xd8,0xf4,0x93,0xd7,0xf4,0x92,
+  0xd6,0xf3,0x91,0xd5,0xf3,0x90,0xd4,0xf2,0x8f,0xd3,0xf2,0x8e,0xd2,0xf1,0x8d,0xd1,
+  0xf1,0x8c,0xd0,0xf0,0x8c,0xd0,0xf0,0x8b,0xcf,0xf0,0x8a,0xce,0xef,0x00,0x84,0xc6,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x85,0xc7,0xa0,
+  0xe4,0xfa,0x9f,0xe3,0xfa,0x9e,0xe2,0xf9,0x9d,0xe1,0xf9,0x9c,0xe0,0xf8,0x9a,0xde,
+  0xf8,0x99,0xdd,0xf7,0x98,0xdc,0xf6,0x97,0xdb,0xf6,0x96,0xda,0xf5,0x95,0xd9,0xf5,
+  0x94,0xd8,0xf4,0x93,0xd7,0xf4,0x92,0xd6,0xf3,0x8d,0xd1,0xf0,0x89,0xcd,0xec,0x88,
+  0xcc,0xec,0x88,0xcc,0xeb,0x87,0xcb,0xeb,0x87,0xcb,0xeb,0x86,0xca,0xeb,0x85,0xc9,
+  0xeb,0x85,0xc9,0xea,0x85,0xc9,0xea,0x89,0xcd,0xef,0x88,0xcc,0xee,0x00,0x85,0xc7,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x86,0xc9,0x00,
+  0x86,0xc9,0x00,0x86,0xc9,0x00,0x86,0xc9,0x00,0x86,0xc9,0x00,0x86,0xc9,0x00,0x86,
+  0xc9,0x00,0x86,0xc9,0x00,0x86,0xc9,0x00,0x86,0xc9,0x00,0x86,0xc9,0x00,0x86,0xc9,
+  0x00,0x86,0xc9,0x00,0x86,0xc9,0x8f,0xd3,0xf2,0xff,0xff,0xfe,0xfc,0xfc,0xfa,0xf8,
+  0xf8,0xf3,0xf3,0xf3,0xeb,0xef,0xef,0xe4,0xea,0xea,0xdd,0xe7,0xe7,0xd7,0xfe,0xca,
+  0x42,0xf8,0xbf,0x37,0xf2,0xb1,0x29,0x88,0xcc,0xee,0x00,0x86,0xc9,0x00,0x86,0xc9,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0x00,0x87,0xca,0x00,0x87,0xca,0x8b,0xcf,0xf0,0xfc,0xfc,0xfa,0xf8,
+  0xf8,0xf3,0xf3,0xf3,0xeb,0xef,0xef,0xe4,0xea,0xea,0xdd,0xe7,0xe7,0xd7,0xfe,0xca,
+  0x42,0xf8,0xbf,0x37,0x88,0xcc,0xee,0x00,0x87,0xca,0x00,0x87,0xca,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x87,0xcb,0x00,0x87,0xcb,0x89,0xcd,0xee,0x88,
+  0xcc,0xee,0x88,0xcc,0xee,0x88,0xcc,0xee,0x88,0xcc,0xee,0x88,0xcc,0xee,0x88,0xcc,
+  0xee,0x88,0xcc,0xee,0x00,0x87,0xcb,0x00,0x87,0xcb,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x88,0xcc,0x00,0x88,0xcc,0x00,
+  0x88,0xcc,0x00,0x88,0xcc,0x00,0x88,0xcc,0x00,0x88,0xcc,0x00,0x88,0xcc,0x00,0x88,
+  0xcc,0x00,0x88,0xcc,0x00,0x88,0xcc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff
+  };
+
+/* Created by reswrap from file rename_gif.gif */
+const unsigned char rename_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf6,0x00,0x00,0x55,0x7f,0x7f,
+  0x53,0x7d,0x7d,0x51,0x7a,0x7a,0xf5,0xfc,0xfc,0xef,0xf9,0xf9,0xea,0xf6,0xf6,0xe5,
+  0xf4,0xf4,0xe2,0xf3,0xf3,0xe1,0xf2,0xf2,0xb1,0xc2,0xc2,0x0c,0x0c,0x0c,0xf3,0xfa,
+  0xfa,0xec,0xf4,0xf4,0xe7,0xf1,0xf1,0xdf,0xec,0xec,0xd9,0xe8,0xe8,0xd5,0xe6,0xe6,
+  0xd4,0xe5,0xe5,0xa5,0xb6,0xb6,0xff,0xff,0xff,0x4e,0x77,0x77,0xf4,0xfa,0xfa,0xbe,
+  0xc3,0xc3,0x8d,0x91,0x91,0xb8,0xc0,0xc0,0x85,0x8d,0x8d,0xad,0xb9,0xb9,0x93,0xa4,
+  0xa4,0x25,0x49,0x49,0x4c,0x74,0x74,0xf6,0xfb,0xfb,0xf0,0xf6,0xf6,0xee,0xf5,0xf5,
+  0x88,0x8d,0x8d,0x11,0x11,0x11,0x18,0x1e,0x1e,0x8c,0x8d,0x8d,0x8b,0x8c,0x8c,0x8a,
+  0x8c,0x8c,0x88,0x8a,0x8a,0x89,0x8b,0x8b,0x9f,0xa5,0xa5,0x48,0x71,0x71,0x3d,0x3d,
+  0x3d,0xdf,0xdf,0xdf,0x86,0x86,0x86,0xa5,0xa7,0xa7,0x45,0x6d,0x6d,0x52,0x52,0x52,
+  0xe7,0xe7,0xe7,0x61,0x83,0xe9,0x42,0x64,0xc8,0x26,0x48,0xad,0x27,0x49,0xb8,0x39,
+  0x5b,0xda,0x7d,0x7d,0x7d,0xb0,0xb2,0xb2,0x42,0x69,0x69,0x62,0x62,0x62,0xf1,0xf1,
+  0xf1,0x75,0x75,0x75,0xb9,0xbb,0xbb,0xea,0xf7,0xf7,0x3e,0x65,0x65,0x6f,0x6f,0x6f,
+  0xfa,0xfa,0xfa,0x6d,0x6d,0x6d,0xc0,0xc2,0xc2,0x3a,0x61,0x61,0x79,0x79,0x79,0x7a,
+  0x7a,0x7a,0x6c,0x74,0x74,0xc9,0xc9,0xc9,0xc8,0xc9,0xc9,0xc8,0xc8,0xc8,0x64,0x64,
+  0x64,0xc7,0xc8,0xc8,0xd1,0xd3,0xd3,0xf2,0xf7,0xf7,0xf2,0xfa,0xfa,0x37,0x5c,0x5c,
+  0x33,0x58,0x58,0xfe,0xff,0xff,0xfc,0xfd,0xfd,0xfb,0xfd,0xfd,0x5b,0x5c,0x5c,0xf8,
+  0xfb,0xfb,0xf6,0xfa,0xfa,0xf4,0xf8,0xf8,0x2f,0x54,0x54,0xab,0xab,0xab,0x57,0x57,
+  0x57,0xa9,0xab,0xab,0x56,0x57,0x57,0xa6,0xa9,0xa9,0xf5,0xfb,0xfb,0x26,0x49,0x49,
+  0xfe,0xfe,0xfe,0xf9,0xfc,0xfc,0x17,0x38,0x38,0xfd,0xfe,0xfe,0xfc,0xfe,0xfe,0xfa,
+  0xfd,0xfd,0xf8,0xfc,0xfc,0xf9,0xfe,0xfe,0x0c,0x2c,0x2c,0x0b,0x2a,0x2a,0x00,0xff,
+  0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x6b,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x07,
+  0xc8,0x80,0x6b,0x82,0x6b,0x00,0x85,0x86,0x87,0x83,0x83,0x01,0x03,0x04,0x05,0x06,
+  0x07,0x08,0x08,0x09,0x01,0x01,0x89,0x6b,0x02,0x0b,0x0c,0x0d,0x0e,0x0f,0x10,0x11,
+  0x12,0x13,0x02,0x02,0x89,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x10,0x1b,0xad,0x1c,
+  0x89,0x1d,0x1e,0x1f,0x20,0x21,0x9b,0x9d,0x11,0x08,0x1d,0x22,0x0a,0xbc,0x23,0x24,
+  0x25,0x26,0x27,0x28,0x29,0x9c,0x10,0x08,0x2a,0x2b,0x2c,0xca,0xcb,0x2c,0x2d,0x2c,
+  0x2e,0xb6,0x07,0x2f,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x31,0x37,0x31,0x38,0x9a,
+  0x0e,0x06,0x39,0x3a,0x3b,0xd6,0xd8,0x36,0x3b,0x3c,0x3b,0x3d,0x20,0x9a,0x3e,0x3f,
+  0x40,0x41,0xf1,0xf2,0x41,0x42,0x41,0x43,0xb3,0x0c,0x04,0x44,0x45,0x46,0xfd,0x47,
+  0x48,0x49,0x94,0x2c,0x61,0xd2,0xc4,0xc9,0xac,0x27,0x50,0x12,0x45,0x91,0x32,0x85,
+  0x4a,0x15,0x2b,0x57,0xb0,0x18,0x5c,0x10,0x25,0x51,0x96,0x09,0x5a,0xb6,0x70,0xe9,
+  0xe2,0x25,0xa2,0x93,0x2f,0x59,0x12,0x81,0x99,0x30,0x21,0x4c,0x43,0x31,0x10,0xb1,
+  0x78,0x00,0x93,0x68,0x0c,0xc9,0x09,0x52,0xc8,0x94,0xa1,0x62,0xe6,0x0c,0x9a,0x31,
+  0x89,0xd2,0xa8,0xd9,0xc9,0xb3,0x67,0x9a,0x40,0x00,0x3b
+  };
+
+/* Created by reswrap from file rotateleft.gif */
+const unsigned char rotateleft[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xa1,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0xff,0xff,0xff,0x5d,0x60,0x69,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,
+  0x10,0x00,0x00,0x02,0x3b,0x84,0x8f,0x69,0x11,0xcb,0xac,0x40,0x10,0x4c,0x58,0x0b,
+  0xd1,0xbc,0x1c,0x6b,0xfe,0x6c,0xc1,0x70,0x6c,0xd8,0x80,0x8a,0x65,0xd7,0x48,0xa7,
+  0x13,0x8e,0x2e,0x45,0x1a,0xc3,0x88,0xa2,0xb3,0xbc,0x50,0x89,0x58,0xdb,0x85,0x4e,
+  0xc1,0x59,0x87,0xa6,0x30,0x61,0x70,0x91,0x58,0x2e,0x62,0xcb,0x15,0xa1,0xd4,0x02,
+  0x00,0x3b
+  };
+
+/* Created by reswrap from file rotateright.gif */
+const unsigned char rotateright[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xa1,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0xff,0xff,0xff,0x5d,0x60,0x69,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,
+  0x10,0x00,0x00,0x02,0x3b,0x84,0x8f,0xa9,0xc1,0x6c,0x8e,0x98,0x98,0x53,0x86,0x71,
+  0x02,0xdd,0xf4,0xe6,0xda,0x6c,0x1e,0xa0,0x09,0xd7,0x30,0x94,0x15,0x46,0xae,0xad,
+  0xc8,0x96,0x5e,0x43,0xc7,0x2e,0x80,0xa6,0xf9,0x73,0xf3,0x41,0x22,0xa3,0xf5,0x5e,
+  0x1c,0x13,0x0a,0xa8,0x5a,0xb1,0x16,0xb5,0xa5,0x02,0x97,0x73,0x3e,0xa7,0x86,0x02,
+  0x00,0x3b
+  };
+
+/* Created by reswrap from file run_bmp.bmp */
+const unsigned char run_bmp[]={
+  0x42,0x4d,0x36,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x20,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x0c,0x00,0x00,0x88,0x0f,0x00,0x00,0x61,0x0f,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,
+  0xbd,0xbd,0xbd,0xa2,0xa2,0xa2,0x85,0x85,0x85,0x52,0x52,0x52,0x00,0x00,0x00,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,
+  0xb2,0xb2,0xb2,0xb2,0xb2,0xb2,0x91,0x91,0x91,0x55,0x55,0x55,0x00,0x00,0x00,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,
+  0xb2,0xb2,0xb2,0xb2,0xb2,0xb2,0x91,0x91,0x91,0x55,0x55,0x55,0x00,0x00,0x00,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,
+  0x91,0x91,0x91,0xaa,0xaa,0xaa,0x8a,0x8a,0x8a,0x46,0x46,0x46,0x00,0x00,0x00,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x02,0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0x00,0x00,0x00,0x65,0x65,0x65,0x62,0x62,0x62,0x4e,0x4e,0x4e,0x42,0x42,
+  0x42,0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x1d,0x1d,0x1d,
+  0x75,0x75,0x75,0xa5,0xa5,0xa5,0x8d,0x8d,0x8d,0x4a,0x4a,0x4a,0x02,0x02,0x02,0x00,
+  0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x1e,0x1e,0x1e,0x36,0x36,0x36,0x85,0x85,
+  0x85,0x85,0x85,0x85,0x7a,0x7a,0x7a,0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0x00,0x00,0x00,0x95,0x95,0x95,0xb5,0xb5,0xb5,0x85,0x85,0x85,0x72,0x72,
+  0x72,0x45,0x45,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x4a,0x4a,0x4d,0x4d,0x4d,
+  0x79,0x79,0x79,0xa2,0xa2,0xa2,0x9d,0x9d,0x9d,0x65,0x65,0x65,0x1d,0x1d,0x1d,0x1a,
+  0x1a,0x1a,0x00,0x00,0x00,0x1a,0x1a,0x1a,0x42,0x42,0x42,0x85,0x85,0x85,0xa5,0xa5,
+  0xa5,0xa5,0xa5,0xa5,0x6a,0x6a,0x6a,0x02,0x02,0x02,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0x00,0x00,0x00,0xb2,0xb2,0xb2,0xe2,0xe2,0xe2,0xc5,0xc5,0xc5,0xba,0xba,
+  0xba,0x6e,0x6e,0x6e,0x46,0x46,0x46,0x62,0x62,0x62,0x92,0x92,0x92,0x9e,0x9e,0x9e,
+  0xaa,0xaa,0xaa,0xb5,0xb5,0xb5,0xad,0xad,0xad,0x9a,0x9a,0x9a,0x76,0x76,0x76,0x5d,
+  0x5d,0x5d,0x1d,0x1d,0x1d,0x45,0x45,0x45,0x8a,0x8a,0x8a,0xa5,0xa5,0xa5,0xb2,0xb2,
+  0xb2,0xaa,0xaa,0xaa,0x6a,0x6a,0x6a,0x02,0x02,0x02,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0x00,0x00,0x00,0xb2,0xb2,0xb2,0xe2,0xe2,0xe2,0xc6,0xc6,0xc6,0xc5,0xc5,
+  0xc5,0xbd,0xbd,0xbd,0xaa,0xaa,0xaa,0xad,0xad,0xad,0xb9,0xb9,0xb9,0xba,0xba,0xba,
+  0xb5,0xb5,0xb5,0xb9,0xb9,0xb9,0xb5,0xb5,0xb5,0xad,0xad,0xad,0xaa,0xaa,0xaa,0xa5,
+  0xa5,0xa5,0x7a,0x7a,0x7a,0x86,0x86,0x86,0xaa,0xaa,0xaa,0xb2,0xb2,0xb2,0xaa,0xaa,
+  0xaa,0x6a,0x6a,0x6a,0x2a,0x2a,0x2a,0x02,0x02,0x02,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0xaa,0xaa,0xaa,0xe2,0xe2,0xe2,0xc5,0xc5,
+  0xc5,0xc5,0xc5,0xc5,0xc2,0xc2,0xc2,0xc1,0xc1,0xc1,0xc1,0xc1,0xc1,0xbd,0xbd,0xbd,
+  0xbe,0xbe,0xbe,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xb5,0xb5,0xb5,0xb2,
+  0xb2,0xb2,0xa2,0xa2,0xa2,0xaa,0xaa,0xaa,0xad,0xad,0xad,0xa5,0xa5,0xa5,0x76,0x76,
+  0x76,0x35,0x35,0x35,0x16,0x16,0x16,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0xaa,0xaa,0xaa,0xd5,0xd5,
+  0xd5,0xca,0xca,0xca,0xc5,0xc5,0xc5,0xc5,0xc5,0xc5,0xc2,0xc2,0xc2,0xc2,0xc2,0xc2,
+  0xbd,0xbd,0xbd,0xbd,0xbd,0xbd,0xbd,0xbd,0xbd,0xb6,0xb6,0xb6,0xb5,0xb5,0xb5,0xb2,
+  0xb2,0xb2,0xb2,0xb2,0xb2,0xb2,0xb2,0xb2,0xa5,0xa5,0xa5,0x82,0x82,0x82,0x36,0x36,
+  0x36,0x15,0x15,0x15,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x82,0x82,0x82,0xdd,0xdd,
+  0xdd,0xcd,0xcd,0xcd,0xca,0xca,0xca,0xc5,0xc5,0xc5,0xc2,0xc2,0xc2,0xbe,0xbe,0xbe,
+  0xc2,0xc2,0xc2,0xc5,0xc5,0xc5,0xc6,0xc6,0xc6,0xc9,0xc9,0xc9,0xbd,0xbd,0xbd,0xb5,
+  0xb5,0xb5,0xb5,0xb5,0xb5,0xb2,0xb2,0xb2,0xa2,0xa2,0xa2,0x7a,0x7a,0x7a,0x1d,0x1d,
+  0x1d,0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x8a,0x8a,0x8a,0xdd,0xdd,0xdd,0xcd,0xcd,
+  0xcd,0xcd,0xcd,0xcd,0xca,0xca,0xca,0xc5,0xc5,0xc5,0xc1,0xc1,0xc1,0xba,0xba,0xba,
+  0xbd,0xbd,0xbd,0xca,0xca,0xca,0xd5,0xd5,0xd5,0xe1,0xe1,0xe1,0xda,0xda,0xda,0xbd,
+  0xbd,0xbd,0xb9,0xb9,0xb9,0xb5,0xb5,0xb5,0xb5,0xb5,0xb5,0xa5,0xa5,0xa5,0x5a,0x5a,
+  0x5a,0x1a,0x1a,0x1a,0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x8a,0x8a,0x8a,0xe1,0xe1,0xe1,0xcd,0xcd,
+  0xcd,0xcd,0xcd,0xcd,0xca,0xca,0xca,0xbe,0xbe,0xbe,0xad,0xad,0xad,0xa2,0xa2,0xa2,
+  0x32,0x32,0x32,0x1d,0x1d,0x1d,0x2a,0x2a,0x2a,0x72,0x72,0x72,0xf5,0xf5,0xf5,0xd9,
+  0xd9,0xd9,0xbd,0xbd,0xbd,0xb5,0xb5,0xb5,0xb2,0xb2,0xb2,0xa5,0xa5,0xa5,0x7a,0x7a,
+  0x7a,0x1d,0x1d,0x1d,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x00,0x00,0x00,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x6a,0x6a,0x6a,0x7e,0x7e,0x7e,0x7e,
+  0x7e,0x7e,0x79,0x79,0x79,0x75,0x75,0x75,0xa2,0xa2,0xa2,0xda,0xda,0xda,0xd2,0xd2,
+  0xd2,0xd2,0xd2,0xd2,0xcd,0xcd,0xcd,0xb5,0xb5,0xb5,0x7d,0x7d,0x7d,0x3a,0x3a,0x3a,
+  0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x42,0x42,0x42,0x6e,0x6e,0x6e,0xe2,
+  0xe2,0xe2,0xca,0xca,0xca,0xba,0xba,0xba,0xb6,0xb6,0xb6,0xb2,0xb2,0xb2,0x9a,0x9a,
+  0x9a,0x65,0x65,0x65,0x46,0x46,0x46,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x3e,0x3e,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x82,0xba,0xba,0xba,0xba,
+  0xba,0xba,0xb6,0xb6,0xb6,0xb6,0xb6,0xb6,0xc5,0xc5,0xc5,0xda,0xda,0xda,0xd2,0xd2,
+  0xd2,0xd2,0xd2,0xd2,0xcd,0xcd,0xcd,0xa5,0xa5,0xa5,0x5d,0x5d,0x5d,0x06,0x06,0x06,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x25,0x25,0x25,0xda,
+  0xda,0xda,0xc9,0xc9,0xc9,0xbd,0xbd,0xbd,0xb9,0xb9,0xb9,0xb5,0xb5,0xb5,0xad,0xad,
+  0xad,0x9a,0x9a,0x9a,0x8d,0x8d,0x8d,0x82,0x82,0x82,0x7e,0x7e,0x7e,0x7e,0x7e,0x7e,
+  0x75,0x75,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x8d,0x8d,0x8d,0xe5,0xe5,0xe5,0xe5,
+  0xe5,0xe5,0xe9,0xe9,0xe9,0xe5,0xe5,0xe5,0xdd,0xdd,0xdd,0xda,0xda,0xda,0xd5,0xd5,
+  0xd5,0xd5,0xd5,0xd5,0xd2,0xd2,0xd2,0xa2,0xa2,0xa2,0x51,0x51,0x51,0x02,0x02,0x02,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x1d,0x1d,0x1d,0xcd,
+  0xcd,0xcd,0xc5,0xc5,0xc5,0xbd,0xbd,0xbd,0xba,0xba,0xba,0xb5,0xb5,0xb5,0xb2,0xb2,
+  0xb2,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,0xad,0xad,0xad,0xad,0xad,0xad,0xad,0xad,0xad,
+  0x9d,0x9d,0x9d,0x00,0x00,0x00,0x00,0x00,0x00,0x7d,0x7d,0x7d,0xe9,0xe9,0xe9,0xe9,
+  0xe9,0xe9,0xe9,0xe9,0xe9,0xe9,0xe9,0xe9,0xe5,0xe5,0xe5,0xdd,0xdd,0xdd,0xd5,0xd5,
+  0xd5,0xd5,0xd5,0xd5,0xd5,0xd5,0xd5,0xa2,0xa2,0xa2,0x4d,0x4d,0x4d,0x0d,0x0d,0x0d,
+  0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x32,0x32,0x32,0xba,
+  0xba,0xba,0xc1,0xc1,0xc1,0xbe,0xbe,0xbe,0xba,0xba,0xba,0xb6,0xb6,0xb6,0xaa,0xaa,
+  0xaa,0x86,0x86,0x86,0x8a,0x8a,0x8a,0x9a,0x9a,0x9a,0xa9,0xa9,0xa9,0xa9,0xa9,0xa9,
+  0xad,0xad,0xad,0x00,0x00,0x00,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x4e,0x4e,0x4e,0x9a,0x9a,0x9a,0xf5,0xf5,0xf5,0xdd,0xdd,
+  0xdd,0xda,0xda,0xda,0xd5,0xd5,0xd5,0xb2,0xb2,0xb2,0x79,0x79,0x79,0x4a,0x4a,0x4a,
+  0x0d,0x0d,0x0d,0x02,0x02,0x02,0x06,0x06,0x06,0x3a,0x3a,0x3a,0xa2,0xa2,0xa2,0xba,
+  0xba,0xba,0xc2,0xc2,0xc2,0xc2,0xc2,0xc2,0xbd,0xbd,0xbd,0xb5,0xb5,0xb5,0x9d,0x9d,
+  0x9d,0x32,0x32,0x32,0x0d,0x0d,0x0d,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+  0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x92,0x92,0x92,0xf5,0xf5,0xf5,0xda,0xda,
+  0xda,0xda,0xda,0xda,0xda,0xda,0xda,0xcd,0xcd,0xcd,0xb2,0xb2,0xb2,0x79,0x79,0x79,
+  0x51,0x51,0x51,0x4a,0x4a,0x4a,0x5a,0x5a,0x5a,0x7d,0x7d,0x7d,0xb2,0xb2,0xb2,0xbe,
+  0xbe,0xbe,0xc2,0xc2,0xc2,0xc2,0xc2,0xc2,0xc2,0xc2,0xc2,0xba,0xba,0xba,0x92,0x92,
+  0x92,0x2a,0x2a,0x2a,0x0a,0x0a,0x0a,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0xad,0xad,0xad,0xe9,0xe9,
+  0xe9,0xdd,0xdd,0xdd,0xdd,0xdd,0xdd,0xda,0xda,0xda,0xcd,0xcd,0xcd,0xb2,0xb2,0xb2,
+  0xa2,0xa2,0xa2,0x9e,0x9e,0x9e,0xaa,0xaa,0xaa,0xb5,0xb5,0xb5,0xbe,0xbe,0xbe,0xc6,
+  0xc6,0xc6,0xc9,0xc9,0xc9,0xc5,0xc5,0xc5,0xbd,0xbd,0xbd,0x9d,0x9d,0x9d,0x45,0x45,
+  0x45,0x25,0x25,0x25,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x9d,0x9d,0x9d,0xf2,0xf2,
+  0xf2,0xe2,0xe2,0xe2,0xda,0xda,0xda,0xd5,0xd5,0xd5,0xd5,0xd5,0xd5,0xd5,0xd5,0xd5,
+  0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xca,
+  0xca,0xca,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xbe,0xbe,0xbe,0x9d,0x9d,0x9d,0x2a,0x2a,
+  0x2a,0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x9e,0x9e,0x9e,0xf2,0xf2,0xf2,0xdd,0xdd,
+  0xdd,0xdd,0xdd,0xdd,0xe1,0xe1,0xe1,0xdd,0xdd,0xdd,0xdd,0xdd,0xdd,0xda,0xda,0xda,
+  0xd5,0xd5,0xd5,0xd5,0xd5,0xd5,0xd2,0xd2,0xd2,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xca,
+  0xca,0xca,0xcd,0xcd,0xcd,0xcd,0xcd,0xcd,0xca,0xca,0xca,0xbd,0xbd,0xbd,0x6e,0x6e,
+  0x6e,0x22,0x22,0x22,0x0e,0x0e,0x0e,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0x00,0x00,0x00,0xa5,0xa5,0xa5,0xdd,0xdd,0xdd,0xe2,0xe2,0xe2,0xdd,0xdd,
+  0xdd,0xe2,0xe2,0xe2,0xf2,0xf2,0xf2,0xed,0xed,0xed,0xdd,0xdd,0xdd,0xdd,0xdd,0xdd,
+  0xd9,0xd9,0xd9,0xd5,0xd5,0xd5,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0xcd,
+  0xcd,0xcd,0xdd,0xdd,0xdd,0xd5,0xd5,0xd5,0xcd,0xcd,0xcd,0xca,0xca,0xca,0xc1,0xc1,
+  0xc1,0x72,0x72,0x72,0x25,0x25,0x25,0x02,0x02,0x02,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0x00,0x00,0x00,0xb2,0xb2,0xb2,0xe9,0xe9,0xe9,0xdd,0xdd,0xdd,0xdd,0xdd,
+  0xdd,0xf5,0xf5,0xf5,0x9d,0x9d,0x9d,0xad,0xad,0xad,0xf5,0xf5,0xf5,0xf2,0xf2,0xf2,
+  0xdd,0xdd,0xdd,0xd5,0xd5,0xd5,0xd5,0xd5,0xd5,0xdd,0xdd,0xdd,0xe1,0xe1,0xe1,0xdd,
+  0xdd,0xdd,0x82,0x82,0x82,0xa2,0xa2,0xa2,0xd9,0xd9,0xd9,0xc5,0xc5,0xc5,0xc5,0xc5,
+  0xc5,0x86,0x86,0x86,0x32,0x32,0x32,0x02,0x02,0x02,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0x00,0x00,0x00,0xad,0xad,0xad,0xed,0xed,0xed,0xe9,0xe9,0xe9,0xdd,0xdd,
+  0xdd,0x9d,0x9d,0x9d,0x00,0x00,0x00,0x00,0x00,0x00,0x95,0x95,0x95,0x9a,0x9a,0x9a,
+  0xe5,0xe5,0xe5,0xe2,0xe2,0xe2,0xc5,0xc5,0xc5,0xa5,0xa5,0xa5,0x8a,0x8a,0x8a,0x8a,
+  0x8a,0x8a,0x00,0x00,0x00,0x00,0x00,0x00,0x9d,0x9d,0x9d,0xd9,0xd9,0xd9,0xd9,0xd9,
+  0xd9,0xb2,0xb2,0xb2,0x4a,0x4a,0x4a,0x02,0x02,0x02,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0x00,0x00,0x00,0x8a,0x8a,0x8a,0xad,0xad,0xad,0xb5,0xb5,0xb5,0xa5,0xa5,
+  0xa5,0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x52,0x52,0x52,
+  0xe9,0xe9,0xe9,0xe5,0xe5,0xe5,0xb2,0xb2,0xb2,0x75,0x75,0x75,0x42,0x42,0x42,0x00,
+  0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0xa2,0xa2,0xa2,0xa2,0xa2,
+  0xa2,0x85,0x85,0x85,0x45,0x45,0x45,0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,
+  0xe9,0xe9,0xe9,0xe5,0xe5,0xe5,0xb5,0xb5,0xb5,0x7a,0x7a,0x7a,0x00,0x00,0x00,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,
+  0xe9,0xe9,0xe9,0xe5,0xe5,0xe5,0xba,0xba,0xba,0x7e,0x7e,0x7e,0x00,0x00,0x00,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,
+  0xe9,0xe9,0xe9,0xe5,0xe5,0xe5,0xba,0xba,0xba,0x7e,0x7e,0x7e,0x00,0x00,0x00,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0x00,0x00,0x00,
+  0xd9,0xd9,0xd9,0xf5,0xf5,0xf5,0xd9,0xd9,0xd9,0x95,0x95,0x95,0x00,0x00,0x00,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdc,0xc0,0xb2,0xdc,
+  0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,
+  0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,0xdc,0xc0,0xb2,
+  0xdc,0xc0,0xb2,0xdc,0xc0,0xb2
+  };
+
+/* Created by reswrap from file search.gif */
+const unsigned char search[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf7,0x00,0x00,0xff,0xff,0xff,
+  0x01,0x01,0x01,0x77,0x77,0x77,0x0d,0x0d,0x0d,0x0f,0x0f,0x0f,0x12,0x12,0x12,0x15,
+  0x15,0x15,0x44,0x44,0x44,0x85,0x85,0x85,0x73,0x73,0x73,0x6f,0x6f,0x73,0x77,0x77,
+  0x76,0x6e,0x6e,0x70,0x7f,0x7f,0x7f,0x5d,0x5d,0x5c,0x53,0x53,0x5b,0x33,0x33,0x33,
+  0x70,0x70,0x70,0x63,0x63,0x63,0x52,0x52,0x56,0x7c,0x7c,0x7c,0x5a,0x5a,0x59,0x3a,
+  0x3a,0x3a,0x45,0x45,0x45,0x60,0x60,0x60,0x4f,0x4f,0x53,0x11,0x11,0x11,0x4f,0x4f,
+  0x4f,0x6a,0x6a,0x6a,0x44,0x44,0x43,0x7a,0x7a,0x7a,0x6f,0x6f,0x6e,0x54,0x54,0x54,
+  0x39,0x39,0x3a,0x55,0x55,0x55,0x6d,0x6d,0x6d,0x64,0x64,0x64,0x64,0x64,0x68,0x74,
+  0x74,0x74,0x5e,0x5e,0x5c,0x4b,0x4b,0x55,0x0e,0x0e,0x0e,0x75,0x75,0x75,0x63,0x63,
+  0x62,0x49,0x49,0x48,0x48,0x48,0x50,0x71,0x71,0x71,0x5b,0x5b,0x59,0x41,0x41,0x41,
+  0x48,0x48,0x52,0x0a,0x0a,0x0a,0x72,0x72,0x72,0x60,0x60,0x5f,0x46,0x46,0x45,0x45,
+  0x45,0x4d,0x6e,0x6e,0x6e,0x58,0x58,0x56,0x3e,0x3e,0x3e,0x45,0x45,0x4f,0x08,0x08,
+  0x08,0x6f,0x6f,0x6f,0x43,0x43,0x42,0x42,0x42,0x4a,0x6c,0x6c,0x6c,0x61,0x61,0x60,
+  0x57,0x57,0x5c,0x06,0x06,0x06,0x56,0x56,0x56,0x56,0x56,0x5a,0x40,0x40,0x40,0x04,
+  0x04,0x04,0x00,0x00,0x00,0x67,0x67,0x67,0x5c,0x5c,0x5c,0x4f,0x4f,0x50,0x53,0x53,
+  0x58,0x02,0x02,0x02,0x68,0x68,0x68,0x5f,0x5f,0x5e,0x52,0x52,0x51,0x51,0x51,0x55,
+  0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0x51,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x08,
+  0xc0,0x00,0xa3,0x08,0x0c,0x40,0x50,0xe0,0xc0,0x82,0x06,0x07,0x0a,0x18,0x90,0x70,
+  0x80,0x80,0x00,0x09,0xa3,0x04,0x30,0x70,0xc0,0x80,0x01,0x81,0x16,0x2b,0x42,0x34,
+  0x18,0x00,0x41,0x02,0x05,0x16,0x2d,0x22,0x58,0xc0,0x60,0xe3,0xc0,0x06,0x0e,0x1e,
+  0x40,0x88,0x10,0x01,0x42,0x03,0x09,0x13,0x4c,0x4a,0xa4,0x50,0xc1,0x02,0x84,0x9b,
+  0x10,0x2e,0x60,0xc8,0x60,0x32,0x80,0x86,0x03,0x37,0x37,0x70,0xe0,0xb0,0x01,0x42,
+  0x07,0x08,0x1a,0x36,0x06,0xf0,0xf0,0x01,0x44,0x08,0x02,0x50,0x09,0x88,0x18,0x41,
+  0xa2,0x84,0x52,0x13,0x27,0x0e,0xa0,0x18,0x90,0x22,0xc5,0x00,0x15,0x2b,0x58,0xb4,
+  0x50,0xea,0xe2,0x05,0x8c,0x18,0x32,0x04,0xca,0x98,0x41,0xa3,0x86,0x0d,0xa5,0x37,
+  0x70,0xe4,0xd0,0xb1,0x43,0xe0,0x0e,0x1e,0x0e,0x7a,0xf8,0x50,0xfa,0x03,0x08,0x88,
+  0x20,0x42,0x04,0x0a,0xf9,0x21,0x61,0x08,0x11,0xa5,0x45,0x7a,0xdc,0x34,0x22,0xd0,
+  0x08,0x8c,0x0b,0x37,0x37,0x1e,0x41,0x92,0x44,0xc9,0x12,0x26,0x02,0x99,0x34,0x71,
+  0xf2,0x04,0xca,0x11,0x81,0x47,0x42,0x87,0x56,0x2a,0x3a,0x74,0xc4,0xd3,0xa7,0x03,
+  0x02,0x00,0x3b
+  };
+
+/* Created by reswrap from file setdir.gif */
+const unsigned char setdir[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0x84,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0xcd,0x66,0x66,0x66,0xee,0xee,0x00,0xf7,0xf7,0xf7,0xf1,0xf1,0xf1,0xf4,
+  0xf4,0xf4,0xef,0xef,0xef,0xea,0xea,0xea,0xe5,0xe5,0xe5,0xcd,0xcd,0x00,0xe7,0xe7,
+  0xe7,0xe2,0xe2,0xe2,0xdd,0xdd,0xdd,0xd8,0xd8,0xd8,0xda,0xda,0xda,0xd5,0xd5,0xd5,
+  0xbb,0xbb,0xbb,0x3b,0x5b,0x70,0xc4,0xc4,0xc4,0xab,0xab,0xab,0x91,0x91,0x91,0x81,
+  0x81,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x05,0x57,0x20,0x20,0x8e,0x62,0x00,0x04,0xa8,
+  0x49,0x02,0x82,0x50,0xa6,0xa7,0x2a,0x0a,0xc3,0xd0,0xc2,0xef,0x48,0xd7,0x43,0x2a,
+  0xab,0x3b,0x9e,0x6b,0x05,0xe4,0x09,0x87,0xa7,0x99,0x71,0xd9,0x22,0x05,0x97,0xc2,
+  0x59,0x0b,0x6a,0x1c,0x0a,0x08,0x85,0x29,0xb4,0xc9,0x32,0x1c,0x10,0x09,0xad,0x50,
+  0x61,0x15,0x2c,0x18,0x0d,0x87,0x56,0xa0,0x20,0x3b,0x05,0x0f,0x08,0x24,0x22,0x69,
+  0xb9,0x57,0x2c,0xc1,0x84,0x52,0x61,0x23,0xf1,0x79,0x16,0x5c,0x80,0x6f,0x2b,0x21,
+  0x00,0x3b
+  };
+
+/* Created by reswrap from file sorting.bmp */
+const unsigned char sorting[]={
+  0x42,0x4d,0x36,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x01,0x00,0x18,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x03,0x00,0x00,0x12,0x0b,0x00,0x00,0x12,0x0b,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,
+  0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+  0x80,0xff,0xff,0xff,0xff,0xff,0xff,0x58,0x58,0x58,0x00,0x00,0x00,0x58,0x58,0x58,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0x58,0x58,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x58,0x58,0x58,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x80,0xff,0xff,
+  0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+  0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,
+  0x80,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0x80,0x00,0x00,0x80,
+  0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0xff,
+  0xff,0xff,0x80,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0xff,
+  0xff,0xff,0x80,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x80,
+  0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x80,
+  0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,
+  0xff,0xff,0xff,0xff,0xff,0xff
+  };
+
+/* Created by reswrap from file smallicons.bmp */
+const unsigned char smallicons[]={
+  0x42,0x4d,0xc6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x01,0x00,0x04,0x00,0x00,0x00,
+  0x00,0x00,0x80,0x00,0x00,0x00,0x6d,0x0b,0x00,0x00,0x6d,0x0b,0x00,0x00,0x04,0x00,
+  0x00,0x00,0x04,0x00,0x00,0x00,0xdc,0xc0,0xb2,0x00,0x7f,0x00,0x00,0x00,0xff,0xff,
+  0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x10,
+  0x00,0x00,0x11,0x10,0x00,0x00,0x12,0x10,0x33,0x30,0x12,0x10,0x33,0x30,0x11,0x00,
+  0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x10,0x00,0x00,0x11,0x10,0x00,0x00,0x12,0x10,
+  0x33,0x30,0x12,0x10,0x33,0x30,0x11,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x10,
+  0x00,0x00,0x11,0x10,0x00,0x00,0x12,0x10,0x33,0x30,0x12,0x10,0x33,0x30,0x11,0x00,
+  0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00
+  };
+
+/* Created by reswrap from file unmaphost.bmp */
+const unsigned char unmaphost[]={
+  0x42,0x4d,0xc2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x28,0x00,
+  0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x01,0x00,0x04,0x00,0x00,0x00,
+  0x00,0x00,0x80,0x00,0x00,0x00,0x6d,0x0b,0x00,0x00,0x6d,0x0b,0x00,0x00,0x03,0x00,
+  0x00,0x00,0x03,0x00,0x00,0x00,0xdc,0xc0,0xb2,0x00,0x00,0x00,0x84,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0x00,0x20,0x20,0x20,0x20,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0x00,0x20,0x20,0x20,0x20,0x02,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x20,0x20,0x02,0x11,0x00,0x11,0x00,0x00,0x00,
+  0x00,0x00,0x01,0x11,0x10,0x02,0x02,0x02,0x02,0x02,0x00,0x11,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x01,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x11,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00
+  };
+
+/* Created by reswrap from file warningicon_gif.gif */
+const unsigned char warningicon_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x20,0x00,0x20,0x00,0xf2,0x00,0x00,0x80,0x80,0x80,
+  0x80,0x80,0x00,0xff,0xff,0x00,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x03,
+  0x8f,0x08,0xba,0xbc,0xf1,0x2d,0xca,0xa9,0x82,0x10,0x83,0xd0,0x2d,0xed,0xc5,0x1a,
+  0x27,0x02,0xde,0x17,0x8e,0x54,0xf9,0x65,0x68,0xfa,0xbd,0x67,0xcb,0xa8,0x2f,0x2b,
+  0xcf,0x6f,0x1e,0xcb,0x74,0x6e,0xdf,0xa5,0x0c,0x81,0x30,0x30,0xdd,0x48,0xb0,0xe1,
+  0x70,0xb5,0x13,0xa9,0x94,0x4b,0x63,0x8b,0x06,0x25,0xd4,0x9a,0xae,0xa4,0x52,0x87,
+  0xea,0x55,0x7d,0xd8,0x48,0x2f,0xa0,0xf4,0x3a,0x73,0x17,0x21,0x11,0xfd,0x9b,0xf4,
+  0x2e,0x5b,0xb4,0x20,0x5c,0x91,0x5f,0xc8,0x6f,0x50,0x56,0x9e,0x29,0xda,0xc3,0x79,
+  0x26,0x76,0x69,0x58,0x81,0x83,0x5c,0x0d,0x86,0x20,0x6b,0x76,0x6d,0x48,0x87,0x50,
+  0x90,0x38,0x87,0x73,0x71,0x8d,0x27,0x8a,0x8b,0x7e,0x83,0x98,0x94,0x9e,0x30,0x0e,
+  0x9f,0x9f,0x6d,0x99,0x9e,0x8e,0x24,0x55,0xa9,0xaa,0xa9,0x47,0xad,0xae,0x22,0x09,
+  0x00,0x3b
+  };
+
+/* Created by reswrap from file work_gif.gif */
+const unsigned char work_gif[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,
+  0xff,0x00,0x00,0x00,0xff,0x00,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0x00,0xff,0x00,
+  0xff,0xff,0xff,0xff,0xff,0xdb,0xdb,0xdb,0xb6,0xb6,0xb6,0x92,0x92,0x92,0x6d,0x6d,
+  0x6d,0x49,0x49,0x49,0x24,0x24,0x24,0xdb,0x00,0x00,0xb6,0x00,0x00,0x92,0x00,0x00,
+  0x6d,0x00,0x00,0x49,0x00,0x00,0x24,0x00,0x00,0x00,0xdb,0x00,0x00,0xb6,0x00,0x00,
+  0x92,0x00,0x00,0x6d,0x00,0x00,0x49,0x00,0x00,0x24,0x00,0xdb,0xdb,0x00,0xb6,0xb6,
+  0x00,0x92,0x92,0x00,0x6d,0x6d,0x00,0x49,0x49,0x00,0x24,0x24,0x00,0x00,0x00,0xdb,
+  0x00,0x00,0xb6,0x00,0x00,0x92,0x00,0x00,0x6d,0x00,0x00,0x49,0x00,0x00,0x24,0xdb,
+  0x00,0xdb,0xb6,0x00,0xb6,0x92,0x00,0x92,0x6d,0x00,0x6d,0x49,0x00,0x49,0x24,0x00,
+  0x24,0x00,0xdb,0xdb,0x00,0xb6,0xb6,0x00,0x92,0x92,0x00,0x6d,0x6d,0x00,0x49,0x49,
+  0x00,0x24,0x24,0xff,0xdb,0xdb,0xdb,0xb6,0xb6,0xb6,0x92,0x92,0x92,0x6d,0x6d,0x6d,
+  0x49,0x49,0x49,0x24,0x24,0xff,0xb6,0xb6,0xdb,0x92,0x92,0xb6,0x6d,0x6d,0x92,0x49,
+  0x49,0x6d,0x24,0x24,0xff,0x92,0x92,0xdb,0x6d,0x6d,0xb6,0x49,0x49,0x92,0x24,0x24,
+  0xff,0x6d,0x6d,0xdb,0x49,0x49,0xb6,0x24,0x24,0xff,0x49,0x49,0xdb,0x24,0x24,0xff,
+  0x24,0x24,0xdb,0xff,0xdb,0xb6,0xdb,0xb6,0x92,0xb6,0x92,0x6d,0x92,0x6d,0x49,0x6d,
+  0x49,0x24,0x49,0x24,0xb6,0xff,0xb6,0x92,0xdb,0x92,0x6d,0xb6,0x6d,0x49,0x92,0x49,
+  0x24,0x6d,0x24,0x92,0xff,0x92,0x6d,0xdb,0x6d,0x49,0xb6,0x49,0x24,0x92,0x24,0x6d,
+  0xff,0x6d,0x49,0xdb,0x49,0x24,0xb6,0x24,0x49,0xff,0x49,0x24,0xdb,0x24,0x24,0xff,
+  0x24,0xdb,0xdb,0xff,0xb6,0xb6,0xdb,0x92,0x92,0xb6,0x6d,0x6d,0x92,0x49,0x49,0x6d,
+  0x24,0x24,0x49,0xb6,0xb6,0xff,0x92,0x92,0xdb,0x6d,0x6d,0xb6,0x49,0x49,0x92,0x24,
+  0x24,0x6d,0x92,0x92,0xff,0x6d,0x6d,0xdb,0x49,0x49,0xb6,0x24,0x24,0x92,0x6d,0x6d,
+  0xff,0x49,0x49,0xdb,0x24,0x24,0xb6,0x49,0x49,0xff,0x24,0x24,0xdb,0x24,0x24,0xff,
+  0xff,0xff,0xdb,0xdb,0xdb,0xb6,0xb6,0xb6,0x92,0x92,0x92,0x6d,0x6d,0x6d,0x49,0x49,
+  0x49,0x24,0xff,0xff,0xb6,0xdb,0xdb,0x92,0xb6,0xb6,0x6d,0x92,0x92,0x49,0x6d,0x6d,
+  0x24,0xff,0xff,0x92,0xdb,0xdb,0x6d,0xb6,0xb6,0x49,0x92,0x92,0x24,0xff,0xff,0x6d,
+  0xdb,0xdb,0x49,0xb6,0xb6,0x24,0xff,0xff,0x49,0xdb,0xdb,0x24,0xff,0xff,0x24,0xff,
+  0xdb,0xff,0xdb,0xb6,0xdb,0xb6,0x92,0xb6,0x92,0x6d,0x92,0x6d,0x49,0x6d,0x49,0x24,
+  0x49,0xff,0xb6,0xff,0xdb,0x92,0xdb,0xb6,0x6d,0xb6,0x92,0x49,0x92,0x6d,0x24,0x6d,
+  0xff,0x92,0xff,0xdb,0x6d,0xdb,0xb6,0x49,0xb6,0x92,0x24,0x92,0xff,0x6d,0xff,0xdb,
+  0x49,0xdb,0xb6,0x24,0xb6,0xff,0x49,0xff,0xdb,0x24,0xdb,0xff,0x24,0xff,0xdb,0xff,
+  0xff,0xb6,0xdb,0xdb,0x92,0xb6,0xb6,0x6d,0x92,0x92,0x49,0x6d,0x6d,0x24,0x49,0x49,
+  0xb6,0xff,0xff,0x92,0xdb,0xdb,0x6d,0xb6,0xb6,0x49,0x92,0x92,0x24,0x6d,0x6d,0x92,
+  0xff,0xff,0x6d,0xdb,0xdb,0x49,0xb6,0xb6,0x24,0x92,0x92,0x6d,0xff,0xff,0x49,0xdb,
+  0xdb,0x24,0xb6,0xb6,0x49,0xff,0xff,0x24,0xdb,0xdb,0x24,0xff,0xff,0xff,0xdb,0xb6,
+  0xdb,0xb6,0x92,0xb6,0x92,0x6d,0x92,0x6d,0x49,0x6d,0x49,0x24,0x49,0x24,0x00,0xff,
+  0xb6,0x92,0xdb,0x92,0x6d,0xb6,0x6d,0x49,0x92,0x49,0x24,0x6d,0x24,0x00,0xff,0xb6,
+  0xdb,0xdb,0x92,0xb6,0xb6,0x6d,0x92,0x92,0x49,0x6d,0x6d,0x24,0x49,0x49,0x00,0x24,
+  0xff,0x92,0xb6,0xdb,0x6d,0x92,0xb6,0x49,0x6d,0x92,0x24,0x49,0x6d,0x00,0x24,0xdb,
+  0xb6,0xff,0xb6,0x92,0xdb,0x92,0x6d,0xb6,0x6d,0x49,0x92,0x49,0x24,0x6d,0x24,0x00,
+  0x49,0xb6,0x92,0xff,0x92,0x6d,0xdb,0x6d,0x49,0xb6,0x49,0x24,0x92,0x24,0x00,0x6d,
+  0xb6,0xdb,0xff,0x92,0xb6,0xdb,0x6d,0x92,0xb6,0x49,0x6d,0x92,0x24,0x49,0x6d,0x00,
+  0x24,0x49,0x92,0xb6,0xff,0x6d,0x92,0xdb,0x49,0x6d,0xb6,0x24,0x49,0x92,0x00,0x24,
+  0x6d,0xb6,0xff,0xdb,0x92,0xdb,0xb6,0x6d,0xb6,0x92,0x49,0x92,0x6d,0x24,0x6d,0x49,
+  0x00,0x49,0x24,0x92,0xff,0xb6,0x6d,0xdb,0x92,0x49,0xb6,0x6d,0x24,0x92,0x49,0x00,
+  0x6d,0x24,0xdb,0xff,0xb6,0xb6,0xdb,0x92,0x92,0xb6,0x6d,0x6d,0x92,0x49,0x49,0x6d,
+  0x24,0x24,0x49,0x00,0xb6,0xff,0x92,0x92,0xdb,0x6d,0x6d,0xb6,0x49,0x49,0x92,0x24,
+  0x24,0x6d,0x00,0xff,0xb6,0x00,0xdb,0x92,0x00,0xb6,0x6d,0x00,0x92,0x49,0x00,0xff,
+  0x00,0xb6,0xdb,0x00,0x92,0xb6,0x00,0x6d,0x92,0x00,0x49,0x00,0xb6,0xff,0x00,0x92,
+  0xdb,0x00,0x6d,0xb6,0x00,0x49,0x92,0x00,0x00,0x00,0x00,0xff,0xff,0x21,0xf9,0x04,
+  0x01,0x00,0x00,0xff,0x00,0x2c,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x08,
+  0x77,0x00,0xeb,0x09,0x14,0xf8,0xaf,0xa0,0xc1,0x83,0xff,0xea,0xd9,0xba,0x75,0xab,
+  0x1e,0xc2,0x87,0xb9,0x16,0xde,0xca,0xf5,0x10,0x61,0x44,0x86,0x14,0x2b,0x1a,0xbc,
+  0x38,0x11,0xa1,0xae,0x83,0xba,0x38,0x66,0x2c,0xa8,0xeb,0x63,0xc1,0x5c,0x21,0x25,
+  0x8e,0xd4,0xa5,0xc1,0x24,0x8f,0x96,0x22,0x49,0x6a,0x40,0xf9,0xef,0x25,0xca,0x98,
+  0x2c,0x73,0xdd,0xd2,0x65,0x73,0xa7,0xc8,0x5c,0x33,0x19,0xe6,0x14,0xca,0x51,0x68,
+  0x49,0xa3,0xba,0x7c,0x4a,0x14,0x8a,0xaa,0x16,0x53,0xa7,0x29,0x19,0x3e,0x9d,0x1a,
+  0x55,0xaa,0xae,0x53,0x4e,0x77,0x62,0x55,0x2a,0x75,0x67,0xad,0xac,0xba,0xbe,0xee,
+  0x2c,0x49,0xb6,0xac,0xd9,0x92,0x01,0x01,0x00,0x3b
+  };
+
@@ -0,0 +1,158 @@
+/*********** Generated on 2026/10/18 22:46:56 by reswrap version 6.0.0 *********/
+
+/* Created by reswrap from file bigicons.bmp */
+extern const unsigned char bigicons[];
+
+/* Created by reswrap from file blocks_gif.gif */
+extern const unsigned char blocks_gif[];
+
+/* Created by reswrap from file bookdel_gif.gif */
+extern const unsigned char bookdel_gif[];
+
+/* Created by reswrap from file booknxt_gif.gif */
+extern const unsigned char booknxt_gif[];
+
+/* Created by reswrap from file bookprv_gif.gif */
+extern const unsigned char bookprv_gif[];
+
+/* Created by reswrap from file bookclr_gif.gif */
+extern const unsigned char bookclr_gif[];
+
+/* Created by reswrap from file bookset_gif.gif */
+extern const unsigned char bookset_gif[];
+
+/* Created by reswrap from file bookmrk_gif.gif */
+extern const unsigned char bookmrk_gif[];
+
+/* Created by reswrap from file closepanel.gif */
+extern const unsigned char closepanel[];
+
+/* Created by reswrap from file copy_gif.gif */
+extern const unsigned char copy_gif[];
+
+/* Created by reswrap from file config_gif.gif */
+extern const unsigned char config_gif[];
+
+/* Created by reswrap from file cut_gif.gif */
+extern const unsigned char cut_gif[];
+
+/* Created by reswrap from file delete_gif.gif */
+extern const unsigned char delete_gif[];
+
+/* Created by reswrap from file desktop.bmp */
+extern const unsigned char desktop[];
+
+/* Created by reswrap from file details.bmp */
+extern const unsigned char details[];
+
+/* Created by reswrap from file dirup_gif.gif */
+extern const unsigned char dirup_gif[];
+
+/* Created by reswrap from file enter.gif */
+extern const unsigned char enter[];
+
+/* Created by reswrap from file file_gif.gif */
+extern const unsigned char file_gif[];
+
+/* Created by reswrap from file fileshown.gif */
+extern const unsigned char fileshown[];
+
+/* Created by reswrap from file filehidden.gif */
+extern const unsigned char filehidden[];
+
+/* Created by reswrap from file foldernew_gif.gif */
+extern const unsigned char foldernew_gif[];
+
+/* Created by reswrap from file foxbig.gif */
+extern const unsigned char foxbig[];
+
+/* Created by reswrap from file foxmini.gif */
+extern const unsigned char foxmini[];
+
+/* Created by reswrap from file goup_gif.gif */
+extern const unsigned char goup_gif[];
+
+/* Created by reswrap from file godown_gif.gif */
+extern const unsigned char godown_gif[];
+
+/* Created by reswrap from file goback_gif.gif */
+extern const unsigned char goback_gif[];
+
+/* Created by reswrap from file goforw_gif.gif */
+extern const unsigned char goforw_gif[];
+
+/* Created by reswrap from file gotodir.bmp */
+extern const unsigned char gotodir[];
+
+/* Created by reswrap from file home_gif.gif */
+extern const unsigned char home_gif[];
+
+/* Created by reswrap from file hosts.bmp */
+extern const unsigned char hosts[];
+
+/* Created by reswrap from file iconpath.gif */
+extern const unsigned char iconpath[];
+
+/* Created by reswrap from file link_gif.gif */
+extern const unsigned char link_gif[];
+
+/* Created by reswrap from file location.gif */
+extern const unsigned char location[];
+
+/* Created by reswrap from file maphost.bmp */
+extern const unsigned char maphost[];
+
+/* Created by reswrap from file miscellaneous_gif.gif */
+extern const unsigned char miscellaneous_gif[];
+
+/* Created by reswrap from file move_gif.gif */
+extern const unsigned char move_gif[];
+
+/* Created by reswrap from file paste.gif */
+extern const unsigned char paste[];
+
+/* Created by reswrap from file pattern_gif.gif */
+extern const unsigned char pattern_gif[];
+
+/* Created by reswrap from file property_gif.gif */
+extern const unsigned char property_gif[];
+
+/* Created by reswrap from file quit_gif.gif */
+extern const unsigned char quit_gif[];
+
+/* Created by reswrap from file newfolder.bmp */
+extern const unsigned char newfolder[];
+
+/* Created by reswrap from file rename_gif.gif */
+extern const unsigned char rename_gif[];
+
+/* Created by reswrap from file rotateleft.gif */
+extern const unsigned char rotateleft[];
+
+/* Created by reswrap from file rotateright.gif */
+extern const unsigned char rotateright[];
+
+/* Created by reswrap from file run_bmp.bmp */
+extern const unsigned char run_bmp[];
+
+/* Created by reswrap from file search.gif */
+extern const unsigned char search[];
+
+/* Created by reswrap from file setdir.gif */
+extern const unsigned char setdir[];
+
+/* Created by reswrap from file sorting.bmp */
+extern const unsigned char sorting[];
+
+/* Created by reswrap from file smallicons.bmp */
+extern const unsigned char smallicons[];
+
+/* Created by reswrap from file unmaphost.bmp */
+extern const unsigned char unmaphost[];
+
+/* Created by reswrap from file warningicon_gif.gif */
+extern const unsigned char warningicon_gif[];
+
+/* Created by reswrap from file work_gif.gif */
+extern const unsigned char work_gif[];
+
@@ -0,0 +1,127 @@
+/*********** Generated on 2026/10/18 22:46:56 by reswrap version 6.0.0 *********/
+
+#include "icons.h"
+
+/* Created by reswrap from file line_0.gif */
+const unsigned char line_0[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x40,0x00,0x08,0x00,0x80,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x40,0x00,0x08,0x00,0x00,0x02,0x14,0x84,
+  0x8f,0xa9,0xcb,0xed,0x0f,0xa3,0x9c,0xb4,0xda,0x8b,0xb3,0xde,0xbc,0xfb,0x0f,0x86,
+  0xe2,0x48,0x15,0x00,0x3b
+  };
+
+/* Created by reswrap from file line_1.gif */
+const unsigned char line_1[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x40,0x00,0x08,0x00,0xf0,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x40,0x00,0x08,0x00,0x00,0x02,0x1c,0x84,
+  0x8f,0xa9,0xcb,0xed,0x0f,0xa3,0x9c,0xb4,0xda,0x6b,0x82,0xde,0xbc,0xfb,0x0f,0x86,
+  0x62,0x88,0x95,0xe6,0x89,0xa6,0xea,0xca,0xb6,0x4f,0x01,0x00,0x3b
+  };
+
+/* Created by reswrap from file line_2.gif */
+const unsigned char line_2[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x40,0x00,0x08,0x00,0xf0,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x40,0x00,0x08,0x00,0x00,0x02,0x1e,0x84,
+  0x8f,0xa9,0xcb,0xed,0x0f,0xa3,0x9c,0xb4,0xda,0x8b,0xb3,0x3e,0xa1,0xfb,0x0f,0x86,
+  0xe2,0x48,0x96,0xe6,0x89,0xa6,0xea,0xb8,0xb5,0xee,0x0b,0x1f,0x05,0x00,0x3b
+  };
+
+/* Created by reswrap from file line_3.gif */
+const unsigned char line_3[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x40,0x00,0x08,0x00,0xf0,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x40,0x00,0x08,0x00,0x00,0x02,0x1f,0x84,
+  0x8f,0xa9,0xcb,0xed,0x0f,0xa3,0x9c,0x2c,0xd8,0x8b,0xb3,0xde,0xbc,0xfb,0x0f,0x86,
+  0xe2,0x48,0x96,0xe6,0x69,0x51,0xea,0xca,0xb6,0xee,0x0b,0xc7,0x50,0x01,0x00,0x3b
+  };
+
+/* Created by reswrap from file line_4.gif */
+const unsigned char line_4[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x40,0x00,0x08,0x00,0xf0,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x40,0x00,0x08,0x00,0x00,0x02,0x1f,0x84,
+  0x8f,0xa9,0xcb,0xed,0x0f,0xa3,0x9c,0x2c,0xd8,0x8b,0xb3,0xde,0xbc,0xfb,0x0f,0x86,
+  0xe2,0x48,0x96,0xe6,0x89,0xa6,0xea,0x45,0xb5,0xee,0x0b,0xc7,0x6d,0x01,0x00,0x3b
+  };
+
+/* Created by reswrap from file line_5.gif */
+const unsigned char line_5[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x40,0x00,0x08,0x00,0xf0,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x40,0x00,0x08,0x00,0x00,0x02,0x1e,0x84,
+  0x8f,0xa9,0xcb,0xed,0x1d,0xa2,0x9c,0xb4,0xda,0x8b,0xb3,0xde,0xbc,0xfb,0x0f,0x86,
+  0xe2,0x48,0x96,0xe6,0x39,0x3e,0xea,0xca,0xb6,0xee,0x0b,0xab,0x05,0x00,0x3b
+  };
+
+/* Created by reswrap from file line_6.gif */
+const unsigned char line_6[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x40,0x00,0x08,0x00,0xf0,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x40,0x00,0x08,0x00,0x00,0x02,0x1d,0x84,
+  0x8f,0xa9,0xcb,0xed,0x1d,0xa2,0x9c,0xb4,0xda,0x8b,0xb3,0xde,0xbc,0xfb,0x0f,0x86,
+  0xe2,0x48,0x96,0xe6,0x89,0xa6,0x6a,0xf5,0xb4,0xee,0xfb,0x16,0x00,0x3b
+  };
+
+/* Created by reswrap from file line_7.gif */
+const unsigned char line_7[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x40,0x00,0x08,0x00,0xf0,0x00,0x00,0xb2,0xc0,0xdc,
+  0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x40,0x00,0x08,0x00,0x00,0x02,0x1b,0x84,
+  0x8f,0xa9,0xcb,0xed,0x1d,0xa2,0x9c,0xb4,0xda,0x8b,0xb3,0xde,0xbc,0xfb,0x0f,0x86,
+  0xe2,0x48,0x96,0xe6,0x89,0xa6,0xea,0xca,0x72,0x05,0x00,0x3b
+  };
+
+/* Created by reswrap from file line_8.gif */
+const unsigned char line_8[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x40,0x00,0x08,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x40,0x00,0x08,0x00,0x00,0x02,0x14,0x84,
+  0x8f,0xa9,0xcb,0xed,0x0f,0xa3,0x9c,0xb4,0xda,0x8b,0xb3,0xde,0xbc,0xfb,0x0f,0x86,
+  0xe2,0x48,0x15,0x00,0x3b
+  };
+
+/* Created by reswrap from file shutterbug.gif */
+const unsigned char shutterbug[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x20,0x00,0x20,0x00,0xe3,0x00,0x00,0x00,0xcd,0xcd,
+  0xcc,0xcc,0xcc,0x00,0x00,0x00,0x30,0x30,0x30,0xff,0x7d,0x1d,0xff,0x00,0x00,0xff,
+  0xa5,0x00,0xff,0xff,0x00,0xca,0x29,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x20,0x00,0x20,0x00,0x00,0x04,0xf1,0x10,0xc8,0x09,0x82,0xa5,0x58,0xda,
+  0x90,0x7b,0x15,0x20,0xe7,0x05,0xa0,0x20,0x7a,0xd4,0x66,0x76,0xe4,0x86,0x56,0xee,
+  0xd4,0x6e,0xea,0x09,0x5f,0x72,0xb9,0x6e,0x43,0x3f,0x08,0xbe,0x81,0x8b,0x54,0xb2,
+  0xd1,0x4c,0xc0,0x01,0x61,0xc9,0x64,0xfa,0x66,0xb8,0x8c,0x45,0xb9,0x2c,0x58,0xaf,
+  0xbd,0x82,0x33,0xca,0xea,0x19,0xb2,0x57,0x6b,0xf0,0x4a,0xe8,0x9d,0xa2,0x01,0xea,
+  0x38,0xbc,0xb6,0x2e,0x85,0x1f,0x51,0x9a,0x20,0xf6,0x85,0xeb,0xf7,0xc2,0x73,0xa5,
+  0x51,0x62,0x07,0x79,0x81,0x7a,0x41,0x67,0x7e,0x82,0x87,0x75,0x4f,0x32,0x86,0x88,
+  0x81,0x3e,0x07,0x07,0x66,0x15,0x80,0x77,0x3a,0x96,0x02,0x77,0x8f,0x91,0x70,0x69,
+  0x05,0x96,0x88,0x63,0x49,0x84,0x1f,0x98,0x8d,0x8e,0x41,0x8a,0x69,0x08,0xa6,0x82,
+  0xa8,0x92,0xaa,0xac,0xa7,0x03,0x90,0x92,0x93,0xab,0x7f,0xa7,0x6c,0x3d,0xb4,0x70,
+  0xb6,0x7f,0x60,0xbf,0x94,0x89,0xb5,0x7d,0xb7,0x6d,0xc3,0xba,0x8a,0x8b,0x08,0xc6,
+  0xc2,0xba,0x77,0x08,0x7b,0x46,0x03,0xcc,0xb7,0xb1,0xcc,0x9c,0x7c,0x7d,0xd4,0xd6,
+  0x87,0xd5,0xc4,0x5c,0x30,0xdc,0xd5,0xe4,0xe5,0xd1,0xe1,0x32,0x35,0x3e,0xe6,0xdf,
+  0x66,0x26,0x31,0x1a,0x3a,0x1c,0x3c,0xae,0x66,0x17,0x44,0x21,0x29,0xf0,0x71,0x34,
+  0x16,0xda,0x37,0x36,0xa4,0xf8,0x0b,0x18,0x6f,0xdf,0x0b,0x7c,0x04,0x73,0xe4,0x7b,
+  0x91,0x2e,0xa1,0x3e,0x87,0x0c,0x23,0xa2,0x88,0x00,0x00,0x3b
+  };
+
+/* Created by reswrap from file tinyshutterbug.gif */
+const unsigned char tinyshutterbug[]={
+  0x47,0x49,0x46,0x38,0x37,0x61,0x10,0x00,0x10,0x00,0xa5,0x00,0x00,0xff,0xff,0xff,
+  0xbf,0xbf,0xbf,0x7f,0x7f,0x7f,0x8b,0x8b,0x8b,0x97,0x76,0x5e,0x97,0x56,0x26,0x8b,
+  0x4a,0x1a,0x97,0x97,0x97,0xcb,0xcb,0xcb,0x97,0x80,0x57,0xff,0x1f,0x07,0xff,0x00,
+  0x00,0x63,0x24,0x24,0xff,0x3e,0x0e,0xcb,0x4a,0x1a,0x97,0x37,0x1f,0x30,0x30,0x30,
+  0x97,0x18,0x18,0x63,0x63,0x63,0xcb,0x2b,0x13,0x7f,0x00,0x00,0xff,0xff,0x00,0x57,
+  0x18,0x18,0xe4,0x14,0x29,0x97,0x97,0x18,0x7d,0x2c,0x41,0xcb,0x0c,0x0c,0xd7,0x1e,
+  0x3e,0x56,0x2e,0x38,0x8a,0x61,0x6c,0xa3,0x2a,0x4a,0xf1,0x0a,0x14,0xca,0x29,0x53,
+  0x57,0x57,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x00,
+  0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x06,0x8d,0x40,0x80,0x30,0x20,0x10,0x1a,0x89,
+  0xc6,0xa1,0x20,0x00,0x28,0x0e,0x99,0x02,0xe7,0x71,0x40,0x28,0x18,0x0a,0x85,0xc3,
+  0x20,0x29,0x44,0x24,0x0a,0x8a,0xc5,0x82,0xc1,0x68,0x38,0x0e,0x49,0x84,0xe3,0x01,
+  0x89,0x88,0xc9,0x62,0x87,0x24,0xc0,0x24,0x84,0xdd,0xe2,0xfc,0x02,0x02,0x41,0x23,
+  0x26,0x62,0x14,0x82,0x82,0x62,0x11,0x10,0x15,0x10,0x00,0x03,0x83,0x7a,0x0b,0x11,
+  0x11,0x16,0x7c,0x89,0x07,0x17,0x8d,0x7a,0x86,0x18,0x89,0x00,0x19,0x0b,0x1a,0x10,
+  0x1a,0x6f,0x0c,0x9d,0x87,0x12,0x42,0x07,0x1b,0x9e,0xa0,0x63,0xa2,0x0b,0x1c,0x10,
+  0x5b,0x42,0x1d,0x1e,0x1f,0x8d,0x1f,0x17,0x19,0x08,0x00,0x4c,0x5d,0x19,0x1e,0x20,
+  0xbf,0x20,0x19,0x1d,0x5c,0x44,0x45,0x03,0x07,0xc8,0x21,0xba,0x51,0xc4,0x4b,0x49,
+  0xcc,0x5c,0xd1,0xd2,0x00,0x41,0x00,0x3b
+  };
+
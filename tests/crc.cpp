@@ -0,0 +1,100 @@
+/********************************************************************************
+*                                                                               *
+*                            C R C 3 2   T e s t                                *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+********************************************************************************/
+#include "fx.h"
+#include "fxcrc.h"
+
+/*
+  Notes:
+  - Tests for CRC32 and CRC32C: check values, comparison against bytewise
+    calculation for all alignments and lengths, combining, and throughput.
+*/
+
+/*******************************************************************************/
+
+// Bytewise CRC32C, for reference
+static FXuint referenceCRC32C(FXuint crc,const FXuchar* buf,FXival len){
+  while(0<len--){
+    crc^=*buf++;
+    for(FXint k=0; k<8; ++k){ crc=(crc>>1)^(0x82F63B78&(0-(crc&1))); }
+    }
+  return crc;
+  }
+
+
+// Bytewise CRC32, for reference
+static FXuint referenceCRC32(FXuint crc,const FXuchar* buf,FXival len){
+  while(0<len--){
+    crc=CRC32::CRC(crc,*buf++);
+    }
+  return crc;
+  }
+
+
+// Start
+int main(int argc,char* argv[]){
+  const FXuchar check[]={'1','2','3','4','5','6','7','8','9'};
+  const FXival SIZE=1<<24;
+  FXuchar *buffer=new FXuchar[SIZE];
+  FXRandom random(12345);
+  FXuint result,crc32,crc32c;
+  FXint errors=0;
+  FXival i,j;
+  FXTime t;
+
+  // Random data
+  for(i=0; i<SIZE; ++i){ buffer[i]=(FXuchar)random.randLong(); }
+
+  // Standard check values
+  fxmessage("CRC32  check: %08x (cbf43926)\n",CRC32::checksum(check,9));
+  fxmessage("CRC32C check: %08x (e3069283)\n",CRC32C::checksum(check,9));
+  if(CRC32::checksum(check,9)!=0xCBF43926) errors++;
+  if(CRC32C::checksum(check,9)!=0xE3069283) errors++;
+
+  // All alignments and lengths up to 300 bytes
+  for(i=0; i<16; ++i){
+    for(j=0; j<300; ++j){
+      if(CRC32::CRC(~0,buffer+i,j)!=referenceCRC32(~0,buffer+i,j)){ fxmessage("CRC32 mismatch at offset %lld length %lld\n",(FXlong)i,(FXlong)j); errors++; }
+      if(CRC32C::CRC(~0,buffer+i,j)!=referenceCRC32C(~0,buffer+i,j)){ fxmessage("CRC32C mismatch at offset %lld length %lld\n",(FXlong)i,(FXlong)j); errors++; }
+      }
+    }
+
+  // Whole buffer
+  if(CRC32::CRC(~0,buffer,SIZE)!=referenceCRC32(~0,buffer,SIZE)){ fxmessage("CRC32 mismatch on %lld bytes\n",(FXlong)SIZE); errors++; }
+  if(CRC32C::CRC(~0,buffer,SIZE)!=referenceCRC32C(~0,buffer,SIZE)){ fxmessage("CRC32C mismatch on %lld bytes\n",(FXlong)SIZE); errors++; }
+
+  // Incremental and combined checksums
+  for(i=0; i<100; ++i){
+    FXival n=random.randLong()%SIZE;
+    FXuint crc32=CRC32::checksum(buffer,SIZE);
+    FXuint crc32c=CRC32C::checksum(buffer,SIZE);
+    if(CRC32::checksum(buffer+n,SIZE-n,CRC32::checksum(buffer,n))!=crc32){ fxmessage("CRC32 incremental mismatch at %lld\n",(FXlong)n); errors++; }
+    if(CRC32C::checksum(buffer+n,SIZE-n,CRC32C::checksum(buffer,n))!=crc32c){ fxmessage("CRC32C incremental mismatch at %lld\n",(FXlong)n); errors++; }
+    if(CRC32::combine(CRC32::checksum(buffer,n),CRC32::checksum(buffer+n,SIZE-n),SIZE-n)!=crc32){ fxmessage("CRC32 combine mismatch at %lld\n",(FXlong)n); errors++; }
+    if(CRC32C::combine(CRC32C::checksum(buffer,n),CRC32C::checksum(buffer+n,SIZE-n),SIZE-n)!=crc32c){ fxmessage("CRC32C combine mismatch at %lld\n",(FXlong)n); errors++; }
+    }
+
+  // Throughput; results are checked so the work can't be optimized away
+  crc32=referenceCRC32(~0,buffer,SIZE);
+  crc32c=referenceCRC32C(~0,buffer,SIZE);
+  t=FXThread::time();
+  for(i=0; i<16; ++i){ result=CRC32::CRC(~0,buffer,SIZE); if(result!=crc32) errors++; }
+  t=FXThread::time()-t;
+  fxmessage("CRC32:           %.2f GB/s\n",16.0*SIZE/t);
+  t=FXThread::time();
+  for(i=0; i<16; ++i){ result=CRC32C::CRC(~0,buffer,SIZE); if(result!=crc32c) errors++; }
+  t=FXThread::time()-t;
+  fxmessage("CRC32C:          %.2f GB/s\n",16.0*SIZE/t);
+  t=FXThread::time();
+  result=referenceCRC32(~0,buffer,SIZE);
+  t=FXThread::time()-t;
+  fxmessage("CRC32 bytewise:  %.2f GB/s (%08x)\n",1.0*SIZE/t,result);
+
+  fxmessage("%s\n",errors?"FAILED":"OK");
+  delete [] buffer;
+  return errors?1:0;
+  }
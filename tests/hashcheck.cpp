@@ -0,0 +1,244 @@
+/********************************************************************************
+*                                                                               *
+*                         H a s h   T a b l e   C h e c k                       *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+********************************************************************************/
+#include "fx.h"
+
+/*
+  Notes:
+  - Checks the grouped probing of FXHash, FXDictionary, and FXStringDictionary.
+  - Lookups and removals in empty tables must not probe past the shared empty table.
+  - Random inserts and removals are checked against a plain array of flags, which
+    leaves voided slots all over the table; every key must be found, or not found,
+    and the used and free counts must match.
+  - Keys all hashing into the last group of the table overflow into the groups
+    that follow, wrapping around to the start of the table; removing some of them
+    voids their slots, which must not cut off the probe sequence of the others.
+  - Growing and shrinking the tables must keep all keys.
+*/
+
+#define NKEYS 2000
+
+/*******************************************************************************/
+
+// Check condition
+#define CHECK(cond) if(!(cond)){ fxmessage("%s:%d: check failed: %s\n",__FILE__,__LINE__,#cond); errors++; }
+
+
+// Simple pseudo-random number generator
+static FXuint rnd(FXuint& seed){
+  seed=seed*1664525u+1013904223u;
+  return seed>>8;
+  }
+
+
+// Pointer key for number i
+static const void* ptrkey(FXint i){
+  return (const void*)(FXival)(16*i+16);
+  }
+
+
+// String key for number i
+static FXString strkey(FXint i){
+  return FXString::value(i)+"_key";
+  }
+
+
+// Table size must be a power of two
+static FXbool powerof2(FXival n){
+  return 0<n && (n&(n-1))==0;
+  }
+
+
+// Check empty tables
+static FXint checkEmpty(){
+  FXint errors=0;
+  const FXHash hash;
+  const FXDictionary dict;
+  const FXStringDictionary sdict;
+  CHECK(hash.no()==1 && hash.used()==0);
+  CHECK(hash.find(ptrkey(1))<0);
+  CHECK(hash.at(ptrkey(1))==nullptr);
+  CHECK(dict.no()==1 && dict.used()==0);
+  CHECK(dict.find("key")<0);
+  CHECK(dict.at("key")==nullptr);
+  CHECK(sdict.no()==1 && sdict.used()==0);
+  CHECK(sdict.find("key")<0);
+  CHECK(sdict.at("key").empty());
+  FXHash h;
+  FXDictionary d;
+  FXStringDictionary s;
+  CHECK(h.remove(ptrkey(1))==nullptr);
+  CHECK(d.remove("key")==nullptr);
+  CHECK(!s.remove("key"));
+  return errors;
+  }
+
+
+// Random inserts and removals against reference flags
+static FXint checkRandom(){
+  FXbool present[NKEYS];
+  FXHash hash;
+  FXDictionary dict;
+  FXStringDictionary sdict;
+  FXuint seed=1;
+  FXint errors=0;
+  FXint count=0;
+  FXint i,k;
+  for(i=0; i<NKEYS; ++i) present[i]=false;
+  for(i=0; i<20*NKEYS; ++i){
+    k=rnd(seed)%NKEYS;
+    if(present[k]){
+      CHECK(hash.remove(ptrkey(k))==ptrkey(k));
+      CHECK(dict.remove(strkey(k))==ptrkey(k));
+      CHECK(sdict.remove(strkey(k)));
+      present[k]=false;
+      count--;
+      }
+    else{
+      CHECK(hash.insert(ptrkey(k),(void*)ptrkey(k))==nullptr);
+      CHECK(dict.insert(strkey(k),(void*)ptrkey(k))==nullptr);
+      CHECK(sdict.insert(strkey(k),strkey(k)));
+      present[k]=true;
+      count++;
+      }
+    }
+  CHECK(hash.used()==count && dict.used()==count && sdict.used()==count);
+  CHECK(powerof2(hash.no()) && powerof2(dict.no()) && powerof2(sdict.no()));
+  CHECK(0<hash.free() && 0<dict.free() && 0<sdict.free());
+  for(k=0; k<NKEYS; ++k){
+    if(present[k]){
+      CHECK(hash.at(ptrkey(k))==ptrkey(k));
+      CHECK(dict.at(strkey(k))==ptrkey(k));
+      CHECK(sdict.at(strkey(k))==strkey(k));
+      }
+    else{
+      CHECK(hash.find(ptrkey(k))<0);
+      CHECK(dict.find(strkey(k))<0);
+      CHECK(sdict.find(strkey(k))<0);
+      }
+    }
+  count=0;
+  for(i=0; i<hash.no(); ++i){ if(!hash.empty(i)) count++; }
+  CHECK(count==hash.used());
+  return errors;
+  }
+
+
+// Keys all hashing into the last group wrap around the table
+static FXint checkWrap(){
+  FXString keys[40];
+  FXDictionary dict;
+  FXStringDictionary sdict;
+  FXint errors=0;
+  FXint wrapped=0;
+  FXint n=0;
+  FXint i;
+  FXival fr;
+
+  // Table of 64 slots, in 4 groups, holds 40 keys without growing
+  for(i=0; n<40; ++i){
+    if(48<=(FXString::hash(strkey(i).text())&63)) keys[n++]=strkey(i);
+    }
+  for(i=0; i<40; ++i){
+    dict.insert(keys[i],(void*)ptrkey(i));
+    sdict.insert(keys[i],keys[i]);
+    }
+  CHECK(dict.no()==64 && dict.used()==40);
+  CHECK(sdict.no()==64 && sdict.used()==40);
+  for(i=0; i<40; ++i){
+    CHECK(dict.at(keys[i])==ptrkey(i));
+    CHECK(sdict.at(keys[i])==keys[i]);
+    if(dict.find(keys[i])<48) wrapped++;
+    }
+  CHECK(wrapped==24);
+
+  // Slots removed from the full last group are voided, not freed
+  fr=dict.free();
+  for(i=0; i<40; i+=5){
+    dict.remove(keys[i]);
+    sdict.remove(keys[i]);
+    }
+  CHECK(dict.used()==32 && sdict.used()==32);
+  for(i=0; i<40; ++i){
+    if(i%5){
+      CHECK(dict.at(keys[i])==ptrkey(i));
+      CHECK(sdict.at(keys[i])==keys[i]);
+      }
+    else{
+      CHECK(dict.find(keys[i])<0);
+      CHECK(sdict.find(keys[i])<0);
+      }
+    }
+
+  // Put them back; voided slots are reused first
+  for(i=0; i<40; i+=5){
+    dict.insert(keys[i],(void*)ptrkey(i));
+    sdict.insert(keys[i],keys[i]);
+    }
+  CHECK(dict.no()==64 && dict.used()==40 && dict.free()<=fr);
+  for(i=0; i<40; ++i){
+    CHECK(dict.at(keys[i])==ptrkey(i));
+    CHECK(sdict.at(keys[i])==keys[i]);
+    }
+  return errors;
+  }
+
+
+// Grow and shrink
+static FXint checkResize(){
+  FXHash hash;
+  FXDictionary dict;
+  FXStringDictionary sdict;
+  FXint errors=0;
+  FXint i,k;
+  for(i=0; i<NKEYS; ++i){
+    hash.insert(ptrkey(i),(void*)ptrkey(i));
+    dict.insert(strkey(i),(void*)ptrkey(i));
+    sdict.insert(strkey(i),strkey(i));
+    }
+  CHECK(hash.used()==NKEYS && dict.used()==NKEYS && sdict.used()==NKEYS);
+  CHECK(NKEYS<hash.no() && NKEYS<dict.no() && NKEYS<sdict.no());
+  for(i=0; i<NKEYS-10; ++i){
+    hash.remove(ptrkey(i));
+    dict.remove(strkey(i));
+    sdict.remove(strkey(i));
+    }
+  CHECK(hash.used()==10 && dict.used()==10 && sdict.used()==10);
+  CHECK(hash.no()<=64 && dict.no()<=64 && sdict.no()<=64);
+  for(k=0; k<NKEYS; ++k){
+    if(NKEYS-10<=k){
+      CHECK(hash.at(ptrkey(k))==ptrkey(k));
+      CHECK(dict.at(strkey(k))==ptrkey(k));
+      CHECK(sdict.at(strkey(k))==strkey(k));
+      }
+    else{
+      CHECK(hash.find(ptrkey(k))<0);
+      CHECK(dict.find(strkey(k))<0);
+      CHECK(sdict.find(strkey(k))<0);
+      }
+    }
+  for(k=NKEYS-10; k<NKEYS; ++k){
+    hash.remove(ptrkey(k));
+    dict.remove(strkey(k));
+    sdict.remove(strkey(k));
+    }
+  CHECK(hash.no()==1 && dict.no()==1 && sdict.no()==1);
+  CHECK(hash.find(ptrkey(0))<0 && dict.find(strkey(0))<0 && sdict.find(strkey(0))<0);
+  return errors;
+  }
+
+
+// Start
+int main(int,char**){
+  FXint errors=0;
+  errors+=checkEmpty();
+  errors+=checkRandom();
+  errors+=checkWrap();
+  errors+=checkResize();
+  fxmessage("%s\n",errors?"FAILED":"OK");
+  return errors?1:0;
+  }
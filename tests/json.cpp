@@ -0,0 +1,177 @@
+/********************************************************************************
+*                                                                               *
+*                              J S O N   T e s t                                *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+********************************************************************************/
+#include "fx.h"
+
+
+/*******************************************************************************/
+
+// Print options
+void printusage(const char* prog){
+  fxmessage("%s options:\n",prog);
+  fxmessage("  --load <file>            Load json file.\n");
+  fxmessage("  --save <file>            Save loaded json to file.\n");
+  fxmessage("  --pull <file>            Pull events from json file, and print them.\n");
+  fxmessage("  --key <key>              Only print values of keys <key> while pulling.\n");
+  fxmessage("  --tracelevel <level>     Set trace level.\n");
+  fxmessage("  -h, --help               Print help.\n");
+  }
+
+
+// Event names
+const FXchar *const events[]={
+  "end",
+  "null",
+  "bool",
+  "int",
+  "real",
+  "string",
+  "key",
+  "beginArray",
+  "endArray",
+  "beginMap",
+  "endMap"
+  };
+
+/*******************************************************************************/
+
+// Print all events
+FXJSON::Error pullAll(FXJSON& json){
+  FXJSON::Event event;
+  FXJSON::Error err;
+  FXint depth;
+  while((err=json.pull(event))==FXJSON::ErrOK && event!=FXJSON::EventEnd){
+    depth=json.getDepth();
+    if(event==FXJSON::EventBeginArray || event==FXJSON::EventBeginMap) depth--;
+    fxmessage("%*s%s",depth*2,"",events[event]);
+    switch(event){
+      case FXJSON::EventBool:
+        fxmessage("(%s)",json.getBool()?"true":"false");
+        break;
+      case FXJSON::EventInt:
+        fxmessage("(%lld)",json.getLong());
+        break;
+      case FXJSON::EventReal:
+        fxmessage("(%.17g)",json.getDouble());
+        break;
+      case FXJSON::EventString:
+      case FXJSON::EventKey:
+        fxmessage("(%s)",json.getString().text());
+        break;
+      default:
+        break;
+      }
+    fxmessage("\n");
+    }
+  return err;
+  }
+
+
+// Print only the values of the given key, wherever it occurs; other
+// values are skipped without loading them
+FXJSON::Error pullKey(FXJSON& json,const FXchar* key){
+  FXJSON::Event event;
+  FXJSON::Error err;
+  FXVariant var;
+  FXint len=strlen(key);
+  while((err=json.pull(event))==FXJSON::ErrOK && event!=FXJSON::EventEnd){
+    if(event==FXJSON::EventKey && json.getTextLength()==len && strncmp(json.getText(),key,len)==0){
+      if((err=json.load(var))!=FXJSON::ErrOK) break;
+      fxmessage("%s\n",var.toString().text());
+      }
+    }
+  return err;
+  }
+
+/*******************************************************************************/
+
+// Test JSON I/O
+int main(int argc,char *argv[]){
+  const FXchar* loadfile=nullptr;
+  const FXchar* savefile=nullptr;
+  const FXchar* pullfile=nullptr;
+  const FXchar* key=nullptr;
+
+  // Grab a few arguments
+  for(FXint arg=1; arg<argc; ++arg){
+    if(strcmp(argv[arg],"-h")==0 || strcmp(argv[arg],"--help")==0){
+      printusage(argv[0]);
+      exit(0);
+      }
+    else if(strcmp(argv[arg],"--load")==0){
+      if(++arg>=argc){ fxmessage("Missing load filename argument.\n"); exit(1); }
+      loadfile=argv[arg];
+      }
+    else if(strcmp(argv[arg],"--save")==0){
+      if(++arg>=argc){ fxmessage("Missing save filename argument.\n"); exit(1); }
+      savefile=argv[arg];
+      }
+    else if(strcmp(argv[arg],"--pull")==0){
+      if(++arg>=argc){ fxmessage("Missing pull filename argument.\n"); exit(1); }
+      pullfile=argv[arg];
+      }
+    else if(strcmp(argv[arg],"--key")==0){
+      if(++arg>=argc){ fxmessage("Missing key argument.\n"); exit(1); }
+      key=argv[arg];
+      }
+    else if(strcmp(argv[arg],"--tracelevel")==0){
+      if(++arg>=argc){ fxmessage("Missing tracelevel number argument.\n"); exit(1); }
+      setTraceLevel(strtoul(argv[arg],nullptr,0));
+      }
+    else{
+      fxmessage("Bad argument.\n");
+      printusage(argv[0]);
+      exit(1);
+      }
+    }
+
+  // Load, and optionally save, whole document
+  if(loadfile){
+    FXVariant var;
+    FXJSONFile json;
+    if(!json.open(loadfile,FXJSON::Load)){
+      fxwarning("Unable to open %s.\n",loadfile);
+      return 1;
+      }
+    FXJSON::Error err=json.load(var);
+    json.close();
+    if(err!=FXJSON::ErrOK){
+      fxmessage("Error: %s:%d:%d: %s\n",loadfile,json.getLine(),json.getColumn(),FXJSON::getError(err));
+      return 1;
+      }
+    fxmessage("Loaded: %s\n",loadfile);
+    if(savefile){
+      if(!json.open(savefile,FXJSON::Save)){
+        fxwarning("Unable to open %s.\n",savefile);
+        return 1;
+        }
+      err=json.save(var);
+      json.close();
+      if(err!=FXJSON::ErrOK){
+        fxmessage("Error: %s: %s\n",savefile,FXJSON::getError(err));
+        return 1;
+        }
+      fxmessage("Saved: %s\n",savefile);
+      }
+    }
+
+  // Pull document piece by piece
+  if(pullfile){
+    FXJSONFile json;
+    if(!json.open(pullfile,FXJSON::Load)){
+      fxwarning("Unable to open %s.\n",pullfile);
+      return 1;
+      }
+    FXJSON::Error err=key?pullKey(json,key):pullAll(json);
+    json.close();
+    if(err!=FXJSON::ErrOK){
+      fxmessage("Error: %s:%d:%d: %s\n",pullfile,json.getLine(),json.getColumn(),FXJSON::getError(err));
+      return 1;
+      }
+    }
+  return 0;
+  }
@@ -0,0 +1,153 @@
+/********************************************************************************
+*                                                                               *
+*                          R e g i s t r y   T e s t                            *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+********************************************************************************/
+#include "fx.h"
+
+/*
+  Notes:
+  - Tests for FXRegistry snapshot: read, write, and read again, in a scratch
+    settings tree; check that reading leaves the registry unmodified, that the
+    snapshot is reused when the settings files are unchanged, that it is
+    updated when write() changes the application settings file, and that a
+    deleted application entry lets the system-wide one through again.
+*/
+
+/*******************************************************************************/
+
+// Check condition
+#define CHECK(cond) if(!(cond)){ fxmessage("%s:%d: check failed: %s\n",__FILE__,__LINE__,#cond); errors++; }
+
+
+// Return true if file is unchanged since stamped
+static FXbool unchanged(const FXString& file,FXStat& stamp){
+  FXStat info;
+  FXbool same=FXStat::statFile(file,info) && info.size()==stamp.size() && info.modified()==stamp.modified();
+  stamp=info;
+  return same;
+  }
+
+
+// Write text to file
+static FXbool writeFile(const FXString& file,const FXchar* text){
+  FXFile f(file,FXIO::Writing);
+  return f.isOpen() && f.writeBlock(text,strlen(text))==(FXival)strlen(text);
+  }
+
+
+// Start
+int main(int argc,char* argv[]){
+  FXString base=FXSystem::getTempDirectory()+PATHSEPSTRING "registry"+FXString::value(FXProcess::current());
+  FXString sysdir=base+PATHSEPSTRING "system";
+  FXString userdir=base+PATHSEPSTRING "user";
+  FXString appfile=userdir+PATHSEPSTRING "Vendor" PATHSEPSTRING "App"+FXRegistry::ext;
+  FXString cache=userdir+PATHSEPSTRING "Vendor" PATHSEPSTRING "App"+FXRegistry::snapshotext;
+  FXStat appstamp,cachestamp;
+  FXint errors=0;
+
+  // Scratch settings tree with system-wide common settings and per-user application settings
+  if(!FXDir::createDirectories(sysdir) || !FXDir::createDirectories(userdir+PATHSEPSTRING "Vendor")){
+    fxwarning("registry: unable to create %s.\n",base.text());
+    return 1;
+    }
+  writeFile(sysdir+PATHSEPSTRING+FXRegistry::foxrc,"[SETTINGS]\ncommon=system\ngone=system\n");
+  writeFile(appfile,"[SETTINGS]\nvalue=one\n");
+
+  // First read parses the files and makes a snapshot; nothing to write back
+  {
+    FXRegistry reg("App","Vendor");
+    reg.setSystemDirectories(sysdir);
+    reg.setUserDirectory(userdir);
+    unchanged(appfile,appstamp);
+    CHECK(reg.read());
+    CHECK(!reg.isModified());
+    CHECK(FXStat::exists(cache));
+    unchanged(cache,cachestamp);
+    CHECK(FXString(reg.readStringEntry("SETTINGS","common",""))=="system");
+    CHECK(FXString(reg.readStringEntry("SETTINGS","value",""))=="one");
+    CHECK(!reg.write());
+    CHECK(unchanged(appfile,appstamp));
+  }
+
+  // Second read loads the snapshot; change and delete entries, and write back
+  {
+    FXRegistry reg("App","Vendor");
+    reg.setSystemDirectories(sysdir);
+    reg.setUserDirectory(userdir);
+    CHECK(reg.read());
+    CHECK(!reg.isModified());
+    CHECK(unchanged(cache,cachestamp));
+    CHECK(FXString(reg.readStringEntry("SETTINGS","gone",""))=="system");
+    CHECK(FXString(reg.readStringEntry("SETTINGS","value",""))=="one");
+    reg.writeStringEntry("SETTINGS","value","two");
+    reg.writeStringEntry("SETTINGS","common","user");
+    reg.deleteEntry("SETTINGS","gone");
+    CHECK(reg.write());
+    CHECK(!unchanged(appfile,appstamp));
+    CHECK(!unchanged(cache,cachestamp));
+  }
+
+  // Third read loads the updated snapshot, which matches the files; delete the
+  // application entry overriding the system-wide one, and write back
+  {
+    FXRegistry reg("App","Vendor");
+    reg.setSystemDirectories(sysdir);
+    reg.setUserDirectory(userdir);
+    CHECK(reg.read());
+    CHECK(!reg.isModified());
+    CHECK(unchanged(cache,cachestamp));
+    CHECK(FXString(reg.readStringEntry("SETTINGS","value",""))=="two");
+    CHECK(FXString(reg.readStringEntry("SETTINGS","gone",""))=="system");
+    CHECK(FXString(reg.readStringEntry("SETTINGS","common",""))=="user");
+    reg.deleteEntry("SETTINGS","common");
+    CHECK(reg.write());
+    CHECK(!unchanged(cache,cachestamp));
+  }
+
+  // Fourth read loads the updated snapshot, with the system-wide entry back;
+  // then change the system-wide file, so the snapshot can't be updated
+  {
+    FXRegistry reg("App","Vendor");
+    reg.setSystemDirectories(sysdir);
+    reg.setUserDirectory(userdir);
+    CHECK(reg.read());
+    CHECK(unchanged(cache,cachestamp));
+    CHECK(FXString(reg.readStringEntry("SETTINGS","common",""))=="system");
+    writeFile(sysdir+PATHSEPSTRING+FXRegistry::foxrc,"[SETTINGS]\ncommon=system\ngone=changed\n");
+    reg.writeStringEntry("SETTINGS","value","three");
+    CHECK(reg.write());
+    CHECK(unchanged(cache,cachestamp));
+  }
+
+  // Parsing the files gives the same settings
+  {
+    FXRegistry reg("App","Vendor");
+    reg.setSystemDirectories(sysdir);
+    reg.setUserDirectory(userdir);
+    reg.setSnapshotMode(false);
+    CHECK(reg.read());
+    CHECK(FXString(reg.readStringEntry("SETTINGS","value",""))=="three");
+    CHECK(FXString(reg.readStringEntry("SETTINGS","gone",""))=="changed");
+    CHECK(FXString(reg.readStringEntry("SETTINGS","common",""))=="system");
+    CHECK(unchanged(cache,cachestamp));
+  }
+
+  // Stale snapshot is rejected, and replaced
+  {
+    FXRegistry reg("App","Vendor");
+    reg.setSystemDirectories(sysdir);
+    reg.setUserDirectory(userdir);
+    CHECK(reg.read());
+    CHECK(!unchanged(cache,cachestamp));
+    CHECK(FXString(reg.readStringEntry("SETTINGS","value",""))=="three");
+    CHECK(FXString(reg.readStringEntry("SETTINGS","gone",""))=="changed");
+  }
+
+  FXFile::removeFiles(base,true);
+
+  fxmessage("%s\n",errors?"FAILED":"OK");
+  return errors?1:0;
+  }
@@ -0,0 +1,334 @@
+/********************************************************************************
+*                                                                               *
+*                             Regular Expression Benchmark                      *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+********************************************************************************/
+#include "fx.h"
+
+
+/*
+  Notes:
+  - Throughput of FXRex, FXString::find() and contains(), FXPath::match(), and
+    FXText::findText(), over fixed corpora.
+  - The corpora are generated from a fixed seed, so the numbers may be compared
+    across versions of the library: a log file, C++ source code, and UTF-8 text.
+  - Each pattern of the matrix is searched in each corpus by each engine path
+    which can handle it; every match is counted, non-overlapping, from the start
+    of the corpus to its end.  The best time of a number of runs is reported, as
+    megabytes per second, and matches per second.
+  - FXRex engine paths are: "rex", the default; "backtrack", with the Backtrack flag;
+    "pieces", matching incrementally through FXRexInput in pieces of 64KB; "set",
+    as the only pattern of an FXRexSet.  FXText::findText() is path "text".
+  - FXRex has no Unicode mode; the "utf8-word" pattern matches words made of letters
+    and multi-byte UTF-8 characters byte by byte.
+  - A pattern which fails to parse aborts the benchmark.
+*/
+
+/*******************************************************************************/
+
+// Pattern in the matrix
+struct Pattern {
+  const FXchar *name;           // What it exercises
+  const FXchar *rex;            // Regular expression
+  FXint         mode;           // Parse mode
+  const FXchar *literal;        // Same as a literal, if possible
+  const FXchar *glob;           // Same as a line-matching wildcard, if possible
+  };
+
+
+// Pattern matrix
+static const Pattern patterns[]={
+  {"literal",      "timeout",                                   FXRex::Normal,     "timeout",  "*timeout*"},
+  {"literal-none", "deadlock",                                  FXRex::Normal,     "deadlock", "*deadlock*"},
+  {"literal-utf8", "Größe",                                     FXRex::Normal,     "Größe",    "*Größe*"},
+  {"class",        "[0-9]+ ms",                                 FXRex::Normal,     nullptr,    "*[0-9] ms*"},
+  {"ip-address",   "\\d{1,3}\\.\\d{1,3}\\.\\d{1,3}\\.\\d{1,3}", FXRex::Normal,     nullptr,    nullptr},
+  {"alternation",  "ERROR|FATAL|PANIC",                         FXRex::Normal,     nullptr,    "*(ERROR|FATAL|PANIC)*"},
+  {"anchored",     "^\\d{4}-\\d\\d-\\d\\d",                     FXRex::Normal,     nullptr,    "[0-9][0-9][0-9][0-9]-[0-9][0-9]-[0-9][0-9]*"},
+  {"ignore-case",  "TIMEOUT",                                   FXRex::IgnoreCase, nullptr,    "*TIMEOUT*"},
+  {"identifier",   "\\b[a-z_]\\w*\\s*=",                        FXRex::Normal,     nullptr,    nullptr},
+  {"words",        "count",                                     FXRex::Words,      nullptr,    nullptr},
+  {"string",       "\"(\\\\.|[^\"\\\\])*\"",                    FXRex::Normal,     nullptr,    nullptr},
+  {"utf8-word",    "(?:\\l|[\\xC0-\\xF4][\\x80-\\xBF]+)+",      FXRex::Normal,     nullptr,    nullptr},
+  };
+
+
+// Corpus
+struct Corpus {
+  const FXchar *name;
+  FXString      text;
+  };
+
+
+// Pick one of n things
+static FXint pick(FXRandom& random,FXint n){
+  return (FXint)(random.randLong()%n);
+  }
+
+
+// Generate log file
+static void makelog(FXString& text,FXint size,FXRandom& random){
+  static const FXchar *const levels[]={"INFO ","INFO ","INFO ","DEBUG","DEBUG","WARN ","ERROR","FATAL"};
+  static const FXchar *const events[]={"request %d from %d.%d.%d.%d took %d ms","connection %d closed","timeout after %d ms waiting for worker %d","cache miss for key %d","retrying job %d, count=%d"};
+  FXString line;
+  while(text.length()<size){
+    FXint e=pick(random,ARRAYNUMBER(events));
+    line.format("2024-%02d-%02d %02d:%02d:%02d.%03d [%s] worker-%d: ",1+pick(random,12),1+pick(random,28),pick(random,24),pick(random,60),pick(random,60),pick(random,1000),levels[pick(random,ARRAYNUMBER(levels))],pick(random,32));
+    text.append(line);
+    line.format(events[e],pick(random,100000),pick(random,256),pick(random,256),pick(random,256),pick(random,256),pick(random,5000));
+    text.append(line);
+    text.append('\n');
+    }
+  }
+
+
+// Generate source code
+static void makesource(FXString& text,FXint size,FXRandom& random){
+  static const FXchar *const types[]={"FXint","FXuint","FXdouble","FXString","FXbool","const FXchar*"};
+  static const FXchar *const names[]={"count","index","result","buffer_size","timeout","pos","name","flags","length","item_count"};
+  static const FXchar *const calls[]={"compute","lookup","append","find","insert","remove","update","getText"};
+  FXString line;
+  while(text.length()<size){
+    switch(pick(random,6)){
+      case 0: line.format("  %s %s=%d;\n",types[pick(random,ARRAYNUMBER(types))],names[pick(random,ARRAYNUMBER(names))],pick(random,1000)); break;
+      case 1: line.format("  %s=%s(%s,%s);\n",names[pick(random,ARRAYNUMBER(names))],calls[pick(random,ARRAYNUMBER(calls))],names[pick(random,ARRAYNUMBER(names))],names[pick(random,ARRAYNUMBER(names))]); break;
+      case 2: line.format("  if(%s<%s){ fxwarning(\"%s: bad \\\"%s\\\" value.\\n\"); }\n",names[pick(random,ARRAYNUMBER(names))],names[pick(random,ARRAYNUMBER(names))],calls[pick(random,ARRAYNUMBER(calls))],names[pick(random,ARRAYNUMBER(names))]); break;
+      case 3: line.format("  // %s the %s, unless %s is zero\n",calls[pick(random,ARRAYNUMBER(calls))],names[pick(random,ARRAYNUMBER(names))],names[pick(random,ARRAYNUMBER(names))]); break;
+      case 4: line.format("  for(%s=0; %s<%d; ++%s){\n",names[1],names[1],pick(random,100),names[1]); break;
+      case 5: line.format("    }\n"); break;
+      }
+    text.append(line);
+    }
+  }
+
+
+// Generate UTF-8 text
+static void makeutf8(FXString& text,FXint size,FXRandom& random){
+  static const FXchar *const words[]={"Größe","Straße","café","naïve","Ærø","Ωmega","δέλτα","Привет","日本語","テキスト","한국어","emoji😀","timeout","plain","text","über","façade"};
+  while(text.length()<size){
+    text.append(words[pick(random,ARRAYNUMBER(words))]);
+    text.append(pick(random,12)?' ':'\n');
+    }
+  }
+
+
+// Delivers a string to FXRex in pieces
+class Pieces : public FXRexInput {
+  const FXString& string;
+  FXint           size;
+public:
+  Pieces(const FXString& str,FXint sz):string(str),size(sz){ }
+  virtual const FXchar* fetch(FXint pos,FXint& beg,FXint& end){
+    if(pos<0 || string.length()<=pos) return nullptr;
+    beg=pos-pos%size;
+    end=FXMIN(beg+size,string.length());
+    return string.text()+beg;
+    }
+  };
+
+
+// Next position after match
+static inline FXint after(FXint b,FXint e){
+  return (b<e)?e:e+1;
+  }
+
+
+// Count matches of FXRex
+static FXint countrex(const FXRex& rex,const FXString& text,FXint mode){
+  FXint pos=0,count=0,b,e;
+  while(pos<=text.length() && 0<=rex.search(text,pos,text.length(),mode,&b,&e,1)){
+    pos=after(b,e);
+    count++;
+    }
+  return count;
+  }
+
+
+// Count matches of FXRex, delivering text in pieces
+static FXint countpieces(const FXRex& rex,const FXString& text){
+  Pieces input(text,65536);
+  FXint pos=0,count=0,b,e;
+  while(pos<=text.length() && 0<=rex.search(input,pos,text.length(),FXRex::Normal,&b,&e,1)){
+    pos=after(b,e);
+    count++;
+    }
+  return count;
+  }
+
+
+// Count matches of FXRexSet
+static FXint countset(const FXRexSet& set,const FXString& text){
+  FXint pos=0,count=0,b,e;
+  while(pos<=text.length() && 0<=set.search(text,pos,text.length(),FXRex::Normal,&b,&e)){
+    pos=after(b,e);
+    count++;
+    }
+  return count;
+  }
+
+
+// Count occurrences using FXString::find()
+static FXint countfind(const FXString& text,const FXchar* literal){
+  FXint len=strlen(literal),pos=0,count=0;
+  while(0<=(pos=text.find(literal,len,pos))){
+    pos+=len;
+    count++;
+    }
+  return count;
+  }
+
+
+// Count lines matching wildcard pattern
+static FXint countglob(const FXString& text,const FXchar* glob,FXuint flags){
+  FXint pos=0,nxt,count=0;
+  FXString line;
+  while(pos<text.length()){
+    if((nxt=text.find('\n',pos))<0) nxt=text.length();
+    line.assign(&text[pos],nxt-pos);
+    if(FXPath::match(line,glob,flags)) count++;
+    pos=nxt+1;
+    }
+  return count;
+  }
+
+
+// Count matches using FXText::findText()
+static FXint counttext(FXText* editor,const FXchar* pattern,FXint mode){
+  FXuint flags=SEARCH_FORWARD|SEARCH_REGEX;
+  FXint pos=0,count=0,b,e;
+  if(mode&FXRex::IgnoreCase) flags|=SEARCH_IGNORECASE;
+  if(mode&FXRex::Words) flags|=SEARCH_WORDS;
+  while(pos<=editor->getLength() && editor->findText(pattern,&b,&e,pos,flags,1)){
+    pos=after(b,e);
+    count++;
+    }
+  return count;
+  }
+
+
+// Report result
+static void report(const FXchar* engine,const Corpus& corpus,const Pattern& pattern,FXint count,FXTime best){
+  FXdouble seconds=best*1.0E-9;
+  fxmessage("%-10s %-7s %-13s %8d %10.1f %14.0f\n",engine,corpus.name,pattern.name,count,corpus.text.length()/(seconds*1048576.0),count/seconds);
+  }
+
+
+// Print command line help
+static void printusage(){
+  fxmessage("Usage: rexbench [options]\n");
+  fxmessage("  options:\n");
+  fxmessage("  -?, -h, --help                      Print help.\n");
+  fxmessage("  -s <MB>, --size <MB>                Size of each corpus [4].\n");
+  fxmessage("  -r <num>, --runs <num>              Number of runs, best is reported [3].\n");
+  fxmessage("  -e <name>, --engine <name>          Only run engine path name.\n");
+  fxmessage("  -c <name>, --corpus <name>          Only search corpus name.\n");
+  fxmessage("  -p <name>, --pattern <name>         Only search for pattern name.\n");
+  }
+
+
+// Start
+int main(int argc,char** argv){
+  const FXchar *engines[]={"rex","backtrack","pieces","set","find","contains","glob","text"};
+  const FXchar *onlyengine=nullptr;
+  const FXchar *onlycorpus=nullptr;
+  const FXchar *onlypattern=nullptr;
+  FXint size=4,runs=3,count,c,p,e,r;
+  FXTime start,time,best;
+  Corpus corpora[3];
+  FXRex::Error err;
+  FXRandom random(1);
+
+  // Parse options
+  for(FXint arg=1; arg<argc; ++arg){
+    if(FXString::compare(argv[arg],"-s")==0 || FXString::compare(argv[arg],"--size")==0){
+      if(++arg>=argc){ fxwarning("rexbench: missing corpus size.\n"); return 1; }
+      sscanf(argv[arg],"%d",&size);
+      }
+    else if(FXString::compare(argv[arg],"-r")==0 || FXString::compare(argv[arg],"--runs")==0){
+      if(++arg>=argc){ fxwarning("rexbench: missing number of runs.\n"); return 1; }
+      sscanf(argv[arg],"%d",&runs);
+      }
+    else if(FXString::compare(argv[arg],"-e")==0 || FXString::compare(argv[arg],"--engine")==0){
+      if(++arg>=argc){ fxwarning("rexbench: missing engine name.\n"); return 1; }
+      onlyengine=argv[arg];
+      }
+    else if(FXString::compare(argv[arg],"-c")==0 || FXString::compare(argv[arg],"--corpus")==0){
+      if(++arg>=argc){ fxwarning("rexbench: missing corpus name.\n"); return 1; }
+      onlycorpus=argv[arg];
+      }
+    else if(FXString::compare(argv[arg],"-p")==0 || FXString::compare(argv[arg],"--pattern")==0){
+      if(++arg>=argc){ fxwarning("rexbench: missing pattern name.\n"); return 1; }
+      onlypattern=argv[arg];
+      }
+    else if(FXString::compare(argv[arg],"-?")==0 || FXString::compare(argv[arg],"-h")==0 || FXString::compare(argv[arg],"--help")==0){
+      printusage();
+      return 0;
+      }
+    else{
+      fxwarning("rexbench: unknown option %s.\n",argv[arg]);
+      return 1;
+      }
+    }
+
+  // Application, so FXText can be made; it is never shown
+  FXApp application("RexBench","FoxTest");
+  FXMainWindow* window=new FXMainWindow(&application,"RexBench");
+  FXText* editor=new FXText(window);
+
+  // Generate corpora
+  corpora[0].name="log";
+  corpora[1].name="source";
+  corpora[2].name="utf8";
+  makelog(corpora[0].text,size<<20,random);
+  makesource(corpora[1].text,size<<20,random);
+  makeutf8(corpora[2].text,size<<20,random);
+
+  fxmessage("%-10s %-7s %-13s %8s %10s %14s\n","engine","corpus","pattern","matches","MB/s","matches/s");
+
+  // Run matrix
+  for(c=0; c<(FXint)ARRAYNUMBER(corpora); ++c){
+    if(onlycorpus && FXString::compare(onlycorpus,corpora[c].name)!=0) continue;
+
+    // Text widget with the gap in the middle of the corpus
+    editor->setText(corpora[c].text);
+    editor->insertText(corpora[c].text.length()/2,"x",1);
+    editor->removeText(corpora[c].text.length()/2,1);
+
+    for(p=0; p<(FXint)ARRAYNUMBER(patterns); ++p){
+      if(onlypattern && FXString::compare(onlypattern,patterns[p].name)!=0) continue;
+      FXRex rex(patterns[p].rex,patterns[p].mode,&err);
+      FXRexSet set;
+      set.append(patterns[p].rex,patterns[p].mode);
+      if(err!=FXRex::ErrOK){
+        fxwarning("rexbench: pattern %s: %s.\n",patterns[p].name,FXRex::getError(err));
+        return 1;
+        }
+      for(e=0; e<(FXint)ARRAYNUMBER(engines); ++e){
+        if(onlyengine && FXString::compare(onlyengine,engines[e])!=0) continue;
+        if((e==4 || e==5) && !patterns[p].literal) continue;
+        if(e==6 && !patterns[p].glob) continue;
+        best=forever;
+        count=0;
+        for(r=0; r<runs; ++r){
+          start=FXThread::time();
+          switch(e){
+            case 0: count=countrex(rex,corpora[c].text,FXRex::Normal); break;
+            case 1: count=countrex(rex,corpora[c].text,FXRex::Backtrack); break;
+            case 2: count=countpieces(rex,corpora[c].text); break;
+            case 3: count=countset(set,corpora[c].text); break;
+            case 4: count=countfind(corpora[c].text,patterns[p].literal); break;
+            case 5: count=corpora[c].text.contains(patterns[p].literal); break;
+            case 6: count=countglob(corpora[c].text,patterns[p].glob,(patterns[p].mode&FXRex::IgnoreCase)?FXPath::NoEscape|FXPath::CaseFold:FXPath::NoEscape); break;
+            case 7: count=counttext(editor,patterns[p].rex,patterns[p].mode); break;
+            }
+          time=FXThread::time()-start;
+          if(time<best) best=time;
+          }
+        report(engines[e],corpora[c],patterns[p],count,best);
+        }
+      }
+    }
+  return 0;
+  }
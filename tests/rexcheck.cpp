@@ -0,0 +1,376 @@
+/********************************************************************************
+*                                                                               *
+*                     R e g u l a r   E x p r e s s i o n   C h e c k           *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+********************************************************************************/
+#include "fx.h"
+
+/*
+  Notes:
+  - Checks FXRex matchers against each other, over a matrix of patterns and subjects,
+    including subjects with non-ASCII bytes.
+  - The lock-step simulation is always used when the subject is delivered in pieces
+    by an FXRexInput, so comparing that with the Backtrack mode checks the simulation
+    against the backtracking matcher.
+  - Searches, which skip ahead using the first bytes and literals of the pattern,
+    are checked against trying an anchored match at every position in turn.
+  - FXRexSet searches are checked against searching for each pattern with FXRex.
+  - FXRexCache is checked for hits, misses, and dropping the least recently used
+    pattern when full.
+*/
+
+#define NCAP 10
+
+/*******************************************************************************/
+
+// Patterns to check
+static const FXchar *const patterns[]={
+  "abc",
+  "a|b|c",
+  "a[bc]+d",
+  "(foo|bar)baz",
+  "(a|ab)(c|bcd)(d*)",
+  "(a+)(b+)?",
+  "(a|aa)*b",
+  "(x+x+)+y",
+  "(a|b)*abb",
+  "a*?b",
+  "(a+?)(a*)",
+  "a{2,4}",
+  "(ab){1,3}c",
+  "[a-c]{3}",
+  "x*",
+  "^ab",
+  "ab$",
+  "^$",
+  "\\bfoo\\b",
+  "\\Bo",
+  "[^a-z]+q",
+  "\\d+\\.\\d*",
+  "\\s+",
+  "\\w+",
+  "\\W+",
+  ".{3}x",
+  "a.*b.*c",
+  "(?:ab|cd)+",
+  "\xC3\xA9+",
+  "[\\x80-\\xff]+z",
+  "[^\\x00-\\x7f]+",
+  "\xFF\xFE?a",
+  "a(?=b)",
+  "a(?!b)",
+  "(?>a+)b",
+  "a++b",
+  "(a|b)+?c"
+  };
+
+
+// Parse modes to check
+static const FXint parsemodes[]={
+  FXRex::Normal,
+  FXRex::Capture,
+  FXRex::Capture|FXRex::IgnoreCase,
+  FXRex::Capture|FXRex::Newline
+  };
+
+
+// Match modes to check
+static const FXint matchmodes[]={
+  FXRex::Normal,
+  FXRex::NotBol,
+  FXRex::NotEol,
+  FXRex::NotEmpty
+  };
+
+
+// Bytes from which subjects are made
+static const FXchar alphabet[]="aabbcdxyzq0 19.\n_foAB\xC3\xA9\x80\xFF\xFE";
+
+
+// Subject delivered in pieces of a few bytes; each piece is copied into a
+// buffer, so the matcher may not look at a piece after the next is fetched
+class Pieces : public FXRexInput {
+  const FXString &string;
+  FXint           size;
+  FXchar          buffer[16];
+public:
+  Pieces(const FXString& str,FXint sz):string(str),size(sz){ }
+  virtual const FXchar* fetch(FXint pos,FXint& beg,FXint& end){
+    if(pos<0 || string.length()<=pos) return nullptr;
+    beg=pos-pos%size;
+    end=FXMIN(beg+size,string.length());
+    memcpy(buffer,string.text()+beg,end-beg);
+    return buffer;
+    }
+  };
+
+
+// Make random subject
+static FXString subject(FXRandom& random){
+  FXint len=random.randLong()%48;
+  FXString result;
+  for(FXint i=0; i<len; ++i){
+    result.append(alphabet[random.randLong()%(ARRAYNUMBER(alphabet)-1)]);
+    }
+  return result;
+  }
+
+
+// Print match failure
+static void failure(const FXchar* what,const FXchar* pattern,FXint pmode,FXint mmode,const FXString& string,FXint pos,FXint r1,FXint r2){
+  fxmessage("%s: pattern \"%s\" parse mode %x match mode %x subject \"%s\" at %d: %d vs %d\n",what,pattern,pmode,mmode,FXString::escape(string,0,0,1).text(),pos,r1,r2);
+  }
+
+
+// Compare captures
+static FXbool samecaptures(const FXint* b1,const FXint* e1,const FXint* b2,const FXint* e2){
+  for(FXint i=0; i<NCAP; ++i){
+    if(b1[i]!=b2[i] || e1[i]!=e2[i]) return false;
+    }
+  return true;
+  }
+
+
+// Check anchored matches of the lock-step simulation against backtracking
+static FXint checkmatch(const FXRex& rex,const FXchar* pattern,FXint pmode,FXint mmode,const FXString& string){
+  FXint b1[NCAP],e1[NCAP],b2[NCAP],e2[NCAP];
+  FXint errors=0,pos,r1,r2,r3;
+  for(pos=0; pos<=string.length(); ++pos){
+    Pieces input(string,1+pos%5);
+    fillElms(b1,-1,NCAP); fillElms(e1,-1,NCAP);
+    fillElms(b2,-1,NCAP); fillElms(e2,-1,NCAP);
+    r1=rex.amatch(string,pos,mmode|FXRex::Backtrack,b1,e1,NCAP);
+    r2=rex.amatch(input,pos,mmode,b2,e2,NCAP);
+    if(r1!=r2 || (r1 && !samecaptures(b1,e1,b2,e2))){ failure("amatch input",pattern,pmode,mmode,string,pos,r1,r2); errors++; }
+    fillElms(b2,-1,NCAP); fillElms(e2,-1,NCAP);
+    r3=rex.amatch(string,pos,mmode,b2,e2,NCAP);
+    if(r1!=r3 || (r1 && !samecaptures(b1,e1,b2,e2))){ failure("amatch",pattern,pmode,mmode,string,pos,r1,r3); errors++; }
+    }
+  return errors;
+  }
+
+
+// Check searches against anchored matches at each position, forwards and backwards
+static FXint checksearch(const FXRex& rex,const FXchar* pattern,FXint pmode,FXint mmode,const FXString& string){
+  FXint b1[NCAP],e1[NCAP],b2[NCAP],e2[NCAP];
+  FXint errors=0,fm,to,pos,r1,r2;
+  for(fm=0; fm<=string.length(); fm+=1+fm%3){
+    to=string.length()-(string.length()-fm)/3;
+
+    // Forward, trying each position from fm to to
+    fillElms(b1,-1,NCAP); fillElms(e1,-1,NCAP);
+    fillElms(b2,-1,NCAP); fillElms(e2,-1,NCAP);
+    for(r1=-1,pos=fm; pos<=to; ++pos){
+      if(rex.amatch(string,pos,mmode,b1,e1,NCAP)){ r1=pos; break; }
+      }
+    r2=rex.search(string,fm,to,mmode,b2,e2,NCAP);
+    if(r1!=r2 || (0<=r1 && !samecaptures(b1,e1,b2,e2))){ failure("search",pattern,pmode,mmode,string,fm,r1,r2); errors++; }
+    fillElms(b2,-1,NCAP); fillElms(e2,-1,NCAP);
+    r2=rex.search(string,fm,to,mmode|FXRex::Backtrack,b2,e2,NCAP);
+    if(r1!=r2 || (0<=r1 && !samecaptures(b1,e1,b2,e2))){ failure("search backtrack",pattern,pmode,mmode,string,fm,r1,r2); errors++; }
+    if(fm<=to){
+      Pieces input(string,1+fm%7);
+      fillElms(b2,-1,NCAP); fillElms(e2,-1,NCAP);
+      r2=rex.search(input,fm,to,mmode,b2,e2,NCAP);
+      if(r1!=r2 || (0<=r1 && !samecaptures(b1,e1,b2,e2))){ failure("search input",pattern,pmode,mmode,string,fm,r1,r2); errors++; }
+      }
+
+    // Backward, trying each position from to down to fm
+    fillElms(b1,-1,NCAP); fillElms(e1,-1,NCAP);
+    fillElms(b2,-1,NCAP); fillElms(e2,-1,NCAP);
+    for(r1=-1,pos=to; fm<=pos; --pos){
+      if(rex.amatch(string,pos,mmode,b1,e1,NCAP)){ r1=pos; break; }
+      }
+    r2=rex.search(string,to,fm,mmode,b2,e2,NCAP);
+    if(r1!=r2 || (0<=r1 && !samecaptures(b1,e1,b2,e2))){ failure("search backward",pattern,pmode,mmode,string,to,r1,r2); errors++; }
+    }
+  return errors;
+  }
+
+
+// Long subjects which exhaust the backtracking budget, so that matching
+// switches over to the lock-step simulation
+static FXint checkbudget(){
+  FXint b1[NCAP],e1[NCAP],b2[NCAP],e2[NCAP];
+  FXint errors=0,r1,r2;
+  FXString string;
+  FXRex rex;
+  string.assign('x',200);
+  rex.parse("(x+x+)+y",FXRex::Capture);
+  fillElms(b1,-1,NCAP); fillElms(e1,-1,NCAP);
+  fillElms(b2,-1,NCAP); fillElms(e2,-1,NCAP);
+  r1=rex.search(string,0,string.length(),FXRex::Normal,b1,e1,NCAP);
+  r2=rex.search(string+"y",0,string.length(),FXRex::Normal,b2,e2,NCAP);
+  if(r1!=-1){ fxmessage("budget: no match expected, got %d\n",r1); errors++; }
+  if(r2!=0 || b2[0]!=0 || e2[0]!=201){ fxmessage("budget: match expected at 0..201, got %d %d..%d\n",r2,b2[0],e2[0]); errors++; }
+  string.assign('a',200);
+  rex.parse("(a|aa)*b",FXRex::Capture);
+  r1=rex.amatch(string,0,FXRex::Normal,b1,e1,NCAP);
+  if(r1){ fxmessage("budget: no match expected\n"); errors++; }
+  return errors;
+  }
+
+
+// Check searches of a set of patterns against searching for each pattern by itself
+static FXint checkset(const FXRexSet& set,FXint mode,const FXString& string){
+  FXint b1[ARRAYNUMBER(patterns)],e1[ARRAYNUMBER(patterns)];
+  FXint b2[ARRAYNUMBER(patterns)],e2[ARRAYNUMBER(patterns)];
+  FXint errors=0,fm,to,i,r1,r2,n1,n2;
+  for(fm=0; fm<=string.length(); fm+=1+fm%4){
+    to=string.length()-(string.length()-fm)/3;
+
+    // Forward and backward
+    for(FXint dir=0; dir<2; ++dir){
+      if(dir){ FXint t=fm; fm=to; to=t; }
+
+      // Each pattern by itself
+      for(i=n1=0,r1=-1; i<set.no(); ++i){
+        if(0<=set[i].search(string,fm,to,mode,&b1[i],&e1[i],1)){
+          if(r1<0 || (fm<=to ? b1[i]<b1[r1] : b1[i]>b1[r1])) r1=i;
+          n1++;
+          }
+        else{
+          b1[i]=e1[i]=-1;
+          }
+        }
+
+      // First match of any pattern
+      r2=set.search(string,fm,to,mode,b2,e2);
+      if(r1!=r2 || (0<=r1 && (b1[r1]!=b2[0] || e1[r1]!=e2[0]))){
+        fxmessage("set search: mode %x subject \"%s\" from %d to %d: pattern %d vs %d\n",mode,FXString::escape(string,0,0,1).text(),fm,to,r1,r2);
+        errors++;
+        }
+
+      // First match of each pattern
+      n2=set.searchAll(string,fm,to,mode,b2,e2);
+      for(i=0; i<set.no(); ++i){
+        if(b1[i]!=b2[i] || e1[i]!=e2[i]){
+          fxmessage("set searchAll: pattern \"%s\" mode %x subject \"%s\" from %d to %d: %d..%d vs %d..%d\n",patterns[i],mode,FXString::escape(string,0,0,1).text(),fm,to,b1[i],e1[i],b2[i],e2[i]);
+          errors++;
+          }
+        }
+      if(n1!=n2){ fxmessage("set searchAll: %d vs %d patterns matched\n",n1,n2); errors++; }
+
+      if(dir){ FXint t=fm; fm=to; to=t; }
+      }
+    }
+  return errors;
+  }
+
+
+// Check cache hits and eviction of least recently used patterns
+static FXint checkcache(){
+  FXRexCache cache(3);
+  FXRefPtr<FXRexCache::Pattern> pat,kept;
+  FXint errors=0;
+  FXRex ref;
+
+  // First lookups parse
+  pat=cache.get("abc");
+  if(pat->getError()!=FXRex::ErrOK){ fxmessage("cache: parse failed\n"); errors++; }
+  cache.get("d+e");
+  cache.get("d+e",FXRex::IgnoreCase);
+  if(cache.getMisses()!=3 || cache.getHits()!=0 || cache.no()!=3){ fxmessage("cache: expected 3 misses, got %u misses %u hits %d entries\n",cache.getMisses(),cache.getHits(),cache.no()); errors++; }
+
+  // Same pattern and mode hits, and yields the same program, without copying it
+  ref.parse("abc");
+  kept=cache.get("abc");
+  if(cache.getHits()!=1 || kept!=pat.get() || kept->getRex()!=ref){ fxmessage("cache: expected hit for \"abc\"\n"); errors++; }
+  if(kept->getRex().search("xxabc",5,0,5)!=2){ fxmessage("cache: cached pattern does not match\n"); errors++; }
+
+  // Failed parses are remembered too
+  if(cache.get("a(b")->getError()!=FXRex::ErrParent || cache.get("a(b")->getError()!=FXRex::ErrParent){ fxmessage("cache: expected parse error\n"); errors++; }
+  if(cache.getMisses()!=4 || cache.getHits()!=2 || cache.no()!=3){ fxmessage("cache: expected 4 misses and 2 hits, got %u and %u\n",cache.getMisses(),cache.getHits()); errors++; }
+
+  // Full cache dropped "d+e", the least recently used; "abc" was used since
+  cache.get("abc");
+  cache.get("d+e",FXRex::IgnoreCase);
+  if(cache.getMisses()!=4 || cache.getHits()!=4){ fxmessage("cache: expected \"abc\" and \"d+e\" ignoring case to be kept\n"); errors++; }
+  cache.get("d+e");
+  if(cache.getMisses()!=5 || cache.no()!=3){ fxmessage("cache: expected \"d+e\" to be dropped\n"); errors++; }
+
+  // Now "a(b" was dropped in turn
+  cache.get("a(b");
+  if(cache.getMisses()!=6){ fxmessage("cache: expected \"a(b\" to be dropped\n"); errors++; }
+
+  // Resizing drops everything; patterns handed out remain valid
+  cache.setSize(1);
+  if(cache.no()!=0){ fxmessage("cache: expected empty cache after resize\n"); errors++; }
+  if(kept->getRex().search("xxabc",5,0,5)!=2){ fxmessage("cache: dropped pattern no longer matches\n"); errors++; }
+  cache.get("abc");
+  cache.get("abc");
+  cache.get("def");
+  cache.get("abc");
+  if(cache.getMisses()!=9 || cache.getHits()!=5 || cache.no()!=1){ fxmessage("cache: expected 9 misses and 5 hits, got %u and %u\n",cache.getMisses(),cache.getHits()); errors++; }
+  return errors;
+  }
+
+
+// Start
+int main(int argc,char* argv[]){
+  FXRandom random(1234);
+  FXint errors=0,incremental=0,checked=0;
+  FXRex::Error err;
+  FXString string;
+  FXuint p,m,k,n;
+  FXRex rex;
+
+  // Check simulation against backtracking, over patterns and modes
+  for(p=0; p<ARRAYNUMBER(patterns); ++p){
+    for(m=0; m<ARRAYNUMBER(parsemodes); ++m){
+      if((err=rex.parse(patterns[p],parsemodes[m]))!=FXRex::ErrOK){
+        fxmessage("parse: pattern \"%s\": %s\n",patterns[p],FXRex::getError(err));
+        errors++;
+        continue;
+        }
+      if(m==0 && rex.incremental()) incremental++;
+      for(k=0; k<ARRAYNUMBER(matchmodes); ++k){
+        for(n=0; n<40; ++n){
+          string=subject(random);
+          errors+=checkmatch(rex,patterns[p],parsemodes[m],matchmodes[k],string);
+          checked++;
+          }
+        }
+      }
+    }
+  fxmessage("checked %d subjects, %d of %d patterns simulated in lock-step\n",checked,incremental,(FXint)ARRAYNUMBER(patterns));
+
+  // Check searches against anchored matches, over patterns and modes
+  for(p=0; p<ARRAYNUMBER(patterns); ++p){
+    for(m=0; m<ARRAYNUMBER(parsemodes); ++m){
+      if(rex.parse(patterns[p],parsemodes[m])!=FXRex::ErrOK) continue;
+      for(k=0; k<ARRAYNUMBER(matchmodes); ++k){
+        for(n=0; n<20; ++n){
+          string=subject(random);
+          errors+=checksearch(rex,patterns[p],parsemodes[m],matchmodes[k],string);
+          }
+        }
+      }
+    }
+
+  // Check sets of patterns, searching in between appending patterns
+  for(m=0; m<ARRAYNUMBER(parsemodes); ++m){
+    FXRexSet set;
+    for(p=0; p<ARRAYNUMBER(patterns); ++p){
+      if(set.append(patterns[p],parsemodes[m])!=FXRex::ErrOK){ fxmessage("set: pattern \"%s\" not appended\n",patterns[p]); errors++; continue; }
+      if(p%8==0 || p+1==ARRAYNUMBER(patterns)){
+        for(n=0; n<10; ++n){
+          string=subject(random);
+          errors+=checkset(set,FXRex::Normal,string);
+          errors+=checkset(set,FXRex::Backtrack,string);
+          }
+        }
+      }
+    }
+
+  // Check switch-over when backtracking takes too long
+  errors+=checkbudget();
+
+  // Check cache
+  errors+=checkcache();
+
+  fxmessage("%s\n",errors?"FAILED":"OK");
+  return errors?1:0;
+  }
@@ -0,0 +1,150 @@
+/********************************************************************************
+*                                                                               *
+*                        U n d o   L i s t   T e s t                            *
+*                                                                               *
+*********************************************************************************
+* Copyright (C) 2024 by Jeroen van der Zijp.   All Rights Reserved.             *
+********************************************************************************/
+#include "fx.h"
+
+/*
+  Notes:
+  - Tests for FXUndoList memory budget: fill past the budget, check that the
+    oldest commands were dropped, and that undo and redo still work.
+*/
+
+/*******************************************************************************/
+
+// Document being edited
+static FXint document=0;
+
+// Number of live commands
+static FXint live=0;
+
+
+// Command changing the document from one value to another
+class SetCommand : public FXCommand {
+private:
+  FXint  oldvalue;
+  FXint  newvalue;
+  FXuval payload;
+public:
+  SetCommand(FXint o,FXint n,FXuval p):oldvalue(o),newvalue(n),payload(p){ live++; }
+  virtual void undo(){ document=oldvalue; }
+  virtual void redo(){ document=newvalue; }
+  virtual FXuval size() const { return sizeof(SetCommand)+payload; }
+  virtual ~SetCommand(){ live--; }
+  };
+
+
+// Check condition
+#define CHECK(cond) if(!(cond)){ fxmessage("%s:%d: check failed: %s\n",__FILE__,__LINE__,#cond); errors++; }
+
+
+// Start
+int main(int argc,char* argv[]){
+  const FXuval PAYLOAD=1000;
+  const FXuval COMMAND=sizeof(SetCommand)+PAYLOAD;
+  const FXint  COUNT=100;
+  FXint errors=0;
+  FXint i,n;
+
+  // Fill past the budget
+  {
+    FXUndoList undolist;
+    undolist.setMaxSize(10*COMMAND);
+    undolist.setKeepSize(5*COMMAND);
+    document=0;
+    for(i=1; i<=COUNT; ++i){
+      undolist.add(new SetCommand(i-1,i,PAYLOAD),true);
+      CHECK(undolist.size()<=undolist.getMaxSize());
+      CHECK(live==undolist.undoCount());
+      }
+    n=undolist.undoCount();
+    fxmessage("kept %d of %d commands, %lu bytes\n",n,COUNT,undolist.size());
+    CHECK(document==COUNT);
+    CHECK(0<n && n<COUNT);
+    CHECK(undolist.size()==n*COMMAND);
+
+    // Remaining commands are the most recent ones
+    for(i=0; i<n; ++i){
+      CHECK(undolist.canUndo());
+      undolist.undo();
+      CHECK(document==COUNT-i-1);
+      }
+    CHECK(!undolist.canUndo());
+    CHECK(document==COUNT-n);
+
+    // Redo all the way back
+    for(i=0; i<n; ++i){
+      CHECK(undolist.canRedo());
+      undolist.redo();
+      }
+    CHECK(!undolist.canRedo());
+    CHECK(document==COUNT);
+
+    // Adding after some undos drops redo commands and stays in budget
+    undolist.undo();
+    undolist.undo();
+    undolist.add(new SetCommand(document,-1,PAYLOAD),true);
+    CHECK(document==-1);
+    CHECK(!undolist.canRedo());
+    CHECK(undolist.size()<=undolist.getMaxSize());
+    undolist.undo();
+    CHECK(document==COUNT-2);
+    undolist.redo();
+    CHECK(document==-1);
+  }
+  CHECK(live==0);
+
+  // Most recent command is kept even if it exceeds the budget
+  {
+    FXUndoList undolist;
+    undolist.setMaxSize(10*COMMAND);
+    undolist.setKeepSize(5*COMMAND);
+    document=0;
+    for(i=1; i<=5; ++i){
+      undolist.add(new SetCommand(i-1,i,PAYLOAD),true);
+      }
+    undolist.add(new SetCommand(5,6,20*COMMAND),true);
+    CHECK(undolist.undoCount()==1);
+    CHECK(live==1);
+    undolist.undo();
+    CHECK(document==5);
+    undolist.redo();
+    CHECK(document==6);
+  }
+  CHECK(live==0);
+
+  // Command groups count toward the budget as a whole
+  {
+    FXUndoList undolist;
+    undolist.setMaxSize(10*COMMAND);
+    undolist.setKeepSize(5*COMMAND);
+    document=0;
+    for(i=1; i<=COUNT; i+=4){
+      undolist.begin(new FXCommandGroup);
+      for(n=i; n<i+4; ++n){
+        undolist.add(new SetCommand(n-1,n,PAYLOAD),true);
+        }
+      undolist.end();
+      CHECK(undolist.size()<=undolist.getMaxSize());
+      }
+    n=undolist.undoCount();
+    CHECK(document==COUNT);
+    CHECK(0<n && n<COUNT/4);
+    CHECK(live==4*n);
+    for(i=0; i<n; ++i){
+      undolist.undo();
+      CHECK(document==COUNT-4*(i+1));
+      }
+    while(undolist.canRedo()){
+      undolist.redo();
+      }
+    CHECK(document==COUNT);
+  }
+  CHECK(live==0);
+
+  fxmessage("%s\n",errors?"FAILED":"OK");
+  return errors?1:0;
+  }
@@ -13,6 +13,7 @@ void printusage(const char* prog){
   fxmessage("%s options:\n",prog);
   fxmessage("  --load <file>            Load xml file.\n");
   fxmessage("  --save <file>            Save xml file.\n");
+  fxmessage("  --spans                  Print tags and text as passed to low-level callbacks.\n");
   fxmessage("  --oasis <dir>            Run OASIS tests from directory <dir>.\n");
   fxmessage("  --tracelevel <level>     Set trace level.\n");
   fxmessage("  -v, --verbose            Increase verbosity level.\n");
@@ -91,12 +92,45 @@ FXXML::Error endDocument(){
 
 /*******************************************************************************/
 
+// Print the low-level callbacks, decoding spans as we go
+
+// Start tag
+FXXML::Error startTag(const FXXML::Span& tag,const FXXML::Attribute* atts,FXint n){
+  FXString value;
+  fxmessage("startTag(%.*s",tag.length,tag.text);
+  for(FXint i=0; i<n; ++i){
+    if(!FXXML::decode(value,atts[i].value)) return FXXML::ErrReference;
+    fxmessage(",%.*s=\"%s\"",atts[i].name.length,atts[i].name.text,value.text());
+    }
+  fxmessage(")\n");
+  return FXXML::ErrOK;
+  }
+
+
+// Text
+FXXML::Error text(const FXXML::Span& span){
+  FXString value;
+  if(!FXXML::decode(value,span)) return FXXML::ErrReference;
+  fxmessage("text(%s)\n",value.text());
+  return FXXML::ErrOK;
+  }
+
+
+// End tag
+FXXML::Error endTag(const FXXML::Span& tag){
+  fxmessage("endTag(%.*s)\n",tag.length,tag.text);
+  return FXXML::ErrOK;
+  }
+
+/*******************************************************************************/
+
 // Test XML I/O
 int main(int argc,char *argv[]){
   const FXchar* xmltests="xmltests.json";
   const FXchar* loadfile=nullptr;
   const FXchar* savefile=nullptr;
   const FXchar* oasisdir=nullptr;
+  FXbool spans=false;
   FXint verbosity=0;
 
   // Grab a few arguments
@@ -116,6 +150,9 @@ int main(int argc,char *argv[]){
       if(++arg>=argc){ fxmessage("Missing load filename argument.\n"); exit(1); }
       loadfile=argv[arg];
       }
+    else if(strcmp(argv[arg],"--spans")==0){
+      spans=true;
+      }
     else if(strcmp(argv[arg],"--oasis")==0){
       if(++arg>=argc){ fxmessage("Missing oasis directory argument.\n"); exit(1); }
       oasisdir=argv[arg];
@@ -199,6 +236,13 @@ int main(int argc,char *argv[]){
   xmlinput.endElementCB.connect<endElement>();
   xmlinput.endDocumentCB.connect<endDocument>();
 
+  // Print low-level callbacks instead
+  if(spans){
+    xmlinput.startTagCB.connect<startTag>();
+    xmlinput.textCB.connect<text>();
+    xmlinput.endTagCB.connect<endTag>();
+    }
+
   // Open save file
   if(savefile){
     if(!xmloutput.open(savefile,FXXML::Save)){